@@ -159,9 +159,9 @@ PublicDependencyModuleNames.AddRange(new string[]
                 "LandscapeEditor","LandscapeEditorUtilities","Foliage","FoliageEdit",
                 "AnimGraph","AnimationBlueprintLibrary","Persona","ToolMenus","EditorWidgets","PropertyEditor","LevelEditor",
                 "RigVM","RigVMDeveloper","UMG","UMGEditor","MergeActors",
-                "RenderCore", "RHI", "AutomationController", "GameplayDebugger", "TraceLog", "TraceAnalysis", "AIGraph",
+                "RenderCore", "RHI", "ImageWrapper", "AutomationController", "GameplayDebugger", "TraceLog", "TraceAnalysis", "TraceServices", "AIGraph",
                 "MeshUtilities", "MaterialUtilities", "PhysicsCore", "ClothingSystemRuntimeCommon",
-                "GeometryCore", "GeometryFramework", "DynamicMesh", "MeshDescription", "StaticMeshDescription",
+                "GeometryCore", "GeometryFramework", "DynamicMesh", "MeshDescription", "StaticMeshDescription", "SkeletalMeshDescription", "AnimationCore",
                 "NavigationSystem"
                 // Optional plugins are handled by AddOptionalDynamicModule() below with delay-load
             });
@@ -1292,6 +1292,56 @@ bool FMcpNativeTransport::HasPendingRequest(const FString& RequestId) const
 	return SSEConnections.Contains(RequestId);
 }
 
+FString FMcpNativeTransport::GetSessionIdForRequest(const FString& RequestId) const
+{
+	FScopeLock Lock(&SSEConnectionsMutex);
+	const TSharedPtr<FSSEConnection>* Found = SSEConnections.Find(RequestId);
+	return (Found && Found->IsValid()) ? (*Found)->SessionId : FString();
+}
+
+bool FMcpNativeTransport::SendSessionNotification(const FString& SessionId,
+	const FString& Method, const TSharedPtr<FJsonObject>& Params)
+{
+	if (SessionId.IsEmpty())
+	{
+		return false;
+	}
+
+	// Snapshot under lock, I/O outside (same pattern as BroadcastToolsListChanged)
+	TArray<TSharedPtr<FNotificationStream>> Snapshot;
+	{
+		FScopeLock Lock(&NotificationStreamsMutex);
+		for (auto& [StreamId, Stream] : NotificationStreams)
+		{
+			if (Stream.IsValid() && !Stream->bMarkedForRemoval.load()
+				&& Stream->SessionId == SessionId)
+			{
+				Snapshot.Add(Stream);
+			}
+		}
+	}
+
+	if (Snapshot.Num() == 0)
+	{
+		return false;
+	}
+
+	const FString NotificationJson = FMcpJsonRpc::BuildNotification(Method, Params);
+	bool bAnyWritten = false;
+	for (const auto& Stream : Snapshot)
+	{
+		if (WriteNotificationEvent(*Stream, NotificationJson))
+		{
+			bAnyWritten = true;
+		}
+		else
+		{
+			Stream->bMarkedForRemoval.store(true);
+		}
+	}
+	return bAnyWritten;
+}
+
 void FMcpNativeTransport::TouchPendingRequest(const FString& RequestId)
 {
 	FScopeLock Lock(&SSEConnectionsMutex);
@@ -60,6 +60,17 @@ public:
 	void SendSSEProgressUpdate(const FString& RequestId, float Percent,
 		const FString& Message);
 
+	/** Session that issued a pending tools/call request (empty if unknown). */
+	FString GetSessionIdForRequest(const FString& RequestId) const;
+
+	/**
+	 * Write a JSON-RPC notification to the session's persistent notification
+	 * streams (GET /mcp). Safe to call from any thread. Returns false if the
+	 * session has no open stream or every write failed.
+	 */
+	bool SendSessionNotification(const FString& SessionId, const FString& Method,
+		const TSharedPtr<FJsonObject>& Params);
+
 	/** Clean up requests that have exceeded the timeout. Called from Tick. */
 	void CleanupStaleRequests();
 
@@ -130,6 +130,33 @@ FMcpSchemaBuilder& FMcpSchemaBuilder::Array(const FString& Name, const FString&
 	return *this;
 }
 
+FMcpSchemaBuilder& FMcpSchemaBuilder::StringOrArray(const FString& Name, const FString& Description,
+	const FString& ItemType)
+{
+	auto Prop = MakeShared<FJsonObject>();
+	if (!Description.IsEmpty())
+	{
+		Prop->SetStringField(TEXT("description"), Description);
+	}
+
+	auto StringSchema = MakeShared<FJsonObject>();
+	StringSchema->SetStringField(TEXT("type"), TEXT("string"));
+
+	auto Items = MakeShared<FJsonObject>();
+	Items->SetStringField(TEXT("type"), ItemType);
+	auto ArraySchema = MakeShared<FJsonObject>();
+	ArraySchema->SetStringField(TEXT("type"), TEXT("array"));
+	ArraySchema->SetObjectField(TEXT("items"), Items);
+
+	TArray<TSharedPtr<FJsonValue>> OneOf;
+	OneOf.Add(MakeShared<FJsonValueObject>(StringSchema));
+	OneOf.Add(MakeShared<FJsonValueObject>(ArraySchema));
+	Prop->SetArrayField(TEXT("oneOf"), OneOf);
+
+	AddProperty(Name, Prop);
+	return *this;
+}
+
 FMcpSchemaBuilder& FMcpSchemaBuilder::ArrayOfObjects(const FString& Name,
 	const FString& Description, TFunction<void(FMcpSchemaBuilder&)> ItemBuilder)
 {
@@ -48,6 +48,10 @@ public:
 	FMcpSchemaBuilder& Array(const FString& Name, const FString& Description,
 		const FString& ItemType = TEXT("string"));
 
+	/** Property that is either a string or an array of ItemType (oneOf), e.g. base64 or number-array buffers. */
+	FMcpSchemaBuilder& StringOrArray(const FString& Name, const FString& Description,
+		const FString& ItemType = TEXT("number"));
+
 	/** Array of objects property with item schema. */
 	FMcpSchemaBuilder& ArrayOfObjects(const FString& Name, const FString& Description,
 		TFunction<void(FMcpSchemaBuilder&)> ItemBuilder = nullptr);
@@ -1,4 +1,4 @@
-// McpTool_AnimationPhysics.cpp — animation_physics tool definition (55 actions)
+// McpTool_AnimationPhysics.cpp — animation_physics tool definition (57 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -55,6 +55,8 @@ public:
 				TEXT("add_bone_track"),
 				TEXT("set_bone_key"),
 				TEXT("set_curve_key"),
+				TEXT("set_bone_track_keys"),
+				TEXT("set_curves"),
 				TEXT("create_montage"),
 				TEXT("add_montage_section"),
 				TEXT("add_montage_slot"),
@@ -123,6 +125,29 @@ public:
 				S.Number(TEXT("x")).Number(TEXT("y")).Number(TEXT("z"));
 			})
 			.FreeformObject(TEXT("value"), TEXT("Generic value (any type)."))
+			.String(TEXT("assetPath"), TEXT("Asset path (e.g., /Game/Path/Asset)."))
+			.ArrayOfObjects(TEXT("tracks"), TEXT("set_bone_track_keys: packed keys per bone."), [](FMcpSchemaBuilder& Item)
+			{
+				Item.String(TEXT("boneName"), TEXT("Name of the bone."))
+					.String(TEXT("positions"), TEXT("x, y, z per key (base64 little-endian float32 or number array)."))
+					.String(TEXT("rotations"), TEXT("x, y, z, w per key, or pitch, yaw, roll with rotationFormat euler."))
+					.String(TEXT("scales"), TEXT("x, y, z per key. A single key holds for the whole sequence."));
+			})
+			.ArrayOfObjects(TEXT("curves"), TEXT("set_curves / set_bone_track_keys: packed float curves."), [](FMcpSchemaBuilder& Item)
+			{
+				Item.String(TEXT("curveName"), TEXT("Name of the curve."))
+					.String(TEXT("values"), TEXT("One value per key (base64 little-endian float32 or number array)."))
+					.String(TEXT("times"), TEXT("Key times in seconds (optional)."))
+					.String(TEXT("frames"), TEXT("Key frames (optional; defaults to 0, 1, 2...)."))
+					.String(TEXT("interpolation"), TEXT("cubic, linear or constant."));
+			})
+			.StringEnum(TEXT("rotationFormat"), {TEXT("quat"), TEXT("euler")},
+				TEXT("Layout of set_bone_track_keys rotations (quat by default)."))
+			.Number(TEXT("numFrames"), TEXT("Resize the sequence to this many frames (default: longest track)."))
+			.Number(TEXT("frameRate"), TEXT("Sampling frame rate to set before writing."))
+			.Bool(TEXT("createIfMissing"), TEXT("Create curves that do not exist yet."))
+			.Bool(TEXT("recompress"), TEXT("Request one asynchronous recompression after writing (default true)."))
+			.Bool(TEXT("save"), TEXT("Save the asset after writing."))
 			.Bool(TEXT("enabled"), TEXT("Whether the item/feature is enabled."))
 			.String(TEXT("rigPath"), TEXT("Asset path (e.g., /Game/Path/Asset)."))
 			.String(TEXT("chainName"), TEXT(""))
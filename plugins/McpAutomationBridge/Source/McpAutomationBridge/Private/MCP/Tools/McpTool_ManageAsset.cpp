@@ -1,4 +1,4 @@
-// McpTool_ManageAsset.cpp — manage_asset tool definition (45 actions)
+// McpTool_ManageAsset.cpp — manage_asset tool definition (48 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -66,7 +66,10 @@ public:
 				TEXT("remove_material_node"),
 				TEXT("break_material_connections"),
 				TEXT("get_material_node_details"),
-				TEXT("rebuild_material")
+				TEXT("rebuild_material"),
+				TEXT("flush_saves"),
+				TEXT("get_save_queue"),
+				TEXT("benchmark_asset_saves")
 			}, TEXT("Action to perform"))
 			.String(TEXT("assetPath"), TEXT("Asset path (e.g., /Game/Path/Asset)."))
 			.String(TEXT("directory"), TEXT("Path to a directory."))
@@ -144,6 +147,10 @@ public:
 			.String(TEXT("type"), TEXT(""))
 			.FreeformObject(TEXT("defaultValue"), TEXT("Generic value (any type)."))
 			.String(TEXT("expressionIndex"), TEXT("ID of the node."))
+			.Bool(TEXT("flushSaves"), TEXT("Write queued asset saves and save this request's assets before responding."))
+			.Bool(TEXT("includePackages"), TEXT("get_save_queue: list queued package names (default true)."))
+			.Integer(TEXT("count"), TEXT("benchmark_asset_saves: assets to author per mode (default 200, max 2000)."))
+			.Bool(TEXT("cleanup"), TEXT("benchmark_asset_saves: delete the benchmark folder afterwards (default true)."))
 			.Required({TEXT("action")})
 			.Build();
 	}
@@ -72,6 +72,9 @@ public:
 				TEXT("create_source_effect_chain"),
 				TEXT("add_source_effect"),
 				TEXT("create_submix_effect"),
+				TEXT("apply_audio_graph"),
+				TEXT("create_sound_assets_from_folder"),
+				TEXT("benchmark_sound_import"),
 				TEXT("get_audio_info")
 			}, TEXT("Action"))
 			.String(TEXT("name"), TEXT("Name identifier."))
@@ -142,6 +145,24 @@ public:
 			.String(TEXT("metasoundNodeType"), TEXT(""))
 			.String(TEXT("soundClassPath"), TEXT("Sound class path."))
 			.String(TEXT("parentClassPath"), TEXT("Parent class path."))
+			.FreeformObject(TEXT("spec"), TEXT("apply_audio_graph: whole cue graph (nodes with inputs, output) or MetaSound graph (graphInputs, graphOutputs, nodes, edges)."))
+			.StringEnum(TEXT("assetType"), {TEXT("SoundCue"), TEXT("MetaSound")},
+				TEXT("apply_audio_graph: type to create when assetPath does not exist."))
+			.String(TEXT("sourceFolder"), TEXT("Folder on disk with the sound files (absolute or project-relative)."))
+			.String(TEXT("destinationPath"), TEXT("Content folder for the imported waves."))
+			.Bool(TEXT("recursive"), TEXT("Include subfolders (mirrored under destinationPath)."))
+			.Array(TEXT("extensions"), TEXT("File extensions to import (default: wav)."), TEXT("string"))
+			.StringEnum(TEXT("wrap"), {TEXT("cue"), TEXT("metasound"), TEXT("none")},
+				TEXT("Wrap each wave in a SoundCue or MetaSound source."))
+			.String(TEXT("wrapPath"), TEXT("Content folder for the wrappers (default: destinationPath/Cues or /MetaSounds)."))
+			.String(TEXT("wrapPrefix"), TEXT("Wrapper name prefix (default: SC_ or MS_)."))
+			.Bool(TEXT("overwrite"), TEXT("Replace existing waves and wrappers instead of skipping them."))
+			.Integer(TEXT("maxFiles"), TEXT("Import at most this many files (0 = all)."))
+			.Number(TEXT("frameBudgetMs"), TEXT("Game-thread import time per editor tick."))
+			.Number(TEXT("timeoutSeconds"), TEXT("create_sound_assets_from_folder / benchmark_sound_import: stop after this many seconds (default and maximum 240)."))
+			.Integer(TEXT("waveCount"), TEXT("benchmark_sound_import: generated waves (default 300)."))
+			.Number(TEXT("durationSeconds"), TEXT("benchmark_sound_import: length of each generated wave."))
+			.Bool(TEXT("cleanup"), TEXT("benchmark_sound_import: delete the generated files and assets afterwards."))
 			.Required({TEXT("action")})
 			.Build();
 	}
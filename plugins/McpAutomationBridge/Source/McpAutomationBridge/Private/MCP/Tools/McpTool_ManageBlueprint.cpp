@@ -1,4 +1,4 @@
-// McpTool_ManageBlueprint.cpp — manage_blueprint tool definition (35 actions)
+// McpTool_ManageBlueprint.cpp — manage_blueprint tool definition (39 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -57,7 +57,11 @@ public:
 				TEXT("get_graph_details"),
 				TEXT("get_pin_details"),
 				TEXT("list_node_types"),
-				TEXT("set_pin_default_value")
+				TEXT("set_pin_default_value"),
+				TEXT("apply_graph"),
+				TEXT("flush_compiles"),
+				TEXT("get_compile_queue"),
+				TEXT("benchmark_compiles")
 			}, TEXT("Blueprint action"))
 			.String(TEXT("name"), TEXT("Name identifier."))
 			.String(TEXT("blueprintPath"), TEXT("Blueprint asset path."))
@@ -145,6 +149,12 @@ public:
 			.String(TEXT("toNodeId"), TEXT("ID of the target node."))
 			.String(TEXT("toPin"), TEXT("Name of the target pin."))
 			.String(TEXT("toPinName"), TEXT("Name of the target pin."))
+			.Bool(TEXT("includeBlueprints"), TEXT("get_compile_queue: list the Blueprints waiting to compile (default true)."))
+			.Integer(TEXT("edits"), TEXT("benchmark_compiles: scripted edits per mode (1-300, default 30)."))
+			.String(TEXT("path"), TEXT("benchmark_compiles: /Game folder for the temporary Blueprints."))
+			.Bool(TEXT("cleanup"), TEXT("benchmark_compiles: delete the temporary Blueprints afterwards (default true)."))
+			.FreeformObject(TEXT("spec"), TEXT("apply_graph: {nodes:[{key,type,x,y,comment,function,variableName,eventName,targetClass,inputAxisName,pins}], links:[{from:'key.Pin',to:'key.Pin'}], prune}."))
+			.Bool(TEXT("prune"), TEXT("apply_graph: remove deletable nodes the spec does not list (default false)."))
 			.Required({TEXT("action")})
 			.Build();
 	}
@@ -1,4 +1,4 @@
-// McpTool_ManageEffect.cpp — manage_effect tool definition (58 actions)
+// McpTool_ManageEffect.cpp — manage_effect tool definition (60 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -80,7 +80,9 @@ public:
 				TEXT("enable_gpu_simulation"),
 				TEXT("add_simulation_stage"),
 				TEXT("get_niagara_info"),
-				TEXT("validate_niagara_system")
+				TEXT("validate_niagara_system"),
+				TEXT("apply_niagara_spec"),
+				TEXT("benchmark_niagara_spec")
 			}, TEXT("Effect/Niagara action to perform."))
 			.String(TEXT("name"), TEXT("Name identifier."))
 			.String(TEXT("assetPath"), TEXT("Asset path (e.g., /Game/Path/Asset)."))
@@ -191,6 +193,14 @@ public:
 			.Bool(TEXT("enabled"), TEXT(""))
 			.String(TEXT("stageName"), TEXT(""))
 			.String(TEXT("stageType"), TEXT(""))
+			.FreeformObject(TEXT("spec"), TEXT("apply_niagara_spec: full system spec (emitters, modules, renderers, userParameters, systemProperties)."))
+			.Bool(TEXT("prune"), TEXT("Remove emitters, renderers and user parameters the spec does not list; disable unlisted modules."))
+			.Bool(TEXT("wait"), TEXT("apply_niagara_spec: wait for VM scripts and GPU shaders to compile (default true)."))
+			.Number(TEXT("timeoutSeconds"), TEXT("apply_niagara_spec / benchmark_niagara_spec: compile wait limit in seconds (default and maximum 240)."))
+			.String(TEXT("sourceEmitter"), TEXT("benchmark_niagara_spec: emitter asset the generated emitters are added from."))
+			.Number(TEXT("emitterCount"), TEXT(""))
+			.Number(TEXT("modulesPerEmitter"), TEXT(""))
+			.Bool(TEXT("save"), TEXT(""))
 			.Number(TEXT("timeoutMs"), TEXT(""))
 			.Required({TEXT("action")})
 			.Build();
@@ -95,7 +95,12 @@ public:
 				TEXT("set_lod_screen_sizes"),
 				TEXT("convert_to_nanite"),
 				TEXT("convert_to_static_mesh"),
-				TEXT("get_mesh_info")
+				TEXT("get_mesh_info"),
+				TEXT("set_mesh_buffers"),
+				TEXT("get_mesh_buffers"),
+				TEXT("apply_geometry_pipeline"),
+				TEXT("cancel_geometry_job"),
+				TEXT("list_geometry_jobs")
 			}, TEXT("Geometry action to perform"))
 			.String(TEXT("meshPath"), TEXT("Mesh asset path."))
 			.String(TEXT("targetMeshPath"),
@@ -227,6 +232,32 @@ public:
 			.Bool(TEXT("save"), TEXT("Save the asset(s) after the operation."))
 			.Bool(TEXT("enableNanite"),
 				TEXT("Enable Nanite for the output mesh."))
+			.StringOrArray(TEXT("positions"),
+				TEXT("set_mesh_buffers: vertex positions, 3 float32 per vertex (base64 little-endian or number array)."))
+			.StringOrArray(TEXT("indices"),
+				TEXT("set_mesh_buffers: triangle indices, 3 uint32 per triangle (base64 little-endian or number array)."))
+			.StringOrArray(TEXT("normals"),
+				TEXT("set_mesh_buffers: optional per-vertex normals, 3 float32 per vertex."))
+			.StringOrArray(TEXT("uvs"),
+				TEXT("set_mesh_buffers: optional per-vertex UVs, 2 float32 per vertex."))
+			.StringOrArray(TEXT("colors"),
+				TEXT("set_mesh_buffers: optional per-vertex RGBA colors, 4 float32 per vertex."))
+			.StringEnum(TEXT("mode"), {
+				TEXT("replace"),
+				TEXT("append")
+			}, TEXT("set_mesh_buffers: replace the mesh (default) or append to it."))
+			.StringEnum(TEXT("encoding"), {
+				TEXT("base64"),
+				TEXT("json")
+			}, TEXT("get_mesh_buffers: return base64 float32/uint32 buffers (default) or number arrays."))
+			.Array(TEXT("include"),
+				TEXT("get_mesh_buffers: optional attribute buffers to return (normals, uvs, colors)."))
+			.ArrayOfObjects(TEXT("ops"),
+				TEXT("apply_geometry_pipeline: ordered ops, each {op, ...params}. op: append_box, append_sphere, append_cylinder, boolean, simplify, remesh_uniform, smooth, weld, fill_holes, recalculate_normals, auto_uv, bevel, transform."))
+			.Bool(TEXT("useCache"),
+				TEXT("apply_geometry_pipeline: reuse cached intermediate meshes for matching op prefixes."))
+			.String(TEXT("jobId"),
+				TEXT("cancel_geometry_job: request ID of a queued or running background geometry job."))
 			.Required({TEXT("action")})
 			.Build();
 	}
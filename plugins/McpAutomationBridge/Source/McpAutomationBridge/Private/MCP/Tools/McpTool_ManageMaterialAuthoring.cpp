@@ -1,4 +1,4 @@
-// McpTool_ManageMaterialAuthoring.cpp — manage_material_authoring tool definition (38 actions)
+// McpTool_ManageMaterialAuthoring.cpp — manage_material_authoring tool definition (44 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -60,7 +60,12 @@ public:
 				TEXT("add_landscape_layer"),
 				TEXT("configure_layer_blend"),
 				TEXT("compile_material"),
-				TEXT("get_material_info")
+				TEXT("get_material_info"),
+				TEXT("begin_material_edit"),
+				TEXT("commit_material_edit"),
+				TEXT("get_material_edit_status"),
+				TEXT("apply_material_graph"),
+				TEXT("benchmark_material_graph")
 			}, TEXT("Material authoring action to perform"))
 			.String(TEXT("assetPath"), TEXT("Asset path (e.g., /Game/Path/Asset)."))
 			.String(TEXT("name"), TEXT("Name identifier."))
@@ -184,6 +189,20 @@ public:
 			.ArrayOfObjects(TEXT("layers"),
 				TEXT("Array of layer configurations for layer blend."))
 			.Bool(TEXT("save"), TEXT("Save the asset(s) after the operation."))
+			.Number(TEXT("maxSeconds"),
+				TEXT("begin_material_edit: commit the session automatically after this many seconds (default 300)."))
+			.Bool(TEXT("wait"),
+				TEXT("compile_material/commit_material_edit/apply_material_graph: respond once shaders finish compiling, with progress and structured compile errors."))
+			.Number(TEXT("timeoutSeconds"),
+				TEXT("Maximum seconds to wait for shader compilation (default and maximum 240, under the client request cap)."))
+			.FreeformObject(TEXT("graph"),
+				TEXT("apply_material_graph: full graph spec {nodes:[{key,type,x,y,parameterName,defaultValue,texture,function,properties}], parameters:[{name,type}], edges:[{from,output,to,input}] (to \"Main\" = material input), materialProperties, prune}."))
+			.String(TEXT("spec"),
+				TEXT("apply_material_graph: text form of the graph, one statement per line (node/param/edge/set/prune)."))
+			.Bool(TEXT("prune"),
+				TEXT("apply_material_graph: delete expressions and clear links the spec does not list (default false)."))
+			.Number(TEXT("nodeCount"),
+				TEXT("benchmark_material_graph: nodes in the generated master material (default 100)."))
 			.Required({TEXT("action")})
 			.Build();
 	}
@@ -1,4 +1,4 @@
-// McpTool_ManageNavigation.cpp — manage_navigation tool definition (12 actions)
+// McpTool_ManageNavigation.cpp — manage_navigation tool definition (20 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -33,7 +33,15 @@ public:
 				TEXT("set_nav_link_type"),
 				TEXT("create_smart_link"),
 				TEXT("configure_smart_link_behavior"),
-				TEXT("get_navigation_info")
+				TEXT("get_navigation_info"),
+				TEXT("find_paths"),
+				TEXT("reachability_matrix"),
+				TEXT("project_points_to_navmesh"),
+				TEXT("benchmark_navigation_queries"),
+				TEXT("begin_nav_batch"),
+				TEXT("end_nav_batch"),
+				TEXT("get_nav_build_status"),
+				TEXT("benchmark_nav_rebuild")
 			}, TEXT("Navigation action to perform"))
 			.String(TEXT("navMeshPath"), TEXT("Path to NavMesh data asset."))
 			.String(TEXT("actorName"), TEXT("Name of the actor."))
@@ -94,7 +102,7 @@ public:
 				S.Number(TEXT("x")).Number(TEXT("y")).Number(TEXT("z"));
 			})
 			.String(TEXT("obstacleAreaClass"), TEXT("Area class for box obstacle."))
-			.Object(TEXT("location"), TEXT("World location for nav link proxy."),
+			.Object(TEXT("location"), TEXT("World location for nav link proxy; benchmark_nav_rebuild row centre."),
 				[](FMcpSchemaBuilder& S) {
 				S.Number(TEXT("x")).Number(TEXT("y")).Number(TEXT("z"));
 			})
@@ -102,6 +110,35 @@ public:
 				[](FMcpSchemaBuilder& S) {
 				S.Number(TEXT("pitch")).Number(TEXT("yaw")).Number(TEXT("roll"));
 			})
+			.ArrayOfObjects(TEXT("pairs"), TEXT("find_paths: start/end pairs (point = {x,y,z}, [x,y,z] or actor name)."),
+				[](FMcpSchemaBuilder& Item) {
+				Item.FreeformObject(TEXT("start"), TEXT("Start point."))
+					.FreeformObject(TEXT("end"), TEXT("End point."));
+			})
+			.Array(TEXT("sources"), TEXT("reachability_matrix: source points or actor names."), TEXT("object"))
+			.Array(TEXT("targets"), TEXT("reachability_matrix: target points or actor names."), TEXT("object"))
+			.Array(TEXT("points"), TEXT("project_points_to_navmesh: points or actor names."), TEXT("object"))
+			.StringEnum(TEXT("mode"), {TEXT("path"), TEXT("test"), TEXT("full"), TEXT("incremental")},
+				TEXT("reachability_matrix: path lengths (path) or existence only (test, faster). "
+					"rebuild_navigation: full rebuild (default) or incremental (dirty tiles only, waits with progress)."))
+			.Bool(TEXT("includePoints"), TEXT("find_paths: return path points as flat x,y,z arrays."))
+			.Number(TEXT("simplifyTolerance"), TEXT("find_paths: drop path points within this distance (0 keeps all)."))
+			.Object(TEXT("queryExtent"), TEXT("Projection extent (default: navmesh query extent)."),
+				[](FMcpSchemaBuilder& S) {
+				S.Number(TEXT("x")).Number(TEXT("y")).Number(TEXT("z"));
+			})
+			.String(TEXT("filterClass"), TEXT("NavigationQueryFilter class path."))
+			.Bool(TEXT("projectEndpoints"), TEXT("Project path endpoints onto the navmesh first (default true)."))
+			.Bool(TEXT("allowPartial"), TEXT("reachability_matrix: count partial paths as reachable."))
+			.Bool(TEXT("parallel"), TEXT("Run queries on worker threads (default true)."))
+			.Number(TEXT("numPaths"), TEXT("benchmark_navigation_queries: random pairs to path (default 2000)."))
+			.Number(TEXT("iterations"), TEXT("benchmark_navigation_queries: timed runs per mode (default 3)."))
+			.Number(TEXT("maxSeconds"), TEXT("begin_nav_batch: resume building after this long if not ended (default 600)."))
+			.Bool(TEXT("wait"), TEXT("end_nav_batch: respond once the navmesh is up to date (default true)."))
+			.Number(TEXT("timeoutSeconds"), TEXT("Wait limit for rebuilds and for queries waiting on dirty tiles (default 120; benchmark_nav_rebuild 240; at most 240, under the client request cap)."))
+			.Number(TEXT("actorCount"), TEXT("benchmark_nav_rebuild: actors placed per mode (default 100)."))
+			.Number(TEXT("spacing"), TEXT("benchmark_nav_rebuild: distance between placed actors (default 300)."))
+			.Number(TEXT("actorScale"), TEXT("benchmark_nav_rebuild: scale of the placed cubes (default 2)."))
 			.String(TEXT("filter"), TEXT("General search filter."))
 			.Bool(TEXT("save"), TEXT("Save the asset(s) after the operation."))
 			.Required({TEXT("action")})
@@ -1,4 +1,4 @@
-// McpTool_ManagePerformance.cpp — manage_performance tool definition (20 actions)
+// McpTool_ManagePerformance.cpp — manage_performance tool definition (22 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -29,6 +29,8 @@ public:
 				TEXT("show_fps"),
 				TEXT("show_stats"),
 				TEXT("generate_memory_report"),
+				TEXT("diff_memory_reports"),
+				TEXT("get_request_profile"),
 				TEXT("set_scalability"),
 				TEXT("set_resolution_scale"),
 				TEXT("set_vsync"),
@@ -80,6 +82,19 @@ public:
 			.Number(TEXT("streamingPoolSize"), TEXT(""))
 			.Number(TEXT("streamingDistance"), TEXT(""))
 			.Number(TEXT("cellSize"), TEXT(""))
+			.String(TEXT("label"), TEXT("generate_memory_report: label stored with the snapshot."))
+			.Array(TEXT("include"), TEXT("generate_memory_report: sections to capture besides platform (objects, textures, llm; default all)."))
+			.Integer(TEXT("topClasses"), TEXT("generate_memory_report: classes returned in the response (default 50, all when detailed)."))
+			.String(TEXT("baseline"), TEXT("diff_memory_reports: snapshot id or .json path. run_benchmark: earlier benchmarkId or result .json path."))
+			.String(TEXT("current"), TEXT("diff_memory_reports: snapshot id or .json path (default: capture now)."))
+			.Number(TEXT("warmupSeconds"), TEXT("run_benchmark: seconds to run before sampling (0-30, default 2)."))
+			.Number(TEXT("hitchThresholdMs"), TEXT("run_benchmark: frames longer than this count as hitches (default 50)."))
+			.ArrayOfObjects(TEXT("cameraPath"), TEXT("run_benchmark: viewport camera keys ({location, rotation}) followed over the duration."))
+			.String(TEXT("sequencePath"), TEXT("run_benchmark: Level Sequence played while sampling; its length (at most 240 s) sets the duration."))
+			.Number(TEXT("regressionThresholdPct"), TEXT("run_benchmark: percent slower than baseline that counts as a regression (default 10)."))
+			.Integer(TEXT("limit"), TEXT("diff_memory_reports: entries per grown/shrunk list (default 25). get_request_profile: requests returned (default 20, max 256)."))
+			.String(TEXT("actionFilter"), TEXT("get_request_profile: only requests for this automation action."))
+			.Bool(TEXT("reset"), TEXT("get_request_profile: clear the request history after reading it."))
 			.Required({TEXT("action")})
 			.Build();
 	}
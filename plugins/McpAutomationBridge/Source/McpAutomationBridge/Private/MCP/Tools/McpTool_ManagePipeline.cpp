@@ -1,4 +1,4 @@
-// McpTool_ManagePipeline.cpp — manage_pipeline tool definition (3 actions)
+// McpTool_ManagePipeline.cpp — manage_pipeline tool definition (6 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -13,8 +13,9 @@ public:
 	FString GetDescription() const override
 	{
 		return TEXT("Build automation and pipeline control. Actions: run_ubt "
-			"(compile targets), list_categories (show tool categories), "
-			"get_status (bridge status). Routes to system_control internally.");
+			"(compile targets as a background job), get_ubt_job / cancel_ubt_job / "
+			"list_ubt_jobs (follow or stop builds), list_categories (show tool "
+			"categories), get_status (bridge status). Routes to system_control internally.");
 	}
 
 	FString GetCategory() const override { return TEXT("core"); }
@@ -27,15 +28,25 @@ public:
 		return FMcpSchemaBuilder()
 			.StringEnum(TEXT("action"), {
 				TEXT("run_ubt"),
+				TEXT("get_ubt_job"),
+				TEXT("cancel_ubt_job"),
+				TEXT("list_ubt_jobs"),
 				TEXT("list_categories"),
 				TEXT("get_status")
 			}, TEXT("run_ubt: compile with UnrealBuildTool. "
+				"get_ubt_job: job state, new output lines and diagnostics. "
+				"cancel_ubt_job: terminate a build. list_ubt_jobs: recent builds. "
 				"list_categories: show available tool categories. "
 				"get_status: get bridge status."))
 			.String(TEXT("target"), TEXT("Build target name (e.g., MyProjectEditor)"))
 			.String(TEXT("platform"), TEXT("Target platform (Win64, Linux, Mac)"))
 			.String(TEXT("configuration"), TEXT("Build configuration (Development, Shipping, Debug)"))
 			.String(TEXT("arguments"), TEXT("Additional UBT arguments"))
+			.Bool(TEXT("wait"), TEXT("run_ubt: block until the build finishes instead of returning a jobId."))
+			.Number(TEXT("timeoutSeconds"), TEXT("run_ubt: terminate the build after this many seconds (default 3600)."))
+			.String(TEXT("jobId"), TEXT("UBT job id returned by run_ubt."))
+			.Integer(TEXT("sinceLine"), TEXT("get_ubt_job: first output line to return (use the previous nextLine)."))
+			.Integer(TEXT("maxLines"), TEXT("get_ubt_job: maximum output lines to return (default 200)."))
 			.Required({TEXT("action")})
 			.Build();
 	}
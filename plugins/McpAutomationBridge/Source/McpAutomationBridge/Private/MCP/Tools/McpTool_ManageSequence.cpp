@@ -34,6 +34,7 @@ public:
 				TEXT("stop"),
 				TEXT("set_playback_speed"),
 				TEXT("add_keyframe"),
+				TEXT("set_keys"),
 				TEXT("get_properties"),
 				TEXT("set_properties"),
 				TEXT("duplicate"),
@@ -63,6 +64,22 @@ public:
 			.Number(TEXT("frame"), TEXT(""))
 			.FreeformObject(TEXT("value"), TEXT(""))
 			.String(TEXT("property"), TEXT("Name of the property."))
+			.String(TEXT("bindingId"), TEXT("Binding GUID (alternative to actorName)."))
+			.ArrayOfObjects(TEXT("channels"), TEXT("set_keys: per-channel keys (one entry for a float property)."), [](FMcpSchemaBuilder& Item)
+			{
+				Item.String(TEXT("channel"), TEXT("Transform channel (location.x, rotation.yaw, scale.z) or 'value'."))
+					.Array(TEXT("frames"), TEXT("Key times in timeUnit."), TEXT("number"))
+					.Array(TEXT("values"), TEXT("Key values, one per frame."), TEXT("number"))
+					.String(TEXT("interpolation"), TEXT("cubic, linear or constant."))
+					.Number(TEXT("tolerance"), TEXT("Key reduction tolerance for this channel."));
+			})
+			.StringEnum(TEXT("interpolation"), {TEXT("cubic"), TEXT("linear"), TEXT("constant")},
+				TEXT("Default interpolation for set_keys."))
+			.StringEnum(TEXT("timeUnit"), {TEXT("frames"), TEXT("seconds")},
+				TEXT("Unit of set_keys frames (display-rate frames by default)."))
+			.Number(TEXT("tolerance"), TEXT("Drop keys within this value error (0 keeps every key)."))
+			.Bool(TEXT("replace"), TEXT("Remove existing keys inside the written range."))
+			.Bool(TEXT("save"), TEXT("Save the sequence after writing."))
 			.String(TEXT("destinationPath"), TEXT("Destination path for move/copy."))
 			.String(TEXT("newName"), TEXT("New name for renaming."))
 			.Bool(TEXT("overwrite"), TEXT("Overwrite if the asset/file already exists."))
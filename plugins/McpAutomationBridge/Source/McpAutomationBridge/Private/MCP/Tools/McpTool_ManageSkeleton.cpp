@@ -1,4 +1,4 @@
-// McpTool_ManageSkeleton.cpp — manage_skeleton tool definition (29 actions)
+// McpTool_ManageSkeleton.cpp — manage_skeleton tool definition (31 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -37,6 +37,8 @@ public:
 				TEXT("prune_weights"),
 				TEXT("copy_weights"),
 				TEXT("mirror_weights"),
+				TEXT("process_skin_weights"),
+				TEXT("benchmark_skin_weights"),
 				TEXT("create_physics_asset"),
 				TEXT("add_physics_body"),
 				TEXT("configure_physics_body"),
@@ -104,6 +106,14 @@ public:
 			}, TEXT("Axis for weight mirroring."))
 			.FreeformObject(TEXT("mirrorTable"),
 				TEXT("Bone name mapping for mirroring."))
+			.ArrayOfObjects(TEXT("operations"),
+				TEXT("process_skin_weights: ordered ops (normalize, prune, limit_influences, smooth, mirror, auto) "
+					"with their options; names may be given as plain strings."))
+			.Number(TEXT("lodIndex"), TEXT("LOD whose skin weights are edited."))
+			.Number(TEXT("maxInfluences"), TEXT("auto_skin_weights: influences per vertex."))
+			.Number(TEXT("smoothIterations"), TEXT("auto_skin_weights: smoothing passes after proximity weights."))
+			.Array(TEXT("vertexCounts"), TEXT("benchmark_skin_weights: synthetic mesh sizes."), TEXT("number"))
+			.Number(TEXT("iterations"), TEXT("benchmark_skin_weights: runs per kernel."))
 			.StringEnum(TEXT("bodyType"), {
 				TEXT("Capsule"),
 				TEXT("Sphere"),
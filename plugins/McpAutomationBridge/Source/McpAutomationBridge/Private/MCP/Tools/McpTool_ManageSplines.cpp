@@ -158,6 +158,19 @@ public:
 				TEXT("Offset from spline end for last mesh."))
 			.Bool(TEXT("bAlignToSpline"),
 				TEXT("Align scattered meshes to spline direction."))
+			.StringEnum(TEXT("instancingMode"), {
+				TEXT("none"),
+				TEXT("ism"),
+				TEXT("hism")
+			}, TEXT("Scatter output: one component per sample (none, default) or one ISM/HISM component per mesh."))
+			.Array(TEXT("meshPaths"),
+				TEXT("Multiple meshes to distribute across scatter samples."))
+			.Bool(TEXT("clearExisting"),
+				TEXT("Remove components from a previous scatter before scattering."))
+			.Bool(TEXT("useRandomOffset"),
+				TEXT("Jitter scatter samples along the spline."))
+			.Number(TEXT("randomOffsetRange"),
+				TEXT("Maximum jitter distance along the spline."))
 			.Bool(TEXT("bRandomizeRotation"),
 				TEXT("Apply random rotation to scattered meshes."))
 			.Object(TEXT("rotationRandomRange"),
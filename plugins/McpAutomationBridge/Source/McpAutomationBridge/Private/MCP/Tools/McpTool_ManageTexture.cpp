@@ -1,4 +1,4 @@
-// McpTool_ManageTexture.cpp — manage_texture tool definition (21 actions)
+// McpTool_ManageTexture.cpp — manage_texture tool definition (22 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -42,7 +42,8 @@ public:
 				TEXT("set_lod_bias"),
 				TEXT("configure_virtual_texture"),
 				TEXT("set_streaming_priority"),
-				TEXT("get_texture_info")
+				TEXT("get_texture_info"),
+				TEXT("benchmark_image_kernels")
 			}, TEXT("Texture action to perform"))
 			.String(TEXT("assetPath"), TEXT("Asset path (e.g., /Game/Path/Asset)."))
 			.String(TEXT("name"), TEXT("Name identifier."))
@@ -221,6 +222,11 @@ public:
 			.Bool(TEXT("neverStream"), TEXT("Disable texture streaming."))
 			.Number(TEXT("streamingPriority"),
 				TEXT("Streaming priority (-1 to 1, lower = higher priority)."))
+			.Array(TEXT("sizes"),
+				TEXT("Square image sizes for benchmark_image_kernels (default [2048, 4096, 8192])."),
+				TEXT("number"))
+			.Number(TEXT("iterations"),
+				TEXT("Runs per kernel for benchmark_image_kernels; best run is reported (default 3)."))
 			.Bool(TEXT("hdr"), TEXT("Create HDR texture (16-bit float)."))
 			.Bool(TEXT("save"), TEXT("Save the asset(s) after the operation."))
 			.Required({TEXT("action")})
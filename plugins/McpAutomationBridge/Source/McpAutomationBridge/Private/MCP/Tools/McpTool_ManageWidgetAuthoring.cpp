@@ -1,4 +1,4 @@
-// McpTool_ManageWidgetAuthoring.cpp — manage_widget_authoring tool definition (64 actions)
+// McpTool_ManageWidgetAuthoring.cpp — manage_widget_authoring tool definition (67 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -86,7 +86,9 @@ public:
 				TEXT("create_dialog_widget"),
 				TEXT("create_radial_menu"),
 				TEXT("get_widget_info"),
-				TEXT("preview_widget")
+				TEXT("preview_widget"),
+				TEXT("apply_widget_tree"),
+				TEXT("benchmark_widget_tree")
 			}, TEXT("The widget authoring action to perform."))
 			.String(TEXT("name"), TEXT("Name identifier."))
 			.String(TEXT("folder"), TEXT("Path to a directory."))
@@ -416,6 +418,26 @@ public:
 			}, TEXT("Preview resolution preset."))
 			.Number(TEXT("customWidth"), TEXT("Custom preview width."))
 			.Number(TEXT("customHeight"), TEXT("Custom preview height."))
+			.FreeformObject(TEXT("spec"),
+				TEXT("apply_widget_tree: { root: { name, type, isVariable, visibility, "
+					"text, properties, slot, bindings, children: [...] }, prune }."))
+			.Bool(TEXT("prune"),
+				TEXT("apply_widget_tree: remove widgets the spec does not list "
+					"(overrides spec.prune)."))
+			.Bool(TEXT("compile"),
+				TEXT("apply_widget_tree: compile once after applying (default true)."))
+			.Bool(TEXT("save"), TEXT("apply_widget_tree: save the widget blueprint (default true)."))
+			.Integer(TEXT("widgetCount"),
+				TEXT("benchmark_widget_tree: widgets in the generated HUD (default 80)."))
+			.String(TEXT("path"),
+				TEXT("benchmark_widget_tree: /Game folder for the temporary widget blueprints."))
+			.Bool(TEXT("compileEach"),
+				TEXT("benchmark_widget_tree: compile after every widget in the "
+					"per-widget run (default true)."))
+			.Bool(TEXT("cleanup"),
+				TEXT("benchmark_widget_tree: delete the temporary widget blueprints (default true)."))
+			.Number(TEXT("timeoutSeconds"),
+				TEXT("benchmark_widget_tree: stop the run after this many seconds (default and maximum 240)."))
 			.Required({TEXT("action")})
 			.Build();
 	}
@@ -1,4 +1,4 @@
-// McpTool_SystemControl.cpp — system_control tool definition (25 actions)
+// McpTool_SystemControl.cpp — system_control tool definition (34 actions)
 
 #include "McpVersionCompatibility.h"
 #include "MCP/McpToolDefinition.h"
@@ -45,7 +45,17 @@ public:
 				TEXT("get_project_settings"),
 				TEXT("validate_assets"),
 				TEXT("set_project_setting"),
-				TEXT("execute_python")
+				TEXT("execute_python"),
+				TEXT("subscribe_viewport_stream"),
+				TEXT("unsubscribe_viewport_stream"),
+				TEXT("get_viewport_stream_stats"),
+				TEXT("get_ubt_job"),
+				TEXT("cancel_ubt_job"),
+				TEXT("list_ubt_jobs"),
+				TEXT("stop_session"),
+				TEXT("snapshot_trace"),
+				TEXT("list_traces"),
+				TEXT("analyze_trace")
 			}, TEXT("Action"))
 			.String(TEXT("profileType"), TEXT(""))
 			.String(TEXT("category"), TEXT(""))
@@ -57,7 +67,7 @@ public:
 			.String(TEXT("platform"), TEXT(""))
 			.String(TEXT("configuration"), TEXT(""))
 			.String(TEXT("arguments"), TEXT(""))
-			.String(TEXT("filter"), TEXT(""))
+			.String(TEXT("filter"), TEXT("run_tests: automation test filter (e.g. Project.Gameplay); all tests when empty."))
 			.String(TEXT("channels"), TEXT(""))
 			.String(TEXT("widgetPath"), TEXT("Widget blueprint path."))
 			.String(TEXT("childClass"), TEXT(""))
@@ -68,6 +78,35 @@ public:
 			.String(TEXT("configName"), TEXT(""))
 			.String(TEXT("code"), TEXT("Python code to execute inline"))
 			.String(TEXT("file"), TEXT("Path to .py file to execute"))
+			.StringEnum(TEXT("format"), {TEXT("png"), TEXT("jpeg")},
+				TEXT("Image format: screenshot default png, viewport stream default jpeg."))
+			.Integer(TEXT("quality"), TEXT("screenshot: JPEG quality 1-100 (default 85)."))
+			.Object(TEXT("crop"), TEXT("screenshot: crop rectangle in viewport pixels."),
+				[](FMcpSchemaBuilder& S) {
+				S.Integer(TEXT("x")).Integer(TEXT("y")).Integer(TEXT("width")).Integer(TEXT("height"));
+			})
+			.Integer(TEXT("maxWidth"), TEXT("screenshot: downscale so width does not exceed this."))
+			.Integer(TEXT("maxHeight"), TEXT("screenshot: downscale so height does not exceed this."))
+			.Number(TEXT("scale"), TEXT("screenshot: uniform downscale factor in (0, 1]."))
+			.StringEnum(TEXT("delivery"), {TEXT("file"), TEXT("base64")},
+				TEXT("screenshot: return a file path (default) or inline base64 bytes."))
+			.Number(TEXT("fps"), TEXT("subscribe_viewport_stream: target frames per second (1-60, default 10)."))
+			.Number(TEXT("durationSeconds"), TEXT("subscribe_viewport_stream: stop after this many seconds (0 = until unsubscribed)."))
+			.Integer(TEXT("maxFrames"), TEXT("subscribe_viewport_stream: stop after this many frames (0 = unlimited)."))
+			.String(TEXT("streamId"), TEXT("Viewport stream id returned by subscribe_viewport_stream."))
+			.Bool(TEXT("wait"), TEXT("run_ubt / run_tests: respond when the job finishes (run_ubt default true, run_tests default false) or return a jobId immediately."))
+			.Number(TEXT("timeoutSeconds"), TEXT("run_ubt / run_tests: terminate the process after this many seconds (default 3600)."))
+			.String(TEXT("jobId"), TEXT("Job id returned by run_ubt or run_tests."))
+			.Integer(TEXT("sinceLine"), TEXT("get_ubt_job: first output line to return (use the previous nextLine)."))
+			.Integer(TEXT("maxLines"), TEXT("get_ubt_job: maximum output lines to return (default 200)."))
+			.String(TEXT("fileName"), TEXT("snapshot_trace: output file name in Saved/Profiling (default Snapshot_<timestamp>)."))
+			.String(TEXT("filePath"), TEXT("analyze_trace: trace name from list_traces, project-relative .utrace path, or \"latest\" (default)."))
+			.Number(TEXT("startSeconds"), TEXT("analyze_trace: start of the analysis window in trace seconds."))
+			.Number(TEXT("endSeconds"), TEXT("analyze_trace: end of the analysis window (default: end of trace)."))
+			.Integer(TEXT("topTimers"), TEXT("analyze_trace: timers returned by inclusive time (default 25)."))
+			.Integer(TEXT("maxCounters"), TEXT("analyze_trace: counters returned (default 100)."))
+			.String(TEXT("counterFilter"), TEXT("analyze_trace: only counters whose name contains this text."))
+			.Integer(TEXT("limit"), TEXT("list_traces: maximum files returned, newest first (default 50)."))
 			.Required({TEXT("action")})
 			.Build();
 	}
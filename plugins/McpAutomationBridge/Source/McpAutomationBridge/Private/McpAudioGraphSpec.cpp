@@ -0,0 +1,1081 @@
+// =============================================================================
+// McpAudioGraphSpec.cpp
+// =============================================================================
+// Implementation of declarative SoundCue and MetaSound graph apply.
+// =============================================================================
+
+#include "McpAudioGraphSpec.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpVersionCompatibility.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/PackageName.h"
+#include "Misc/SecureHash.h"
+
+#if WITH_EDITOR
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "Factories/SoundCueFactoryNew.h"
+#include "ScopedTransaction.h"
+#include "Sound/SoundAttenuation.h"
+#include "Sound/SoundClass.h"
+#include "Sound/SoundCue.h"
+#include "Sound/SoundNode.h"
+#include "Sound/SoundNodeAttenuation.h"
+#include "Sound/SoundNodeBranch.h"
+#include "Sound/SoundNodeConcatenator.h"
+#include "Sound/SoundNodeDelay.h"
+#include "Sound/SoundNodeLooping.h"
+#include "Sound/SoundNodeMixer.h"
+#include "Sound/SoundNodeModulator.h"
+#include "Sound/SoundNodeRandom.h"
+#include "Sound/SoundNodeSwitch.h"
+#include "Sound/SoundNodeWavePlayer.h"
+#include "Sound/SoundWave.h"
+#include "UObject/Package.h"
+
+// MetaSound (optional plugin); the same checks as the audio authoring handlers
+#if __has_include("MetasoundSource.h")
+#include "MetasoundSource.h"
+#define MCP_AUDIO_SPEC_HAS_METASOUND 1
+#else
+#define MCP_AUDIO_SPEC_HAS_METASOUND 0
+#endif
+
+#if MCP_AUDIO_SPEC_HAS_METASOUND && __has_include("MetasoundFrontendDocumentBuilder.h")
+#include "MetasoundFrontendDocumentBuilder.h"
+#include "MetasoundFrontendDocument.h"
+#include "MetasoundFrontendSearchEngine.h"
+#define MCP_AUDIO_SPEC_HAS_FRONTEND 1
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
+#define MCP_AUDIO_SPEC_HAS_FRONTEND_V2 1
+#else
+#define MCP_AUDIO_SPEC_HAS_FRONTEND_V2 0
+#endif
+#else
+#define MCP_AUDIO_SPEC_HAS_FRONTEND 0
+#define MCP_AUDIO_SPEC_HAS_FRONTEND_V2 0
+#endif
+
+#if MCP_AUDIO_SPEC_HAS_METASOUND && __has_include("MetasoundFactory.h")
+#include "MetasoundFactory.h"
+#define MCP_AUDIO_SPEC_HAS_FACTORY 1
+#else
+#define MCP_AUDIO_SPEC_HAS_FACTORY 0
+#endif
+#endif // WITH_EDITOR
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcpAudioGraphSpec, Log, All);
+
+namespace McpAudioGraphSpec
+{
+    namespace
+    {
+#if WITH_EDITOR
+        /** "/Game/Audio/Wave" -> "/Game/Audio/Wave.Wave"; full object paths pass through. */
+        FString ToObjectPath(const FString& Path)
+        {
+            if (Path.Contains(TEXT(".")))
+            {
+                return Path;
+            }
+            return Path + TEXT(".") + FPackageName::GetShortName(Path);
+        }
+
+        template <typename T>
+        T* LoadAudioAsset(const FString& Path)
+        {
+            return Path.IsEmpty() ? nullptr : LoadObject<T>(nullptr, *ToObjectPath(Path));
+        }
+
+        /** Set a reflected property by name (case-insensitive). */
+        bool ApplyProperty(UObject& Target, const FString& Name, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+        {
+            FProperty* Property = Target.GetClass()->FindPropertyByName(FName(*Name));
+            for (TFieldIterator<FProperty> It(Target.GetClass()); It && !Property; ++It)
+            {
+                if (It->GetName().Equals(Name, ESearchCase::IgnoreCase))
+                {
+                    Property = *It;
+                }
+            }
+            if (!Property)
+            {
+                OutError = FString::Printf(TEXT("%s has no property '%s'"), *Target.GetClass()->GetName(), *Name);
+                return false;
+            }
+            return ApplyJsonValueToProperty(&Target, Property, Value, OutError);
+        }
+
+        // ---- SoundCue ------------------------------------------------------------
+
+        struct FCueNodeSpec
+        {
+            FString Key;
+            UClass* Class = nullptr;
+            TSharedPtr<FJsonObject> Json;
+            TArray<int32> Inputs;
+            USoundWave* Wave = nullptr;
+            USoundAttenuation* Attenuation = nullptr;
+
+            /** Distance from the output node, for layout. */
+            int32 Depth = INDEX_NONE;
+            USoundNode* Node = nullptr;
+        };
+
+        UClass* ResolveCueNodeClass(const FString& Type)
+        {
+            static const TMap<FString, UClass*> Types = {
+                {TEXT("wave_player"), USoundNodeWavePlayer::StaticClass()},
+                {TEXT("waveplayer"), USoundNodeWavePlayer::StaticClass()},
+                {TEXT("mixer"), USoundNodeMixer::StaticClass()},
+                {TEXT("random"), USoundNodeRandom::StaticClass()},
+                {TEXT("modulator"), USoundNodeModulator::StaticClass()},
+                {TEXT("looping"), USoundNodeLooping::StaticClass()},
+                {TEXT("attenuation"), USoundNodeAttenuation::StaticClass()},
+                {TEXT("concatenator"), USoundNodeConcatenator::StaticClass()},
+                {TEXT("delay"), USoundNodeDelay::StaticClass()},
+                {TEXT("switch"), USoundNodeSwitch::StaticClass()},
+                {TEXT("branch"), USoundNodeBranch::StaticClass()}
+            };
+            if (UClass* const* Found = Types.Find(Type.ToLower()))
+            {
+                return *Found;
+            }
+            // Any other sound node class by name (SoundNodeEnveloper, ...)
+            UClass* Class = ResolveUClass(Type);
+            if (!Class && !Type.StartsWith(TEXT("SoundNode")))
+            {
+                Class = ResolveUClass(TEXT("SoundNode") + Type);
+            }
+            return Class && Class->IsChildOf(USoundNode::StaticClass()) &&
+                !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated) ? Class : nullptr;
+        }
+
+        bool HasCycle(const TArray<FCueNodeSpec>& Nodes, int32 Index, TArray<uint8>& State)
+        {
+            // 0 = unvisited, 1 = on the current path, 2 = done
+            if (State[Index] == 1)
+            {
+                return true;
+            }
+            if (State[Index] == 2)
+            {
+                return false;
+            }
+            State[Index] = 1;
+            for (int32 Input : Nodes[Index].Inputs)
+            {
+                if (HasCycle(Nodes, Input, State))
+                {
+                    return true;
+                }
+            }
+            State[Index] = 2;
+            return false;
+        }
+
+        void AssignDepth(TArray<FCueNodeSpec>& Nodes, int32 Index, int32 Depth)
+        {
+            if (Nodes[Index].Depth >= Depth)
+            {
+                return;
+            }
+            Nodes[Index].Depth = Depth;
+            for (int32 Input : Nodes[Index].Inputs)
+            {
+                AssignDepth(Nodes, Input, Depth + 1);
+            }
+        }
+
+        bool ParseCueSpec(const TSharedPtr<FJsonObject>& Spec, TArray<FCueNodeSpec>& OutNodes, int32& OutOutput,
+                          FString& OutError, FString& OutErrorCode)
+        {
+            const TArray<TSharedPtr<FJsonValue>>* NodeValues = nullptr;
+            if (!Spec->TryGetArrayField(TEXT("nodes"), NodeValues) || NodeValues->Num() == 0)
+            {
+                OutError = TEXT("SoundCue spec needs a non-empty 'nodes' array");
+                return false;
+            }
+
+            TMap<FString, int32> ByKey;
+            for (const TSharedPtr<FJsonValue>& Value : *NodeValues)
+            {
+                const TSharedPtr<FJsonObject>* Json = nullptr;
+                if (!Value.IsValid() || !Value->TryGetObject(Json))
+                {
+                    OutError = TEXT("'nodes' must be an array of objects");
+                    return false;
+                }
+                FCueNodeSpec Node;
+                Node.Json = *Json;
+                FString Type;
+                Node.Json->TryGetStringField(TEXT("key"), Node.Key);
+                Node.Json->TryGetStringField(TEXT("type"), Type);
+                if (Node.Key.IsEmpty() || Type.IsEmpty())
+                {
+                    OutError = TEXT("Every node needs a 'key' and a 'type'");
+                    return false;
+                }
+                if (ByKey.Contains(Node.Key))
+                {
+                    OutError = FString::Printf(TEXT("Node key '%s' is used twice"), *Node.Key);
+                    return false;
+                }
+                Node.Class = ResolveCueNodeClass(Type);
+                if (!Node.Class)
+                {
+                    OutError = FString::Printf(TEXT("Node '%s': unknown sound node type '%s'"), *Node.Key, *Type);
+                    OutErrorCode = TEXT("UNKNOWN_NODE_TYPE");
+                    return false;
+                }
+
+                FString WavePath;
+                if (Node.Json->TryGetStringField(TEXT("wave"), WavePath))
+                {
+                    Node.Wave = LoadAudioAsset<USoundWave>(WavePath);
+                    if (!Node.Wave)
+                    {
+                        OutError = FString::Printf(TEXT("Node '%s': sound wave not found: %s"), *Node.Key, *WavePath);
+                        OutErrorCode = TEXT("ASSET_NOT_FOUND");
+                        return false;
+                    }
+                }
+                FString AttenuationPath;
+                if (Node.Json->TryGetStringField(TEXT("attenuation"), AttenuationPath))
+                {
+                    Node.Attenuation = LoadAudioAsset<USoundAttenuation>(AttenuationPath);
+                    if (!Node.Attenuation)
+                    {
+                        OutError = FString::Printf(TEXT("Node '%s': attenuation not found: %s"), *Node.Key, *AttenuationPath);
+                        OutErrorCode = TEXT("ASSET_NOT_FOUND");
+                        return false;
+                    }
+                }
+                ByKey.Add(Node.Key, OutNodes.Add(Node));
+            }
+
+            TSet<int32> Used;
+            for (FCueNodeSpec& Node : OutNodes)
+            {
+                const TArray<TSharedPtr<FJsonValue>>* Inputs = nullptr;
+                if (Node.Json->TryGetArrayField(TEXT("inputs"), Inputs))
+                {
+                    for (const TSharedPtr<FJsonValue>& Input : *Inputs)
+                    {
+                        const FString InputKey = Input.IsValid() ? Input->AsString() : FString();
+                        const int32* Found = ByKey.Find(InputKey);
+                        if (!Found)
+                        {
+                            OutError = FString::Printf(TEXT("Node '%s': input '%s' is not a node key"), *Node.Key, *InputKey);
+                            return false;
+                        }
+                        Node.Inputs.Add(*Found);
+                        Used.Add(*Found);
+                    }
+                }
+                const USoundNode* Default = Node.Class->GetDefaultObject<USoundNode>();
+                if (Node.Inputs.Num() > Default->GetMaxChildNodes())
+                {
+                    OutError = FString::Printf(TEXT("Node '%s' (%s) takes at most %d input(s)"), *Node.Key,
+                        *Node.Class->GetName(), Default->GetMaxChildNodes());
+                    return false;
+                }
+            }
+
+            TArray<uint8> State;
+            State.SetNumZeroed(OutNodes.Num());
+            for (int32 Index = 0; Index < OutNodes.Num(); ++Index)
+            {
+                if (HasCycle(OutNodes, Index, State))
+                {
+                    OutError = FString::Printf(TEXT("Node '%s' is part of a cycle"), *OutNodes[Index].Key);
+                    return false;
+                }
+            }
+
+            FString OutputKey;
+            if (Spec->TryGetStringField(TEXT("output"), OutputKey))
+            {
+                const int32* Found = ByKey.Find(OutputKey);
+                if (!Found)
+                {
+                    OutError = FString::Printf(TEXT("'output' names no node: %s"), *OutputKey);
+                    return false;
+                }
+                OutOutput = *Found;
+            }
+            else
+            {
+                TArray<int32> Roots;
+                for (int32 Index = 0; Index < OutNodes.Num(); ++Index)
+                {
+                    if (!Used.Contains(Index))
+                    {
+                        Roots.Add(Index);
+                    }
+                }
+                if (Roots.Num() != 1)
+                {
+                    OutError = TEXT("Spec needs 'output' when there is not exactly one node without a consumer");
+                    return false;
+                }
+                OutOutput = Roots[0];
+            }
+            return true;
+        }
+
+        void ApplyCueNodeFields(FCueNodeSpec& Spec, FApplyResult& Result)
+        {
+            const TSharedPtr<FJsonObject>& Json = Spec.Json;
+            double Number = 0.0;
+            bool bFlag = false;
+
+            if (USoundNodeWavePlayer* Player = Cast<USoundNodeWavePlayer>(Spec.Node))
+            {
+                if (Spec.Wave)
+                {
+                    Player->SetSoundWave(Spec.Wave);
+                }
+                if (Json->TryGetBoolField(TEXT("looping"), bFlag))
+                {
+                    Player->bLooping = bFlag;
+                }
+            }
+            else if (USoundNodeModulator* Modulator = Cast<USoundNodeModulator>(Spec.Node))
+            {
+                if (Json->TryGetNumberField(TEXT("volume"), Number))
+                {
+                    Modulator->VolumeMin = Modulator->VolumeMax = static_cast<float>(Number);
+                }
+                if (Json->TryGetNumberField(TEXT("pitch"), Number))
+                {
+                    Modulator->PitchMin = Modulator->PitchMax = static_cast<float>(Number);
+                }
+            }
+            else if (USoundNodeLooping* Looping = Cast<USoundNodeLooping>(Spec.Node))
+            {
+                if (Json->TryGetBoolField(TEXT("indefinite"), bFlag))
+                {
+                    Looping->bLoopIndefinitely = bFlag;
+                }
+                if (Json->TryGetNumberField(TEXT("loopCount"), Number))
+                {
+                    Looping->LoopCount = static_cast<int32>(Number);
+                }
+            }
+            else if (USoundNodeDelay* Delay = Cast<USoundNodeDelay>(Spec.Node))
+            {
+                if (Json->TryGetNumberField(TEXT("delay"), Number))
+                {
+                    Delay->DelayMin = Delay->DelayMax = static_cast<float>(Number);
+                }
+            }
+            else if (USoundNodeAttenuation* Attenuation = Cast<USoundNodeAttenuation>(Spec.Node))
+            {
+                if (Spec.Attenuation)
+                {
+                    Attenuation->AttenuationSettings = Spec.Attenuation;
+                }
+            }
+            else if (USoundNodeRandom* Random = Cast<USoundNodeRandom>(Spec.Node))
+            {
+                const TArray<TSharedPtr<FJsonValue>>* Weights = nullptr;
+                if (Json->TryGetArrayField(TEXT("weights"), Weights))
+                {
+                    for (int32 Index = 0; Index < Weights->Num() && Index < Random->Weights.Num(); ++Index)
+                    {
+                        Random->Weights[Index] = static_cast<float>((*Weights)[Index]->AsNumber());
+                    }
+                }
+            }
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (Json->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+                {
+                    FString Error;
+                    if (!ApplyProperty(*Spec.Node, Pair.Key, Pair.Value, Error))
+                    {
+                        Result.Warnings.Add(FString::Printf(TEXT("%s: %s"), *Spec.Key, *Error));
+                    }
+                }
+            }
+        }
+
+        bool ApplyCue(USoundCue* Cue, const TSharedPtr<FJsonObject>& Spec, FApplyResult& Result,
+                      FString& OutError, FString& OutErrorCode)
+        {
+            TArray<FCueNodeSpec> Nodes;
+            int32 Output = INDEX_NONE;
+            if (!ParseCueSpec(Spec, Nodes, Output, OutError, OutErrorCode))
+            {
+                return false;
+            }
+            FString SoundClassPath, AttenuationPath;
+            USoundClass* SoundClass = nullptr;
+            USoundAttenuation* CueAttenuation = nullptr;
+            if (Spec->TryGetStringField(TEXT("soundClass"), SoundClassPath) &&
+                !(SoundClass = LoadAudioAsset<USoundClass>(SoundClassPath)))
+            {
+                OutError = FString::Printf(TEXT("Sound class not found: %s"), *SoundClassPath);
+                OutErrorCode = TEXT("ASSET_NOT_FOUND");
+                return false;
+            }
+            if (Spec->TryGetStringField(TEXT("attenuation"), AttenuationPath) &&
+                !(CueAttenuation = LoadAudioAsset<USoundAttenuation>(AttenuationPath)))
+            {
+                OutError = FString::Printf(TEXT("Attenuation not found: %s"), *AttenuationPath);
+                OutErrorCode = TEXT("ASSET_NOT_FOUND");
+                return false;
+            }
+
+            const FScopedTransaction Transaction(FText::FromString(TEXT("Apply Audio Graph")));
+            Cue->Modify();
+
+            // The spec describes the whole graph: drop the old nodes (and their
+            // graph nodes, which breaks the links to the root)
+            UEdGraph* Graph = Cue->GetGraph();
+            for (USoundNode* Existing : Cue->AllNodes)
+            {
+                if (Existing && Existing->GraphNode && Graph)
+                {
+                    Graph->RemoveNode(Existing->GraphNode);
+                }
+                Result.Removed += Existing ? 1 : 0;
+            }
+            Cue->AllNodes.Empty();
+            Cue->FirstNode = nullptr;
+
+            for (FCueNodeSpec& Node : Nodes)
+            {
+                Node.Node = Cue->ConstructSoundNode<USoundNode>(Node.Class, false);
+                ++Result.Created;
+            }
+
+            for (FCueNodeSpec& Node : Nodes)
+            {
+                // InsertChildNode adds the slot and its graph pin together;
+                // filling ChildNodes directly leaves the graph without pins
+                USoundNode* SoundNode = Node.Node;
+                while (SoundNode->ChildNodes.Num() < Node.Inputs.Num())
+                {
+                    SoundNode->InsertChildNode(SoundNode->ChildNodes.Num());
+                }
+                while (SoundNode->ChildNodes.Num() > FMath::Max(Node.Inputs.Num(), SoundNode->GetMinChildNodes()))
+                {
+                    SoundNode->RemoveChildNode(SoundNode->ChildNodes.Num() - 1);
+                }
+                for (int32 Index = 0; Index < Node.Inputs.Num(); ++Index)
+                {
+                    SoundNode->ChildNodes[Index] = Nodes[Node.Inputs[Index]].Node;
+                    ++Result.Linked;
+                }
+                ApplyCueNodeFields(Node, Result);
+            }
+
+            // Lay out right to left from the output, one column per depth
+            AssignDepth(Nodes, Output, 0);
+            TMap<int32, int32> RowsPerDepth;
+            for (int32 Index = 0; Index < Nodes.Num(); ++Index)
+            {
+                FCueNodeSpec& Node = Nodes[Index];
+                const int32 Depth = Node.Depth == INDEX_NONE ? 0 : Node.Depth;
+                int32& Row = RowsPerDepth.FindOrAdd(Depth);
+                if (Node.Node->GraphNode)
+                {
+                    Node.Node->GraphNode->NodePosX = static_cast<int32>(GetJsonNumberField(Node.Json, TEXT("x"), -280.0 * (Depth + 1)));
+                    Node.Node->GraphNode->NodePosY = static_cast<int32>(GetJsonNumberField(Node.Json, TEXT("y"), 140.0 * Row));
+                }
+                ++Row;
+                if (Node.Depth == INDEX_NONE)
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: not connected to the output"), *Node.Key));
+                }
+                Result.NodeIds->SetStringField(Node.Key, Node.Node->GetName());
+            }
+
+            double Number = 0.0;
+            if (Spec->TryGetNumberField(TEXT("volume"), Number))
+            {
+                Cue->VolumeMultiplier = static_cast<float>(Number);
+            }
+            if (Spec->TryGetNumberField(TEXT("pitch"), Number))
+            {
+                Cue->PitchMultiplier = static_cast<float>(Number);
+            }
+            if (SoundClass)
+            {
+                Cue->SoundClassObject = SoundClass;
+            }
+            if (CueAttenuation)
+            {
+                Cue->AttenuationSettings = CueAttenuation;
+            }
+
+            Cue->FirstNode = Nodes[Output].Node;
+            Cue->LinkGraphNodesFromSoundNodes();
+            Cue->PostEditChange();
+            Cue->MarkPackageDirty();
+            return true;
+        }
+
+        // ---- MetaSound -----------------------------------------------------------
+
+#if MCP_AUDIO_SPEC_HAS_FRONTEND
+        FGuid KeyGuid(const FString& Key)
+        {
+            const FString Seed = FString::Printf(TEXT("McpAudioGraphSpec|%s"), *Key);
+            const FTCHARToUTF8 Utf8(*Seed);
+            FMD5 Md5;
+            Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+            uint8 Digest[16];
+            Md5.Final(Digest);
+            uint32 Parts[4];
+            FMemory::Memcpy(Parts, Digest, sizeof(Parts));
+            return FGuid(Parts[0], Parts[1], Parts[2], Parts[3]);
+        }
+
+        /** "UE.Sine.Audio" -> { UE, Sine, Audio }; shortcuts for the common nodes. */
+        FMetasoundFrontendClassName ParseClassName(const FString& Class)
+        {
+            static const TMap<FString, FString> Shortcuts = {
+                {TEXT("waveplayer"), TEXT("UE.Wave Player.Mono")},
+                {TEXT("waveplayerstereo"), TEXT("UE.Wave Player.Stereo")},
+                {TEXT("sine"), TEXT("UE.Sine.Audio")},
+                {TEXT("multiply"), TEXT("UE.Multiply.Audio")},
+                {TEXT("add"), TEXT("UE.Add.Audio")}
+            };
+            const FString* Shortcut = Shortcuts.Find(Class.Replace(TEXT(" "), TEXT("")).ToLower());
+            TArray<FString> Parts;
+            (Shortcut ? *Shortcut : Class).ParseIntoArray(Parts, TEXT("."), false);
+            if (Parts.Num() == 1)
+            {
+                return FMetasoundFrontendClassName(FName(), FName(*Parts[0]), FName());
+            }
+            // Everything after the name is the variant, dots included
+            FString Variant;
+            for (int32 Index = 2; Index < Parts.Num(); ++Index)
+            {
+                Variant += (Index > 2 ? TEXT(".") : TEXT("")) + Parts[Index];
+            }
+            return FMetasoundFrontendClassName(FName(*Parts[0]), FName(*Parts[1]), FName(*Variant));
+        }
+
+        bool ReadLiteral(const TSharedPtr<FJsonValue>& Value, const FString& TypeHint, FMetasoundFrontendLiteral& Out, FString& OutError)
+        {
+            bool bFlag = false;
+            double Number = 0.0;
+            FString String;
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (!Value.IsValid())
+            {
+                OutError = TEXT("missing value");
+                return false;
+            }
+            if (Value->TryGetBool(bFlag))
+            {
+                Out.Set(bFlag);
+            }
+            else if (Value->TryGetNumber(Number))
+            {
+                if (TypeHint.Equals(TEXT("Int32"), ESearchCase::IgnoreCase))
+                {
+                    Out.Set(static_cast<int32>(Number));
+                }
+                else
+                {
+                    Out.Set(static_cast<float>(Number));
+                }
+            }
+            else if (Value->TryGetString(String))
+            {
+                Out.Set(String);
+            }
+            else if (Value->TryGetObject(Object) && (*Object)->TryGetNumberField(TEXT("int"), Number))
+            {
+                Out.Set(static_cast<int32>(Number));
+            }
+            else if (Object && (*Object)->TryGetStringField(TEXT("object"), String))
+            {
+                UObject* Asset = LoadObject<UObject>(nullptr, *ToObjectPath(String));
+                if (!Asset)
+                {
+                    OutError = FString::Printf(TEXT("asset not found: %s"), *String);
+                    return false;
+                }
+                Out.Set(Asset);
+            }
+            else
+            {
+                OutError = TEXT("literal must be a bool, number, string, { int } or { object }");
+                return false;
+            }
+            return true;
+        }
+
+        struct FEndpoint
+        {
+            FString Key;
+            FName Vertex;
+        };
+
+        bool ParseEndpoint(const FString& Text, FEndpoint& Out)
+        {
+            // Keys have no dots; vertex names may ("graph.UE.Source.OnPlay")
+            FString Key, Vertex;
+            if (!Text.Split(TEXT("."), &Key, &Vertex) || Key.IsEmpty() || Vertex.IsEmpty())
+            {
+                return false;
+            }
+            Out.Key = Key;
+            Out.Vertex = FName(*Vertex);
+            return true;
+        }
+
+        bool ApplyMetaSound(UMetaSoundSource* MetaSound, const TSharedPtr<FJsonObject>& Spec, FApplyResult& Result,
+                            FString& OutError, FString& OutErrorCode)
+        {
+            struct FNodeSpec
+            {
+                FString Key;
+                FMetasoundFrontendClassName ClassName;
+                int32 MajorVersion = 1;
+                TSharedPtr<FJsonObject> Inputs;
+                FGuid NodeId;
+            };
+            struct FEdgeSpec
+            {
+                FEndpoint From;
+                FEndpoint To;
+            };
+
+            // ---- Parse everything first ------------------------------------
+            const TArray<TSharedPtr<FJsonValue>> Empty;
+            const TArray<TSharedPtr<FJsonValue>>* Values = &Empty;
+
+            TArray<FNodeSpec> Nodes;
+            TMap<FString, int32> ByKey;
+            if (Spec->TryGetArrayField(TEXT("nodes"), Values))
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *Values)
+                {
+                    const TSharedPtr<FJsonObject>* Json = nullptr;
+                    FNodeSpec Node;
+                    FString Class;
+                    if (!Value.IsValid() || !Value->TryGetObject(Json) ||
+                        !(*Json)->TryGetStringField(TEXT("key"), Node.Key) ||
+                        !(*Json)->TryGetStringField(TEXT("class"), Class))
+                    {
+                        OutError = TEXT("Every MetaSound node needs a 'key' and a 'class'");
+                        return false;
+                    }
+                    if (Node.Key.Contains(TEXT(".")) || Node.Key == TEXT("graph") || ByKey.Contains(Node.Key))
+                    {
+                        OutError = FString::Printf(TEXT("Node key '%s' is reserved, used twice or contains '.'"), *Node.Key);
+                        return false;
+                    }
+                    Node.ClassName = ParseClassName(Class);
+                    Node.MajorVersion = static_cast<int32>(GetJsonNumberField(*Json, TEXT("version"), 1.0));
+                    const TSharedPtr<FJsonObject>* Inputs = nullptr;
+                    if ((*Json)->TryGetObjectField(TEXT("inputs"), Inputs))
+                    {
+                        Node.Inputs = *Inputs;
+                    }
+                    Node.NodeId = KeyGuid(Node.Key);
+
+                    // Checked here so a missing class cannot leave the graph half rebuilt
+                    FMetasoundFrontendClass RegisteredClass;
+                    if (!Metasound::Frontend::ISearchEngine::Get().FindClassWithHighestMinorVersion(
+                            Node.ClassName, Node.MajorVersion, RegisteredClass))
+                    {
+                        OutError = FString::Printf(TEXT("Node '%s': class '%s' (v%d) is not registered"), *Node.Key,
+                            *Node.ClassName.ToString(), Node.MajorVersion);
+                        OutErrorCode = TEXT("NODE_CLASS_NOT_FOUND");
+                        return false;
+                    }
+                    ByKey.Add(Node.Key, Nodes.Add(Node));
+                }
+            }
+
+            TArray<FEdgeSpec> Edges;
+            Values = &Empty;
+            if (Spec->TryGetArrayField(TEXT("edges"), Values))
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *Values)
+                {
+                    const TSharedPtr<FJsonObject>* Json = nullptr;
+                    FEdgeSpec Edge;
+                    if (!Value.IsValid() || !Value->TryGetObject(Json) ||
+                        !ParseEndpoint(GetJsonStringField(*Json, TEXT("from")), Edge.From) ||
+                        !ParseEndpoint(GetJsonStringField(*Json, TEXT("to")), Edge.To))
+                    {
+                        OutError = TEXT("Every edge needs 'from' and 'to' as \"<key>.<vertex>\"");
+                        return false;
+                    }
+                    for (const FEndpoint* End : {&Edge.From, &Edge.To})
+                    {
+                        if (End->Key != TEXT("graph") && !ByKey.Contains(End->Key))
+                        {
+                            OutError = FString::Printf(TEXT("Edge endpoint '%s' names no node"), *End->Key);
+                            return false;
+                        }
+                    }
+                    Edges.Add(Edge);
+                }
+            }
+
+            // ---- Build -----------------------------------------------------
+            const FScopedTransaction Transaction(FText::FromString(TEXT("Apply Audio Graph")));
+            MetaSound->Modify();
+
+            TScriptInterface<IMetaSoundDocumentInterface> ScriptInterface(MetaSound);
+#if MCP_AUDIO_SPEC_HAS_FRONTEND_V2
+            FMetaSoundFrontendDocumentBuilder Builder(ScriptInterface, nullptr, true);
+#else
+            FMetaSoundFrontendDocumentBuilder Builder(ScriptInterface);
+#endif
+            bool bOk = true;
+
+            Values = &Empty;
+            if (Spec->TryGetArrayField(TEXT("graphInputs"), Values))
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *Values)
+                {
+                    const TSharedPtr<FJsonObject> Json = Value.IsValid() ? Value->AsObject() : nullptr;
+                    const FString Name = GetJsonStringField(Json, TEXT("name"));
+                    const FString Type = GetJsonStringField(Json, TEXT("type"), TEXT("Float"));
+                    if (Name.IsEmpty())
+                    {
+                        Result.Warnings.Add(TEXT("graphInputs entry without a name"));
+                        continue;
+                    }
+                    if (!Builder.FindGraphInputNode(FName(*Name)))
+                    {
+                        FMetasoundFrontendClassInput ClassInput;
+                        ClassInput.Name = FName(*Name);
+                        ClassInput.TypeName = FName(*Type);
+                        ClassInput.VertexID = FGuid::NewGuid();
+                        ClassInput.NodeID = KeyGuid(TEXT("graph.in.") + Name);
+                        ClassInput.AccessType = EMetasoundFrontendVertexAccessType::Reference;
+                        if (!Builder.AddGraphInput(ClassInput))
+                        {
+                            Result.Warnings.Add(FString::Printf(TEXT("graph input '%s': type '%s' rejected"), *Name, *Type));
+                            continue;
+                        }
+                        ++Result.GraphInputsAdded;
+                    }
+                    FMetasoundFrontendLiteral Literal;
+                    FString Error;
+                    if (Json->HasField(TEXT("default")))
+                    {
+                        if (ReadLiteral(Json->TryGetField(TEXT("default")), Type, Literal, Error) &&
+                            Builder.SetGraphInputDefault(FName(*Name), Literal))
+                        {
+                            ++Result.DefaultsSet;
+                        }
+                        else
+                        {
+                            Result.Warnings.Add(FString::Printf(TEXT("graph input '%s' default: %s"), *Name,
+                                Error.IsEmpty() ? TEXT("rejected") : *Error));
+                        }
+                    }
+                }
+            }
+
+            Values = &Empty;
+            if (Spec->TryGetArrayField(TEXT("graphOutputs"), Values))
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *Values)
+                {
+                    const TSharedPtr<FJsonObject> Json = Value.IsValid() ? Value->AsObject() : nullptr;
+                    const FString Name = GetJsonStringField(Json, TEXT("name"));
+                    const FString Type = GetJsonStringField(Json, TEXT("type"), TEXT("Audio"));
+                    if (Name.IsEmpty() || Builder.FindGraphOutputNode(FName(*Name)))
+                    {
+                        continue;
+                    }
+                    FMetasoundFrontendClassOutput ClassOutput;
+                    ClassOutput.Name = FName(*Name);
+                    ClassOutput.TypeName = FName(*Type);
+                    ClassOutput.VertexID = FGuid::NewGuid();
+                    ClassOutput.NodeID = KeyGuid(TEXT("graph.out.") + Name);
+                    ClassOutput.AccessType = EMetasoundFrontendVertexAccessType::Reference;
+                    if (Builder.AddGraphOutput(ClassOutput))
+                    {
+                        ++Result.GraphOutputsAdded;
+                    }
+                    else
+                    {
+                        Result.Warnings.Add(FString::Printf(TEXT("graph output '%s': type '%s' rejected"), *Name, *Type));
+                    }
+                }
+            }
+
+            for (FNodeSpec& Node : Nodes)
+            {
+                bool bReplace = false;
+                if (const FMetasoundFrontendNode* Existing = Builder.FindNode(Node.NodeId))
+                {
+                    const FMetasoundFrontendClass* ExistingClass = Builder.FindDependency(Existing->ClassID);
+                    if (ExistingClass && ExistingClass->Metadata.GetClassName() == Node.ClassName)
+                    {
+                        ++Result.Updated;
+                    }
+                    else
+                    {
+                        Builder.RemoveNode(Node.NodeId);
+                        bReplace = true;
+                    }
+                }
+                if (!Builder.FindNode(Node.NodeId))
+                {
+                    if (!Builder.AddNodeByClassName(Node.ClassName, Node.MajorVersion, Node.NodeId))
+                    {
+                        // Registered at validation; only an unregister in between gets here
+                        OutError = FString::Printf(TEXT("Node '%s': class '%s' (v%d) could not be added"), *Node.Key,
+                            *Node.ClassName.ToString(), Node.MajorVersion);
+                        OutErrorCode = TEXT("NODE_CLASS_NOT_FOUND");
+                        bOk = false;
+                        break;
+                    }
+                    ++(bReplace ? Result.Replaced : Result.Created);
+                }
+                Result.NodeIds->SetStringField(Node.Key, Node.NodeId.ToString());
+
+                if (Node.Inputs.IsValid())
+                {
+                    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Node.Inputs->Values)
+                    {
+                        const FMetasoundFrontendVertex* Input = Builder.FindNodeInput(Node.NodeId, FName(*Pair.Key));
+                        FMetasoundFrontendLiteral Literal;
+                        FString Error;
+                        if (!Input)
+                        {
+                            Result.Warnings.Add(FString::Printf(TEXT("%s: no input '%s'"), *Node.Key, *Pair.Key));
+                        }
+                        else if (ReadLiteral(Pair.Value, Input->TypeName.ToString(), Literal, Error) &&
+                                 Builder.SetNodeInputDefault(Node.NodeId, Input->VertexID, Literal))
+                        {
+                            ++Result.DefaultsSet;
+                        }
+                        else
+                        {
+                            Result.Warnings.Add(FString::Printf(TEXT("%s.%s: %s"), *Node.Key, *Pair.Key,
+                                Error.IsEmpty() ? TEXT("default rejected") : *Error));
+                        }
+                    }
+                }
+            }
+
+            if (bOk)
+            {
+                TSet<Metasound::Frontend::FNamedEdge> NamedEdges;
+                for (const FEdgeSpec& Edge : Edges)
+                {
+                    const FMetasoundFrontendNode* FromNode = Edge.From.Key == TEXT("graph")
+                        ? Builder.FindGraphInputNode(Edge.From.Vertex)
+                        : Builder.FindNode(Nodes[ByKey[Edge.From.Key]].NodeId);
+                    const FMetasoundFrontendNode* ToNode = Edge.To.Key == TEXT("graph")
+                        ? Builder.FindGraphOutputNode(Edge.To.Vertex)
+                        : Builder.FindNode(Nodes[ByKey[Edge.To.Key]].NodeId);
+                    if (!FromNode || !ToNode ||
+                        !Builder.FindNodeOutput(FromNode->GetID(), Edge.From.Vertex) ||
+                        !Builder.FindNodeInput(ToNode->GetID(), Edge.To.Vertex))
+                    {
+                        Result.Warnings.Add(FString::Printf(TEXT("edge %s.%s -> %s.%s: vertex not found"), *Edge.From.Key,
+                            *Edge.From.Vertex.ToString(), *Edge.To.Key, *Edge.To.Vertex.ToString()));
+                        continue;
+                    }
+                    NamedEdges.Add(Metasound::Frontend::FNamedEdge{FromNode->GetID(), Edge.From.Vertex, ToNode->GetID(), Edge.To.Vertex});
+                }
+                TArray<const FMetasoundFrontendEdge*> CreatedEdges;
+                if (NamedEdges.Num() > 0 && !Builder.AddNamedEdges(NamedEdges, &CreatedEdges, true))
+                {
+                    Result.Warnings.Add(TEXT("some edges were rejected (type mismatch or cycle)"));
+                }
+                Result.Linked = CreatedEdges.Num();
+            }
+
+#if MCP_AUDIO_SPEC_HAS_FRONTEND_V2
+            Builder.FinishBuilding();
+#endif
+            MetaSound->MarkPackageDirty();
+            return bOk;
+        }
+#endif // MCP_AUDIO_SPEC_HAS_FRONTEND
+#endif // WITH_EDITOR
+    }
+
+    TSharedPtr<FJsonObject> FApplyResult::ToJson() const
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetStringField(TEXT("assetType"), AssetType);
+        Json->SetNumberField(TEXT("created"), Created);
+        Json->SetNumberField(TEXT("updated"), Updated);
+        Json->SetNumberField(TEXT("replaced"), Replaced);
+        Json->SetNumberField(TEXT("removed"), Removed);
+        Json->SetNumberField(TEXT("linked"), Linked);
+        Json->SetNumberField(TEXT("defaultsSet"), DefaultsSet);
+        Json->SetNumberField(TEXT("graphInputsAdded"), GraphInputsAdded);
+        Json->SetNumberField(TEXT("graphOutputsAdded"), GraphOutputsAdded);
+        Json->SetNumberField(TEXT("applyMs"), ApplySeconds * 1000.0);
+        Json->SetObjectField(TEXT("nodeIds"), NodeIds.IsValid() ? NodeIds : MakeShared<FJsonObject>());
+
+        TArray<TSharedPtr<FJsonValue>> WarningValues;
+        for (const FString& Warning : Warnings)
+        {
+            WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+        }
+        Json->SetArrayField(TEXT("warnings"), WarningValues);
+        return Json;
+    }
+
+    bool Apply(UObject* Asset, const TSharedPtr<FJsonObject>& Spec, FApplyResult& OutResult,
+               FString& OutError, FString& OutErrorCode)
+    {
+#if WITH_EDITOR
+        const double StartSeconds = FPlatformTime::Seconds();
+        OutResult = FApplyResult();
+        OutResult.NodeIds = MakeShared<FJsonObject>();
+        OutErrorCode = TEXT("INVALID_SPEC");
+        if (!Asset || !Spec.IsValid())
+        {
+            OutError = TEXT("Missing asset or spec");
+            return false;
+        }
+
+        bool bOk = false;
+        if (USoundCue* Cue = Cast<USoundCue>(Asset))
+        {
+            OutResult.AssetType = TEXT("SoundCue");
+            bOk = ApplyCue(Cue, Spec, OutResult, OutError, OutErrorCode);
+        }
+#if MCP_AUDIO_SPEC_HAS_FRONTEND
+        else if (UMetaSoundSource* MetaSound = Cast<UMetaSoundSource>(Asset))
+        {
+            OutResult.AssetType = TEXT("MetaSound");
+            bOk = ApplyMetaSound(MetaSound, Spec, OutResult, OutError, OutErrorCode);
+        }
+#endif
+        else
+        {
+            OutError = FString::Printf(TEXT("%s is not a SoundCue or MetaSound source (MetaSound specs need UE 5.3+)"),
+                *Asset->GetClass()->GetName());
+            OutErrorCode = TEXT("UNSUPPORTED_ASSET");
+            return false;
+        }
+
+        OutResult.ApplySeconds = FPlatformTime::Seconds() - StartSeconds;
+        if (bOk)
+        {
+            OutErrorCode.Reset();
+            UE_LOG(LogMcpAudioGraphSpec, Verbose, TEXT("%s: %d created, %d linked in %.1f ms"), *Asset->GetName(),
+                OutResult.Created, OutResult.Linked, OutResult.ApplySeconds * 1000.0);
+        }
+        return bOk;
+#else
+        OutError = TEXT("apply_audio_graph requires the editor");
+        OutErrorCode = TEXT("EDITOR_ONLY");
+        return false;
+#endif
+    }
+
+    UObject* CreateAsset(const FString& PackagePath, const FString& AssetType, FString& OutError, FString& OutErrorCode)
+    {
+#if WITH_EDITOR
+        const FString Name = FPackageName::GetShortName(PackagePath);
+        const bool bCue = AssetType.Equals(TEXT("SoundCue"), ESearchCase::IgnoreCase);
+        const bool bMetaSound = AssetType.Equals(TEXT("MetaSound"), ESearchCase::IgnoreCase);
+        if (!bCue && !bMetaSound)
+        {
+            OutError = FString::Printf(TEXT("assetType must be SoundCue or MetaSound, not '%s'"), *AssetType);
+            OutErrorCode = TEXT("INVALID_ARGUMENT");
+            return nullptr;
+        }
+        UPackage* Package = CreatePackage(*PackagePath);
+        if (!Package || FindObject<UObject>(Package, *Name))
+        {
+            OutError = FString::Printf(TEXT("Cannot create %s: the package is unavailable or taken"), *PackagePath);
+            OutErrorCode = TEXT("PACKAGE_ERROR");
+            return nullptr;
+        }
+
+        // Factories directly, as create_sound_cue does: AssetTools would prompt on conflicts
+        UObject* Asset = nullptr;
+        if (bCue)
+        {
+            USoundCueFactoryNew* Factory = NewObject<USoundCueFactoryNew>();
+            Asset = Factory->FactoryCreateNew(USoundCue::StaticClass(), Package, FName(*Name),
+                RF_Public | RF_Standalone, nullptr, GWarn);
+        }
+        else
+        {
+#if MCP_AUDIO_SPEC_HAS_FACTORY
+            UMetaSoundSourceFactory* Factory = NewObject<UMetaSoundSourceFactory>();
+            Asset = Factory->FactoryCreateNew(UMetaSoundSource::StaticClass(), Package, FName(*Name),
+                RF_Public | RF_Standalone, nullptr, GWarn);
+#else
+            OutError = TEXT("MetaSound support not available");
+            OutErrorCode = TEXT("METASOUND_NOT_AVAILABLE");
+            return nullptr;
+#endif
+        }
+        if (!Asset)
+        {
+            OutError = FString::Printf(TEXT("Failed to create %s"), *PackagePath);
+            OutErrorCode = TEXT("CREATE_FAILED");
+        }
+        return Asset;
+#else
+        OutError = TEXT("Creating audio assets requires the editor");
+        OutErrorCode = TEXT("EDITOR_ONLY");
+        return nullptr;
+#endif
+    }
+
+    TSharedPtr<FJsonObject> MakeWaveWrapperSpec(const FString& AssetType, const FString& WavePath)
+    {
+        TSharedPtr<FJsonObject> Spec = MakeShared<FJsonObject>();
+        TArray<TSharedPtr<FJsonValue>> Nodes;
+        TSharedPtr<FJsonObject> Player = MakeShared<FJsonObject>();
+        Player->SetStringField(TEXT("key"), TEXT("player"));
+
+        if (AssetType.Equals(TEXT("MetaSound"), ESearchCase::IgnoreCase))
+        {
+            // OnPlay -> Play, Out Mono -> mono output, On Finished -> OnFinished
+            Player->SetStringField(TEXT("class"), TEXT("WavePlayer"));
+            TSharedPtr<FJsonObject> WaveLiteral = MakeShared<FJsonObject>();
+            WaveLiteral->SetStringField(TEXT("object"), WavePath);
+            TSharedPtr<FJsonObject> Inputs = MakeShared<FJsonObject>();
+            Inputs->SetObjectField(TEXT("Wave Asset"), WaveLiteral);
+            Player->SetObjectField(TEXT("inputs"), Inputs);
+
+            TArray<TSharedPtr<FJsonValue>> Edges;
+            const TCHAR* Links[][2] = {
+                {TEXT("graph.UE.Source.OnPlay"), TEXT("player.Play")},
+                {TEXT("player.Out Mono"), TEXT("graph.UE.OutputFormat.Mono.Audio:0")},
+                {TEXT("player.On Finished"), TEXT("graph.UE.Source.OnFinished")}
+            };
+            for (const auto& Link : Links)
+            {
+                TSharedPtr<FJsonObject> Edge = MakeShared<FJsonObject>();
+                Edge->SetStringField(TEXT("from"), Link[0]);
+                Edge->SetStringField(TEXT("to"), Link[1]);
+                Edges.Add(MakeShared<FJsonValueObject>(Edge));
+            }
+            Spec->SetArrayField(TEXT("edges"), Edges);
+        }
+        else
+        {
+            Player->SetStringField(TEXT("type"), TEXT("wave_player"));
+            Player->SetStringField(TEXT("wave"), WavePath);
+            Spec->SetStringField(TEXT("output"), TEXT("player"));
+        }
+        Nodes.Add(MakeShared<FJsonValueObject>(Player));
+        Spec->SetArrayField(TEXT("nodes"), Nodes);
+        return Spec;
+    }
+}
@@ -0,0 +1,105 @@
+// =============================================================================
+// McpAudioGraphSpec.h
+// =============================================================================
+// Declarative SoundCue and MetaSound graphs for manage_audio_authoring
+// apply_audio_graph.
+//
+// add_cue_node, connect_cue_nodes, add_metasound_node and
+// connect_metasound_nodes change one node or edge per request, and each one
+// reloads the asset and saves it. A spec describes the whole graph instead;
+// Apply builds it in one pass and the caller saves once.
+//
+//   - SoundCue: the cue's node graph is rebuilt from the spec. Cue nodes have
+//     no identity beyond their settings, so nothing is diffed; every node is
+//     constructed, linked to its inputs (children) and laid out, and "output"
+//     (or the one node no other node uses) becomes the cue's first node.
+//   - MetaSound: every spec node has a key; a node created for a key gets a
+//     GUID derived from the key, so the same key finds it again on later
+//     applies. Nodes whose class changed are replaced. Graph inputs and
+//     outputs are added when missing; defaults and edges are set as listed.
+//     Nodes and edges the spec does not list are left alone.
+//
+// SPEC (SoundCue):
+//   {
+//     "nodes": [ { "key", "type": wave_player | mixer | random | modulator |
+//                  looping | attenuation | concatenator | delay | switch |
+//                  branch | <USoundNode class>,
+//                  "wave", "looping", "volume", "pitch", "delay", "indefinite",
+//                  "loopCount", "attenuation", "weights": [],
+//                  "properties": { "<Property>": value },
+//                  "inputs": [ "<child key>", ... ], "x", "y" } ],
+//     "output": "<key>",
+//     "volume", "pitch", "attenuation", "soundClass"
+//   }
+// SPEC (MetaSound):
+//   {
+//     "graphInputs":  [ { "name", "type": Float | Int32 | Bool | Trigger | ..., "default" } ],
+//     "graphOutputs": [ { "name", "type" } ],
+//     "nodes": [ { "key", "class": "UE.Sine.Audio" | WavePlayer | ..., "version",
+//                  "inputs": { "<Input>": literal } } ],
+//     "edges": [ { "from": "<key>.<Output>", "to": "<key>.<Input>" } ]
+//   }
+// In edges, the key "graph" names the graph's own inputs ("from") and outputs
+// ("to"), including interface vertices such as "graph.UE.Source.OnPlay".
+// Literals are booleans, numbers (float), strings, { "int": n } or
+// { "object": "<asset path>" }.
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpAudioGraphSpec
+{
+    struct FApplyResult
+    {
+        /** "SoundCue" or "MetaSound". */
+        FString AssetType;
+
+        int32 Created = 0;
+        int32 Updated = 0;
+        int32 Replaced = 0;
+        int32 Removed = 0;
+        int32 Linked = 0;
+        int32 DefaultsSet = 0;
+        int32 GraphInputsAdded = 0;
+        int32 GraphOutputsAdded = 0;
+
+        double ApplySeconds = 0.0;
+
+        /** Spec key -> node name (SoundCue) or node ID (MetaSound). */
+        TSharedPtr<FJsonObject> NodeIds;
+
+        /** Non-fatal problems: unknown properties, rejected defaults or edges. */
+        TArray<FString> Warnings;
+
+        TSharedPtr<FJsonObject> ToJson() const;
+    };
+
+    /**
+     * Apply Spec to a USoundCue or UMetaSoundSource. Node types, assets and
+     * references are validated before anything changes; on failure
+     * OutError / OutErrorCode describe the problem and nothing is modified,
+     * except that MetaSound node classes are only resolved as nodes are
+     * added, so an unregistered class stops the apply part way. The asset is
+     * not saved.
+     */
+    bool Apply(UObject* Asset, const TSharedPtr<FJsonObject>& Spec, FApplyResult& OutResult,
+               FString& OutError, FString& OutErrorCode);
+
+    /**
+     * Create an empty SoundCue or MetaSound source ("SoundCue" / "MetaSound")
+     * at PackagePath. Returns nullptr with OutError / OutErrorCode set when the
+     * type is unknown, unavailable, or the package cannot be created.
+     */
+    UObject* CreateAsset(const FString& PackagePath, const FString& AssetType, FString& OutError, FString& OutErrorCode);
+
+    /** The spec that wraps one wave: a wave player (cue) or a wave player routed to the mono output (MetaSound). */
+    TSharedPtr<FJsonObject> MakeWaveWrapperSpec(const FString& AssetType, const FString& WavePath);
+}
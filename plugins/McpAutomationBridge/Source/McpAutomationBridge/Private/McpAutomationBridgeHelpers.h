@@ -170,6 +170,7 @@
 // Globals used by registry helpers and fast-mode simulations
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpCompileScheduler.h"
 
 #if WITH_EDITOR
 #include "Editor.h"  // GEditor for McpSafeLoadMap
@@ -1133,27 +1134,23 @@ static inline UMaterialInterface* McpLoadMaterialWithFallback(
  * When invoked from the automation bridge, this can race with the render thread
  * and cause Fatal Error 80070005 in WindowsD3D12Viewport.cpp
  * 
+ * During Blueprint edit requests the compile is deferred to McpCompileScheduler,
+ * which compiles each edited Blueprint once (see McpCompileScheduler.h).
+ * 
  * @param Blueprint The blueprint to compile
- * @return True if compilation succeeded, false otherwise
+ * @return True if compilation succeeded or was deferred, false otherwise
  */
 static inline bool McpSafeCompileBlueprint(UBlueprint* Blueprint)
 {
     if (!Blueprint) return false;
-    
-    // 1. Flush rendering commands to ensure GPU is idle before compilation UI opens
-    FlushRenderingCommands();
-    
-    // 2. Compile without forcing garbage collection (can cause issues during automation)
-    // Note: FKismetEditorUtilities::CompileBlueprint returns void in UE 5.7+
-    FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
-    
-    // 3. Flush again to ensure any UI updates from compilation are complete
-    FlushRenderingCommands();
-    
-    // 4. Check compilation status - success if UpToDate or UpToDateWithWarnings
-    const bool bSuccess = (Blueprint->Status == EBlueprintStatus::BS_UpToDate || Blueprint->Status == EBlueprintStatus::BS_UpToDateWithWarnings);
-    
-    return bSuccess;
+
+    if (McpCompileScheduler::IsDeferring())
+    {
+        McpCompileScheduler::MarkDirty(Blueprint);
+        return true;
+    }
+
+    return McpCompileScheduler::CompileNow(Blueprint);
 }
 #else
 static inline bool McpSafeCompileBlueprint(UBlueprint* Blueprint) { return Blueprint != nullptr; }
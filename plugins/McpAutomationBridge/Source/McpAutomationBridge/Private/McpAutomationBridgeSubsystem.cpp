@@ -7,6 +7,19 @@
 
 #include "McpAutomationBridgeSubsystem.h"
 #include "MCP/McpNativeTransport.h"
+#include "McpBenchmark.h"
+#include "McpBuildJobs.h"
+#include "McpCompileScheduler.h"
+#include "McpMaterialEditSession.h"
+#include "McpMaterialGraphSpec.h"
+#include "McpNiagaraSpec.h"
+#include "McpNavBuildController.h"
+#include "McpRequestProfiler.h"
+#include "McpSaveCoordinator.h"
+#include "McpSoundFolderImport.h"
+#include "McpTraceAnalysis.h"
+#include "McpViewportStream.h"
+#include "McpWidgetTreeSpec.h"
 #include "Interfaces/IPluginManager.h"
 
 // =============================================================================
@@ -169,6 +182,37 @@ void UMcpAutomationBridgeSubsystem::Initialize(
   // Initialize the handler registry
   InitializeHandlers();
 
+  // Saves fail at flush time, after the response went out; tell the
+  // requester with an event instead
+  McpSaveCoordinator::SetFailureSink(
+      [WeakThis = TWeakObjectPtr<UMcpAutomationBridgeSubsystem>(this)](
+          const FString &RequestId, const TArray<FString> &Packages,
+          const FString &Reason) {
+        UMcpAutomationBridgeSubsystem *Self = WeakThis.Get();
+        if (!Self || !Self->ConnectionManager.IsValid()) {
+          return;
+        }
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetBoolField(TEXT("success"), false);
+        Result->SetStringField(TEXT("error"), TEXT("SAVE_FAILED"));
+        Result->SetStringField(
+            TEXT("message"),
+            FString::Printf(TEXT("Queued save failed for %d package(s) (%s flush)"),
+                            Packages.Num(), *Reason));
+        TArray<TSharedPtr<FJsonValue>> PackageValues;
+        for (const FString &Package : Packages) {
+          PackageValues.Add(MakeShared<FJsonValueString>(Package));
+        }
+        Result->SetArrayField(TEXT("failedPackages"), PackageValues);
+
+        TSharedPtr<FJsonObject> Notify = MakeShared<FJsonObject>();
+        Notify->SetStringField(TEXT("type"), TEXT("automation_event"));
+        Notify->SetStringField(TEXT("event"), TEXT("asset_save_failed"));
+        Notify->SetStringField(TEXT("requestId"), RequestId);
+        Notify->SetObjectField(TEXT("result"), Result);
+        Self->ConnectionManager->SendControlMessage(Notify);
+      });
+
   // Start the connection manager
   ConnectionManager->Start();
 
@@ -234,6 +278,33 @@ void UMcpAutomationBridgeSubsystem::Deinitialize() {
            TEXT("McpAutomationBridgeSubsystem deinitializing."));
   }
 
+  // Viewport streams hold sinks that write to the transports below
+  McpViewportStream::StopAll();
+
+  // Terminate UBT processes rather than leaving them orphaned
+  McpBuildJobs::CancelAll();
+  McpBenchmark::CancelAll();
+  McpTraceAnalysis::CancelAll();
+  // Release a paused navmesh build and delete benchmark actors
+  McpNavBuildController::CancelAll();
+  // Compile materials whose edit sessions were never committed
+  McpMaterialEditSession::CancelWaits();
+  McpMaterialGraphSpec::CancelBenchmark();
+  McpNiagaraSpec::CancelAll();
+  McpSoundFolderImport::CancelAll();
+  McpWidgetTreeSpec::CancelAll();
+  if (!IsRunningCommandlet()) {
+    McpMaterialEditSession::CommitAll(TEXT("shutdown"));
+  }
+
+  // Compile deferred Blueprints, then write any saves still waiting for an
+  // idle flush
+  if (!IsRunningCommandlet()) {
+    McpCompileScheduler::Flush(TEXT("shutdown"));
+    McpSaveCoordinator::Flush(TEXT("shutdown"));
+    McpSaveCoordinator::SetFailureSink(nullptr);
+  }
+
   if (NativeTransport)
   {
     NativeTransport->Shutdown();
@@ -366,7 +437,10 @@ bool UMcpAutomationBridgeSubsystem::SendRawMessage(const FString &Message) {
  *
  * Invokes processing of any pending automation requests that were previously
  * deferred due to unsafe engine states (saving, garbage collection, or async
- * loading).
+ * loading), then lets the compile scheduler and save coordinator flush
+ * deferred Blueprint compiles and queued asset saves, and the navigation
+ * build controller resume navmesh building, if the bridge has been idle long
+ * enough.
  *
  * @param DeltaTime Time elapsed since the last tick, in seconds.
  * @return true to remain registered and continue receiving ticks.
@@ -378,6 +452,19 @@ bool UMcpAutomationBridgeSubsystem::Tick(float DeltaTime) {
       !IsGarbageCollecting() && !IsAsyncLoading()) {
     ProcessPendingAutomationRequests();
   }
+  // Compile deferred Blueprints, then flush coalesced asset saves, once the
+  // bridge goes idle
+  McpCompileScheduler::Tick(bProcessingAutomationRequest);
+  // A folder import queues its packages and flushes them once when it ends
+  McpSaveCoordinator::Tick(bProcessingAutomationRequest || McpSoundFolderImport::IsRunning());
+  // Resume paused navmesh building once idle and report rebuild progress
+  McpNavBuildController::Tick(bProcessingAutomationRequest);
+  // Compile expired material edit sessions and report material and Niagara
+  // compile progress
+  McpMaterialEditSession::Tick();
+  McpNiagaraSpec::Tick();
+  McpSoundFolderImport::Tick();
+  McpWidgetTreeSpec::Tick();
   // Cleanup stale HTTP pending requests (5 minute timeout)
   if (NativeTransport)
   {
@@ -410,24 +497,35 @@ void UMcpAutomationBridgeSubsystem::SendAutomationResponse(
     const bool bSuccess, const FString &Message,
     const TSharedPtr<FJsonObject> &Result, const FString &ErrorCode,
     ERequestOrigin Origin) {
+  // Assets this request queued are not on disk yet: report saveQueued rather
+  // than saved
+  const TSharedPtr<FJsonObject> ResponseResult =
+      McpSaveCoordinator::AnnotateResponse(RequestId, Result);
+
   // When handlers omit Origin (default WebSocket), use the stored
   // CurrentRequestOrigin from the active ProcessAutomationRequest call.
   ERequestOrigin EffectiveOrigin = (Origin == ERequestOrigin::WebSocket)
       ? CurrentRequestOrigin : Origin;
   if (EffectiveOrigin == ERequestOrigin::NativeHTTP && NativeTransport)
   {
-    if (!NativeTransport->CompletePendingRequest(RequestId, bSuccess, Message, Result, ErrorCode))
     {
-      UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
-        TEXT("Native HTTP response for %s dropped — request already expired or unknown"),
-        *RequestId);
+      McpRequestProfiler::FPhaseScope SendPhase(
+          McpRequestProfiler::EPhase::Send, RequestId);
+      if (!NativeTransport->CompletePendingRequest(RequestId, bSuccess, Message, ResponseResult, ErrorCode))
+      {
+        UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
+          TEXT("Native HTTP response for %s dropped — request already expired or unknown"),
+          *RequestId);
+      }
     }
+    McpRequestProfiler::EndRequest(RequestId, bSuccess, ErrorCode);
     return;
   }
   if (ConnectionManager.IsValid()) {
     ConnectionManager->SendAutomationResponse(TargetSocket, RequestId, bSuccess,
-                                              Message, Result, ErrorCode);
+                                              Message, ResponseResult, ErrorCode);
   }
+  McpRequestProfiler::EndRequest(RequestId, bSuccess, ErrorCode);
 }
 
 /**
@@ -1352,7 +1450,8 @@ void UMcpAutomationBridgeSubsystem::InitializeHandlers() {
  * Ensures execution on the game thread (re-dispatches if called from another
  * thread), moves the shared pending-request queue into a local list under a
  * lock, clears the shared queue and the scheduled flag, then dispatches each
- * request to ProcessAutomationRequest.
+ * request to ProcessAutomationRequest and flushes the compiles and saves the
+ * batch deferred.
  */
 void UMcpAutomationBridgeSubsystem::ProcessPendingAutomationRequests() {
   if (!IsInGameThread()) {
@@ -1377,6 +1476,13 @@ void UMcpAutomationBridgeSubsystem::ProcessPendingAutomationRequests() {
     ProcessAutomationRequest(Req.RequestId, Req.Action, Req.Payload,
                              Req.RequestingSocket, Req.Origin);
   }
+
+  // A drained queue is a batch boundary: compile its Blueprints and write its
+  // saves together
+  if (!bProcessingAutomationRequest && !GIsSavingPackage) {
+    McpCompileScheduler::Flush(TEXT("batch"));
+    McpSaveCoordinator::Flush(TEXT("batch"));
+  }
 }
 
 // ============================================================================
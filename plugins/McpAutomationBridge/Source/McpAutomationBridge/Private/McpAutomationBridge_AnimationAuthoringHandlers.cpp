@@ -9,6 +9,8 @@
 //   - create_animation_sequence    : Create UAnimSequence asset
 //   - add_animation_curve          : Add curve to animation
 //   - set_animation_rate           : Set animation frame rate
+//   - set_bone_track_keys          : Bulk bone tracks from packed arrays (5.1+)
+//   - set_curves                   : Bulk float curves from packed arrays (5.1+)
 //
 // Section 2: Animation Montages
 //   - create_animation_montage     : Create UAnimMontage from sequence
@@ -65,6 +67,8 @@
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION == 0
 #pragma warning(pop)
 #endif
+#include "Animation/AnimData/IAnimationDataController.h"
+#include "Curves/RichCurve.h"
 #include "Engine/SkeletalMesh.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetToolsModule.h"
@@ -76,6 +80,7 @@
 #include "Misc/PackageName.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/Kismet2NameValidators.h"
+#include "Misc/Base64.h"
 
 // Blend Space factories
 #if __has_include("Factories/BlendSpaceFactoryNew.h") && __has_include("Factories/BlendSpaceFactory1D.h")
@@ -389,6 +394,256 @@ static FRotator GetRotatorFromJsonAnim(const TSharedPtr<FJsonObject>& Obj)
     return FRotator::ZeroRotator;
 }
 
+// ============================================================================
+// Bulk Key Helpers (set_bone_track_keys / set_curves)
+// ============================================================================
+// Packed arrays are either base64 strings of little-endian float32 data or
+// plain JSON number arrays, one entry per key:
+//   positions : x, y, z
+//   rotations : x, y, z, w (quaternion) or pitch, yaw, roll (rotationFormat "euler")
+//   scales    : x, y, z
+//   values / times / frames : one float per curve key
+// A bone component given as a single key is held for the whole sequence.
+
+static bool ReadPackedAnimBuffer(const TSharedPtr<FJsonObject>& Obj, const TCHAR* FieldName,
+                                 TArray<float>& OutValues, FString& OutError)
+{
+    OutValues.Reset();
+
+    FString Encoded;
+    if (Obj->TryGetStringField(FieldName, Encoded))
+    {
+        TArray<uint8> Bytes;
+        if (!FBase64::Decode(Encoded, Bytes))
+        {
+            OutError = FString::Printf(TEXT("'%s' is not valid base64"), FieldName);
+            return false;
+        }
+        if (Bytes.Num() % sizeof(float) != 0)
+        {
+            OutError = FString::Printf(TEXT("'%s' byte length %d is not a multiple of 4"), FieldName, Bytes.Num());
+            return false;
+        }
+        OutValues.SetNumUninitialized(Bytes.Num() / sizeof(float));
+        FMemory::Memcpy(OutValues.GetData(), Bytes.GetData(), Bytes.Num());
+        return true;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (Obj->TryGetArrayField(FieldName, Values) && Values)
+    {
+        OutValues.Reserve(Values->Num());
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            OutValues.Add(static_cast<float>(Value.IsValid() ? Value->AsNumber() : 0.0));
+        }
+    }
+    return true;
+}
+
+struct FBulkBoneTrack
+{
+    FName BoneName;
+    TArray<FVector> Positions;
+    TArray<FQuat> Rotations;
+    TArray<FVector> Scales;
+
+    int32 GetNumKeys() const
+    {
+        return FMath::Max3(Positions.Num(), Rotations.Num(), Scales.Num());
+    }
+};
+
+struct FBulkCurve
+{
+    FName CurveName;
+    TArray<FRichCurveKey> Keys;
+};
+
+// Parse one entry of 'tracks'. Omitted components take the bone's reference pose.
+static bool ParseBulkBoneTrack(const TSharedPtr<FJsonObject>& TrackObj, const FReferenceSkeleton& RefSkeleton,
+                               bool bEulerRotations, FBulkBoneTrack& OutTrack, FString& OutError, FString& OutErrorCode)
+{
+    OutErrorCode = TEXT("INVALID_ARGUMENT");
+
+    const FString BoneName = GetStringFieldAnimAuth(TrackObj, TEXT("boneName"), TEXT(""));
+    if (BoneName.IsEmpty())
+    {
+        OutError = TEXT("Every track needs a boneName");
+        OutErrorCode = TEXT("MISSING_BONE_NAME");
+        return false;
+    }
+
+    OutTrack.BoneName = FName(*BoneName);
+    const int32 BoneIndex = RefSkeleton.FindBoneIndex(OutTrack.BoneName);
+    if (BoneIndex == INDEX_NONE)
+    {
+        OutError = FString::Printf(TEXT("Bone '%s' not found in skeleton"), *BoneName);
+        OutErrorCode = TEXT("BONE_NOT_FOUND_IN_SKELETON");
+        return false;
+    }
+    const FTransform& RefPose = RefSkeleton.GetRefBonePose()[BoneIndex];
+
+    TArray<float> Packed;
+    if (!ReadPackedAnimBuffer(TrackObj, TEXT("positions"), Packed, OutError))
+    {
+        return false;
+    }
+    if (Packed.Num() % 3 != 0)
+    {
+        OutError = FString::Printf(TEXT("Track '%s': positions must hold 3 floats per key"), *BoneName);
+        return false;
+    }
+    for (int32 Index = 0; Index < Packed.Num(); Index += 3)
+    {
+        OutTrack.Positions.Add(FVector(Packed[Index], Packed[Index + 1], Packed[Index + 2]));
+    }
+
+    if (!ReadPackedAnimBuffer(TrackObj, TEXT("rotations"), Packed, OutError))
+    {
+        return false;
+    }
+    const int32 RotationStride = bEulerRotations ? 3 : 4;
+    if (Packed.Num() % RotationStride != 0)
+    {
+        OutError = FString::Printf(TEXT("Track '%s': rotations must hold %d floats per key"), *BoneName, RotationStride);
+        return false;
+    }
+    for (int32 Index = 0; Index < Packed.Num(); Index += RotationStride)
+    {
+        OutTrack.Rotations.Add(bEulerRotations
+            ? FRotator(Packed[Index], Packed[Index + 1], Packed[Index + 2]).Quaternion()
+            : FQuat(Packed[Index], Packed[Index + 1], Packed[Index + 2], Packed[Index + 3]).GetNormalized());
+    }
+
+    if (!ReadPackedAnimBuffer(TrackObj, TEXT("scales"), Packed, OutError))
+    {
+        return false;
+    }
+    if (Packed.Num() % 3 != 0)
+    {
+        OutError = FString::Printf(TEXT("Track '%s': scales must hold 3 floats per key"), *BoneName);
+        return false;
+    }
+    for (int32 Index = 0; Index < Packed.Num(); Index += 3)
+    {
+        OutTrack.Scales.Add(FVector(Packed[Index], Packed[Index + 1], Packed[Index + 2]));
+    }
+
+    if (OutTrack.Positions.Num() == 0)
+    {
+        OutTrack.Positions.Add(RefPose.GetTranslation());
+    }
+    if (OutTrack.Rotations.Num() == 0)
+    {
+        OutTrack.Rotations.Add(RefPose.GetRotation());
+    }
+    if (OutTrack.Scales.Num() == 0)
+    {
+        OutTrack.Scales.Add(RefPose.GetScale3D());
+    }
+    return true;
+}
+
+// Bring every component of a track to NumKeys keys, holding single keys.
+template <typename T>
+static bool ExpandBulkKeys(TArray<T>& Keys, int32 NumKeys)
+{
+    if (Keys.Num() == NumKeys)
+    {
+        return true;
+    }
+    if (Keys.Num() != 1)
+    {
+        return false;
+    }
+    const T Held = Keys[0];
+    Keys.Init(Held, NumKeys);
+    return true;
+}
+
+// Parse one entry of 'curves'. Keys are placed at 'times' (seconds), at
+// 'frames', or at frame 0, 1, 2... when neither is given. Tangents of cubic
+// keys are computed here since the controller stores keys as given.
+static bool ParseBulkCurve(const TSharedPtr<FJsonObject>& CurveObj, double FrameRate,
+                           FBulkCurve& OutCurve, FString& OutError)
+{
+    const FString CurveName = GetStringFieldAnimAuth(CurveObj, TEXT("curveName"), TEXT(""));
+    if (CurveName.IsEmpty())
+    {
+        OutError = TEXT("Every curve needs a curveName");
+        return false;
+    }
+    OutCurve.CurveName = FName(*CurveName);
+
+    TArray<float> Values;
+    TArray<float> Times;
+    TArray<float> Frames;
+    if (!ReadPackedAnimBuffer(CurveObj, TEXT("values"), Values, OutError) ||
+        !ReadPackedAnimBuffer(CurveObj, TEXT("times"), Times, OutError) ||
+        !ReadPackedAnimBuffer(CurveObj, TEXT("frames"), Frames, OutError))
+    {
+        return false;
+    }
+    if (Values.Num() == 0)
+    {
+        OutError = FString::Printf(TEXT("Curve '%s' has no values"), *CurveName);
+        return false;
+    }
+    if ((Times.Num() > 0 && Times.Num() != Values.Num()) || (Frames.Num() > 0 && Frames.Num() != Values.Num()))
+    {
+        OutError = FString::Printf(TEXT("Curve '%s': times/frames must have one entry per value"), *CurveName);
+        return false;
+    }
+
+    const FString Interpolation = GetStringFieldAnimAuth(CurveObj, TEXT("interpolation"), TEXT("cubic")).ToLower();
+    ERichCurveInterpMode InterpMode = RCIM_Cubic;
+    if (Interpolation == TEXT("linear"))
+    {
+        InterpMode = RCIM_Linear;
+    }
+    else if (Interpolation == TEXT("constant"))
+    {
+        InterpMode = RCIM_Constant;
+    }
+    else if (Interpolation != TEXT("cubic"))
+    {
+        OutError = FString::Printf(TEXT("Curve '%s': unknown interpolation '%s' (cubic, linear, constant)"), *CurveName, *Interpolation);
+        return false;
+    }
+
+    FRichCurve Curve;
+    TArray<FRichCurveKey> Keys;
+    Keys.Reserve(Values.Num());
+    for (int32 Index = 0; Index < Values.Num(); ++Index)
+    {
+        const float Time = Times.Num() > 0 ? Times[Index]
+            : static_cast<float>((Frames.Num() > 0 ? Frames[Index] : Index) / FrameRate);
+        FRichCurveKey& Key = Keys.Emplace_GetRef(Time, Values[Index]);
+        Key.InterpMode = InterpMode;
+    }
+    Keys.Sort([](const FRichCurveKey& A, const FRichCurveKey& B) { return A.Time < B.Time; });
+
+    Curve.SetKeys(Keys);
+    Curve.AutoSetTangents();
+    OutCurve.Keys = Curve.GetConstRefOfKeys();
+    return true;
+}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+static FAnimationCurveIdentifier MakeFloatCurveId(FName CurveName)
+{
+    return FAnimationCurveIdentifier(CurveName, ERawCurveTrackTypes::RCT_Float);
+}
+#elif ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+static FAnimationCurveIdentifier MakeFloatCurveId(FName CurveName)
+{
+    FSmartName SmartCurveName;
+    SmartCurveName.DisplayName = CurveName;
+    return FAnimationCurveIdentifier(SmartCurveName, ERawCurveTrackTypes::RCT_Float);
+}
+#endif
+
 // ============================================================================
 // AnimGraph Helper Functions for State Machine Implementation
 // ============================================================================
@@ -985,6 +1240,268 @@ static TSharedPtr<FJsonObject> HandleAnimationAuthoringRequest(const TSharedPtr<
         return Response;
     }
 
+    // Bulk authoring: every bone track and curve of the request is written
+    // inside one controller bracket, so the data model broadcasts a single
+    // change, and compression is requested once at the end instead of per key.
+    if (SubAction == TEXT("set_bone_track_keys") || SubAction == TEXT("set_curves"))
+    {
+        const bool bBoneTracks = SubAction == TEXT("set_bone_track_keys");
+        FString AssetPath = NormalizeAnimPath(GetStringFieldAnimAuth(Params, TEXT("assetPath"), TEXT("")));
+        FString RotationFormat = GetStringFieldAnimAuth(Params, TEXT("rotationFormat"), TEXT("quat")).ToLower();
+        bool bCreateIfMissing = GetBoolFieldAnimAuth(Params, TEXT("createIfMissing"), true);
+        bool bRecompress = GetBoolFieldAnimAuth(Params, TEXT("recompress"), true);
+        bool bSave = GetBoolFieldAnimAuth(Params, TEXT("save"), true);
+
+        const TArray<TSharedPtr<FJsonValue>>* TrackValues = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* CurveValues = nullptr;
+        if (bBoneTracks)
+        {
+            Params->TryGetArrayField(TEXT("tracks"), TrackValues);
+            if (!TrackValues || TrackValues->Num() == 0)
+            {
+                ANIM_ERROR_RESPONSE(TEXT("tracks is required and must not be empty"), TEXT("MISSING_TRACKS"));
+            }
+        }
+        Params->TryGetArrayField(TEXT("curves"), CurveValues);
+        if (!bBoneTracks && (!CurveValues || CurveValues->Num() == 0))
+        {
+            ANIM_ERROR_RESPONSE(TEXT("curves is required and must not be empty"), TEXT("MISSING_CURVES"));
+        }
+        if (RotationFormat != TEXT("quat") && RotationFormat != TEXT("euler"))
+        {
+            ANIM_ERROR_RESPONSE(FString::Printf(TEXT("Unknown rotationFormat '%s' (quat, euler)"), *RotationFormat), TEXT("INVALID_ARGUMENT"));
+        }
+
+        UAnimSequence* Sequence = LoadAnimSequenceFromPath(AssetPath);
+        if (!Sequence)
+        {
+            ANIM_ERROR_RESPONSE(FString::Printf(TEXT("Could not load animation sequence: %s"), *AssetPath), TEXT("SEQUENCE_NOT_FOUND"));
+        }
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+        IAnimationDataController& Controller = Sequence->GetController();
+        if (!Controller.GetModel())
+        {
+            ANIM_ERROR_RESPONSE(TEXT("Animation data model is not available - cannot set keys"), TEXT("MODEL_NOT_AVAILABLE"));
+        }
+
+        const bool bSetFrameRate = Params->HasField(TEXT("frameRate"));
+        const FFrameRate FrameRate = bSetFrameRate
+            ? FFrameRate(static_cast<int32>(GetNumberFieldAnimAuth(Params, TEXT("frameRate"), 30)), 1)
+            : Sequence->GetSamplingFrameRate();
+        if (FrameRate.Numerator <= 0)
+        {
+            ANIM_ERROR_RESPONSE(TEXT("frameRate must be positive"), TEXT("INVALID_ARGUMENT"));
+        }
+
+        // Parse and validate everything before the model is touched, so a bad
+        // request leaves the sequence unchanged.
+        TArray<FBulkBoneTrack> Tracks;
+        if (TrackValues)
+        {
+            USkeleton* Skeleton = Sequence->GetSkeleton();
+            if (!Skeleton)
+            {
+                ANIM_ERROR_RESPONSE(TEXT("Animation sequence has no skeleton reference"), TEXT("NO_SKELETON"));
+            }
+            const bool bEulerRotations = RotationFormat == TEXT("euler");
+            for (const TSharedPtr<FJsonValue>& TrackValue : *TrackValues)
+            {
+                const TSharedPtr<FJsonObject>* TrackObj = nullptr;
+                if (!TrackValue.IsValid() || !TrackValue->TryGetObject(TrackObj) || !TrackObj)
+                {
+                    ANIM_ERROR_RESPONSE(TEXT("Every entry of tracks must be an object"), TEXT("INVALID_ARGUMENT"));
+                }
+                FString ParseError;
+                FString ParseErrorCode;
+                if (!ParseBulkBoneTrack(*TrackObj, Skeleton->GetReferenceSkeleton(), bEulerRotations,
+                                        Tracks.AddDefaulted_GetRef(), ParseError, ParseErrorCode))
+                {
+                    ANIM_ERROR_RESPONSE(ParseError, ParseErrorCode);
+                }
+            }
+        }
+
+        TArray<FBulkCurve> Curves;
+        if (CurveValues)
+        {
+            for (const TSharedPtr<FJsonValue>& CurveValue : *CurveValues)
+            {
+                const TSharedPtr<FJsonObject>* CurveObj = nullptr;
+                if (!CurveValue.IsValid() || !CurveValue->TryGetObject(CurveObj) || !CurveObj)
+                {
+                    ANIM_ERROR_RESPONSE(TEXT("Every entry of curves must be an object"), TEXT("INVALID_ARGUMENT"));
+                }
+                FString ParseError;
+                if (!ParseBulkCurve(*CurveObj, FrameRate.AsDecimal(), Curves.AddDefaulted_GetRef(), ParseError))
+                {
+                    ANIM_ERROR_RESPONSE(ParseError, TEXT("INVALID_ARGUMENT"));
+                }
+            }
+        }
+
+        // Key count of the sequence after the write: numFrames + 1 when given,
+        // otherwise the longest track, otherwise the current length.
+        const int32 CurrentNumKeys = Sequence->GetDataModel()->GetNumberOfKeys();
+        int32 NumKeys = CurrentNumKeys;
+        if (Params->HasField(TEXT("numFrames")))
+        {
+            NumKeys = static_cast<int32>(GetNumberFieldAnimAuth(Params, TEXT("numFrames"), 0)) + 1;
+        }
+        else
+        {
+            int32 LongestTrack = 1;
+            for (const FBulkBoneTrack& Track : Tracks)
+            {
+                LongestTrack = FMath::Max(LongestTrack, Track.GetNumKeys());
+            }
+            if (LongestTrack > 1)
+            {
+                NumKeys = LongestTrack;
+            }
+        }
+        if (NumKeys != CurrentNumKeys && NumKeys < 2)
+        {
+            ANIM_ERROR_RESPONSE(TEXT("numFrames must be at least 1"), TEXT("INVALID_ARGUMENT"));
+        }
+        for (FBulkBoneTrack& Track : Tracks)
+        {
+            if (!ExpandBulkKeys(Track.Positions, NumKeys) || !ExpandBulkKeys(Track.Rotations, NumKeys) ||
+                !ExpandBulkKeys(Track.Scales, NumKeys))
+            {
+                ANIM_ERROR_RESPONSE(
+                    FString::Printf(TEXT("Track '%s' has %d keys; every component needs 1 or %d keys"),
+                        *Track.BoneName.ToString(), Track.GetNumKeys(), NumKeys),
+                    TEXT("KEY_COUNT_MISMATCH"));
+            }
+        }
+
+        int32 BoneKeysWritten = 0;
+        int32 CurveKeysWritten = 0;
+        int32 TracksWritten = 0;
+        int32 CurvesWritten = 0;
+        int32 TracksAdded = 0;
+        int32 CurvesAdded = 0;
+        TArray<FString> FailedNames;
+
+        const double WriteStart = FPlatformTime::Seconds();
+        {
+            IAnimationDataController::FScopedBracket Bracket(Controller,
+                FText::FromString(FString::Printf(TEXT("MCP %s"), *SubAction)));
+
+            if (bSetFrameRate)
+            {
+                Controller.SetFrameRate(FrameRate);
+            }
+            if (NumKeys != CurrentNumKeys)
+            {
+                Controller.SetNumberOfFrames(FFrameNumber(NumKeys - 1));
+            }
+
+            for (const FBulkBoneTrack& Track : Tracks)
+            {
+                PRAGMA_DISABLE_DEPRECATION_WARNINGS
+                const bool bHasTrack = Controller.GetModel()->GetBoneTrackIndexByName(Track.BoneName) != INDEX_NONE;
+                PRAGMA_ENABLE_DEPRECATION_WARNINGS
+                if (!bHasTrack)
+                {
+                    if (!Controller.AddBoneCurve(Track.BoneName))
+                    {
+                        FailedNames.Add(Track.BoneName.ToString());
+                        continue;
+                    }
+                    ++TracksAdded;
+                }
+                if (Controller.SetBoneTrackKeys(Track.BoneName, Track.Positions, Track.Rotations, Track.Scales))
+                {
+                    BoneKeysWritten += NumKeys;
+                    ++TracksWritten;
+                }
+                else
+                {
+                    FailedNames.Add(Track.BoneName.ToString());
+                }
+            }
+
+            for (const FBulkCurve& Curve : Curves)
+            {
+                const FAnimationCurveIdentifier CurveId = MakeFloatCurveId(Curve.CurveName);
+                if (!Sequence->GetDataModel()->FindFloatCurve(CurveId))
+                {
+                    if (!bCreateIfMissing || !Controller.AddCurve(CurveId, AACF_DefaultCurve))
+                    {
+                        FailedNames.Add(Curve.CurveName.ToString());
+                        continue;
+                    }
+                    ++CurvesAdded;
+                }
+                if (Controller.SetCurveKeys(CurveId, Curve.Keys))
+                {
+                    CurveKeysWritten += Curve.Keys.Num();
+                    ++CurvesWritten;
+                }
+                else
+                {
+                    FailedNames.Add(Curve.CurveName.ToString());
+                }
+            }
+        }
+        const double WriteSeconds = FPlatformTime::Seconds() - WriteStart;
+        const int32 KeysWritten = BoneKeysWritten + CurveKeysWritten;
+
+        // One asynchronous compression request for the whole write. Saving
+        // waits for it in PreSave; pass save=false to return while it runs.
+        bool bCompressionRequested = false;
+        if (bRecompress && KeysWritten > 0)
+        {
+#if ENGINE_MINOR_VERSION >= 2
+            Sequence->BeginCacheDerivedDataForCurrentPlatform();
+#else
+            Sequence->RequestAsyncAnimRecompression(false);
+#endif
+            bCompressionRequested = true;
+        }
+
+        Response->SetStringField(TEXT("assetPath"), AssetPath);
+        Response->SetNumberField(TEXT("numKeys"), NumKeys);
+        Response->SetNumberField(TEXT("tracksWritten"), TracksWritten);
+        Response->SetNumberField(TEXT("curvesWritten"), CurvesWritten);
+        Response->SetNumberField(TEXT("tracksAdded"), TracksAdded);
+        Response->SetNumberField(TEXT("curvesAdded"), CurvesAdded);
+        Response->SetNumberField(TEXT("boneKeysWritten"), BoneKeysWritten);
+        Response->SetNumberField(TEXT("curveKeysWritten"), CurveKeysWritten);
+        Response->SetNumberField(TEXT("keysWritten"), KeysWritten);
+        Response->SetNumberField(TEXT("writeMs"), WriteSeconds * 1000.0);
+        Response->SetNumberField(TEXT("keysPerSecond"), WriteSeconds > 0.0 ? KeysWritten / WriteSeconds : 0.0);
+        Response->SetBoolField(TEXT("compressionRequested"), bCompressionRequested);
+
+        if (FailedNames.Num() > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> FailedArray;
+            for (const FString& Name : FailedNames)
+            {
+                FailedArray.Add(MakeShared<FJsonValueString>(Name));
+            }
+            Response->SetArrayField(TEXT("failed"), FailedArray);
+            ANIM_ERROR_RESPONSE(
+                FString::Printf(TEXT("%d track(s)/curve(s) could not be written: %s"), FailedNames.Num(), *FString::Join(FailedNames, TEXT(", "))),
+                TEXT("KEY_WRITE_FAILED"));
+        }
+
+        const double SaveStart = FPlatformTime::Seconds();
+        const bool bSaved = bSave && SaveAnimAsset(Sequence, true);
+        Response->SetBoolField(TEXT("saved"), bSaved);
+        Response->SetNumberField(TEXT("saveMs"), (FPlatformTime::Seconds() - SaveStart) * 1000.0);
+
+        ANIM_SUCCESS_RESPONSE(FString::Printf(TEXT("Wrote %d keys (%d bone, %d curve) in %.1f ms"),
+            KeysWritten, BoneKeysWritten, CurveKeysWritten, WriteSeconds * 1000.0));
+        McpHandlerUtils::AddVerification(Response, Sequence);
+        return Response;
+#else
+        ANIM_ERROR_RESPONSE(FString::Printf(TEXT("%s requires UE 5.1 or later"), *SubAction), TEXT("NOT_SUPPORTED"));
+#endif
+    }
+
     if (SubAction == TEXT("add_notify"))
     {
         FString AssetPath = NormalizeAnimPath(GetStringFieldAnimAuth(Params, TEXT("assetPath"), TEXT("")));
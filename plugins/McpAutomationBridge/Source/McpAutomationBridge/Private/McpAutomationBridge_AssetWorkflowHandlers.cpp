@@ -23,6 +23,9 @@
 //     - fixup_redirectors, bulk_rename, bulk_delete
 //     - generate_lods, nanite_rebuild_mesh
 //
+//   Save Queue:
+//     - flush_saves, get_save_queue, benchmark_asset_saves
+//
 // REFACTORING NOTES:
 //   - Uses McpVersionCompatibility.h for UE 5.0-5.7 API abstraction
 //   - Uses McpHandlerUtils for standardized JSON parsing/responses
@@ -48,6 +51,8 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpSafeOperations.h"
+#include "McpMaterialEditSession.h"
+#include "McpSaveCoordinator.h"
 
 // -----------------------------------------------------------------------------
 // MCP Handler Utilities (centralized JSON/Asset helpers)
@@ -93,6 +98,7 @@
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetToolsModule.h"
 #include "AssetViewUtils.h"
+#include "Curves/CurveFloat.h"
 #include "EditorAssetLibrary.h"
 #include "Engine/StaticMesh.h"
 #include "EngineUtils.h"  // TActorIterator
@@ -267,6 +273,14 @@ bool UMcpAutomationBridgeSubsystem::HandleAssetAction(
   if (Lower == TEXT("rebuild_material"))
     return HandleRebuildMaterial(RequestId, Action, Payload, RequestingSocket);
 
+  // Save Queue
+  if (Lower == TEXT("flush_saves"))
+    return HandleFlushSaves(RequestId, Action, Payload, RequestingSocket);
+  if (Lower == TEXT("get_save_queue"))
+    return HandleGetSaveQueue(RequestId, Action, Payload, RequestingSocket);
+  if (Lower == TEXT("benchmark_asset_saves"))
+    return HandleBenchmarkAssetSaves(RequestId, Action, Payload, RequestingSocket);
+
   return false;
 }
 
@@ -4178,8 +4192,7 @@ bool UMcpAutomationBridgeSubsystem::HandleConnectMaterialPins(
 #endif
 
     if (bFound) {
-      Material->PostEditChange();
-      Material->MarkPackageDirty();
+      McpMaterialEditSession::NotifyEdited(Material);
 
       TSharedPtr<FJsonObject> Resp = McpHandlerUtils::CreateResultObject();
       McpHandlerUtils::AddVerification(Resp, Material);
@@ -4252,8 +4265,7 @@ bool UMcpAutomationBridgeSubsystem::HandleConnectMaterialPins(
 
   // Make the connection
   TargetInput->Expression = FromExpression;
-  Material->PostEditChange();
-  Material->MarkPackageDirty();
+  McpMaterialEditSession::NotifyEdited(Material);
 
   TSharedPtr<FJsonObject> Resp = McpHandlerUtils::CreateResultObject();
   McpHandlerUtils::AddVerification(Resp, Material);
@@ -4400,8 +4412,7 @@ bool UMcpAutomationBridgeSubsystem::HandleRemoveMaterialNode(
   // Also remove from the material's root node if connected
   Material->RemoveExpressionParameter(ExpressionToRemove);
 
-  Material->PostEditChange();
-  Material->MarkPackageDirty();
+  McpMaterialEditSession::NotifyEdited(Material);
 
   TSharedPtr<FJsonObject> Resp = McpHandlerUtils::CreateResultObject();
   McpHandlerUtils::AddVerification(Resp, Material);
@@ -4563,8 +4574,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBreakMaterialConnections(
 #endif
 
     if (bFound) {
-      Material->PostEditChange();
-      Material->MarkPackageDirty();
+      McpMaterialEditSession::NotifyEdited(Material);
 
       TSharedPtr<FJsonObject> Resp = McpHandlerUtils::CreateResultObject();
       McpHandlerUtils::AddVerification(Resp, Material);
@@ -4630,8 +4640,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBreakMaterialConnections(
     }
   }
 
-  Material->PostEditChange();
-  Material->MarkPackageDirty();
+  McpMaterialEditSession::NotifyEdited(Material);
 
   TSharedPtr<FJsonObject> Resp = McpHandlerUtils::CreateResultObject();
   McpHandlerUtils::AddVerification(Resp, Material);
@@ -5482,3 +5491,211 @@ bool UMcpAutomationBridgeSubsystem::HandleRebuildMaterial(
   return true;
 #endif
 }
+
+// ============================================================================
+// SAVE QUEUE (McpSaveCoordinator)
+// ============================================================================
+
+bool UMcpAutomationBridgeSubsystem::HandleFlushSaves(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+#if WITH_EDITOR
+  const McpSaveCoordinator::FFlushResult Flush =
+      McpSaveCoordinator::Flush(TEXT("explicit"));
+
+  TSharedPtr<FJsonObject> Result = McpSaveCoordinator::FlushResultToJson(Flush);
+  Result->SetNumberField(TEXT("pending"), McpSaveCoordinator::NumPending());
+
+  const bool bOk = Flush.FailedPackages.Num() == 0;
+  SendAutomationResponse(
+      Socket, RequestId, bOk,
+      bOk ? FString::Printf(TEXT("Flushed %d queued package(s)"), Flush.Saved)
+          : FString::Printf(TEXT("%d of %d package(s) failed to save"),
+                            Flush.FailedPackages.Num(), Flush.Requested),
+      Result, bOk ? FString() : TEXT("SAVE_FAILED"));
+  return true;
+#else
+  SendAutomationError(Socket, RequestId, TEXT("Editor only."),
+                      TEXT("EDITOR_ONLY"));
+  return true;
+#endif
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleGetSaveQueue(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+  bool bIncludePackages = true;
+  if (Payload.IsValid()) {
+    Payload->TryGetBoolField(TEXT("includePackages"), bIncludePackages);
+  }
+
+  TSharedPtr<FJsonObject> Result =
+      McpSaveCoordinator::GetStatus(bIncludePackages);
+  SendAutomationResponse(
+      Socket, RequestId, true,
+      FString::Printf(TEXT("%d package(s) queued for save"),
+                      McpSaveCoordinator::NumPending()),
+      Result, FString());
+  return true;
+}
+
+bool UMcpAutomationBridgeSubsystem::HandleBenchmarkAssetSaves(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+#if WITH_EDITOR
+  int32 Count = 200;
+  FString RootPath = TEXT("/Game/McpSaveBenchmark");
+  bool bCleanup = true;
+  if (Payload.IsValid()) {
+    double CountValue = 0.0;
+    if (Payload->TryGetNumberField(TEXT("count"), CountValue)) {
+      Count = static_cast<int32>(CountValue);
+    }
+    Payload->TryGetStringField(TEXT("path"), RootPath);
+    Payload->TryGetBoolField(TEXT("cleanup"), bCleanup);
+  }
+
+  if (Count < 1 || Count > 2000) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("count must be between 1 and 2000"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+  RootPath.RemoveFromEnd(TEXT("/"));
+  if (!RootPath.StartsWith(TEXT("/Game/"))) {
+    SendAutomationError(Socket, RequestId,
+                        TEXT("path must be a folder under /Game/"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  // Each run gets its own folder so repeated runs never collide
+  const FString RunPath =
+      RootPath / FString::Printf(
+                     TEXT("Run_%s"),
+                     *FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(8));
+  const FString PerOpPath = RunPath / TEXT("PerOp");
+  const FString CoalescedPath = RunPath / TEXT("Coalesced");
+
+  // Cheap stand-in for an authored asset: one package, one small object
+  auto CreateCurve = [](const FString &Folder, int32 Index) -> UCurveFloat * {
+    const FString AssetName = FString::Printf(TEXT("Curve_%04d"), Index);
+    UPackage *Package = CreatePackage(*(Folder / AssetName));
+    if (!Package) {
+      return nullptr;
+    }
+    UCurveFloat *Curve = NewObject<UCurveFloat>(Package, *AssetName,
+                                                RF_Public | RF_Standalone);
+    Curve->FloatCurve.AddKey(0.0f, 0.0f);
+    Curve->FloatCurve.AddKey(1.0f, static_cast<float>(Index));
+    return Curve;
+  };
+
+  // Start from an empty queue so the coalesced flush only holds this run
+  McpSaveCoordinator::Flush(TEXT("benchmark"));
+
+  int32 CreateFailures = 0;
+
+  // saveCalls / registryScans are measured from the coordinator's counters
+  auto DiffIo = [](const McpSaveCoordinator::FIoCounters &Start) {
+    const McpSaveCoordinator::FIoCounters End =
+        McpSaveCoordinator::GetIoCounters();
+    McpSaveCoordinator::FIoCounters Delta;
+    Delta.SaveCalls = End.SaveCalls - Start.SaveCalls;
+    Delta.RegistryScans = End.RegistryScans - Start.RegistryScans;
+    return Delta;
+  };
+
+  // Per-op: save and rescan after every asset (the pre-coordinator behavior)
+  int32 PerOpFailures = 0;
+  double PerOpSeconds = 0.0;
+  McpSaveCoordinator::FIoCounters PerOpIo;
+  {
+    McpSaveCoordinator::FScopedImmediateSaves ImmediateSaves;
+    const McpSaveCoordinator::FIoCounters IoStart =
+        McpSaveCoordinator::GetIoCounters();
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Count; ++Index) {
+      UCurveFloat *Curve = CreateCurve(PerOpPath, Index);
+      if (!Curve) {
+        ++CreateFailures;
+        continue;
+      }
+      if (!McpSafeAssetSave(Curve)) {
+        ++PerOpFailures;
+      }
+    }
+    PerOpSeconds = FPlatformTime::Seconds() - Start;
+    PerOpIo = DiffIo(IoStart);
+  }
+
+  // Coalesced: queue every asset, then one SavePackages batch and one scan
+  double CoalescedSeconds = 0.0;
+  McpSaveCoordinator::FFlushResult CoalescedFlush;
+  McpSaveCoordinator::FIoCounters CoalescedIo;
+  {
+    const McpSaveCoordinator::FIoCounters IoStart =
+        McpSaveCoordinator::GetIoCounters();
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Count; ++Index) {
+      UCurveFloat *Curve = CreateCurve(CoalescedPath, Index);
+      if (!Curve) {
+        ++CreateFailures;
+        continue;
+      }
+      McpSaveCoordinator::Enqueue(Curve);
+    }
+    CoalescedFlush = McpSaveCoordinator::Flush(TEXT("benchmark"));
+    CoalescedSeconds = FPlatformTime::Seconds() - Start;
+    CoalescedIo = DiffIo(IoStart);
+  }
+
+  auto ModeToJson = [Count](double Seconds,
+                            const McpSaveCoordinator::FIoCounters &Io,
+                            int32 Failures) {
+    TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+    Json->SetNumberField(TEXT("totalMs"), Seconds * 1000.0);
+    Json->SetNumberField(TEXT("perAssetMs"), Seconds * 1000.0 / Count);
+    Json->SetNumberField(TEXT("saveCalls"), static_cast<double>(Io.SaveCalls));
+    Json->SetNumberField(TEXT("registryScans"),
+                         static_cast<double>(Io.RegistryScans));
+    Json->SetNumberField(TEXT("failures"), Failures);
+    return Json;
+  };
+
+  TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+  Result->SetNumberField(TEXT("count"), Count);
+  Result->SetStringField(TEXT("path"), RunPath);
+  Result->SetNumberField(TEXT("createFailures"), CreateFailures);
+  Result->SetObjectField(TEXT("perOp"),
+                         ModeToJson(PerOpSeconds, PerOpIo, PerOpFailures));
+  TSharedPtr<FJsonObject> Coalesced =
+      ModeToJson(CoalescedSeconds, CoalescedIo,
+                 CoalescedFlush.FailedPackages.Num());
+  Coalesced->SetObjectField(
+      TEXT("flush"), McpSaveCoordinator::FlushResultToJson(CoalescedFlush));
+  Result->SetObjectField(TEXT("coalesced"), Coalesced);
+  Result->SetNumberField(TEXT("speedup"), CoalescedSeconds > 0.0
+                                              ? PerOpSeconds / CoalescedSeconds
+                                              : 0.0);
+
+  if (bCleanup) {
+    Result->SetBoolField(TEXT("cleanedUp"),
+                         McpSafeOperations::McpSafeDeleteFolder(RunPath));
+  }
+
+  SendAutomationResponse(
+      Socket, RequestId, true,
+      FString::Printf(TEXT("Saved %d assets: per-op %.0f ms, coalesced %.0f ms"),
+                      Count, PerOpSeconds * 1000.0, CoalescedSeconds * 1000.0),
+      Result, FString());
+  return true;
+#else
+  SendAutomationError(Socket, RequestId, TEXT("Editor only."),
+                      TEXT("EDITOR_ONLY"));
+  return true;
+#endif
+}
@@ -29,6 +29,11 @@
 //   - create_dialogue_voice        : Create UDialogueVoice
 //   - create_dialogue_wave         : Create UDialogueWave
 //
+// Section 7: Declarative Graphs & Bulk Import
+//   - apply_audio_graph            : Build a cue or MetaSound graph from one spec
+//   - create_sound_assets_from_folder : Import and wrap a folder of waves (async)
+//   - benchmark_sound_import       : Time a generated import-and-wrap job (async)
+//
 // VERSION COMPATIBILITY:
 // ----------------------
 // UE 5.0-5.7: Sound Cue/Class/Mix APIs stable
@@ -44,6 +49,8 @@
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
+#include "McpAudioGraphSpec.h"
+#include "McpSoundFolderImport.h"
 
 #if WITH_EDITOR
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -2157,6 +2164,93 @@ static TSharedPtr<FJsonObject> HandleAudioAuthoringRequest(const TSharedPtr<FJso
 #endif
     }
     
+    // ===== 11.7 Declarative Graphs =====
+    
+    if (SubAction == TEXT("apply_audio_graph"))
+    {
+        // Build a whole cue or MetaSound graph from one spec, then save once
+        // (see McpAudioGraphSpec.h)
+        FString AssetPath = NormalizeAudioPath(McpHandlerUtils::GetOptionalString(Params, TEXT("assetPath"), TEXT("")));
+        FString AssetType = McpHandlerUtils::GetOptionalString(Params, TEXT("assetType"), TEXT(""));
+        bool bSave = McpHandlerUtils::GetOptionalBool(Params, TEXT("save"), true);
+        
+        const TSharedPtr<FJsonObject>* SpecObj = nullptr;
+        if (AssetPath.IsEmpty())
+        {
+            return McpHandlerUtils::BuildErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("assetPath is required"));
+        }
+        if (!Params->TryGetObjectField(TEXT("spec"), SpecObj) || !SpecObj || !(*SpecObj).IsValid())
+        {
+            return McpHandlerUtils::BuildErrorResponse(TEXT("MISSING_PARAMETER"), TEXT("spec is required"));
+        }
+        
+        FString PackagePath, ObjectName;
+        if (!AssetPath.Split(TEXT("."), &PackagePath, &ObjectName))
+        {
+            PackagePath = AssetPath;
+            ObjectName = FPackageName::GetShortName(AssetPath);
+        }
+        UObject* Asset = LoadObject<UObject>(nullptr, *(PackagePath + TEXT(".") + ObjectName), nullptr, LOAD_NoWarn | LOAD_Quiet);
+        bool bCreated = false;
+        FString Error, ErrorCode;
+        if (!Asset)
+        {
+            if (AssetType.IsEmpty())
+            {
+                // MetaSound specs are the ones with edges or graph vertices
+                const bool bMetaSoundSpec = (*SpecObj)->HasField(TEXT("edges")) ||
+                    (*SpecObj)->HasField(TEXT("graphInputs")) || (*SpecObj)->HasField(TEXT("graphOutputs"));
+                AssetType = bMetaSoundSpec ? TEXT("MetaSound") : TEXT("SoundCue");
+            }
+            Asset = McpAudioGraphSpec::CreateAsset(PackagePath, AssetType, Error, ErrorCode);
+            if (!Asset)
+            {
+                return McpHandlerUtils::BuildErrorResponse(ErrorCode, Error);
+            }
+            bCreated = true;
+        }
+        
+        McpAudioGraphSpec::FApplyResult Result;
+        if (!McpAudioGraphSpec::Apply(Asset, *SpecObj, Result, Error, ErrorCode))
+        {
+            if (bCreated)
+            {
+                // Let GC take the empty asset rather than leave it to be saved later
+                Asset->ClearFlags(RF_Standalone | RF_Public);
+            }
+            return McpHandlerUtils::BuildErrorResponse(ErrorCode, Error);
+        }
+        
+        // One save (or one queued save) and one registry update for the whole graph
+        EMcpAssetSaveResult SaveResult = EMcpAssetSaveResult::Failed;
+        if (bSave)
+        {
+            SaveResult = McpRequestAssetSave(Asset);
+            if (SaveResult == EMcpAssetSaveResult::Failed)
+            {
+                return McpHandlerUtils::BuildErrorResponse(TEXT("SAVE_FAILED"),
+                    FString::Printf(TEXT("%s graph applied but %s could not be saved"), *Result.AssetType, *Asset->GetPathName()));
+            }
+        }
+        else
+        {
+            SaveAudioAsset(Asset, true);
+        }
+        
+        Response->SetStringField(TEXT("assetPath"), Asset->GetPathName());
+        Response->SetStringField(TEXT("assetType"), Result.AssetType);
+        Response->SetBoolField(TEXT("created"), bCreated);
+        Response->SetBoolField(TEXT("saved"), SaveResult == EMcpAssetSaveResult::Saved);
+        Response->SetBoolField(TEXT("saveQueued"), SaveResult == EMcpAssetSaveResult::Queued);
+        Response->SetObjectField(TEXT("apply"), Result.ToJson());
+        Response->SetObjectField(TEXT("nodeIds"), Result.NodeIds);
+        Response->SetBoolField(TEXT("success"), true);
+        Response->SetStringField(TEXT("message"), FString::Printf(TEXT("%s graph applied: %d nodes created, %d links (%d warnings)"),
+            *Result.AssetType, Result.Created, Result.Linked, Result.Warnings.Num()));
+        McpHandlerUtils::AddVerification(Response, Asset);
+        return Response;
+    }
+    
     // ===== Utility =====
     
     if (SubAction == TEXT("get_audio_info"))
@@ -2247,6 +2341,79 @@ bool UMcpAutomationBridgeSubsystem::HandleManageAudioAuthoringAction(
         return true;
     }
     
+    // Folder imports run over many ticks and answer when the job ends
+    const FString SubAction = GetJsonStringField(Payload, TEXT("subAction"));
+    if (SubAction == TEXT("create_sound_assets_from_folder") || SubAction == TEXT("benchmark_sound_import"))
+    {
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+        const ERequestOrigin Origin = CurrentRequestOrigin;
+        auto OnProgress = [WeakSelf, RequestId, Origin](float Percent, const FString& Message)
+        {
+            if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+            {
+                Subsystem->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+            }
+        };
+        auto OnComplete = [WeakSelf, RequestId, RequestingSocket, Origin](bool bSuccess, const FString& Message,
+                                                                         const TSharedPtr<FJsonObject>& JobResult, const FString& JobErrorCode)
+        {
+            if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+            {
+                Subsystem->SendAutomationResponse(RequestingSocket, RequestId, bSuccess, Message, JobResult, JobErrorCode, Origin);
+            }
+        };
+        
+        FString Error, ErrorCode;
+        bool bStarted = false;
+        if (SubAction == TEXT("create_sound_assets_from_folder"))
+        {
+            McpSoundFolderImport::FSettings Settings;
+            Settings.SourceFolder = McpHandlerUtils::GetOptionalString(Payload, TEXT("sourceFolder"), TEXT(""));
+            Settings.DestinationPath = NormalizeAudioPath(McpHandlerUtils::GetOptionalString(Payload, TEXT("destinationPath"), TEXT("/Game/Audio/Imported")));
+            Settings.bRecursive = McpHandlerUtils::GetOptionalBool(Payload, TEXT("recursive"), true);
+            Settings.Wrap = McpHandlerUtils::GetOptionalString(Payload, TEXT("wrap"), TEXT("cue"));
+            Settings.WrapPath = NormalizeAudioPath(McpHandlerUtils::GetOptionalString(Payload, TEXT("wrapPath"), TEXT("")));
+            Settings.WrapPrefix = McpHandlerUtils::GetOptionalString(Payload, TEXT("wrapPrefix"), TEXT(""));
+            Settings.bOverwrite = McpHandlerUtils::GetOptionalBool(Payload, TEXT("overwrite"), false);
+            Settings.MaxFiles = static_cast<int32>(McpHandlerUtils::GetOptionalInt(Payload, TEXT("maxFiles"), 0));
+            Settings.FrameBudgetMs = FMath::Clamp(McpHandlerUtils::GetOptionalFloat(Payload, TEXT("frameBudgetMs"), 50.0), 5.0, 1000.0);
+            Settings.bSave = McpHandlerUtils::GetOptionalBool(Payload, TEXT("save"), true);
+            // The client drops any request after 300 s, so stay under that
+            Settings.TimeoutSeconds = FMath::Clamp(McpHandlerUtils::GetOptionalFloat(Payload, TEXT("timeoutSeconds"), 240.0), 1.0, 240.0);
+            const TArray<TSharedPtr<FJsonValue>>* Extensions = nullptr;
+            if (Payload->TryGetArrayField(TEXT("extensions"), Extensions) && Extensions->Num() > 0)
+            {
+                Settings.Extensions.Reset();
+                for (const TSharedPtr<FJsonValue>& Extension : *Extensions)
+                {
+                    Settings.Extensions.Add(Extension->AsString());
+                }
+            }
+            if (Settings.SourceFolder.IsEmpty())
+            {
+                SendAutomationError(RequestingSocket, RequestId, TEXT("sourceFolder is required"), TEXT("MISSING_PARAMETER"));
+                return true;
+            }
+            bStarted = McpSoundFolderImport::Start(Settings, OnProgress, OnComplete, Error, ErrorCode);
+        }
+        else
+        {
+            McpSoundFolderImport::FBenchmarkSettings Settings;
+            Settings.WaveCount = static_cast<int32>(McpHandlerUtils::GetOptionalInt(Payload, TEXT("waveCount"), 300));
+            Settings.DurationSeconds = McpHandlerUtils::GetOptionalFloat(Payload, TEXT("durationSeconds"), 1.0);
+            Settings.Wrap = McpHandlerUtils::GetOptionalString(Payload, TEXT("wrap"), TEXT("cue"));
+            Settings.RootPath = NormalizeAudioPath(McpHandlerUtils::GetOptionalString(Payload, TEXT("path"), TEXT("/Game/McpSoundImportBenchmark")));
+            Settings.bCleanup = McpHandlerUtils::GetOptionalBool(Payload, TEXT("cleanup"), true);
+            Settings.TimeoutSeconds = FMath::Clamp(McpHandlerUtils::GetOptionalFloat(Payload, TEXT("timeoutSeconds"), 240.0), 10.0, 240.0);
+            bStarted = McpSoundFolderImport::StartBenchmark(Settings, OnProgress, OnComplete, Error, ErrorCode);
+        }
+        if (!bStarted)
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, ErrorCode);
+        }
+        return true;
+    }
+    
     TSharedPtr<FJsonObject> Response = HandleAudioAuthoringRequest(Payload);
     
     if (Response.IsValid())
@@ -5,7 +5,7 @@
 //
 // Implements node creation, connection, and graph inspection for Blueprint graphs.
 //
-// HANDLERS IMPLEMENTED (13 subActions):
+// HANDLERS IMPLEMENTED (14 subActions):
 // ================================
 //
 // NODE OPERATIONS:
@@ -28,6 +28,10 @@
 // PROPERTY:
 //   - set_node_property  : Set a property on a node (comment text, etc.)
 //
+// DECLARATIVE:
+//   - apply_graph        : Diff a node/pin/link spec against the graph and
+//                          apply it in one transaction with one compile
+//
 // SUPPORTED NODE TYPES (partial list):
 //   - K2Node_CallFunction, K2Node_VariableGet, K2Node_VariableSet
 //   - K2Node_IfThenElse, K2Node_ExecutionSequence, K2Node_Knot
@@ -53,6 +57,7 @@
 #include "McpAutomationBridgeHelpers.h"
 #include "McpHandlerUtils.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpBlueprintGraphSpec.h"
 #include "Misc/ScopeExit.h"
 
 #if WITH_EDITOR
@@ -362,87 +367,11 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction(
       }
     };
 
-    // Map common Blueprint node names to their CallFunction equivalents
+    // Common Blueprint node names map to their CallFunction equivalents
     // This allows users to use nodeType="PrintString" instead of CallFunction
-    static TMap<FString, TTuple<FString, FString>> CommonFunctionNodes = {
-        {TEXT("PrintString"),
-         MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("PrintString"))},
-        {TEXT("Print"),
-         MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("PrintString"))},
-        {TEXT("PrintText"),
-         MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("PrintText"))},
-        {TEXT("SetActorLocation"),
-         MakeTuple(TEXT("AActor"), TEXT("K2_SetActorLocation"))},
-        {TEXT("GetActorLocation"),
-         MakeTuple(TEXT("AActor"), TEXT("K2_GetActorLocation"))},
-        {TEXT("SetActorRotation"),
-         MakeTuple(TEXT("AActor"), TEXT("K2_SetActorRotation"))},
-        {TEXT("GetActorRotation"),
-         MakeTuple(TEXT("AActor"), TEXT("K2_GetActorRotation"))},
-        {TEXT("SetActorTransform"),
-         MakeTuple(TEXT("AActor"), TEXT("K2_SetActorTransform"))},
-        {TEXT("GetActorTransform"),
-         MakeTuple(TEXT("AActor"), TEXT("K2_GetActorTransform"))},
-        {TEXT("AddActorLocalOffset"),
-         MakeTuple(TEXT("AActor"), TEXT("K2_AddActorLocalOffset"))},
-        {TEXT("Delay"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("Delay"))},
-        {TEXT("DestroyActor"),
-         MakeTuple(TEXT("AActor"), TEXT("K2_DestroyActor"))},
-        {TEXT("SpawnActor"),
-         MakeTuple(TEXT("UGameplayStatics"),
-                   TEXT("BeginDeferredActorSpawnFromClass"))},
-        {TEXT("GetPlayerPawn"),
-         MakeTuple(TEXT("UGameplayStatics"), TEXT("GetPlayerPawn"))},
-        {TEXT("GetPlayerController"),
-         MakeTuple(TEXT("UGameplayStatics"), TEXT("GetPlayerController"))},
-        {TEXT("PlaySound"),
-         MakeTuple(TEXT("UGameplayStatics"), TEXT("PlaySound2D"))},
-        {TEXT("PlaySound2D"),
-         MakeTuple(TEXT("UGameplayStatics"), TEXT("PlaySound2D"))},
-        {TEXT("PlaySoundAtLocation"),
-         MakeTuple(TEXT("UGameplayStatics"), TEXT("PlaySoundAtLocation"))},
-        {TEXT("GetWorldDeltaSeconds"),
-         MakeTuple(TEXT("UGameplayStatics"), TEXT("GetWorldDeltaSeconds"))},
-        {TEXT("SetTimerByFunctionName"),
-         MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("K2_SetTimer"))},
-        {TEXT("ClearTimer"),
-         MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("K2_ClearTimer"))},
-        {TEXT("IsValid"),
-         MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("IsValid"))},
-        {TEXT("IsValidClass"),
-         MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("IsValidClass"))},
-        // Math Nodes
-        {TEXT("Add_IntInt"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Add_IntInt"))},
-        {TEXT("Subtract_IntInt"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Subtract_IntInt"))},
-        {TEXT("Multiply_IntInt"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Multiply_IntInt"))},
-        {TEXT("Divide_IntInt"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Divide_IntInt"))},
-        {TEXT("Add_DoubleDouble"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Add_DoubleDouble"))},
-        {TEXT("Subtract_DoubleDouble"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Subtract_DoubleDouble"))},
-        {TEXT("Multiply_DoubleDouble"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Multiply_DoubleDouble"))},
-        {TEXT("Divide_DoubleDouble"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Divide_DoubleDouble"))},
-        {TEXT("FTrunc"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("FTrunc"))},
-        // Vector Ops
-        {TEXT("MakeVector"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("MakeVector"))},
-        {TEXT("BreakVector"),
-         MakeTuple(TEXT("UKismetMathLibrary"), TEXT("BreakVector"))},
-        // Actor/Component Ops
-        {TEXT("GetComponentByClass"),
-         MakeTuple(TEXT("AActor"), TEXT("GetComponentByClass"))},
-        // Timer
-        {TEXT("GetWorldTimerManager"),
-         MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("K2_GetTimerManager"))}};
-
     // Check if this is a common function node shortcut
-    if (const auto *FuncInfo = CommonFunctionNodes.Find(NodeType)) {
+    if (const auto *FuncInfo =
+            McpBlueprintGraphSpec::FindFunctionShortcut(NodeType)) {
       FString ClassName = FuncInfo->Get<0>();
       FString FuncName = FuncInfo->Get<1>();
 
@@ -489,84 +418,8 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction(
     // DYNAMIC NODE CREATION - Find node classes at runtime
     // ========================================================================
 
-    // Map user-friendly node names to their K2Node class names
-    static TMap<FString, FString> NodeTypeAliases = {
-        // Flow Control
-        {TEXT("Branch"), TEXT("K2Node_IfThenElse")},
-        {TEXT("IfThenElse"), TEXT("K2Node_IfThenElse")},
-        {TEXT("Sequence"), TEXT("K2Node_ExecutionSequence")},
-        {TEXT("ExecutionSequence"), TEXT("K2Node_ExecutionSequence")},
-        {TEXT("Select"), TEXT("K2Node_Select")},
-        {TEXT("Switch"), TEXT("K2Node_SwitchInteger")},
-        {TEXT("SwitchOnInt"), TEXT("K2Node_SwitchInteger")},
-        {TEXT("SwitchOnEnum"), TEXT("K2Node_SwitchEnum")},
-        {TEXT("SwitchOnString"), TEXT("K2Node_SwitchString")},
-        {TEXT("SwitchOnName"), TEXT("K2Node_SwitchName")},
-        // Flow Control
-        {TEXT("DoOnce"), TEXT("K2Node_DoOnce")},
-        {TEXT("DoN"), TEXT("K2Node_DoN")},
-        {TEXT("FlipFlop"), TEXT("K2Node_FlipFlop")},
-        {TEXT("Gate"), TEXT("K2Node_Gate")},
-        {TEXT("MultiGate"), TEXT("K2Node_MultiGate")},
-        // Loops
-        {TEXT("ForLoop"), TEXT("K2Node_ForLoop")},
-        {TEXT("ForLoopWithBreak"), TEXT("K2Node_ForLoopWithBreak")},
-        {TEXT("ForEachLoop"), TEXT("K2Node_ForEachElementInEnum")},
-        {TEXT("WhileLoop"), TEXT("K2Node_WhileLoop")},
-        // Data
-        {TEXT("MakeArray"), TEXT("K2Node_MakeArray")},
-        {TEXT("MakeStruct"), TEXT("K2Node_MakeStruct")},
-        {TEXT("BreakStruct"), TEXT("K2Node_BreakStruct")},
-        {TEXT("MakeMap"), TEXT("K2Node_MakeMap")},
-        {TEXT("MakeSet"), TEXT("K2Node_MakeSet")},
-        // Actor/Component
-        {TEXT("SpawnActorFromClass"), TEXT("K2Node_SpawnActorFromClass")},
-        {TEXT("GetAllActorsOfClass"), TEXT("K2Node_GetAllActorsOfClass")},
-        // Misc
-        {TEXT("Self"), TEXT("K2Node_Self")},
-        {TEXT("GetSelf"), TEXT("K2Node_Self")},
-        {TEXT("Timeline"), TEXT("K2Node_Timeline")},
-        {TEXT("Knot"), TEXT("K2Node_Knot")},
-        {TEXT("Reroute"), TEXT("K2Node_Knot")},
-        {TEXT("Comment"), TEXT("EdGraphNode_Comment")},
-        // Literals
-        {TEXT("Literal"), TEXT("K2Node_Literal")},
-    };
-
-    // Helper: Try to find a UK2Node subclass by name
-    auto FindNodeClassByName = [](const FString &TypeName) -> UClass * {
-      // First check for aliases
-      FString ResolvedName = TypeName;
-      if (const FString *Alias = NodeTypeAliases.Find(TypeName)) {
-        ResolvedName = *Alias;
-      }
-
-      TArray<FString> NamesToTry;
-      NamesToTry.Add(ResolvedName);
-      NamesToTry.Add(FString::Printf(TEXT("K2Node_%s"), *ResolvedName));
-      NamesToTry.Add(FString::Printf(TEXT("UK2Node_%s"), *ResolvedName));
-      // Also try the original name if different
-      if (ResolvedName != TypeName) {
-        NamesToTry.Add(TypeName);
-        NamesToTry.Add(FString::Printf(TEXT("K2Node_%s"), *TypeName));
-        NamesToTry.Add(FString::Printf(TEXT("UK2Node_%s"), *TypeName));
-      }
-
-      for (TObjectIterator<UClass> It; It; ++It) {
-        if (!It->IsChildOf(UEdGraphNode::StaticClass()))
-          continue;
-        if (It->HasAnyClassFlags(CLASS_Abstract))
-          continue;
-
-        FString ClassName = It->GetName();
-        for (const FString &NameToMatch : NamesToTry) {
-          if (ClassName.Equals(NameToMatch, ESearchCase::IgnoreCase)) {
-            return *It;
-          }
-        }
-      }
-      return nullptr;
-    };
+    // User-friendly node names (Branch, Sequence, ...) resolve to K2Node
+    // classes through McpBlueprintGraphSpec::FindNodeClass
 
     // Special nodes requiring extra parameters
     if (NodeType == TEXT("VariableGet") ||
@@ -1071,7 +924,7 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction(
     }
 
     // ========== DYNAMIC FALLBACK: Create ANY node class by name ==========
-    UClass *NodeClass = FindNodeClassByName(NodeType);
+    UClass *NodeClass = McpBlueprintGraphSpec::FindNodeClass(NodeType);
     if (NodeClass) {
       UEdGraphNode *NewNode = NewObject<UEdGraphNode>(TargetGraph, NodeClass);
       if (NewNode) {
@@ -1712,6 +1565,57 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintGraphAction(
     SendAutomationResponse(RequestingSocket, RequestId, true,
                            TEXT("Pin default value set."), Result);
     return true;
+  } else if (SubAction == TEXT("apply_graph")) {
+    // Diff a declarative node/pin/link spec against the graph and apply it
+    // in one transaction with one compile (see McpBlueprintGraphSpec.h)
+    const TSharedPtr<FJsonObject> *SpecObj = nullptr;
+    if (!Payload->TryGetObjectField(TEXT("spec"), SpecObj) || !SpecObj ||
+        !(*SpecObj).IsValid()) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("'spec' object required (nodes, links)."),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+
+    TSharedPtr<FJsonObject> Spec = *SpecObj;
+    bool bPrune = false;
+    if (Payload->TryGetBoolField(TEXT("prune"), bPrune)) {
+      // Copy so the override does not leak into the caller's payload
+      Spec = MakeShared<FJsonObject>(**SpecObj);
+      Spec->SetBoolField(TEXT("prune"), bPrune);
+    }
+    bool bCompile = true;
+    Payload->TryGetBoolField(TEXT("compile"), bCompile);
+    bool bSave = true;
+    Payload->TryGetBoolField(TEXT("save"), bSave);
+
+    McpBlueprintGraphSpec::FApplyResult Apply;
+    FString Error, ErrorCode;
+    if (!McpBlueprintGraphSpec::Apply(Blueprint, TargetGraph, Spec, bCompile,
+                                      Apply, Error, ErrorCode)) {
+      SendAutomationError(RequestingSocket, RequestId, Error, ErrorCode);
+      return true;
+    }
+
+    if (bSave) {
+      SaveLoadedAssetThrottled(Blueprint);
+    }
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetStringField(TEXT("blueprintPath"), NormalizedPath);
+    Result->SetStringField(TEXT("graphName"), TargetGraph->GetName());
+    Result->SetObjectField(TEXT("apply"), Apply.ToJson());
+    Result->SetObjectField(TEXT("nodeIds"), Apply.NodeIds);
+    Result->SetBoolField(TEXT("saved"), bSave);
+    McpHandlerUtils::AddVerification(Result, Blueprint);
+    SendAutomationResponse(
+        RequestingSocket, RequestId, true,
+        FString::Printf(TEXT("Graph spec applied: %d created, %d updated, "
+                             "%d replaced, %d deleted, %d linked."),
+                        Apply.Created, Apply.Updated, Apply.Replaced,
+                        Apply.Deleted, Apply.Linked),
+        Result);
+    return true;
   }
 
   SendAutomationError(
@@ -11,6 +11,9 @@
 //   - blueprint_get_variables: List blueprint variables
 //   - blueprint_get_functions: List blueprint functions
 //   - blueprint_get_events: List blueprint events
+//   - blueprint_flush_compiles: Compile every Blueprint with a deferred compile
+//   - blueprint_get_compile_queue: Deferred compiles and compile telemetry
+//   - blueprint_benchmark_compiles: Per-edit vs batched compile timing
 //
 // REFACTORING NOTES:
 //   - Includes McpVersionCompatibility.h for UE 5.0-5.7 API abstraction
@@ -32,11 +35,13 @@
 #include "HAL/PlatformTime.h"
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
+#include "McpCompileScheduler.h"
 
 #if WITH_EDITOR
 #include "AssetToolsModule.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "UObject/UObjectIterator.h"
@@ -1567,6 +1572,48 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
     return FString();
   };
 
+  // Compile queue control (McpCompileScheduler). Matched exactly and ahead of
+  // the tolerant patterns below, which would route anything containing
+  // "compile" to blueprint_compile.
+  if (AlphaNumLower == TEXT("blueprintflushcompiles") ||
+      AlphaNumLower == TEXT("flushcompiles")) {
+    const McpCompileScheduler::FFlushResult Flush =
+        McpCompileScheduler::Flush(TEXT("explicit"));
+
+    TSharedPtr<FJsonObject> Result =
+        McpCompileScheduler::FlushResultToJson(Flush);
+    Result->SetNumberField(TEXT("pending"), McpCompileScheduler::NumPending());
+
+    const bool bOk = Flush.FailedBlueprints.Num() == 0;
+    SendAutomationResponse(
+        RequestingSocket, RequestId, bOk,
+        bOk ? FString::Printf(TEXT("Compiled %d queued blueprint(s)"),
+                              Flush.Compiled)
+            : FString::Printf(TEXT("%d blueprint(s) failed to compile"),
+                              Flush.FailedBlueprints.Num()),
+        Result, bOk ? FString() : TEXT("COMPILE_FAILED"));
+    return true;
+  }
+
+  if (AlphaNumLower == TEXT("blueprintgetcompilequeue") ||
+      AlphaNumLower == TEXT("getcompilequeue")) {
+    bool bIncludeBlueprints = true;
+    LocalPayload->TryGetBoolField(TEXT("includeBlueprints"),
+                                  bIncludeBlueprints);
+    SendAutomationResponse(
+        RequestingSocket, RequestId, true,
+        FString::Printf(TEXT("%d blueprint(s) waiting to compile"),
+                        McpCompileScheduler::NumPending()),
+        McpCompileScheduler::GetStatus(bIncludeBlueprints), FString());
+    return true;
+  }
+
+  if (AlphaNumLower == TEXT("blueprintbenchmarkcompiles") ||
+      AlphaNumLower == TEXT("benchmarkcompiles")) {
+    return HandleBenchmarkBlueprintCompiles(RequestId, Action, LocalPayload,
+                                            RequestingSocket);
+  }
+
   if (ActionMatchesPattern(TEXT("blueprint_modify_scs")) ||
       ActionMatchesPattern(TEXT("modify_scs")) ||
       ActionMatchesPattern(TEXT("modifyscs")) ||
@@ -5367,6 +5414,198 @@ bool UMcpAutomationBridgeSubsystem::HandleBlueprintAction(
 #endif // WITH_EDITOR
 }
 
+/**
+ * Times a scripted edit sequence on two fresh Actor Blueprints: one compiled
+ * after every edit (the per-op path), one edited under the compile scheduler
+ * and compiled once by a single flush.
+ *
+ * @param RequestId Unique request identifier.
+ * @param Action Action name ('blueprint_benchmark_compiles').
+ * @param Payload Optional 'edits' (1-300, default 30), 'path' and 'cleanup'.
+ * @param RequestingSocket WebSocket connection.
+ * @return True if handled.
+ */
+bool UMcpAutomationBridgeSubsystem::HandleBenchmarkBlueprintCompiles(
+    const FString &RequestId, const FString &Action,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
+#if WITH_EDITOR
+  int32 Edits = 30;
+  FString RootPath = TEXT("/Game/McpCompileBenchmark");
+  bool bCleanup = true;
+  if (Payload.IsValid()) {
+    double EditsValue = 0.0;
+    if (Payload->TryGetNumberField(TEXT("edits"), EditsValue)) {
+      Edits = static_cast<int32>(EditsValue);
+    }
+    Payload->TryGetStringField(TEXT("path"), RootPath);
+    Payload->TryGetBoolField(TEXT("cleanup"), bCleanup);
+  }
+
+  if (Edits < 1 || Edits > 300) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("edits must be between 1 and 300"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+  RootPath.RemoveFromEnd(TEXT("/"));
+  if (!RootPath.StartsWith(TEXT("/Game/"))) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("path must be a folder under /Game/"),
+                        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  const FString RunPath =
+      RootPath / FString::Printf(
+                     TEXT("Run_%s"),
+                     *FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(8));
+
+  auto CreateActorBlueprint = [&RunPath](const TCHAR *Name) -> UBlueprint * {
+    UPackage *Package = CreatePackage(*(RunPath / Name));
+    if (!Package) {
+      return nullptr;
+    }
+    return FKismetEditorUtilities::CreateBlueprint(
+        AActor::StaticClass(), Package, Name, BPTYPE_Normal,
+        UBlueprint::StaticClass(), UBlueprintGeneratedClass::StaticClass());
+  };
+
+  UBlueprint *PerOpBlueprint = CreateActorBlueprint(TEXT("BP_PerOp"));
+  UBlueprint *ScheduledBlueprint = CreateActorBlueprint(TEXT("BP_Scheduled"));
+  if (!PerOpBlueprint || !ScheduledBlueprint) {
+    if (bCleanup) {
+      McpSafeOperations::McpSafeDeleteFolder(RunPath);
+    }
+    SendAutomationError(RequestingSocket, RequestId,
+                        TEXT("Failed to create benchmark blueprints"),
+                        TEXT("CREATION_FAILED"));
+    return true;
+  }
+
+  // The same edit mix an authoring script produces: a member variable, a
+  // component, then metadata on the variable just added
+  auto ApplyEdit = [](UBlueprint *Blueprint, int32 Index) -> bool {
+    const int32 Group = Index / 3;
+    const FName VarName(*FString::Printf(TEXT("BenchVar_%03d"), Group));
+    switch (Index % 3) {
+    case 0: {
+      FEdGraphPinType PinType;
+      PinType.PinCategory = (Group % 2 == 0) ? MCP_PC_Boolean : MCP_PC_Int;
+      return FBlueprintEditorUtils::AddMemberVariable(Blueprint, VarName,
+                                                      PinType);
+    }
+    case 1: {
+      USimpleConstructionScript *SCS = Blueprint->SimpleConstructionScript;
+      if (!SCS) {
+        return false;
+      }
+      USCS_Node *Node = SCS->CreateNode(
+          USceneComponent::StaticClass(),
+          *FString::Printf(TEXT("BenchComponent_%03d"), Group));
+      if (!Node) {
+        return false;
+      }
+      SCS->AddNode(Node);
+      FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+      return true;
+    }
+    default:
+      FBlueprintEditorUtils::SetBlueprintVariableMetaData(
+          Blueprint, VarName, nullptr, TEXT("Tooltip"),
+          FString::Printf(TEXT("Benchmark variable %d"), Group));
+      return true;
+    }
+  };
+
+  // Start from an empty queue so the scheduled flush only holds this run
+  McpCompileScheduler::Flush(TEXT("benchmark"));
+
+  // Per-op: every edit request compiles before it returns
+  int32 PerOpEditFailures = 0;
+  int32 PerOpCompileFailures = 0;
+  double PerOpSeconds = 0.0;
+  {
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Edits; ++Index) {
+      if (!ApplyEdit(PerOpBlueprint, Index)) {
+        ++PerOpEditFailures;
+      }
+      if (!McpCompileScheduler::CompileNow(PerOpBlueprint)) {
+        ++PerOpCompileFailures;
+      }
+    }
+    PerOpSeconds = FPlatformTime::Seconds() - Start;
+  }
+
+  // Scheduled: each edit runs as its own structural request, then one flush
+  int32 ScheduledEditFailures = 0;
+  double ScheduledSeconds = 0.0;
+  McpCompileScheduler::FFlushResult ScheduledFlush;
+  {
+    const double Start = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Edits; ++Index) {
+      McpCompileScheduler::FScopedRequest EditScope(
+          McpCompileScheduler::ERequestKind::Structural);
+      if (!ApplyEdit(ScheduledBlueprint, Index)) {
+        ++ScheduledEditFailures;
+      }
+      McpSafeCompileBlueprint(ScheduledBlueprint);
+    }
+    ScheduledFlush = McpCompileScheduler::Flush(TEXT("benchmark"));
+    ScheduledSeconds = FPlatformTime::Seconds() - Start;
+  }
+
+  auto ModeToJson = [Edits](double Seconds, int32 Compiles,
+                            int32 EditFailures, int32 CompileFailures) {
+    TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+    Json->SetNumberField(TEXT("totalMs"), Seconds * 1000.0);
+    Json->SetNumberField(TEXT("perEditMs"), Seconds * 1000.0 / Edits);
+    Json->SetNumberField(TEXT("compiles"), Compiles);
+    Json->SetNumberField(TEXT("editFailures"), EditFailures);
+    Json->SetNumberField(TEXT("compileFailures"), CompileFailures);
+    return Json;
+  };
+
+  TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+  Result->SetNumberField(TEXT("edits"), Edits);
+  Result->SetStringField(TEXT("path"), RunPath);
+  Result->SetObjectField(TEXT("perOp"),
+                         ModeToJson(PerOpSeconds, Edits, PerOpEditFailures,
+                                    PerOpCompileFailures));
+  TSharedPtr<FJsonObject> Scheduled =
+      ModeToJson(ScheduledSeconds, ScheduledFlush.Compiled,
+                 ScheduledEditFailures, ScheduledFlush.FailedBlueprints.Num());
+  Scheduled->SetObjectField(
+      TEXT("flush"), McpCompileScheduler::FlushResultToJson(ScheduledFlush));
+  Result->SetObjectField(TEXT("scheduled"), Scheduled);
+  Result->SetNumberField(TEXT("compilesAvoided"),
+                         Edits - ScheduledFlush.Compiled);
+  Result->SetNumberField(TEXT("speedup"), ScheduledSeconds > 0.0
+                                              ? PerOpSeconds / ScheduledSeconds
+                                              : 0.0);
+
+  if (bCleanup) {
+    Result->SetBoolField(TEXT("cleanedUp"),
+                         McpSafeOperations::McpSafeDeleteFolder(RunPath));
+  }
+
+  SendAutomationResponse(
+      RequestingSocket, RequestId, true,
+      FString::Printf(
+          TEXT("%d edits: per-op %.0f ms (%d compiles), scheduled %.0f ms "
+               "(%d compiles)"),
+          Edits, PerOpSeconds * 1000.0, Edits, ScheduledSeconds * 1000.0,
+          ScheduledFlush.Compiled),
+      Result, FString());
+  return true;
+#else
+  SendAutomationError(RequestingSocket, RequestId, TEXT("Editor only."),
+                      TEXT("EDITOR_ONLY"));
+  return true;
+#endif
+}
+
 bool UMcpAutomationBridgeSubsystem::HandleSCSAction(
     const FString &RequestId, const FString &Action,
     const TSharedPtr<FJsonObject> &Payload,
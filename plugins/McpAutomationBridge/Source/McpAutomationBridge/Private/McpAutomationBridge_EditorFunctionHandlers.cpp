@@ -35,7 +35,7 @@
 //   - ADD_WIDGET_TO_VIEWPORT   : Add UMG widget to viewport
 //
 // System:
-//   - GENERATE_MEMORY_REPORT   : Generate memory profiling report
+//   - GENERATE_MEMORY_REPORT   : Capture a structured memory snapshot
 //   - CALL_SUBSYSTEM           : Call subsystem function via reflection
 //   - CONFIGURE_TEXTURE_STREAMING: Configure texture streaming CVars
 //   - BLUEPRINT_ADD_COMPONENT  : Add component to Blueprint SCS
@@ -1350,33 +1350,9 @@ bool UMcpAutomationBridgeSubsystem::HandleExecuteEditorFunction(
   // =========================================================================
 
   if (FN == TEXT("GENERATE_MEMORY_REPORT")) {
-    FString OutputPath;
-    Payload->TryGetStringField(TEXT("outputPath"), OutputPath);
-    bool bDetailed = false;
-    Payload->TryGetBoolField(TEXT("detailed"), bDetailed);
-
-    if (!GEditor) {
-      SendAutomationResponse(RequestingSocket, RequestId, false,
-                             TEXT("Editor not available"), nullptr,
-                             TEXT("EDITOR_NOT_AVAILABLE"));
-      return true;
-    }
-
-    FString MemReportCmd =
-        bDetailed ? TEXT("memreport -full") : TEXT("memreport");
-    GEditor->Exec(nullptr, *MemReportCmd);
-
-    TSharedPtr<FJsonObject> Out = McpHandlerUtils::CreateResultObject();
-    Out->SetBoolField(TEXT("success"), true);
-    // Note: OutputPath is not fully supported by the native memreport command
-    // (it auto-generates filenames), but we acknowledge the request.
-    Out->SetStringField(
-        TEXT("message"),
-        TEXT("Memory report generated (check Saved/Profiling/MemReports)"));
-
-    SendAutomationResponse(RequestingSocket, RequestId, true,
-                           TEXT("Memory report generated"), Out, FString());
-    return true;
+    // Same structured snapshot as manage_performance generate_memory_report.
+    return HandlePerformanceAction(RequestId, TEXT("generate_memory_report"),
+                                   Payload, RequestingSocket);
   }
 
   // CALL_SUBSYSTEM: generic reflection-based subsystem call
@@ -16,9 +16,18 @@
 //
 //   Mesh Editing:
 //     - mesh_add_vertices, mesh_add_triangles
+//     - set_mesh_buffers, get_mesh_buffers (packed base64/JSON arrays, one update)
 //     - mesh_set_normals, mesh_set_uvs
 //     - mesh_remesh, mesh_smooth
 //
+//   Pipelines:
+//     - apply_geometry_pipeline (ordered ops on a worker-thread copy, one commit)
+//
+//   Background Jobs:
+//     - boolean, simplify, remesh_voxel, generate_complex_collision,
+//       generate_lods and pipelines run as queued jobs off the game thread
+//     - cancel_geometry_job, list_geometry_jobs
+//
 //   Asset Generation:
 //     - create_static_mesh_from_dynamic
 //     - generate_collision, simplify_collision
@@ -54,6 +63,12 @@ DEFINE_LOG_CATEGORY_STATIC(LogMcpGeometryHandlers, Log, All);
 #include "DynamicMeshActor.h"
 #include "DynamicMesh/DynamicMesh3.h"
 #include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "DynamicMesh/MeshNormals.h"
+#include "DynamicMeshEditor.h"
+#include "Misc/Base64.h"
+#include "Hash/CityHash.h"
+#include "Async/Async.h"
+#include "Serialization/JsonSerializer.h"
 #include "Engine/StaticMesh.h"
 #include "Engine/StaticMeshActor.h"
 #include "EngineUtils.h"
@@ -252,6 +267,51 @@ static AActor* SpawnDynamicMeshActorWithMesh(
     return NewActor;
 }
 
+// Helper to resolve the DynamicMeshComponent of a DynamicMeshActor by label.
+// Sends the error response itself and returns false when resolution fails.
+static bool ResolveDynamicMeshComponent(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    TSharedPtr<FMcpBridgeWebSocket> Socket,
+    const FString& ActorName,
+    UDynamicMeshComponent*& OutComponent)
+{
+    OutComponent = nullptr;
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("No world available"), TEXT("NO_WORLD"));
+        return false;
+    }
+
+    ADynamicMeshActor* TargetActor = nullptr;
+    for (TActorIterator<ADynamicMeshActor> It(World); It; ++It)
+    {
+        if (It->GetActorLabel() == ActorName)
+        {
+            TargetActor = *It;
+            break;
+        }
+    }
+
+    if (!TargetActor)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
+        return false;
+    }
+
+    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
+    if (!DMC || !DMC->GetDynamicMesh())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
+        return false;
+    }
+
+    OutComponent = DMC;
+    return true;
+}
+
 // Safety limits for geometry operations to prevent OOM
 static constexpr int32 MAX_SEGMENTS = 256;
 static constexpr double MAX_DIMENSION = 100000.0;
@@ -302,6 +362,199 @@ static double ClampDimension(double Value, double Default = 100.0)
     return FMath::Clamp(Value, MIN_DIMENSION, MAX_DIMENSION);
 }
 
+// -------------------------------------------------------------------------
+// Background geometry jobs
+// -------------------------------------------------------------------------
+// Heavy ops copy the target mesh into a rooted transient UDynamicMesh on the
+// game thread, run on the thread pool and commit back on the game thread, so
+// the editor keeps ticking and other automation requests keep flowing. At most
+// MAX_CONCURRENT_GEOMETRY_JOBS run at once; further jobs wait in a FIFO queue.
+// Jobs are keyed by request ID and can be cancelled via cancel_geometry_job.
+// Geometry Script calls are not interruptible, so cancellation is checked
+// between stages and always before commit (a cancelled result is discarded).
+// A job commits over whatever the component holds at that point; edits made
+// to the same mesh while the job runs are overwritten.
+
+static constexpr int32 MAX_CONCURRENT_GEOMETRY_JOBS = 2;
+
+struct FMcpGeometryJob
+{
+    FString RequestId;
+    FString Label;
+    TSharedPtr<FMcpBridgeWebSocket> Socket;
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> Subsystem;
+    ERequestOrigin Origin = ERequestOrigin::WebSocket;
+    FThreadSafeBool bCancelled;
+    bool bCancellable = true;
+    bool bRunning = false;
+    double QueuedTime = 0.0;
+    double StartTime = 0.0;
+    double GameThreadSeconds = 0.0;  // time spent blocking the game thread
+    TArray<UDynamicMesh*> RootedMeshes;
+
+    // Invoked on the game thread when a slot is free. Must eventually call
+    // FinishGeometryJob on the game thread.
+    TFunction<void(const TSharedRef<FMcpGeometryJob, ESPMode::ThreadSafe>&)> Run;
+
+    // Game thread: transient mesh kept alive until the job finishes
+    UDynamicMesh* CreateRootedMesh()
+    {
+        UDynamicMesh* Mesh = NewObject<UDynamicMesh>(GetTransientPackage());
+        Mesh->AddToRoot();
+        RootedMeshes.Add(Mesh);
+        return Mesh;
+    }
+
+    // Any thread: forwards to SendProgressUpdate on the game thread
+    void ReportProgress(float Percent, const FString& Message) const
+    {
+        AsyncTask(ENamedThreads::GameThread, [WeakSubsystem = Subsystem, Id = RequestId, Origin = Origin, Percent, Message]()
+        {
+            if (UMcpAutomationBridgeSubsystem* Bridge = WeakSubsystem.Get())
+            {
+                Bridge->SendProgressUpdate(Id, Percent, Message, true, Origin);
+            }
+        });
+    }
+};
+
+using FMcpGeometryJobRef = TSharedRef<FMcpGeometryJob, ESPMode::ThreadSafe>;
+
+// Game-thread only
+static TMap<FString, FMcpGeometryJobRef> GGeometryJobs;
+static TArray<FMcpGeometryJobRef> GGeometryJobQueue;
+static int32 GRunningGeometryJobs = 0;
+
+static void StartQueuedGeometryJobs()
+{
+    while (GRunningGeometryJobs < MAX_CONCURRENT_GEOMETRY_JOBS && GGeometryJobQueue.Num() > 0)
+    {
+        FMcpGeometryJobRef Job = GGeometryJobQueue[0];
+        GGeometryJobQueue.RemoveAt(0);
+        ++GRunningGeometryJobs;
+        Job->bRunning = true;
+        Job->StartTime = FPlatformTime::Seconds();
+        // Keep the callable alive on the stack in case it finishes the job synchronously
+        TFunction<void(const FMcpGeometryJobRef&)> Run = MoveTemp(Job->Run);
+        Run(Job);
+    }
+}
+
+static void FinishGeometryJob(const FMcpGeometryJobRef& Job, bool bSuccess, const FString& Message,
+                              TSharedPtr<FJsonObject> Result, const FString& ErrorCode = FString())
+{
+    const double Now = FPlatformTime::Seconds();
+    if (Result.IsValid())
+    {
+        Result->SetStringField(TEXT("jobId"), Job->RequestId);
+        Result->SetNumberField(TEXT("queueMs"), ((Job->bRunning ? Job->StartTime : Now) - Job->QueuedTime) * 1000.0);
+        Result->SetNumberField(TEXT("gameThreadMs"), Job->GameThreadSeconds * 1000.0);
+        Result->SetNumberField(TEXT("totalMs"), (Now - Job->QueuedTime) * 1000.0);
+    }
+
+    if (UMcpAutomationBridgeSubsystem* Bridge = Job->Subsystem.Get())
+    {
+        Bridge->SendAutomationResponse(Job->Socket, Job->RequestId, bSuccess, Message, Result, ErrorCode, Job->Origin);
+    }
+
+    for (UDynamicMesh* Rooted : Job->RootedMeshes)
+    {
+        Rooted->RemoveFromRoot();
+    }
+    Job->RootedMeshes.Reset();
+
+    GGeometryJobs.Remove(Job->RequestId);
+    GGeometryJobQueue.Remove(Job);
+    if (Job->bRunning)
+    {
+        Job->bRunning = false;
+        --GRunningGeometryJobs;
+    }
+    StartQueuedGeometryJobs();
+}
+
+// Registers the job and starts it immediately if a slot is free
+static void EnqueueGeometryJob(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                               TSharedPtr<FMcpBridgeWebSocket> Socket, const FMcpGeometryJobRef& Job)
+{
+    Job->RequestId = RequestId;
+    Job->Socket = Socket;
+    Job->Subsystem = Self;
+    Job->Origin = Self->CurrentRequestOrigin;
+    Job->QueuedTime = FPlatformTime::Seconds();
+
+    GGeometryJobs.Add(RequestId, Job);
+    GGeometryJobQueue.Add(Job);
+    if (GRunningGeometryJobs >= MAX_CONCURRENT_GEOMETRY_JOBS)
+    {
+        Job->ReportProgress(0.0f, FString::Printf(TEXT("%s queued (%d ahead)"), *Job->Label, GGeometryJobQueue.Num() - 1));
+    }
+    StartQueuedGeometryJobs();
+}
+
+using FMcpGeometryJobWork = TFunction<bool(FMcpGeometryJob& Job, FString& OutError)>;
+using FMcpGeometryJobCommit = TFunction<FString(FMcpGeometryJob& Job, UDynamicMeshComponent* Component, const TSharedPtr<FJsonObject>& Result)>;
+
+// Moves the job's work mesh into the component with a single render/collision update
+static void CommitGeometryJobMesh(UDynamicMeshComponent* Component, UDynamicMesh* WorkMesh)
+{
+    Component->GetDynamicMesh()->GetMeshRef() = MoveTemp(WorkMesh->GetMeshRef());
+    Component->NotifyMeshUpdated();
+}
+
+// Standard shape: Work runs on the thread pool against meshes the job owns,
+// Commit runs on the game thread with the (still valid) target component.
+static void RunGeometryJobOnWorker(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                   TSharedPtr<FMcpBridgeWebSocket> Socket, const FMcpGeometryJobRef& Job,
+                                   UDynamicMeshComponent* Component, FMcpGeometryJobWork Work, FMcpGeometryJobCommit Commit)
+{
+    TWeakObjectPtr<UDynamicMeshComponent> WeakComponent(Component);
+    Job->Run = [WeakComponent, Work = MoveTemp(Work), Commit = MoveTemp(Commit)](const FMcpGeometryJobRef& RunningJob)
+    {
+        if (RunningJob->bCancelled)
+        {
+            FinishGeometryJob(RunningJob, false, FString::Printf(TEXT("%s cancelled"), *RunningJob->Label), nullptr, TEXT("CANCELLED"));
+            return;
+        }
+
+        Async(EAsyncExecution::ThreadPool, [RunningJob, WeakComponent, Work, Commit]()
+        {
+            FString Error;
+            const bool bWorked = Work(*RunningJob, Error);
+            const double WorkerSeconds = FPlatformTime::Seconds() - RunningJob->StartTime;
+
+            AsyncTask(ENamedThreads::GameThread, [RunningJob, WeakComponent, Commit, bWorked, Error, WorkerSeconds]()
+            {
+                UDynamicMeshComponent* Target = WeakComponent.Get();
+                if (RunningJob->bCancelled)
+                {
+                    FinishGeometryJob(RunningJob, false, FString::Printf(TEXT("%s cancelled"), *RunningJob->Label), nullptr, TEXT("CANCELLED"));
+                }
+                else if (!bWorked)
+                {
+                    FinishGeometryJob(RunningJob, false, Error, nullptr, TEXT("OPERATION_FAILED"));
+                }
+                else if (!Target)
+                {
+                    FinishGeometryJob(RunningJob, false, TEXT("Target mesh was removed while the job ran"), nullptr, TEXT("ACTOR_NOT_FOUND"));
+                }
+                else
+                {
+                    const double CommitStart = FPlatformTime::Seconds();
+                    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+                    const FString Message = Commit(*RunningJob, Target, Result);
+                    const double CommitSeconds = FPlatformTime::Seconds() - CommitStart;
+                    RunningJob->GameThreadSeconds += CommitSeconds;
+                    Result->SetNumberField(TEXT("workerMs"), WorkerSeconds * 1000.0);
+                    Result->SetNumberField(TEXT("commitMs"), CommitSeconds * 1000.0);
+                    FinishGeometryJob(RunningJob, true, Message, Result);
+                }
+            });
+        });
+    };
+    EnqueueGeometryJob(Self, RequestId, Socket, Job);
+}
+
 // -------------------------------------------------------------------------
 // Primitives
 // -------------------------------------------------------------------------
@@ -890,74 +1143,86 @@ static bool HandleBooleanOperation(UMcpAutomationBridgeSubsystem* Self, const FS
         return true;
     }
 
-    FGeometryScriptMeshBooleanOptions BoolOptions;
-    BoolOptions.bFillHoles = true;
-    BoolOptions.bSimplifyOutput = false;
-
-    // UE 5.7: ApplyMeshBoolean returns UDynamicMesh* directly, no Outcome parameter
-    UDynamicMesh* ResultMesh = UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshBoolean(
-        TargetMesh,
-        TargetActor->GetActorTransform(),
-        ToolMesh,
-        ToolActor->GetActorTransform(),
-        BoolOp,
-        BoolOptions,
-        nullptr
-    );
+    // Snapshot both meshes; the boolean itself runs as a background job
+    const double SetupStart = FPlatformTime::Seconds();
+    FMcpGeometryJobRef Job = MakeShared<FMcpGeometryJob, ESPMode::ThreadSafe>();
+    Job->Label = FString::Printf(TEXT("Boolean %s"), *OpName);
+    UDynamicMesh* WorkMesh = Job->CreateRootedMesh();
+    WorkMesh->SetMesh(TargetMesh->GetMeshRef());
+    UDynamicMesh* ToolCopy = Job->CreateRootedMesh();
+    ToolCopy->SetMesh(ToolMesh->GetMeshRef());
+    const FTransform TargetTransform = TargetActor->GetActorTransform();
+    const FTransform ToolTransform = ToolActor->GetActorTransform();
+    TWeakObjectPtr<ADynamicMeshActor> WeakToolActor(ToolActor);
+
+    auto Work = [WorkMesh, ToolCopy, TargetTransform, ToolTransform, BoolOp, OpName](FMcpGeometryJob& RunningJob, FString& OutError) -> bool
+    {
+        RunningJob.ReportProgress(10.0f, FString::Printf(TEXT("Boolean %s running"), *OpName));
+
+        FGeometryScriptMeshBooleanOptions BoolOptions;
+        BoolOptions.bFillHoles = true;
+        BoolOptions.bSimplifyOutput = false;
+
+        // UE 5.7: ApplyMeshBoolean returns UDynamicMesh* directly, no Outcome parameter
+        UDynamicMesh* ResultMesh = UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshBoolean(
+            WorkMesh,
+            TargetTransform,
+            ToolCopy,
+            ToolTransform,
+            BoolOp,
+            BoolOptions,
+            nullptr
+        );
 
-    bool bBooleanSucceeded = (ResultMesh != nullptr);
+        if (!ResultMesh)
+        {
+            // Boolean operation returned null - this typically means the operation failed
+            // (e.g., empty result from intersection, non-overlapping meshes)
+            UE_LOG(LogMcpGeometryHandlers, Warning,
+                   TEXT("Boolean %s returned null result - operation may have produced empty geometry"), *OpName);
+            OutError = FString::Printf(TEXT("Boolean %s failed - operation produced empty geometry"), *OpName);
+            return false;
+        }
 
-    // Safety: Check result polygon count
-    int32 ResultTriCount = 0;
-    if (ResultMesh)
-    {
-        ResultTriCount = ResultMesh->GetTriangleCount();
-        
-        // Check if result exceeds limit
+        const int32 ResultTriCount = ResultMesh->GetTriangleCount();
         if (ResultTriCount > MAX_TRIANGLES_PER_DYNAMIC_MESH)
         {
             // Log warning but don't fail - the operation already completed
-            UE_LOG(LogMcpGeometryHandlers, Warning, 
-                   TEXT("Boolean %s result has %d triangles (exceeds limit of %d)"), 
+            UE_LOG(LogMcpGeometryHandlers, Warning,
+                   TEXT("Boolean %s result has %d triangles (exceeds limit of %d)"),
                    *OpName, ResultTriCount, MAX_TRIANGLES_PER_DYNAMIC_MESH);
         }
-        
-        // Warning if approaching limit
-        if (ResultTriCount > WARNING_TRIANGLE_THRESHOLD)
+        else if (ResultTriCount > WARNING_TRIANGLE_THRESHOLD)
         {
-            UE_LOG(LogMcpGeometryHandlers, Warning, 
-                   TEXT("Boolean %s result has %d triangles (warning threshold: %d)"), 
+            UE_LOG(LogMcpGeometryHandlers, Warning,
+                   TEXT("Boolean %s result has %d triangles (warning threshold: %d)"),
                    *OpName, ResultTriCount, WARNING_TRIANGLE_THRESHOLD);
         }
-    }
-    else
-    {
-        // Boolean operation returned null - this typically means the operation failed
-        // (e.g., empty result from intersection, non-overlapping meshes)
-        UE_LOG(LogMcpGeometryHandlers, Warning, 
-               TEXT("Boolean %s returned null result - operation may have produced empty geometry"), *OpName);
-    }
+        return true;
+    };
 
-    // Optionally delete tool actor
-    if (!bKeepTool)
+    auto Commit = [WorkMesh, WeakToolActor, bKeepTool, TargetActorName, OpName, TargetTriCount, ToolTriCount](
+        FMcpGeometryJob& RunningJob, UDynamicMeshComponent* Component, const TSharedPtr<FJsonObject>& Result) -> FString
     {
-        ToolActor->Destroy();
-    }
+        CommitGeometryJobMesh(Component, WorkMesh);
 
-    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetStringField(TEXT("targetActor"), TargetActorName);
-    Result->SetStringField(TEXT("operation"), OpName);
-    Result->SetBoolField(TEXT("success"), bBooleanSucceeded);
-    Result->SetNumberField(TEXT("targetTriangles"), TargetTriCount);
-    Result->SetNumberField(TEXT("toolTriangles"), ToolTriCount);
-    if (bBooleanSucceeded)
-    {
-        Result->SetNumberField(TEXT("resultTriangles"), ResultTriCount);
-    }
+        // Optionally delete tool actor
+        if (!bKeepTool && WeakToolActor.IsValid())
+        {
+            WeakToolActor->Destroy();
+        }
 
-    Self->SendAutomationResponse(Socket, RequestId, bBooleanSucceeded, 
-        bBooleanSucceeded ? FString::Printf(TEXT("Boolean %s completed"), *OpName) : FString::Printf(TEXT("Boolean %s failed - operation produced empty geometry"), *OpName), 
-        Result);
+        Result->SetStringField(TEXT("targetActor"), TargetActorName);
+        Result->SetStringField(TEXT("operation"), OpName);
+        Result->SetBoolField(TEXT("success"), true);
+        Result->SetNumberField(TEXT("targetTriangles"), TargetTriCount);
+        Result->SetNumberField(TEXT("toolTriangles"), ToolTriCount);
+        Result->SetNumberField(TEXT("resultTriangles"), Component->GetDynamicMesh()->GetTriangleCount());
+        return FString::Printf(TEXT("Boolean %s completed"), *OpName);
+    };
+
+    Job->GameThreadSeconds = FPlatformTime::Seconds() - SetupStart;
+    RunGeometryJobOnWorker(Self, RequestId, Socket, Job, TargetDMC, MoveTemp(Work), MoveTemp(Commit));
     return true;
 }
 
@@ -1208,38 +1473,52 @@ static bool HandleSimplifyMesh(UMcpAutomationBridgeSubsystem* Self, const FStrin
         return true;
     }
 
-    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
-
-    // UE 5.7: Use FGeometryScriptSimplifyMeshOptions (renamed from FGeometryScriptMeshSimplifyOptions)
-    FGeometryScriptSimplifyMeshOptions SimplifyOptions;
-    SimplifyOptions.Method = EGeometryScriptRemoveMeshSimplificationType::StandardQEM;
-    // Note: bPreserveSharpEdges was removed in UE 5.7
-    SimplifyOptions.bAllowSeamCollapse = true;
+    const double SetupStart = FPlatformTime::Seconds();
+    FMcpGeometryJobRef Job = MakeShared<FMcpGeometryJob, ESPMode::ThreadSafe>();
+    Job->Label = TEXT("Simplify");
+    UDynamicMesh* WorkMesh = Job->CreateRootedMesh();
+    WorkMesh->SetMesh(DMC->GetDynamicMesh()->GetMeshRef());
 
     // UE 5.7: FGeometryScriptMeshInfo and GetMeshInfo() were removed
     // Use individual query functions instead
-    int32 TriCountBefore = Mesh->GetTriangleCount();
+    int32 TriCountBefore = WorkMesh->GetTriangleCount();
 
     int32 TargetTriCount = FMath::Max(1, FMath::RoundToInt(TriCountBefore * (TargetPercentage / 100.0)));
 
-    UGeometryScriptLibrary_MeshSimplifyFunctions::ApplySimplifyToTriangleCount(
-        Mesh,
-        TargetTriCount,
-        SimplifyOptions,
-        nullptr
-    );
+    auto Work = [WorkMesh, TargetTriCount](FMcpGeometryJob& RunningJob, FString& OutError) -> bool
+    {
+        RunningJob.ReportProgress(10.0f, FString::Printf(TEXT("Simplifying to %d triangles"), TargetTriCount));
 
-    int32 TriCountAfter = Mesh->GetTriangleCount();
+        // UE 5.7: Use FGeometryScriptSimplifyMeshOptions (renamed from FGeometryScriptMeshSimplifyOptions)
+        FGeometryScriptSimplifyMeshOptions SimplifyOptions;
+        SimplifyOptions.Method = EGeometryScriptRemoveMeshSimplificationType::StandardQEM;
+        // Note: bPreserveSharpEdges was removed in UE 5.7
+        SimplifyOptions.bAllowSeamCollapse = true;
 
-    DMC->NotifyMeshUpdated();
+        UGeometryScriptLibrary_MeshSimplifyFunctions::ApplySimplifyToTriangleCount(
+            WorkMesh,
+            TargetTriCount,
+            SimplifyOptions,
+            nullptr
+        );
+        return true;
+    };
 
-    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetStringField(TEXT("actorName"), ActorName);
-    Result->SetNumberField(TEXT("originalTriangles"), TriCountBefore);
-    Result->SetNumberField(TEXT("simplifiedTriangles"), TriCountAfter);
-    Result->SetNumberField(TEXT("reductionPercent"), (1.0 - ((double)TriCountAfter / (double)TriCountBefore)) * 100.0);
+    auto Commit = [WorkMesh, ActorName, TriCountBefore](
+        FMcpGeometryJob& RunningJob, UDynamicMeshComponent* Component, const TSharedPtr<FJsonObject>& Result) -> FString
+    {
+        const int32 TriCountAfter = WorkMesh->GetTriangleCount();
+        CommitGeometryJobMesh(Component, WorkMesh);
+
+        Result->SetStringField(TEXT("actorName"), ActorName);
+        Result->SetNumberField(TEXT("originalTriangles"), TriCountBefore);
+        Result->SetNumberField(TEXT("simplifiedTriangles"), TriCountAfter);
+        Result->SetNumberField(TEXT("reductionPercent"), (1.0 - ((double)TriCountAfter / (double)FMath::Max(TriCountBefore, 1))) * 100.0);
+        return TEXT("Mesh simplified");
+    };
 
-    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Mesh simplified"), Result);
+    Job->GameThreadSeconds = FPlatformTime::Seconds() - SetupStart;
+    RunGeometryJobOnWorker(Self, RequestId, Socket, Job, DMC, MoveTemp(Work), MoveTemp(Commit));
     return true;
 }
 
@@ -5871,76 +6150,128 @@ static bool HandleSetVertexPosition(UMcpAutomationBridgeSubsystem* Self, const F
 }
 
 // -------------------------------------------------------------------------
-// translate_mesh - Translate entire mesh
+// set_mesh_buffers / get_mesh_buffers - Bulk buffer transfer
 // -------------------------------------------------------------------------
-
-static bool HandleTranslateMesh(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
-                                const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+// Packed arrays are either base64 strings of little-endian float32/uint32
+// data or plain JSON number arrays. Vertex attributes are per-vertex:
+// positions/normals (3 floats), uvs (2 floats), colors (4 floats RGBA),
+// indices (3 uint32 per triangle).
+
+// JSON numbers arrive as doubles and converting one T cannot represent is
+// undefined, so each value is checked before the cast: floats must be finite
+// and in float range, indices whole and below IndexLimit.
+template <typename T>
+static bool IsValidGeometryBufferValue(double Value, double IndexLimit)
 {
-    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
-    FVector Translation = ReadVectorFromPayload(Payload, TEXT("translation"), FVector::ZeroVector);
-    
-    if (ActorName.IsEmpty())
+    if (!FMath::IsFinite(Value))
     {
-        Self->SendAutomationError(Socket, RequestId, TEXT("actorName required"), TEXT("INVALID_ARGUMENT"));
-        return true;
+        return false;
+    }
+    if constexpr (std::is_integral_v<T>)
+    {
+        return Value >= 0.0 && Value < IndexLimit && FMath::FloorToDouble(Value) == Value;
+    }
+    else
+    {
+        return FMath::Abs(Value) <= static_cast<double>(TNumericLimits<T>::Max());
     }
+}
 
-    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-    ADynamicMeshActor* TargetActor = nullptr;
+template <typename T>
+static bool ReadPackedGeometryBuffer(const TSharedPtr<FJsonObject>& Payload, const TCHAR* FieldName,
+                                     TArray<T>& OutValues, FString& OutError,
+                                     double IndexLimit = static_cast<double>(TNumericLimits<uint32>::Max()) + 1.0)
+{
+    OutValues.Reset();
 
-    for (TActorIterator<ADynamicMeshActor> It(World); It; ++It)
+    FString Encoded;
+    if (Payload->TryGetStringField(FieldName, Encoded))
     {
-        if (It->GetActorLabel() == ActorName)
+        TArray<uint8> Bytes;
+        if (!FBase64::Decode(Encoded, Bytes))
         {
-            TargetActor = *It;
-            break;
+            OutError = FString::Printf(TEXT("'%s' is not valid base64"), FieldName);
+            return false;
         }
+        if (Bytes.Num() % sizeof(T) != 0)
+        {
+            OutError = FString::Printf(TEXT("'%s' byte length %d is not a multiple of %d"),
+                                       FieldName, Bytes.Num(), static_cast<int32>(sizeof(T)));
+            return false;
+        }
+        OutValues.SetNumUninitialized(Bytes.Num() / sizeof(T));
+        FMemory::Memcpy(OutValues.GetData(), Bytes.GetData(), Bytes.Num());
+        if constexpr (!std::is_integral_v<T>)
+        {
+            // Raw float32 bits can be NaN or infinity; indices are range-checked by the caller
+            for (int32 I = 0; I < OutValues.Num(); ++I)
+            {
+                if (!FMath::IsFinite(OutValues[I]))
+                {
+                    OutError = FString::Printf(TEXT("'%s'[%d] = %g is not a finite float32"), FieldName, I,
+                                               static_cast<double>(OutValues[I]));
+                    OutValues.Reset();
+                    return false;
+                }
+            }
+        }
+        return true;
     }
 
-    if (!TargetActor)
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (Payload->TryGetArrayField(FieldName, Values) && Values)
     {
-        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
-        return true;
+        OutValues.Reserve(Values->Num());
+        for (int32 I = 0; I < Values->Num(); ++I)
+        {
+            const TSharedPtr<FJsonValue>& Value = (*Values)[I];
+            if (!Value.IsValid() || Value->Type != EJson::Number)
+            {
+                OutError = FString::Printf(TEXT("'%s'[%d] is not a number"), FieldName, I);
+                return false;
+            }
+            const double Number = Value->AsNumber();
+            if (!IsValidGeometryBufferValue<T>(Number, IndexLimit))
+            {
+                OutError = std::is_integral_v<T>
+                    ? FString::Printf(TEXT("'%s'[%d] = %g is not a valid index (0..%.0f)"), FieldName, I, Number, IndexLimit - 1.0)
+                    : FString::Printf(TEXT("'%s'[%d] = %g is not a finite float32"), FieldName, I, Number);
+                return false;
+            }
+            OutValues.Add(static_cast<T>(Number));
+        }
     }
+    return true;
+}
 
-    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
-    if (!DMC || !DMC->GetDynamicMesh())
+template <typename T>
+static void WritePackedGeometryBuffer(const TSharedPtr<FJsonObject>& Result, const TCHAR* FieldName,
+                                      const TArray<T>& Values, bool bBase64)
+{
+    if (bBase64)
     {
-        Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
-        return true;
+        Result->SetStringField(FieldName, FBase64::Encode(
+            reinterpret_cast<const uint8*>(Values.GetData()), static_cast<uint32>(Values.Num() * sizeof(T))));
+        return;
     }
 
-    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
-    
-    // Use Geometry Script to translate the mesh
-    // UE 5.7+: TranslateMesh is in MeshTransformFunctions
-    // UE 5.5+: TranslateMesh is in MeshTransformFunctions
-    UGeometryScriptLibrary_MeshTransformFunctions::TranslateMesh(Mesh, Translation, nullptr);
-    DMC->NotifyMeshUpdated();
-
-    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetStringField(TEXT("actorName"), ActorName);
-    
-    TSharedPtr<FJsonObject> TransObj = McpHandlerUtils::CreateResultObject();
-    TransObj->SetNumberField(TEXT("x"), Translation.X);
-    TransObj->SetNumberField(TEXT("y"), Translation.Y);
-    TransObj->SetNumberField(TEXT("z"), Translation.Z);
-    Result->SetObjectField(TEXT("translation"), TransObj);
-    
-    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Mesh translated"), Result);
-    return true;
+    TArray<TSharedPtr<FJsonValue>> JsonValues;
+    JsonValues.Reserve(Values.Num());
+    for (const T& Value : Values)
+    {
+        JsonValues.Add(MakeShared<FJsonValueNumber>(static_cast<double>(Value)));
+    }
+    Result->SetArrayField(FieldName, JsonValues);
 }
 
-// -------------------------------------------------------------------------
-// UV Operations - Unwrap and Pack
-// -------------------------------------------------------------------------
-
-static bool HandleUnwrapUV(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
-                           const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+static bool HandleSetMeshBuffers(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                 const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
 {
+    using namespace UE::Geometry;
+
     FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
-    int32 UVChannel = GetIntFieldGeom(Payload, TEXT("uvChannel"), 0);
+    bool bAppend = GetStringFieldGeom(Payload, TEXT("mode"), TEXT("replace")).Equals(TEXT("append"), ESearchCase::IgnoreCase);
+    int32 GroupID = GetIntFieldGeom(Payload, TEXT("groupID"), 0);
 
     if (ActorName.IsEmpty())
     {
@@ -5948,36 +6279,1073 @@ static bool HandleUnwrapUV(UMcpAutomationBridgeSubsystem* Self, const FString& R
         return true;
     }
 
-    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
-    ADynamicMeshActor* TargetActor = nullptr;
+    if (!IsMemoryPressureSafe())
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("Memory pressure too high (%.1f%% used)"), GetMemoryUsagePercent()), TEXT("MEMORY_PRESSURE"));
+        return true;
+    }
 
-    for (TActorIterator<ADynamicMeshActor> It(World); It; ++It)
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<float> Positions, Normals, UVs, Colors;
+    TArray<uint32> Indices;
+    FString DecodeError;
+    // Positions first, so array indices can be range-checked before the uint32 cast
+    // (with no positions the missing-buffer error below is the clearer one)
+    if (!ReadPackedGeometryBuffer(Payload, TEXT("positions"), Positions, DecodeError) ||
+        !ReadPackedGeometryBuffer(Payload, TEXT("indices"), Indices, DecodeError,
+                                  Positions.Num() >= 3 ? static_cast<double>(Positions.Num() / 3)
+                                                       : static_cast<double>(TNumericLimits<uint32>::Max()) + 1.0) ||
+        !ReadPackedGeometryBuffer(Payload, TEXT("normals"), Normals, DecodeError) ||
+        !ReadPackedGeometryBuffer(Payload, TEXT("uvs"), UVs, DecodeError) ||
+        !ReadPackedGeometryBuffer(Payload, TEXT("colors"), Colors, DecodeError))
     {
-        if (It->GetActorLabel() == ActorName)
-        {
-            TargetActor = *It;
-            break;
-        }
+        Self->SendAutomationError(Socket, RequestId, DecodeError, TEXT("INVALID_BUFFER"));
+        return true;
     }
 
-    if (!TargetActor)
+    const int32 VertexCount = Positions.Num() / 3;
+    const int32 TriangleCount = Indices.Num() / 3;
+    if (Positions.Num() % 3 != 0 || Indices.Num() % 3 != 0 || VertexCount == 0)
     {
-        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
+        Self->SendAutomationError(Socket, RequestId,
+            TEXT("positions and indices are required and must contain multiples of 3 values"), TEXT("INVALID_BUFFER"));
+        return true;
+    }
+    if ((Normals.Num() > 0 && Normals.Num() != VertexCount * 3) ||
+        (UVs.Num() > 0 && UVs.Num() != VertexCount * 2) ||
+        (Colors.Num() > 0 && Colors.Num() != VertexCount * 4))
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("normals/uvs/colors must have 3/2/4 values per vertex (%d vertices)"), VertexCount),
+            TEXT("INVALID_BUFFER"));
+        return true;
+    }
+    if (TriangleCount > MAX_TRIANGLES_PER_DYNAMIC_MESH)
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("Triangle count %d exceeds limit %d"), TriangleCount, MAX_TRIANGLES_PER_DYNAMIC_MESH),
+            TEXT("POLY_LIMIT_EXCEEDED"));
         return true;
     }
+    for (uint32 Index : Indices)
+    {
+        if (Index >= static_cast<uint32>(VertexCount))
+        {
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("Index %u out of range (%d vertices)"), Index, VertexCount), TEXT("INVALID_BUFFER"));
+            return true;
+        }
+    }
 
-    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
-    if (!DMC || !DMC->GetDynamicMesh())
+    UDynamicMeshComponent* DMC = nullptr;
+    if (!ResolveDynamicMeshComponent(Self, RequestId, Socket, ActorName, DMC))
     {
-        Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
         return true;
     }
 
-    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
+    const double DecodeTime = FPlatformTime::Seconds();
 
-    // Use XAtlas for proper UV unwrapping
-    FGeometryScriptXAtlasOptions XAtlasOptions;
-    // XAtlas defaults are reasonable for most cases
+    // Build the uploaded geometry in a standalone mesh; element IDs in the
+    // fresh overlays line up 1:1 with vertex IDs.
+    FDynamicMesh3 NewMesh;
+    NewMesh.EnableAttributes();
+    if (Colors.Num() > 0)
+    {
+        NewMesh.EnableVertexColors(FVector3f(1.0f, 1.0f, 1.0f));
+        NewMesh.Attributes()->EnablePrimaryColors();
+    }
+
+    for (int32 V = 0; V < VertexCount; ++V)
+    {
+        NewMesh.AppendVertex(FVector3d(Positions[V * 3], Positions[V * 3 + 1], Positions[V * 3 + 2]));
+        if (Colors.Num() > 0)
+        {
+            NewMesh.SetVertexColor(V, FVector3f(Colors[V * 4], Colors[V * 4 + 1], Colors[V * 4 + 2]));
+        }
+    }
+
+    FDynamicMeshNormalOverlay* NormalOverlay = NewMesh.Attributes()->PrimaryNormals();
+    FDynamicMeshUVOverlay* UVOverlay = NewMesh.Attributes()->GetUVLayer(0);
+    FDynamicMeshColorOverlay* ColorOverlay = NewMesh.Attributes()->PrimaryColors();
+    for (int32 V = 0; V < VertexCount; ++V)
+    {
+        if (Normals.Num() > 0)
+        {
+            NormalOverlay->AppendElement(FVector3f(Normals[V * 3], Normals[V * 3 + 1], Normals[V * 3 + 2]));
+        }
+        if (UVs.Num() > 0)
+        {
+            UVOverlay->AppendElement(FVector2f(UVs[V * 2], UVs[V * 2 + 1]));
+        }
+        if (ColorOverlay)
+        {
+            ColorOverlay->AppendElement(FVector4f(Colors[V * 4], Colors[V * 4 + 1], Colors[V * 4 + 2], Colors[V * 4 + 3]));
+        }
+    }
+
+    int32 SkippedTriangles = 0;
+    for (int32 T = 0; T < TriangleCount; ++T)
+    {
+        const FIndex3i Tri(static_cast<int32>(Indices[T * 3]), static_cast<int32>(Indices[T * 3 + 1]), static_cast<int32>(Indices[T * 3 + 2]));
+        const int32 TID = NewMesh.AppendTriangle(Tri, GroupID);
+        if (TID < 0)
+        {
+            // Degenerate, duplicate or non-manifold triangle
+            SkippedTriangles++;
+            continue;
+        }
+        if (Normals.Num() > 0) NormalOverlay->SetTriangle(TID, Tri);
+        if (UVs.Num() > 0) UVOverlay->SetTriangle(TID, Tri);
+        if (ColorOverlay) ColorOverlay->SetTriangle(TID, Tri);
+    }
+
+    if (Normals.Num() == 0)
+    {
+        FMeshNormals::InitializeOverlayToPerVertexNormals(NormalOverlay, false);
+    }
+
+    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
+    FDynamicMesh3& EditMesh = Mesh->GetMeshRef();
+    if (bAppend && EditMesh.TriangleCount() > 0)
+    {
+        if (EditMesh.TriangleCount() + NewMesh.TriangleCount() > MAX_TRIANGLES_PER_DYNAMIC_MESH)
+        {
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("Appending %d triangles would exceed limit %d"), NewMesh.TriangleCount(), MAX_TRIANGLES_PER_DYNAMIC_MESH),
+                TEXT("POLY_LIMIT_EXCEEDED"));
+            return true;
+        }
+        FDynamicMeshEditor Editor(&EditMesh);
+        FMeshIndexMappings Mappings;
+        Editor.AppendMesh(&NewMesh, Mappings);
+    }
+    else
+    {
+        EditMesh = MoveTemp(NewMesh);
+    }
+
+    // Single render/collision update for the whole upload
+    DMC->NotifyMeshUpdated();
+
+    const double EndTime = FPlatformTime::Seconds();
+    const double TotalSeconds = FMath::Max(EndTime - StartTime, 1e-6);
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetStringField(TEXT("actorName"), ActorName);
+    Result->SetStringField(TEXT("mode"), bAppend ? TEXT("append") : TEXT("replace"));
+    Result->SetNumberField(TEXT("verticesUploaded"), VertexCount);
+    Result->SetNumberField(TEXT("trianglesUploaded"), TriangleCount - SkippedTriangles);
+    Result->SetNumberField(TEXT("skippedTriangles"), SkippedTriangles);
+    Result->SetNumberField(TEXT("vertexCount"), EditMesh.VertexCount());
+    Result->SetNumberField(TEXT("triangleCount"), EditMesh.TriangleCount());
+    Result->SetNumberField(TEXT("decodeMs"), (DecodeTime - StartTime) * 1000.0);
+    Result->SetNumberField(TEXT("buildMs"), (EndTime - DecodeTime) * 1000.0);
+    Result->SetNumberField(TEXT("totalMs"), TotalSeconds * 1000.0);
+    Result->SetNumberField(TEXT("trianglesPerSecond"), (TriangleCount - SkippedTriangles) / TotalSeconds);
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("Uploaded %d vertices / %d triangles"), VertexCount, TriangleCount - SkippedTriangles), Result);
+    return true;
+}
+
+static bool HandleGetMeshBuffers(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                 const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    using namespace UE::Geometry;
+
+    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
+    bool bBase64 = !GetStringFieldGeom(Payload, TEXT("encoding"), TEXT("base64")).Equals(TEXT("json"), ESearchCase::IgnoreCase);
+    int32 UVChannel = GetIntFieldGeom(Payload, TEXT("uvChannel"), 0);
+
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("actorName required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    // Optional subset of buffers; positions and indices are always returned
+    TSet<FString> Include;
+    const TArray<TSharedPtr<FJsonValue>>* IncludeArray = nullptr;
+    if (Payload->TryGetArrayField(TEXT("include"), IncludeArray) && IncludeArray)
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *IncludeArray)
+        {
+            Include.Add(Value->AsString().ToLower());
+        }
+    }
+    auto Wants = [&Include](const TCHAR* Name) { return Include.Num() == 0 || Include.Contains(Name); };
+
+    UDynamicMeshComponent* DMC = nullptr;
+    if (!ResolveDynamicMeshComponent(Self, RequestId, Socket, ActorName, DMC))
+    {
+        return true;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const FDynamicMesh3& ReadMesh = DMC->GetDynamicMesh()->GetMeshRef();
+
+    // Compact vertex IDs (the mesh may contain holes after deletions)
+    TArray<int32> CompactIndex;
+    CompactIndex.Init(INDEX_NONE, ReadMesh.MaxVertexID());
+    TArray<float> Positions;
+    Positions.Reserve(ReadMesh.VertexCount() * 3);
+    int32 NextIndex = 0;
+    for (int32 VID : ReadMesh.VertexIndicesItr())
+    {
+        CompactIndex[VID] = NextIndex++;
+        const FVector3d P = ReadMesh.GetVertex(VID);
+        Positions.Add(static_cast<float>(P.X));
+        Positions.Add(static_cast<float>(P.Y));
+        Positions.Add(static_cast<float>(P.Z));
+    }
+
+    TArray<uint32> Indices;
+    Indices.Reserve(ReadMesh.TriangleCount() * 3);
+    for (int32 TID : ReadMesh.TriangleIndicesItr())
+    {
+        const FIndex3i Tri = ReadMesh.GetTriangle(TID);
+        Indices.Add(static_cast<uint32>(CompactIndex[Tri.A]));
+        Indices.Add(static_cast<uint32>(CompactIndex[Tri.B]));
+        Indices.Add(static_cast<uint32>(CompactIndex[Tri.C]));
+    }
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetStringField(TEXT("actorName"), ActorName);
+    Result->SetStringField(TEXT("encoding"), bBase64 ? TEXT("base64") : TEXT("json"));
+    Result->SetNumberField(TEXT("vertexCount"), NextIndex);
+    Result->SetNumberField(TEXT("triangleCount"), ReadMesh.TriangleCount());
+    WritePackedGeometryBuffer(Result, TEXT("positions"), Positions, bBase64);
+    WritePackedGeometryBuffer(Result, TEXT("indices"), Indices, bBase64);
+
+    // Overlay attributes are flattened to per-vertex values; split seams
+    // resolve to the value of the last triangle visiting the vertex.
+    const FDynamicMeshAttributeSet* Attributes = ReadMesh.Attributes();
+
+    if (Wants(TEXT("normals")))
+    {
+        TArray<float> Normals;
+        Normals.SetNumZeroed(NextIndex * 3);
+        const FDynamicMeshNormalOverlay* NormalOverlay = Attributes ? Attributes->PrimaryNormals() : nullptr;
+        if (NormalOverlay)
+        {
+            for (int32 TID : ReadMesh.TriangleIndicesItr())
+            {
+                if (!NormalOverlay->IsSetTriangle(TID)) continue;
+                const FIndex3i Tri = ReadMesh.GetTriangle(TID);
+                const FIndex3i Elements = NormalOverlay->GetTriangle(TID);
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const FVector3f N = NormalOverlay->GetElement(Elements[Corner]);
+                    const int32 Base = CompactIndex[Tri[Corner]] * 3;
+                    Normals[Base] = N.X; Normals[Base + 1] = N.Y; Normals[Base + 2] = N.Z;
+                }
+            }
+        }
+        else
+        {
+            FMeshNormals VertexNormals(&ReadMesh);
+            VertexNormals.ComputeVertexNormals();
+            for (int32 VID : ReadMesh.VertexIndicesItr())
+            {
+                const FVector3d N = VertexNormals[VID];
+                const int32 Base = CompactIndex[VID] * 3;
+                Normals[Base] = static_cast<float>(N.X); Normals[Base + 1] = static_cast<float>(N.Y); Normals[Base + 2] = static_cast<float>(N.Z);
+            }
+        }
+        WritePackedGeometryBuffer(Result, TEXT("normals"), Normals, bBase64);
+    }
+
+    if (Wants(TEXT("uvs")) && Attributes && UVChannel >= 0 && UVChannel < Attributes->NumUVLayers())
+    {
+        TArray<float> UVs;
+        UVs.SetNumZeroed(NextIndex * 2);
+        const FDynamicMeshUVOverlay* UVOverlay = Attributes->GetUVLayer(UVChannel);
+        for (int32 TID : ReadMesh.TriangleIndicesItr())
+        {
+            if (!UVOverlay->IsSetTriangle(TID)) continue;
+            const FIndex3i Tri = ReadMesh.GetTriangle(TID);
+            const FIndex3i Elements = UVOverlay->GetTriangle(TID);
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const FVector2f UV = UVOverlay->GetElement(Elements[Corner]);
+                const int32 Base = CompactIndex[Tri[Corner]] * 2;
+                UVs[Base] = UV.X; UVs[Base + 1] = UV.Y;
+            }
+        }
+        WritePackedGeometryBuffer(Result, TEXT("uvs"), UVs, bBase64);
+    }
+
+    if (Wants(TEXT("colors")) && (ReadMesh.HasVertexColors() || (Attributes && Attributes->HasPrimaryColors())))
+    {
+        TArray<float> Colors;
+        Colors.Init(1.0f, NextIndex * 4);
+        if (Attributes && Attributes->HasPrimaryColors())
+        {
+            const FDynamicMeshColorOverlay* ColorOverlay = Attributes->PrimaryColors();
+            for (int32 TID : ReadMesh.TriangleIndicesItr())
+            {
+                if (!ColorOverlay->IsSetTriangle(TID)) continue;
+                const FIndex3i Tri = ReadMesh.GetTriangle(TID);
+                const FIndex3i Elements = ColorOverlay->GetTriangle(TID);
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const FVector4f C = ColorOverlay->GetElement(Elements[Corner]);
+                    const int32 Base = CompactIndex[Tri[Corner]] * 4;
+                    Colors[Base] = C.X; Colors[Base + 1] = C.Y; Colors[Base + 2] = C.Z; Colors[Base + 3] = C.W;
+                }
+            }
+        }
+        else
+        {
+            for (int32 VID : ReadMesh.VertexIndicesItr())
+            {
+                const FVector3f C = ReadMesh.GetVertexColor(VID);
+                const int32 Base = CompactIndex[VID] * 4;
+                Colors[Base] = C.X; Colors[Base + 1] = C.Y; Colors[Base + 2] = C.Z;
+            }
+        }
+        WritePackedGeometryBuffer(Result, TEXT("colors"), Colors, bBase64);
+    }
+
+    const double TotalSeconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-6);
+    Result->SetNumberField(TEXT("totalMs"), TotalSeconds * 1000.0);
+    Result->SetNumberField(TEXT("trianglesPerSecond"), ReadMesh.TriangleCount() / TotalSeconds);
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("Read %d vertices / %d triangles"), NextIndex, ReadMesh.TriangleCount()), Result);
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// apply_geometry_pipeline - Chained mesh ops on a worker-thread copy
+// -------------------------------------------------------------------------
+// The target mesh is copied into a rooted transient UDynamicMesh on the game
+// thread, every op runs against that copy on the thread pool, and the result
+// is moved back into the component with a single NotifyMeshUpdated. Tool
+// meshes for boolean ops are snapshotted up front so the worker never touches
+// live actors. Intermediate results can be cached by a chained 64-bit hash of
+// the input mesh content and the op list prefix, so re-running a pipeline with
+// a tweaked tail only recomputes the changed ops. Each entry keeps the input
+// and step list that produced it, and a lookup only hits when both match.
+
+static constexpr int32 MAX_PIPELINE_OPS = 64;
+static constexpr int32 MAX_PIPELINE_CACHE_ENTRIES = 16;
+static constexpr int64 MAX_PIPELINE_CACHE_TRIANGLES = 2000000;
+
+// Everything that determines what a step does to the mesh
+struct FMcpGeometryPipelineStepKey
+{
+    FString Op;
+    /** Condensed JSON of the op object. */
+    FString ParamsJson;
+    /** Content hash of a toolActor mesh (0 for none). */
+    uint64 ToolMeshHash = 0;
+    FTransform TargetTransform = FTransform::Identity;
+    FTransform ToolTransform = FTransform::Identity;
+
+    bool operator==(const FMcpGeometryPipelineStepKey& Other) const
+    {
+        return Op.Equals(Other.Op, ESearchCase::CaseSensitive) &&
+               ParamsJson.Equals(Other.ParamsJson, ESearchCase::CaseSensitive) &&
+               ToolMeshHash == Other.ToolMeshHash &&
+               TargetTransform.Equals(Other.TargetTransform, 0.0) &&
+               ToolTransform.Equals(Other.ToolTransform, 0.0);
+    }
+};
+
+// Identity of the mesh a pipeline starts from
+struct FMcpGeometryPipelineInput
+{
+    uint64 ContentHash = 0;
+    int32 VertexCount = 0;
+    int32 TriangleCount = 0;
+
+    bool operator==(const FMcpGeometryPipelineInput& Other) const
+    {
+        return ContentHash == Other.ContentHash && VertexCount == Other.VertexCount &&
+               TriangleCount == Other.TriangleCount;
+    }
+};
+
+struct FMcpGeometryPipelineOp
+{
+    FMcpGeometryPipelineStepKey Key;
+    TSharedPtr<FJsonObject> Params;
+    UDynamicMesh* ToolMesh = nullptr;
+};
+
+struct FMcpGeometryPipelineCacheEntry
+{
+    TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe> Mesh;
+    int64 TriangleCount = 0;
+    /** What produced Mesh; compared on lookup so a key collision is a miss. */
+    FMcpGeometryPipelineInput Input;
+    TArray<FMcpGeometryPipelineStepKey> Steps;
+};
+
+static FCriticalSection GGeometryPipelineCacheMutex;
+static TMap<uint64, FMcpGeometryPipelineCacheEntry> GGeometryPipelineCache;
+static TArray<uint64> GGeometryPipelineCacheOrder;
+
+static bool GeometryPipelineCacheEntryMatches(const FMcpGeometryPipelineCacheEntry& Entry,
+                                              const FMcpGeometryPipelineInput& Input,
+                                              TArrayView<const FMcpGeometryPipelineStepKey> Steps)
+{
+    if (!(Entry.Input == Input) || Entry.Steps.Num() != Steps.Num())
+    {
+        return false;
+    }
+    for (int32 Index = 0; Index < Steps.Num(); ++Index)
+    {
+        if (!(Entry.Steps[Index] == Steps[Index]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void StoreGeometryPipelineCache(uint64 Key, const FMcpGeometryPipelineInput& Input,
+                                       TArrayView<const FMcpGeometryPipelineStepKey> Steps,
+                                       const UE::Geometry::FDynamicMesh3& Mesh)
+{
+    FScopeLock Lock(&GGeometryPipelineCacheMutex);
+    if (GGeometryPipelineCache.Contains(Key))
+    {
+        // Same result already cached; on a collision keep the older entry
+        return;
+    }
+
+    FMcpGeometryPipelineCacheEntry Entry;
+    Entry.Mesh = MakeShared<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>(Mesh);
+    Entry.TriangleCount = Mesh.TriangleCount();
+    Entry.Input = Input;
+    Entry.Steps = TArray<FMcpGeometryPipelineStepKey>(Steps.GetData(), Steps.Num());
+    GGeometryPipelineCache.Add(Key, MoveTemp(Entry));
+    GGeometryPipelineCacheOrder.Add(Key);
+
+    // Evict oldest entries until both the entry and triangle budgets hold
+    int64 TotalTriangles = 0;
+    for (const TPair<uint64, FMcpGeometryPipelineCacheEntry>& Pair : GGeometryPipelineCache)
+    {
+        TotalTriangles += Pair.Value.TriangleCount;
+    }
+    while (GGeometryPipelineCacheOrder.Num() > 1 &&
+           (GGeometryPipelineCacheOrder.Num() > MAX_PIPELINE_CACHE_ENTRIES || TotalTriangles > MAX_PIPELINE_CACHE_TRIANGLES))
+    {
+        const uint64 Oldest = GGeometryPipelineCacheOrder[0];
+        GGeometryPipelineCacheOrder.RemoveAt(0);
+        if (const FMcpGeometryPipelineCacheEntry* Evicted = GGeometryPipelineCache.Find(Oldest))
+        {
+            TotalTriangles -= Evicted->TriangleCount;
+        }
+        GGeometryPipelineCache.Remove(Oldest);
+    }
+}
+
+static TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe> FindGeometryPipelineCache(
+    uint64 Key, const FMcpGeometryPipelineInput& Input, TArrayView<const FMcpGeometryPipelineStepKey> Steps)
+{
+    FScopeLock Lock(&GGeometryPipelineCacheMutex);
+    const FMcpGeometryPipelineCacheEntry* Entry = GGeometryPipelineCache.Find(Key);
+    return Entry && GeometryPipelineCacheEntryMatches(*Entry, Input, Steps) ? Entry->Mesh : nullptr;
+}
+
+// Content hash of positions and topology; attributes follow from the ops so
+// they are not hashed separately.
+static uint64 HashDynamicMeshContent(const UE::Geometry::FDynamicMesh3& Mesh)
+{
+    uint64 Hash = static_cast<uint64>(Mesh.TriangleCount());
+    for (int32 VID : Mesh.VertexIndicesItr())
+    {
+        const FVector3d P = Mesh.GetVertex(VID);
+        Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&P), sizeof(P), Hash);
+    }
+    for (int32 TID : Mesh.TriangleIndicesItr())
+    {
+        const UE::Geometry::FIndex3i Tri = Mesh.GetTriangle(TID);
+        Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Tri), sizeof(Tri), Hash);
+    }
+    return Hash;
+}
+
+static uint64 HashTransformForPipeline(const FTransform& Transform, uint64 Seed)
+{
+    const FVector Location = Transform.GetLocation();
+    const FQuat Rotation = Transform.GetRotation();
+    const FVector Scale = Transform.GetScale3D();
+    const double Values[10] = {Location.X, Location.Y, Location.Z, Rotation.X, Rotation.Y, Rotation.Z, Rotation.W,
+                               Scale.X, Scale.Y, Scale.Z};
+    return CityHash64WithSeed(reinterpret_cast<const char*>(Values), sizeof(Values), Seed);
+}
+
+// Chains one step onto the key of the mesh before it
+static uint64 HashPipelineStep(const FMcpGeometryPipelineStepKey& Step, uint64 Seed)
+{
+    uint64 Hash = CityHash64WithSeed(reinterpret_cast<const char*>(*Step.Op), Step.Op.Len() * sizeof(TCHAR), Seed);
+    Hash = CityHash64WithSeed(reinterpret_cast<const char*>(*Step.ParamsJson), Step.ParamsJson.Len() * sizeof(TCHAR), Hash);
+    Hash = CityHash64WithSeed(reinterpret_cast<const char*>(&Step.ToolMeshHash), sizeof(Step.ToolMeshHash), Hash);
+    Hash = HashTransformForPipeline(Step.TargetTransform, Hash);
+    return HashTransformForPipeline(Step.ToolTransform, Hash);
+}
+
+static bool IsSupportedGeometryPipelineOp(const FString& Op)
+{
+    static const TSet<FString> SupportedOps = {
+        TEXT("append_box"), TEXT("append_sphere"), TEXT("append_cylinder"),
+        TEXT("boolean"), TEXT("simplify"), TEXT("remesh_uniform"), TEXT("smooth"),
+        TEXT("weld"), TEXT("fill_holes"), TEXT("recalculate_normals"), TEXT("auto_uv"),
+        TEXT("bevel"), TEXT("transform")
+    };
+    return SupportedOps.Contains(Op);
+}
+
+static void AppendPipelinePrimitive(const TSharedPtr<FJsonObject>& Params, const FString& Shape,
+                                    UDynamicMesh* Mesh, const FTransform& Transform)
+{
+    FGeometryScriptPrimitiveOptions Options;
+    if (Shape == TEXT("sphere"))
+    {
+        const int32 Steps = ClampSegments(GetIntFieldGeom(Params, TEXT("subdivisions"), 16), 16);
+        UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendSphereBox(
+            Mesh, Options, Transform, ClampDimension(GetNumberFieldGeom(Params, TEXT("radius"), 50.0)),
+            Steps, Steps, Steps, EGeometryScriptPrimitiveOriginMode::Center, nullptr);
+    }
+    else if (Shape == TEXT("cylinder"))
+    {
+        UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendCylinder(
+            Mesh, Options, Transform,
+            ClampDimension(GetNumberFieldGeom(Params, TEXT("radius"), 50.0)),
+            ClampDimension(GetNumberFieldGeom(Params, TEXT("height"), 100.0)),
+            ClampSegments(GetIntFieldGeom(Params, TEXT("radialSteps"), 24), 24),
+            ClampSegments(GetIntFieldGeom(Params, TEXT("heightSteps"), 1)),
+            true, EGeometryScriptPrimitiveOriginMode::Center, nullptr);
+    }
+    else
+    {
+        UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendBox(
+            Mesh, Options, Transform,
+            ClampDimension(GetNumberFieldGeom(Params, TEXT("width"), 100.0)),
+            ClampDimension(GetNumberFieldGeom(Params, TEXT("height"), 100.0)),
+            ClampDimension(GetNumberFieldGeom(Params, TEXT("depth"), 100.0)),
+            1, 1, 1, EGeometryScriptPrimitiveOriginMode::Center, nullptr);
+    }
+}
+
+// Runs on the thread pool. Only touches the transient meshes owned by the job.
+static bool ApplyGeometryPipelineOp(UDynamicMesh* Mesh, const FMcpGeometryPipelineOp& Step, FString& OutError)
+{
+    const TSharedPtr<FJsonObject>& Params = Step.Params;
+
+    if (Step.Key.Op == TEXT("append_box") || Step.Key.Op == TEXT("append_sphere") || Step.Key.Op == TEXT("append_cylinder"))
+    {
+        AppendPipelinePrimitive(Params, Step.Key.Op.RightChop(7), Mesh, ReadTransformFromPayload(Params));
+    }
+    else if (Step.Key.Op == TEXT("boolean"))
+    {
+        const FString Operation = GetStringFieldGeom(Params, TEXT("operation"), TEXT("subtract")).ToLower();
+        EGeometryScriptBooleanOperation BoolOp = EGeometryScriptBooleanOperation::Subtract;
+        if (Operation == TEXT("union")) BoolOp = EGeometryScriptBooleanOperation::Union;
+        else if (Operation == TEXT("intersect") || Operation == TEXT("intersection")) BoolOp = EGeometryScriptBooleanOperation::Intersection;
+
+        FGeometryScriptMeshBooleanOptions BoolOptions;
+        BoolOptions.bFillHoles = true;
+        BoolOptions.bSimplifyOutput = false;
+        if (!UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshBoolean(
+                Mesh, Step.Key.TargetTransform, Step.ToolMesh, Step.Key.ToolTransform, BoolOp, BoolOptions, nullptr))
+        {
+            OutError = TEXT("Boolean operation failed");
+            return false;
+        }
+    }
+    else if (Step.Key.Op == TEXT("simplify"))
+    {
+        FGeometryScriptSimplifyMeshOptions SimplifyOptions;
+        SimplifyOptions.Method = EGeometryScriptRemoveMeshSimplificationType::StandardQEM;
+        SimplifyOptions.bAllowSeamCollapse = true;
+        int32 TargetTris = GetIntFieldGeom(Params, TEXT("targetTriangleCount"), 0);
+        if (TargetTris <= 0)
+        {
+            const double Percentage = FMath::Clamp(GetNumberFieldGeom(Params, TEXT("targetPercentage"), 50.0), 1.0, 100.0);
+            TargetTris = FMath::RoundToInt(Mesh->GetTriangleCount() * (Percentage / 100.0));
+        }
+        UGeometryScriptLibrary_MeshSimplifyFunctions::ApplySimplifyToTriangleCount(
+            Mesh, FMath::Max(1, TargetTris), SimplifyOptions, nullptr);
+    }
+    else if (Step.Key.Op == TEXT("remesh_uniform"))
+    {
+        FGeometryScriptRemeshOptions RemeshOptions;
+        RemeshOptions.bDiscardAttributes = false;
+        RemeshOptions.bReprojectToInputMesh = true;
+        FGeometryScriptUniformRemeshOptions UniformOptions;
+        UniformOptions.TargetType = EGeometryScriptUniformRemeshTargetType::TriangleCount;
+        UniformOptions.TargetTriangleCount = FMath::Clamp(GetIntFieldGeom(Params, TEXT("targetTriangleCount"), 5000), 4, MAX_TRIANGLES_PER_DYNAMIC_MESH);
+        UGeometryScriptLibrary_RemeshingFunctions::ApplyUniformRemesh(Mesh, RemeshOptions, UniformOptions, nullptr);
+    }
+    else if (Step.Key.Op == TEXT("smooth"))
+    {
+        FGeometryScriptIterativeMeshSmoothingOptions SmoothOptions;
+        SmoothOptions.NumIterations = FMath::Clamp(GetIntFieldGeom(Params, TEXT("iterations"), 10), 1, 1000);
+        SmoothOptions.Alpha = GetNumberFieldGeom(Params, TEXT("alpha"), 0.2);
+        UGeometryScriptLibrary_MeshDeformFunctions::ApplyIterativeSmoothingToMesh(
+            Mesh, FGeometryScriptMeshSelection(), SmoothOptions, nullptr);
+    }
+    else if (Step.Key.Op == TEXT("weld"))
+    {
+        FGeometryScriptWeldEdgesOptions WeldOptions;
+        WeldOptions.Tolerance = GetNumberFieldGeom(Params, TEXT("tolerance"), 0.001);
+        WeldOptions.bOnlyUniquePairs = true;
+        UGeometryScriptLibrary_MeshRepairFunctions::WeldMeshEdges(Mesh, WeldOptions, nullptr);
+    }
+    else if (Step.Key.Op == TEXT("fill_holes"))
+    {
+        FGeometryScriptFillHolesOptions FillOptions;
+        FillOptions.FillMethod = EGeometryScriptFillHolesMethod::Automatic;
+        int32 NumFilled = 0;
+        int32 NumFailed = 0;
+        UGeometryScriptLibrary_MeshRepairFunctions::FillAllMeshHoles(Mesh, FillOptions, NumFilled, NumFailed, nullptr);
+    }
+    else if (Step.Key.Op == TEXT("recalculate_normals"))
+    {
+        FGeometryScriptCalculateNormalsOptions NormalOptions;
+        NormalOptions.bAreaWeighted = GetBoolFieldGeom(Params, TEXT("areaWeighted"), true);
+        NormalOptions.bAngleWeighted = true;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+        UGeometryScriptLibrary_MeshNormalsFunctions::RecomputeNormals(Mesh, NormalOptions, false, nullptr);
+#else
+        UGeometryScriptLibrary_MeshNormalsFunctions::RecomputeNormals(Mesh, NormalOptions, nullptr);
+#endif
+    }
+    else if (Step.Key.Op == TEXT("auto_uv"))
+    {
+        UGeometryScriptLibrary_MeshUVFunctions::AutoGenerateXAtlasMeshUVs(
+            Mesh, GetIntFieldGeom(Params, TEXT("uvChannel"), 0), FGeometryScriptXAtlasOptions(), nullptr);
+    }
+    else if (Step.Key.Op == TEXT("bevel"))
+    {
+        FGeometryScriptMeshBevelOptions BevelOptions;
+        BevelOptions.BevelDistance = GetNumberFieldGeom(Params, TEXT("distance"), 5.0);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4
+        BevelOptions.Subdivisions = FMath::Clamp(GetIntFieldGeom(Params, TEXT("subdivisions"), 0), 0, 16);
+#endif
+        UGeometryScriptLibrary_MeshModelingFunctions::ApplyMeshPolygroupBevel(Mesh, BevelOptions, nullptr);
+    }
+    else if (Step.Key.Op == TEXT("transform"))
+    {
+        const FVector Scale = ReadVectorFromPayload(Params, TEXT("scale"), FVector::OneVector);
+        const FRotator Rotation = ReadRotatorFromPayload(Params, TEXT("rotation"), FRotator::ZeroRotator);
+        const FVector Translation = ReadVectorFromPayload(Params, TEXT("location"), FVector::ZeroVector);
+        if (!Scale.Equals(FVector::OneVector))
+        {
+            UGeometryScriptLibrary_MeshTransformFunctions::ScaleMesh(Mesh, Scale, FVector::ZeroVector, true, nullptr);
+        }
+        if (!Rotation.IsNearlyZero())
+        {
+            UGeometryScriptLibrary_MeshTransformFunctions::RotateMesh(Mesh, Rotation, FVector::ZeroVector, nullptr);
+        }
+        if (!Translation.IsNearlyZero())
+        {
+            UGeometryScriptLibrary_MeshTransformFunctions::TranslateMesh(Mesh, Translation, nullptr);
+        }
+    }
+
+    if (Mesh->GetTriangleCount() > MAX_TRIANGLES_PER_DYNAMIC_MESH)
+    {
+        OutError = FString::Printf(TEXT("Result has %d triangles, limit is %d"), Mesh->GetTriangleCount(), MAX_TRIANGLES_PER_DYNAMIC_MESH);
+        return false;
+    }
+    return true;
+}
+
+static bool HandleApplyGeometryPipeline(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                        const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
+    bool bUseCache = GetBoolFieldGeom(Payload, TEXT("useCache"), false);
+
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("actorName required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* OpsArray = nullptr;
+    if (!Payload->TryGetArrayField(TEXT("ops"), OpsArray) || OpsArray->Num() == 0)
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("ops array required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+    if (OpsArray->Num() > MAX_PIPELINE_OPS)
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("Pipeline has %d ops, limit is %d"), OpsArray->Num(), MAX_PIPELINE_OPS),
+            TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    if (!IsMemoryPressureSafe())
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("Memory pressure too high (%.1f%% used). Pipeline blocked to prevent OOM."), GetMemoryUsagePercent()),
+            TEXT("MEMORY_PRESSURE"));
+        return true;
+    }
+
+    UDynamicMeshComponent* DMC = nullptr;
+    if (!ResolveDynamicMeshComponent(Self, RequestId, Socket, ActorName, DMC))
+    {
+        return true;
+    }
+
+    const double SetupStart = FPlatformTime::Seconds();
+    const FTransform TargetTransform = DMC->GetOwner()->GetActorTransform();
+    FMcpGeometryJobRef Job = MakeShared<FMcpGeometryJob, ESPMode::ThreadSafe>();
+    Job->Label = TEXT("apply_geometry_pipeline");
+
+    // Validate every op and snapshot boolean tool meshes before going async
+    TArray<FMcpGeometryPipelineOp> Steps;
+    auto ReleaseRooted = [&Job]()
+    {
+        for (UDynamicMesh* Rooted : Job->RootedMeshes)
+        {
+            Rooted->RemoveFromRoot();
+        }
+        Job->RootedMeshes.Reset();
+    };
+
+    for (int32 Index = 0; Index < OpsArray->Num(); ++Index)
+    {
+        const TSharedPtr<FJsonObject> OpObject = (*OpsArray)[Index].IsValid() ? (*OpsArray)[Index]->AsObject() : nullptr;
+        FMcpGeometryPipelineOp Step;
+        Step.Key.Op = OpObject.IsValid() ? GetStringFieldGeom(OpObject, TEXT("op")).ToLower() : FString();
+        if (!IsSupportedGeometryPipelineOp(Step.Key.Op))
+        {
+            ReleaseRooted();
+            Self->SendAutomationError(Socket, RequestId,
+                FString::Printf(TEXT("ops[%d]: unsupported op '%s'"), Index, *Step.Key.Op), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        Step.Params = OpObject;
+
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Step.Key.ParamsJson);
+        FJsonSerializer::Serialize(OpObject.ToSharedRef(), Writer);
+
+        if (Step.Key.Op == TEXT("boolean"))
+        {
+            Step.ToolMesh = Job->CreateRootedMesh();
+
+            FString ToolActorName = GetStringFieldGeom(OpObject, TEXT("toolActor"));
+            if (!ToolActorName.IsEmpty())
+            {
+                UDynamicMeshComponent* ToolDMC = nullptr;
+                if (!ResolveDynamicMeshComponent(Self, RequestId, Socket, ToolActorName, ToolDMC))
+                {
+                    ReleaseRooted();
+                    return true;
+                }
+                Step.ToolMesh->SetMesh(ToolDMC->GetDynamicMesh()->GetMeshRef());
+                Step.Key.TargetTransform = TargetTransform;
+                Step.Key.ToolTransform = ToolDMC->GetOwner()->GetActorTransform();
+                // Tool mesh content is part of the cache key
+                Step.Key.ToolMeshHash = HashDynamicMeshContent(ToolDMC->GetDynamicMesh()->GetMeshRef());
+            }
+            else
+            {
+                // Primitive tool in the target's local space
+                AppendPipelinePrimitive(OpObject, GetStringFieldGeom(OpObject, TEXT("shape"), TEXT("box")).ToLower(),
+                                        Step.ToolMesh, ReadTransformFromPayload(OpObject));
+            }
+        }
+        Steps.Add(MoveTemp(Step));
+    }
+
+    UDynamicMesh* WorkMesh = Job->CreateRootedMesh();
+    WorkMesh->SetMesh(DMC->GetDynamicMesh()->GetMeshRef());
+    const int32 TrianglesBefore = WorkMesh->GetTriangleCount();
+
+    struct FPipelineState
+    {
+        TArray<TSharedPtr<FJsonValue>> OpResults;
+        int32 CachedOps = 0;
+    };
+    TSharedRef<FPipelineState, ESPMode::ThreadSafe> State = MakeShared<FPipelineState, ESPMode::ThreadSafe>();
+
+    auto Work = [Steps = MoveTemp(Steps), WorkMesh, bUseCache, State](FMcpGeometryJob& RunningJob, FString& OutError) -> bool
+    {
+        // Chained keys: Keys[i] identifies the mesh after ops [0..i]
+        FMcpGeometryPipelineInput Input;
+        Input.ContentHash = HashDynamicMeshContent(WorkMesh->GetMeshRef());
+        Input.VertexCount = WorkMesh->GetMeshRef().VertexCount();
+        Input.TriangleCount = WorkMesh->GetMeshRef().TriangleCount();
+        TArray<FMcpGeometryPipelineStepKey> StepKeys;
+        TArray<uint64> Keys;
+        uint64 Key = Input.ContentHash;
+        for (const FMcpGeometryPipelineOp& Step : Steps)
+        {
+            Key = HashPipelineStep(Step.Key, Key);
+            Keys.Add(Key);
+            StepKeys.Add(Step.Key);
+        }
+
+        if (bUseCache)
+        {
+            for (int32 Index = Steps.Num() - 1; Index >= 0; --Index)
+            {
+                if (TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe> Cached =
+                        FindGeometryPipelineCache(Keys[Index], Input, MakeArrayView(StepKeys).Left(Index + 1)))
+                {
+                    WorkMesh->SetMesh(*Cached);
+                    State->CachedOps = Index + 1;
+                    break;
+                }
+            }
+        }
+
+        for (int32 Index = 0; Index < State->CachedOps; ++Index)
+        {
+            TSharedPtr<FJsonObject> OpResult = MakeShared<FJsonObject>();
+            OpResult->SetNumberField(TEXT("index"), Index);
+            OpResult->SetStringField(TEXT("op"), Steps[Index].Key.Op);
+            OpResult->SetBoolField(TEXT("cached"), true);
+            State->OpResults.Add(MakeShared<FJsonValueObject>(OpResult));
+        }
+
+        for (int32 Index = State->CachedOps; Index < Steps.Num(); ++Index)
+        {
+            if (RunningJob.bCancelled)
+            {
+                return false;
+            }
+
+            const double OpStart = FPlatformTime::Seconds();
+            FString Error;
+            if (!ApplyGeometryPipelineOp(WorkMesh, Steps[Index], Error))
+            {
+                OutError = FString::Printf(TEXT("ops[%d] failed: %s"), Index, *Error);
+                return false;
+            }
+            if (bUseCache)
+            {
+                StoreGeometryPipelineCache(Keys[Index], Input, MakeArrayView(StepKeys).Left(Index + 1), WorkMesh->GetMeshRef());
+            }
+
+            TSharedPtr<FJsonObject> OpResult = MakeShared<FJsonObject>();
+            OpResult->SetNumberField(TEXT("index"), Index);
+            OpResult->SetStringField(TEXT("op"), Steps[Index].Key.Op);
+            OpResult->SetBoolField(TEXT("cached"), false);
+            OpResult->SetNumberField(TEXT("triangleCount"), WorkMesh->GetTriangleCount());
+            OpResult->SetNumberField(TEXT("durationMs"), (FPlatformTime::Seconds() - OpStart) * 1000.0);
+            State->OpResults.Add(MakeShared<FJsonValueObject>(OpResult));
+
+            RunningJob.ReportProgress(100.0f * (Index + 1) / Steps.Num(),
+                FString::Printf(TEXT("%s (%d/%d)"), *Steps[Index].Key.Op, Index + 1, Steps.Num()));
+        }
+        return true;
+    };
+
+    auto Commit = [ActorName, WorkMesh, TrianglesBefore, State, OpCount = OpsArray->Num()](
+        FMcpGeometryJob& RunningJob, UDynamicMeshComponent* Component, const TSharedPtr<FJsonObject>& Result) -> FString
+    {
+        // Single commit and render/collision update for the whole pipeline
+        CommitGeometryJobMesh(Component, WorkMesh);
+        const UE::Geometry::FDynamicMesh3& Committed = Component->GetDynamicMesh()->GetMeshRef();
+
+        Result->SetStringField(TEXT("actorName"), ActorName);
+        Result->SetNumberField(TEXT("opCount"), OpCount);
+        Result->SetNumberField(TEXT("cachedOps"), State->CachedOps);
+        Result->SetNumberField(TEXT("trianglesBefore"), TrianglesBefore);
+        Result->SetNumberField(TEXT("trianglesAfter"), Committed.TriangleCount());
+        Result->SetNumberField(TEXT("vertexCount"), Committed.VertexCount());
+        Result->SetArrayField(TEXT("ops"), State->OpResults);
+        return FString::Printf(TEXT("Applied %d ops (%d from cache)"), OpCount, State->CachedOps);
+    };
+
+    Job->GameThreadSeconds = FPlatformTime::Seconds() - SetupStart;
+    RunGeometryJobOnWorker(Self, RequestId, Socket, Job, DMC, MoveTemp(Work), MoveTemp(Commit));
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// cancel_geometry_job / list_geometry_jobs - Background job control
+// -------------------------------------------------------------------------
+
+static bool HandleCancelGeometryJob(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                    const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString JobId = GetStringFieldGeom(Payload, TEXT("jobId"));
+    if (JobId.IsEmpty())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("jobId required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    FMcpGeometryJobRef* Found = GGeometryJobs.Find(JobId);
+    if (!Found)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Geometry job not found: %s"), *JobId), TEXT("JOB_NOT_FOUND"));
+        return true;
+    }
+
+    FMcpGeometryJobRef Job = *Found;
+    if (!Job->bCancellable)
+    {
+        Self->SendAutomationError(Socket, RequestId,
+            FString::Printf(TEXT("%s can no longer be cancelled"), *Job->Label), TEXT("JOB_NOT_CANCELLABLE"));
+        return true;
+    }
+
+    Job->bCancelled = true;
+    const bool bWasRunning = Job->bRunning;
+    if (!bWasRunning)
+    {
+        // Queued jobs never started; answer the original request right away
+        FinishGeometryJob(Job, false, FString::Printf(TEXT("%s cancelled"), *Job->Label), nullptr, TEXT("CANCELLED"));
+    }
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetStringField(TEXT("jobId"), JobId);
+    Result->SetStringField(TEXT("label"), Job->Label);
+    Result->SetStringField(TEXT("state"), bWasRunning ? TEXT("cancelling") : TEXT("cancelled"));
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        bWasRunning ? TEXT("Cancellation requested; result will be discarded") : TEXT("Queued job cancelled"), Result);
+    return true;
+}
+
+static bool HandleListGeometryJobs(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                   const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    const double Now = FPlatformTime::Seconds();
+    TArray<TSharedPtr<FJsonValue>> Jobs;
+    for (const TPair<FString, FMcpGeometryJobRef>& Pair : GGeometryJobs)
+    {
+        const FMcpGeometryJobRef& Job = Pair.Value;
+        TSharedPtr<FJsonObject> JobObject = MakeShared<FJsonObject>();
+        JobObject->SetStringField(TEXT("jobId"), Job->RequestId);
+        JobObject->SetStringField(TEXT("label"), Job->Label);
+        JobObject->SetStringField(TEXT("state"), Job->bCancelled ? TEXT("cancelling") : (Job->bRunning ? TEXT("running") : TEXT("queued")));
+        JobObject->SetBoolField(TEXT("cancellable"), Job->bCancellable);
+        JobObject->SetNumberField(TEXT("elapsedMs"), (Now - Job->QueuedTime) * 1000.0);
+        Jobs.Add(MakeShared<FJsonValueObject>(JobObject));
+    }
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetArrayField(TEXT("jobs"), Jobs);
+    Result->SetNumberField(TEXT("running"), GRunningGeometryJobs);
+    Result->SetNumberField(TEXT("queued"), GGeometryJobQueue.Num());
+    Result->SetNumberField(TEXT("maxConcurrent"), MAX_CONCURRENT_GEOMETRY_JOBS);
+    Self->SendAutomationResponse(Socket, RequestId, true, FString::Printf(TEXT("%d geometry jobs"), Jobs.Num()), Result);
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// translate_mesh - Translate entire mesh
+// -------------------------------------------------------------------------
+
+static bool HandleTranslateMesh(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                                const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
+    FVector Translation = ReadVectorFromPayload(Payload, TEXT("translation"), FVector::ZeroVector);
+    
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("actorName required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    ADynamicMeshActor* TargetActor = nullptr;
+
+    for (TActorIterator<ADynamicMeshActor> It(World); It; ++It)
+    {
+        if (It->GetActorLabel() == ActorName)
+        {
+            TargetActor = *It;
+            break;
+        }
+    }
+
+    if (!TargetActor)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
+        return true;
+    }
+
+    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
+    if (!DMC || !DMC->GetDynamicMesh())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
+        return true;
+    }
+
+    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
+    
+    // Use Geometry Script to translate the mesh
+    // UE 5.7+: TranslateMesh is in MeshTransformFunctions
+    // UE 5.5+: TranslateMesh is in MeshTransformFunctions
+    UGeometryScriptLibrary_MeshTransformFunctions::TranslateMesh(Mesh, Translation, nullptr);
+    DMC->NotifyMeshUpdated();
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetStringField(TEXT("actorName"), ActorName);
+    
+    TSharedPtr<FJsonObject> TransObj = McpHandlerUtils::CreateResultObject();
+    TransObj->SetNumberField(TEXT("x"), Translation.X);
+    TransObj->SetNumberField(TEXT("y"), Translation.Y);
+    TransObj->SetNumberField(TEXT("z"), Translation.Z);
+    Result->SetObjectField(TEXT("translation"), TransObj);
+    
+    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Mesh translated"), Result);
+    return true;
+}
+
+// -------------------------------------------------------------------------
+// UV Operations - Unwrap and Pack
+// -------------------------------------------------------------------------
+
+static bool HandleUnwrapUV(UMcpAutomationBridgeSubsystem* Self, const FString& RequestId,
+                           const TSharedPtr<FJsonObject>& Payload, TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetStringFieldGeom(Payload, TEXT("actorName"));
+    int32 UVChannel = GetIntFieldGeom(Payload, TEXT("uvChannel"), 0);
+
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("actorName required"), TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    ADynamicMeshActor* TargetActor = nullptr;
+
+    for (TActorIterator<ADynamicMeshActor> It(World); It; ++It)
+    {
+        if (It->GetActorLabel() == ActorName)
+        {
+            TargetActor = *It;
+            break;
+        }
+    }
+
+    if (!TargetActor)
+    {
+        Self->SendAutomationError(Socket, RequestId, FString::Printf(TEXT("Actor not found: %s"), *ActorName), TEXT("ACTOR_NOT_FOUND"));
+        return true;
+    }
+
+    UDynamicMeshComponent* DMC = TargetActor->GetDynamicMeshComponent();
+    if (!DMC || !DMC->GetDynamicMesh())
+    {
+        Self->SendAutomationError(Socket, RequestId, TEXT("DynamicMesh not available"), TEXT("MESH_NOT_FOUND"));
+        return true;
+    }
+
+    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
+
+    // Use XAtlas for proper UV unwrapping
+    FGeometryScriptXAtlasOptions XAtlasOptions;
+    // XAtlas defaults are reasonable for most cases
 
     UGeometryScriptLibrary_MeshUVFunctions::AutoGenerateXAtlasMeshUVs(
         Mesh,
@@ -6602,47 +7970,65 @@ static bool HandleRemeshVoxel(UMcpAutomationBridgeSubsystem* Self, const FString
         return true;
     }
 
-    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
-    int32 TrisBefore = Mesh->GetTriangleCount();
+    const double SetupStart = FPlatformTime::Seconds();
+    FMcpGeometryJobRef Job = MakeShared<FMcpGeometryJob, ESPMode::ThreadSafe>();
+    Job->Label = TEXT("Voxel remesh");
+    UDynamicMesh* WorkMesh = Job->CreateRootedMesh();
+    WorkMesh->SetMesh(DMC->GetDynamicMesh()->GetMeshRef());
+    int32 TrisBefore = WorkMesh->GetTriangleCount();
+    TWeakObjectPtr<ADynamicMeshActor> WeakActor(TargetActor);
 
-    // Voxel remesh: Use uniform remesh as approximation (UE5 doesn't have direct voxel remesh in GeometryScript)
-    // For voxel-like results, we use uniform remesh with the voxel size as target edge length approximation
-    FGeometryScriptRemeshOptions RemeshOptions;
-    RemeshOptions.bDiscardAttributes = false;
-    RemeshOptions.bReprojectToInputMesh = true;
-    
-    FGeometryScriptUniformRemeshOptions UniformOptions;
-    // Calculate target triangle count based on voxel size
-    int32 TargetTris = FMath::Max(100, TrisBefore / 2);
-    UniformOptions.TargetType = EGeometryScriptUniformRemeshTargetType::TriangleCount;
-    UniformOptions.TargetTriangleCount = TargetTris;
-    
-    UGeometryScriptLibrary_RemeshingFunctions::ApplyUniformRemesh(Mesh, RemeshOptions, UniformOptions, nullptr);
-    
-    // Fill holes if requested
-    if (bFillHoles)
+    auto Work = [WorkMesh, TrisBefore, bFillHoles](FMcpGeometryJob& RunningJob, FString& OutError) -> bool
     {
-        FGeometryScriptFillHolesOptions FillOptions;
-        FillOptions.FillMethod = EGeometryScriptFillHolesMethod::Automatic;
-        int32 NumFilled = 0;
-        int32 NumFailed = 0;
-        UGeometryScriptLibrary_MeshRepairFunctions::FillAllMeshHoles(Mesh, FillOptions, NumFilled, NumFailed, nullptr);
-    }
+        RunningJob.ReportProgress(10.0f, TEXT("Remeshing"));
 
-    DMC->NotifyMeshUpdated();
+        // Voxel remesh: Use uniform remesh as approximation (UE5 doesn't have direct voxel remesh in GeometryScript)
+        // For voxel-like results, we use uniform remesh with the voxel size as target edge length approximation
+        FGeometryScriptRemeshOptions RemeshOptions;
+        RemeshOptions.bDiscardAttributes = false;
+        RemeshOptions.bReprojectToInputMesh = true;
 
-    int32 TrisAfter = Mesh->GetTriangleCount();
+        FGeometryScriptUniformRemeshOptions UniformOptions;
+        // Calculate target triangle count based on voxel size
+        int32 TargetTris = FMath::Max(100, TrisBefore / 2);
+        UniformOptions.TargetType = EGeometryScriptUniformRemeshTargetType::TriangleCount;
+        UniformOptions.TargetTriangleCount = TargetTris;
 
-    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetStringField(TEXT("actorName"), ActorName);
-    Result->SetNumberField(TEXT("voxelSize"), VoxelSize);
-    Result->SetNumberField(TEXT("trianglesBefore"), TrisBefore);
-    Result->SetNumberField(TEXT("trianglesAfter"), TrisAfter);
-    
-    // Add verification data
-    McpHandlerUtils::AddVerification(Result, TargetActor);
-    
-    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Voxel remesh applied"), Result);
+        UGeometryScriptLibrary_RemeshingFunctions::ApplyUniformRemesh(WorkMesh, RemeshOptions, UniformOptions, nullptr);
+
+        // Fill holes if requested
+        if (bFillHoles && !RunningJob.bCancelled)
+        {
+            RunningJob.ReportProgress(70.0f, TEXT("Filling holes"));
+            FGeometryScriptFillHolesOptions FillOptions;
+            FillOptions.FillMethod = EGeometryScriptFillHolesMethod::Automatic;
+            int32 NumFilled = 0;
+            int32 NumFailed = 0;
+            UGeometryScriptLibrary_MeshRepairFunctions::FillAllMeshHoles(WorkMesh, FillOptions, NumFilled, NumFailed, nullptr);
+        }
+        return true;
+    };
+
+    auto Commit = [WorkMesh, WeakActor, ActorName, VoxelSize, TrisBefore](
+        FMcpGeometryJob& RunningJob, UDynamicMeshComponent* Component, const TSharedPtr<FJsonObject>& Result) -> FString
+    {
+        CommitGeometryJobMesh(Component, WorkMesh);
+
+        Result->SetStringField(TEXT("actorName"), ActorName);
+        Result->SetNumberField(TEXT("voxelSize"), VoxelSize);
+        Result->SetNumberField(TEXT("trianglesBefore"), TrisBefore);
+        Result->SetNumberField(TEXT("trianglesAfter"), Component->GetDynamicMesh()->GetTriangleCount());
+
+        // Add verification data
+        if (WeakActor.IsValid())
+        {
+            McpHandlerUtils::AddVerification(Result, WeakActor.Get());
+        }
+        return TEXT("Voxel remesh applied");
+    };
+
+    Job->GameThreadSeconds = FPlatformTime::Seconds() - SetupStart;
+    RunGeometryJobOnWorker(Self, RequestId, Socket, Job, DMC, MoveTemp(Work), MoveTemp(Commit));
     return true;
 }
 
@@ -6689,35 +8075,57 @@ static bool HandleGenerateComplexCollision(UMcpAutomationBridgeSubsystem* Self,
         return true;
     }
 
-    UDynamicMesh* Mesh = DMC->GetDynamicMesh();
-
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5
-    FGeometryScriptCollisionFromMeshOptions CollisionOptions;
-    CollisionOptions.Method = EGeometryScriptCollisionGenerationMethod::ConvexHulls;
-    CollisionOptions.MaxConvexHullsPerMesh = FMath::Clamp(MaxHullCount, 1, 64);
-    CollisionOptions.bEmitTransaction = false;
-    
-    // Generate collision from mesh
-    FGeometryScriptSimpleCollision Collision = UGeometryScriptLibrary_CollisionFunctions::GenerateCollisionFromMesh(
-        Mesh, CollisionOptions, nullptr);
+    // Convex decomposition runs on a mesh copy; only the collision assignment
+    // touches the component on the game thread.
+    const double SetupStart = FPlatformTime::Seconds();
+    FMcpGeometryJobRef Job = MakeShared<FMcpGeometryJob, ESPMode::ThreadSafe>();
+    Job->Label = TEXT("Complex collision");
+    UDynamicMesh* WorkMesh = Job->CreateRootedMesh();
+    WorkMesh->SetMesh(DMC->GetDynamicMesh()->GetMeshRef());
+    TWeakObjectPtr<ADynamicMeshActor> WeakActor(TargetActor);
+    TSharedRef<FGeometryScriptSimpleCollision, ESPMode::ThreadSafe> Collision = MakeShared<FGeometryScriptSimpleCollision, ESPMode::ThreadSafe>();
 
-    // Set the collision on the DynamicMeshComponent
-    FGeometryScriptSetSimpleCollisionOptions SetOptions;
-    UGeometryScriptLibrary_CollisionFunctions::SetSimpleCollisionOfDynamicMeshComponent(
-        Collision, DMC, SetOptions, nullptr);
+    auto Work = [WorkMesh, Collision, MaxHullCount](FMcpGeometryJob& RunningJob, FString& OutError) -> bool
+    {
+        RunningJob.ReportProgress(10.0f, TEXT("Computing convex decomposition"));
 
-    int32 ShapeCount = UGeometryScriptLibrary_CollisionFunctions::GetSimpleCollisionShapeCount(Collision);
+        FGeometryScriptCollisionFromMeshOptions CollisionOptions;
+        CollisionOptions.Method = EGeometryScriptCollisionGenerationMethod::ConvexHulls;
+        CollisionOptions.MaxConvexHullsPerMesh = FMath::Clamp(MaxHullCount, 1, 64);
+        CollisionOptions.bEmitTransaction = false;
 
-    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetStringField(TEXT("actorName"), ActorName);
-    Result->SetNumberField(TEXT("hullCount"), MaxHullCount);
-    Result->SetNumberField(TEXT("shapeCount"), ShapeCount);
-    Result->SetStringField(TEXT("collisionType"), TEXT("convex_decomposition"));
-    
-    // Add verification data
-    McpHandlerUtils::AddVerification(Result, TargetActor);
-    
-    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("Complex collision generated"), Result);
+        // Generate collision from mesh
+        *Collision = UGeometryScriptLibrary_CollisionFunctions::GenerateCollisionFromMesh(
+            WorkMesh, CollisionOptions, nullptr);
+        return true;
+    };
+
+    auto Commit = [Collision, WeakActor, ActorName, MaxHullCount](
+        FMcpGeometryJob& RunningJob, UDynamicMeshComponent* Component, const TSharedPtr<FJsonObject>& Result) -> FString
+    {
+        // Set the collision on the DynamicMeshComponent
+        FGeometryScriptSetSimpleCollisionOptions SetOptions;
+        UGeometryScriptLibrary_CollisionFunctions::SetSimpleCollisionOfDynamicMeshComponent(
+            *Collision, Component, SetOptions, nullptr);
+
+        int32 ShapeCount = UGeometryScriptLibrary_CollisionFunctions::GetSimpleCollisionShapeCount(*Collision);
+
+        Result->SetStringField(TEXT("actorName"), ActorName);
+        Result->SetNumberField(TEXT("hullCount"), MaxHullCount);
+        Result->SetNumberField(TEXT("shapeCount"), ShapeCount);
+        Result->SetStringField(TEXT("collisionType"), TEXT("convex_decomposition"));
+
+        // Add verification data
+        if (WeakActor.IsValid())
+        {
+            McpHandlerUtils::AddVerification(Result, WeakActor.Get());
+        }
+        return TEXT("Complex collision generated");
+    };
+
+    Job->GameThreadSeconds = FPlatformTime::Seconds() - SetupStart;
+    RunGeometryJobOnWorker(Self, RequestId, Socket, Job, DMC, MoveTemp(Work), MoveTemp(Commit));
 #else
     Self->SendAutomationError(Socket, RequestId, TEXT("Complex collision generation requires UE 5.4+"), TEXT("VERSION_NOT_SUPPORTED"));
 #endif
@@ -6907,40 +8315,93 @@ static bool HandleGenerateLODsGeometry(UMcpAutomationBridgeSubsystem* Self, cons
         }
     }
 
-    // Generate LODs
-    StaticMesh->Modify();
-    StaticMesh->SetNumSourceModels(LODCount);
+    // Generate LODs as a geometry job: Build() hands the reduction to the
+    // engine's async static mesh compiler (when enabled) and a ticker polls
+    // for completion instead of blocking the game thread.
+    FMcpGeometryJobRef Job = MakeShared<FMcpGeometryJob, ESPMode::ThreadSafe>();
+    Job->Label = TEXT("Generate LODs");
+    TWeakObjectPtr<UStaticMesh> WeakStaticMesh(StaticMesh);
 
-    // Configure LOD reduction settings with progressive reduction
-    for (int32 LODIndex = 1; LODIndex < LODCount; LODIndex++)
+    Job->Run = [WeakStaticMesh, TargetPath, LODCount](const FMcpGeometryJobRef& RunningJob)
     {
-        FStaticMeshSourceModel& SourceModel = StaticMesh->GetSourceModel(LODIndex);
-        FMeshReductionSettings& ReductionSettings = SourceModel.ReductionSettings;
+        UStaticMesh* Mesh = WeakStaticMesh.Get();
+        if (RunningJob->bCancelled || !Mesh)
+        {
+            FinishGeometryJob(RunningJob, false,
+                RunningJob->bCancelled ? TEXT("Generate LODs cancelled") : TEXT("StaticMesh was unloaded before the build started"),
+                nullptr, RunningJob->bCancelled ? TEXT("CANCELLED") : TEXT("ASSET_NOT_FOUND"));
+            return;
+        }
 
-        // Progressive reduction: 50%, 25%, 12.5%...
-        float ReductionPercent = 1.0f / FMath::Pow(2.0f, static_cast<float>(LODIndex));
-        ReductionSettings.PercentTriangles = ReductionPercent;
-        ReductionSettings.PercentVertices = ReductionPercent;
+        // The engine build cannot be interrupted once started
+        RunningJob->bCancellable = false;
+        const double BuildStart = FPlatformTime::Seconds();
 
-        SourceModel.BuildSettings.bRecomputeNormals = false;
-        SourceModel.BuildSettings.bRecomputeTangents = false;
-        SourceModel.BuildSettings.bUseMikkTSpace = true;
-    }
+        Mesh->Modify();
+        Mesh->SetNumSourceModels(LODCount);
 
-    // Build the mesh with new LOD settings
-    StaticMesh->Build();
-    StaticMesh->PostEditChange();
-    McpSafeAssetSave(StaticMesh);
+        // Configure LOD reduction settings with progressive reduction
+        for (int32 LODIndex = 1; LODIndex < LODCount; LODIndex++)
+        {
+            FStaticMeshSourceModel& SourceModel = Mesh->GetSourceModel(LODIndex);
+            FMeshReductionSettings& ReductionSettings = SourceModel.ReductionSettings;
 
-    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetStringField(TEXT("assetPath"), TargetPath);
-    Result->SetNumberField(TEXT("lodCount"), LODCount);
-    Result->SetNumberField(TEXT("triangles"), StaticMesh->GetNumTriangles(0));
-    
-    // Add verification data
-    McpHandlerUtils::AddVerification(Result, StaticMesh);
-    
-    Self->SendAutomationResponse(Socket, RequestId, true, TEXT("LODs generated for geometry"), Result);
+            // Progressive reduction: 50%, 25%, 12.5%...
+            float ReductionPercent = 1.0f / FMath::Pow(2.0f, static_cast<float>(LODIndex));
+            ReductionSettings.PercentTriangles = ReductionPercent;
+            ReductionSettings.PercentVertices = ReductionPercent;
+
+            SourceModel.BuildSettings.bRecomputeNormals = false;
+            SourceModel.BuildSettings.bRecomputeTangents = false;
+            SourceModel.BuildSettings.bUseMikkTSpace = true;
+        }
+
+        // Build the mesh with new LOD settings
+        Mesh->Build(true);
+        RunningJob->GameThreadSeconds += FPlatformTime::Seconds() - BuildStart;
+        RunningJob->ReportProgress(10.0f, FString::Printf(TEXT("Building %d LODs"), LODCount));
+
+        double LastReport = FPlatformTime::Seconds();
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+            [RunningJob, WeakStaticMesh, TargetPath, LODCount, LastReport](float) mutable -> bool
+        {
+            UStaticMesh* BuiltMesh = WeakStaticMesh.Get();
+            if (!BuiltMesh)
+            {
+                FinishGeometryJob(RunningJob, false, TEXT("StaticMesh was unloaded during the build"), nullptr, TEXT("ASSET_NOT_FOUND"));
+                return false;
+            }
+            if (BuiltMesh->IsCompiling())
+            {
+                const double Now = FPlatformTime::Seconds();
+                if (Now - LastReport > 1.0)
+                {
+                    LastReport = Now;
+                    RunningJob->ReportProgress(-1.0f, FString::Printf(TEXT("Building %d LODs"), LODCount));
+                }
+                return true;
+            }
+
+            const double CommitStart = FPlatformTime::Seconds();
+            BuiltMesh->PostEditChange();
+            McpSafeAssetSave(BuiltMesh);
+
+            TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+            Result->SetStringField(TEXT("assetPath"), TargetPath);
+            Result->SetNumberField(TEXT("lodCount"), LODCount);
+            Result->SetNumberField(TEXT("triangles"), BuiltMesh->GetNumTriangles(0));
+            Result->SetNumberField(TEXT("buildMs"), (CommitStart - RunningJob->StartTime) * 1000.0);
+
+            // Add verification data
+            McpHandlerUtils::AddVerification(Result, BuiltMesh);
+
+            RunningJob->GameThreadSeconds += FPlatformTime::Seconds() - CommitStart;
+            FinishGeometryJob(RunningJob, true, TEXT("LODs generated for geometry"), Result);
+            return false;
+        }), 0.1f);
+    };
+
+    EnqueueGeometryJob(Self, RequestId, Socket, Job);
 #else
     Self->SendAutomationError(Socket, RequestId, TEXT("Requires editor build"), TEXT("NOT_SUPPORTED"));
 #endif
@@ -7242,6 +8703,17 @@ bool UMcpAutomationBridgeSubsystem::HandleGeometryAction(
     if (SubAction == TEXT("set_vertex_position")) return HandleSetVertexPosition(this, RequestId, Payload, RequestingSocket);
     if (SubAction == TEXT("translate_mesh")) return HandleTranslateMesh(this, RequestId, Payload, RequestingSocket);
 
+    // Bulk Buffer Transfer
+    if (SubAction == TEXT("set_mesh_buffers")) return HandleSetMeshBuffers(this, RequestId, Payload, RequestingSocket);
+    if (SubAction == TEXT("get_mesh_buffers")) return HandleGetMeshBuffers(this, RequestId, Payload, RequestingSocket);
+
+    // Chained Operations
+    if (SubAction == TEXT("apply_geometry_pipeline")) return HandleApplyGeometryPipeline(this, RequestId, Payload, RequestingSocket);
+
+    // Background Job Control
+    if (SubAction == TEXT("cancel_geometry_job")) return HandleCancelGeometryJob(this, RequestId, Payload, RequestingSocket);
+    if (SubAction == TEXT("list_geometry_jobs")) return HandleListGeometryJobs(this, RequestId, Payload, RequestingSocket);
+
     // Additional UV Operations
     if (SubAction == TEXT("unwrap_uv")) return HandleUnwrapUV(this, RequestId, Payload, RequestingSocket);
     if (SubAction == TEXT("pack_uv_islands")) return HandlePackUVIslands(this, RequestId, Payload, RequestingSocket);
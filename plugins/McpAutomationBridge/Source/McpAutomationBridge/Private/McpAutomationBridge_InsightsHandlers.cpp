@@ -9,15 +9,22 @@
 // -----------------------------------------------------------------------------
 // Action: manage_insights
 //   - start_session: Start Unreal Insights trace session with optional channels
+//   - stop_session: Stop the running trace and report the newest trace file
+//   - snapshot_trace: Write the trace tail buffer to a .utrace file
+//   - list_traces: List recorded .utrace files under Saved/Profiling
+//   - analyze_trace: Summarize a .utrace in-process (timers, threads, frames,
+//     counters, load time) via McpTraceAnalysis
 // 
 // Dependencies:
 //   - Core: McpAutomationBridgeSubsystem, McpAutomationBridgeHelpers
-//   - Engine: Trace system (built-in)
+//   - Engine: Trace system (built-in), TraceServices for analysis
 // 
 // Notes:
-//   - Uses console command "Trace.Start [channels]" for compatibility
+//   - Uses console commands "Trace.Start [channels]", "Trace.Stop" and
+//     "Trace.SnapshotFile" for compatibility
 //   - Channels are optional; default trace starts without specific channels
-//   - Trace data sent to Unreal Insights application
+//   - Trace files are written under Saved/Profiling
+//   - analyze_trace responds when analysis finishes and streams progress
 // =============================================================================
 
 #include "McpVersionCompatibility.h"  // MUST be first - UE version compatibility macros
@@ -29,11 +36,16 @@
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
 #include "McpHandlerUtils.h"
+#include "McpTraceAnalysis.h"
 
 // -----------------------------------------------------------------------------
 // Engine Includes
 // -----------------------------------------------------------------------------
 #include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/TraceAuxiliary.h"
 
 // =============================================================================
 // Handler Implementation
@@ -114,6 +126,161 @@ bool UMcpAutomationBridgeSubsystem::HandleInsightsAction(
         return true;
     }
 
+    // -------------------------------------------------------------------------
+    // stop_session: Stop the running trace
+    // -------------------------------------------------------------------------
+    if (SubAction == TEXT("stop_session"))
+    {
+        if (!GEngine)
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                TEXT("Engine is not available."), TEXT("ENGINE_UNAVAILABLE"));
+            return true;
+        }
+        if (!FTraceAuxiliary::IsConnected())
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                TEXT("No trace session is running."), TEXT("NOT_TRACING"));
+            return true;
+        }
+
+        GEngine->Exec(nullptr, TEXT("Trace.Stop"));
+
+        TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+        Result->SetStringField(TEXT("action"), TEXT("stop_trace"));
+        Result->SetStringField(TEXT("status"), TEXT("stopped"));
+        const TArray<TSharedPtr<FJsonValue>> Latest = McpTraceAnalysis::ListTraces(1);
+        if (Latest.Num() > 0)
+        {
+            Result->SetObjectField(TEXT("trace"), Latest[0]->AsObject());
+        }
+
+        SendAutomationResponse(RequestingSocket, RequestId, true,
+            TEXT("Trace session stopped."), Result);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // snapshot_trace: Write the in-memory trace buffer to a file
+    // -------------------------------------------------------------------------
+    if (SubAction == TEXT("snapshot_trace") || SubAction == TEXT("snapshot"))
+    {
+        if (!GEngine)
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                TEXT("Engine is not available."), TEXT("ENGINE_UNAVAILABLE"));
+            return true;
+        }
+
+        FString FileName;
+        Payload->TryGetStringField(TEXT("fileName"), FileName);
+        if (FileName.IsEmpty())
+        {
+            FileName = FString::Printf(TEXT("Snapshot_%s"), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+        }
+        FileName = FPaths::MakeValidFileName(FPaths::GetBaseFilename(FileName)) + TEXT(".utrace");
+        const FString FilePath = FPaths::Combine(McpTraceAnalysis::GetTraceDir(), FileName);
+
+        GEngine->Exec(nullptr, *FString::Printf(TEXT("Trace.SnapshotFile \"%s\""), *FilePath));
+        if (!FPaths::FileExists(FilePath))
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                TEXT("Trace snapshot was not written. The trace tail buffer may be disabled."),
+                TEXT("COMMAND_FAILED"));
+            return true;
+        }
+
+        TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+        Result->SetStringField(TEXT("action"), TEXT("snapshot_trace"));
+        Result->SetStringField(TEXT("name"), FileName);
+        Result->SetStringField(TEXT("path"), FilePath);
+        Result->SetNumberField(TEXT("sizeBytes"), static_cast<double>(IFileManager::Get().FileSize(*FilePath)));
+        Result->SetBoolField(TEXT("tracing"), FTraceAuxiliary::IsConnected());
+
+        SendAutomationResponse(RequestingSocket, RequestId, true,
+            FString::Printf(TEXT("Trace snapshot written to %s."), *FileName), Result);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // list_traces: Recorded trace files, newest first
+    // -------------------------------------------------------------------------
+    if (SubAction == TEXT("list_traces"))
+    {
+        double Limit = 50.0;
+        Payload->TryGetNumberField(TEXT("limit"), Limit);
+        const TArray<TSharedPtr<FJsonValue>> Traces =
+            McpTraceAnalysis::ListTraces(FMath::Clamp(static_cast<int32>(Limit), 1, 1000));
+
+        TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+        Result->SetStringField(TEXT("traceDir"), McpTraceAnalysis::GetTraceDir());
+        Result->SetBoolField(TEXT("tracing"), FTraceAuxiliary::IsConnected());
+        Result->SetNumberField(TEXT("count"), Traces.Num());
+        Result->SetArrayField(TEXT("traces"), Traces);
+
+        SendAutomationResponse(RequestingSocket, RequestId, true,
+            FString::Printf(TEXT("Found %d trace file(s)."), Traces.Num()), Result);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // analyze_trace: Summarize a recorded trace without Unreal Insights
+    // -------------------------------------------------------------------------
+    if (SubAction == TEXT("analyze_trace"))
+    {
+        FString Reference;
+        if (!Payload->TryGetStringField(TEXT("filePath"), Reference))
+        {
+            Payload->TryGetStringField(TEXT("traceName"), Reference);
+        }
+
+        FString Error;
+        const FString FilePath = McpTraceAnalysis::ResolveTracePath(Reference, Error);
+        if (FilePath.IsEmpty())
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, TEXT("NOT_FOUND"));
+            return true;
+        }
+
+        McpTraceAnalysis::FAnalyzeOptions Options;
+        Payload->TryGetNumberField(TEXT("startSeconds"), Options.StartSeconds);
+        Payload->TryGetNumberField(TEXT("endSeconds"), Options.EndSeconds);
+        Payload->TryGetStringField(TEXT("counterFilter"), Options.CounterFilter);
+        double TopTimers = Options.TopTimers;
+        Payload->TryGetNumberField(TEXT("topTimers"), TopTimers);
+        Options.TopTimers = FMath::Clamp(static_cast<int32>(TopTimers), 1, 500);
+        double MaxCounters = Options.MaxCounters;
+        Payload->TryGetNumberField(TEXT("maxCounters"), MaxCounters);
+        Options.MaxCounters = FMath::Clamp(static_cast<int32>(MaxCounters), 0, 1000);
+
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakThis(this);
+        const ERequestOrigin Origin = CurrentRequestOrigin;
+        FString ErrorCode;
+        const bool bStarted = McpTraceAnalysis::Analyze(FilePath, Options,
+            [WeakThis, RequestId, Origin](float Percent, const FString& Message)
+            {
+                if (UMcpAutomationBridgeSubsystem* Self = WeakThis.Get())
+                {
+                    Self->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+                }
+            },
+            [WeakThis, RequestId, RequestingSocket, Origin](bool bSuccess, const FString& Message,
+                const TSharedPtr<FJsonObject>& Result, const FString& Code)
+            {
+                if (UMcpAutomationBridgeSubsystem* Self = WeakThis.Get())
+                {
+                    Self->SendAutomationResponse(RequestingSocket, RequestId, bSuccess, Message,
+                        Result, Code, Origin);
+                }
+            },
+            Error, ErrorCode);
+        if (!bStarted)
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, ErrorCode);
+        }
+        return true;
+    }
+
     // Unknown subaction
     SendAutomationError(RequestingSocket, RequestId, 
         TEXT("Unknown subAction."), TEXT("INVALID_SUBACTION"));
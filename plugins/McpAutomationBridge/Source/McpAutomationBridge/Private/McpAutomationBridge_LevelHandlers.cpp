@@ -42,6 +42,7 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpNavBuildController.h"
 
 #if WITH_EDITOR
 #include "Editor.h"
@@ -2347,6 +2348,20 @@ TSharedPtr<FJsonObject> Resp = McpHandlerUtils::CreateResultObject();
       return true;
     }
     
+    // mode "incremental" rebuilds only the tiles dirtied since navmesh
+    // building was paused, like manage_navigation rebuild_navigation
+    FString Mode;
+    if (Payload.IsValid() && Payload->TryGetStringField(TEXT("mode"), Mode) &&
+        Mode == TEXT("incremental")) {
+      TSharedPtr<FJsonObject> NavPayload = MakeShared<FJsonObject>();
+      NavPayload->Values = Payload->Values;
+      NavPayload->SetStringField(TEXT("subAction"), TEXT("rebuild_navigation"));
+      return HandleManageNavigationAction(RequestId, TEXT("manage_navigation"),
+                                          NavPayload, RequestingSocket);
+    }
+
+    // A full build covers whatever a paused batch collected
+    McpNavBuildController::Release(TEXT("full_rebuild"));
     FEditorBuildUtils::EditorBuild(World, FBuildOptions::BuildAIPaths);
     
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
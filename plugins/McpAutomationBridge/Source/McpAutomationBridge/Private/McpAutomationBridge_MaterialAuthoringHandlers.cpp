@@ -23,6 +23,12 @@
  *                              create_material_instance_dynamic
  * 8.8  Utility Actions      - compile_material, get_material_info, export_material_code,
  *                              duplicate_material
+ * 8.9  Edit Sessions        - begin_material_edit, commit_material_edit,
+ *                              get_material_edit_status (one compile per batch,
+ *                              see McpMaterialEditSession.h)
+ * 8.10 Declarative Graphs   - apply_material_graph, benchmark_material_graph
+ *                              (diff a full graph spec in one transaction,
+ *                              see McpMaterialGraphSpec.h)
  *
  * VERSION COMPATIBILITY:
  * ----------------------
@@ -47,6 +53,8 @@
 #include "McpHandlerUtils.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpVersionCompatibility.h"
+#include "McpMaterialEditSession.h"
+#include "McpMaterialGraphSpec.h"
 
 // JSON & Serialization
 #include "Dom/JsonObject.h"
@@ -152,6 +160,13 @@ static UMaterialExpression* FindExpressionByIdOrName(UMaterial* Material, const
 static bool SaveMaterialAsset(UMaterial *Material);
 static bool SaveMaterialFunctionAsset(UMaterialFunction *Function);
 static bool SaveMaterialInstanceAsset(UMaterialInstanceConstant *Instance);
+#if WITH_EDITOR
+static void RespondAfterMaterialCompile(
+    UMcpAutomationBridgeSubsystem *Self, const FString &RequestId,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket, UMaterial *Material,
+    const TSharedPtr<FJsonObject> &Result);
+#endif
 
 
 bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
@@ -486,8 +501,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
       return true;
     }
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     bool bSave = true;
     Payload->TryGetBoolField(TEXT("save"), bSave);
@@ -581,8 +595,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
       return true;
     }
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     bool bSave = true;
     Payload->TryGetBoolField(TEXT("save"), bSave);
@@ -661,8 +674,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
       return true;
     }
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     bool bSave = true;
     Payload->TryGetBoolField(TEXT("save"), bSave);
@@ -775,8 +787,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
       MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(PlainSample);
 #endif
       
-      Material->PostEditChange();
-      Material->MarkPackageDirty();
+      McpMaterialEditSession::NotifyEdited(Material);
       
       TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
       Result->SetStringField(TEXT("nodeId"), PlainSample->MaterialExpressionGuid.ToString());
@@ -815,8 +826,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(TexSample);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -852,8 +862,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(TexCoord);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -896,8 +905,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(ScalarParam);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -951,8 +959,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(VecParam);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -997,8 +1004,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(SwitchParam);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1078,8 +1084,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(MathNode);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1171,8 +1176,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
       MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(NewExpr);
 #endif
 
-      Material->PostEditChange();
-      Material->MarkPackageDirty();
+      McpMaterialEditSession::NotifyEdited(Material);
 
       TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
       Result->SetStringField(TEXT("nodeId"),
@@ -1218,8 +1222,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(NewExpr);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1257,8 +1260,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(MaskExpr);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1285,8 +1287,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(DotExpr);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1313,8 +1314,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(CrossExpr);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1352,8 +1352,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(DesatExpr);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1380,8 +1379,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(AppendExpr);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1437,8 +1435,7 @@ bool UMcpAutomationBridgeSubsystem::HandleManageMaterialAuthoringAction(
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(CustomExpr);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -1514,8 +1511,7 @@ MCP_GET_MATERIAL_INPUT(Material, WorldPositionOffset).Expression =
 #endif
 
       if (bFound) {
-        Material->PostEditChange();
-        Material->MarkPackageDirty();
+        McpMaterialEditSession::NotifyEdited(Material);
         SendAutomationResponse(Socket, RequestId, true,
                                TEXT("Connected to main material node."));
       } else {
@@ -1545,8 +1541,7 @@ MCP_GET_MATERIAL_INPUT(Material, WorldPositionOffset).Expression =
             StructProp->ContainerPtrToValuePtr<FExpressionInput>(TargetExpr);
         if (InputPtr) {
           InputPtr->Expression = SourceExpr;
-          Material->PostEditChange();
-          Material->MarkPackageDirty();
+          McpMaterialEditSession::NotifyEdited(Material);
           SendAutomationResponse(Socket, RequestId, true,
                                  TEXT("Nodes connected."));
           return true;
@@ -1610,8 +1605,7 @@ MCP_GET_MATERIAL_INPUT(Material, WorldPositionOffset).Expression =
 #endif
 
         if (bFound) {
-          Material->PostEditChange();
-          Material->MarkPackageDirty();
+          McpMaterialEditSession::NotifyEdited(Material);
           SendAutomationResponse(Socket, RequestId, true,
                                  TEXT("Disconnected from main material pin."));
           return true;
@@ -1908,8 +1902,7 @@ MCP_GET_MATERIAL_INPUT(Material, WorldPositionOffset).Expression =
     MCP_GET_MATERIAL_EXPRESSIONS(Material).Add(FuncCall);
 #endif
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"),
@@ -2581,8 +2574,7 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
       CreatedNodeIds.Add(WeightParam->MaterialExpressionGuid.ToString());
     }
     
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
     
     // Save if requested
     bool bSave = true;
@@ -2641,10 +2633,12 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
       return true;
     }
 
-    // Force recompile
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Force recompile; an open edit session is committed by this compile
+    const McpMaterialEditSession::FCommitResult Commit =
+        McpMaterialEditSession::Commit(Material, TEXT("compile_material"));
+    if (!Commit.bCompiled) {
+      McpMaterialEditSession::Recompile(Material);
+    }
 
     bool bSave = true;
     Payload->TryGetBoolField(TEXT("save"), bSave);
@@ -2656,10 +2650,201 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
     Result->SetStringField(TEXT("assetPath"), AssetPath);
     Result->SetBoolField(TEXT("compiled"), true);
     Result->SetBoolField(TEXT("saved"), bSave);
+    Result->SetNumberField(TEXT("deferredEdits"), Commit.DeferredEdits);
+
+    if (GetJsonBoolField(Payload, TEXT("wait"), false)) {
+      RespondAfterMaterialCompile(this, RequestId, Payload, Socket, Material,
+                                  Result);
+      return true;
+    }
     SendAutomationResponse(Socket, RequestId, true, TEXT("Material compiled."), Result);
     return true;
   }
 
+  // --------------------------------------------------------------------------
+  // begin_material_edit
+  // --------------------------------------------------------------------------
+  if (SubAction == TEXT("begin_material_edit")) {
+    LOAD_MATERIAL_OR_RETURN();
+
+    double MaxSeconds = 300.0;
+    Payload->TryGetNumberField(TEXT("maxSeconds"), MaxSeconds);
+    MaxSeconds = FMath::Clamp(MaxSeconds, 1.0, 3600.0);
+
+    FString Error;
+    if (!McpMaterialEditSession::Begin(Material, MaxSeconds, Error)) {
+      SendAutomationError(Socket, RequestId, Error, TEXT("SESSION_ALREADY_OPEN"));
+      return true;
+    }
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetStringField(TEXT("assetPath"), AssetPath);
+    Result->SetNumberField(TEXT("maxSeconds"), MaxSeconds);
+    SendAutomationResponse(
+        Socket, RequestId, true,
+        TEXT("Material edit session opened; graph edits compile on commit."),
+        Result);
+    return true;
+  }
+
+  // --------------------------------------------------------------------------
+  // commit_material_edit
+  // --------------------------------------------------------------------------
+  if (SubAction == TEXT("commit_material_edit")) {
+    LOAD_MATERIAL_OR_RETURN();
+
+    if (!McpMaterialEditSession::IsOpen(Material)) {
+      SendAutomationError(Socket, RequestId,
+                          TEXT("No material edit session is open for this material."),
+                          TEXT("NO_SESSION"));
+      return true;
+    }
+
+    const McpMaterialEditSession::FCommitResult Commit =
+        McpMaterialEditSession::Commit(Material, TEXT("commit_material_edit"));
+
+    bool bSave = false;
+    Payload->TryGetBoolField(TEXT("save"), bSave);
+    if (bSave) {
+      SaveMaterialAsset(Material);
+    }
+
+    TSharedPtr<FJsonObject> Result =
+        McpMaterialEditSession::CommitResultToJson(Commit);
+    Result->SetBoolField(TEXT("saved"), bSave);
+
+    if (Commit.bCompiled && GetJsonBoolField(Payload, TEXT("wait"), false)) {
+      RespondAfterMaterialCompile(this, RequestId, Payload, Socket, Material,
+                                  Result);
+      return true;
+    }
+    SendAutomationResponse(
+        Socket, RequestId, true,
+        FString::Printf(TEXT("Material edit session committed (%d edits, %s)."),
+                        Commit.DeferredEdits,
+                        Commit.bCompiled ? TEXT("compiled once")
+                                         : TEXT("nothing to compile")),
+        Result);
+    return true;
+  }
+
+  // --------------------------------------------------------------------------
+  // get_material_edit_status
+  // --------------------------------------------------------------------------
+  if (SubAction == TEXT("get_material_edit_status")) {
+    TSharedPtr<FJsonObject> Result = McpMaterialEditSession::GetStatus();
+    SendAutomationResponse(Socket, RequestId, true,
+                           TEXT("Material edit session status."), Result);
+    return true;
+  }
+
+  // --------------------------------------------------------------------------
+  // apply_material_graph
+  // --------------------------------------------------------------------------
+  if (SubAction == TEXT("apply_material_graph")) {
+    LOAD_MATERIAL_OR_RETURN();
+
+    TSharedPtr<FJsonObject> Spec;
+    const TSharedPtr<FJsonObject> *GraphObj = nullptr;
+    FString SpecText;
+    if (Payload->TryGetObjectField(TEXT("graph"), GraphObj) && GraphObj &&
+        (*GraphObj).IsValid()) {
+      Spec = *GraphObj;
+    } else if (Payload->TryGetStringField(TEXT("spec"), SpecText) &&
+               !SpecText.IsEmpty()) {
+      FString ParseError;
+      if (!McpMaterialGraphSpec::ParseText(SpecText, Spec, ParseError)) {
+        SendAutomationError(Socket, RequestId,
+                            FString::Printf(TEXT("Invalid graph spec: %s"), *ParseError),
+                            TEXT("INVALID_SPEC"));
+        return true;
+      }
+    } else {
+      SendAutomationError(Socket, RequestId,
+                          TEXT("Provide 'graph' (object) or 'spec' (text)."),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+
+    // The payload-level prune flag wins over the spec's
+    bool bPrune = false;
+    if (Payload->TryGetBoolField(TEXT("prune"), bPrune)) {
+      Spec->SetBoolField(TEXT("prune"), bPrune);
+    }
+
+    McpMaterialGraphSpec::FApplyResult Applied;
+    FString ApplyError, ApplyErrorCode;
+    if (!McpMaterialGraphSpec::Apply(Material, Spec, Applied, ApplyError,
+                                     ApplyErrorCode)) {
+      SendAutomationError(Socket, RequestId, ApplyError, ApplyErrorCode);
+      return true;
+    }
+
+    bool bSave = false;
+    Payload->TryGetBoolField(TEXT("save"), bSave);
+    if (bSave) {
+      SaveMaterialAsset(Material);
+    }
+
+    TSharedPtr<FJsonObject> Result = Applied.ToJson();
+    Result->SetStringField(TEXT("assetPath"), AssetPath);
+    Result->SetBoolField(TEXT("saved"), bSave);
+
+    if (Applied.bCompiled && GetJsonBoolField(Payload, TEXT("wait"), false)) {
+      RespondAfterMaterialCompile(this, RequestId, Payload, Socket, Material,
+                                  Result);
+      return true;
+    }
+    SendAutomationResponse(
+        Socket, RequestId, true,
+        FString::Printf(TEXT("Material graph applied: %d created, %d updated, "
+                             "%d replaced, %d deleted, %d links (%s)."),
+                        Applied.Created, Applied.Updated, Applied.Replaced,
+                        Applied.Deleted, Applied.Connected,
+                        Applied.bCompiled ? TEXT("compiled once")
+                                          : TEXT("compile deferred to session")),
+        Result);
+    return true;
+  }
+
+  // --------------------------------------------------------------------------
+  // benchmark_material_graph
+  // --------------------------------------------------------------------------
+  if (SubAction == TEXT("benchmark_material_graph")) {
+    double NodeCount = 100.0;
+    Payload->TryGetNumberField(TEXT("nodeCount"), NodeCount);
+    // The client drops any request after 300 s, so stay under that.
+    double TimeoutSeconds = 240.0;
+    Payload->TryGetNumberField(TEXT("timeoutSeconds"), TimeoutSeconds);
+    TimeoutSeconds = FMath::Clamp(TimeoutSeconds, 10.0, 240.0);
+
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+    const ERequestOrigin Origin = CurrentRequestOrigin;
+    FString Error;
+    const bool bStarted = McpMaterialGraphSpec::StartBenchmark(
+        static_cast<int32>(NodeCount), TimeoutSeconds,
+        [WeakSelf, RequestId, Origin](float Percent, const FString &Message) {
+          if (UMcpAutomationBridgeSubsystem *Subsystem = WeakSelf.Get()) {
+            Subsystem->SendProgressUpdate(RequestId, Percent, Message, true,
+                                          Origin);
+          }
+        },
+        [WeakSelf, RequestId, Socket, Origin](
+            bool bSuccess, const FString &Message,
+            const TSharedPtr<FJsonObject> &Result, const FString &ErrorCode) {
+          if (UMcpAutomationBridgeSubsystem *Subsystem = WeakSelf.Get()) {
+            Subsystem->SendAutomationResponse(Socket, RequestId, bSuccess,
+                                              Message, Result, ErrorCode,
+                                              Origin);
+          }
+        },
+        Error);
+    if (!bStarted) {
+      SendAutomationError(Socket, RequestId, Error, TEXT("BENCHMARK_RUNNING"));
+    }
+    return true;
+  }
+
   // --------------------------------------------------------------------------
   // get_material_info
   // --------------------------------------------------------------------------
@@ -2924,8 +3109,7 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
       }
     }
 
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"), NewExpr->MaterialExpressionGuid.ToString());
@@ -2984,8 +3168,7 @@ PRAGMA_ENABLE_DEPRECATION_WARNINGS
     // UE 5.0: Expressions is a direct member array
     Material->Expressions.Remove(Expr);
 #endif
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    McpMaterialEditSession::NotifyEdited(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("nodeId"), NodeId);
@@ -3192,6 +3375,66 @@ static bool SaveMaterialInstanceAsset(UMaterialInstanceConstant *Instance) {
   return McpSafeAssetSave(Instance);
 }
 
+/**
+ * Stream the remaining shader jobs until Material's shaders have compiled,
+ * then respond with Result extended by the structured compile errors.
+ */
+static void RespondAfterMaterialCompile(
+    UMcpAutomationBridgeSubsystem *Self, const FString &RequestId,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket, UMaterial *Material,
+    const TSharedPtr<FJsonObject> &Result) {
+  // The client drops any request after 300 s, so stay under that.
+  double TimeoutSeconds = 240.0;
+  Payload->TryGetNumberField(TEXT("timeoutSeconds"), TimeoutSeconds);
+  TimeoutSeconds = FMath::Clamp(TimeoutSeconds, 1.0, 240.0);
+  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(Self);
+  const ERequestOrigin Origin = Self->CurrentRequestOrigin;
+
+  McpMaterialEditSession::WaitForCompile(
+      Material, TimeoutSeconds,
+      [WeakSelf, RequestId, Origin](float Percent, const FString &Message) {
+        if (UMcpAutomationBridgeSubsystem *Subsystem = WeakSelf.Get()) {
+          Subsystem->SendProgressUpdate(RequestId, Percent, Message, true,
+                                        Origin);
+        }
+      },
+      [WeakSelf, RequestId, Socket, Origin, Result,
+       TimeoutSeconds](const McpMaterialEditSession::FCompileResult &Compile) {
+        UMcpAutomationBridgeSubsystem *Subsystem = WeakSelf.Get();
+        if (!Subsystem) {
+          return;
+        }
+        Result->SetObjectField(
+            TEXT("compile"),
+            McpMaterialEditSession::CompileResultToJson(Compile));
+        if (Compile.bMaterialLost) {
+          Subsystem->SendAutomationResponse(
+              Socket, RequestId, false,
+              TEXT("Material was unloaded before its shaders compiled."),
+              Result, TEXT("ASSET_NOT_FOUND"), Origin);
+        } else if (!Compile.bFinished) {
+          Subsystem->SendAutomationResponse(
+              Socket, RequestId, false,
+              FString::Printf(TEXT("Material shaders still compiling after %.0f s."),
+                              TimeoutSeconds),
+              Result, TEXT("TIMEOUT"), Origin);
+        } else if (Compile.Errors.Num() > 0) {
+          Subsystem->SendAutomationResponse(
+              Socket, RequestId, false,
+              FString::Printf(TEXT("Material compiled with %d error(s): %s"),
+                              Compile.Errors.Num(), *Compile.Errors[0].Message),
+              Result, TEXT("MATERIAL_COMPILE_ERROR"), Origin);
+        } else {
+          Subsystem->SendAutomationResponse(
+              Socket, RequestId, true,
+              FString::Printf(TEXT("Material compiled in %.0f ms."),
+                              Compile.CompileSeconds * 1000.0),
+              Result, FString(), Origin);
+        }
+      });
+}
+
 static UMaterialExpression *FindExpressionByIdOrName(UMaterial *Material,
                                                       const FString &IdOrName) {
   if (IdOrName.IsEmpty() || !Material) {
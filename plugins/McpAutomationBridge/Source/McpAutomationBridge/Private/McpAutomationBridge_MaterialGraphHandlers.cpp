@@ -36,6 +36,7 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpMaterialEditSession.h"
 
 #if WITH_EDITOR
 
@@ -321,8 +322,7 @@ bool UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction(
                 }
             }
 
-            Material->PostEditChange();
-            Material->MarkPackageDirty();
+            McpMaterialEditSession::NotifyEdited(Material);
 
             TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
             McpHandlerUtils::AddVerification(Result, Material);
@@ -379,8 +379,7 @@ bool UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction(
 #endif
 #endif
 
-            Material->PostEditChange();
-            Material->MarkPackageDirty();
+            McpMaterialEditSession::NotifyEdited(Material);
 
             TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
             McpHandlerUtils::AddVerification(Result, Material);
@@ -500,8 +499,7 @@ bool UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction(
 
             if (bFound)
             {
-                Material->PostEditChange();
-                Material->MarkPackageDirty();
+                McpMaterialEditSession::NotifyEdited(Material);
 
                 TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
                 McpHandlerUtils::AddVerification(Result, Material);
@@ -540,8 +538,7 @@ bool UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction(
                             if (InputPtr)
                             {
                                 InputPtr->Expression = SourceExpr;
-                                Material->PostEditChange();
-                                Material->MarkPackageDirty();
+                                McpMaterialEditSession::NotifyEdited(Material);
 
                                 TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
                                 McpHandlerUtils::AddVerification(Result, Material);
@@ -641,8 +638,7 @@ bool UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction(
 
                 if (bFound)
                 {
-                    Material->PostEditChange();
-                    Material->MarkPackageDirty();
+                    McpMaterialEditSession::NotifyEdited(Material);
 
                     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
                     McpHandlerUtils::AddVerification(Result, Material);
@@ -665,8 +661,7 @@ bool UMcpAutomationBridgeSubsystem::HandleMaterialGraphAction(
         if (TargetExpr)
         {
             // Note: Generic input clearing not implemented - requires property iteration
-            Material->PostEditChange();
-            Material->MarkPackageDirty();
+            McpMaterialEditSession::NotifyEdited(Material);
 
             TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
             McpHandlerUtils::AddVerification(Result, Material);
@@ -882,8 +877,7 @@ bool UMcpAutomationBridgeSubsystem::HandleAddMaterialTextureSample(
 #endif
 #endif
 
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
+    McpMaterialEditSession::NotifyEdited(Material);
     McpSafeAssetSave(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
@@ -1039,8 +1033,7 @@ bool UMcpAutomationBridgeSubsystem::HandleAddMaterialExpression(
 #endif
 #endif
 
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
+    McpMaterialEditSession::NotifyEdited(Material);
     McpSafeAssetSave(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
@@ -1267,8 +1260,7 @@ bool UMcpAutomationBridgeSubsystem::HandleCreateMaterialNodes(
         SuccessCount++;
     }
 
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
+    McpMaterialEditSession::NotifyEdited(Material);
     McpSafeAssetSave(Material);
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
@@ -8,7 +8,7 @@
 // Section 1: NavMesh Configuration
 //   - HandleConfigureNavMeshSettings    : Configure NavMesh tile size, cell size/height
 //   - HandleSetNavAgentProperties       : Set agent radius, height, max slope, step height
-//   - HandleRebuildNavigation           : Trigger full navigation rebuild
+//   - HandleRebuildNavigation           : Full rebuild, or incremental rebuild of dirty tiles
 //
 // Section 2: Nav Modifiers
 //   - HandleCreateNavModifierComponent  : Add NavModifierComponent to Blueprint
@@ -24,6 +24,20 @@
 //
 // Section 4: Utility Handlers
 //   - HandleGetNavigationInfo           : Get navigation system status and settings
+//
+// Section 5: Navigation Queries
+//   - HandleFindPaths                   : Batched path queries (parallel workers)
+//   - HandleReachabilityMatrix          : Source x target reachability / path lengths
+//   - HandleProjectPointsToNavMesh      : Batched point projection onto the navmesh
+//   - HandleBenchmarkNavigationQueries  : Serial vs parallel paths per second
+//
+// Section 6: Navmesh Build Control
+//   - HandleBeginNavBatch               : Pause navmesh building and collect dirty areas
+//   - HandleEndNavBatch                 : Resume building, wait for the dirty tiles
+//   - HandleGetNavBuildStatus           : Pause owners, dirty bounds, tile tasks
+//   - HandleBenchmarkNavRebuild         : Rebuild per placement vs one batched rebuild
+//
+// Section 7: Main Dispatcher
 //   - HandleManageNavigationAction      : Main dispatcher for navigation actions
 //
 // PAYLOAD/RESPONSE FORMATS:
@@ -48,6 +62,37 @@
 //   Payload: { "blueprintPath"?: string }
 //   Response: { "success": bool, "navMeshInfo": { agentRadius, agentHeight, cellSize, ... } }
 //
+// find_paths:
+//   Payload: { "pairs": [{ "start": point, "end": point }], "includePoints"?: bool,
+//              "simplifyTolerance"?: number, "queryExtent"?: {x,y,z}, "filterClass"?: string,
+//              "projectEndpoints"?: bool, "parallel"?: bool }
+//   Response: { "success": bool, "paths": [{ status, length?, cost?, points? }], "pathsPerSecond": number }
+//   A point is {x,y,z}, [x,y,z] or an actor name/label.
+//
+// reachability_matrix:
+//   Payload: { "sources": [point], "targets": [point], "mode"?: "path" | "test", "allowPartial"?: bool }
+//   Response: { "success": bool, "matrix": [[length | -1]] or [[1 | 0]], "allReachable": bool,
+//               "unreachable": [{ source, target, status }], "isolatedSources": [index] }
+//
+// project_points_to_navmesh:
+//   Payload: { "points": [point], "queryExtent"?: {x,y,z} }
+//   Response: { "success": bool, "projected": [[x,y,z] | null], "distances": [number] }
+//
+// The queries above wait (up to "timeoutSeconds", default 120) for the
+// navmesh to rebuild tiles dirtied by earlier requests before they run.
+//
+// rebuild_navigation (mode "incremental") / end_nav_batch:
+//   Payload: { "mode"?: "full" | "incremental", "wait"?: bool, "timeoutSeconds"?: number }
+//   Response: { "success": bool, "upToDate": bool, "rebuildMs": number, "peakTileTasks": number,
+//               "pausedMs": number, "dirtyActorChanges": number, "estimatedDirtyTiles": number }
+//   Tile progress is streamed as progress updates until the navmesh is up to date.
+//
+// benchmark_nav_rebuild:
+//   Payload: { "actorCount"?: number, "spacing"?: number, "actorScale"?: number,
+//              "location"?: {x,y,z}, "timeoutSeconds"?: number }
+//   Response: { "success": bool, "perPlacement": { totalMs, rebuildMs, ... },
+//               "batched": { totalMs, placementMs, rebuildMs, ... }, "rebuildSpeedup": number }
+//
 // VERSION COMPATIBILITY:
 // ----------------------
 // UE 5.0-5.1: Uses deprecated direct NavMesh properties (CellSize, CellHeight, AgentMaxStepHeight)
@@ -71,6 +116,7 @@
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpBridgeWebSocket.h"
+#include "McpNavBuildController.h"
 #include "Misc/EngineVersionComparison.h"
 
 // =============================================================================
@@ -95,6 +141,9 @@
 #include "NavLinkCustomComponent.h"
 #include "Navigation/NavLinkProxy.h"
 #include "AI/NavigationSystemBase.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
 
 // =============================================================================
 // Nav Area Includes
@@ -250,6 +299,115 @@ static bool IsValidNavigationPath(const FString& Path)
     return IsValidAssetPath(Path);
 }
 
+/**
+ * RespondAfterNavRebuild - Resume paused navmesh building and respond once the
+ * dirty tiles are rebuilt, streaming tile progress until then
+ */
+static void RespondAfterNavRebuild(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket,
+    const FString& Reason)
+{
+    const double TimeoutSeconds = FMath::Clamp(GetJsonNumberFieldNav(Payload, TEXT("timeoutSeconds"), 120.0), 1.0, 240.0);
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(Self);
+    const ERequestOrigin Origin = Self->CurrentRequestOrigin;
+
+    McpNavBuildController::WaitForRebuild(Reason, TimeoutSeconds,
+        [WeakSelf, RequestId, Origin](float Percent, const FString& Message)
+        {
+            if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+            {
+                Subsystem->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+            }
+        },
+        [WeakSelf, RequestId, Socket, Origin, TimeoutSeconds](const McpNavBuildController::FRebuildResult& Rebuild)
+        {
+            UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get();
+            if (!Subsystem)
+            {
+                return;
+            }
+            TSharedPtr<FJsonObject> Result = McpNavBuildController::RebuildResultToJson(Rebuild);
+            if (Rebuild.bLockedExternally)
+            {
+                Subsystem->SendAutomationResponse(Socket, RequestId, false,
+                    TEXT("Navmesh building is locked outside the bridge (navigation auto-update disabled?)"),
+                    Result, TEXT("NAV_BUILD_LOCKED"), Origin);
+            }
+            else if (!Rebuild.bUpToDate)
+            {
+                Subsystem->SendAutomationResponse(Socket, RequestId, false,
+                    FString::Printf(TEXT("Navmesh still rebuilding after %.0f s"), TimeoutSeconds),
+                    Result, TEXT("TIMEOUT"), Origin);
+            }
+            else
+            {
+                Subsystem->SendAutomationResponse(Socket, RequestId, true,
+                    FString::Printf(TEXT("Navmesh up to date after %.0f ms (%d tile tasks, %d actor changes)"),
+                        Rebuild.RebuildSeconds * 1000.0, Rebuild.PeakTileTasks, Rebuild.DirtyActorChanges),
+                    Result, FString(), Origin);
+            }
+        });
+}
+
+using FNavQueryHandler = bool (*)(
+    UMcpAutomationBridgeSubsystem*,
+    const FString&,
+    const TSharedPtr<FJsonObject>&,
+    TSharedPtr<FMcpBridgeWebSocket>);
+
+/**
+ * RunAfterNavRebuild - Run a navigation query once the navmesh has caught up
+ * with the geometry changes made before it, streaming tile progress meanwhile
+ */
+static bool RunAfterNavRebuild(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket,
+    FNavQueryHandler Handler)
+{
+    if (!McpNavBuildController::IsRebuildPending())
+    {
+        return Handler(Self, RequestId, Payload, Socket);
+    }
+
+    const double TimeoutSeconds = FMath::Clamp(GetJsonNumberFieldNav(Payload, TEXT("timeoutSeconds"), 120.0), 1.0, 240.0);
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(Self);
+    const ERequestOrigin Origin = Self->CurrentRequestOrigin;
+
+    McpNavBuildController::WaitForRebuild(TEXT("dependent_read"), TimeoutSeconds,
+        [WeakSelf, RequestId, Origin](float Percent, const FString& Message)
+        {
+            if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+            {
+                Subsystem->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+            }
+        },
+        [WeakSelf, RequestId, Payload, Socket, Origin, TimeoutSeconds, Handler](
+            const McpNavBuildController::FRebuildResult& Rebuild)
+        {
+            UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get();
+            if (!Subsystem)
+            {
+                return;
+            }
+            // A navmesh locked outside the bridge never catches up; query it as it is
+            if (!Rebuild.bUpToDate && !Rebuild.bLockedExternally)
+            {
+                Subsystem->SendAutomationResponse(Socket, RequestId, false,
+                    FString::Printf(TEXT("Navmesh still rebuilding after %.0f s; query not run"), TimeoutSeconds),
+                    McpNavBuildController::RebuildResultToJson(Rebuild), TEXT("TIMEOUT"), Origin);
+                return;
+            }
+            TGuardValue<ERequestOrigin> OriginGuard(Subsystem->CurrentRequestOrigin, Origin);
+            Handler(Subsystem, RequestId, Payload, Socket);
+        });
+    return true;
+}
+
 #endif // WITH_EDITOR
 
 // =============================================================================
@@ -553,7 +711,9 @@ static bool HandleSetNavAgentProperties(
 /**
  * HandleRebuildNavigation
  * ------------------------
- * Trigger a full navigation rebuild for the current level.
+ * Trigger a full navigation rebuild for the current level, or with mode
+ * "incremental" rebuild only the tiles dirtied since building was paused and
+ * respond once the navmesh is up to date.
  */
 static bool HandleRebuildNavigation(
     UMcpAutomationBridgeSubsystem* Self,
@@ -597,10 +757,27 @@ static bool HandleRebuildNavigation(
         return true;
     }
 
+    const FString Mode = GetJsonStringFieldNav(Payload, TEXT("mode"), TEXT("full"));
+    if (Mode == TEXT("incremental"))
+    {
+        RespondAfterNavRebuild(Self, RequestId, Payload, Socket, TEXT("rebuild_navigation"));
+        return true;
+    }
+    if (Mode != TEXT("full"))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("Unknown rebuild mode '%s' (expected full or incremental)"), *Mode),
+            nullptr, TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
     // Check for RecastNavMesh - warn if missing but still allow rebuild attempt
     ARecastNavMesh* NavMesh = Cast<ARecastNavMesh>(NavSys->GetDefaultNavDataInstance());
     bool bHasNavMesh = (NavMesh != nullptr);
 
+    // A full build covers whatever a paused batch collected
+    McpNavBuildController::Release(TEXT("full_rebuild"));
+
     // Trigger full navigation rebuild
     NavSys->Build();
 
@@ -1627,80 +1804,1146 @@ static bool HandleGetNavigationInfo(
 #endif // WITH_EDITOR
 
 // =============================================================================
-// Section 5: Main Dispatcher
+// Section 5: Navigation Queries
 // =============================================================================
+// Path, reachability and projection queries against the default RecastNavMesh.
+// Queries in a batch are independent, so they are split into ParallelFor
+// chunks calling the navmesh's FindPath / TestPath / ProjectPoint directly
+// (what FindPathSync does on the game thread). Each chunk reuses one
+// FNavMeshPath, so no path instance is registered with the nav data. The
+// game thread is blocked while a batch runs, so tiles finished by an async
+// build cannot be attached to the navmesh while workers read it.
+
+#if WITH_EDITOR
+
+/** Upper bound on queries (pairs, matrix cells or points) in one request. */
+static constexpr int32 MaxNavQueriesPerRequest = 250000;
+
+/** Queries per ParallelFor work item. */
+static constexpr int32 NavQueryChunkSize = 16;
 
 /**
- * HandleManageNavigationAction
- * -----------------------------
- * Main dispatcher for all navigation-related actions.
- * 
- * Dispatches to appropriate handlers based on subAction field.
- * 
- * Supported subActions:
- *   - configure_nav_mesh_settings
- *   - set_nav_agent_properties
- *   - rebuild_navigation
- *   - create_nav_modifier_component
- *   - set_nav_area_class
- *   - configure_nav_area_cost
- *   - create_nav_link_proxy
- *   - configure_nav_link
- *   - set_nav_link_type
- *   - create_smart_link
- *   - configure_smart_link_behavior
- *   - get_navigation_info
+ * FNavActorLocator - Resolve actor names and labels to locations.
+ * The world is indexed on the first lookup.
  */
-bool UMcpAutomationBridgeSubsystem::HandleManageNavigationAction(
-    const FString& RequestId,
-    const FString& Action,
-    const TSharedPtr<FJsonObject>& Payload,
-    TSharedPtr<FMcpBridgeWebSocket> Socket)
+struct FNavActorLocator
 {
-#if WITH_EDITOR
-    FString SubAction = GetJsonStringFieldNav(Payload, TEXT("subAction"), TEXT(""));
+    explicit FNavActorLocator(UWorld* InWorld) : World(InWorld) {}
 
-    UE_LOG(LogMcpNavigationHandlers, Verbose, TEXT("HandleManageNavigationAction: SubAction=%s"), *SubAction);
+    bool Find(const FString& Name, FVector& OutLocation)
+    {
+        if (!bIndexed)
+        {
+            bIndexed = true;
+            for (TActorIterator<AActor> It(World); It; ++It)
+            {
+                AActor* Actor = *It;
+                ActorsByName.Add(Actor->GetName(), Actor);
+                if (!ActorsByName.Contains(Actor->GetActorLabel()))
+                {
+                    ActorsByName.Add(Actor->GetActorLabel(), Actor);
+                }
+            }
+        }
+        AActor* const* Actor = ActorsByName.Find(Name);
+        if (!Actor || !*Actor)
+        {
+            return false;
+        }
+        OutLocation = (*Actor)->GetActorLocation();
+        return true;
+    }
 
-    // =========================================================================
-    // NavMesh Configuration
-    // =========================================================================
-    if (SubAction == TEXT("configure_nav_mesh_settings"))
-        return HandleConfigureNavMeshSettings(this, RequestId, Payload, Socket);
-    if (SubAction == TEXT("set_nav_agent_properties"))
-        return HandleSetNavAgentProperties(this, RequestId, Payload, Socket);
-    if (SubAction == TEXT("rebuild_navigation"))
-        return HandleRebuildNavigation(this, RequestId, Payload, Socket);
+private:
+    UWorld* World = nullptr;
+    bool bIndexed = false;
+    TMap<FString, AActor*> ActorsByName;
+};
 
-    // =========================================================================
-    // Nav Modifiers
-    // =========================================================================
-    if (SubAction == TEXT("create_nav_modifier_component"))
-        return HandleCreateNavModifierComponent(this, RequestId, Payload, Socket);
-    if (SubAction == TEXT("set_nav_area_class"))
-        return HandleSetNavAreaClass(this, RequestId, Payload, Socket);
-    if (SubAction == TEXT("configure_nav_area_cost"))
-        return HandleConfigureNavAreaCost(this, RequestId, Payload, Socket);
+/**
+ * ReadNavPoint - Read one point: {x,y,z}, [x,y,z] or an actor name/label.
+ */
+static bool ReadNavPoint(const TSharedPtr<FJsonValue>& Value, FNavActorLocator& Locator,
+                         FVector& OutPoint, FString& OutError, FString& OutErrorCode)
+{
+    OutErrorCode = TEXT("INVALID_ARGUMENT");
+    if (!Value.IsValid())
+    {
+        OutError = TEXT("Points must not be null");
+        return false;
+    }
 
-    // =========================================================================
-    // Nav Links
-    // =========================================================================
-    if (SubAction == TEXT("create_nav_link_proxy"))
-        return HandleCreateNavLinkProxy(this, RequestId, Payload, Socket);
-    if (SubAction == TEXT("configure_nav_link"))
-        return HandleConfigureNavLink(this, RequestId, Payload, Socket);
-    if (SubAction == TEXT("set_nav_link_type"))
-        return HandleSetNavLinkType(this, RequestId, Payload, Socket);
-    if (SubAction == TEXT("create_smart_link"))
-        return HandleCreateSmartLink(this, RequestId, Payload, Socket);
-    if (SubAction == TEXT("configure_smart_link_behavior"))
-        return HandleConfigureSmartLinkBehavior(this, RequestId, Payload, Socket);
+    const TSharedPtr<FJsonObject>* Obj = nullptr;
+    if (Value->TryGetObject(Obj) && Obj && Obj->IsValid())
+    {
+        OutPoint = FVector(
+            GetJsonNumberFieldNav(*Obj, TEXT("x")),
+            GetJsonNumberFieldNav(*Obj, TEXT("y")),
+            GetJsonNumberFieldNav(*Obj, TEXT("z")));
+        return true;
+    }
 
-    // =========================================================================
-    // Utility
-    // =========================================================================
-    if (SubAction == TEXT("get_navigation_info"))
-        return HandleGetNavigationInfo(this, RequestId, Payload, Socket);
+    const TArray<TSharedPtr<FJsonValue>>* Components = nullptr;
+    if (Value->TryGetArray(Components) && Components && Components->Num() == 3)
+    {
+        OutPoint = FVector((*Components)[0]->AsNumber(), (*Components)[1]->AsNumber(), (*Components)[2]->AsNumber());
+        return true;
+    }
+
+    FString ActorName;
+    if (Value->TryGetString(ActorName))
+    {
+        if (Locator.Find(ActorName, OutPoint))
+        {
+            return true;
+        }
+        OutError = FString::Printf(TEXT("Actor not found: %s"), *ActorName);
+        OutErrorCode = TEXT("NOT_FOUND");
+        return false;
+    }
+
+    OutError = TEXT("Points must be {x,y,z}, [x,y,z] or an actor name");
+    return false;
+}
+
+/**
+ * ReadNavPointList - Read a required array of points from the payload.
+ */
+static bool ReadNavPointList(const TSharedPtr<FJsonObject>& Payload, const TCHAR* FieldName, FNavActorLocator& Locator,
+                             TArray<FVector>& OutPoints, FString& OutError, FString& OutErrorCode)
+{
+    OutPoints.Reset();
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (!Payload->TryGetArrayField(FieldName, Values) || !Values || Values->Num() == 0)
+    {
+        OutError = FString::Printf(TEXT("%s is required and must not be empty"), FieldName);
+        OutErrorCode = TEXT("MISSING_PARAM");
+        return false;
+    }
+
+    OutPoints.Reserve(Values->Num());
+    for (const TSharedPtr<FJsonValue>& Value : *Values)
+    {
+        if (!ReadNavPoint(Value, Locator, OutPoints.AddDefaulted_GetRef(), OutError, OutErrorCode))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+enum class ENavQueryStatus : uint8
+{
+    Success,
+    Partial,
+    Failed,
+    StartOffNavMesh,
+    EndOffNavMesh
+};
+
+static const TCHAR* GetNavQueryStatusName(ENavQueryStatus Status)
+{
+    switch (Status)
+    {
+    case ENavQueryStatus::Success:         return TEXT("success");
+    case ENavQueryStatus::Partial:         return TEXT("partial");
+    case ENavQueryStatus::StartOffNavMesh: return TEXT("start_off_navmesh");
+    case ENavQueryStatus::EndOffNavMesh:   return TEXT("end_off_navmesh");
+    default:                               return TEXT("failed");
+    }
+}
+
+struct FNavQueryOptions
+{
+    FSharedConstNavQueryFilter Filter;
+    FVector QueryExtent = FVector::ZeroVector;
+    bool bProjectEndpoints = true;
+    bool bTestOnly = false;
+    bool bCollectPoints = false;
+    double SimplifyTolerance = 0.0;
+    bool bParallel = true;
+};
+
+struct FNavQueryResult
+{
+    ENavQueryStatus Status = ENavQueryStatus::Failed;
+    double Length = -1.0;
+    double Cost = -1.0;
+    TArray<FVector> Points;
+};
+
+/**
+ * ReadNavQueryOptions - Query filter, extent and output options shared by
+ * the query actions.
+ */
+static bool ReadNavQueryOptions(const TSharedPtr<FJsonObject>& Payload, const ARecastNavMesh& NavMesh,
+                                FNavQueryOptions& OutOptions, FString& OutError, FString& OutErrorCode)
+{
+    OutOptions.Filter = NavMesh.GetDefaultQueryFilter();
+
+    const FString FilterClassPath = GetJsonStringFieldNav(Payload, TEXT("filterClass"));
+    if (!FilterClassPath.IsEmpty())
+    {
+        UClass* FilterClass = LoadClass<UNavigationQueryFilter>(nullptr, *FilterClassPath);
+        if (!FilterClass)
+        {
+            OutError = FString::Printf(TEXT("Navigation query filter class not found: %s"), *FilterClassPath);
+            OutErrorCode = TEXT("INVALID_CLASS");
+            return false;
+        }
+        OutOptions.Filter = UNavigationQueryFilter::GetQueryFilter(NavMesh, nullptr, FilterClass);
+    }
+
+    OutOptions.QueryExtent = GetJsonVectorFieldNav(Payload, TEXT("queryExtent"), NavMesh.GetDefaultQueryExtent());
+    OutOptions.bProjectEndpoints = GetJsonBoolFieldNav(Payload, TEXT("projectEndpoints"), true);
+    OutOptions.bCollectPoints = GetJsonBoolFieldNav(Payload, TEXT("includePoints"), false);
+    OutOptions.SimplifyTolerance = FMath::Max(0.0, GetJsonNumberFieldNav(Payload, TEXT("simplifyTolerance"), 0.0));
+    OutOptions.bParallel = GetJsonBoolFieldNav(Payload, TEXT("parallel"), true);
+    return true;
+}
+
+/**
+ * SimplifyNavPolyline - Ramer-Douglas-Peucker: drop path points closer than
+ * Tolerance to the segment between the points kept around them.
+ */
+static void SimplifyNavPolyline(TArray<FVector>& Points, double Tolerance)
+{
+    if (Tolerance <= 0.0 || Points.Num() <= 2)
+    {
+        return;
+    }
+
+    TArray<bool> Keep;
+    Keep.Init(false, Points.Num());
+    Keep[0] = true;
+    Keep.Last() = true;
+
+    const double ToleranceSq = Tolerance * Tolerance;
+    TArray<TPair<int32, int32>, TInlineAllocator<32>> Spans;
+    Spans.Emplace(0, Points.Num() - 1);
+    while (Spans.Num() > 0)
+    {
+        const TPair<int32, int32> Span = Spans.Pop();
+        double MaxDistanceSq = ToleranceSq;
+        int32 MaxIndex = INDEX_NONE;
+        for (int32 Index = Span.Key + 1; Index < Span.Value; ++Index)
+        {
+            const double DistanceSq = FMath::PointDistToSegmentSquared(Points[Index], Points[Span.Key], Points[Span.Value]);
+            if (DistanceSq > MaxDistanceSq)
+            {
+                MaxDistanceSq = DistanceSq;
+                MaxIndex = Index;
+            }
+        }
+        if (MaxIndex != INDEX_NONE)
+        {
+            Keep[MaxIndex] = true;
+            Spans.Emplace(Span.Key, MaxIndex);
+            Spans.Emplace(MaxIndex, Span.Value);
+        }
+    }
+
+    int32 Write = 0;
+    for (int32 Read = 0; Read < Points.Num(); ++Read)
+    {
+        if (Keep[Read])
+        {
+            Points[Write++] = Points[Read];
+        }
+    }
+    Points.SetNum(Write);
+}
+
+/**
+ * RunNavPathQueries - Find (or test) a path for every start/end pair.
+ */
+static TArray<FNavQueryResult> RunNavPathQueries(const ARecastNavMesh& NavMesh,
+                                                 const TArray<TPair<FVector, FVector>>& Pairs,
+                                                 const FNavQueryOptions& Options)
+{
+    TArray<FNavQueryResult> Results;
+    Results.SetNum(Pairs.Num());
+
+    const FNavAgentProperties& AgentProperties = NavMesh.GetConfig();
+    const int32 NumChunks = (Pairs.Num() + NavQueryChunkSize - 1) / NavQueryChunkSize;
+
+    ParallelFor(NumChunks, [&](int32 ChunkIndex)
+    {
+        // FindPath resets and refills the path it is given for every query.
+        FNavPathSharedPtr Path = MakeShared<FNavMeshPath, ESPMode::ThreadSafe>();
+
+        const int32 Begin = ChunkIndex * NavQueryChunkSize;
+        const int32 End = FMath::Min(Begin + NavQueryChunkSize, Pairs.Num());
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            FNavQueryResult& Result = Results[Index];
+            FVector Start = Pairs[Index].Key;
+            FVector Goal = Pairs[Index].Value;
+
+            if (Options.bProjectEndpoints)
+            {
+                FNavLocation Projected;
+                if (!NavMesh.ProjectPoint(Start, Projected, Options.QueryExtent, Options.Filter))
+                {
+                    Result.Status = ENavQueryStatus::StartOffNavMesh;
+                    continue;
+                }
+                Start = Projected.Location;
+                if (!NavMesh.ProjectPoint(Goal, Projected, Options.QueryExtent, Options.Filter))
+                {
+                    Result.Status = ENavQueryStatus::EndOffNavMesh;
+                    continue;
+                }
+                Goal = Projected.Location;
+            }
+
+            const FPathFindingQuery Query(nullptr, NavMesh, Start, Goal, Options.Filter, Path);
+            if (Options.bTestOnly)
+            {
+                Result.Status = NavMesh.TestPath(AgentProperties, Query, nullptr)
+                    ? ENavQueryStatus::Success : ENavQueryStatus::Failed;
+                continue;
+            }
+
+            const FPathFindingResult PathResult = NavMesh.FindPath(AgentProperties, Query);
+            if (!PathResult.IsSuccessful() || !PathResult.Path.IsValid())
+            {
+                Result.Status = ENavQueryStatus::Failed;
+                continue;
+            }
+
+            Result.Status = PathResult.Path->IsPartial() ? ENavQueryStatus::Partial : ENavQueryStatus::Success;
+            Result.Length = PathResult.Path->GetLength();
+            Result.Cost = PathResult.Path->GetCost();
+            if (Options.bCollectPoints)
+            {
+                for (const FNavPathPoint& PathPoint : PathResult.Path->GetPathPoints())
+                {
+                    Result.Points.Add(PathPoint.Location);
+                }
+                SimplifyNavPolyline(Result.Points, Options.SimplifyTolerance);
+            }
+        }
+    }, Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    return Results;
+}
+
+/** Round to 0.1 uu to keep query results compact. */
+static double RoundNavValue(double Value)
+{
+    return FMath::RoundToDouble(Value * 10.0) / 10.0;
+}
+
+static void AppendNavPoint(TArray<TSharedPtr<FJsonValue>>& Out, const FVector& Point)
+{
+    Out.Add(MakeShared<FJsonValueNumber>(RoundNavValue(Point.X)));
+    Out.Add(MakeShared<FJsonValueNumber>(RoundNavValue(Point.Y)));
+    Out.Add(MakeShared<FJsonValueNumber>(RoundNavValue(Point.Z)));
+}
+
+/**
+ * ResolveQueryNavMesh - World, navigation system and default RecastNavMesh
+ * for a query. Sends the error response and returns nullptr when missing.
+ */
+static ARecastNavMesh* ResolveQueryNavMesh(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    TSharedPtr<FMcpBridgeWebSocket> Socket,
+    UWorld*& OutWorld)
+{
+    OutWorld = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!OutWorld)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("No editor world available"), nullptr, TEXT("NO_WORLD"));
+        return nullptr;
+    }
+
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(OutWorld);
+    if (!NavSys)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("Navigation system not available"), nullptr, TEXT("NO_NAV_SYS"));
+        return nullptr;
+    }
+
+    ARecastNavMesh* NavMesh = Cast<ARecastNavMesh>(NavSys->GetDefaultNavDataInstance());
+    if (!NavMesh)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("No RecastNavMesh found in level"), nullptr, TEXT("NO_NAVMESH"));
+        return nullptr;
+    }
+    return NavMesh;
+}
+
+static int32 GetNavQueryWorkerCount(bool bParallel)
+{
+    return bParallel ? FTaskGraphInterface::Get().GetNumWorkerThreads() + 1 : 1;
+}
+
+/**
+ * HandleFindPaths
+ * ----------------
+ * Find paths for many start/end pairs in one call. Returns per-pair status,
+ * length and cost, plus the (optionally simplified) path points.
+ */
+static bool HandleFindPaths(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    UWorld* World = nullptr;
+    ARecastNavMesh* NavMesh = ResolveQueryNavMesh(Self, RequestId, Socket, World);
+    if (!NavMesh)
+    {
+        return true;
+    }
+
+    FString Error;
+    FString ErrorCode;
+    FNavQueryOptions Options;
+    if (!ReadNavQueryOptions(Payload, *NavMesh, Options, Error, ErrorCode))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, ErrorCode);
+        return true;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* PairValues = nullptr;
+    if (!Payload->TryGetArrayField(TEXT("pairs"), PairValues) || !PairValues || PairValues->Num() == 0)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("pairs is required: [{ start, end }, ...]"), nullptr, TEXT("MISSING_PARAM"));
+        return true;
+    }
+    if (PairValues->Num() > MaxNavQueriesPerRequest)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("Too many pairs (%d, max %d)"), PairValues->Num(), MaxNavQueriesPerRequest),
+            nullptr, TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    FNavActorLocator Locator(World);
+    TArray<TPair<FVector, FVector>> Pairs;
+    Pairs.Reserve(PairValues->Num());
+    for (const TSharedPtr<FJsonValue>& PairValue : *PairValues)
+    {
+        const TSharedPtr<FJsonObject>* PairObj = nullptr;
+        if (!PairValue.IsValid() || !PairValue->TryGetObject(PairObj) || !PairObj ||
+            !(*PairObj)->HasField(TEXT("start")) || !(*PairObj)->HasField(TEXT("end")))
+        {
+            Self->SendAutomationResponse(Socket, RequestId, false,
+                TEXT("Every pair needs a start and an end"), nullptr, TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        TPair<FVector, FVector>& Pair = Pairs.AddDefaulted_GetRef();
+        if (!ReadNavPoint((*PairObj)->TryGetField(TEXT("start")), Locator, Pair.Key, Error, ErrorCode) ||
+            !ReadNavPoint((*PairObj)->TryGetField(TEXT("end")), Locator, Pair.Value, Error, ErrorCode))
+        {
+            Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, ErrorCode);
+            return true;
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const TArray<FNavQueryResult> Results = RunNavPathQueries(*NavMesh, Pairs, Options);
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+    int32 Succeeded = 0;
+    int32 Partial = 0;
+    int32 OffNavMesh = 0;
+    TArray<TSharedPtr<FJsonValue>> PathsArray;
+    PathsArray.Reserve(Results.Num());
+    for (const FNavQueryResult& QueryResult : Results)
+    {
+        TSharedPtr<FJsonObject> PathObj = MakeShared<FJsonObject>();
+        PathObj->SetStringField(TEXT("status"), GetNavQueryStatusName(QueryResult.Status));
+        if (QueryResult.Status == ENavQueryStatus::Success || QueryResult.Status == ENavQueryStatus::Partial)
+        {
+            if (QueryResult.Status == ENavQueryStatus::Success)
+            {
+                ++Succeeded;
+            }
+            else
+            {
+                ++Partial;
+            }
+            PathObj->SetNumberField(TEXT("length"), RoundNavValue(QueryResult.Length));
+            PathObj->SetNumberField(TEXT("cost"), RoundNavValue(QueryResult.Cost));
+            if (Options.bCollectPoints)
+            {
+                TArray<TSharedPtr<FJsonValue>> PointValues;
+                for (const FVector& Point : QueryResult.Points)
+                {
+                    AppendNavPoint(PointValues, Point);
+                }
+                PathObj->SetArrayField(TEXT("points"), PointValues);
+            }
+        }
+        else if (QueryResult.Status != ENavQueryStatus::Failed)
+        {
+            ++OffNavMesh;
+        }
+        PathsArray.Add(MakeShared<FJsonValueObject>(PathObj));
+    }
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetArrayField(TEXT("paths"), PathsArray);
+    Result->SetNumberField(TEXT("total"), Results.Num());
+    Result->SetNumberField(TEXT("succeeded"), Succeeded);
+    Result->SetNumberField(TEXT("partial"), Partial);
+    Result->SetNumberField(TEXT("offNavMesh"), OffNavMesh);
+    Result->SetNumberField(TEXT("failed"), Results.Num() - Succeeded - Partial - OffNavMesh);
+    Result->SetNumberField(TEXT("elapsedMs"), ElapsedSeconds * 1000.0);
+    Result->SetNumberField(TEXT("pathsPerSecond"), ElapsedSeconds > 0.0 ? Results.Num() / ElapsedSeconds : 0.0);
+    Result->SetNumberField(TEXT("workers"), GetNavQueryWorkerCount(Options.bParallel));
+
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("Found %d of %d paths (%d partial)"), Succeeded + Partial, Results.Num(), Partial), Result);
+    return true;
+}
+
+/**
+ * HandleReachabilityMatrix
+ * -------------------------
+ * Path every source to every target. mode "path" (default) reports path
+ * lengths, mode "test" only whether a path exists, which skips building the
+ * path and is faster. Unreachable cells are -1 (path) or 0 (test).
+ */
+static bool HandleReachabilityMatrix(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    UWorld* World = nullptr;
+    ARecastNavMesh* NavMesh = ResolveQueryNavMesh(Self, RequestId, Socket, World);
+    if (!NavMesh)
+    {
+        return true;
+    }
+
+    FString Error;
+    FString ErrorCode;
+    FNavQueryOptions Options;
+    if (!ReadNavQueryOptions(Payload, *NavMesh, Options, Error, ErrorCode))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, ErrorCode);
+        return true;
+    }
+
+    const FString Mode = GetJsonStringFieldNav(Payload, TEXT("mode"), TEXT("path")).ToLower();
+    if (Mode != TEXT("path") && Mode != TEXT("test"))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("Unknown mode '%s' (path, test)"), *Mode), nullptr, TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+    Options.bTestOnly = Mode == TEXT("test");
+    Options.bCollectPoints = false;
+    const bool bAllowPartial = GetJsonBoolFieldNav(Payload, TEXT("allowPartial"), false);
+
+    FNavActorLocator Locator(World);
+    TArray<FVector> Sources;
+    TArray<FVector> Targets;
+    if (!ReadNavPointList(Payload, TEXT("sources"), Locator, Sources, Error, ErrorCode) ||
+        !ReadNavPointList(Payload, TEXT("targets"), Locator, Targets, Error, ErrorCode))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, ErrorCode);
+        return true;
+    }
+
+    const int64 NumCells = static_cast<int64>(Sources.Num()) * Targets.Num();
+    if (NumCells > MaxNavQueriesPerRequest)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("Matrix too large (%lld cells, max %d)"), NumCells, MaxNavQueriesPerRequest),
+            nullptr, TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    TArray<TPair<FVector, FVector>> Pairs;
+    Pairs.Reserve(static_cast<int32>(NumCells));
+    for (const FVector& Source : Sources)
+    {
+        for (const FVector& Target : Targets)
+        {
+            Pairs.Emplace(Source, Target);
+        }
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const TArray<FNavQueryResult> Results = RunNavPathQueries(*NavMesh, Pairs, Options);
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+    // Unreachable cells are listed up to this many; the counts are always exact.
+    constexpr int32 MaxListedUnreachable = 100;
+
+    int32 ReachableCount = 0;
+    TArray<TSharedPtr<FJsonValue>> MatrixRows;
+    TArray<TSharedPtr<FJsonValue>> UnreachableList;
+    TArray<TSharedPtr<FJsonValue>> IsolatedSources;
+    for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+    {
+        TArray<TSharedPtr<FJsonValue>> Row;
+        Row.Reserve(Targets.Num());
+        int32 RowReachable = 0;
+        for (int32 TargetIndex = 0; TargetIndex < Targets.Num(); ++TargetIndex)
+        {
+            const FNavQueryResult& Cell = Results[SourceIndex * Targets.Num() + TargetIndex];
+            const bool bReachable = Cell.Status == ENavQueryStatus::Success ||
+                (bAllowPartial && Cell.Status == ENavQueryStatus::Partial);
+            if (bReachable)
+            {
+                ++RowReachable;
+                Row.Add(MakeShared<FJsonValueNumber>(Options.bTestOnly ? 1.0 : RoundNavValue(Cell.Length)));
+                continue;
+            }
+
+            Row.Add(MakeShared<FJsonValueNumber>(Options.bTestOnly ? 0.0 : -1.0));
+            if (UnreachableList.Num() < MaxListedUnreachable)
+            {
+                TSharedPtr<FJsonObject> CellObj = MakeShared<FJsonObject>();
+                CellObj->SetNumberField(TEXT("source"), SourceIndex);
+                CellObj->SetNumberField(TEXT("target"), TargetIndex);
+                CellObj->SetStringField(TEXT("status"), GetNavQueryStatusName(Cell.Status));
+                UnreachableList.Add(MakeShared<FJsonValueObject>(CellObj));
+            }
+        }
+        ReachableCount += RowReachable;
+        if (RowReachable == 0)
+        {
+            IsolatedSources.Add(MakeShared<FJsonValueNumber>(SourceIndex));
+        }
+        MatrixRows.Add(MakeShared<FJsonValueArray>(Row));
+    }
+
+    const int32 UnreachableCount = static_cast<int32>(NumCells) - ReachableCount;
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetStringField(TEXT("mode"), Mode);
+    Result->SetNumberField(TEXT("sources"), Sources.Num());
+    Result->SetNumberField(TEXT("targets"), Targets.Num());
+    Result->SetArrayField(TEXT("matrix"), MatrixRows);
+    Result->SetBoolField(TEXT("allReachable"), UnreachableCount == 0);
+    Result->SetNumberField(TEXT("reachablePairs"), ReachableCount);
+    Result->SetNumberField(TEXT("unreachablePairs"), UnreachableCount);
+    Result->SetArrayField(TEXT("unreachable"), UnreachableList);
+    Result->SetBoolField(TEXT("unreachableTruncated"), UnreachableCount > UnreachableList.Num());
+    Result->SetArrayField(TEXT("isolatedSources"), IsolatedSources);
+    Result->SetNumberField(TEXT("elapsedMs"), ElapsedSeconds * 1000.0);
+    Result->SetNumberField(TEXT("queriesPerSecond"), ElapsedSeconds > 0.0 ? NumCells / ElapsedSeconds : 0.0);
+    Result->SetNumberField(TEXT("workers"), GetNavQueryWorkerCount(Options.bParallel));
+
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("%d of %lld source/target pairs reachable"), ReachableCount, NumCells), Result);
+    return true;
+}
+
+/**
+ * HandleProjectPointsToNavMesh
+ * -----------------------------
+ * Project points onto the navmesh within queryExtent. Misses are null.
+ */
+static bool HandleProjectPointsToNavMesh(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    UWorld* World = nullptr;
+    ARecastNavMesh* NavMesh = ResolveQueryNavMesh(Self, RequestId, Socket, World);
+    if (!NavMesh)
+    {
+        return true;
+    }
+
+    FString Error;
+    FString ErrorCode;
+    FNavQueryOptions Options;
+    FNavActorLocator Locator(World);
+    TArray<FVector> Points;
+    if (!ReadNavQueryOptions(Payload, *NavMesh, Options, Error, ErrorCode) ||
+        !ReadNavPointList(Payload, TEXT("points"), Locator, Points, Error, ErrorCode))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, ErrorCode);
+        return true;
+    }
+    if (Points.Num() > MaxNavQueriesPerRequest)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("Too many points (%d, max %d)"), Points.Num(), MaxNavQueriesPerRequest),
+            nullptr, TEXT("INVALID_ARGUMENT"));
+        return true;
+    }
+
+    TArray<FVector> Projected;
+    TArray<bool> Hits;
+    Projected.SetNumZeroed(Points.Num());
+    Hits.SetNumZeroed(Points.Num());
+
+    const double StartTime = FPlatformTime::Seconds();
+    const int32 NumChunks = (Points.Num() + NavQueryChunkSize - 1) / NavQueryChunkSize;
+    ParallelFor(NumChunks, [&](int32 ChunkIndex)
+    {
+        const int32 Begin = ChunkIndex * NavQueryChunkSize;
+        const int32 End = FMath::Min(Begin + NavQueryChunkSize, Points.Num());
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            FNavLocation Location;
+            Hits[Index] = NavMesh->ProjectPoint(Points[Index], Location, Options.QueryExtent, Options.Filter);
+            Projected[Index] = Location.Location;
+        }
+    }, Options.bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+    const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+
+    int32 HitCount = 0;
+    TArray<TSharedPtr<FJsonValue>> ProjectedArray;
+    TArray<TSharedPtr<FJsonValue>> DistanceArray;
+    for (int32 Index = 0; Index < Points.Num(); ++Index)
+    {
+        if (!Hits[Index])
+        {
+            ProjectedArray.Add(MakeShared<FJsonValueNull>());
+            DistanceArray.Add(MakeShared<FJsonValueNumber>(-1.0));
+            continue;
+        }
+        ++HitCount;
+        TArray<TSharedPtr<FJsonValue>> PointValue;
+        AppendNavPoint(PointValue, Projected[Index]);
+        ProjectedArray.Add(MakeShared<FJsonValueArray>(PointValue));
+        DistanceArray.Add(MakeShared<FJsonValueNumber>(RoundNavValue(FVector::Dist(Points[Index], Projected[Index]))));
+    }
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetArrayField(TEXT("projected"), ProjectedArray);
+    Result->SetArrayField(TEXT("distances"), DistanceArray);
+    Result->SetNumberField(TEXT("hits"), HitCount);
+    Result->SetNumberField(TEXT("misses"), Points.Num() - HitCount);
+    Result->SetNumberField(TEXT("elapsedMs"), ElapsedSeconds * 1000.0);
+    Result->SetNumberField(TEXT("pointsPerSecond"), ElapsedSeconds > 0.0 ? Points.Num() / ElapsedSeconds : 0.0);
+
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("Projected %d of %d points"), HitCount, Points.Num()), Result);
+    return true;
+}
+
+/**
+ * HandleBenchmarkNavigationQueries
+ * ---------------------------------
+ * Path numPaths random navmesh point pairs serially, in parallel, and in
+ * parallel with TestPath, and report paths per second (best of iterations).
+ * The parallel results are checked against the serial ones.
+ */
+static bool HandleBenchmarkNavigationQueries(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    UWorld* World = nullptr;
+    ARecastNavMesh* NavMesh = ResolveQueryNavMesh(Self, RequestId, Socket, World);
+    if (!NavMesh)
+    {
+        return true;
+    }
+
+    FString Error;
+    FString ErrorCode;
+    FNavQueryOptions Options;
+    if (!ReadNavQueryOptions(Payload, *NavMesh, Options, Error, ErrorCode))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, ErrorCode);
+        return true;
+    }
+    Options.bCollectPoints = false;
+    Options.bProjectEndpoints = false;
+
+    const int32 NumPaths = FMath::Clamp(static_cast<int32>(GetJsonNumberFieldNav(Payload, TEXT("numPaths"), 2000)), 1, MaxNavQueriesPerRequest);
+    const int32 Iterations = FMath::Clamp(static_cast<int32>(GetJsonNumberFieldNav(Payload, TEXT("iterations"), 3)), 1, 20);
+
+    // Endpoints are random navmesh points, so every query starts on the mesh.
+    TArray<TPair<FVector, FVector>> Pairs;
+    Pairs.Reserve(NumPaths);
+    for (int32 Attempt = 0; Pairs.Num() < NumPaths && Attempt < NumPaths * 4; ++Attempt)
+    {
+        const FNavLocation Start = NavMesh->GetRandomPoint(Options.Filter);
+        const FNavLocation Goal = NavMesh->GetRandomPoint(Options.Filter);
+        if (Start.HasNodeRef() && Goal.HasNodeRef())
+        {
+            Pairs.Emplace(Start.Location, Goal.Location);
+        }
+    }
+    if (Pairs.Num() == 0)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("NavMesh has no polygons to sample - build navigation first"), nullptr, TEXT("NO_NAVMESH"));
+        return true;
+    }
+
+    auto TimeRuns = [&](bool bParallel, bool bTestOnly, TArray<FNavQueryResult>& OutResults)
+    {
+        FNavQueryOptions RunOptions = Options;
+        RunOptions.bParallel = bParallel;
+        RunOptions.bTestOnly = bTestOnly;
+        double BestSeconds = TNumericLimits<double>::Max();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            const double StartTime = FPlatformTime::Seconds();
+            OutResults = RunNavPathQueries(*NavMesh, Pairs, RunOptions);
+            BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartTime);
+        }
+        return BestSeconds;
+    };
+
+    TArray<FNavQueryResult> SerialResults;
+    TArray<FNavQueryResult> ParallelResults;
+    TArray<FNavQueryResult> TestResults;
+    const double SerialSeconds = TimeRuns(false, false, SerialResults);
+    const double ParallelSeconds = TimeRuns(true, false, ParallelResults);
+    const double TestSeconds = TimeRuns(true, true, TestResults);
+
+    int32 Found = 0;
+    int32 Mismatches = 0;
+    double TotalLength = 0.0;
+    for (int32 Index = 0; Index < Pairs.Num(); ++Index)
+    {
+        const FNavQueryResult& Serial = SerialResults[Index];
+        const FNavQueryResult& Parallel = ParallelResults[Index];
+        if (Serial.Status != Parallel.Status || !FMath::IsNearlyEqual(Serial.Length, Parallel.Length, 0.01))
+        {
+            ++Mismatches;
+        }
+        if (Serial.Status == ENavQueryStatus::Success)
+        {
+            ++Found;
+            TotalLength += Serial.Length;
+        }
+    }
+
+    auto MakeTiming = [&](double Seconds)
+    {
+        TSharedPtr<FJsonObject> Timing = MakeShared<FJsonObject>();
+        Timing->SetNumberField(TEXT("bestMs"), Seconds * 1000.0);
+        Timing->SetNumberField(TEXT("pathsPerSecond"), Seconds > 0.0 ? Pairs.Num() / Seconds : 0.0);
+        return Timing;
+    };
+
+    const FBox Bounds = NavMesh->GetNavMeshBounds();
+    TSharedPtr<FJsonObject> NavMeshInfo = MakeShared<FJsonObject>();
+    NavMeshInfo->SetNumberField(TEXT("tiles"), NavMesh->GetNavMeshTilesCount());
+    NavMeshInfo->SetNumberField(TEXT("sizeX"), RoundNavValue(Bounds.GetSize().X));
+    NavMeshInfo->SetNumberField(TEXT("sizeY"), RoundNavValue(Bounds.GetSize().Y));
+    NavMeshInfo->SetNumberField(TEXT("sizeZ"), RoundNavValue(Bounds.GetSize().Z));
+
+    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+    Result->SetNumberField(TEXT("paths"), Pairs.Num());
+    Result->SetNumberField(TEXT("iterations"), Iterations);
+    Result->SetNumberField(TEXT("workers"), GetNavQueryWorkerCount(true));
+    Result->SetObjectField(TEXT("serial"), MakeTiming(SerialSeconds));
+    Result->SetObjectField(TEXT("parallel"), MakeTiming(ParallelSeconds));
+    Result->SetObjectField(TEXT("parallelTest"), MakeTiming(TestSeconds));
+    Result->SetNumberField(TEXT("speedup"), ParallelSeconds > 0.0 ? SerialSeconds / ParallelSeconds : 0.0);
+    Result->SetNumberField(TEXT("found"), Found);
+    Result->SetNumberField(TEXT("averageLength"), Found > 0 ? RoundNavValue(TotalLength / Found) : 0.0);
+    Result->SetNumberField(TEXT("mismatches"), Mismatches);
+    Result->SetBoolField(TEXT("verified"), Mismatches == 0);
+    Result->SetObjectField(TEXT("navMesh"), NavMeshInfo);
+
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("%.0f paths/s parallel, %.0f paths/s serial"),
+            ParallelSeconds > 0.0 ? Pairs.Num() / ParallelSeconds : 0.0,
+            SerialSeconds > 0.0 ? Pairs.Num() / SerialSeconds : 0.0), Result);
+    return true;
+}
+
+#endif // WITH_EDITOR
+
+// =============================================================================
+// Section 6: Navmesh Build Control
+// =============================================================================
+
+#if WITH_EDITOR
+
+/**
+ * ResolveBuildNavSys - Editor world navigation system, or an error response
+ */
+static UNavigationSystemV1* ResolveBuildNavSys(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("No editor world available"), nullptr, TEXT("NO_WORLD"));
+        return nullptr;
+    }
+    UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+    if (!NavSys)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("Navigation system not available"), nullptr, TEXT("NO_NAV_SYS"));
+        return nullptr;
+    }
+    return NavSys;
+}
+
+/**
+ * HandleBeginNavBatch
+ * --------------------
+ * Pause navmesh building until end_nav_batch (or maxSeconds). Actors placed,
+ * moved or deleted meanwhile only collect dirty areas.
+ */
+static bool HandleBeginNavBatch(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    if (!ResolveBuildNavSys(Self, RequestId, Socket))
+    {
+        return true;
+    }
+    if (McpNavBuildController::IsBenchmarkRunning())
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("A navigation rebuild benchmark is running"), nullptr, TEXT("BUSY"));
+        return true;
+    }
+
+    const double MaxSeconds = FMath::Clamp(GetJsonNumberFieldNav(Payload, TEXT("maxSeconds"), 600.0), 1.0, 3600.0);
+    FString Error;
+    if (!McpNavBuildController::BeginBatch(MaxSeconds, Error))
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, TEXT("NO_NAV_SYS"));
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> Result = McpNavBuildController::GetStatus();
+    Result->SetNumberField(TEXT("maxSeconds"), MaxSeconds);
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("Navmesh building paused for up to %.0f s; call end_nav_batch to rebuild"), MaxSeconds),
+        Result);
+    return true;
+}
+
+/**
+ * HandleEndNavBatch
+ * ------------------
+ * Resume navmesh building. The dirty areas collected while paused are rebuilt
+ * tile by tile; with wait (default) the response is sent once they are done.
+ */
+static bool HandleEndNavBatch(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    if (!ResolveBuildNavSys(Self, RequestId, Socket))
+    {
+        return true;
+    }
+
+    if (GetJsonBoolFieldNav(Payload, TEXT("wait"), true))
+    {
+        RespondAfterNavRebuild(Self, RequestId, Payload, Socket, TEXT("end_nav_batch"));
+        return true;
+    }
+
+    const McpNavBuildController::FRebuildResult Summary = McpNavBuildController::Release(TEXT("end_nav_batch"));
+    TSharedPtr<FJsonObject> Result = McpNavBuildController::RebuildResultToJson(Summary);
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        FString::Printf(TEXT("Navmesh building resumed (%d actor changes, ~%d tiles dirty)"),
+            Summary.DirtyActorChanges, Summary.DirtyTiles), Result);
+    return true;
+}
+
+/**
+ * HandleGetNavBuildStatus
+ * ------------------------
+ * Report pause owners, the dirty bounds collected so far, tile tasks of the
+ * navigation system and lifetime rebuild totals.
+ */
+static bool HandleGetNavBuildStatus(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    TSharedPtr<FJsonObject> Result = McpNavBuildController::GetStatus();
+    Self->SendAutomationResponse(Socket, RequestId, true,
+        McpNavBuildController::IsPaused() ? TEXT("Navmesh building paused") : TEXT("Navmesh building active"),
+        Result);
+    return true;
+}
+
+/**
+ * HandleBenchmarkNavRebuild
+ * --------------------------
+ * Place actorCount cubes in a row twice - rebuilding after every placement,
+ * then paused with one rebuild at the end - and report both rebuild times.
+ * The cubes are deleted afterwards. Responds when the run ends.
+ */
+static bool HandleBenchmarkNavRebuild(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    McpNavBuildController::FBenchmarkSettings Settings;
+    Settings.ActorCount = FMath::Clamp(static_cast<int32>(GetJsonNumberFieldNav(Payload, TEXT("actorCount"), 100.0)), 1, 1000);
+    Settings.Spacing = FMath::Max(GetJsonNumberFieldNav(Payload, TEXT("spacing"), 300.0), 10.0);
+    Settings.ActorScale = FMath::Clamp(GetJsonNumberFieldNav(Payload, TEXT("actorScale"), 2.0), 0.1, 20.0);
+    Settings.TimeoutSeconds = FMath::Clamp(GetJsonNumberFieldNav(Payload, TEXT("timeoutSeconds"), 240.0), 10.0, 240.0);
+    if (Payload.IsValid() && Payload->HasField(TEXT("location")))
+    {
+        Settings.Location = GetJsonVectorFieldNav(Payload, TEXT("location"));
+    }
+
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(Self);
+    const ERequestOrigin Origin = Self->CurrentRequestOrigin;
+    FString Error;
+    FString ErrorCode;
+    const bool bStarted = McpNavBuildController::StartBenchmark(
+        Settings,
+        [WeakSelf, RequestId, Origin](float Percent, const FString& Message)
+        {
+            if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+            {
+                Subsystem->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+            }
+        },
+        [WeakSelf, RequestId, Socket, Origin](bool bSuccess, const FString& Message,
+                                              const TSharedPtr<FJsonObject>& Result, const FString& Code)
+        {
+            if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+            {
+                Subsystem->SendAutomationResponse(Socket, RequestId, bSuccess, Message, Result, Code, Origin);
+            }
+        },
+        Error, ErrorCode);
+    if (!bStarted)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false, Error, nullptr, ErrorCode);
+    }
+    return true;
+}
+
+#endif // WITH_EDITOR
+
+// =============================================================================
+// Section 7: Main Dispatcher
+// =============================================================================
+
+/**
+ * HandleManageNavigationAction
+ * -----------------------------
+ * Main dispatcher for all navigation-related actions.
+ * 
+ * Dispatches to appropriate handlers based on subAction field.
+ * 
+ * Supported subActions:
+ *   - configure_nav_mesh_settings
+ *   - set_nav_agent_properties
+ *   - rebuild_navigation
+ *   - create_nav_modifier_component
+ *   - set_nav_area_class
+ *   - configure_nav_area_cost
+ *   - create_nav_link_proxy
+ *   - configure_nav_link
+ *   - set_nav_link_type
+ *   - create_smart_link
+ *   - configure_smart_link_behavior
+ *   - get_navigation_info
+ *   - find_paths
+ *   - reachability_matrix
+ *   - project_points_to_navmesh
+ *   - benchmark_navigation_queries
+ *   - begin_nav_batch
+ *   - end_nav_batch
+ *   - get_nav_build_status
+ *   - benchmark_nav_rebuild
+ */
+bool UMcpAutomationBridgeSubsystem::HandleManageNavigationAction(
+    const FString& RequestId,
+    const FString& Action,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+#if WITH_EDITOR
+    FString SubAction = GetJsonStringFieldNav(Payload, TEXT("subAction"), TEXT(""));
+
+    UE_LOG(LogMcpNavigationHandlers, Verbose, TEXT("HandleManageNavigationAction: SubAction=%s"), *SubAction);
+
+    // =========================================================================
+    // NavMesh Configuration
+    // =========================================================================
+    if (SubAction == TEXT("configure_nav_mesh_settings"))
+        return HandleConfigureNavMeshSettings(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("set_nav_agent_properties"))
+        return HandleSetNavAgentProperties(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("rebuild_navigation"))
+        return HandleRebuildNavigation(this, RequestId, Payload, Socket);
+
+    // =========================================================================
+    // Nav Modifiers
+    // =========================================================================
+    if (SubAction == TEXT("create_nav_modifier_component"))
+        return HandleCreateNavModifierComponent(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("set_nav_area_class"))
+        return HandleSetNavAreaClass(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("configure_nav_area_cost"))
+        return HandleConfigureNavAreaCost(this, RequestId, Payload, Socket);
+
+    // =========================================================================
+    // Nav Links
+    // =========================================================================
+    if (SubAction == TEXT("create_nav_link_proxy"))
+        return HandleCreateNavLinkProxy(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("configure_nav_link"))
+        return HandleConfigureNavLink(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("set_nav_link_type"))
+        return HandleSetNavLinkType(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("create_smart_link"))
+        return HandleCreateSmartLink(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("configure_smart_link_behavior"))
+        return HandleConfigureSmartLinkBehavior(this, RequestId, Payload, Socket);
+
+    // =========================================================================
+    // Utility
+    // =========================================================================
+    if (SubAction == TEXT("get_navigation_info"))
+        return HandleGetNavigationInfo(this, RequestId, Payload, Socket);
+
+    // =========================================================================
+    // Navigation Queries
+    // =========================================================================
+    // Queries run once the navmesh has rebuilt the tiles dirtied before them.
+    if (SubAction == TEXT("find_paths"))
+        return RunAfterNavRebuild(this, RequestId, Payload, Socket, &HandleFindPaths);
+    if (SubAction == TEXT("reachability_matrix"))
+        return RunAfterNavRebuild(this, RequestId, Payload, Socket, &HandleReachabilityMatrix);
+    if (SubAction == TEXT("project_points_to_navmesh"))
+        return RunAfterNavRebuild(this, RequestId, Payload, Socket, &HandleProjectPointsToNavMesh);
+    if (SubAction == TEXT("benchmark_navigation_queries"))
+        return RunAfterNavRebuild(this, RequestId, Payload, Socket, &HandleBenchmarkNavigationQueries);
+
+    // =========================================================================
+    // Navmesh Build Control
+    // =========================================================================
+    if (SubAction == TEXT("begin_nav_batch"))
+        return HandleBeginNavBatch(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("end_nav_batch"))
+        return HandleEndNavBatch(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("get_nav_build_status"))
+        return HandleGetNavBuildStatus(this, RequestId, Payload, Socket);
+    if (SubAction == TEXT("benchmark_nav_rebuild"))
+        return HandleBenchmarkNavRebuild(this, RequestId, Payload, Socket);
 
     // Unknown action
     SendAutomationResponse(Socket, RequestId, false,
@@ -30,6 +30,10 @@
 //   - configure_gpu_simulation     : Setup GPU simulation
 //   - add_simulation_stage         : Add simulation stage
 //
+// Section 6: Declarative Specs (see McpNiagaraSpec.h)
+//   - apply_niagara_spec           : Diff a full system spec, one compile
+//   - benchmark_niagara_spec       : Time spec apply against incremental edits
+//
 // VERSION COMPATIBILITY:
 // ----------------------
 // UE 5.0: Uses UNiagaraEmitter* directly
@@ -48,6 +52,7 @@
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeGlobals.h"
+#include "McpNiagaraSpec.h"
 
 // Note: FVersionedNiagaraEmitterData and related APIs were introduced in UE 5.1
 // UE 5.0 uses direct emitter pointers, UE 5.1+ uses versioned emitter data
@@ -2227,6 +2232,169 @@ bool UMcpAutomationBridgeSubsystem::HandleManageNiagaraAuthoringAction(
         return true;
     }
 
+    // =========================================================================
+    // 12.6 Declarative Specs (2 actions)
+    // =========================================================================
+
+    if (SubAction == TEXT("apply_niagara_spec"))
+    {
+        if (SystemPath.IsEmpty())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing 'systemPath'."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* SpecObj = nullptr;
+        if (!Payload->TryGetObjectField(TEXT("spec"), SpecObj) || !SpecObj->IsValid())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing 'spec' object."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+
+        // Guard against non-existent assets to prevent LoadObject hangs
+        if (!UEditorAssetLibrary::DoesAssetExist(SystemPath))
+        {
+            SendAutomationError(RequestingSocket, RequestId, FString::Printf(TEXT("Niagara system asset not found: %s"), *SystemPath), TEXT("ASSET_NOT_FOUND"));
+            return true;
+        }
+
+        UNiagaraSystem* System = LoadObject<UNiagaraSystem>(nullptr, *SystemPath);
+        if (!System)
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Could not load Niagara System."), TEXT("ASSET_NOT_FOUND"));
+            return true;
+        }
+
+        // A payload-level prune overrides the spec's
+        TSharedPtr<FJsonObject> Spec = *SpecObj;
+        bool bPrune = false;
+        if (Payload->TryGetBoolField(TEXT("prune"), bPrune))
+        {
+            Spec = MakeShared<FJsonObject>(**SpecObj);
+            Spec->SetBoolField(TEXT("prune"), bPrune);
+        }
+
+        McpNiagaraSpec::FApplyResult Applied;
+        FString Error, ErrorCode;
+        if (!McpNiagaraSpec::Apply(System, Spec, Applied, Error, ErrorCode))
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, ErrorCode.IsEmpty() ? TEXT("INVALID_SPEC") : *ErrorCode);
+            return true;
+        }
+
+        Result->SetObjectField(TEXT("apply"), Applied.ToJson());
+        Result->SetStringField(TEXT("systemPath"), System->GetPathName());
+        McpHandlerUtils::AddVerification(Result, System);
+
+        const bool bWait = GetBoolFieldNiagAuth(Payload, TEXT("wait"), true);
+        if (!bWait)
+        {
+            if (bSave)
+            {
+                McpSafeAssetSave(System);
+            }
+            Result->SetBoolField(TEXT("saved"), bSave);
+            SendAutomationResponse(RequestingSocket, RequestId, true,
+                FString::Printf(TEXT("Niagara spec applied in %.0f ms; compile requested."), Applied.ApplySeconds * 1000.0), Result);
+            return true;
+        }
+
+        // Save once the scripts are compiled so the package holds the results
+        const double TimeoutSeconds = FMath::Clamp(GetNumberFieldNiagAuth(Payload, TEXT("timeoutSeconds"), 240.0), 1.0, 240.0);
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+        const ERequestOrigin Origin = CurrentRequestOrigin;
+        McpNiagaraSpec::WaitForCompile(System, TimeoutSeconds,
+            [WeakSelf, RequestId, Origin](float Percent, const FString& Message)
+            {
+                if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+                {
+                    Subsystem->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+                }
+            },
+            [WeakSelf, RequestId, RequestingSocket, Origin, Result, bSave, ApplyMs = Applied.ApplySeconds * 1000.0](
+                const McpNiagaraSpec::FCompileResult& Compile)
+            {
+                UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get();
+                if (!Subsystem)
+                {
+                    return;
+                }
+                Result->SetObjectField(TEXT("compile"), McpNiagaraSpec::CompileResultToJson(Compile));
+
+                if (Compile.bSystemLost)
+                {
+                    Subsystem->SendAutomationResponse(RequestingSocket, RequestId, false,
+                        TEXT("Niagara system was unloaded while compiling."), Result, TEXT("ASSET_NOT_FOUND"), Origin);
+                    return;
+                }
+
+                UNiagaraSystem* Compiled = LoadObject<UNiagaraSystem>(nullptr, *Compile.SystemPath);
+                const bool bSaved = bSave && Compiled && Compile.bFinished && McpSafeAssetSave(Compiled);
+                Result->SetBoolField(TEXT("saved"), bSaved);
+
+                if (!Compile.bFinished)
+                {
+                    Subsystem->SendAutomationResponse(RequestingSocket, RequestId, false,
+                        TEXT("Niagara spec applied; scripts did not finish compiling in time."), Result, TEXT("TIMEOUT"), Origin);
+                }
+                else if (Compile.Errors.Num() > 0)
+                {
+                    Subsystem->SendAutomationResponse(RequestingSocket, RequestId, false,
+                        FString::Printf(TEXT("Niagara spec applied; %d script compile error(s)."), Compile.Errors.Num()),
+                        Result, TEXT("NIAGARA_COMPILE_ERROR"), Origin);
+                }
+                else
+                {
+                    Subsystem->SendAutomationResponse(RequestingSocket, RequestId, true,
+                        FString::Printf(TEXT("Niagara spec applied in %.0f ms; scripts %.0f ms, GPU shaders %.0f ms."),
+                            ApplyMs, Compile.ScriptSeconds * 1000.0, Compile.GpuShaderSeconds * 1000.0),
+                        Result, FString(), Origin);
+                }
+            });
+        return true;
+    }
+
+    if (SubAction == TEXT("benchmark_niagara_spec"))
+    {
+        McpNiagaraSpec::FBenchmarkSettings Settings;
+        Settings.TemplateSystemPath = SystemPath;
+        Settings.SourceEmitterPath = GetStringFieldNiagAuth(Payload, TEXT("sourceEmitter"));
+        Settings.EmitterCount = static_cast<int32>(GetNumberFieldNiagAuth(Payload, TEXT("emitterCount"), 3.0));
+        Settings.ModulesPerEmitter = static_cast<int32>(GetNumberFieldNiagAuth(Payload, TEXT("modulesPerEmitter"), 10.0));
+        Settings.TimeoutSeconds = FMath::Clamp(GetNumberFieldNiagAuth(Payload, TEXT("timeoutSeconds"), 240.0), 10.0, 240.0);
+        if (Settings.TemplateSystemPath.IsEmpty() || Settings.SourceEmitterPath.IsEmpty())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing 'systemPath' (template system) or 'sourceEmitter'."), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+        const ERequestOrigin Origin = CurrentRequestOrigin;
+        FString Error, ErrorCode;
+        const bool bStarted = McpNiagaraSpec::StartBenchmark(Settings,
+            [WeakSelf, RequestId, Origin](float Percent, const FString& Message)
+            {
+                if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+                {
+                    Subsystem->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+                }
+            },
+            [WeakSelf, RequestId, RequestingSocket, Origin](bool bSuccess, const FString& Message,
+                                                           const TSharedPtr<FJsonObject>& BenchResult, const FString& BenchErrorCode)
+            {
+                if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+                {
+                    Subsystem->SendAutomationResponse(RequestingSocket, RequestId, bSuccess, Message, BenchResult, BenchErrorCode, Origin);
+                }
+            },
+            Error, ErrorCode);
+        if (!bStarted)
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, ErrorCode);
+        }
+        return true;
+    }
+
     // Unknown subAction
     SendAutomationError(RequestingSocket, RequestId, FString::Printf(TEXT("Unknown subAction: %s"), *SubAction), TEXT("INVALID_SUBACTION"));
     return true;
@@ -6,12 +6,14 @@
 // HANDLERS IMPLEMENTED:
 // ---------------------
 // Performance Profiling:
-//   - generate_memory_report: Generate memory report via memreport command
+//   - generate_memory_report: Capture a structured memory snapshot (JSON)
+//   - diff_memory_reports: Rank memory growth between two snapshots
 //   - start_profiling: Start stats capture (stat startfile)
 //   - stop_profiling: Stop stats capture (stat stopfile)
 //   - show_fps: Toggle FPS display
 //   - show_stats: Toggle stat category display
-//   - run_benchmark: Start performance benchmark
+//   - run_benchmark: Sample frame/game/render/GPU times and compare to a baseline
+//   - get_request_profile: Per-phase timing of recent automation requests
 //   - enable_gpu_timing: Enable/disable GPU timing stats
 //
 // Rendering Optimization:
@@ -53,6 +55,9 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpHandlerUtils.h"
 #include "McpAutomationBridgeHelpers.h"
+#include "McpBenchmark.h"
+#include "McpMemoryReport.h"
+#include "McpRequestProfiler.h"
 #include "McpAutomationBridgeSubsystem.h"
 #include "Dom/JsonObject.h"
 
@@ -101,6 +106,7 @@ bool UMcpAutomationBridgeSubsystem::HandlePerformanceAction(
     TSharedPtr<FMcpBridgeWebSocket> RequestingSocket) {
   const FString Lower = Action.ToLower();
   if (!Lower.StartsWith(TEXT("generate_memory_report")) &&
+      !Lower.StartsWith(TEXT("diff_memory_reports")) &&
       !Lower.StartsWith(TEXT("configure_texture_streaming")) &&
       !Lower.StartsWith(TEXT("merge_actors")) &&
       !Lower.StartsWith(TEXT("start_profiling")) &&
@@ -114,6 +120,7 @@ bool UMcpAutomationBridgeSubsystem::HandlePerformanceAction(
       !Lower.StartsWith(TEXT("configure_nanite")) &&
       !Lower.StartsWith(TEXT("configure_lod")) &&
       !Lower.StartsWith(TEXT("run_benchmark")) &&
+      !Lower.StartsWith(TEXT("get_request_profile")) &&
       !Lower.StartsWith(TEXT("enable_gpu_timing")) &&
       !Lower.StartsWith(TEXT("apply_baseline_settings")) &&
       !Lower.StartsWith(TEXT("optimize_draw_calls")) &&
@@ -132,31 +139,135 @@ bool UMcpAutomationBridgeSubsystem::HandlePerformanceAction(
   }
 
   // ===========================================================================
-  // generate_memory_report - Generate memory report
+  // generate_memory_report - Capture a structured memory snapshot
   // ===========================================================================
   if (Lower == TEXT("generate_memory_report")) {
     bool bDetailed = false;
     Payload->TryGetBoolField(TEXT("detailed"), bDetailed);
 
+    McpMemoryReport::FCaptureOptions Options;
+    Options.bWriteRawText = bDetailed;
+    Payload->TryGetStringField(TEXT("label"), Options.Label);
+
+    const TArray<TSharedPtr<FJsonValue>> *Include = nullptr;
+    if (Payload->TryGetArrayField(TEXT("include"), Include) && Include->Num() > 0) {
+      TSet<FString> Sections;
+      for (const TSharedPtr<FJsonValue> &Value : *Include) {
+        Sections.Add(Value.IsValid() ? Value->AsString().ToLower() : FString());
+      }
+      Options.bObjects = Sections.Contains(TEXT("objects"));
+      Options.bTextures = Sections.Contains(TEXT("textures"));
+      Options.bLLM = Sections.Contains(TEXT("llm"));
+    }
+
+    // outputPath is project-relative: "*.json" names the file, anything else
+    // is a folder that receives <snapshotId>.json.
     FString OutputPath;
-    Payload->TryGetStringField(TEXT("outputPath"), OutputPath);
+    FString OutputFile;
+    if (Payload->TryGetStringField(TEXT("outputPath"), OutputPath) &&
+        !OutputPath.IsEmpty()) {
+      const FString Sanitized = SanitizeProjectFilePath(OutputPath);
+      if (Sanitized.IsEmpty()) {
+        SendAutomationError(RequestingSocket, RequestId,
+                            FString::Printf(TEXT("Invalid outputPath: %s"), *OutputPath),
+                            TEXT("INVALID_ARGUMENT"));
+        return true;
+      }
+      OutputFile = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / Sanitized);
+    }
 
-    // Execute memreport command
-    FString Cmd = bDetailed ? TEXT("memreport -full") : TEXT("memreport");
-    if (!GEditor)
-    {
-        SendAutomationError(RequestingSocket, RequestId, TEXT("Editor not available"), TEXT("NO_EDITOR"));
+    double TopClasses = bDetailed ? TNumericLimits<int32>::Max() : 50.0;
+    Payload->TryGetNumberField(TEXT("topClasses"), TopClasses);
+
+    FString FilePath;
+    const TSharedPtr<FJsonObject> Snapshot = McpMemoryReport::Capture(Options, FilePath);
+
+    if (!OutputFile.IsEmpty()) {
+      if (!OutputFile.EndsWith(TEXT(".json"), ESearchCase::IgnoreCase)) {
+        OutputFile /= Snapshot->GetStringField(TEXT("snapshotId")) + TEXT(".json");
+      }
+      FString WriteError;
+      if (!McpMemoryReport::WriteSnapshot(Snapshot, OutputFile, WriteError)) {
+        SendAutomationError(RequestingSocket, RequestId, WriteError,
+                            TEXT("WRITE_FAILED"));
         return true;
+      }
+      FilePath = OutputFile;
     }
 
-    GEngine->Exec(GEditor->GetEditorWorldContext().World(), *Cmd);
+    TSharedPtr<FJsonObject> Result = McpMemoryReport::Summarize(
+        Snapshot, FMath::Clamp(static_cast<int32>(TopClasses), 0, TNumericLimits<int32>::Max()));
+    Result->SetStringField(TEXT("filePath"), FilePath);
+    SendAutomationResponse(
+        RequestingSocket, RequestId, true,
+        FString::Printf(TEXT("Memory snapshot %s captured"),
+                        *Snapshot->GetStringField(TEXT("snapshotId"))),
+        Result);
+    return true;
+  }
+  // ===========================================================================
+  // diff_memory_reports - Rank growth between two memory snapshots
+  // ===========================================================================
+  else if (Lower == TEXT("diff_memory_reports")) {
+    // A snapshot reference is a snapshot id or a project-relative .json path.
+    auto Resolve = [](const FString &Reference, FString &OutError) -> TSharedPtr<FJsonObject> {
+      if (McpMemoryReport::IsSnapshotId(Reference)) {
+        TSharedPtr<FJsonObject> Snapshot = McpMemoryReport::FindSnapshot(Reference);
+        if (!Snapshot.IsValid()) {
+          OutError = FString::Printf(TEXT("Memory snapshot not found: %s"), *Reference);
+        }
+        return Snapshot;
+      }
+      const FString Sanitized = SanitizeProjectFilePath(Reference);
+      if (Sanitized.IsEmpty()) {
+        OutError = FString::Printf(TEXT("Invalid snapshot path: %s"), *Reference);
+        return nullptr;
+      }
+      return McpMemoryReport::LoadSnapshotFile(
+          FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / Sanitized), OutError);
+    };
+
+    FString BaselineRef;
+    if (!Payload->TryGetStringField(TEXT("baseline"), BaselineRef) || BaselineRef.IsEmpty()) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          TEXT("baseline (snapshot id or .json path) is required"),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
 
-    // If output path provided, we might want to move the log file, but
-    // memreport writes to a specific location. For now, just acknowledge
-    // execution.
+    FString Error;
+    const TSharedPtr<FJsonObject> Baseline = Resolve(BaselineRef, Error);
+    if (!Baseline.IsValid()) {
+      SendAutomationError(RequestingSocket, RequestId, Error, TEXT("NOT_FOUND"));
+      return true;
+    }
 
-    SendAutomationResponse(RequestingSocket, RequestId, true,
-                           TEXT("Memory report generated"), nullptr);
+    // Without "current" the comparison is against a fresh capture.
+    FString CurrentRef;
+    TSharedPtr<FJsonObject> Current;
+    if (Payload->TryGetStringField(TEXT("current"), CurrentRef) && !CurrentRef.IsEmpty()) {
+      Current = Resolve(CurrentRef, Error);
+      if (!Current.IsValid()) {
+        SendAutomationError(RequestingSocket, RequestId, Error, TEXT("NOT_FOUND"));
+        return true;
+      }
+    } else {
+      McpMemoryReport::FCaptureOptions Options;
+      Payload->TryGetStringField(TEXT("label"), Options.Label);
+      FString Ignored;
+      Current = McpMemoryReport::Capture(Options, Ignored);
+    }
+
+    double Limit = 25.0;
+    Payload->TryGetNumberField(TEXT("limit"), Limit);
+    TSharedPtr<FJsonObject> Result = McpMemoryReport::Diff(
+        Baseline, Current, FMath::Clamp(static_cast<int32>(Limit), 1, 500));
+    SendAutomationResponse(
+        RequestingSocket, RequestId, true,
+        FString::Printf(TEXT("Compared memory snapshots %s -> %s"),
+                        *Result->GetStringField(TEXT("baselineId")),
+                        *Result->GetStringField(TEXT("currentId"))),
+        Result);
     return true;
   }
   // ===========================================================================
@@ -586,32 +697,106 @@ bool UMcpAutomationBridgeSubsystem::HandlePerformanceAction(
   // run_benchmark - Start performance benchmark
   // ===========================================================================
   else if (Lower == TEXT("run_benchmark")) {
-    double Duration = 60.0;
-    Payload->TryGetNumberField(TEXT("duration"), Duration);
+    McpBenchmark::FSettings Settings;
+    Payload->TryGetStringField(TEXT("label"), Settings.Label);
+    Payload->TryGetStringField(TEXT("sequencePath"), Settings.SequencePath);
 
-    FString BenchmarkType = TEXT("all");
-    Payload->TryGetStringField(TEXT("type"), BenchmarkType);
+    double Duration = 10.0;
+    Payload->TryGetNumberField(TEXT("duration"), Duration);
+    Settings.DurationSeconds = FMath::Clamp(Duration, 1.0, McpBenchmark::MaxDurationSeconds);
+    if (!Payload->TryGetNumberField(TEXT("warmupSeconds"), Settings.WarmupSeconds)) {
+      Payload->TryGetNumberField(TEXT("warmup"), Settings.WarmupSeconds);
+    }
+    Settings.WarmupSeconds = FMath::Clamp(Settings.WarmupSeconds, 0.0, 30.0);
+    Payload->TryGetNumberField(TEXT("hitchThresholdMs"), Settings.HitchThresholdMs);
+    Settings.HitchThresholdMs = FMath::Max(Settings.HitchThresholdMs, 1.0);
+    Payload->TryGetNumberField(TEXT("regressionThresholdPct"), Settings.RegressionThresholdPct);
+
+    const TArray<TSharedPtr<FJsonValue>> *CameraPath = nullptr;
+    if (Payload->TryGetArrayField(TEXT("cameraPath"), CameraPath)) {
+      for (const TSharedPtr<FJsonValue> &Value : *CameraPath) {
+        const TSharedPtr<FJsonObject> *KeyObject = nullptr;
+        if (!Value.IsValid() || !Value->TryGetObject(KeyObject)) {
+          SendAutomationError(RequestingSocket, RequestId,
+                              TEXT("cameraPath entries must be objects with location and rotation"),
+                              TEXT("INVALID_ARGUMENT"));
+          return true;
+        }
+        McpBenchmark::FCameraKey Key;
+        ReadVectorField(*KeyObject, TEXT("location"), Key.Location, FVector::ZeroVector);
+        ReadRotatorField(*KeyObject, TEXT("rotation"), Key.Rotation, FRotator::ZeroRotator);
+        Settings.CameraPath.Add(Key);
+      }
+    }
 
-    // Start profiling for benchmark
-    if (!GEditor)
-    {
-        SendAutomationError(RequestingSocket, RequestId, TEXT("Editor not available"), TEXT("NO_EDITOR"));
+    // baseline: id of an earlier run or a project-relative result .json
+    FString BaselineRef;
+    if (Payload->TryGetStringField(TEXT("baseline"), BaselineRef) && !BaselineRef.IsEmpty()) {
+      FString BaselineError = FString::Printf(TEXT("Benchmark result not found: %s"), *BaselineRef);
+      if (BaselineRef.EndsWith(TEXT(".json"), ESearchCase::IgnoreCase)) {
+        const FString Sanitized = SanitizeProjectFilePath(BaselineRef);
+        if (!Sanitized.IsEmpty()) {
+          Settings.Baseline = McpBenchmark::LoadResultFile(
+              FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / Sanitized), BaselineError);
+        }
+      } else {
+        Settings.Baseline = McpBenchmark::FindResult(BaselineRef);
+      }
+      if (!Settings.Baseline.IsValid()) {
+        SendAutomationError(RequestingSocket, RequestId, BaselineError, TEXT("NOT_FOUND"));
         return true;
+      }
     }
 
-    GEngine->Exec(GEditor->GetEditorWorldContext().World(),
-                  TEXT("stat startfile"));
-
-    TSharedPtr<FJsonObject> Resp = McpHandlerUtils::CreateResultObject();
-    Resp->SetNumberField(TEXT("duration"), Duration);
-    Resp->SetStringField(TEXT("type"), BenchmarkType);
-    Resp->SetStringField(TEXT("status"), TEXT("started"));
+    // Respond when sampling ends; elapsed time streams as progress updates
+    TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakThis(this);
+    const ERequestOrigin Origin = CurrentRequestOrigin;
+    FString Error;
+    FString ErrorCode;
+    const FString BenchmarkId = McpBenchmark::Start(
+        Settings,
+        [WeakThis, RequestId, Origin](float Percent, const FString &Message) {
+          if (UMcpAutomationBridgeSubsystem *Self = WeakThis.Get()) {
+            Self->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+          }
+        },
+        [WeakThis, RequestId, RequestingSocket, Origin](
+            bool bSuccess, const FString &Message, const TSharedPtr<FJsonObject> &Result,
+            const FString &Code) {
+          if (UMcpAutomationBridgeSubsystem *Self = WeakThis.Get()) {
+            Self->SendAutomationResponse(RequestingSocket, RequestId, bSuccess, Message,
+                                         Result, Code, Origin);
+          }
+        },
+        Error, ErrorCode);
+    if (BenchmarkId.IsEmpty()) {
+      SendAutomationError(RequestingSocket, RequestId, Error, ErrorCode);
+    }
+    return true;
+  }
+  // ===========================================================================
+  // get_request_profile - Per-phase breakdown of recent automation requests
+  // ===========================================================================
+  else if (Lower == TEXT("get_request_profile")) {
+    double Limit = 20.0;
+    Payload->TryGetNumberField(TEXT("limit"), Limit);
+    FString ActionFilter;
+    Payload->TryGetStringField(TEXT("actionFilter"), ActionFilter);
+    bool bReset = false;
+    Payload->TryGetBoolField(TEXT("reset"), bReset);
+
+    TSharedPtr<FJsonObject> Result = McpRequestProfiler::GetProfile(
+        static_cast<int32>(Limit), ActionFilter);
+    if (bReset) {
+      McpRequestProfiler::Reset();
+    }
+    Result->SetBoolField(TEXT("reset"), bReset);
 
     SendAutomationResponse(
         RequestingSocket, RequestId, true,
-        FString::Printf(TEXT("Benchmark started (type: %s, duration: %.0fs)"),
-                        *BenchmarkType, Duration),
-        Resp);
+        FString::Printf(TEXT("Profile of %d recent requests"),
+                        static_cast<int32>(Result->GetNumberField(TEXT("count")))),
+        Result);
     return true;
   }
   // ===========================================================================
@@ -8,16 +8,17 @@
 // Handler Summary:
 // -----------------------------------------------------------------------------
 // Action: manage_pipeline
-//   - run_ubt: Launch UnrealBuildTool process with target/platform/config
+//   - run_ubt: Start a background UBT job (see McpBuildJobs)
+//   - get_ubt_job / cancel_ubt_job / list_ubt_jobs: Inspect or stop UBT jobs
 //   - list_categories: Return all available automation tool categories
 //   - get_status: Return automation bridge status and version info
 // 
 // Dependencies:
 //   - Core: McpAutomationBridgeSubsystem, McpAutomationBridgeHelpers
-//   - Engine: PlatformProcess, Paths, EngineVersion, App
+//   - Engine: Paths, EngineVersion, App
 // 
 // Notes:
-//   - UBT spawns as detached process; results logged separately
+//   - UBT runs on a worker thread; poll get_ubt_job for output and diagnostics
 //   - Status includes engine version, platform, PIE state, project name
 // =============================================================================
 
@@ -35,7 +36,6 @@
 // Engine Includes
 // -----------------------------------------------------------------------------
 #include "Dom/JsonObject.h"
-#include "HAL/PlatformProcess.h"
 #include "Misc/Paths.h"
 #include "Misc/EngineVersion.h"
 #include "Misc/App.h"
@@ -70,62 +70,13 @@ bool UMcpAutomationBridgeSubsystem::HandlePipelineAction(
     const FString SubAction = GetJsonStringField(Payload, TEXT("subAction"));
 
     // -------------------------------------------------------------------------
-    // run_ubt: Launch UnrealBuildTool process
+    // run_ubt / get_ubt_job / cancel_ubt_job / list_ubt_jobs: background UBT
+    // jobs. run_ubt returns the job id immediately unless wait=true.
     // -------------------------------------------------------------------------
-    if (SubAction == TEXT("run_ubt"))
+    if (SubAction == TEXT("run_ubt") || SubAction == TEXT("get_ubt_job") ||
+        SubAction == TEXT("cancel_ubt_job") || SubAction == TEXT("list_ubt_jobs"))
     {
-        FString Target;
-        Payload->TryGetStringField(TEXT("target"), Target);
-        
-        FString Platform;
-        Payload->TryGetStringField(TEXT("platform"), Platform);
-        
-        FString Configuration;
-        Payload->TryGetStringField(TEXT("configuration"), Configuration);
-        
-        FString ExtraArgs;
-        Payload->TryGetStringField(TEXT("extraArgs"), ExtraArgs);
-
-        // Construct UBT executable path
-        // Location: Engine/Binaries/DotNET/UnrealBuildTool/UnrealBuildTool.exe
-        const FString UBTPath = FPaths::ConvertRelativePathToFull(
-            FPaths::EngineDir() / TEXT("Binaries/DotNET/UnrealBuildTool/UnrealBuildTool.exe"));
-        
-        // Build command line
-        const FString Params = FString::Printf(TEXT("%s %s %s %s"), 
-            *Target, *Platform, *Configuration, *ExtraArgs);
-
-        // Spawn UBT as detached process
-        FProcHandle ProcHandle = FPlatformProcess::CreateProc(
-            *UBTPath,
-            *Params,
-            true,    // bLaunchDetached
-            false,   // bLaunchHidden
-            false,   // bLaunchReallyHidden
-            nullptr, // ProcessID
-            0,       // PriorityModifier
-            nullptr, // OptionalWorkingDirectory
-            nullptr  // PipeWriteChild
-        );
-
-        if (ProcHandle.IsValid())
-        {
-            TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-            Result->SetStringField(TEXT("action"), TEXT("run_ubt"));
-            Result->SetStringField(TEXT("target"), Target);
-            Result->SetStringField(TEXT("platform"), Platform);
-            Result->SetStringField(TEXT("configuration"), Configuration);
-            Result->SetBoolField(TEXT("processStarted"), true);
-
-            SendAutomationResponse(RequestingSocket, RequestId, true, 
-                TEXT("UBT process started."), Result);
-        }
-        else
-        {
-            SendAutomationError(RequestingSocket, RequestId, 
-                TEXT("Failed to launch UBT."), TEXT("LAUNCH_FAILED"));
-        }
-        return true;
+        return HandleUbtJobAction(RequestId, SubAction, Payload, RequestingSocket, false);
     }
 
     // -------------------------------------------------------------------------
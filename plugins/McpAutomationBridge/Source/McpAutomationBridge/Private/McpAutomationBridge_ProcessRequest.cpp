@@ -4,7 +4,11 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpCompileScheduler.h"
 #include "McpConnectionManager.h"
+#include "McpNavBuildController.h"
+#include "McpRequestProfiler.h"
+#include "McpSaveCoordinator.h"
 #include "Misc/ScopeExit.h"
 #include "Misc/ScopeLock.h"
 
@@ -109,15 +113,21 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
 
   bProcessingAutomationRequest = true;
   CurrentRequestOrigin = Origin;
+  McpSaveCoordinator::NoteRequestActivity(RequestId);
   bool bDispatchHandled = false;
   FString ConsumedHandlerLabel = TEXT("unknown-handler");
   const double DispatchStartSeconds = FPlatformTime::Seconds();
 
   auto HandleAndLog = [&](const TCHAR *HandlerLabel, auto &&Callable) -> bool {
+    // Handlers that decline the request count as dispatch time
+    McpRequestProfiler::FPhaseScope HandlerPhase(
+        McpRequestProfiler::EPhase::Dispatch, HandlerLabel);
     const bool bResult = Callable();
     if (bResult) {
       bDispatchHandled = true;
       ConsumedHandlerLabel = HandlerLabel;
+      HandlerPhase.SetPhase(McpRequestProfiler::EPhase::Handler);
+      McpRequestProfiler::SetHandler(RequestId, HandlerLabel);
     }
     return bResult;
   };
@@ -146,6 +156,7 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
       
       bProcessingAutomationRequest = false;
       CurrentRequestOrigin = ERequestOrigin::WebSocket;
+      McpSaveCoordinator::NoteRequestFinished();
       const double DispatchEndSeconds = FPlatformTime::Seconds();
       const double DurationMs =
           (DispatchEndSeconds - DispatchStartSeconds) * 1000.0;
@@ -168,6 +179,38 @@ void UMcpAutomationBridgeSubsystem::ProcessAutomationRequest(
       }
     };
 
+    // Phase timing and trace scopes for this request. Declared after
+    // ON_SCOPE_EXIT so queued requests drained there are not charged to it.
+    McpRequestProfiler::FScopedRequest ProfileScope(RequestId, Action);
+    McpRequestProfiler::FPhaseScope DispatchPhase(
+        McpRequestProfiler::EPhase::Dispatch);
+
+    // flushSaves=true: write everything queued so far and save this request's
+    // assets immediately, so they are on disk before the response goes out.
+    // Declared after ON_SCOPE_EXIT so deferral resumes before queued requests
+    // are drained.
+    bool bFlushSaves = false;
+    if (Payload.IsValid()) {
+      Payload->TryGetBoolField(TEXT("flushSaves"), bFlushSaves);
+    }
+    TOptional<McpSaveCoordinator::FScopedImmediateSaves> ImmediateSaves;
+    if (bFlushSaves) {
+      McpSaveCoordinator::Flush(TEXT("request"));
+      ImmediateSaves.Emplace();
+    }
+
+    // Blueprint edits defer their compile; anything that may read a
+    // generated class first compiles the Blueprints it depends on.
+    McpCompileScheduler::FScopedRequest CompileScope(
+        bFlushSaves ? McpCompileScheduler::ERequestKind::Other
+                    : McpCompileScheduler::ClassifyRequest(Action, Payload));
+
+    // Placements pause navmesh building until the bridge goes idle; requests
+    // that read navigation release the pause, and the navigation queries
+    // wait for the dirty tiles to rebuild before running.
+    McpNavBuildController::FScopedRequest NavBuildScope(
+        McpNavBuildController::ClassifyRequest(Action, Payload));
+
     try {
       // =========================================================================
       // Begin Error Capture for this request (inside try block)
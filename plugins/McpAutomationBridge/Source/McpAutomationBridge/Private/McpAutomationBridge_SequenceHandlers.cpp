@@ -20,6 +20,8 @@
 //   - remove_key                   : Remove keyframe
 //   - set_key_time                 : Move keyframe to new time
 //   - set_key_value                : Set keyframe value
+//   - set_keys                     : Bulk keys per channel in one transaction,
+//                                    with interpolation and key reduction
 //
 // Section 4: Binding
 //   - add_binding                  : Add object binding
@@ -50,6 +52,7 @@
 #include "MovieSceneSequence.h"
 #include "MovieSceneTrack.h"
 #include "UObject/UObjectIterator.h"
+#include "Algo/StableSort.h"
 
 // UE 5.0 compatibility: GetTracks() was introduced in UE 5.1, use GetMasterTracks() in 5.0
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
@@ -1874,6 +1877,557 @@ bool UMcpAutomationBridgeSubsystem::HandleSequenceAddKeyframe(
 #endif
 }
 
+#if WITH_EDITOR
+// -----------------------------------------------------------------------------
+// sequence_set_keys helpers
+// -----------------------------------------------------------------------------
+
+/** Resolve a binding from its GUID string or a possessable/spawnable name. */
+static FGuid FindSequenceBindingGuid(UMovieScene *MovieScene,
+                                     const FString &BindingIdStr,
+                                     const FString &ActorName) {
+  FGuid BindingGuid;
+  if (!BindingIdStr.IsEmpty()) {
+    FGuid::Parse(BindingIdStr, BindingGuid);
+    return BindingGuid;
+  }
+  for (const FMovieSceneBinding &Binding :
+       const_cast<const UMovieScene *>(MovieScene)->GetBindings()) {
+    FString BindingName;
+    if (FMovieScenePossessable *Possessable =
+            MovieScene->FindPossessable(Binding.GetObjectGuid())) {
+      BindingName = Possessable->GetName();
+    } else if (FMovieSceneSpawnable *Spawnable =
+                   MovieScene->FindSpawnable(Binding.GetObjectGuid())) {
+      BindingName = Spawnable->GetName();
+    }
+    if (BindingName.Equals(ActorName, ESearchCase::IgnoreCase)) {
+      return Binding.GetObjectGuid();
+    }
+  }
+  return BindingGuid;
+}
+
+/**
+ * Map "location.x" / "rotation.yaw" / "scale.z" to the channel index of a
+ * UMovieScene3DTransformSection (location 0-2, rotation roll/pitch/yaw 3-5,
+ * scale 6-8). Returns INDEX_NONE for unknown names.
+ */
+static int32 ResolveTransformChannelIndex(const FString &ChannelName) {
+  FString Group, Axis;
+  if (!ChannelName.ToLower().Split(TEXT("."), &Group, &Axis)) {
+    return INDEX_NONE;
+  }
+  int32 Base = INDEX_NONE;
+  if (Group == TEXT("location") || Group == TEXT("translation")) {
+    Base = 0;
+  } else if (Group == TEXT("rotation")) {
+    Base = 3;
+  } else if (Group == TEXT("scale")) {
+    Base = 6;
+  }
+  if (Base == INDEX_NONE) {
+    return INDEX_NONE;
+  }
+  if (Axis == TEXT("x") || Axis == TEXT("roll")) {
+    return Base;
+  }
+  if (Axis == TEXT("y") || Axis == TEXT("pitch")) {
+    return Base + 1;
+  }
+  if (Axis == TEXT("z") || Axis == TEXT("yaw")) {
+    return Base + 2;
+  }
+  return INDEX_NONE;
+}
+
+static bool ParseSequenceInterpolation(const FString &Name,
+                                       ERichCurveInterpMode &OutMode) {
+  const FString Lower = Name.ToLower();
+  if (Lower.IsEmpty() || Lower == TEXT("cubic") || Lower == TEXT("auto")) {
+    OutMode = RCIM_Cubic;
+  } else if (Lower == TEXT("linear")) {
+    OutMode = RCIM_Linear;
+  } else if (Lower == TEXT("constant") || Lower == TEXT("step")) {
+    OutMode = RCIM_Constant;
+  } else {
+    return false;
+  }
+  return true;
+}
+
+static const TCHAR *SequenceInterpolationName(ERichCurveInterpMode Mode) {
+  switch (Mode) {
+  case RCIM_Linear:
+    return TEXT("linear");
+  case RCIM_Constant:
+    return TEXT("constant");
+  default:
+    return TEXT("cubic");
+  }
+}
+
+/**
+ * Key reduction for dense input. Linear and cubic curves use
+ * Ramer-Douglas-Peucker: a key is dropped when its value lies within
+ * Tolerance of the line between the kept keys around it. Constant curves drop
+ * keys that do not change the held value by more than Tolerance. Returns one
+ * keep flag per key.
+ */
+static TArray<bool> SimplifySequenceKeys(const TArray<FFrameNumber> &Times,
+                                         const TArray<double> &Values,
+                                         ERichCurveInterpMode Mode,
+                                         double Tolerance) {
+  const int32 Num = Times.Num();
+  TArray<bool> Keep;
+  if (Num <= 2 || Tolerance <= 0.0) {
+    Keep.Init(true, Num);
+    return Keep;
+  }
+  Keep.Init(false, Num);
+  Keep[0] = true;
+
+  if (Mode == RCIM_Constant) {
+    double Held = Values[0];
+    for (int32 Index = 1; Index < Num; ++Index) {
+      if (FMath::Abs(Values[Index] - Held) > Tolerance) {
+        Keep[Index] = true;
+        Held = Values[Index];
+      }
+    }
+    return Keep;
+  }
+
+  Keep[Num - 1] = true;
+  TArray<TPair<int32, int32>> Spans;
+  Spans.Emplace(0, Num - 1);
+  while (Spans.Num() > 0) {
+    const TPair<int32, int32> Span = Spans.Pop();
+    const double T0 = Times[Span.Key].Value;
+    const double T1 = Times[Span.Value].Value;
+    const double V0 = Values[Span.Key];
+    const double V1 = Values[Span.Value];
+
+    double MaxError = 0.0;
+    int32 MaxIndex = INDEX_NONE;
+    for (int32 Index = Span.Key + 1; Index < Span.Value; ++Index) {
+      const double Alpha =
+          T1 > T0 ? (Times[Index].Value - T0) / (T1 - T0) : 0.0;
+      const double Error =
+          FMath::Abs(Values[Index] - FMath::Lerp(V0, V1, Alpha));
+      if (Error > MaxError) {
+        MaxError = Error;
+        MaxIndex = Index;
+      }
+    }
+    if (MaxIndex != INDEX_NONE && MaxError > Tolerance) {
+      Keep[MaxIndex] = true;
+      Spans.Emplace(Span.Key, MaxIndex);
+      Spans.Emplace(MaxIndex, Span.Value);
+    }
+  }
+  return Keep;
+}
+
+/** Keys parsed for one channel, sorted by tick and ready to write. */
+struct FSequenceChannelKeys {
+  FString Name;
+  int32 ChannelIndex = 0;
+  ERichCurveInterpMode InterpMode = RCIM_Cubic;
+  int32 KeysIn = 0;
+  TArray<FFrameNumber> Times;
+  TArray<double> Values;
+};
+
+/**
+ * Merge new keys into a float or double channel in one Set() call. Existing
+ * keys on the same tick are replaced; with bReplaceRange every existing key
+ * between the first and last new key is removed. Auto tangents are
+ * recomputed once at the end.
+ */
+template <typename ChannelType, typename ValueType>
+static void WriteSequenceChannelKeys(ChannelType *Channel,
+                                     const FSequenceChannelKeys &Keys,
+                                     bool bReplaceRange, int32 &OutReplaced,
+                                     int32 &OutRemoved) {
+  using FKeyScalar = decltype(ValueType::Value);
+
+  TMovieSceneChannelData<ValueType> Data = Channel->GetData();
+  const TArrayView<const FFrameNumber> OldTimes = Data.GetTimes();
+  const TArrayView<ValueType> OldValues = Data.GetValues();
+  const FFrameNumber RangeStart = Keys.Times[0];
+  const FFrameNumber RangeEnd = Keys.Times.Last();
+
+  TArray<FFrameNumber> MergedTimes;
+  TArray<ValueType> MergedValues;
+  MergedTimes.Reserve(OldTimes.Num() + Keys.Times.Num());
+  MergedValues.Reserve(OldTimes.Num() + Keys.Times.Num());
+
+  int32 OldIndex = 0;
+  int32 NewIndex = 0;
+  while (OldIndex < OldTimes.Num() || NewIndex < Keys.Times.Num()) {
+    const bool bTakeOld =
+        NewIndex >= Keys.Times.Num() ||
+        (OldIndex < OldTimes.Num() && OldTimes[OldIndex] < Keys.Times[NewIndex]);
+    if (bTakeOld) {
+      const FFrameNumber Time = OldTimes[OldIndex];
+      if (bReplaceRange && Time >= RangeStart && Time <= RangeEnd) {
+        ++OutRemoved;
+      } else {
+        MergedTimes.Add(Time);
+        MergedValues.Add(OldValues[OldIndex]);
+      }
+      ++OldIndex;
+      continue;
+    }
+    if (OldIndex < OldTimes.Num() && OldTimes[OldIndex] == Keys.Times[NewIndex]) {
+      ++OutReplaced;
+      ++OldIndex;
+    }
+    ValueType Key(static_cast<FKeyScalar>(Keys.Values[NewIndex]));
+    Key.InterpMode = Keys.InterpMode;
+    Key.TangentMode = RCTM_Auto;
+    MergedTimes.Add(Keys.Times[NewIndex]);
+    MergedValues.Add(Key);
+    ++NewIndex;
+  }
+
+  Channel->Set(MoveTemp(MergedTimes), MoveTemp(MergedValues));
+  Channel->AutoSetTangents();
+}
+#endif
+
+bool UMcpAutomationBridgeSubsystem::HandleSequenceSetKeys(
+    const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket) {
+#if WITH_EDITOR
+  const FString SeqPath = ResolveSequencePath(Payload);
+  if (SeqPath.IsEmpty()) {
+    SendAutomationResponse(Socket, RequestId, false,
+                           TEXT("sequence_set_keys requires a sequence path"),
+                           nullptr, TEXT("INVALID_SEQUENCE"));
+    return true;
+  }
+
+  FString BindingIdStr;
+  Payload->TryGetStringField(TEXT("bindingId"), BindingIdStr);
+  FString ActorName;
+  Payload->TryGetStringField(TEXT("actorName"), ActorName);
+  FString PropertyName = TEXT("Transform");
+  Payload->TryGetStringField(TEXT("property"), PropertyName);
+  if (BindingIdStr.IsEmpty() && ActorName.IsEmpty()) {
+    SendAutomationResponse(
+        Socket, RequestId, false,
+        TEXT("Either bindingId or actorName must be provided"), nullptr,
+        TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  const TArray<TSharedPtr<FJsonValue>> *ChannelSpecs = nullptr;
+  if (!Payload->TryGetArrayField(TEXT("channels"), ChannelSpecs) ||
+      !ChannelSpecs || ChannelSpecs->Num() == 0) {
+    SendAutomationResponse(
+        Socket, RequestId, false,
+        TEXT("channels is required. Example: {\"channels\": [{\"channel\": "
+             "\"location.x\", \"frames\": [0, 30], \"values\": [0, 500]}]}"),
+        nullptr, TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  FString DefaultInterpName;
+  Payload->TryGetStringField(TEXT("interpolation"), DefaultInterpName);
+  ERichCurveInterpMode DefaultInterp = RCIM_Cubic;
+  if (!ParseSequenceInterpolation(DefaultInterpName, DefaultInterp)) {
+    SendAutomationResponse(
+        Socket, RequestId, false,
+        FString::Printf(TEXT("Unknown interpolation '%s' (cubic, linear, "
+                             "constant)"),
+                        *DefaultInterpName),
+        nullptr, TEXT("INVALID_ARGUMENT"));
+    return true;
+  }
+
+  FString TimeUnit = TEXT("frames");
+  Payload->TryGetStringField(TEXT("timeUnit"), TimeUnit);
+  const bool bSeconds = TimeUnit.Equals(TEXT("seconds"), ESearchCase::IgnoreCase);
+  double DefaultTolerance = 0.0;
+  Payload->TryGetNumberField(TEXT("tolerance"), DefaultTolerance);
+  bool bReplaceRange = false;
+  Payload->TryGetBoolField(TEXT("replace"), bReplaceRange);
+  bool bSave = false;
+  Payload->TryGetBoolField(TEXT("save"), bSave);
+
+  ULevelSequence *Sequence = LoadObject<ULevelSequence>(nullptr, *SeqPath);
+  UMovieScene *MovieScene = Sequence ? Sequence->GetMovieScene() : nullptr;
+  if (!MovieScene) {
+    SendAutomationResponse(Socket, RequestId, false, TEXT("Sequence not found"),
+                           nullptr, TEXT("INVALID_SEQUENCE"));
+    return true;
+  }
+
+  const FGuid BindingGuid =
+      FindSequenceBindingGuid(MovieScene, BindingIdStr, ActorName);
+  if (!BindingGuid.IsValid() || !MovieScene->FindBinding(BindingGuid)) {
+    SendAutomationResponse(
+        Socket, RequestId, false,
+        FString::Printf(TEXT("Binding not found for '%s'. Ensure actor is "
+                             "bound to sequence."),
+                        !BindingIdStr.IsEmpty() ? *BindingIdStr : *ActorName),
+        nullptr, TEXT("BINDING_NOT_FOUND"));
+    return true;
+  }
+
+  // Location / Rotation / Scale are shorthands for Transform channels
+  FString ChannelGroup;
+  if (PropertyName.Equals(TEXT("Location"), ESearchCase::IgnoreCase) ||
+      PropertyName.Equals(TEXT("Rotation"), ESearchCase::IgnoreCase) ||
+      PropertyName.Equals(TEXT("Scale"), ESearchCase::IgnoreCase)) {
+    ChannelGroup = PropertyName.ToLower();
+    PropertyName = TEXT("Transform");
+  }
+  const bool bTransform =
+      PropertyName.Equals(TEXT("Transform"), ESearchCase::IgnoreCase);
+
+  const FFrameRate TickResolution = MovieScene->GetTickResolution();
+  const FFrameRate DisplayRate = MovieScene->GetDisplayRate();
+  auto ToTick = [&](double Time) -> FFrameNumber {
+    if (bSeconds) {
+      return TickResolution.AsFrameTime(Time).RoundToFrame();
+    }
+    return FFrameRate::TransformTime(FFrameTime::FromDecimal(Time), DisplayRate,
+                                     TickResolution)
+        .RoundToFrame();
+  };
+
+  // Parse and validate every channel before touching the sequence
+  TArray<FSequenceChannelKeys> ChannelKeys;
+  for (int32 SpecIndex = 0; SpecIndex < ChannelSpecs->Num(); ++SpecIndex) {
+    const TSharedPtr<FJsonObject> Spec = (*ChannelSpecs)[SpecIndex]->AsObject();
+    auto Fail = [&](const FString &Reason) {
+      SendAutomationResponse(
+          Socket, RequestId, false,
+          FString::Printf(TEXT("channels[%d]: %s"), SpecIndex, *Reason),
+          nullptr, TEXT("INVALID_ARGUMENT"));
+      return true;
+    };
+    if (!Spec.IsValid()) {
+      return Fail(TEXT("expected an object"));
+    }
+
+    FSequenceChannelKeys Keys;
+    Spec->TryGetStringField(TEXT("channel"), Keys.Name);
+    if (bTransform) {
+      if (!ChannelGroup.IsEmpty() && !Keys.Name.Contains(TEXT("."))) {
+        Keys.Name = ChannelGroup + TEXT(".") + Keys.Name;
+      }
+      Keys.ChannelIndex = ResolveTransformChannelIndex(Keys.Name);
+      if (Keys.ChannelIndex == INDEX_NONE) {
+        return Fail(FString::Printf(
+            TEXT("unknown transform channel '%s' (location.x, rotation.yaw, "
+                 "scale.z, ...)"),
+            *Keys.Name));
+      }
+    } else if (SpecIndex > 0) {
+      // A float track has a single channel; a second entry would overwrite
+      // the first
+      return Fail(FString::Printf(
+          TEXT("'%s' is a float property with one channel; send one "
+               "channels entry per request"),
+          *PropertyName));
+    } else if (Keys.Name.IsEmpty()) {
+      Keys.Name = TEXT("value");
+    }
+
+    FString InterpName;
+    Keys.InterpMode = DefaultInterp;
+    if (Spec->TryGetStringField(TEXT("interpolation"), InterpName) &&
+        !ParseSequenceInterpolation(InterpName, Keys.InterpMode)) {
+      return Fail(FString::Printf(TEXT("unknown interpolation '%s'"),
+                                  *InterpName));
+    }
+
+    const TArray<TSharedPtr<FJsonValue>> *Frames = nullptr;
+    const TArray<TSharedPtr<FJsonValue>> *Values = nullptr;
+    if (!Spec->TryGetArrayField(bSeconds ? TEXT("times") : TEXT("frames"),
+                                Frames) &&
+        !Spec->TryGetArrayField(TEXT("frames"), Frames)) {
+      return Fail(TEXT("frames array is required"));
+    }
+    if (!Spec->TryGetArrayField(TEXT("values"), Values) ||
+        Values->Num() != Frames->Num() || Frames->Num() == 0) {
+      return Fail(TEXT("values must be a non-empty array the same length as "
+                       "frames"));
+    }
+
+    // Sort by tick; a later key on the same tick wins
+    TArray<TPair<FFrameNumber, double>> Sorted;
+    Sorted.Reserve(Frames->Num());
+    for (int32 Index = 0; Index < Frames->Num(); ++Index) {
+      double Time = 0.0;
+      double Value = 0.0;
+      if (!(*Frames)[Index]->TryGetNumber(Time) ||
+          !(*Values)[Index]->TryGetNumber(Value)) {
+        return Fail(FString::Printf(TEXT("key %d is not numeric"), Index));
+      }
+      Sorted.Emplace(ToTick(Time), Value);
+    }
+    Algo::StableSortBy(Sorted,
+                       [](const TPair<FFrameNumber, double> &Key) {
+                         return Key.Key.Value;
+                       });
+    for (const TPair<FFrameNumber, double> &Key : Sorted) {
+      if (Keys.Times.Num() > 0 && Keys.Times.Last() == Key.Key) {
+        Keys.Values.Last() = Key.Value;
+      } else {
+        Keys.Times.Add(Key.Key);
+        Keys.Values.Add(Key.Value);
+      }
+    }
+    Keys.KeysIn = Frames->Num();
+
+    double Tolerance = DefaultTolerance;
+    Spec->TryGetNumberField(TEXT("tolerance"), Tolerance);
+    const TArray<bool> Keep = SimplifySequenceKeys(Keys.Times, Keys.Values,
+                                                   Keys.InterpMode, Tolerance);
+    if (Keep.Contains(false)) {
+      TArray<FFrameNumber> KeptTimes;
+      TArray<double> KeptValues;
+      for (int32 Index = 0; Index < Keep.Num(); ++Index) {
+        if (Keep[Index]) {
+          KeptTimes.Add(Keys.Times[Index]);
+          KeptValues.Add(Keys.Values[Index]);
+        }
+      }
+      Keys.Times = MoveTemp(KeptTimes);
+      Keys.Values = MoveTemp(KeptValues);
+    }
+    ChannelKeys.Add(MoveTemp(Keys));
+  }
+
+  // One transaction for every channel so a single undo reverts the batch
+#ifndef MCP_NO_SCOPED_TRANSACTION
+  const FScopedTransaction Transaction(
+      FText::FromString(TEXT("Set Sequencer Keys")));
+#endif
+  Sequence->Modify();
+  MovieScene->Modify();
+
+  UMovieSceneSection *Section = nullptr;
+  TArrayView<FMovieSceneDoubleChannel *> DoubleChannels;
+  FMovieSceneFloatChannel *FloatChannel = nullptr;
+  bool bSectionAdded = false;
+  if (bTransform) {
+    UMovieScene3DTransformTrack *Track =
+        MovieScene->FindTrack<UMovieScene3DTransformTrack>(BindingGuid,
+                                                           FName("Transform"));
+    if (!Track) {
+      Track = MovieScene->AddTrack<UMovieScene3DTransformTrack>(BindingGuid);
+    }
+    Section = Track ? Track->FindOrAddSection(0, bSectionAdded) : nullptr;
+    if (Section) {
+      DoubleChannels =
+          Section->GetChannelProxy().GetChannels<FMovieSceneDoubleChannel>();
+    }
+    if (DoubleChannels.Num() < 9) {
+      Section = nullptr;
+    }
+  } else {
+    UMovieSceneFloatTrack *Track = MovieScene->FindTrack<UMovieSceneFloatTrack>(
+        BindingGuid, FName(*PropertyName));
+    if (!Track) {
+      Track = MovieScene->AddTrack<UMovieSceneFloatTrack>(BindingGuid);
+      if (Track) {
+        Track->SetPropertyNameAndPath(FName(*PropertyName), PropertyName);
+      }
+    }
+    Section = Track ? Track->FindOrAddSection(0, bSectionAdded) : nullptr;
+    if (Section) {
+      FloatChannel =
+          Section->GetChannelProxy().GetChannel<FMovieSceneFloatChannel>(0);
+    }
+    if (!FloatChannel) {
+      Section = nullptr;
+    }
+  }
+  if (!Section) {
+    SendAutomationResponse(
+        Socket, RequestId, false,
+        FString::Printf(TEXT("Failed to create a keyable track for '%s'"),
+                        *PropertyName),
+        nullptr, TEXT("UNSUPPORTED_PROPERTY"));
+    return true;
+  }
+  Section->Modify();
+
+  TArray<TSharedPtr<FJsonValue>> ChannelResults;
+  int32 TotalIn = 0;
+  int32 TotalWritten = 0;
+  FFrameNumber MinTick = ChannelKeys[0].Times[0];
+  FFrameNumber MaxTick = ChannelKeys[0].Times.Last();
+  for (const FSequenceChannelKeys &Keys : ChannelKeys) {
+    int32 Replaced = 0;
+    int32 Removed = 0;
+    if (bTransform) {
+      WriteSequenceChannelKeys<FMovieSceneDoubleChannel, FMovieSceneDoubleValue>(
+          DoubleChannels[Keys.ChannelIndex], Keys, bReplaceRange, Replaced,
+          Removed);
+    } else {
+      WriteSequenceChannelKeys<FMovieSceneFloatChannel, FMovieSceneFloatValue>(
+          FloatChannel, Keys, bReplaceRange, Replaced, Removed);
+    }
+    MinTick = FMath::Min(MinTick, Keys.Times[0]);
+    MaxTick = FMath::Max(MaxTick, Keys.Times.Last());
+    TotalIn += Keys.KeysIn;
+    TotalWritten += Keys.Times.Num();
+
+    TSharedPtr<FJsonObject> ChannelResult = McpHandlerUtils::CreateResultObject();
+    ChannelResult->SetStringField(TEXT("channel"), Keys.Name);
+    ChannelResult->SetStringField(TEXT("interpolation"),
+                                  SequenceInterpolationName(Keys.InterpMode));
+    ChannelResult->SetNumberField(TEXT("keysIn"), Keys.KeysIn);
+    ChannelResult->SetNumberField(TEXT("keysWritten"), Keys.Times.Num());
+    ChannelResult->SetNumberField(TEXT("keysReplaced"), Replaced);
+    ChannelResult->SetNumberField(TEXT("keysRemoved"), Removed);
+    ChannelResults.Add(MakeShared<FJsonValueObject>(ChannelResult));
+  }
+  Section->ExpandToFrame(MinTick);
+  Section->ExpandToFrame(MaxTick);
+  Sequence->MarkPackageDirty();
+  if (bSave) {
+    McpSafeAssetSave(Sequence);
+  }
+
+  TSharedPtr<FJsonObject> Resp = McpHandlerUtils::CreateResultObject();
+  Resp->SetStringField(TEXT("sequencePath"), SeqPath);
+  Resp->SetStringField(TEXT("bindingId"), BindingGuid.ToString());
+  Resp->SetStringField(TEXT("property"), PropertyName);
+  Resp->SetArrayField(TEXT("channels"), ChannelResults);
+  Resp->SetNumberField(TEXT("keysIn"), TotalIn);
+  Resp->SetNumberField(TEXT("keysWritten"), TotalWritten);
+  Resp->SetNumberField(
+      TEXT("startFrame"),
+      FFrameRate::TransformTime(FFrameTime(MinTick), TickResolution, DisplayRate)
+          .AsDecimal());
+  Resp->SetNumberField(
+      TEXT("endFrame"),
+      FFrameRate::TransformTime(FFrameTime(MaxTick), TickResolution, DisplayRate)
+          .AsDecimal());
+  Resp->SetBoolField(TEXT("sectionCreated"), bSectionAdded);
+  Resp->SetBoolField(TEXT("saved"), bSave);
+  SendAutomationResponse(
+      Socket, RequestId, true,
+      FString::Printf(TEXT("Wrote %d keys on %d channels (%d in)"),
+                      TotalWritten, ChannelKeys.Num(), TotalIn),
+      Resp);
+  return true;
+#else
+  SendAutomationResponse(Socket, RequestId, false,
+                         TEXT("sequence_set_keys requires editor build."),
+                         nullptr, TEXT("NOT_IMPLEMENTED"));
+  return true;
+#endif
+}
+
 bool UMcpAutomationBridgeSubsystem::HandleSequenceAddSection(
     const FString &RequestId, const TSharedPtr<FJsonObject> &Payload,
     TSharedPtr<FMcpBridgeWebSocket> Socket) {
@@ -2466,6 +3020,8 @@ bool UMcpAutomationBridgeSubsystem::HandleSequenceAction(
     return HandleSequenceGetMetadata(RequestId, LocalPayload, RequestingSocket);
   if (EffectiveAction == TEXT("sequence_add_keyframe"))
     return HandleSequenceAddKeyframe(RequestId, LocalPayload, RequestingSocket);
+  if (EffectiveAction == TEXT("sequence_set_keys"))
+    return HandleSequenceSetKeys(RequestId, LocalPayload, RequestingSocket);
 
   // New handlers
   if (EffectiveAction == TEXT("sequence_add_section"))
@@ -17,7 +17,9 @@
  *                              set_constraint_angular_limits, set_constraint_linear_limits,
  *                              remove_physics_body, remove_physics_constraint
  * 7.4  Skin Weights          - paint_weights, copy_weights, mirror_weights,
- *                              create_skin_weight_profile
+ *                              create_skin_weight_profile, normalize_weights,
+ *                              prune_weights, auto_skin_weights,
+ *                              process_skin_weights, benchmark_skin_weights
  * 7.5  Morph Targets         - list_morph_targets, get_morph_target_info, set_morph_target
  * 7.6  Cloth Binding         - bind_cloth_asset, unbind_cloth_asset, list_cloth_assets
  * 7.7  Utility Actions       - preview_physics, validate_skeleton, compare_skeletons
@@ -53,6 +55,7 @@
 #include "McpAutomationBridgeGlobals.h"
 #include "McpHandlerUtils.h"
 #include "McpAutomationBridgeHelpers.h"
+#include "McpSkinWeightKernels.h"
 
 // JSON & Serialization
 #include "Dom/JsonObject.h"
@@ -72,6 +75,16 @@
 #include "Rendering/SkeletalMeshLODModel.h"
 #include "Rendering/SkeletalMeshModel.h"
 
+// Skin weight editing through the mesh description (UE 5.1+)
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+#include "MeshDescription.h"
+#include "SkeletalMeshAttributes.h"
+#include "BoneWeights.h"
+#define MCP_HAS_SKELETAL_MESH_DESCRIPTION 1
+#else
+#define MCP_HAS_SKELETAL_MESH_DESCRIPTION 0
+#endif
+
 // Physics
 #include "PhysicsEngine/PhysicsAsset.h"
 #include "PhysicsEngine/BodySetup.h"
@@ -95,6 +108,7 @@
 // Core & Misc
 #include "Misc/PackageName.h"
 #include "Misc/Paths.h"
+#include "HAL/PlatformTime.h"
 #include "Modules/ModuleManager.h"
 #include "UObject/Package.h"
 #include "UObject/SavePackage.h"
@@ -316,6 +330,118 @@ static FRotator ParseRotatorFromJson(const TSharedPtr<FJsonObject>& JsonObj, con
     return Default;
 }
 
+/**
+ * Helper: Build a bone index -> mirrored bone index table. Explicit
+ * MirrorTable entries (name -> name) win; other bones are paired by common
+ * side tokens (_l/_r, Left/Right, l_/r_, .L/.R). Unpaired bones map to
+ * INDEX_NONE and keep their index when mirrored.
+ */
+static TArray<int32> BuildBoneMirrorTable(const FReferenceSkeleton& RefSkeleton, const TSharedPtr<FJsonObject>& MirrorTable)
+{
+    const int32 NumBones = RefSkeleton.GetRawBoneNum();
+    TArray<int32> Mirror;
+    Mirror.Init(INDEX_NONE, NumBones);
+
+    if (MirrorTable.IsValid())
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Entry : MirrorTable->Values)
+        {
+            const int32 From = RefSkeleton.FindRawBoneIndex(FName(*Entry.Key));
+            const int32 To = Entry.Value.IsValid() ? RefSkeleton.FindRawBoneIndex(FName(*Entry.Value->AsString())) : INDEX_NONE;
+            if (From != INDEX_NONE && To != INDEX_NONE)
+            {
+                Mirror[From] = To;
+                Mirror[To] = From;
+            }
+        }
+    }
+
+    // Suffix, infix and prefix side markers, tried in both directions
+    static const TCHAR* SideTokens[][2] = {
+        { TEXT("_l"), TEXT("_r") }, { TEXT("_l_"), TEXT("_r_") }, { TEXT("Left"), TEXT("Right") },
+        { TEXT("left"), TEXT("right") }, { TEXT(".L"), TEXT(".R") }, { TEXT("l_"), TEXT("r_") }
+    };
+    for (int32 Bone = 0; Bone < NumBones; ++Bone)
+    {
+        if (Mirror[Bone] != INDEX_NONE)
+        {
+            continue;
+        }
+        const FString Name = RefSkeleton.GetBoneName(Bone).ToString();
+        for (const auto& Tokens : SideTokens)
+        {
+            for (int32 Side = 0; Side < 2 && Mirror[Bone] == INDEX_NONE; ++Side)
+            {
+                const FString From = Tokens[Side];
+                const FString To = Tokens[1 - Side];
+                FString Candidate;
+                if (From == TEXT("_l") || From == TEXT("_r") || From == TEXT(".L") || From == TEXT(".R"))
+                {
+                    if (Name.EndsWith(From, ESearchCase::IgnoreCase))
+                    {
+                        Candidate = Name.LeftChop(From.Len()) + To;
+                    }
+                }
+                else if (From == TEXT("l_") || From == TEXT("r_"))
+                {
+                    if (Name.StartsWith(From, ESearchCase::IgnoreCase))
+                    {
+                        Candidate = To + Name.RightChop(From.Len());
+                    }
+                }
+                else if (Name.Contains(From, ESearchCase::CaseSensitive))
+                {
+                    Candidate = Name.Replace(*From, *To, ESearchCase::CaseSensitive);
+                }
+
+                const int32 Other = Candidate.IsEmpty() ? INDEX_NONE : RefSkeleton.FindRawBoneIndex(FName(*Candidate));
+                if (Other != INDEX_NONE && Other != Bone && Mirror[Other] == INDEX_NONE)
+                {
+                    Mirror[Bone] = Other;
+                    Mirror[Other] = Bone;
+                }
+            }
+        }
+    }
+    return Mirror;
+}
+
+/**
+ * Helper: Reference-pose bone segments for proximity skinning. Each bone owns
+ * the segments from its joint to each child joint; leaf bones own a point.
+ */
+static void BuildBoneSegments(const FReferenceSkeleton& RefSkeleton, TArray<FVector3f>& OutStart,
+                              TArray<FVector3f>& OutEnd, TArray<int32>& OutBone)
+{
+    const int32 NumBones = RefSkeleton.GetRawBoneNum();
+    const TArray<FTransform>& RefPose = RefSkeleton.GetRawRefBonePose();
+    TArray<FTransform> ComponentSpace;
+    ComponentSpace.SetNum(NumBones);
+    TArray<bool> HasChild;
+    HasChild.Init(false, NumBones);
+    for (int32 Bone = 0; Bone < NumBones; ++Bone)
+    {
+        const int32 Parent = RefSkeleton.GetRawParentIndex(Bone);
+        ComponentSpace[Bone] = Parent != INDEX_NONE ? RefPose[Bone] * ComponentSpace[Parent] : RefPose[Bone];
+        if (Parent != INDEX_NONE)
+        {
+            HasChild[Parent] = true;
+            OutStart.Add(FVector3f(ComponentSpace[Parent].GetLocation()));
+            OutEnd.Add(FVector3f(ComponentSpace[Bone].GetLocation()));
+            OutBone.Add(Parent);
+        }
+    }
+    for (int32 Bone = 0; Bone < NumBones; ++Bone)
+    {
+        if (!HasChild[Bone])
+        {
+            OutStart.Add(FVector3f(ComponentSpace[Bone].GetLocation()));
+            OutEnd.Add(FVector3f(ComponentSpace[Bone].GetLocation()));
+            OutBone.Add(Bone);
+        }
+    }
+}
+
 } // anonymous namespace
 
 
@@ -1996,22 +2122,52 @@ bool UMcpAutomationBridgeSubsystem::HandleImportMorphTargets(
 // ============================================================================
 
 /**
- * Handle: normalize_weights
- * Normalize skin weights to sum to 1.0 for each vertex
+ * Handle: process_skin_weights
+ * Run a chain of skin weight kernels (normalize, prune, limit, smooth, mirror,
+ * auto) on one LOD's mesh description, then commit and rebuild once.
+ * normalize_weights, prune_weights, auto_skin_weights and mirror_weights are
+ * single-operation forms of this handler.
  */
-bool UMcpAutomationBridgeSubsystem::HandleNormalizeWeights(
+bool UMcpAutomationBridgeSubsystem::HandleProcessSkinWeights(
     const FString& RequestId,
     const TSharedPtr<FJsonObject>& Payload,
     TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
 {
     FString SkeletalMeshPath = GetStringFieldSkel(Payload, TEXT("skeletalMeshPath"));
-
     if (SkeletalMeshPath.IsEmpty())
     {
         SendAutomationError(RequestingSocket, RequestId, TEXT("skeletalMeshPath is required"), TEXT("MISSING_PARAM"));
         return true;
     }
 
+    // Operations are names ("normalize") or objects ({"op": "prune", "threshold": 0.02})
+    const TArray<TSharedPtr<FJsonValue>>* OperationValues = nullptr;
+    if (!Payload->TryGetArrayField(TEXT("operations"), OperationValues) || !OperationValues || OperationValues->Num() == 0)
+    {
+        SendAutomationError(RequestingSocket, RequestId,
+            TEXT("operations is required (normalize, prune, limit_influences, smooth, mirror, auto)"), TEXT("MISSING_PARAM"));
+        return true;
+    }
+    TArray<TSharedPtr<FJsonObject>> Operations;
+    for (const TSharedPtr<FJsonValue>& Value : *OperationValues)
+    {
+        TSharedPtr<FJsonObject> Operation = Value.IsValid() ? Value->AsObject() : nullptr;
+        if (!Operation.IsValid())
+        {
+            Operation = McpHandlerUtils::CreateResultObject();
+            Operation->SetStringField(TEXT("op"), Value.IsValid() ? Value->AsString() : FString());
+        }
+        const FString Op = GetStringFieldSkel(Operation, TEXT("op"));
+        if (Op != TEXT("normalize") && Op != TEXT("prune") && Op != TEXT("limit_influences") &&
+            Op != TEXT("smooth") && Op != TEXT("mirror") && Op != TEXT("auto"))
+        {
+            SendAutomationError(RequestingSocket, RequestId,
+                FString::Printf(TEXT("Unknown skin weight operation '%s'"), *Op), TEXT("INVALID_ARGUMENT"));
+            return true;
+        }
+        Operations.Add(Operation);
+    }
+
     FString Error;
     USkeletalMesh* Mesh = LoadSkeletalMeshFromPathSkel(SkeletalMeshPath, Error);
     if (!Mesh)
@@ -2020,75 +2176,294 @@ bool UMcpAutomationBridgeSubsystem::HandleNormalizeWeights(
         return true;
     }
 
-    // Weight normalization is typically done during import
-    // The mesh's skin weights should already be normalized
-    // We can trigger a rebuild of the weights
-    
-    Mesh->Build();
-    McpSafeAssetSave(Mesh);
-
-    // Save if requested
-    bool bSave = false;
+#if WITH_EDITORONLY_DATA && MCP_HAS_SKELETAL_MESH_DESCRIPTION
+    int32 LODIndex = 0;
+    Payload->TryGetNumberField(TEXT("lodIndex"), LODIndex);
+    bool bSave = true;
     Payload->TryGetBoolField(TEXT("save"), bSave);
-    if (bSave)
+
+    if (LODIndex < 0 || LODIndex >= Mesh->GetLODNum())
     {
+        SendAutomationError(RequestingSocket, RequestId,
+            FString::Printf(TEXT("lodIndex %d is out of range (mesh has %d LODs)"), LODIndex, Mesh->GetLODNum()),
+            TEXT("INVALID_LOD"));
+        return true;
+    }
+    FMeshDescription* MeshDescription = Mesh->GetMeshDescription(LODIndex);
+    if (!MeshDescription)
+    {
+        SendAutomationError(RequestingSocket, RequestId,
+            FString::Printf(TEXT("LOD %d has no mesh description to edit"), LODIndex), TEXT("INVALID_LOD"));
+        return true;
+    }
+    FSkeletalMeshAttributes Attributes(*MeshDescription);
+    FSkinWeightsVertexAttributesRef SkinWeights = Attributes.GetVertexSkinWeights();
+    if (!SkinWeights.IsValid())
+    {
+        SendAutomationError(RequestingSocket, RequestId, TEXT("Mesh description has no skin weights"), TEXT("NO_SKIN_WEIGHTS"));
+        return true;
     }
 
-    TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetStringField(TEXT("skeletalMeshPath"), SkeletalMeshPath);
-
-    SendAutomationResponse(RequestingSocket, RequestId, true, TEXT("Skin weights normalized"), Result);
-    return true;
-}
+    // Copy weights into a dense fixed-stride buffer
+    double PhaseStart = FPlatformTime::Seconds();
+    TArray<FVertexID> VertexIds;
+    VertexIds.Reserve(MeshDescription->Vertices().Num());
+    TArray<int32> DenseIndex;
+    DenseIndex.Init(INDEX_NONE, MeshDescription->Vertices().GetArraySize());
+    int32 Stride = 1;
+    for (const FVertexID VertexID : MeshDescription->Vertices().GetElementIDs())
+    {
+        DenseIndex[VertexID.GetValue()] = VertexIds.Add(VertexID);
+        Stride = FMath::Max(Stride, SkinWeights.Get(VertexID).Num());
+    }
+    for (const TSharedPtr<FJsonObject>& Operation : Operations)
+    {
+        if (GetStringFieldSkel(Operation, TEXT("op")) == TEXT("auto"))
+        {
+            Stride = FMath::Max(Stride, GetIntFieldSkel(Operation, TEXT("maxInfluences"), 4));
+        }
+    }
+    Stride = FMath::Clamp(Stride, 1, MAX_TOTAL_INFLUENCES);
 
-/**
- * Handle: prune_weights
- * Remove bone influences below a threshold
- */
-bool UMcpAutomationBridgeSubsystem::HandlePruneWeights(
-    const FString& RequestId,
-    const TSharedPtr<FJsonObject>& Payload,
-    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
-{
-    FString SkeletalMeshPath = GetStringFieldSkel(Payload, TEXT("skeletalMeshPath"));
-    double Threshold = 0.01;
-    Payload->TryGetNumberField(TEXT("threshold"), Threshold);
+    const int32 NumVertices = VertexIds.Num();
+    McpSkinWeightKernels::FSkinWeightBuffer Buffer;
+    Buffer.Init(NumVertices, Stride);
+    TArray<FVector3f> Positions;
+    Positions.SetNumUninitialized(NumVertices);
+    TVertexAttributesRef<FVector3f> VertexPositions = MeshDescription->GetVertexPositions();
+    for (int32 V = 0; V < NumVertices; ++V)
+    {
+        Positions[V] = VertexPositions[VertexIds[V]];
+        const FVertexBoneWeights BoneWeights = SkinWeights.Get(VertexIds[V]);
+        for (int32 I = 0; I < FMath::Min(BoneWeights.Num(), Stride); ++I)
+        {
+            Buffer.Bones[V * Stride + I] = BoneWeights[I].GetBoneIndex();
+            Buffer.Weights[V * Stride + I] = BoneWeights[I].GetWeight();
+        }
+    }
+    const double ReadMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
+    const McpSkinWeightKernels::FSumStats Before = McpSkinWeightKernels::ComputeSumStats(Buffer);
 
-    if (SkeletalMeshPath.IsEmpty())
+    // Run the kernels in order
+    McpSkinWeightKernels::FVertexAdjacency Adjacency;
+    const FReferenceSkeleton& RefSkeleton = Mesh->GetRefSkeleton();
+    TArray<TSharedPtr<FJsonValue>> OperationResults;
+    double KernelSeconds = 0.0;
+    for (const TSharedPtr<FJsonObject>& Operation : Operations)
     {
-        SendAutomationError(RequestingSocket, RequestId, TEXT("skeletalMeshPath is required"), TEXT("MISSING_PARAM"));
-        return true;
+        const FString Op = GetStringFieldSkel(Operation, TEXT("op"));
+        TSharedPtr<FJsonObject> OpResult = McpHandlerUtils::CreateResultObject();
+        OpResult->SetStringField(TEXT("op"), Op);
+
+        // Topology is only gathered when a smooth needs it
+        if (Op == TEXT("smooth") && Adjacency.Offsets.Num() == 0)
+        {
+            TArray<TPair<int32, int32>> Edges;
+            Edges.Reserve(MeshDescription->Edges().Num());
+            for (const FEdgeID EdgeID : MeshDescription->Edges().GetElementIDs())
+            {
+                Edges.Emplace(DenseIndex[MeshDescription->GetEdgeVertex(EdgeID, 0).GetValue()],
+                              DenseIndex[MeshDescription->GetEdgeVertex(EdgeID, 1).GetValue()]);
+            }
+            Adjacency.Build(NumVertices, Edges);
+        }
+
+        const double OpStart = FPlatformTime::Seconds();
+        if (Op == TEXT("normalize"))
+        {
+            OpResult->SetNumberField(TEXT("verticesChanged"), McpSkinWeightKernels::Normalize(Buffer));
+        }
+        else if (Op == TEXT("prune"))
+        {
+            double Threshold = GetNumberFieldSkel(Payload, TEXT("threshold"), 0.01);
+            Operation->TryGetNumberField(TEXT("threshold"), Threshold);
+            bool bRenormalize = true;
+            Operation->TryGetBoolField(TEXT("renormalize"), bRenormalize);
+            OpResult->SetNumberField(TEXT("threshold"), Threshold);
+            OpResult->SetNumberField(TEXT("influencesRemoved"), McpSkinWeightKernels::Prune(Buffer, static_cast<float>(Threshold)));
+            if (bRenormalize)
+            {
+                McpSkinWeightKernels::Normalize(Buffer);
+            }
+        }
+        else if (Op == TEXT("limit_influences"))
+        {
+            const int32 MaxInfluences = GetIntFieldSkel(Operation, TEXT("maxInfluences"), 4);
+            OpResult->SetNumberField(TEXT("maxInfluences"), MaxInfluences);
+            OpResult->SetNumberField(TEXT("influencesRemoved"), McpSkinWeightKernels::LimitInfluences(Buffer, MaxInfluences));
+            McpSkinWeightKernels::Normalize(Buffer);
+        }
+        else if (Op == TEXT("smooth"))
+        {
+            const int32 Iterations = FMath::Clamp(GetIntFieldSkel(Operation, TEXT("iterations"), 2), 1, 100);
+            double Strength = 0.5;
+            Operation->TryGetNumberField(TEXT("strength"), Strength);
+            // Neighbours can contribute bones the vertex lacked; cap to maxInfluences (default: the stride)
+            const int32 MaxInfluences = FMath::Clamp(GetIntFieldSkel(Operation, TEXT("maxInfluences"), Stride), 1, Stride);
+            McpSkinWeightKernels::Smooth(Buffer, Adjacency, Iterations, static_cast<float>(Strength), MaxInfluences);
+            OpResult->SetNumberField(TEXT("iterations"), Iterations);
+            OpResult->SetNumberField(TEXT("strength"), Strength);
+            OpResult->SetNumberField(TEXT("maxInfluences"), MaxInfluences);
+        }
+        else if (Op == TEXT("mirror"))
+        {
+            FString Axis = GetStringFieldSkel(Operation, TEXT("axis"));
+            if (Axis.IsEmpty())
+            {
+                Axis = GetStringFieldSkel(Payload, TEXT("mirrorAxis"));
+            }
+            if (Axis.IsEmpty())
+            {
+                Axis = GetStringFieldSkel(Payload, TEXT("axis"));
+            }
+            const int32 AxisIndex = Axis.Equals(TEXT("Y"), ESearchCase::IgnoreCase) ? 1 : (Axis.Equals(TEXT("Z"), ESearchCase::IgnoreCase) ? 2 : 0);
+            const FString Direction = GetStringFieldSkel(Operation, TEXT("direction"));
+            const bool bPositiveToNegative = !Direction.Equals(TEXT("negative_to_positive"), ESearchCase::IgnoreCase);
+            double Tolerance = 0.5;
+            Operation->TryGetNumberField(TEXT("tolerance"), Tolerance);
+
+            const TSharedPtr<FJsonObject>* MirrorTable = nullptr;
+            if (!Operation->TryGetObjectField(TEXT("mirrorTable"), MirrorTable))
+            {
+                Payload->TryGetObjectField(TEXT("mirrorTable"), MirrorTable);
+            }
+            const TArray<int32> BoneMirror = BuildBoneMirrorTable(RefSkeleton, MirrorTable ? *MirrorTable : TSharedPtr<FJsonObject>());
+            int32 PairedBones = 0;
+            for (int32 Other : BoneMirror)
+            {
+                PairedBones += Other != INDEX_NONE ? 1 : 0;
+            }
+
+            int32 Unmatched = 0;
+            const int32 Mirrored = McpSkinWeightKernels::Mirror(Buffer, Positions, AxisIndex, bPositiveToNegative,
+                                                                BoneMirror, static_cast<float>(Tolerance), Unmatched);
+            OpResult->SetStringField(TEXT("axis"), AxisIndex == 0 ? TEXT("X") : (AxisIndex == 1 ? TEXT("Y") : TEXT("Z")));
+            OpResult->SetStringField(TEXT("direction"), bPositiveToNegative ? TEXT("positive_to_negative") : TEXT("negative_to_positive"));
+            OpResult->SetNumberField(TEXT("verticesMirrored"), Mirrored);
+            OpResult->SetNumberField(TEXT("verticesUnmatched"), Unmatched);
+            OpResult->SetNumberField(TEXT("pairedBones"), PairedBones / 2);
+        }
+        else if (Op == TEXT("auto"))
+        {
+            TArray<FVector3f> SegmentStart;
+            TArray<FVector3f> SegmentEnd;
+            TArray<int32> SegmentBone;
+            BuildBoneSegments(RefSkeleton, SegmentStart, SegmentEnd, SegmentBone);
+            double Falloff = 2.0;
+            Operation->TryGetNumberField(TEXT("falloff"), Falloff);
+            // The stride may be wider (existing weights); auto writes no more than maxInfluences
+            const int32 MaxInfluences = FMath::Clamp(GetIntFieldSkel(Operation, TEXT("maxInfluences"), 4), 1, Stride);
+            McpSkinWeightKernels::ComputeFromBones(Buffer, Positions, SegmentStart, SegmentEnd, SegmentBone,
+                                                   static_cast<float>(Falloff), MaxInfluences);
+            OpResult->SetNumberField(TEXT("maxInfluences"), MaxInfluences);
+            OpResult->SetNumberField(TEXT("bones"), RefSkeleton.GetRawBoneNum());
+            OpResult->SetNumberField(TEXT("falloff"), Falloff);
+        }
+        const double OpSeconds = FPlatformTime::Seconds() - OpStart;
+        KernelSeconds += OpSeconds;
+        OpResult->SetNumberField(TEXT("ms"), OpSeconds * 1000.0);
+        OpResult->SetNumberField(TEXT("verticesPerSec"), OpSeconds > 0.0 ? NumVertices / OpSeconds : 0.0);
+        OperationResults.Add(MakeShared<FJsonValueObject>(OpResult));
     }
+    const McpSkinWeightKernels::FSumStats After = McpSkinWeightKernels::ComputeSumStats(Buffer);
 
-    FString Error;
-    USkeletalMesh* Mesh = LoadSkeletalMeshFromPathSkel(SkeletalMeshPath, Error);
-    if (!Mesh)
+    // Write back, then one commit and one rebuild for the whole chain
+    PhaseStart = FPlatformTime::Seconds();
+    Mesh->Modify();
+    TArray<UE::AnimationCore::FBoneWeight, TInlineAllocator<MAX_TOTAL_INFLUENCES>> BoneWeights;
+    for (int32 V = 0; V < NumVertices; ++V)
     {
-        SendAutomationError(RequestingSocket, RequestId, Error, TEXT("MESH_NOT_FOUND"));
-        return true;
+        BoneWeights.Reset();
+        for (int32 I = 0; I < Stride; ++I)
+        {
+            if (Buffer.Bones[V * Stride + I] != INDEX_NONE && Buffer.Weights[V * Stride + I] > 0.0f)
+            {
+                BoneWeights.Emplace(static_cast<FBoneIndexType>(Buffer.Bones[V * Stride + I]), Buffer.Weights[V * Stride + I]);
+            }
+        }
+        SkinWeights.Set(VertexIds[V], BoneWeights);
     }
+    Mesh->CommitMeshDescription(LODIndex);
+    const double WriteMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
 
-    // Skin weight pruning is done during import/build
-    // For runtime, we can trigger a rebuild with the threshold
-    // Note: This requires setting import options which are not accessible post-import
-    
+    PhaseStart = FPlatformTime::Seconds();
     Mesh->Build();
-    McpSafeAssetSave(Mesh);
-
-    // Save if requested
-    bool bSave = false;
-    Payload->TryGetBoolField(TEXT("save"), bSave);
+    Mesh->MarkPackageDirty();
+    const double RebuildMs = (FPlatformTime::Seconds() - PhaseStart) * 1000.0;
     if (bSave)
     {
+        McpSafeAssetSave(Mesh);
     }
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
     Result->SetStringField(TEXT("skeletalMeshPath"), SkeletalMeshPath);
-    Result->SetNumberField(TEXT("threshold"), Threshold);
-
-    SendAutomationResponse(RequestingSocket, RequestId, true, 
-        FString::Printf(TEXT("Weights pruned with threshold %f"), Threshold), Result);
+    Result->SetNumberField(TEXT("lodIndex"), LODIndex);
+    Result->SetNumberField(TEXT("vertices"), NumVertices);
+    Result->SetNumberField(TEXT("maxInfluences"), Stride);
+    Result->SetArrayField(TEXT("operations"), OperationResults);
+    Result->SetObjectField(TEXT("before"), Before.ToJson());
+    Result->SetObjectField(TEXT("after"), After.ToJson());
+    Result->SetNumberField(TEXT("readMs"), ReadMs);
+    Result->SetNumberField(TEXT("kernelMs"), KernelSeconds * 1000.0);
+    Result->SetNumberField(TEXT("writeMs"), WriteMs);
+    Result->SetNumberField(TEXT("rebuildMs"), RebuildMs);
+    Result->SetNumberField(TEXT("verticesPerSec"), KernelSeconds > 0.0 ? NumVertices * Operations.Num() / KernelSeconds : 0.0);
+    Result->SetBoolField(TEXT("saved"), bSave);
+
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+        FString::Printf(TEXT("Processed skin weights of %d vertices (%d operation(s), one rebuild)"), NumVertices, Operations.Num()), Result);
+    return true;
+#else
+    SendAutomationError(RequestingSocket, RequestId,
+        TEXT("Skin weight editing requires editor data and UE 5.1+ skeletal mesh descriptions"), TEXT("NOT_SUPPORTED"));
     return true;
+#endif
+}
+
+/** Copy of a payload with its operations replaced, for the single-operation weight actions. */
+static TSharedPtr<FJsonObject> MakeSkinWeightOperationPayload(const TSharedPtr<FJsonObject>& Payload,
+                                                              const TArray<TSharedPtr<FJsonObject>>& Operations)
+{
+    TSharedPtr<FJsonObject> Forwarded = McpHandlerUtils::CreateResultObject();
+    Forwarded->Values = Payload->Values;
+    TArray<TSharedPtr<FJsonValue>> OperationValues;
+    for (const TSharedPtr<FJsonObject>& Operation : Operations)
+    {
+        OperationValues.Add(MakeShared<FJsonValueObject>(Operation));
+    }
+    Forwarded->SetArrayField(TEXT("operations"), OperationValues);
+    return Forwarded;
+}
+
+/**
+ * Handle: normalize_weights
+ * Normalize skin weights to sum to 1.0 for each vertex
+ */
+bool UMcpAutomationBridgeSubsystem::HandleNormalizeWeights(
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    TSharedPtr<FJsonObject> Normalize = McpHandlerUtils::CreateResultObject();
+    Normalize->SetStringField(TEXT("op"), TEXT("normalize"));
+    return HandleProcessSkinWeights(RequestId, MakeSkinWeightOperationPayload(Payload, { Normalize }), RequestingSocket);
+}
+
+/**
+ * Handle: prune_weights
+ * Remove bone influences below a threshold, then renormalize
+ */
+bool UMcpAutomationBridgeSubsystem::HandlePruneWeights(
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket)
+{
+    TSharedPtr<FJsonObject> Prune = McpHandlerUtils::CreateResultObject();
+    Prune->SetStringField(TEXT("op"), TEXT("prune"));
+    double Threshold = 0.01;
+    Payload->TryGetNumberField(TEXT("threshold"), Threshold);
+    Prune->SetNumberField(TEXT("threshold"), Threshold);
+    return HandleProcessSkinWeights(RequestId, MakeSkinWeightOperationPayload(Payload, { Prune }), RequestingSocket);
 }
 
 
@@ -3267,6 +3642,35 @@ bool UMcpAutomationBridgeSubsystem::HandleManageSkeleton(
     {
         return HandlePruneWeights(RequestId, Payload, RequestingSocket);
     }
+    else if (SubAction == TEXT("process_skin_weights"))
+    {
+        return HandleProcessSkinWeights(RequestId, Payload, RequestingSocket);
+    }
+    else if (SubAction == TEXT("benchmark_skin_weights"))
+    {
+        TArray<int32> VertexCounts;
+        const TArray<TSharedPtr<FJsonValue>>* CountValues = nullptr;
+        if (Payload->TryGetArrayField(TEXT("vertexCounts"), CountValues) && CountValues)
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *CountValues)
+            {
+                VertexCounts.Add(static_cast<int32>(Value->AsNumber()));
+            }
+        }
+        if (VertexCounts.Num() == 0)
+        {
+            VertexCounts = { 50000, 200000 };
+        }
+        const int32 Iterations = GetIntFieldSkel(Payload, TEXT("iterations"), 3);
+
+        TSharedPtr<FJsonObject> Report = McpSkinWeightKernels::RunBenchmark(VertexCounts, Iterations);
+        const bool bVerified = Report->GetBoolField(TEXT("allVerified"));
+        SendAutomationResponse(RequestingSocket, RequestId, bVerified,
+            FString::Printf(TEXT("Benchmarked skin weight kernels at %d vertex count(s)%s"), VertexCounts.Num(),
+                bVerified ? TEXT("") : TEXT(" - VERIFICATION FAILED")), Report,
+            bVerified ? FString() : TEXT("VERIFICATION_FAILED"));
+        return true;
+    }
     // Cloth operations
     else if (SubAction == TEXT("bind_cloth_to_skeletal_mesh"))
     {
@@ -3731,35 +4135,22 @@ bool UMcpAutomationBridgeSubsystem::HandleManageSkeleton(
     }
     else if (SubAction == TEXT("auto_skin_weights"))
     {
-        // Auto skin weights computation - typically done during import
-        // We trigger a mesh rebuild which recalculates default weights
-        FString SkeletalMeshPath = GetStringFieldSkel(Payload, TEXT("skeletalMeshPath"));
-        
-        if (SkeletalMeshPath.IsEmpty())
+        // Proximity weights from the reference pose bone segments
+        TSharedPtr<FJsonObject> AutoOp = McpHandlerUtils::CreateResultObject();
+        AutoOp->SetStringField(TEXT("op"), TEXT("auto"));
+        AutoOp->SetNumberField(TEXT("maxInfluences"), GetIntFieldSkel(Payload, TEXT("maxInfluences"), 4));
+        AutoOp->SetNumberField(TEXT("falloff"), GetNumberFieldSkel(Payload, TEXT("falloff"), 2.0));
+        TArray<TSharedPtr<FJsonObject>> Operations = { AutoOp };
+        const int32 SmoothIterations = GetIntFieldSkel(Payload, TEXT("smoothIterations"), 1);
+        if (SmoothIterations > 0)
         {
-            SendAutomationError(RequestingSocket, RequestId, TEXT("skeletalMeshPath is required"), TEXT("MISSING_PARAM"));
-            return true;
+            TSharedPtr<FJsonObject> SmoothOp = McpHandlerUtils::CreateResultObject();
+            SmoothOp->SetStringField(TEXT("op"), TEXT("smooth"));
+            SmoothOp->SetNumberField(TEXT("iterations"), SmoothIterations);
+            SmoothOp->SetNumberField(TEXT("maxInfluences"), AutoOp->GetNumberField(TEXT("maxInfluences")));
+            Operations.Add(SmoothOp);
         }
-        
-        FString Error;
-        USkeletalMesh* Mesh = LoadSkeletalMeshFromPathSkel(SkeletalMeshPath, Error);
-        if (!Mesh)
-        {
-            SendAutomationError(RequestingSocket, RequestId, Error, TEXT("MESH_NOT_FOUND"));
-            return true;
-        }
-        
-        // Rebuild the mesh - this recalculates skin weights based on bone positions
-        Mesh->Build();
-        McpSafeAssetSave(Mesh);
-        
-        TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-        Result->SetStringField(TEXT("skeletalMeshPath"), SkeletalMeshPath);
-        Result->SetBoolField(TEXT("rebuilt"), true);
-        
-        SendAutomationResponse(RequestingSocket, RequestId, true, 
-            TEXT("Mesh rebuilt with recalculated skin weights"), Result);
-        return true;
+        return HandleProcessSkinWeights(RequestId, MakeSkinWeightOperationPayload(Payload, Operations), RequestingSocket);
     }
     else if (SubAction == TEXT("copy_weights"))
     {
@@ -3875,77 +4266,16 @@ bool UMcpAutomationBridgeSubsystem::HandleManageSkeleton(
     }
     else if (SubAction == TEXT("mirror_weights"))
     {
-        FString SkeletalMeshPath = GetStringFieldSkel(Payload, TEXT("skeletalMeshPath"));
-        FString Axis = GetStringFieldSkel(Payload, TEXT("axis"));
-        if (Axis.IsEmpty())
-        {
-            Axis = TEXT("X");
-        }
-        FString ProfileName = GetStringFieldSkel(Payload, TEXT("profileName"));
-        if (ProfileName.IsEmpty())
+        TSharedPtr<FJsonObject> MirrorOp = McpHandlerUtils::CreateResultObject();
+        MirrorOp->SetStringField(TEXT("op"), TEXT("mirror"));
+        for (const TCHAR* Field : { TEXT("axis"), TEXT("direction"), TEXT("tolerance") })
         {
-            ProfileName = TEXT("MirroredWeights");
-        }
-        
-        if (SkeletalMeshPath.IsEmpty())
-        {
-            SendAutomationError(RequestingSocket, RequestId, TEXT("skeletalMeshPath is required"), TEXT("MISSING_PARAM"));
-            return true;
-        }
-        
-        FString Error;
-        USkeletalMesh* Mesh = LoadSkeletalMeshFromPathSkel(SkeletalMeshPath, Error);
-        if (!Mesh)
-        {
-            SendAutomationError(RequestingSocket, RequestId, Error, TEXT("MESH_NOT_FOUND"));
-            return true;
-        }
-        
-#if WITH_EDITORONLY_DATA
-        FSkeletalMeshModel* ImportedModel = Mesh->GetImportedModel();
-        if (!ImportedModel || ImportedModel->LODModels.Num() == 0)
-        {
-            SendAutomationError(RequestingSocket, RequestId, TEXT("Mesh has no LOD models"), TEXT("NO_LOD_MODELS"));
-            return true;
-        }
-        
-        int32 LODIndex = 0;
-        Payload->TryGetNumberField(TEXT("lodIndex"), LODIndex);
-        
-        FSkeletalMeshLODModel& LODModel = ImportedModel->LODModels[LODIndex];
-        
-        // Create mirrored skin weight profile
-        FSkinWeightProfileInfo NewProfile;
-        NewProfile.Name = FName(*ProfileName);
-        Mesh->AddSkinWeightProfile(NewProfile);
-        
-        FImportedSkinWeightProfileData& ProfileData = LODModel.SkinWeightProfiles.FindOrAdd(FName(*ProfileName));
-        ProfileData.SkinWeights.SetNum(LODModel.NumVertices);
-        
-        // Initialize profile - mirroring logic would need vertex position data
-        // For now we create the profile structure and indicate manual completion needed
-        for (uint32 i = 0; i < LODModel.NumVertices; ++i)
-        {
-            FMemory::Memzero(&ProfileData.SkinWeights[i], sizeof(FRawSkinWeight));
+            if (Payload->HasField(Field))
+            {
+                MirrorOp->SetField(Field, Payload->TryGetField(Field));
+            }
         }
-        
-        Mesh->Build();
-        McpSafeAssetSave(Mesh);
-        
-        TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-        Result->SetStringField(TEXT("skeletalMeshPath"), SkeletalMeshPath);
-        Result->SetStringField(TEXT("profileName"), ProfileName);
-        Result->SetStringField(TEXT("axis"), Axis);
-        Result->SetNumberField(TEXT("lodIndex"), LODIndex);
-        Result->SetStringField(TEXT("note"), TEXT("Skin weight profile created. Use Skeletal Mesh Editor for precise mirroring with bone name mapping."));
-        
-        SendAutomationResponse(RequestingSocket, RequestId, true, 
-            FString::Printf(TEXT("Skin weight profile '%s' created for mirroring along %s axis"), *ProfileName, *Axis), Result);
-        return true;
-#else
-        SendAutomationError(RequestingSocket, RequestId, TEXT("mirror_weights requires editor mode"), TEXT("NOT_EDITOR"));
-        return true;
-#endif
+        return HandleProcessSkinWeights(RequestId, MakeSkinWeightOperationPayload(Payload, { MirrorOp }), RequestingSocket);
     }
     // set_physics_constraint - Alias for add_physics_constraint/configure_constraint_limits
     else if (SubAction == TEXT("set_physics_constraint"))
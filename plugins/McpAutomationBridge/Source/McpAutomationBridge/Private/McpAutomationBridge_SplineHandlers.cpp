@@ -18,6 +18,9 @@
 //   - create_spline_mesh_component    : Add USplineMeshComponent to Blueprint
 //   - add_spline_mesh                 : Create spline mesh along spline path
 //   - configure_spline_mesh           : Configure spline mesh properties
+//   - scatter_meshes_along_spline     : Scatter meshes as components or one ISM/HISM per mesh
+//   - configure_mesh_spacing          : Persist spacing settings on the spline actor
+//   - configure_mesh_randomization    : Persist scale/rotation randomization on the spline actor
 //
 // Section 3: Utility Functions
 //   - get_spline_info                 : Get spline component details
@@ -41,6 +44,11 @@
 //              "staticMesh": string, "material"?: string }
 //   Response: { "success": bool, "meshCount": int }
 //
+// scatter_meshes_along_spline:
+//   Payload: { "actorName": string, "meshPath"?: string, "meshPaths"?: string[],
+//              "instancingMode"?: "none"|"ism"|"hism", "clearExisting"?: bool, ...overrides }
+//   Response: { "success": bool, "instanceCount": int, "componentsCreated": int, "spawnTimeMs": number }
+//
 // VERSION COMPATIBILITY:
 // ----------------------
 // UE 5.0-5.7: All handlers supported
@@ -76,6 +84,9 @@
 // -----------------------------------------------------------------------------
 #include "Components/SplineComponent.h"
 #include "Components/SplineMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Math/RandomStream.h"
 #include "Engine/StaticMesh.h"
 #include "Materials/MaterialInterface.h"
 #include "GameFramework/Actor.h"
@@ -1348,6 +1359,157 @@ static bool HandleCreateSplineMeshActor(
 // Mesh Scattering Handlers
 // ============================================================================
 
+// Scatter settings persisted on the spline actor as "MCP_SCATTER:<key>=<value>"
+// actor tags so configure_mesh_spacing / configure_mesh_randomization survive
+// level save/load and are picked up by later scatter_meshes_along_spline calls.
+static const TCHAR* SplineScatterTagPrefix = TEXT("MCP_SCATTER:");
+
+// Component tag applied to everything scatter_meshes_along_spline creates, so a
+// re-scatter with clearExisting can remove the previous output.
+static const FName SplineScatterComponentTag(TEXT("MCP_SCATTER"));
+
+struct FMcpSplineScatterSettings
+{
+    double Spacing = 100.0;
+    double StartOffset = 0.0;
+    double EndOffset = 0.0;
+    bool bAlignToSpline = true;
+    bool bUseRandomOffset = false;
+    double RandomOffsetRange = 0.0;
+    bool bRandomizeScale = false;
+    double MinScale = 0.8;
+    double MaxScale = 1.2;
+    bool bRandomizeRotation = false;
+    FRotator RotationRange = FRotator(0.0, 360.0, 0.0);
+    int32 RandomSeed = 0;
+};
+
+static void SetSplineScatterTag(AActor* Actor, const FString& Key, const FString& Value)
+{
+    const FString Prefix = FString::Printf(TEXT("%s%s="), SplineScatterTagPrefix, *Key);
+    Actor->Tags.RemoveAll([&Prefix](const FName& Tag)
+    {
+        return Tag.ToString().StartsWith(Prefix);
+    });
+    Actor->Tags.Add(FName(*(Prefix + Value)));
+}
+
+static TMap<FString, FString> GetSplineScatterTags(const AActor* Actor)
+{
+    TMap<FString, FString> Values;
+    for (const FName& Tag : Actor->Tags)
+    {
+        FString TagStr = Tag.ToString();
+        if (!TagStr.RemoveFromStart(SplineScatterTagPrefix))
+        {
+            continue;
+        }
+        FString Key, Value;
+        if (TagStr.Split(TEXT("="), &Key, &Value))
+        {
+            Values.Add(Key, Value);
+        }
+    }
+    return Values;
+}
+
+static void ReadSplineScatterSettingsFromActor(const AActor* Actor, FMcpSplineScatterSettings& Settings)
+{
+    const TMap<FString, FString> Values = GetSplineScatterTags(Actor);
+    auto ReadDouble = [&Values](const TCHAR* Key, double& Out)
+    {
+        if (const FString* Found = Values.Find(Key)) { Out = FCString::Atod(**Found); }
+    };
+    auto ReadBool = [&Values](const TCHAR* Key, bool& Out)
+    {
+        if (const FString* Found = Values.Find(Key)) { Out = Found->ToBool(); }
+    };
+
+    ReadDouble(TEXT("spacing"), Settings.Spacing);
+    ReadDouble(TEXT("startOffset"), Settings.StartOffset);
+    ReadDouble(TEXT("endOffset"), Settings.EndOffset);
+    ReadBool(TEXT("useRandomOffset"), Settings.bUseRandomOffset);
+    ReadDouble(TEXT("randomOffsetRange"), Settings.RandomOffsetRange);
+    ReadBool(TEXT("randomizeScale"), Settings.bRandomizeScale);
+    ReadDouble(TEXT("minScale"), Settings.MinScale);
+    ReadDouble(TEXT("maxScale"), Settings.MaxScale);
+    ReadBool(TEXT("randomizeRotation"), Settings.bRandomizeRotation);
+    ReadDouble(TEXT("rotationPitch"), Settings.RotationRange.Pitch);
+    ReadDouble(TEXT("rotationYaw"), Settings.RotationRange.Yaw);
+    ReadDouble(TEXT("rotationRoll"), Settings.RotationRange.Roll);
+    if (const FString* Seed = Values.Find(TEXT("randomSeed")))
+    {
+        Settings.RandomSeed = FCString::Atoi(**Seed);
+    }
+}
+
+// Applies any fields present in the payload on top of Settings. Both the
+// short names used by configure_* and the b-prefixed schema names are accepted.
+static void ApplySplineScatterSettingsFromPayload(const TSharedPtr<FJsonObject>& Payload, FMcpSplineScatterSettings& Settings)
+{
+    if (!Payload.IsValid()) return;
+
+    auto TryNumber = [&Payload](std::initializer_list<const TCHAR*> Keys, double& Out)
+    {
+        for (const TCHAR* Key : Keys)
+        {
+            if (Payload->TryGetNumberField(Key, Out)) return true;
+        }
+        return false;
+    };
+    auto TryBool = [&Payload](std::initializer_list<const TCHAR*> Keys, bool& Out)
+    {
+        for (const TCHAR* Key : Keys)
+        {
+            if (Payload->TryGetBoolField(Key, Out)) return true;
+        }
+        return false;
+    };
+
+    TryNumber({TEXT("spacing")}, Settings.Spacing);
+    TryNumber({TEXT("startOffset")}, Settings.StartOffset);
+    TryNumber({TEXT("endOffset")}, Settings.EndOffset);
+    TryBool({TEXT("bAlignToSpline"), TEXT("alignToSpline")}, Settings.bAlignToSpline);
+    TryBool({TEXT("useRandomOffset"), TEXT("bUseRandomOffset")}, Settings.bUseRandomOffset);
+    TryNumber({TEXT("randomOffsetRange")}, Settings.RandomOffsetRange);
+    TryBool({TEXT("randomizeScale"), TEXT("bRandomizeScale")}, Settings.bRandomizeScale);
+    TryNumber({TEXT("minScale"), TEXT("scaleMin")}, Settings.MinScale);
+    TryNumber({TEXT("maxScale"), TEXT("scaleMax")}, Settings.MaxScale);
+    TryBool({TEXT("randomizeRotation"), TEXT("bRandomizeRotation")}, Settings.bRandomizeRotation);
+
+    // rotationRange is a yaw-only shorthand; rotationRandomRange gives per-axis ranges.
+    double YawRange = 0.0;
+    if (Payload->TryGetNumberField(TEXT("rotationRange"), YawRange))
+    {
+        Settings.RotationRange = FRotator(0.0, YawRange, 0.0);
+    }
+    Settings.RotationRange = GetJsonRotatorFieldSpline(Payload, TEXT("rotationRandomRange"), Settings.RotationRange);
+
+    double Seed = 0.0;
+    if (Payload->TryGetNumberField(TEXT("randomSeed"), Seed))
+    {
+        Settings.RandomSeed = static_cast<int32>(Seed);
+    }
+}
+
+static TSharedPtr<FJsonObject> SplineScatterSettingsToJson(const FMcpSplineScatterSettings& Settings)
+{
+    TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+    Obj->SetNumberField(TEXT("spacing"), Settings.Spacing);
+    Obj->SetNumberField(TEXT("startOffset"), Settings.StartOffset);
+    Obj->SetNumberField(TEXT("endOffset"), Settings.EndOffset);
+    Obj->SetBoolField(TEXT("alignToSpline"), Settings.bAlignToSpline);
+    Obj->SetBoolField(TEXT("useRandomOffset"), Settings.bUseRandomOffset);
+    Obj->SetNumberField(TEXT("randomOffsetRange"), Settings.RandomOffsetRange);
+    Obj->SetBoolField(TEXT("randomizeScale"), Settings.bRandomizeScale);
+    Obj->SetNumberField(TEXT("minScale"), Settings.MinScale);
+    Obj->SetNumberField(TEXT("maxScale"), Settings.MaxScale);
+    Obj->SetBoolField(TEXT("randomizeRotation"), Settings.bRandomizeRotation);
+    Obj->SetObjectField(TEXT("rotationRandomRange"), McpHandlerUtils::RotatorToJson(Settings.RotationRange));
+    Obj->SetNumberField(TEXT("randomSeed"), Settings.RandomSeed);
+    return Obj;
+}
+
 static bool HandleScatterMeshesAlongSpline(
     UMcpAutomationBridgeSubsystem* Self,
     const FString& RequestId,
@@ -1355,26 +1517,50 @@ static bool HandleScatterMeshesAlongSpline(
     TSharedPtr<FMcpBridgeWebSocket> Socket)
 {
     FString ActorName = GetJsonStringFieldSpline(Payload, TEXT("actorName"));
-    FString MeshPath = GetJsonStringFieldSpline(Payload, TEXT("meshPath"));
-    double Spacing = GetJsonNumberFieldSpline(Payload, TEXT("spacing"), 100.0);
-    bool bAlignToSpline = GetJsonBoolFieldSpline(Payload, TEXT("alignToSpline"), true);
+    FString InstancingMode = GetJsonStringFieldSpline(Payload, TEXT("instancingMode"), TEXT("none")).ToLower();
+    bool bClearExisting = GetJsonBoolFieldSpline(Payload, TEXT("clearExisting"), false);
 
-    // Sanitize mesh path
-    FString SafeMeshPath = SanitizeProjectRelativePath(MeshPath);
-    if (SafeMeshPath.IsEmpty())
+    if (InstancingMode != TEXT("none") && InstancingMode != TEXT("ism") && InstancingMode != TEXT("hism"))
     {
         Self->SendAutomationResponse(Socket, RequestId, false,
-            FString::Printf(TEXT("Invalid or unsafe meshPath: %s. Path must be relative to project (e.g., /Game/...)"), *MeshPath),
-            nullptr, TEXT("SECURITY_VIOLATION"));
+            FString::Printf(TEXT("Invalid instancingMode: %s. Expected none, ism or hism"), *InstancingMode),
+            nullptr, TEXT("INVALID_PARAM"));
         return true;
     }
 
-    // Validate spacing to prevent division by zero
-    if (Spacing <= 0.0)
+    // Accept a single meshPath or a meshPaths array; samples are distributed
+    // across meshes by the seeded random stream.
+    TArray<FString> MeshPaths;
+    const TArray<TSharedPtr<FJsonValue>>* MeshPathsArray = nullptr;
+    if (Payload->TryGetArrayField(TEXT("meshPaths"), MeshPathsArray) && MeshPathsArray)
     {
-        Self->SendAutomationResponse(Socket, RequestId, false,
-            TEXT("spacing must be greater than 0"), nullptr, TEXT("INVALID_PARAM"));
-        return true;
+        for (const TSharedPtr<FJsonValue>& Value : *MeshPathsArray)
+        {
+            FString Path;
+            if (Value.IsValid() && Value->TryGetString(Path) && !Path.IsEmpty())
+            {
+                MeshPaths.Add(Path);
+            }
+        }
+    }
+    if (MeshPaths.Num() == 0)
+    {
+        MeshPaths.Add(GetJsonStringFieldSpline(Payload, TEXT("meshPath")));
+    }
+
+    // Sanitize mesh paths
+    TArray<FString> SafeMeshPaths;
+    for (const FString& MeshPath : MeshPaths)
+    {
+        FString SafeMeshPath = SanitizeProjectRelativePath(MeshPath);
+        if (SafeMeshPath.IsEmpty())
+        {
+            Self->SendAutomationResponse(Socket, RequestId, false,
+                FString::Printf(TEXT("Invalid or unsafe meshPath: %s. Path must be relative to project (e.g., /Game/...)"), *MeshPath),
+                nullptr, TEXT("SECURITY_VIOLATION"));
+            return true;
+        }
+        SafeMeshPaths.Add(SafeMeshPath);
     }
 
     UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
@@ -1401,72 +1587,253 @@ static bool HandleScatterMeshesAlongSpline(
         return true;
     }
 
-    UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *SafeMeshPath);
-    if (!Mesh)
+    // Stored settings first, explicit payload values win
+    FMcpSplineScatterSettings Settings;
+    ReadSplineScatterSettingsFromActor(Actor, Settings);
+    ApplySplineScatterSettingsFromPayload(Payload, Settings);
+
+    // Validate spacing to prevent division by zero
+    if (Settings.Spacing <= 0.0)
     {
         Self->SendAutomationResponse(Socket, RequestId, false,
-            FString::Printf(TEXT("Mesh not found: %s"), *SafeMeshPath), nullptr, TEXT("MESH_NOT_FOUND"));
+            TEXT("spacing must be greater than 0"), nullptr, TEXT("INVALID_PARAM"));
         return true;
     }
 
-    float SplineLength = SplineComp->GetSplineLength();
-    int32 MeshCount = FMath::FloorToInt(SplineLength / Spacing);
-    
-    TArray<FString> CreatedMeshes;
+    TArray<UStaticMesh*> Meshes;
+    for (const FString& SafeMeshPath : SafeMeshPaths)
+    {
+        UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, *SafeMeshPath);
+        if (!Mesh)
+        {
+            Self->SendAutomationResponse(Socket, RequestId, false,
+                FString::Printf(TEXT("Mesh not found: %s"), *SafeMeshPath), nullptr, TEXT("MESH_NOT_FOUND"));
+            return true;
+        }
+        Meshes.Add(Mesh);
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    int32 ComponentsRemoved = 0;
+    if (bClearExisting)
+    {
+        TArray<UActorComponent*> Previous;
+        Actor->GetComponents(Previous);
+        for (UActorComponent* Comp : Previous)
+        {
+            if (Comp && Comp->ComponentHasTag(SplineScatterComponentTag))
+            {
+                Actor->RemoveInstanceComponent(Comp);
+                Comp->DestroyComponent();
+                ComponentsRemoved++;
+            }
+        }
+    }
+
+    // Sample transforms along the spline, bucketed per mesh
+    const double SplineLength = SplineComp->GetSplineLength();
+    const double UsableEnd = SplineLength - FMath::Max(0.0, Settings.EndOffset);
+    const double UsableStart = FMath::Clamp(Settings.StartOffset, 0.0, SplineLength);
+    FRandomStream Random(Settings.RandomSeed);
+
+    TArray<TArray<FTransform>> TransformsPerMesh;
+    TransformsPerMesh.SetNum(Meshes.Num());
+    int32 SampleCount = 0;
 
-    for (int32 i = 0; i <= MeshCount; i++)
+    for (double Distance = UsableStart; Distance <= UsableEnd; Distance += Settings.Spacing)
     {
-        float Distance = i * Spacing;
-        FVector Location = SplineComp->GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World);
-        FRotator Rotation = bAlignToSpline 
-            ? SplineComp->GetRotationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::World)
+        double SampleDistance = Distance;
+        if (Settings.bUseRandomOffset && Settings.RandomOffsetRange > 0.0)
+        {
+            SampleDistance = FMath::Clamp(
+                SampleDistance + Random.FRandRange(-Settings.RandomOffsetRange, Settings.RandomOffsetRange),
+                0.0, SplineLength);
+        }
+
+        FVector Location = SplineComp->GetLocationAtDistanceAlongSpline(SampleDistance, ESplineCoordinateSpace::World);
+        FRotator Rotation = Settings.bAlignToSpline
+            ? SplineComp->GetRotationAtDistanceAlongSpline(SampleDistance, ESplineCoordinateSpace::World)
             : FRotator::ZeroRotator;
 
-        // Create a static mesh component for each instance
-        UStaticMeshComponent* MeshComp = NewObject<UStaticMeshComponent>(Actor);
-        if (MeshComp)
+        if (Settings.bRandomizeRotation)
         {
-            MeshComp->SetStaticMesh(Mesh);
-            MeshComp->SetWorldLocationAndRotation(Location, Rotation);
-            MeshComp->RegisterComponent();
-            Actor->AddInstanceComponent(MeshComp);
-            MeshComp->AttachToComponent(SplineComp, FAttachmentTransformRules::KeepWorldTransform);
-            CreatedMeshes.Add(MeshComp->GetName());
+            Rotation += FRotator(
+                Random.FRandRange(-0.5, 0.5) * Settings.RotationRange.Pitch,
+                Random.FRandRange(-0.5, 0.5) * Settings.RotationRange.Yaw,
+                Random.FRandRange(-0.5, 0.5) * Settings.RotationRange.Roll);
+        }
+
+        FVector Scale = FVector::OneVector;
+        if (Settings.bRandomizeScale)
+        {
+            Scale = FVector(Random.FRandRange(Settings.MinScale, Settings.MaxScale));
+        }
+
+        const int32 MeshIndex = Meshes.Num() > 1 ? Random.RandRange(0, Meshes.Num() - 1) : 0;
+        TransformsPerMesh[MeshIndex].Add(FTransform(Rotation, Location, Scale));
+        SampleCount++;
+    }
+
+    TArray<FString> CreatedComponents;
+
+    if (InstancingMode == TEXT("none"))
+    {
+        // One component per sample (legacy behaviour)
+        for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); ++MeshIndex)
+        {
+            for (const FTransform& Transform : TransformsPerMesh[MeshIndex])
+            {
+                UStaticMeshComponent* MeshComp = NewObject<UStaticMeshComponent>(Actor);
+                if (MeshComp)
+                {
+                    MeshComp->SetStaticMesh(Meshes[MeshIndex]);
+                    MeshComp->SetWorldTransform(Transform);
+                    MeshComp->ComponentTags.Add(SplineScatterComponentTag);
+                    MeshComp->RegisterComponent();
+                    Actor->AddInstanceComponent(MeshComp);
+                    MeshComp->AttachToComponent(SplineComp, FAttachmentTransformRules::KeepWorldTransform);
+                    CreatedComponents.Add(MeshComp->GetName());
+                }
+            }
+        }
+    }
+    else
+    {
+        // One ISM/HISM per mesh; instances stored relative to the spline
+        const bool bHierarchical = InstancingMode == TEXT("hism");
+        const FTransform SplineTransform = SplineComp->GetComponentTransform();
+
+        for (int32 MeshIndex = 0; MeshIndex < Meshes.Num(); ++MeshIndex)
+        {
+            if (TransformsPerMesh[MeshIndex].Num() == 0)
+            {
+                continue;
+            }
+
+            UInstancedStaticMeshComponent* InstancedComp = bHierarchical
+                ? NewObject<UHierarchicalInstancedStaticMeshComponent>(Actor)
+                : NewObject<UInstancedStaticMeshComponent>(Actor);
+            if (!InstancedComp)
+            {
+                continue;
+            }
+
+            InstancedComp->SetStaticMesh(Meshes[MeshIndex]);
+            InstancedComp->ComponentTags.Add(SplineScatterComponentTag);
+            InstancedComp->SetupAttachment(SplineComp);
+            InstancedComp->RegisterComponent();
+            Actor->AddInstanceComponent(InstancedComp);
+
+            TArray<FTransform> LocalTransforms;
+            LocalTransforms.Reserve(TransformsPerMesh[MeshIndex].Num());
+            for (const FTransform& Transform : TransformsPerMesh[MeshIndex])
+            {
+                LocalTransforms.Add(Transform.GetRelativeTransform(SplineTransform));
+            }
+            InstancedComp->AddInstances(LocalTransforms, /*bShouldReturnIndices*/ false);
+            CreatedComponents.Add(InstancedComp->GetName());
         }
     }
 
+    const double SpawnTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
     World->MarkPackageDirty();
 
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetNumberField(TEXT("meshesCreated"), CreatedMeshes.Num());
+    Result->SetNumberField(TEXT("meshesCreated"), SampleCount);
+    Result->SetNumberField(TEXT("instanceCount"), SampleCount);
+    Result->SetNumberField(TEXT("componentsCreated"), CreatedComponents.Num());
+    Result->SetNumberField(TEXT("componentsRemoved"), ComponentsRemoved);
+    Result->SetStringField(TEXT("instancingMode"), InstancingMode);
+    Result->SetNumberField(TEXT("spawnTimeMs"), SpawnTimeMs);
     Result->SetNumberField(TEXT("splineLength"), SplineLength);
-    Result->SetNumberField(TEXT("spacing"), Spacing);
+    Result->SetNumberField(TEXT("spacing"), Settings.Spacing);
+    Result->SetObjectField(TEXT("settings"), SplineScatterSettingsToJson(Settings));
 
     // Add verification data
     McpHandlerUtils::AddVerification(Result, Actor);
 
     Self->SendAutomationResponse(Socket, RequestId, true,
-        FString::Printf(TEXT("Scattered %d meshes along spline"), CreatedMeshes.Num()), Result);
+        FString::Printf(TEXT("Scattered %d meshes along spline using %d component(s)"), SampleCount, CreatedComponents.Num()), Result);
     return true;
 }
 
+// Resolves the spline actor targeted by configure_mesh_* and sends the error
+// response itself when it cannot be found.
+static AActor* ResolveSplineScatterActor(
+    UMcpAutomationBridgeSubsystem* Self,
+    const FString& RequestId,
+    const TSharedPtr<FJsonObject>& Payload,
+    TSharedPtr<FMcpBridgeWebSocket> Socket)
+{
+    FString ActorName = GetJsonStringFieldSpline(Payload, TEXT("actorName"));
+    if (ActorName.IsEmpty())
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("actorName is required to store scatter settings"), nullptr, TEXT("INVALID_PARAM"));
+        return nullptr;
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("No editor world available"), nullptr, TEXT("NO_WORLD"));
+        return nullptr;
+    }
+
+    AActor* Actor = FindActorByName(World, ActorName);
+    if (!Actor)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            FString::Printf(TEXT("Actor not found: %s"), *ActorName), nullptr, TEXT("NOT_FOUND"));
+        return nullptr;
+    }
+    return Actor;
+}
+
 static bool HandleConfigureMeshSpacing(
     UMcpAutomationBridgeSubsystem* Self,
     const FString& RequestId,
     const TSharedPtr<FJsonObject>& Payload,
     TSharedPtr<FMcpBridgeWebSocket> Socket)
 {
-    // VALIDATION-ONLY: This action validates spacing parameters and echoes them back.
-    // Storage is not implemented - spacing must be passed directly to scatter_meshes_along_spline.
-    // Future enhancement: Store in actor metadata via UMetaData component.
-    
+    AActor* Actor = ResolveSplineScatterActor(Self, RequestId, Payload, Socket);
+    if (!Actor)
+    {
+        return true;
+    }
+
+    FMcpSplineScatterSettings Settings;
+    ReadSplineScatterSettingsFromActor(Actor, Settings);
+    ApplySplineScatterSettingsFromPayload(Payload, Settings);
+
+    if (Settings.Spacing <= 0.0)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("spacing must be greater than 0"), nullptr, TEXT("INVALID_PARAM"));
+        return true;
+    }
+
+    Actor->Modify();
+    SetSplineScatterTag(Actor, TEXT("spacing"), FString::SanitizeFloat(Settings.Spacing));
+    SetSplineScatterTag(Actor, TEXT("startOffset"), FString::SanitizeFloat(Settings.StartOffset));
+    SetSplineScatterTag(Actor, TEXT("endOffset"), FString::SanitizeFloat(Settings.EndOffset));
+    SetSplineScatterTag(Actor, TEXT("useRandomOffset"), Settings.bUseRandomOffset ? TEXT("true") : TEXT("false"));
+    SetSplineScatterTag(Actor, TEXT("randomOffsetRange"), FString::SanitizeFloat(Settings.RandomOffsetRange));
+    Actor->MarkPackageDirty();
+
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetNumberField(TEXT("spacing"), GetJsonNumberFieldSpline(Payload, TEXT("spacing"), 100.0));
-    Result->SetBoolField(TEXT("useRandomOffset"), GetJsonBoolFieldSpline(Payload, TEXT("useRandomOffset"), false));
-    Result->SetNumberField(TEXT("randomOffsetRange"), GetJsonNumberFieldSpline(Payload, TEXT("randomOffsetRange"), 0.0));
+    Result->SetNumberField(TEXT("spacing"), Settings.Spacing);
+    Result->SetNumberField(TEXT("startOffset"), Settings.StartOffset);
+    Result->SetNumberField(TEXT("endOffset"), Settings.EndOffset);
+    Result->SetBoolField(TEXT("useRandomOffset"), Settings.bUseRandomOffset);
+    Result->SetNumberField(TEXT("randomOffsetRange"), Settings.RandomOffsetRange);
+    McpHandlerUtils::AddVerification(Result, Actor);
 
     Self->SendAutomationResponse(Socket, RequestId, true,
-        TEXT("Mesh spacing parameters validated (storage not implemented - pass to scatter_meshes_along_spline)"), Result);
+        FString::Printf(TEXT("Mesh spacing stored on '%s'"), *Actor->GetActorLabel()), Result);
     return true;
 }
 
@@ -1476,18 +1843,45 @@ static bool HandleConfigureMeshRandomization(
     const TSharedPtr<FJsonObject>& Payload,
     TSharedPtr<FMcpBridgeWebSocket> Socket)
 {
-    // VALIDATION-ONLY: This action validates randomization parameters and echoes them back.
-    // Storage is not implemented - pass randomization params to scatter_meshes_along_spline.
-    // Future enhancement: Store in actor metadata via UMetaData component.
+    AActor* Actor = ResolveSplineScatterActor(Self, RequestId, Payload, Socket);
+    if (!Actor)
+    {
+        return true;
+    }
+
+    FMcpSplineScatterSettings Settings;
+    ReadSplineScatterSettingsFromActor(Actor, Settings);
+    ApplySplineScatterSettingsFromPayload(Payload, Settings);
+
+    if (Settings.MinScale <= 0.0 || Settings.MaxScale < Settings.MinScale)
+    {
+        Self->SendAutomationResponse(Socket, RequestId, false,
+            TEXT("minScale must be > 0 and <= maxScale"), nullptr, TEXT("INVALID_PARAM"));
+        return true;
+    }
+
+    Actor->Modify();
+    SetSplineScatterTag(Actor, TEXT("randomizeScale"), Settings.bRandomizeScale ? TEXT("true") : TEXT("false"));
+    SetSplineScatterTag(Actor, TEXT("minScale"), FString::SanitizeFloat(Settings.MinScale));
+    SetSplineScatterTag(Actor, TEXT("maxScale"), FString::SanitizeFloat(Settings.MaxScale));
+    SetSplineScatterTag(Actor, TEXT("randomizeRotation"), Settings.bRandomizeRotation ? TEXT("true") : TEXT("false"));
+    SetSplineScatterTag(Actor, TEXT("rotationPitch"), FString::SanitizeFloat(Settings.RotationRange.Pitch));
+    SetSplineScatterTag(Actor, TEXT("rotationYaw"), FString::SanitizeFloat(Settings.RotationRange.Yaw));
+    SetSplineScatterTag(Actor, TEXT("rotationRoll"), FString::SanitizeFloat(Settings.RotationRange.Roll));
+    SetSplineScatterTag(Actor, TEXT("randomSeed"), FString::FromInt(Settings.RandomSeed));
+    Actor->MarkPackageDirty();
+
     TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-    Result->SetBoolField(TEXT("randomizeScale"), GetJsonBoolFieldSpline(Payload, TEXT("randomizeScale"), false));
-    Result->SetNumberField(TEXT("minScale"), GetJsonNumberFieldSpline(Payload, TEXT("minScale"), 0.8));
-    Result->SetNumberField(TEXT("maxScale"), GetJsonNumberFieldSpline(Payload, TEXT("maxScale"), 1.2));
-    Result->SetBoolField(TEXT("randomizeRotation"), GetJsonBoolFieldSpline(Payload, TEXT("randomizeRotation"), false));
-    Result->SetNumberField(TEXT("rotationRange"), GetJsonNumberFieldSpline(Payload, TEXT("rotationRange"), 360.0));
+    Result->SetBoolField(TEXT("randomizeScale"), Settings.bRandomizeScale);
+    Result->SetNumberField(TEXT("minScale"), Settings.MinScale);
+    Result->SetNumberField(TEXT("maxScale"), Settings.MaxScale);
+    Result->SetBoolField(TEXT("randomizeRotation"), Settings.bRandomizeRotation);
+    Result->SetObjectField(TEXT("rotationRandomRange"), McpHandlerUtils::RotatorToJson(Settings.RotationRange));
+    Result->SetNumberField(TEXT("randomSeed"), Settings.RandomSeed);
+    McpHandlerUtils::AddVerification(Result, Actor);
 
     Self->SendAutomationResponse(Socket, RequestId, true,
-        TEXT("Mesh randomization parameters validated (storage not implemented - pass to scatter_meshes_along_spline)"), Result);
+        FString::Printf(TEXT("Mesh randomization stored on '%s'"), *Actor->GetActorLabel()), Result);
     return true;
 }
 
@@ -1,7 +1,9 @@
 #include "McpAutomationBridgeGlobals.h"
+#include "McpBuildJobs.h"
 #include "Dom/JsonObject.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpHandlerUtils.h"
 
 #if WITH_EDITOR
 #include "Editor/UnrealEd/Public/Editor.h"
@@ -36,6 +38,8 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
   
   // Check if this handler should process this sub-action
   if (!Lower.StartsWith(TEXT("run_ubt")) &&
+      !Lower.EndsWith(TEXT("_ubt_job")) &&
+      Lower != TEXT("list_ubt_jobs") &&
       !Lower.StartsWith(TEXT("run_tests")) &&
       !Lower.StartsWith(TEXT("test_progress")) &&
       !Lower.StartsWith(TEXT("test_stale")) &&
@@ -52,206 +56,13 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
     return true;
   }
 
-  if (Lower == TEXT("run_ubt")) {
-    // Extract optional parameters
-    FString Target;
-    Payload->TryGetStringField(TEXT("target"), Target);
-    
-    FString Platform;
-    Payload->TryGetStringField(TEXT("platform"), Platform);
-    
-    FString Configuration;
-    Payload->TryGetStringField(TEXT("configuration"), Configuration);
-    
-    FString AdditionalArgs;
-    Payload->TryGetStringField(TEXT("additionalArgs"), AdditionalArgs);
-
-    // Build UBT path
-    FString EngineDir = FPaths::EngineDir();
-    FString UBTPath;
-    
-#if PLATFORM_WINDOWS
-    UBTPath = FPaths::Combine(EngineDir, TEXT("Build/BatchFiles/Build.bat"));
-#else
-    UBTPath = FPaths::Combine(EngineDir, TEXT("Build/BatchFiles/Build.sh"));
-#endif
-
-    if (!FPaths::FileExists(UBTPath)) {
-      SendAutomationError(RequestingSocket, RequestId,
-                          FString::Printf(TEXT("UBT not found at: %s"), *UBTPath),
-                          TEXT("UBT_NOT_FOUND"));
-      return true;
-    }
-
-    // Build command line arguments
-    FString Arguments;
-    
-    // Target (project or engine target)
-    if (!Target.IsEmpty()) {
-      Arguments += Target + TEXT(" ");
-    } else {
-      // Default to current project
-      FString ProjectPath = FPaths::GetProjectFilePath();
-      if (!ProjectPath.IsEmpty()) {
-        Arguments += FString::Printf(TEXT("-project=\"%s\" "), *ProjectPath);
-      }
-    }
-    
-    // Platform
-    if (!Platform.IsEmpty()) {
-      Arguments += Platform + TEXT(" ");
-    } else {
-#if PLATFORM_WINDOWS
-      Arguments += TEXT("Win64 ");
-#elif PLATFORM_MAC
-      Arguments += TEXT("Mac ");
-#else
-      Arguments += TEXT("Linux ");
-#endif
-    }
-    
-    // Configuration
-    if (!Configuration.IsEmpty()) {
-      Arguments += Configuration + TEXT(" ");
-    } else {
-      Arguments += TEXT("Development ");
-    }
-    
-    // Additional args
-    if (!AdditionalArgs.IsEmpty()) {
-      Arguments += AdditionalArgs;
-    }
-
-    // Use FMonitoredProcess for non-blocking execution with output capture
-    // For simplicity, we'll use a synchronous approach with timeout
-    int32 ReturnCode = -1;
-    FString StdOut;
-    FString StdErr;
-    
-    // Note: FPlatformProcess::ExecProcess is simpler but blocks
-    // Using CreateProc with pipes for better control
-    void* ReadPipe = nullptr;
-    void* WritePipe = nullptr;
-    FPlatformProcess::CreatePipe(ReadPipe, WritePipe);
-    
-    FProcHandle ProcessHandle = FPlatformProcess::CreateProc(
-        *UBTPath,
-        *Arguments,
-        false,  // bLaunchDetached
-        true,   // bLaunchHidden
-        true,   // bLaunchReallyHidden
-        nullptr, // OutProcessID
-        0,      // PriorityModifier
-        nullptr, // OptionalWorkingDirectory
-        WritePipe // PipeWriteChild
-    );
-
-    if (!ProcessHandle.IsValid()) {
-      FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
-      SendAutomationError(RequestingSocket, RequestId,
-                          TEXT("Failed to launch UBT process"),
-                          TEXT("PROCESS_LAUNCH_FAILED"));
-      return true;
-    }
-
-    // Read output with timeout (30 seconds max wait, but check periodically)
-    const double TimeoutSeconds = 300.0; // 5 minute timeout for builds
-    const double StartTime = FPlatformTime::Seconds();
-    
-    while (FPlatformProcess::IsProcRunning(ProcessHandle)) {
-      // Read available output
-      FString NewOutput = FPlatformProcess::ReadPipe(ReadPipe);
-      if (!NewOutput.IsEmpty()) {
-        StdOut += NewOutput;
-      }
-      
-      // Check timeout
-      if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds) {
-        FPlatformProcess::TerminateProc(ProcessHandle, true);
-        FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
-        
-        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-        Result->SetStringField(TEXT("output"), StdOut);
-        Result->SetBoolField(TEXT("timedOut"), true);
-        
-        SendAutomationResponse(RequestingSocket, RequestId, false,
-                               TEXT("UBT process timed out"), Result,
-                               TEXT("TIMEOUT"));
-        return true;
-      }
-      
-      // Small sleep to avoid busy waiting
-      FPlatformProcess::Sleep(0.1f);
-    }
-
-    // Read any remaining output
-    FString FinalOutput = FPlatformProcess::ReadPipe(ReadPipe);
-    if (!FinalOutput.IsEmpty()) {
-      StdOut += FinalOutput;
-    }
-
-    // Get return code
-    FPlatformProcess::GetProcReturnCode(ProcessHandle, &ReturnCode);
-    FPlatformProcess::CloseProc(ProcessHandle);
-    FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
-
-    TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-    Result->SetStringField(TEXT("output"), StdOut);
-    Result->SetNumberField(TEXT("returnCode"), ReturnCode);
-    Result->SetStringField(TEXT("ubtPath"), UBTPath);
-    Result->SetStringField(TEXT("arguments"), Arguments);
-
-    if (ReturnCode == 0) {
-      SendAutomationResponse(RequestingSocket, RequestId, true,
-                             TEXT("UBT completed successfully"), Result);
-    } else {
-      SendAutomationResponse(RequestingSocket, RequestId, false,
-                             FString::Printf(TEXT("UBT failed with code %d"), ReturnCode),
-                             Result, TEXT("UBT_FAILED"));
-    }
-    return true;
+  if (Lower == TEXT("run_ubt") || Lower == TEXT("get_ubt_job") ||
+      Lower == TEXT("cancel_ubt_job") || Lower == TEXT("list_ubt_jobs")) {
+    // system_control callers expect run_ubt to return the build result
+    return HandleUbtJobAction(RequestId, Lower, Payload, RequestingSocket, true);
   } else if (Lower == TEXT("run_tests")) {
-    // Extract test filter
-    FString Filter;
-    Payload->TryGetStringField(TEXT("filter"), Filter);
-    
-    FString TestName;
-    Payload->TryGetStringField(TEXT("test"), TestName);
-    
-    // If specific test name provided, use it as filter
-    if (!TestName.IsEmpty() && Filter.IsEmpty()) {
-      Filter = TestName;
-    }
-    
-    // Build automation test command
-    FString TestCommand;
-    if (Filter.IsEmpty()) {
-      // Run all tests
-      TestCommand = TEXT("automation RunAll");
-    } else {
-      // Run filtered tests
-      TestCommand = FString::Printf(TEXT("automation RunTests %s"), *Filter);
-    }
-
-    // Execute the automation command
-    if (GEngine && GEditor && GEditor->GetEditorWorldContext().World()) {
-      GEngine->Exec(GEditor->GetEditorWorldContext().World(), *TestCommand);
-      
-      TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
-      Result->SetStringField(TEXT("command"), TestCommand);
-      Result->SetStringField(TEXT("filter"), Filter);
-      
-      // Note: Automation tests run asynchronously in UE.
-      // The command starts the tests, but results come later via automation framework.
-      SendAutomationResponse(RequestingSocket, RequestId, true,
-                             TEXT("Automation tests started. Check Output Log for results."),
-                             Result);
-    } else {
-      SendAutomationError(RequestingSocket, RequestId,
-                          TEXT("Editor world not available for running tests"),
-                          TEXT("EDITOR_NOT_AVAILABLE"));
-    }
-    return true;
+    // Tests run in a headless editor process as a background job
+    return HandleUbtJobAction(RequestId, Lower, Payload, RequestingSocket, false);
   } else   if (Lower == TEXT("test_progress_protocol")) {
     // Test action for heartbeat/progress protocol
     // Simulates a long-running operation with progress updates
@@ -722,3 +533,196 @@ bool UMcpAutomationBridgeSubsystem::HandleSystemControlAction(
   return true;
 #endif
 }
+
+bool UMcpAutomationBridgeSubsystem::HandleUbtJobAction(
+    const FString &RequestId, const FString &SubAction,
+    const TSharedPtr<FJsonObject> &Payload,
+    TSharedPtr<FMcpBridgeWebSocket> RequestingSocket, bool bWaitByDefault) {
+#if WITH_EDITOR
+  if (SubAction == TEXT("list_ubt_jobs")) {
+    TSharedPtr<FJsonObject> Result = McpBuildJobs::ListJobs();
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+                           FString::Printf(TEXT("%d UBT jobs running, %d queued"),
+                                           static_cast<int32>(Result->GetNumberField(TEXT("running"))),
+                                           static_cast<int32>(Result->GetNumberField(TEXT("queued")))),
+                           Result);
+    return true;
+  }
+
+  if (SubAction == TEXT("get_ubt_job") || SubAction == TEXT("cancel_ubt_job")) {
+    FString JobId;
+    if (!Payload.IsValid() || !Payload->TryGetStringField(TEXT("jobId"), JobId) || JobId.IsEmpty()) {
+      SendAutomationError(RequestingSocket, RequestId, TEXT("jobId is required"),
+                          TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+
+    if (SubAction == TEXT("cancel_ubt_job")) {
+      FString State;
+      if (!McpBuildJobs::Cancel(JobId, State)) {
+        if (State.IsEmpty()) {
+          SendAutomationError(RequestingSocket, RequestId,
+                              FString::Printf(TEXT("UBT job not found: %s"), *JobId),
+                              TEXT("JOB_NOT_FOUND"));
+        } else {
+          SendAutomationError(RequestingSocket, RequestId,
+                              FString::Printf(TEXT("UBT job %s already finished (%s)"), *JobId, *State),
+                              TEXT("JOB_NOT_CANCELLABLE"));
+        }
+        return true;
+      }
+      TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+      Result->SetStringField(TEXT("jobId"), JobId);
+      Result->SetStringField(TEXT("state"), State);
+      SendAutomationResponse(RequestingSocket, RequestId, true,
+                             FString::Printf(TEXT("UBT job %s %s"), *JobId, *State), Result);
+      return true;
+    }
+
+    double SinceLine = 0.0;
+    double MaxLines = 200.0;
+    Payload->TryGetNumberField(TEXT("sinceLine"), SinceLine);
+    Payload->TryGetNumberField(TEXT("maxLines"), MaxLines);
+
+    TSharedPtr<FJsonObject> Result = McpBuildJobs::GetJob(
+        JobId, FMath::Max(0, static_cast<int32>(SinceLine)),
+        FMath::Clamp(static_cast<int32>(MaxLines), 0, 2000));
+    if (!Result.IsValid()) {
+      SendAutomationError(RequestingSocket, RequestId,
+                          FString::Printf(TEXT("UBT job not found: %s"), *JobId),
+                          TEXT("JOB_NOT_FOUND"));
+      return true;
+    }
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+                           FString::Printf(TEXT("UBT job %s is %s"), *JobId,
+                                           *Result->GetStringField(TEXT("state"))),
+                           Result);
+    return true;
+  }
+
+  if (SubAction != TEXT("run_ubt") && SubAction != TEXT("run_tests")) {
+    return false;
+  }
+
+  if (!Payload.IsValid()) {
+    SendAutomationError(RequestingSocket, RequestId,
+                        FString::Printf(TEXT("%s payload missing"), *SubAction),
+                        TEXT("INVALID_PAYLOAD"));
+    return true;
+  }
+
+  McpBuildJobs::FJobSpec Spec;
+  FString SpecError;
+  // Echoed in the response next to the job result
+  TSharedPtr<FJsonObject> JobFields = McpHandlerUtils::CreateResultObject();
+  bool bWait = bWaitByDefault;
+
+  if (SubAction == TEXT("run_tests")) {
+    FString Filter;
+    Payload->TryGetStringField(TEXT("filter"), Filter);
+    FString TestName;
+    Payload->TryGetStringField(TEXT("test"), TestName);
+    if (Filter.IsEmpty()) {
+      Filter = TestName;
+    }
+    Filter.TrimStartAndEndInline();
+
+    if (!McpBuildJobs::MakeAutomationTestJobSpec(Filter, Spec, SpecError)) {
+      SendAutomationError(RequestingSocket, RequestId, SpecError, TEXT("INVALID_ARGUMENT"));
+      return true;
+    }
+    JobFields->SetStringField(TEXT("filter"), Filter);
+    JobFields->SetStringField(TEXT("editorPath"), Spec.Executable);
+    // A headless editor takes minutes to boot, so tests never wait by default
+    bWait = false;
+  } else {
+    FString Target;
+    Payload->TryGetStringField(TEXT("target"), Target);
+
+    FString Platform;
+    Payload->TryGetStringField(TEXT("platform"), Platform);
+
+    FString Configuration;
+    Payload->TryGetStringField(TEXT("configuration"), Configuration);
+
+    // system_control uses additionalArgs, manage_pipeline extraArgs / arguments
+    FString AdditionalArgs;
+    if (!Payload->TryGetStringField(TEXT("additionalArgs"), AdditionalArgs) &&
+        !Payload->TryGetStringField(TEXT("extraArgs"), AdditionalArgs)) {
+      Payload->TryGetStringField(TEXT("arguments"), AdditionalArgs);
+    }
+
+    // Build.bat runs through cmd.exe, so refuse anything that chains commands
+    for (const TCHAR *Forbidden : {TEXT("\n"), TEXT("\r"), TEXT(";"), TEXT("|"),
+                                   TEXT("`"), TEXT("&"), TEXT(">"), TEXT("<")}) {
+      if (AdditionalArgs.Contains(Forbidden)) {
+        SendAutomationError(RequestingSocket, RequestId,
+                            TEXT("UBT arguments contain forbidden characters (newlines, ;, |, `, &, <, >)"),
+                            TEXT("INVALID_ARGUMENT"));
+        return true;
+      }
+    }
+
+    if (!McpBuildJobs::MakeUbtJobSpec(Target, Platform, Configuration, AdditionalArgs, Spec, SpecError)) {
+      SendAutomationError(RequestingSocket, RequestId, SpecError, TEXT("UBT_NOT_FOUND"));
+      return true;
+    }
+    JobFields->SetStringField(TEXT("target"), Target);
+    JobFields->SetStringField(TEXT("platform"), Platform);
+    JobFields->SetStringField(TEXT("configuration"), Configuration);
+    JobFields->SetStringField(TEXT("ubtPath"), Spec.Executable);
+  }
+
+  double TimeoutSeconds = Spec.TimeoutSeconds;
+  Payload->TryGetNumberField(TEXT("timeoutSeconds"), TimeoutSeconds);
+  Spec.TimeoutSeconds = FMath::Clamp(TimeoutSeconds, 10.0, 4.0 * 3600.0);
+
+  Payload->TryGetBoolField(TEXT("wait"), bWait);
+
+  if (!bWait) {
+    const FString JobId = McpBuildJobs::Start(Spec, nullptr, nullptr);
+    TSharedPtr<FJsonObject> Result = JobFields;
+    Result->SetStringField(TEXT("action"), SubAction);
+    Result->SetStringField(TEXT("jobId"), JobId);
+    Result->SetStringField(TEXT("arguments"), Spec.Arguments);
+    Result->SetBoolField(TEXT("processStarted"), true);
+    if (TSharedPtr<FJsonObject> Job = McpBuildJobs::GetJob(JobId, 0, 0)) {
+      Result->SetStringField(TEXT("state"), Job->GetStringField(TEXT("state")));
+    }
+    SendAutomationResponse(RequestingSocket, RequestId, true,
+                           FString::Printf(TEXT("%s started as job %s"), *Spec.Label, *JobId),
+                           Result);
+    return true;
+  }
+
+  // Respond when the process exits; output lines stream as progress updates
+  TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakThis(this);
+  const ERequestOrigin Origin = CurrentRequestOrigin;
+  McpBuildJobs::Start(
+      Spec,
+      [WeakThis, RequestId, Origin](float Percent, const FString &Message) {
+        if (UMcpAutomationBridgeSubsystem *Self = WeakThis.Get()) {
+          Self->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+        }
+      },
+      [WeakThis, RequestId, RequestingSocket, Origin, JobFields](
+          bool bSuccess, const FString &Message, const TSharedPtr<FJsonObject> &Result,
+          const FString &ErrorCode) {
+        if (UMcpAutomationBridgeSubsystem *Self = WeakThis.Get()) {
+          for (const TPair<FString, TSharedPtr<FJsonValue>> &Field : JobFields->Values) {
+            if (!Result->HasField(Field.Key)) {
+              Result->SetField(Field.Key, Field.Value);
+            }
+          }
+          Self->SendAutomationResponse(RequestingSocket, RequestId, bSuccess, Message,
+                                       Result, ErrorCode, Origin);
+        }
+      });
+  return true;
+#else
+  SendAutomationResponse(RequestingSocket, RequestId, false,
+                         TEXT("UBT jobs require editor build"),
+                         nullptr, TEXT("NOT_IMPLEMENTED"));
+  return true;
+#endif
+}
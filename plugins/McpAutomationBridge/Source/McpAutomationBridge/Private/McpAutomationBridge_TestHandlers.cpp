@@ -8,16 +8,17 @@
 // Handler Summary:
 // -----------------------------------------------------------------------------
 // Action: manage_tests
-//   - run_tests: Execute automation tests by filter via FAutomationTestFramework
+//   - run_tests: Run automation tests by filter as a background job
 // 
 // Dependencies:
 //   - Core: McpAutomationBridgeSubsystem, McpAutomationBridgeHelpers
-//   - Engine: AutomationTest module
+//   - McpBuildJobs: process supervision shared with run_ubt
 // 
 // Notes:
-//   - Tests run asynchronously; results appear in logs
-//   - StartTestByName() initiates test execution
-//   - For synchronous results, would require OnTestEnd delegate binding
+//   - Tests run in a separate headless UnrealEditor-Cmd, so this editor keeps
+//     serving requests; the response carries a jobId unless wait=true
+//   - get_ubt_job / cancel_ubt_job / list_ubt_jobs follow test jobs too, with
+//     passed / failed / skipped counts and the failed test paths
 // =============================================================================
 
 #include "McpVersionCompatibility.h"  // MUST be first - UE version compatibility macros
@@ -34,7 +35,6 @@
 // Engine Includes
 // -----------------------------------------------------------------------------
 #include "Dom/JsonObject.h"
-#include "Misc/AutomationTest.h"
 
 // =============================================================================
 // Handler Implementation
@@ -64,28 +64,11 @@ bool UMcpAutomationBridgeSubsystem::HandleTestAction(
     const FString SubAction = GetJsonStringField(Payload, TEXT("subAction"));
 
     // -------------------------------------------------------------------------
-    // run_tests: Execute automation tests by filter
+    // run_tests: Run automation tests by filter as a background job
     // -------------------------------------------------------------------------
     if (SubAction == TEXT("run_tests"))
     {
-        FString Filter;
-        Payload->TryGetStringField(TEXT("filter"), Filter);
-
-        // Note: FAutomationTestFramework::StartTestByName() runs asynchronously
-        // Results are delivered via OnTestEnd delegate (global)
-        // For this bridge, we confirm test initiation; check logs for results
-        
-        FAutomationTestFramework::Get().StartTestByName(Filter, 0);
-
-        // Build response
-        TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
-        Result->SetStringField(TEXT("action"), TEXT("run_tests"));
-        Result->SetStringField(TEXT("filter"), Filter);
-        Result->SetBoolField(TEXT("started"), true);
-
-        SendAutomationResponse(RequestingSocket, RequestId, true, 
-            TEXT("Tests started. Check logs for results."), Result);
-        return true;
+        return HandleUbtJobAction(RequestId, SubAction, Payload, RequestingSocket, false);
     }
 
     // Unknown subaction
@@ -5,7 +5,7 @@
 //
 // Implements procedural texture creation, processing, and settings management.
 //
-// HANDLERS IMPLEMENTED (28 subActions):
+// HANDLERS IMPLEMENTED (29 subActions):
 // ================================
 //
 // PROCEDURAL GENERATION:
@@ -30,7 +30,7 @@
 //   - invert                   : Channel inversion (R/G/B/A or All)
 //   - desaturate               : Rec.709 luminance grayscale conversion
 //   - adjust_levels            : Input/Output black/white point with gamma
-//   - blur                     : Box blur with configurable radius
+//   - blur                     : Separable box blur with configurable radius (1-64)
 //   - sharpen                  : Unsharp mask convolution
 //   - adjust_curves            : RGB curve adjustment via control points
 //
@@ -39,6 +39,9 @@
 //   - channel_extract          : Extract single channel to grayscale texture
 //   - combine_textures         : Blend two textures (Normal/Multiply/Screen/Overlay/Add)
 //
+// DIAGNOSTICS:
+//   - benchmark_image_kernels  : MP/s of the shared image kernels at 2k/4k/8k
+//
 // TEXTURE CREATION:
 //   - create_render_target     : UTextureRenderTarget2D creation
 //   - create_cube_texture      : Placeholder for cubemap (requires HDR import)
@@ -50,6 +53,7 @@
 //   - UE 5.0-5.7: All handlers supported
 //   - Uses McpSafeAssetSave() for UE 5.7+ safe asset saving
 //   - Source.LockMip/UnlockMip for proper streaming texture handling
+//   - Pixel processing runs through McpImageKernels (LUTs + ParallelFor row tiles)
 //
 // Copyright (c) 2025 MCP Automation Bridge Contributors
 // SPDX-License-Identifier: MIT
@@ -62,6 +66,7 @@
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpHandlerUtils.h"
+#include "McpImageKernels.h"
 #include "Dom/JsonObject.h"
 #include "Engine/Texture2D.h"
 #include "TextureResource.h"
@@ -346,43 +351,47 @@ TSharedPtr<FJsonObject> UMcpAutomationBridgeSubsystem::HandleManageTextureAction
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data"));
         }
         
-        for (int32 Y = 0; Y < Height; Y++)
+        // Rows are independent, so generate them in parallel tiles
+        McpImageKernels::ParallelForRows(Height, [&](int32 RowBegin, int32 RowEnd)
         {
-            for (int32 X = 0; X < Width; X++)
+            for (int32 Y = RowBegin; Y < RowEnd; Y++)
             {
-                float NX = static_cast<float>(X) / static_cast<float>(Width) * Scale;
-                float NY = static_cast<float>(Y) / static_cast<float>(Height) * Scale;
-                
-                // Seamless tiling using domain wrapping
-                float NoiseValue;
-                if (bSeamless)
-                {
-                    float Angle1 = NX * PI * 2.0f;
-                    float Angle2 = NY * PI * 2.0f;
-                    float NX3D = FMath::Cos(Angle1);
-                    float NY3D = FMath::Sin(Angle1);
-                    float NZ3D = FMath::Cos(Angle2);
-                    float NW3D = FMath::Sin(Angle2);
-                    NoiseValue = FBMNoise(NX3D + NZ3D, NY3D + NW3D, Octaves, Persistence, Lacunarity, Seed);
-                }
-                else
+                for (int32 X = 0; X < Width; X++)
                 {
-                    NoiseValue = FBMNoise(NX, NY, Octaves, Persistence, Lacunarity, Seed);
-                }
+                    float NX = static_cast<float>(X) / static_cast<float>(Width) * Scale;
+                    float NY = static_cast<float>(Y) / static_cast<float>(Height) * Scale;
                 
-                // Normalize to 0-1 range
-                NoiseValue = (NoiseValue + 1.0f) * 0.5f;
-                NoiseValue = FMath::Clamp(NoiseValue, 0.0f, 1.0f);
+                    // Seamless tiling using domain wrapping
+                    float NoiseValue;
+                    if (bSeamless)
+                    {
+                        float Angle1 = NX * PI * 2.0f;
+                        float Angle2 = NY * PI * 2.0f;
+                        float NX3D = FMath::Cos(Angle1);
+                        float NY3D = FMath::Sin(Angle1);
+                        float NZ3D = FMath::Cos(Angle2);
+                        float NW3D = FMath::Sin(Angle2);
+                        NoiseValue = FBMNoise(NX3D + NZ3D, NY3D + NW3D, Octaves, Persistence, Lacunarity, Seed);
+                    }
+                    else
+                    {
+                        NoiseValue = FBMNoise(NX, NY, Octaves, Persistence, Lacunarity, Seed);
+                    }
                 
-                // Write pixel data (BGRA8 format)
-                int32 PixelIndex = (Y * Width + X) * 4;
-                uint8 ByteValue = static_cast<uint8>(NoiseValue * 255.0f);
-                MipData[PixelIndex + 0] = ByteValue; // B
-                MipData[PixelIndex + 1] = ByteValue; // G
-                MipData[PixelIndex + 2] = ByteValue; // R
-                MipData[PixelIndex + 3] = 255;       // A
+                    // Normalize to 0-1 range
+                    NoiseValue = (NoiseValue + 1.0f) * 0.5f;
+                    NoiseValue = FMath::Clamp(NoiseValue, 0.0f, 1.0f);
+                
+                    // Write pixel data (BGRA8 format)
+                    int32 PixelIndex = (Y * Width + X) * 4;
+                    uint8 ByteValue = static_cast<uint8>(NoiseValue * 255.0f);
+                    MipData[PixelIndex + 0] = ByteValue; // B
+                    MipData[PixelIndex + 1] = ByteValue; // G
+                    MipData[PixelIndex + 2] = ByteValue; // R
+                    MipData[PixelIndex + 3] = 255;       // A
+                }
             }
-        }
+        });
         
         NewTexture->Source.UnlockMip(0);
         NewTexture->UpdateResource();
@@ -838,98 +847,102 @@ Response->SetBoolField(TEXT("success"), true);
         {
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock height map pixel data - texture may be compressed or streaming"));
         }
-        for (int32 i = 0; i < Width * Height; i++)
+        // Resolve the channel weights once; the per-pixel loop is then a weighted sum
+        // (BGRA format: index 0=B, 1=G, 2=R, 3=A)
+        float Weights[4] = { 0.0722f / 255.0f, 0.7152f / 255.0f, 0.2126f / 255.0f, 0.0f }; // Rec. 709 luminance
+        if (ChannelMode.Equals(TEXT("red"), ESearchCase::IgnoreCase))
         {
-            float HeightValue = 0.0f;
-            // BGRA format: index 0=B, 1=G, 2=R, 3=A
-            uint8 B = HeightPixels[i * 4 + 0];
-            uint8 G = HeightPixels[i * 4 + 1];
-            uint8 R = HeightPixels[i * 4 + 2];
-            uint8 A = HeightPixels[i * 4 + 3];
-            if (ChannelMode.Equals(TEXT("red"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = static_cast<float>(R) / 255.0f;
-            }
-            else if (ChannelMode.Equals(TEXT("green"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = static_cast<float>(G) / 255.0f;
-            }
-            else if (ChannelMode.Equals(TEXT("blue"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = static_cast<float>(B) / 255.0f;
-            }
-            else if (ChannelMode.Equals(TEXT("alpha"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = static_cast<float>(A) / 255.0f;
-            }
-            else if (ChannelMode.Equals(TEXT("average"), ESearchCase::IgnoreCase))
-            {
-                HeightValue = (static_cast<float>(R) + static_cast<float>(G) + static_cast<float>(B)) / (255.0f * 3.0f);
-            }
-            else // Default: Rec. 709 luminance coefficients for proper grayscale
+            Weights[0] = 0.0f; Weights[1] = 0.0f; Weights[2] = 1.0f / 255.0f; Weights[3] = 0.0f;
+        }
+        else if (ChannelMode.Equals(TEXT("green"), ESearchCase::IgnoreCase))
+        {
+            Weights[0] = 0.0f; Weights[1] = 1.0f / 255.0f; Weights[2] = 0.0f; Weights[3] = 0.0f;
+        }
+        else if (ChannelMode.Equals(TEXT("blue"), ESearchCase::IgnoreCase))
+        {
+            Weights[0] = 1.0f / 255.0f; Weights[1] = 0.0f; Weights[2] = 0.0f; Weights[3] = 0.0f;
+        }
+        else if (ChannelMode.Equals(TEXT("alpha"), ESearchCase::IgnoreCase))
+        {
+            Weights[0] = 0.0f; Weights[1] = 0.0f; Weights[2] = 0.0f; Weights[3] = 1.0f / 255.0f;
+        }
+        else if (ChannelMode.Equals(TEXT("average"), ESearchCase::IgnoreCase))
+        {
+            Weights[0] = Weights[1] = Weights[2] = 1.0f / (255.0f * 3.0f); Weights[3] = 0.0f;
+        }
+        
+        McpImageKernels::ParallelForRows(Height, [&](int32 RowBegin, int32 RowEnd)
+        {
+            for (int32 i = RowBegin * Width; i < RowEnd * Width; i++)
             {
-                // Y = 0.2126*R + 0.7152*G + 0.0722*B (ITU-R BT.709 standard)
-                HeightValue = (0.2126f * static_cast<float>(R) + 
-                               0.7152f * static_cast<float>(G) + 
-                               0.0722f * static_cast<float>(B)) / 255.0f;
+                const uint8* Pixel = HeightPixels + i * 4;
+                HeightData[i] = Weights[0] * Pixel[0] + Weights[1] * Pixel[1] + Weights[2] * Pixel[2] + Weights[3] * Pixel[3];
             }
-            HeightData[i] = HeightValue;
-        }
+        });
         HeightMap->Source.UnlockMip(0);
         
         // Generate normal map
         uint8* NormalData = NormalMap->Source.LockMip(0);
+        if (!NormalData)
+        {
+            TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock normal map texture data"));
+        }
         
-        for (int32 Y = 0; Y < Height; Y++)
+        const bool bSobel = (Algorithm == TEXT("Sobel"));
+        
+        // Sample neighboring heights with wrap
+        auto SampleHeight = [&HeightData, Width, Height](int32 SX, int32 SY) -> float {
+            SX = (SX + Width) % Width;
+            SY = (SY + Height) % Height;
+            return HeightData[SY * Width + SX];
+        };
+        
+        McpImageKernels::ParallelForRows(Height, [&](int32 RowBegin, int32 RowEnd)
         {
-            for (int32 X = 0; X < Width; X++)
+            for (int32 Y = RowBegin; Y < RowEnd; Y++)
             {
-                // Sample neighboring heights with wrap
-                auto SampleHeight = [&](int32 SX, int32 SY) -> float {
-                    SX = (SX + Width) % Width;
-                    SY = (SY + Height) % Height;
-                    return HeightData[SY * Width + SX];
-                };
-                
-                float DX, DY;
-                
-                if (Algorithm == TEXT("Sobel"))
-                {
-                    // Sobel operator
-                    DX = (SampleHeight(X - 1, Y - 1) * -1.0f + SampleHeight(X - 1, Y) * -2.0f + SampleHeight(X - 1, Y + 1) * -1.0f +
-                          SampleHeight(X + 1, Y - 1) * 1.0f + SampleHeight(X + 1, Y) * 2.0f + SampleHeight(X + 1, Y + 1) * 1.0f);
-                    DY = (SampleHeight(X - 1, Y - 1) * -1.0f + SampleHeight(X, Y - 1) * -2.0f + SampleHeight(X + 1, Y - 1) * -1.0f +
-                          SampleHeight(X - 1, Y + 1) * 1.0f + SampleHeight(X, Y + 1) * 2.0f + SampleHeight(X + 1, Y + 1) * 1.0f);
-                }
-                else
+                for (int32 X = 0; X < Width; X++)
                 {
-                    // Simple finite difference
-                    DX = SampleHeight(X + 1, Y) - SampleHeight(X - 1, Y);
-                    DY = SampleHeight(X, Y + 1) - SampleHeight(X, Y - 1);
-                }
-                
-                // Apply strength
-                DX *= Strength;
-                DY *= Strength;
-                
-                // Flip Y if needed (DirectX vs OpenGL)
-                if (bFlipY)
-                {
-                    DY = -DY;
+                    float DX, DY;
+                    
+                    if (bSobel)
+                    {
+                        // Sobel operator
+                        DX = (SampleHeight(X - 1, Y - 1) * -1.0f + SampleHeight(X - 1, Y) * -2.0f + SampleHeight(X - 1, Y + 1) * -1.0f +
+                              SampleHeight(X + 1, Y - 1) * 1.0f + SampleHeight(X + 1, Y) * 2.0f + SampleHeight(X + 1, Y + 1) * 1.0f);
+                        DY = (SampleHeight(X - 1, Y - 1) * -1.0f + SampleHeight(X, Y - 1) * -2.0f + SampleHeight(X + 1, Y - 1) * -1.0f +
+                              SampleHeight(X - 1, Y + 1) * 1.0f + SampleHeight(X, Y + 1) * 2.0f + SampleHeight(X + 1, Y + 1) * 1.0f);
+                    }
+                    else
+                    {
+                        // Simple finite difference
+                        DX = SampleHeight(X + 1, Y) - SampleHeight(X - 1, Y);
+                        DY = SampleHeight(X, Y + 1) - SampleHeight(X, Y - 1);
+                    }
+                    
+                    // Apply strength
+                    DX *= Strength;
+                    DY *= Strength;
+                    
+                    // Flip Y if needed (DirectX vs OpenGL)
+                    if (bFlipY)
+                    {
+                        DY = -DY;
+                    }
+                    
+                    // Create normal vector
+                    FVector3f Normal(-DX, -DY, 1.0f);
+                    Normal.Normalize();
+                    
+                    // Convert to 0-1 range
+                    int32 PixelIndex = (Y * Width + X) * 4;
+                    NormalData[PixelIndex + 0] = static_cast<uint8>((Normal.Z * 0.5f + 0.5f) * 255.0f); // B = Z
+                    NormalData[PixelIndex + 1] = static_cast<uint8>((Normal.Y * 0.5f + 0.5f) * 255.0f); // G = Y
+                    NormalData[PixelIndex + 2] = static_cast<uint8>((Normal.X * 0.5f + 0.5f) * 255.0f); // R = X
+                    NormalData[PixelIndex + 3] = 255;
                 }
-                
-                // Create normal vector
-                FVector Normal(-DX, -DY, 1.0f);
-                Normal.Normalize();
-                
-                // Convert to 0-1 range
-                int32 PixelIndex = (Y * Width + X) * 4;
-                NormalData[PixelIndex + 0] = static_cast<uint8>((Normal.Z * 0.5f + 0.5f) * 255.0f); // B = Z
-                NormalData[PixelIndex + 1] = static_cast<uint8>((Normal.Y * 0.5f + 0.5f) * 255.0f); // G = Y
-                NormalData[PixelIndex + 2] = static_cast<uint8>((Normal.X * 0.5f + 0.5f) * 255.0f); // R = X
-                NormalData[PixelIndex + 3] = 255;
             }
-        }
+        });
         
         NormalMap->Source.UnlockMip(0);
         NormalMap->UpdateResource();
@@ -1441,46 +1454,7 @@ Response->SetBoolField(TEXT("success"), true);
         }
         
         // Bilinear interpolation resize
-        for (int32 Y = 0; Y < NewHeight; ++Y)
-        {
-            for (int32 X = 0; X < NewWidth; ++X)
-            {
-                float U = static_cast<float>(X) / static_cast<float>(NewWidth - 1) * (SrcWidth - 1);
-                float V = static_cast<float>(Y) / static_cast<float>(NewHeight - 1) * (SrcHeight - 1);
-                
-                int32 X0 = FMath::FloorToInt(U);
-                int32 Y0 = FMath::FloorToInt(V);
-                int32 X1 = FMath::Min(X0 + 1, SrcWidth - 1);
-                int32 Y1 = FMath::Min(Y0 + 1, SrcHeight - 1);
-                
-                float FracX = U - X0;
-                float FracY = V - Y0;
-                
-                // Access BGRA pixel data (uint8* format)
-                auto GetPixelBGRA = [&](int32 PX, int32 PY) -> FColor {
-                    int32 Idx = (PY * SrcWidth + PX) * 4;
-                    return FColor(SrcData[Idx + 2], SrcData[Idx + 1], SrcData[Idx + 0], SrcData[Idx + 3]); // BGRA -> RGBA
-                };
-                
-                FColor C00 = GetPixelBGRA(X0, Y0);
-                FColor C10 = GetPixelBGRA(X1, Y0);
-                FColor C01 = GetPixelBGRA(X0, Y1);
-                FColor C11 = GetPixelBGRA(X1, Y1);
-                
-                // Bilinear interpolation
-                FColor SampledColor;
-                SampledColor.R = static_cast<uint8>(FMath::Lerp(FMath::Lerp((float)C00.R, (float)C10.R, FracX), FMath::Lerp((float)C01.R, (float)C11.R, FracX), FracY));
-                SampledColor.G = static_cast<uint8>(FMath::Lerp(FMath::Lerp((float)C00.G, (float)C10.G, FracX), FMath::Lerp((float)C01.G, (float)C11.G, FracX), FracY));
-                SampledColor.B = static_cast<uint8>(FMath::Lerp(FMath::Lerp((float)C00.B, (float)C10.B, FracX), FMath::Lerp((float)C01.B, (float)C11.B, FracX), FracY));
-                SampledColor.A = static_cast<uint8>(FMath::Lerp(FMath::Lerp((float)C00.A, (float)C10.A, FracX), FMath::Lerp((float)C01.A, (float)C11.A, FracX), FracY));
-                
-                int32 DstIndex = (Y * NewWidth + X) * 4;
-                DstMipData[DstIndex + 0] = SampledColor.B;
-                DstMipData[DstIndex + 1] = SampledColor.G;
-                DstMipData[DstIndex + 2] = SampledColor.R;
-                DstMipData[DstIndex + 3] = SampledColor.A;
-            }
-        }
+        McpImageKernels::ResizeBilinear(SrcData, SrcWidth, SrcHeight, DstMipData, NewWidth, NewHeight);
         
         SourceTexture->Source.UnlockMip(0);
         NewTexture->Source.UnlockMip(0);
@@ -1595,15 +1569,16 @@ Response->SetBoolField(TEXT("success"), true);
         bool bInvertB = Channel.Equals(TEXT("All"), ESearchCase::IgnoreCase) || Channel.Equals(TEXT("Blue"), ESearchCase::IgnoreCase);
         bool bInvertA = bInvertAlpha && (Channel.Equals(TEXT("All"), ESearchCase::IgnoreCase) || Channel.Equals(TEXT("Alpha"), ESearchCase::IgnoreCase));
         
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
+        uint8 InvertLUT[256];
+        for (int32 i = 0; i < 256; ++i)
         {
-            int32 Idx = i * 4;
-            if (bInvertB) MipData[Idx + 0] = 255 - MipData[Idx + 0]; // B
-            if (bInvertG) MipData[Idx + 1] = 255 - MipData[Idx + 1]; // G
-            if (bInvertR) MipData[Idx + 2] = 255 - MipData[Idx + 2]; // R
-            if (bInvertA) MipData[Idx + 3] = 255 - MipData[Idx + 3]; // A
+            InvertLUT[i] = static_cast<uint8>(255 - i);
         }
+        McpImageKernels::ApplyLUT(MipData, static_cast<int64>(Width) * Height,
+            bInvertB ? InvertLUT : nullptr,
+            bInvertG ? InvertLUT : nullptr,
+            bInvertR ? InvertLUT : nullptr,
+            bInvertA ? InvertLUT : nullptr);
         
         TargetTexture->Source.UnlockMip(0);
         TargetTexture->UpdateResource();
@@ -1709,21 +1684,7 @@ Response->SetBoolField(TEXT("success"), true);
         }
         
         Amount = FMath::Clamp(Amount, 0.0f, 1.0f);
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            uint8 B = MipData[Idx + 0];
-            uint8 G = MipData[Idx + 1];
-            uint8 R = MipData[Idx + 2];
-            
-            // Rec. 709 luminance coefficients
-            uint8 Gray = static_cast<uint8>(0.2126f * R + 0.7152f * G + 0.0722f * B);
-            
-            MipData[Idx + 0] = static_cast<uint8>(FMath::Lerp((float)B, (float)Gray, Amount));
-            MipData[Idx + 1] = static_cast<uint8>(FMath::Lerp((float)G, (float)Gray, Amount));
-            MipData[Idx + 2] = static_cast<uint8>(FMath::Lerp((float)R, (float)Gray, Amount));
-        }
+        McpImageKernels::Desaturate(MipData, static_cast<int64>(Width) * Height, Amount);
         
         TargetTexture->Source.UnlockMip(0);
         TargetTexture->UpdateResource();
@@ -1799,23 +1760,10 @@ Response->SetBoolField(TEXT("success"), true);
         OutBlack = FMath::Clamp(OutBlack, 0.0f, 1.0f);
         OutWhite = FMath::Clamp(OutWhite, 0.0f, 1.0f);
         
-        float InRange = FMath::Max(InWhite - InBlack, 0.001f);
-        float OutRange = OutWhite - OutBlack;
-        float InvGamma = 1.0f / Gamma;
-        
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            for (int32 c = 0; c < 3; ++c)
-            {
-                float Val = MipData[Idx + c] / 255.0f;
-                Val = FMath::Clamp((Val - InBlack) / InRange, 0.0f, 1.0f);
-                Val = FMath::Pow(Val, InvGamma);
-                Val = OutBlack + Val * OutRange;
-                MipData[Idx + c] = static_cast<uint8>(FMath::Clamp(Val * 255.0f, 0.0f, 255.0f));
-            }
-        }
+        // Levels are a pure per-value mapping, so evaluate the pow() once per byte value
+        uint8 LevelsLUT[256];
+        McpImageKernels::BuildLevelsLUT(InBlack, InWhite, Gamma, OutBlack, OutWhite, LevelsLUT);
+        McpImageKernels::ApplyLUT(MipData, static_cast<int64>(Width) * Height, LevelsLUT, LevelsLUT, LevelsLUT, nullptr);
         
         Texture->Source.UnlockMip(0);
         Texture->UpdateResource();
@@ -1885,7 +1833,7 @@ Response->SetBoolField(TEXT("success"), true);
         
         int32 Width = Texture->GetSizeX();
         int32 Height = Texture->GetSizeY();
-        Radius = FMath::Clamp(Radius, 1, 10);
+        Radius = FMath::Clamp(Radius, 1, 64);
         
         uint8* MipData = Texture->Source.LockMip(0);
         if (!MipData)
@@ -1893,42 +1841,8 @@ Response->SetBoolField(TEXT("success"), true);
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data - texture may be compressed or streaming"));
         }
         
-        // Create copy of original data
-        TArray<uint8> OriginalData;
-        int32 DataSize = Width * Height * 4;
-        OriginalData.SetNumUninitialized(DataSize);
-        FMemory::Memcpy(OriginalData.GetData(), MipData, DataSize);
-        
-        // Box blur
-        int32 KernelSize = Radius * 2 + 1;
-        float KernelWeight = 1.0f / (KernelSize * KernelSize);
-        
-        for (int32 Y = 0; Y < Height; ++Y)
-        {
-            for (int32 X = 0; X < Width; ++X)
-            {
-                float SumR = 0, SumG = 0, SumB = 0;
-                
-                for (int32 KY = -Radius; KY <= Radius; ++KY)
-                {
-                    for (int32 KX = -Radius; KX <= Radius; ++KX)
-                    {
-                        int32 SampleX = FMath::Clamp(X + KX, 0, Width - 1);
-                        int32 SampleY = FMath::Clamp(Y + KY, 0, Height - 1);
-                        int32 SampleIdx = (SampleY * Width + SampleX) * 4;
-                        
-                        SumB += OriginalData[SampleIdx + 0];
-                        SumG += OriginalData[SampleIdx + 1];
-                        SumR += OriginalData[SampleIdx + 2];
-                    }
-                }
-                
-                int32 DstIdx = (Y * Width + X) * 4;
-                MipData[DstIdx + 0] = static_cast<uint8>(SumB * KernelWeight);
-                MipData[DstIdx + 1] = static_cast<uint8>(SumG * KernelWeight);
-                MipData[DstIdx + 2] = static_cast<uint8>(SumR * KernelWeight);
-            }
-        }
+        // Separable sliding-window box blur (cost independent of radius)
+        McpImageKernels::BoxBlur(MipData, Width, Height, Radius);
         
         Texture->Source.UnlockMip(0);
         Texture->UpdateResource();
@@ -1992,37 +1906,9 @@ Response->SetBoolField(TEXT("success"), true);
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture mip data - texture may be compressed or streaming"));
         }
         
-        // Create copy of original data
-        TArray<uint8> OriginalData;
-        int32 DataSize = Width * Height * 4;
-        OriginalData.SetNumUninitialized(DataSize);
-        FMemory::Memcpy(OriginalData.GetData(), MipData, DataSize);
-        
         // Unsharp mask sharpening
         // Sharpen kernel: center = 1 + 4*amount, neighbors = -amount
-        for (int32 Y = 1; Y < Height - 1; ++Y)
-        {
-            for (int32 X = 1; X < Width - 1; ++X)
-            {
-                int32 CenterIdx = (Y * Width + X) * 4;
-                int32 LeftIdx = (Y * Width + X - 1) * 4;
-                int32 RightIdx = (Y * Width + X + 1) * 4;
-                int32 TopIdx = ((Y - 1) * Width + X) * 4;
-                int32 BottomIdx = ((Y + 1) * Width + X) * 4;
-                
-                for (int32 c = 0; c < 3; ++c)
-                {
-                    float Center = OriginalData[CenterIdx + c];
-                    float Left = OriginalData[LeftIdx + c];
-                    float Right = OriginalData[RightIdx + c];
-                    float Top = OriginalData[TopIdx + c];
-                    float Bottom = OriginalData[BottomIdx + c];
-                    
-                    float Sharpened = Center * (1.0f + 4.0f * Amount) - Amount * (Left + Right + Top + Bottom);
-                    MipData[CenterIdx + c] = static_cast<uint8>(FMath::Clamp(Sharpened, 0.0f, 255.0f));
-                }
-            }
-        }
+        McpImageKernels::Sharpen(MipData, Width, Height, Amount);
         
         Texture->Source.UnlockMip(0);
         Texture->UpdateResource();
@@ -2174,10 +2060,7 @@ Response->SetBoolField(TEXT("success"), true);
                 Data.Empty();
                 return Data;
             }
-            for (int32 i = 0; i < W * H; ++i)
-            {
-                Data[i] = MipData[i * 4 + ChannelIdx];
-            }
+            McpImageKernels::ExtractChannel(MipData, static_cast<int64>(W) * H, ChannelIdx, Data.GetData());
             Tex->Source.UnlockMip(0);
             return Data;
         };
@@ -2187,15 +2070,14 @@ Response->SetBoolField(TEXT("success"), true);
         TArray<uint8> BlueData = GetChannelData(BlueTex, 0);
         TArray<uint8> AlphaData = GetChannelData(AlphaTex, 3);
         
+        // Channels whose source is missing or smaller than the output fall back to
+        // 0 for colour and 255 for alpha
         int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            OutData[Idx + 0] = BlueData.Num() > i ? BlueData[i] : 0; // B
-            OutData[Idx + 1] = GreenData.Num() > i ? GreenData[i] : 0; // G
-            OutData[Idx + 2] = RedData.Num() > i ? RedData[i] : 0; // R
-            OutData[Idx + 3] = AlphaData.Num() > i ? AlphaData[i] : 255; // A
-        }
+        auto PlaneOrNull = [NumPixels](const TArray<uint8>& Plane) -> const uint8* {
+            return Plane.Num() >= NumPixels ? Plane.GetData() : nullptr;
+        };
+        McpImageKernels::InterleaveChannels(PlaneOrNull(BlueData), PlaneOrNull(GreenData), PlaneOrNull(RedData), PlaneOrNull(AlphaData),
+            NumPixels, OutData);
         
         OutputTexture->Source.UnlockMip(0);
         OutputTexture->UpdateResource();
@@ -2288,43 +2170,9 @@ Response->SetBoolField(TEXT("success"), true);
             TEXTURE_ERROR_RESPONSE(TEXT("Failed to lock texture data"));
         }
         
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            
-            for (int32 c = 0; c < 3; ++c)
-            {
-                float Base = BaseData[Idx + c] / 255.0f;
-                float Overlay = OverlayData[Idx + c] / 255.0f;
-                float Result;
-                
-                if (BlendMode.Equals(TEXT("Multiply"), ESearchCase::IgnoreCase))
-                {
-                    Result = Base * Overlay;
-                }
-                else if (BlendMode.Equals(TEXT("Screen"), ESearchCase::IgnoreCase))
-                {
-                    Result = 1.0f - (1.0f - Base) * (1.0f - Overlay);
-                }
-                else if (BlendMode.Equals(TEXT("Overlay"), ESearchCase::IgnoreCase))
-                {
-                    Result = Base < 0.5f ? 2.0f * Base * Overlay : 1.0f - 2.0f * (1.0f - Base) * (1.0f - Overlay);
-                }
-                else if (BlendMode.Equals(TEXT("Add"), ESearchCase::IgnoreCase))
-                {
-                    Result = FMath::Min(Base + Overlay, 1.0f);
-                }
-                else // Normal blend
-                {
-                    Result = Overlay;
-                }
-                
-                Result = FMath::Lerp(Base, Result, Opacity);
-                OutData[Idx + c] = static_cast<uint8>(FMath::Clamp(Result * 255.0f, 0.0f, 255.0f));
-            }
-            OutData[Idx + 3] = BaseData[Idx + 3]; // Keep base alpha
-        }
+        // Blend mode is resolved once; the kernel keeps the base alpha
+        McpImageKernels::Blend(BaseData, OverlayData, OutData, static_cast<int64>(Width) * Height,
+            McpImageKernels::ParseBlendMode(BlendMode), Opacity);
         
         BaseTex->Source.UnlockMip(0);
         OverlayTex->Source.UnlockMip(0);
@@ -2415,62 +2263,10 @@ Response->SetBoolField(TEXT("success"), true);
         }
         
         // Build 256-entry LUT via linear interpolation
-        auto BuildLUT = [](const TArray<float>& Input, const TArray<float>& Output) -> TArray<uint8> {
-            TArray<uint8> LUT;
-            LUT.SetNum(256);
-            
-            if (Input.Num() < 2 || Output.Num() < 2 || Input.Num() != Output.Num())
-            {
-                // Fallback: linear 1:1 mapping
-                for (int32 i = 0; i < 256; ++i)
-                {
-                    LUT[i] = static_cast<uint8>(i);
-                }
-                return LUT;
-            }
-            
-            for (int32 i = 0; i < 256; ++i)
-            {
-                float NormalizedInput = static_cast<float>(i) / 255.0f;
-                float Mapped = NormalizedInput;
-                
-                // Find segment in curve and interpolate
-                for (int32 j = 0; j < Input.Num() - 1; ++j)
-                {
-                    if (NormalizedInput >= Input[j] && NormalizedInput <= Input[j + 1])
-                    {
-                        float SegmentRange = Input[j + 1] - Input[j];
-                        if (SegmentRange > SMALL_NUMBER)
-                        {
-                            float T = (NormalizedInput - Input[j]) / SegmentRange;
-                            Mapped = FMath::Lerp(Output[j], Output[j + 1], T);
-                        }
-                        else
-                        {
-                            Mapped = Output[j];
-                        }
-                        break;
-                    }
-                }
-                
-                // Handle values outside the defined range
-                if (NormalizedInput < Input[0])
-                {
-                    Mapped = Output[0];
-                }
-                else if (NormalizedInput > Input[Input.Num() - 1])
-                {
-                    Mapped = Output[Output.Num() - 1];
-                }
-                
-                LUT[i] = static_cast<uint8>(FMath::Clamp(Mapped * 255.0f, 0.0f, 255.0f));
-            }
-            return LUT;
-        };
-        
-        TArray<uint8> LUT_R = BuildLUT(InputPointsR, OutputPointsR);
-        TArray<uint8> LUT_G = BuildLUT(InputPointsG, OutputPointsG);
-        TArray<uint8> LUT_B = BuildLUT(InputPointsB, OutputPointsB);
+        uint8 LUT_R[256], LUT_G[256], LUT_B[256];
+        McpImageKernels::BuildCurveLUT(InputPointsR, OutputPointsR, LUT_R);
+        McpImageKernels::BuildCurveLUT(InputPointsG, OutputPointsG, LUT_G);
+        McpImageKernels::BuildCurveLUT(InputPointsB, OutputPointsB, LUT_B);
         
         UTexture2D* TargetTexture = SourceTexture;
         if (!bInPlace)
@@ -2500,15 +2296,7 @@ Response->SetBoolField(TEXT("success"), true);
         }
         
         // Apply LUT to each pixel (BGRA format: B=0, G=1, R=2, A=3)
-        int32 NumPixels = Width * Height;
-        for (int32 i = 0; i < NumPixels; ++i)
-        {
-            int32 Idx = i * 4;
-            MipData[Idx + 0] = LUT_B[MipData[Idx + 0]]; // B
-            MipData[Idx + 1] = LUT_G[MipData[Idx + 1]]; // G
-            MipData[Idx + 2] = LUT_R[MipData[Idx + 2]]; // R
-            // Alpha unchanged
-        }
+        McpImageKernels::ApplyLUT(MipData, static_cast<int64>(Width) * Height, LUT_B, LUT_G, LUT_R, nullptr); // Alpha unchanged
         
         TargetTexture->Source.UnlockMip(0);
         TargetTexture->UpdateResource();
@@ -2529,6 +2317,41 @@ Response->SetBoolField(TEXT("success"), true);
         return Response;
     }
     
+    // ===== benchmark_image_kernels =====
+    // Time the shared image kernels on synthetic images and report megapixels/sec
+    if (SubAction == TEXT("benchmark_image_kernels"))
+    {
+        TArray<int32> Sizes;
+        const TArray<TSharedPtr<FJsonValue>>* SizesArray = nullptr;
+        if (Params->TryGetArrayField(TEXT("sizes"), SizesArray) && SizesArray)
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *SizesArray)
+            {
+                const int32 Size = Value.IsValid() ? static_cast<int32>(Value->AsNumber()) : 0;
+                if (Size < 64 || Size > 8192)
+                {
+                    TEXTURE_ERROR_RESPONSE(FString::Printf(TEXT("sizes entries must be between 64 and 8192 (got %d)"), Size));
+                }
+                Sizes.Add(Size);
+            }
+        }
+        if (Sizes.Num() == 0)
+        {
+            Sizes = { 2048, 4096, 8192 };
+        }
+        int32 Iterations = static_cast<int32>(GetNumberFieldTextAuth(Params, TEXT("iterations"), 3));
+        
+        TSharedPtr<FJsonObject> Report = McpImageKernels::RunBenchmark(Sizes, Iterations);
+        for (const auto& Field : Report->Values)
+        {
+            Response->SetField(Field.Key, Field.Value);
+        }
+        
+        Response->SetBoolField(TEXT("success"), true);
+        Response->SetStringField(TEXT("message"), FString::Printf(TEXT("Benchmarked image kernels at %d size(s)"), Sizes.Num()));
+        return Response;
+    }
+    
     // ===== channel_extract =====
     // Extract a single channel (R, G, B, or A) to a new grayscale texture
     if (SubAction == TEXT("channel_extract"))
@@ -2610,34 +2433,12 @@ Response->SetBoolField(TEXT("success"), true);
         }
         
         // Determine which channel to extract
-        // BGRA format: index 0=B, 1=G, 2=R, 3=A
-        for (int32 i = 0; i < Width * Height; ++i)
-        {
-            int32 Idx = i * 4;
-            uint8 Value;
-            if (Channel.Equals(TEXT("R"), ESearchCase::IgnoreCase))
-            {
-                Value = SrcData[Idx + 2]; // R is at index 2 in BGRA
-            }
-            else if (Channel.Equals(TEXT("G"), ESearchCase::IgnoreCase))
-            {
-                Value = SrcData[Idx + 1]; // G is at index 1 in BGRA
-            }
-            else if (Channel.Equals(TEXT("B"), ESearchCase::IgnoreCase))
-            {
-                Value = SrcData[Idx + 0]; // B is at index 0 in BGRA
-            }
-            else if (Channel.Equals(TEXT("A"), ESearchCase::IgnoreCase))
-            {
-                Value = SrcData[Idx + 3]; // A is at index 3 in BGRA
-            }
-            else
-            {
-                // Default to R if invalid channel specified
-                Value = SrcData[Idx + 2];
-            }
-            DestData[i] = Value;
-        }
+        // BGRA format: index 0=B, 1=G, 2=R, 3=A (default to R if invalid channel specified)
+        int32 ChannelIndex = 2;
+        if (Channel.Equals(TEXT("G"), ESearchCase::IgnoreCase)) ChannelIndex = 1;
+        else if (Channel.Equals(TEXT("B"), ESearchCase::IgnoreCase)) ChannelIndex = 0;
+        else if (Channel.Equals(TEXT("A"), ESearchCase::IgnoreCase)) ChannelIndex = 3;
+        McpImageKernels::ExtractChannel(SrcData, static_cast<int64>(Width) * Height, ChannelIndex, DestData);
         
         NewTexture->Source.UnlockMip(0);
         SourceTexture->Source.UnlockMip(0);
@@ -8,7 +8,10 @@
 // system_control / manage_ui:
 //   - create_widget: Create UMG widget blueprint
 //   - add_widget_child: Add child widget to widget tree
-//   - screenshot: Capture viewport screenshot with base64 encoding
+//   - screenshot: Async viewport capture (GPU readback + worker encode),
+//     optional crop/downscale, PNG or JPEG, delivered as a file path
+//   - subscribe_viewport_stream / unsubscribe_viewport_stream /
+//     get_viewport_stream_stats: Rate-limited frame streaming with drop-on-busy
 //   - play_in_editor: Start PIE session
 //   - stop_play: Stop PIE session
 //   - save_all: Save all assets
@@ -21,8 +24,8 @@
 //
 // VERSION COMPATIBILITY:
 // ----------------------
-// UE 5.0: FImageUtils::CompressImageArray (no ThumbnailCompressImageArray)
-// UE 5.1+: FImageUtils::ThumbnailCompressImageArray available
+// Screenshot readback: FRHIGPUTextureReadback lock API differs before UE 5.2
+// (handled in McpViewportCapture.cpp)
 // WidgetBlueprintFactory: Header location varies by UE version
 //
 // SECURITY:
@@ -44,6 +47,10 @@
 #include "McpHandlerUtils.h"
 #include "McpAutomationBridgeHelpers.h"
 #include "McpAutomationBridgeSubsystem.h"
+#include "McpViewportCapture.h"
+#include "McpViewportStream.h"
+#include "McpBridgeWebSocket.h"
+#include "MCP/McpNativeTransport.h"
 
 // =============================================================================
 // Editor-Only Headers
@@ -64,18 +71,17 @@
 #include "WidgetBlueprint.h"
 
 // Engine & Rendering
+#include "Async/Async.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/Texture2D.h"
 #include "Framework/Application/SlateApplication.h"
 #include "HAL/FileManager.h"
 #include "Misc/ConfigCacheIni.h"
-#include "IImageWrapper.h"
-#include "IImageWrapperModule.h"
-#include "ImageUtils.h"
 #include "Misc/Base64.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Modules/ModuleManager.h"
+#include "Serialization/JsonSerializer.h"
 #include "UnrealClient.h"
 
 // Widget Factory (version-dependent header location)
@@ -345,7 +351,7 @@ bool UMcpAutomationBridgeSubsystem::HandleUiAction(
   // SubAction: screenshot
   // ===========================================================================
   else if (LowerSub == TEXT("screenshot")) {
-    // Take a screenshot of the viewport and return as base64
+    // Capture the viewport without blocking the game thread and save it to disk
     FString RawScreenshotPath;
     Payload->TryGetStringField(TEXT("path"), RawScreenshotPath);
 
@@ -399,98 +405,285 @@ bool UMcpAutomationBridgeSubsystem::HandleUiAction(
                                  FDateTime::Now().ToUnixTimestamp());
     }
 
-    bool bReturnBase64 = true;
+    // Strip a caller-supplied image extension; the encoder picks the real one
+    if (Filename.EndsWith(TEXT(".png"), ESearchCase::IgnoreCase) ||
+        Filename.EndsWith(TEXT(".jpg"), ESearchCase::IgnoreCase) ||
+        Filename.EndsWith(TEXT(".jpeg"), ESearchCase::IgnoreCase)) {
+      Filename = FPaths::GetBaseFilename(Filename);
+    }
+
+    // Bytes are delivered through the saved file by default; inline base64
+    // only when explicitly requested (delivery: "base64" or returnBase64: true)
+    bool bReturnBase64 = false;
     Payload->TryGetBoolField(TEXT("returnBase64"), bReturnBase64);
+    FString Delivery;
+    if (Payload->TryGetStringField(TEXT("delivery"), Delivery) && !Delivery.IsEmpty()) {
+      bReturnBase64 = Delivery.Equals(TEXT("base64"), ESearchCase::IgnoreCase);
+    }
+
+    McpViewportCapture::FEncodeOptions EncodeOptions;
+    FString OptionsError;
+    FViewport *Viewport = McpViewportCapture::FindCaptureViewport();
 
-    // Get viewport
-    if (!GEngine || !GEngine->GameViewport) {
-      Message = TEXT("No game viewport available");
+    if (!McpViewportCapture::ParseEncodeOptions(Payload, EncodeOptions, OptionsError)) {
+      Message = OptionsError;
+      ErrorCode = TEXT("INVALID_ARGUMENT");
+      Resp->SetStringField(TEXT("error"), Message);
+    } else if (!Viewport) {
+      Message = TEXT("No viewport available");
       ErrorCode = TEXT("NO_VIEWPORT");
       Resp->SetStringField(TEXT("error"), Message);
     } else {
-      UGameViewportClient *ViewportClient = GEngine->GameViewport;
-      FViewport *Viewport = ViewportClient->Viewport;
-
-      if (!Viewport) {
-        Message = TEXT("No viewport available");
-        ErrorCode = TEXT("NO_VIEWPORT");
-        Resp->SetStringField(TEXT("error"), Message);
-      } else {
-        // Capture viewport pixels
-        TArray<FColor> Bitmap;
-        FIntVector Size(Viewport->GetSizeXY().X, Viewport->GetSizeXY().Y, 0);
+      // Readback completes on a later frame and encoding runs on a worker, so
+      // the game thread only pays for queuing the copy. The response is sent
+      // from the completion callbacks below.
+      McpViewportCapture::PreloadEncoder();
+      IFileManager::Get().MakeDirectory(*ScreenshotPath, true);
 
-        bool bReadSuccess = Viewport->ReadPixels(Bitmap);
+      const FString Extension =
+          EncodeOptions.Format == TEXT("jpeg") ? TEXT("jpg") : TEXT("png");
+      FString FullPath =
+          FPaths::Combine(ScreenshotPath, Filename + TEXT(".") + Extension);
+      FPaths::MakeStandardFilename(FullPath);
 
-        if (!bReadSuccess || Bitmap.Num() == 0) {
-          Message = TEXT("Failed to read viewport pixels");
-          ErrorCode = TEXT("CAPTURE_FAILED");
-          Resp->SetStringField(TEXT("error"), Message);
-        } else {
-          // Ensure we have the right size
-          const int32 Width = Size.X;
-          const int32 Height = Size.Y;
-
-          // Compress to PNG
-          // Note: ThumbnailCompressImageArray was introduced in UE 5.1
-          TArray<uint8> PngData;
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
-          FImageUtils::ThumbnailCompressImageArray(Width, Height, Bitmap,
-                                                   PngData);
-#else
-          // UE 5.0 fallback - use CompressImageArray
-          FImageUtils::CompressImageArray(Width, Height, Bitmap, PngData);
-#endif
+      const double RequestStart = FPlatformTime::Seconds();
+      const ERequestOrigin Origin = CurrentRequestOrigin;
+      TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakThis(this);
 
-          if (PngData.Num() == 0) {
-            // Alternative: compress as PNG using IImageWrapper
-            IImageWrapperModule &ImageWrapperModule =
-                FModuleManager::LoadModuleChecked<IImageWrapperModule>(
-                    FName("ImageWrapper"));
-            TSharedPtr<IImageWrapper> ImageWrapper =
-                ImageWrapperModule.CreateImageWrapper(EImageFormat::PNG);
-
-            if (ImageWrapper.IsValid()) {
-              TArray<uint8> RawData;
-              RawData.SetNum(Width * Height * 4);
-              for (int32 i = 0; i < Bitmap.Num(); ++i) {
-                RawData[i * 4 + 0] = Bitmap[i].R;
-                RawData[i * 4 + 1] = Bitmap[i].G;
-                RawData[i * 4 + 2] = Bitmap[i].B;
-                RawData[i * 4 + 3] = Bitmap[i].A;
-              }
+      McpViewportCapture::ReadViewportAsync(
+          Viewport,
+          [WeakThis, RequestId, RequestingSocket, Origin, FullPath, Filename,
+           EncodeOptions, bReturnBase64, RequestStart](
+              bool bReadOk, TArray<FColor> &&Pixels, int32 SourceWidth,
+              int32 SourceHeight, const FString &ReadError) {
+            UMcpAutomationBridgeSubsystem *Self = WeakThis.Get();
+            if (!Self) {
+              return;
+            }
+            const double ReadbackSeconds = FPlatformTime::Seconds() - RequestStart;
 
-              if (ImageWrapper->SetRaw(RawData.GetData(), RawData.Num(), Width,
-                                       Height, ERGBFormat::RGBA, 8)) {
-                PngData = ImageWrapper->GetCompressed(100);
-              }
+            if (!bReadOk) {
+              TSharedPtr<FJsonObject> ErrorResp = McpHandlerUtils::CreateResultObject();
+              ErrorResp->SetStringField(TEXT("action"), TEXT("screenshot"));
+              ErrorResp->SetStringField(TEXT("error"), ReadError);
+              Self->SendAutomationResponse(RequestingSocket, RequestId, false,
+                                           ReadError, ErrorResp,
+                                           TEXT("CAPTURE_FAILED"), Origin);
+              return;
             }
-          }
 
-          FString FullPath =
-              FPaths::Combine(ScreenshotPath, Filename + TEXT(".png"));
-          FPaths::MakeStandardFilename(FullPath);
+            Async(EAsyncExecution::ThreadPool,
+                  [WeakThis, RequestId, RequestingSocket, Origin, FullPath,
+                   Filename, EncodeOptions, bReturnBase64, RequestStart,
+                   ReadbackSeconds, SourceWidth, SourceHeight,
+                   Pixels = MoveTemp(Pixels)]() mutable {
+                    McpViewportCapture::FEncodedImage Image;
+                    FString EncodeError;
+                    const bool bEncoded = McpViewportCapture::EncodeImage(
+                        MoveTemp(Pixels), SourceWidth, SourceHeight,
+                        EncodeOptions, Image, EncodeError);
 
-          // Always save to disk
-          IFileManager::Get().MakeDirectory(*ScreenshotPath, true);
-          bool bSaved = FFileHelper::SaveArrayToFile(PngData, *FullPath);
+                    bool bSaved = false;
+                    double WriteSeconds = 0.0;
+                    FString Base64Data;
+                    if (bEncoded) {
+                      const double WriteStart = FPlatformTime::Seconds();
+                      bSaved = FFileHelper::SaveArrayToFile(Image.Bytes, *FullPath);
+                      WriteSeconds = FPlatformTime::Seconds() - WriteStart;
+                      if (bReturnBase64) {
+                        Base64Data = FBase64::Encode(Image.Bytes);
+                      }
+                    }
 
-          bSuccess = true;
-          Message = FString::Printf(TEXT("Screenshot captured (%dx%d)"), Width,
-                                    Height);
-          Resp->SetStringField(TEXT("screenshotPath"), FullPath);
-          Resp->SetStringField(TEXT("filename"), Filename);
-          Resp->SetNumberField(TEXT("width"), Width);
-          Resp->SetNumberField(TEXT("height"), Height);
-          Resp->SetNumberField(TEXT("sizeBytes"), PngData.Num());
-
-          // Return base64 encoded image if requested
-          if (bReturnBase64 && PngData.Num() > 0) {
-            FString Base64Data = FBase64::Encode(PngData);
-            Resp->SetStringField(TEXT("imageBase64"), Base64Data);
-            Resp->SetStringField(TEXT("mimeType"), TEXT("image/png"));
+                    AsyncTask(ENamedThreads::GameThread,
+                              [WeakThis, RequestId, RequestingSocket, Origin,
+                               FullPath, Filename, EncodeOptions, RequestStart,
+                               ReadbackSeconds, WriteSeconds, SourceWidth,
+                               SourceHeight, bEncoded, bSaved, EncodeError,
+                               Image = MoveTemp(Image),
+                               Base64Data = MoveTemp(Base64Data)]() {
+                      UMcpAutomationBridgeSubsystem *Self = WeakThis.Get();
+                      if (!Self) {
+                        return;
+                      }
+
+                      TSharedPtr<FJsonObject> Result = McpHandlerUtils::CreateResultObject();
+                      Result->SetStringField(TEXT("action"), TEXT("screenshot"));
+                      if (!bEncoded || !bSaved) {
+                        const FString Error = bEncoded
+                            ? FString::Printf(TEXT("Failed to write screenshot to %s"), *FullPath)
+                            : EncodeError;
+                        Result->SetStringField(TEXT("error"), Error);
+                        Self->SendAutomationResponse(
+                            RequestingSocket, RequestId, false, Error, Result,
+                            bEncoded ? TEXT("WRITE_FAILED") : TEXT("ENCODE_FAILED"),
+                            Origin);
+                        return;
+                      }
+
+                      const double TotalSeconds = FPlatformTime::Seconds() - RequestStart;
+                      Result->SetStringField(TEXT("screenshotPath"), FullPath);
+                      Result->SetStringField(TEXT("filename"), Filename);
+                      Result->SetNumberField(TEXT("width"), Image.Width);
+                      Result->SetNumberField(TEXT("height"), Image.Height);
+                      Result->SetNumberField(TEXT("sourceWidth"), SourceWidth);
+                      Result->SetNumberField(TEXT("sourceHeight"), SourceHeight);
+                      Result->SetStringField(TEXT("format"), EncodeOptions.Format);
+                      Result->SetStringField(TEXT("mimeType"), Image.MimeType);
+                      if (EncodeOptions.Format == TEXT("jpeg")) {
+                        Result->SetNumberField(TEXT("quality"), EncodeOptions.Quality);
+                      }
+                      Result->SetNumberField(TEXT("sizeBytes"), Image.Bytes.Num());
+                      Result->SetStringField(TEXT("delivery"),
+                                             Base64Data.IsEmpty() ? TEXT("file") : TEXT("base64"));
+                      if (!Base64Data.IsEmpty()) {
+                        Result->SetStringField(TEXT("imageBase64"), Base64Data);
+                      }
+
+                      TSharedPtr<FJsonObject> Timings = MakeShared<FJsonObject>();
+                      Timings->SetNumberField(TEXT("readbackMs"), ReadbackSeconds * 1000.0);
+                      Timings->SetNumberField(TEXT("resizeMs"), Image.ResizeSeconds * 1000.0);
+                      Timings->SetNumberField(TEXT("compressMs"), Image.CompressSeconds * 1000.0);
+                      Timings->SetNumberField(TEXT("writeMs"), WriteSeconds * 1000.0);
+                      Timings->SetNumberField(TEXT("totalMs"), TotalSeconds * 1000.0);
+                      Result->SetObjectField(TEXT("timings"), Timings);
+                      Result->SetNumberField(TEXT("latencyMs"), TotalSeconds * 1000.0);
+
+                      Self->SendAutomationResponse(
+                          RequestingSocket, RequestId, true,
+                          FString::Printf(TEXT("Screenshot captured (%dx%d)"),
+                                          Image.Width, Image.Height),
+                          Result, FString(), Origin);
+                    });
+                  });
+          });
+      return true;
+    }
+  }
+  // ===========================================================================
+  // SubAction: subscribe_viewport_stream
+  // ===========================================================================
+  else if (LowerSub == TEXT("subscribe_viewport_stream")) {
+    // Continuous capture at a target FPS. Frames go out as binary WebSocket
+    // messages (or SSE notifications for native HTTP clients) and are dropped
+    // rather than queued while the previous frame is still in flight.
+    McpViewportStream::FStreamSettings Settings;
+    Settings.Encode.Format = TEXT("jpeg");
+    Settings.Encode.Quality = 70;
+    FString OptionsError;
+    double Number = 0.0;
+    if (Payload->TryGetNumberField(TEXT("fps"), Number)) {
+      Settings.TargetFps = static_cast<float>(Number);
+    }
+    if (Payload->TryGetNumberField(TEXT("durationSeconds"), Number)) {
+      Settings.DurationSeconds = FMath::Max(0.0, Number);
+    }
+    if (Payload->TryGetNumberField(TEXT("maxFrames"), Number)) {
+      Settings.MaxFrames = FMath::Max(0, static_cast<int32>(Number));
+    }
+
+    const bool bNative = (CurrentRequestOrigin == ERequestOrigin::NativeHTTP);
+    Settings.Transport = bNative ? TEXT("sse") : TEXT("websocket");
+
+    McpViewportStream::FFrameSink Sink;
+    if (bNative) {
+      // Frames travel as JSON-RPC notifications on the session's GET /mcp stream
+      const FString SessionId = NativeTransport.IsValid()
+                                    ? NativeTransport->GetSessionIdForRequest(RequestId)
+                                    : FString();
+      if (!SessionId.IsEmpty()) {
+        TWeakPtr<FMcpNativeTransport> WeakTransport = NativeTransport;
+        Sink = [WeakTransport, SessionId](const TSharedRef<FJsonObject> &Header,
+                                          const TArray<uint8> &ImageBytes) {
+          TSharedPtr<FMcpNativeTransport> Transport = WeakTransport.Pin();
+          if (!Transport.IsValid()) {
+            return false;
           }
+          TSharedPtr<FJsonObject> Params = MakeShared<FJsonObject>(*Header);
+          Params->SetStringField(TEXT("data"), FBase64::Encode(ImageBytes));
+          return Transport->SendSessionNotification(
+              SessionId, TEXT("notifications/viewport_frame"), Params);
+        };
+      }
+    } else if (RequestingSocket.IsValid()) {
+      TWeakPtr<FMcpBridgeWebSocket> WeakSocket = RequestingSocket;
+      Sink = [WeakSocket](const TSharedRef<FJsonObject> &Header,
+                          const TArray<uint8> &ImageBytes) {
+        TSharedPtr<FMcpBridgeWebSocket> Socket = WeakSocket.Pin();
+        if (!Socket.IsValid() || !Socket->IsConnected()) {
+          return false;
         }
+        FString HeaderJson;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&HeaderJson);
+        FJsonSerializer::Serialize(Header, Writer);
+        TArray<uint8> Message;
+        McpViewportStream::BuildBinaryFrame(HeaderJson, ImageBytes, Message);
+        return Socket->SendBinary(Message.GetData(), Message.Num());
+      };
+    }
+
+    if (!McpViewportCapture::ParseEncodeOptions(Payload, Settings.Encode, OptionsError)) {
+      Message = OptionsError;
+      ErrorCode = TEXT("INVALID_ARGUMENT");
+      Resp->SetStringField(TEXT("error"), Message);
+    } else if (!Sink) {
+      Message = bNative
+          ? TEXT("Viewport streaming over HTTP needs an open GET /mcp notification stream for this session")
+          : TEXT("Viewport streaming requires a WebSocket connection");
+      ErrorCode = TEXT("NO_STREAM_TRANSPORT");
+      Resp->SetStringField(TEXT("error"), Message);
+    } else if (!McpViewportCapture::FindCaptureViewport()) {
+      Message = TEXT("No viewport available");
+      ErrorCode = TEXT("NO_VIEWPORT");
+      Resp->SetStringField(TEXT("error"), Message);
+    } else {
+      const FString StreamId = McpViewportStream::Start(Settings, MoveTemp(Sink), Message);
+      if (StreamId.IsEmpty()) {
+        ErrorCode = TEXT("STREAM_LIMIT");
+        Resp->SetStringField(TEXT("error"), Message);
+      } else {
+        bSuccess = true;
+        Message = FString::Printf(TEXT("Viewport stream %s started"), *StreamId);
+        Resp->SetStringField(TEXT("streamId"), StreamId);
+        Resp->SetStringField(TEXT("transport"), Settings.Transport);
+        Resp->SetNumberField(TEXT("fps"), FMath::Clamp(Settings.TargetFps, 1.0f, 60.0f));
+        Resp->SetStringField(TEXT("format"), Settings.Encode.Format);
+        Resp->SetStringField(TEXT("frameEncoding"),
+                             bNative ? TEXT("notifications/viewport_frame with base64 data")
+                                     : TEXT("binary: 'MCPV' + uint32le header length + JSON header + image bytes"));
+      }
+    }
+  }
+  // ===========================================================================
+  // SubAction: unsubscribe_viewport_stream / get_viewport_stream_stats
+  // ===========================================================================
+  else if (LowerSub == TEXT("unsubscribe_viewport_stream") ||
+           LowerSub == TEXT("get_viewport_stream_stats")) {
+    const bool bStop = (LowerSub == TEXT("unsubscribe_viewport_stream"));
+    FString StreamId;
+    Payload->TryGetStringField(TEXT("streamId"), StreamId);
+
+    if (StreamId.IsEmpty() && !bStop) {
+      bSuccess = true;
+      Resp->SetArrayField(TEXT("streams"), McpViewportStream::ListStreams());
+      Message = TEXT("Viewport stream stats");
+    } else if (StreamId.IsEmpty()) {
+      Message = TEXT("streamId is required");
+      ErrorCode = TEXT("INVALID_ARGUMENT");
+      Resp->SetStringField(TEXT("error"), Message);
+    } else {
+      TSharedPtr<FJsonObject> Stats = bStop ? McpViewportStream::Stop(StreamId)
+                                            : McpViewportStream::GetStats(StreamId);
+      if (!Stats.IsValid()) {
+        Message = FString::Printf(TEXT("Viewport stream '%s' not found"), *StreamId);
+        ErrorCode = TEXT("STREAM_NOT_FOUND");
+        Resp->SetStringField(TEXT("error"), Message);
+      } else {
+        bSuccess = true;
+        Resp->SetObjectField(TEXT("stats"), Stats);
+        Message = bStop ? FString::Printf(TEXT("Viewport stream %s stopped"), *StreamId)
+                        : TEXT("Viewport stream stats");
       }
     }
   }
@@ -31,6 +31,7 @@
 //                            add_menu_anchor, add_viewport_stats
 // 19.10 Text Operations     - set_text_content, bind_localized_text
 // 19.11 Template Actions    - create_credits_screen, create_shop_ui, add_quest_tracker
+// 19.17 Declarative Trees   - apply_widget_tree, benchmark_widget_tree
 //
 // VERSION COMPATIBILITY:
 // ----------------------
@@ -61,6 +62,7 @@
 #include "McpBridgeWebSocket.h"
 #include "McpHandlerUtils.h"
 #include "McpAutomationBridgeHelpers.h"
+#include "McpWidgetTreeSpec.h"
 
 // JSON & Serialization
 #include "Dom/JsonObject.h"
@@ -7042,6 +7044,111 @@ bool UMcpAutomationBridgeSubsystem::HandleManageWidgetAuthoringAction(
         return true;
     }
 
+    // =========================================================================
+    // 19.17 Declarative Widget Trees
+    // =========================================================================
+
+    if (SubAction.Equals(TEXT("apply_widget_tree"), ESearchCase::IgnoreCase))
+    {
+        // Diff a nested widget spec against the tree and apply it in one
+        // transaction with one compile (see McpWidgetTreeSpec.h)
+        FString WidgetPath = GetJsonStringField(Payload, TEXT("widgetPath"));
+        if (WidgetPath.IsEmpty())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing required parameter: widgetPath"), TEXT("MISSING_PARAMETER"));
+            return true;
+        }
+
+        const TSharedPtr<FJsonObject>* SpecObj = nullptr;
+        if (!Payload->TryGetObjectField(TEXT("spec"), SpecObj) || !SpecObj || !(*SpecObj).IsValid())
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Missing required parameter: spec"), TEXT("MISSING_PARAMETER"));
+            return true;
+        }
+
+        UWidgetBlueprint* WidgetBP = LoadWidgetBlueprint(WidgetPath);
+        if (!WidgetBP)
+        {
+            SendAutomationError(RequestingSocket, RequestId, TEXT("Widget blueprint not found"), TEXT("NOT_FOUND"));
+            return true;
+        }
+
+        TSharedPtr<FJsonObject> Spec = *SpecObj;
+        bool bPrune = false;
+        if (Payload->TryGetBoolField(TEXT("prune"), bPrune))
+        {
+            // Copy so the override does not leak into the caller's payload
+            Spec = MakeShared<FJsonObject>(**SpecObj);
+            Spec->SetBoolField(TEXT("prune"), bPrune);
+        }
+        const bool bCompile = GetJsonBoolField(Payload, TEXT("compile"), true);
+        const bool bSave = GetJsonBoolField(Payload, TEXT("save"), true);
+
+        McpWidgetTreeSpec::FApplyResult Apply;
+        FString Error, ErrorCode;
+        if (!McpWidgetTreeSpec::Apply(WidgetBP, Spec, bCompile, Apply, Error, ErrorCode))
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, ErrorCode);
+            return true;
+        }
+
+        if (bSave)
+        {
+            McpSafeAssetSave(WidgetBP);
+        }
+
+        ResultJson->SetBoolField(TEXT("success"), true);
+        ResultJson->SetStringField(TEXT("widgetPath"), WidgetBP->GetPathName());
+        ResultJson->SetObjectField(TEXT("apply"), Apply.ToJson());
+        ResultJson->SetObjectField(TEXT("widgets"), Apply.Widgets);
+        ResultJson->SetBoolField(TEXT("saved"), bSave);
+
+        McpHandlerUtils::AddVerification(ResultJson, WidgetBP);
+        SendAutomationResponse(RequestingSocket, RequestId, true,
+            FString::Printf(TEXT("Widget tree applied: %d created, %d updated, %d replaced, %d deleted, %d moved"),
+                Apply.Created, Apply.Updated, Apply.Replaced, Apply.Deleted, Apply.Moved), ResultJson);
+        return true;
+    }
+
+    if (SubAction.Equals(TEXT("benchmark_widget_tree"), ESearchCase::IgnoreCase))
+    {
+        // Build the same HUD one widget per request and as one spec, in two
+        // temporary widget blueprints, and compare the timings
+        McpWidgetTreeSpec::FBenchmarkSettings Settings;
+        Settings.WidgetCount = static_cast<int32>(GetJsonNumberField(Payload, TEXT("widgetCount"), Settings.WidgetCount));
+        Settings.RootPath = GetJsonStringField(Payload, TEXT("path"), Settings.RootPath);
+        Settings.bCompileEach = GetJsonBoolField(Payload, TEXT("compileEach"), Settings.bCompileEach);
+        Settings.bCleanup = GetJsonBoolField(Payload, TEXT("cleanup"), Settings.bCleanup);
+        // The client drops any request after 300 s, so stay under that
+        Settings.TimeoutSeconds = FMath::Clamp(GetJsonNumberField(Payload, TEXT("timeoutSeconds"), Settings.TimeoutSeconds), 10.0, 240.0);
+
+        TWeakObjectPtr<UMcpAutomationBridgeSubsystem> WeakSelf(this);
+        const ERequestOrigin Origin = CurrentRequestOrigin;
+        FString Error, ErrorCode;
+        const bool bStarted = McpWidgetTreeSpec::StartBenchmark(Settings,
+            [WeakSelf, RequestId, Origin](float Percent, const FString& Message)
+            {
+                if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+                {
+                    Subsystem->SendProgressUpdate(RequestId, Percent, Message, true, Origin);
+                }
+            },
+            [WeakSelf, RequestId, RequestingSocket, Origin](bool bSuccess, const FString& Message,
+                                                            const TSharedPtr<FJsonObject>& Report, const FString& Code)
+            {
+                if (UMcpAutomationBridgeSubsystem* Subsystem = WeakSelf.Get())
+                {
+                    Subsystem->SendAutomationResponse(RequestingSocket, RequestId, bSuccess, Message, Report, Code, Origin);
+                }
+            },
+            Error, ErrorCode);
+        if (!bStarted)
+        {
+            SendAutomationError(RequestingSocket, RequestId, Error, ErrorCode);
+        }
+        return true;
+    }
+
     // Action not recognized
     return false;
 }
@@ -0,0 +1,628 @@
+// =============================================================================
+// McpBenchmark.cpp
+// =============================================================================
+// Implementation of the frame-time benchmark runner.
+// =============================================================================
+
+#include "McpBenchmark.h"
+#include "McpVersionCompatibility.h"
+#include "McpAutomationBridgeHelpers.h"
+
+#include "Containers/Ticker.h"
+#include "DynamicRHI.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "RHI.h"
+#include "RenderCore.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#include "EditorViewportClient.h"
+#include "Editor/EditorPerformanceSettings.h"
+#include "LevelSequence.h"
+#include "LevelSequenceEditorBlueprintLibrary.h"
+#include "MovieScene.h"
+#include "MovieSceneTimeHelpers.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "McpBenchmark"
+
+namespace McpBenchmark
+{
+    namespace
+    {
+        constexpr int32 MAX_RECENT_RESULTS = 8;
+        constexpr double PROGRESS_INTERVAL_SECONDS = 1.0;
+
+        enum class EPhase : uint8
+        {
+            Warmup,
+            Sampling
+        };
+
+        struct FRun
+        {
+            FString Id;
+            FSettings Settings;
+            FProgressSink OnProgress;
+            FCompletionSink OnComplete;
+
+            EPhase Phase = EPhase::Warmup;
+            double PhaseStart = 0.0;
+            double LastProgress = 0.0;
+            double SampleSeconds = 0.0;
+            FString Driver;
+
+            TArray<float> FrameMs;
+            TArray<float> GameMs;
+            TArray<float> RenderMs;
+            TArray<float> GpuMs;
+
+#if WITH_EDITOR
+            TWeakObjectPtr<ULevelSequence> Sequence;
+            FEditorViewportClient* ViewportClient = nullptr;
+            bool bRestoreThrottle = false;
+            bool bRealtimeOverride = false;
+            FVector SavedLocation = FVector::ZeroVector;
+            FRotator SavedRotation = FRotator::ZeroRotator;
+#endif
+        };
+
+        struct FState
+        {
+            TUniquePtr<FRun> Active;
+            FTSTicker::FDelegateHandle TickHandle;
+            TArray<TSharedPtr<FJsonObject>> Recent;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        FString GetResultDir()
+        {
+            return FPaths::ConvertRelativePathToFull(
+                FPaths::Combine(FPaths::ProfilingDir(), TEXT("Benchmarks"), TEXT("Mcp")));
+        }
+
+        /** min / avg / p50 / p95 / p99 / max of one timing series (nearest-rank percentiles). */
+        TSharedPtr<FJsonObject> SeriesStats(TArray<float> Samples)
+        {
+            TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+            if (Samples.Num() == 0)
+            {
+                return Stats;
+            }
+            Samples.Sort();
+            double Sum = 0.0;
+            for (const float Sample : Samples)
+            {
+                Sum += Sample;
+            }
+            auto Percentile = [&Samples](double P)
+            {
+                const int32 Rank = FMath::CeilToInt(P / 100.0 * Samples.Num());
+                return Samples[FMath::Clamp(Rank - 1, 0, Samples.Num() - 1)];
+            };
+            Stats->SetNumberField(TEXT("min"), Samples[0]);
+            Stats->SetNumberField(TEXT("avg"), Sum / Samples.Num());
+            Stats->SetNumberField(TEXT("p50"), Percentile(50.0));
+            Stats->SetNumberField(TEXT("p95"), Percentile(95.0));
+            Stats->SetNumberField(TEXT("p99"), Percentile(99.0));
+            Stats->SetNumberField(TEXT("max"), Samples.Last());
+            return Stats;
+        }
+
+        double GetStat(const TSharedPtr<FJsonObject>& Result, const TCHAR* Series, const TCHAR* Stat, bool& bOutFound)
+        {
+            const TSharedPtr<FJsonObject>* SeriesObject = nullptr;
+            double Value = 0.0;
+            bOutFound = Result.IsValid() && Result->TryGetObjectField(Series, SeriesObject) &&
+                (*SeriesObject)->TryGetNumberField(Stat, Value);
+            return Value;
+        }
+
+        /**
+         * Per-metric deltas against a baseline result. Lower is better for every
+         * metric, so a positive deltaPct above the threshold is a regression, as
+         * is any rise from a zero baseline (deltaPct is null there).
+         */
+        TSharedPtr<FJsonObject> Compare(const TSharedPtr<FJsonObject>& Baseline, const TSharedPtr<FJsonObject>& Current,
+                                        double ThresholdPct)
+        {
+            struct FMetric
+            {
+                const TCHAR* Series;
+                const TCHAR* Stat;
+            };
+            static const FMetric Metrics[] = {
+                { TEXT("frameMs"), TEXT("avg") },
+                { TEXT("frameMs"), TEXT("p95") },
+                { TEXT("frameMs"), TEXT("p99") },
+                { TEXT("gameThreadMs"), TEXT("avg") },
+                { TEXT("gameThreadMs"), TEXT("p95") },
+                { TEXT("renderThreadMs"), TEXT("avg") },
+                { TEXT("renderThreadMs"), TEXT("p95") },
+                { TEXT("gpuMs"), TEXT("avg") },
+                { TEXT("gpuMs"), TEXT("p95") },
+            };
+
+            TArray<TSharedPtr<FJsonValue>> MetricValues;
+            TArray<TSharedPtr<FJsonValue>> Regressions;
+            auto AddMetric = [&](const FString& Name, double Before, double After)
+            {
+                // No percentage exists from a zero baseline (e.g. no hitches before);
+                // any increase from zero counts as a regression
+                const bool bFromZero = Before <= 0.0;
+                const double DeltaPct = bFromZero ? 0.0 : (After - Before) / Before * 100.0;
+                const bool bRegressed = bFromZero ? After > 0.0 : DeltaPct > ThresholdPct;
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("metric"), Name);
+                Entry->SetNumberField(TEXT("baseline"), Before);
+                Entry->SetNumberField(TEXT("current"), After);
+                Entry->SetNumberField(TEXT("delta"), After - Before);
+                if (bFromZero)
+                {
+                    Entry->SetField(TEXT("deltaPct"), MakeShared<FJsonValueNull>());
+                }
+                else
+                {
+                    Entry->SetNumberField(TEXT("deltaPct"), DeltaPct);
+                }
+                Entry->SetBoolField(TEXT("regressed"), bRegressed);
+                MetricValues.Add(MakeShared<FJsonValueObject>(Entry));
+                if (bRegressed)
+                {
+                    Regressions.Add(MakeShared<FJsonValueObject>(Entry));
+                }
+            };
+
+            for (const FMetric& Metric : Metrics)
+            {
+                bool bBefore = false;
+                bool bAfter = false;
+                const double Before = GetStat(Baseline, Metric.Series, Metric.Stat, bBefore);
+                const double After = GetStat(Current, Metric.Series, Metric.Stat, bAfter);
+                if (bBefore && bAfter)
+                {
+                    AddMetric(FString::Printf(TEXT("%s.%s"), Metric.Series, Metric.Stat), Before, After);
+                }
+            }
+
+            // Hitch rate rather than count, so runs of different length compare.
+            double BaselineHitchPct = 0.0;
+            double CurrentHitchPct = 0.0;
+            if (Baseline->TryGetNumberField(TEXT("hitchPercent"), BaselineHitchPct) &&
+                Current->TryGetNumberField(TEXT("hitchPercent"), CurrentHitchPct))
+            {
+                AddMetric(TEXT("hitchPercent"), BaselineHitchPct, CurrentHitchPct);
+            }
+
+            TSharedPtr<FJsonObject> Comparison = MakeShared<FJsonObject>();
+            Comparison->SetStringField(TEXT("baselineId"), Baseline->GetStringField(TEXT("benchmarkId")));
+            Comparison->SetStringField(TEXT("baselineLabel"), Baseline->GetStringField(TEXT("label")));
+            Comparison->SetNumberField(TEXT("thresholdPct"), ThresholdPct);
+            Comparison->SetBoolField(TEXT("regressed"), Regressions.Num() > 0);
+            Comparison->SetArrayField(TEXT("metrics"), MetricValues);
+            Comparison->SetArrayField(TEXT("regressions"), Regressions);
+            return Comparison;
+        }
+
+        bool WriteResult(const TSharedPtr<FJsonObject>& Result, const FString& FilePath)
+        {
+            FString Serialized;
+            TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+                TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Serialized);
+            if (!FJsonSerializer::Serialize(Result.ToSharedRef(), Writer))
+            {
+                return false;
+            }
+            IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+            return FFileHelper::SaveStringToFile(Serialized, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM);
+        }
+
+#if WITH_EDITOR
+        void ApplyCameraPath(FRun& Run, double Alpha)
+        {
+            const TArray<FCameraKey>& Keys = Run.Settings.CameraPath;
+            if (!Run.ViewportClient || Keys.Num() == 0)
+            {
+                return;
+            }
+            const double Position = FMath::Clamp(Alpha, 0.0, 1.0) * (Keys.Num() - 1);
+            const int32 Index = FMath::Min(FMath::FloorToInt(Position), Keys.Num() - 1);
+            const int32 Next = FMath::Min(Index + 1, Keys.Num() - 1);
+            const double Blend = Position - Index;
+            Run.ViewportClient->SetViewLocation(FMath::Lerp(Keys[Index].Location, Keys[Next].Location, Blend));
+            Run.ViewportClient->SetViewRotation(
+                FQuat::Slerp(Keys[Index].Rotation.Quaternion(), Keys[Next].Rotation.Quaternion(), Blend).Rotator());
+            Run.ViewportClient->Invalidate();
+        }
+
+        /** Set up everything the run changes in the editor; reverted by RestoreEditor. */
+        void PrepareEditor(FRun& Run)
+        {
+            if (UEditorPerformanceSettings* Performance = GetMutableDefault<UEditorPerformanceSettings>())
+            {
+                Run.bRestoreThrottle = Performance->bThrottleCPUWhenNotForeground;
+                Performance->bThrottleCPUWhenNotForeground = false;
+            }
+
+            const bool bPlayInEditor = GEditor && GEditor->PlayWorld != nullptr;
+            if (GEditor && !bPlayInEditor && GEditor->GetActiveViewport())
+            {
+                Run.ViewportClient = static_cast<FEditorViewportClient*>(GEditor->GetActiveViewport()->GetClient());
+            }
+            if (Run.ViewportClient)
+            {
+                Run.ViewportClient->AddRealtimeOverride(true, LOCTEXT("BenchmarkRealtime", "MCP Benchmark"));
+                Run.bRealtimeOverride = true;
+                Run.SavedLocation = Run.ViewportClient->GetViewLocation();
+                Run.SavedRotation = Run.ViewportClient->GetViewRotation();
+                ApplyCameraPath(Run, 0.0);
+            }
+        }
+
+        void RestoreEditor(FRun& Run)
+        {
+            if (Run.bRestoreThrottle)
+            {
+                GetMutableDefault<UEditorPerformanceSettings>()->bThrottleCPUWhenNotForeground = true;
+            }
+            if (Run.Sequence.IsValid())
+            {
+                ULevelSequenceEditorBlueprintLibrary::Pause();
+            }
+
+            // The viewport client may have been destroyed (layout change) while sampling
+            bool bClientAlive = false;
+            if (GEditor && Run.ViewportClient)
+            {
+                for (FEditorViewportClient* Client : GEditor->GetAllViewportClients())
+                {
+                    bClientAlive |= Client == Run.ViewportClient;
+                }
+            }
+            if (bClientAlive)
+            {
+                if (Run.Settings.CameraPath.Num() > 0)
+                {
+                    Run.ViewportClient->SetViewLocation(Run.SavedLocation);
+                    Run.ViewportClient->SetViewRotation(Run.SavedRotation);
+                }
+                if (Run.bRealtimeOverride)
+                {
+                    Run.ViewportClient->RemoveRealtimeOverride(LOCTEXT("BenchmarkRealtime", "MCP Benchmark"), false);
+                }
+                Run.ViewportClient->Invalidate();
+            }
+            Run.ViewportClient = nullptr;
+        }
+
+        void StartSequence(FRun& Run)
+        {
+            ULevelSequence* Sequence = Run.Sequence.Get();
+            if (!Sequence)
+            {
+                return;
+            }
+            const UMovieScene* MovieScene = Sequence->GetMovieScene();
+            const FFrameNumber StartTick = UE::MovieScene::DiscreteInclusiveLower(MovieScene->GetPlaybackRange());
+            const FFrameTime StartDisplay =
+                FFrameRate::TransformTime(FFrameTime(StartTick), MovieScene->GetTickResolution(), MovieScene->GetDisplayRate());
+            ULevelSequenceEditorBlueprintLibrary::SetCurrentTime(StartDisplay.FloorToFrame().Value);
+            ULevelSequenceEditorBlueprintLibrary::Play();
+        }
+#endif
+
+        void Finish(bool bSuccess, const FString& Message, const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)
+        {
+            FState& State = GetState();
+            if (State.TickHandle.IsValid())
+            {
+                FTSTicker::GetCoreTicker().RemoveTicker(State.TickHandle);
+                State.TickHandle.Reset();
+            }
+            TUniquePtr<FRun> Run = MoveTemp(State.Active);
+            if (!Run)
+            {
+                return;
+            }
+#if WITH_EDITOR
+            RestoreEditor(*Run);
+#endif
+            if (Run->OnComplete)
+            {
+                Run->OnComplete(bSuccess, Message, Result, ErrorCode);
+            }
+        }
+
+        TSharedPtr<FJsonObject> BuildResult(FRun& Run)
+        {
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetStringField(TEXT("benchmarkId"), Run.Id);
+            Result->SetStringField(TEXT("label"), Run.Settings.Label);
+            Result->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+            Result->SetStringField(TEXT("projectName"), FApp::GetProjectName());
+            Result->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+            Result->SetStringField(TEXT("driver"), Run.Driver);
+#if WITH_EDITOR
+            Result->SetStringField(TEXT("mode"), GEditor && GEditor->PlayWorld ? TEXT("pie") : TEXT("editor"));
+#endif
+            if (!Run.Settings.SequencePath.IsEmpty())
+            {
+                Result->SetStringField(TEXT("sequencePath"), Run.Settings.SequencePath);
+            }
+            Result->SetNumberField(TEXT("cameraKeys"), Run.Settings.CameraPath.Num());
+            Result->SetNumberField(TEXT("warmupSeconds"), Run.Settings.WarmupSeconds);
+            Result->SetNumberField(TEXT("durationSeconds"), Run.SampleSeconds);
+            Result->SetNumberField(TEXT("frames"), Run.FrameMs.Num());
+
+            TSharedPtr<FJsonObject> FrameStats = SeriesStats(Run.FrameMs);
+            const double AvgFrame = FrameStats->HasField(TEXT("avg")) ? FrameStats->GetNumberField(TEXT("avg")) : 0.0;
+            Result->SetNumberField(TEXT("avgFps"), AvgFrame > 0.0 ? 1000.0 / AvgFrame : 0.0);
+            Result->SetObjectField(TEXT("frameMs"), FrameStats);
+            Result->SetObjectField(TEXT("gameThreadMs"), SeriesStats(Run.GameMs));
+            Result->SetObjectField(TEXT("renderThreadMs"), SeriesStats(Run.RenderMs));
+
+            // GPU timing is zero when the RHI does not record timestamps
+            const bool bGpuAvailable = Run.GpuMs.ContainsByPredicate([](float Ms) { return Ms > 0.0f; });
+            Result->SetBoolField(TEXT("gpuAvailable"), bGpuAvailable);
+            if (bGpuAvailable)
+            {
+                Result->SetObjectField(TEXT("gpuMs"), SeriesStats(Run.GpuMs));
+            }
+
+            int32 Hitches = 0;
+            float WorstFrame = 0.0f;
+            for (const float Ms : Run.FrameMs)
+            {
+                Hitches += Ms > Run.Settings.HitchThresholdMs ? 1 : 0;
+                WorstFrame = FMath::Max(WorstFrame, Ms);
+            }
+            Result->SetNumberField(TEXT("hitchThresholdMs"), Run.Settings.HitchThresholdMs);
+            Result->SetNumberField(TEXT("hitches"), Hitches);
+            Result->SetNumberField(TEXT("hitchPercent"), Run.FrameMs.Num() > 0 ? 100.0 * Hitches / Run.FrameMs.Num() : 0.0);
+            Result->SetNumberField(TEXT("worstFrameMs"), WorstFrame);
+
+            // Same rule as stat unit colouring: the slowest average is the bottleneck
+            bool bFound = false;
+            const double GameAvg = GetStat(Result, TEXT("gameThreadMs"), TEXT("avg"), bFound);
+            const double RenderAvg = GetStat(Result, TEXT("renderThreadMs"), TEXT("avg"), bFound);
+            const double GpuAvg = bGpuAvailable ? GetStat(Result, TEXT("gpuMs"), TEXT("avg"), bFound) : 0.0;
+            Result->SetStringField(TEXT("boundBy"), GpuAvg >= GameAvg && GpuAvg >= RenderAvg ? TEXT("gpu")
+                                                    : RenderAvg >= GameAvg ? TEXT("render") : TEXT("game"));
+
+            if (Run.Settings.Baseline.IsValid())
+            {
+                Result->SetObjectField(TEXT("comparison"),
+                    Compare(Run.Settings.Baseline, Result, Run.Settings.RegressionThresholdPct));
+            }
+            return Result;
+        }
+
+        void Complete(FRun& Run)
+        {
+            TSharedPtr<FJsonObject> Result = BuildResult(Run);
+
+            FState& State = GetState();
+            State.Recent.Add(Result);
+            if (State.Recent.Num() > MAX_RECENT_RESULTS)
+            {
+                State.Recent.RemoveAt(0);
+            }
+            const FString FilePath = FPaths::Combine(GetResultDir(), Run.Id + TEXT(".json"));
+            if (WriteResult(Result, FilePath))
+            {
+                Result->SetStringField(TEXT("filePath"), FilePath);
+            }
+
+            const TSharedPtr<FJsonObject>* Comparison = nullptr;
+            const bool bRegressed = Result->TryGetObjectField(TEXT("comparison"), Comparison) &&
+                (*Comparison)->GetBoolField(TEXT("regressed"));
+            const FString Message = FString::Printf(
+                TEXT("Benchmark %s: %d frames, avg %.2f ms, p95 %.2f ms, p99 %.2f ms, %d hitches%s"), *Run.Id,
+                Run.FrameMs.Num(), Result->GetObjectField(TEXT("frameMs"))->GetNumberField(TEXT("avg")),
+                Result->GetObjectField(TEXT("frameMs"))->GetNumberField(TEXT("p95")),
+                Result->GetObjectField(TEXT("frameMs"))->GetNumberField(TEXT("p99")),
+                static_cast<int32>(Result->GetNumberField(TEXT("hitches"))),
+                bRegressed ? TEXT(" (regressed vs baseline)") : TEXT(""));
+            Finish(true, Message, Result, FString());
+        }
+
+        bool Tick(float DeltaTime)
+        {
+            FState& State = GetState();
+            if (!State.Active)
+            {
+                return false;
+            }
+            FRun& Run = *State.Active;
+            const double Now = FPlatformTime::Seconds();
+            const double Elapsed = Now - Run.PhaseStart;
+
+            if (Run.Phase == EPhase::Warmup)
+            {
+                if (Elapsed >= Run.Settings.WarmupSeconds)
+                {
+                    Run.Phase = EPhase::Sampling;
+                    Run.PhaseStart = Now;
+#if WITH_EDITOR
+                    StartSequence(Run);
+#endif
+                }
+            }
+            else
+            {
+                Run.FrameMs.Add(static_cast<float>(FApp::GetDeltaTime() * 1000.0));
+                Run.GameMs.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+                Run.RenderMs.Add(FPlatformTime::ToMilliseconds(GRenderThreadTime));
+                Run.GpuMs.Add(FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles(0)));
+                Run.SampleSeconds = Elapsed;
+#if WITH_EDITOR
+                ApplyCameraPath(Run, Elapsed / Run.Settings.DurationSeconds);
+#endif
+                if (Elapsed >= Run.Settings.DurationSeconds)
+                {
+                    Complete(Run);
+                    return false;
+                }
+            }
+
+            if (Run.OnProgress && Now - Run.LastProgress >= PROGRESS_INTERVAL_SECONDS)
+            {
+                Run.LastProgress = Now;
+                const double Total = Run.Settings.WarmupSeconds + Run.Settings.DurationSeconds;
+                const double Done = Run.Phase == EPhase::Warmup ? Elapsed : Run.Settings.WarmupSeconds + Elapsed;
+                const FString Message = Run.Phase == EPhase::Warmup
+                    ? FString::Printf(TEXT("Warming up %.0f/%.0fs"), Elapsed, Run.Settings.WarmupSeconds)
+                    : FString::Printf(TEXT("Sampling %.0f/%.0fs, %d frames, last %.1f ms"), Elapsed,
+                                      Run.Settings.DurationSeconds, Run.FrameMs.Num(), Run.FrameMs.Last());
+                Run.OnProgress(static_cast<float>(FMath::Clamp(Done / Total * 100.0, 0.0, 99.0)), Message);
+            }
+            return true;
+        }
+    }
+
+    FString Start(const FSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                  FString& OutError, FString& OutErrorCode)
+    {
+        check(IsInGameThread());
+        FState& State = GetState();
+        if (State.Active)
+        {
+            OutError = FString::Printf(TEXT("Benchmark %s is already running"), *State.Active->Id);
+            OutErrorCode = TEXT("BENCHMARK_RUNNING");
+            return FString();
+        }
+
+        TUniquePtr<FRun> Run = MakeUnique<FRun>();
+        Run->Settings = Settings;
+        Run->OnProgress = MoveTemp(OnProgress);
+        Run->OnComplete = MoveTemp(OnComplete);
+        Run->Driver = Settings.CameraPath.Num() > 0 ? TEXT("camera_path") : TEXT("duration");
+
+#if WITH_EDITOR
+        if (!Settings.SequencePath.IsEmpty())
+        {
+            ULevelSequence* Sequence = LoadObject<ULevelSequence>(nullptr, *Settings.SequencePath);
+            if (!Sequence || !Sequence->GetMovieScene())
+            {
+                OutError = FString::Printf(TEXT("Level Sequence not found: %s"), *Settings.SequencePath);
+                OutErrorCode = TEXT("SEQUENCE_NOT_FOUND");
+                return FString();
+            }
+            const UMovieScene* MovieScene = Sequence->GetMovieScene();
+            const FFrameNumber Length = UE::MovieScene::DiscreteSize(MovieScene->GetPlaybackRange());
+            const double SequenceSeconds = MovieScene->GetTickResolution().AsSeconds(FFrameTime(Length));
+            if (SequenceSeconds > MaxDurationSeconds)
+            {
+                OutError = FString::Printf(
+                    TEXT("Level Sequence %s runs %.1f s; sequence benchmarks are limited to %.0f s. Shorten its playback range or benchmark a sub-sequence."),
+                    *Settings.SequencePath, SequenceSeconds, MaxDurationSeconds);
+                OutErrorCode = TEXT("INVALID_ARGUMENT");
+                return FString();
+            }
+            if (!ULevelSequenceEditorBlueprintLibrary::OpenLevelSequence(Sequence))
+            {
+                OutError = FString::Printf(TEXT("Failed to open %s in Sequencer"), *Settings.SequencePath);
+                OutErrorCode = TEXT("EXECUTION_ERROR");
+                return FString();
+            }
+            ULevelSequenceEditorBlueprintLibrary::Pause();
+
+            Run->Settings.DurationSeconds = SequenceSeconds;
+            Run->Sequence = Sequence;
+            Run->Driver = TEXT("sequence");
+        }
+#else
+        if (!Settings.SequencePath.IsEmpty())
+        {
+            OutError = TEXT("Sequence-driven benchmarks require an editor build");
+            OutErrorCode = TEXT("NOT_IMPLEMENTED");
+            return FString();
+        }
+#endif
+        if (Run->Settings.DurationSeconds <= 0.0)
+        {
+            OutError = TEXT("Benchmark duration must be positive");
+            OutErrorCode = TEXT("INVALID_ARGUMENT");
+            return FString();
+        }
+
+        Run->Id = FString::Printf(TEXT("bench_%s_%s"), *FDateTime::UtcNow().ToString(TEXT("%Y%m%d_%H%M%S")),
+            *FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(4).ToLower());
+        Run->PhaseStart = FPlatformTime::Seconds();
+        Run->LastProgress = Run->PhaseStart;
+#if WITH_EDITOR
+        PrepareEditor(*Run);
+#endif
+
+        const FString Id = Run->Id;
+        State.Active = MoveTemp(Run);
+        State.TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&Tick));
+        return Id;
+    }
+
+    bool IsRunning()
+    {
+        return GetState().Active.IsValid();
+    }
+
+    void CancelAll()
+    {
+        FState& State = GetState();
+        if (State.Active)
+        {
+            State.Active->OnComplete = nullptr;
+            Finish(false, TEXT("Benchmark cancelled"), nullptr, TEXT("CANCELLED"));
+        }
+    }
+
+    TSharedPtr<FJsonObject> FindResult(const FString& BenchmarkId)
+    {
+        for (const TSharedPtr<FJsonObject>& Result : GetState().Recent)
+        {
+            if (Result->GetStringField(TEXT("benchmarkId")) == BenchmarkId)
+            {
+                return Result;
+            }
+        }
+
+        FString Ignored;
+        const FString FilePath = FPaths::Combine(GetResultDir(), BenchmarkId + TEXT(".json"));
+        return FPaths::FileExists(FilePath) ? LoadResultFile(FilePath, Ignored) : nullptr;
+    }
+
+    TSharedPtr<FJsonObject> LoadResultFile(const FString& FilePath, FString& OutError)
+    {
+        FString Contents;
+        if (!FFileHelper::LoadFileToString(Contents, *FilePath))
+        {
+            OutError = FString::Printf(TEXT("Benchmark result not found: %s"), *FilePath);
+            return nullptr;
+        }
+
+        TSharedPtr<FJsonObject> Result;
+        TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(Contents);
+        if (!FJsonSerializer::Deserialize(Reader, Result) || !Result.IsValid() ||
+            !Result->HasTypedField<EJson::Object>(TEXT("frameMs")))
+        {
+            OutError = FString::Printf(TEXT("Not a benchmark result file: %s"), *FilePath);
+            return nullptr;
+        }
+        return Result;
+    }
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,87 @@
+// =============================================================================
+// McpBenchmark.h
+// =============================================================================
+// Frame-time benchmark runner behind manage_performance run_benchmark.
+//
+// A run ticks once per engine frame on the core ticker. It first warms up for
+// WarmupSeconds without recording, then samples the same timings "stat unit"
+// shows - frame, game thread, render thread and GPU - until the duration ends.
+// The duration is either fixed, derived from a camera path that the active
+// editor viewport follows, or the playback length of a Level Sequence played
+// in Sequencer.
+//
+// The result holds min / avg / p50 / p95 / p99 / max per timing, the hitch
+// count above HitchThresholdMs and, when a baseline run is given, per-metric
+// deltas with regressions flagged. Results are written to
+// Saved/Profiling/Benchmarks/Mcp/<benchmarkId>.json and the most recent runs
+// are kept in memory, so later runs can name them as a baseline.
+//
+// Editor CPU throttling is disabled and the viewport is forced realtime for
+// the run; both are restored when it ends. One run at a time.
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpBenchmark
+{
+    struct FCameraKey
+    {
+        FVector Location = FVector::ZeroVector;
+        FRotator Rotation = FRotator::ZeroRotator;
+    };
+
+    /** Longest sampling time; the client drops any request after 300 s, so stay under that. */
+    constexpr double MaxDurationSeconds = 240.0;
+
+    struct FSettings
+    {
+        /** Free-form label stored with the result. */
+        FString Label;
+        double WarmupSeconds = 2.0;
+        /** Sampling time; ignored when SequencePath is set (the sequence length is used). */
+        double DurationSeconds = 10.0;
+        /** Frames longer than this count as hitches. */
+        double HitchThresholdMs = 50.0;
+        /** Keys the viewport camera moves through, evenly spaced over the duration. */
+        TArray<FCameraKey> CameraPath;
+        /** Level Sequence played in Sequencer while sampling; rejected when longer than MaxDurationSeconds. */
+        FString SequencePath;
+        /** Previous result to compare against (null for none). */
+        TSharedPtr<FJsonObject> Baseline;
+        /** A metric regresses when it is this many percent worse than the baseline. */
+        double RegressionThresholdPct = 10.0;
+    };
+
+    /** Phase and elapsed time of the running benchmark. Runs on the game thread. */
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+
+    /** Final statistics; ErrorCode is empty on success. Runs on the game thread. */
+    using FCompletionSink = TFunction<void(bool bSuccess, const FString& Message,
+                                           const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)>;
+
+    /**
+     * Start a run. Returns the benchmark id, or an empty string with OutError
+     * and OutErrorCode set (another run in progress, sequence not found).
+     */
+    FString Start(const FSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                  FString& OutError, FString& OutErrorCode);
+
+    bool IsRunning();
+
+    /** Abort the running benchmark (subsystem shutdown). Its completion is not reported. */
+    void CancelAll();
+
+    /** Look up a result by id: recent runs first, then the default folder. */
+    TSharedPtr<FJsonObject> FindResult(const FString& BenchmarkId);
+
+    /** Load a result file written by a previous run. */
+    TSharedPtr<FJsonObject> LoadResultFile(const FString& FilePath, FString& OutError);
+}
@@ -0,0 +1,951 @@
+// =============================================================================
+// McpBlueprintGraphSpec.cpp
+// =============================================================================
+// Implementation of declarative Blueprint graph diff/apply.
+// =============================================================================
+
+#include "McpBlueprintGraphSpec.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpVersionCompatibility.h"
+#include "McpCompileScheduler.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/SecureHash.h"
+
+#if WITH_EDITOR
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraph/EdGraphSchema.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_DynamicCast.h"
+#include "K2Node_Event.h"
+#include "K2Node_InputAxisEvent.h"
+#include "K2Node_VariableGet.h"
+#include "K2Node_VariableSet.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/KismetSystemLibrary.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "ScopedTransaction.h"
+#endif
+
+namespace McpBlueprintGraphSpec
+{
+    namespace
+    {
+        /** create_node shortcuts for common function calls. */
+        const TMap<FString, TTuple<FString, FString>>& GetFunctionShortcuts()
+        {
+            static const TMap<FString, TTuple<FString, FString>> Shortcuts = {
+                {TEXT("PrintString"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("PrintString"))},
+                {TEXT("Print"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("PrintString"))},
+                {TEXT("PrintText"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("PrintText"))},
+                {TEXT("SetActorLocation"), MakeTuple(TEXT("AActor"), TEXT("K2_SetActorLocation"))},
+                {TEXT("GetActorLocation"), MakeTuple(TEXT("AActor"), TEXT("K2_GetActorLocation"))},
+                {TEXT("SetActorRotation"), MakeTuple(TEXT("AActor"), TEXT("K2_SetActorRotation"))},
+                {TEXT("GetActorRotation"), MakeTuple(TEXT("AActor"), TEXT("K2_GetActorRotation"))},
+                {TEXT("SetActorTransform"), MakeTuple(TEXT("AActor"), TEXT("K2_SetActorTransform"))},
+                {TEXT("GetActorTransform"), MakeTuple(TEXT("AActor"), TEXT("K2_GetActorTransform"))},
+                {TEXT("AddActorLocalOffset"), MakeTuple(TEXT("AActor"), TEXT("K2_AddActorLocalOffset"))},
+                {TEXT("Delay"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("Delay"))},
+                {TEXT("DestroyActor"), MakeTuple(TEXT("AActor"), TEXT("K2_DestroyActor"))},
+                {TEXT("SpawnActor"), MakeTuple(TEXT("UGameplayStatics"), TEXT("BeginDeferredActorSpawnFromClass"))},
+                {TEXT("GetPlayerPawn"), MakeTuple(TEXT("UGameplayStatics"), TEXT("GetPlayerPawn"))},
+                {TEXT("GetPlayerController"), MakeTuple(TEXT("UGameplayStatics"), TEXT("GetPlayerController"))},
+                {TEXT("PlaySound"), MakeTuple(TEXT("UGameplayStatics"), TEXT("PlaySound2D"))},
+                {TEXT("PlaySound2D"), MakeTuple(TEXT("UGameplayStatics"), TEXT("PlaySound2D"))},
+                {TEXT("PlaySoundAtLocation"), MakeTuple(TEXT("UGameplayStatics"), TEXT("PlaySoundAtLocation"))},
+                {TEXT("GetWorldDeltaSeconds"), MakeTuple(TEXT("UGameplayStatics"), TEXT("GetWorldDeltaSeconds"))},
+                {TEXT("SetTimerByFunctionName"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("K2_SetTimer"))},
+                {TEXT("ClearTimer"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("K2_ClearTimer"))},
+                {TEXT("IsValid"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("IsValid"))},
+                {TEXT("IsValidClass"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("IsValidClass"))},
+                // Math Nodes
+                {TEXT("Add_IntInt"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Add_IntInt"))},
+                {TEXT("Subtract_IntInt"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Subtract_IntInt"))},
+                {TEXT("Multiply_IntInt"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Multiply_IntInt"))},
+                {TEXT("Divide_IntInt"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Divide_IntInt"))},
+                {TEXT("Add_DoubleDouble"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Add_DoubleDouble"))},
+                {TEXT("Subtract_DoubleDouble"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Subtract_DoubleDouble"))},
+                {TEXT("Multiply_DoubleDouble"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Multiply_DoubleDouble"))},
+                {TEXT("Divide_DoubleDouble"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("Divide_DoubleDouble"))},
+                {TEXT("FTrunc"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("FTrunc"))},
+                // Vector Ops
+                {TEXT("MakeVector"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("MakeVector"))},
+                {TEXT("BreakVector"), MakeTuple(TEXT("UKismetMathLibrary"), TEXT("BreakVector"))},
+                // Actor/Component Ops
+                {TEXT("GetComponentByClass"), MakeTuple(TEXT("AActor"), TEXT("GetComponentByClass"))},
+                // Timer
+                {TEXT("GetWorldTimerManager"), MakeTuple(TEXT("UKismetSystemLibrary"), TEXT("K2_GetTimerManager"))}
+            };
+            return Shortcuts;
+        }
+
+        /** create_node names for node classes. */
+        const TMap<FString, FString>& GetNodeTypeAliases()
+        {
+            static const TMap<FString, FString> Aliases = {
+                // Flow Control
+                {TEXT("Branch"), TEXT("K2Node_IfThenElse")},
+                {TEXT("IfThenElse"), TEXT("K2Node_IfThenElse")},
+                {TEXT("Sequence"), TEXT("K2Node_ExecutionSequence")},
+                {TEXT("ExecutionSequence"), TEXT("K2Node_ExecutionSequence")},
+                {TEXT("Select"), TEXT("K2Node_Select")},
+                {TEXT("Switch"), TEXT("K2Node_SwitchInteger")},
+                {TEXT("SwitchOnInt"), TEXT("K2Node_SwitchInteger")},
+                {TEXT("SwitchOnEnum"), TEXT("K2Node_SwitchEnum")},
+                {TEXT("SwitchOnString"), TEXT("K2Node_SwitchString")},
+                {TEXT("SwitchOnName"), TEXT("K2Node_SwitchName")},
+                {TEXT("DoOnce"), TEXT("K2Node_DoOnce")},
+                {TEXT("DoN"), TEXT("K2Node_DoN")},
+                {TEXT("FlipFlop"), TEXT("K2Node_FlipFlop")},
+                {TEXT("Gate"), TEXT("K2Node_Gate")},
+                {TEXT("MultiGate"), TEXT("K2Node_MultiGate")},
+                // Loops
+                {TEXT("ForLoop"), TEXT("K2Node_ForLoop")},
+                {TEXT("ForLoopWithBreak"), TEXT("K2Node_ForLoopWithBreak")},
+                {TEXT("ForEachLoop"), TEXT("K2Node_ForEachElementInEnum")},
+                {TEXT("WhileLoop"), TEXT("K2Node_WhileLoop")},
+                // Data
+                {TEXT("MakeArray"), TEXT("K2Node_MakeArray")},
+                {TEXT("MakeStruct"), TEXT("K2Node_MakeStruct")},
+                {TEXT("BreakStruct"), TEXT("K2Node_BreakStruct")},
+                {TEXT("MakeMap"), TEXT("K2Node_MakeMap")},
+                {TEXT("MakeSet"), TEXT("K2Node_MakeSet")},
+                // Actor/Component
+                {TEXT("SpawnActorFromClass"), TEXT("K2Node_SpawnActorFromClass")},
+                {TEXT("GetAllActorsOfClass"), TEXT("K2Node_GetAllActorsOfClass")},
+                // Misc
+                {TEXT("Self"), TEXT("K2Node_Self")},
+                {TEXT("GetSelf"), TEXT("K2Node_Self")},
+                {TEXT("Timeline"), TEXT("K2Node_Timeline")},
+                {TEXT("Knot"), TEXT("K2Node_Knot")},
+                {TEXT("Reroute"), TEXT("K2Node_Knot")},
+                {TEXT("Comment"), TEXT("EdGraphNode_Comment")},
+                // Literals
+                {TEXT("Literal"), TEXT("K2Node_Literal")}
+            };
+            return Aliases;
+        }
+
+#if WITH_EDITOR
+        enum class ENodeKind : uint8
+        {
+            CallFunction,
+            VariableGet,
+            VariableSet,
+            Event,
+            CustomEvent,
+            Cast,
+            InputAxisEvent,
+            Generic
+        };
+
+        struct FNodeSpec
+        {
+            FString Key;
+            FString Type;
+            TSharedPtr<FJsonObject> Json;
+            ENodeKind Kind = ENodeKind::Generic;
+            UFunction* Function = nullptr;
+            UClass* Class = nullptr;
+            FName MemberName;
+            TOptional<FVector2D> Position;
+
+            /** Resolved during apply. */
+            UEdGraphNode* Node = nullptr;
+        };
+
+        struct FLinkSpec
+        {
+            FString FromNode;
+            FString FromPin;
+            FString ToNode;
+            FString ToPin;
+        };
+
+        /** Node GUID for a spec key: stable across applies, unique per graph. */
+        FGuid KeyGuid(const UEdGraph& Graph, const FString& Key)
+        {
+            const FString Seed = FString::Printf(TEXT("McpBlueprintGraphSpec|%s|%s"), *Graph.GetName(), *Key);
+            const FTCHARToUTF8 Utf8(*Seed);
+            FMD5 Md5;
+            Md5.Update(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+            uint8 Digest[16];
+            Md5.Final(Digest);
+            uint32 Parts[4];
+            FMemory::Memcpy(Parts, Digest, sizeof(Parts));
+            return FGuid(Parts[0], Parts[1], Parts[2], Parts[3]);
+        }
+
+        UClass* ResolveShortcutClass(const FString& ClassName)
+        {
+            if (ClassName == TEXT("UKismetSystemLibrary"))
+            {
+                return UKismetSystemLibrary::StaticClass();
+            }
+            if (ClassName == TEXT("UGameplayStatics"))
+            {
+                return UGameplayStatics::StaticClass();
+            }
+            if (ClassName == TEXT("AActor"))
+            {
+                return AActor::StaticClass();
+            }
+            if (ClassName == TEXT("UKismetMathLibrary"))
+            {
+                return UKismetMathLibrary::StaticClass();
+            }
+            return ResolveUClass(ClassName);
+        }
+
+        /** As create_node: the member class if given, else the Blueprint and the common libraries. */
+        UFunction* ResolveFunction(UBlueprint& Blueprint, const FString& MemberClass, const FString& MemberName)
+        {
+            if (!MemberClass.IsEmpty())
+            {
+                UClass* Class = ResolveUClass(MemberClass);
+                return Class ? Class->FindFunctionByName(*MemberName) : nullptr;
+            }
+            UClass* const Candidates[] = {
+                Blueprint.GeneratedClass, UKismetSystemLibrary::StaticClass(),
+                UGameplayStatics::StaticClass(), UKismetMathLibrary::StaticClass()
+            };
+            for (UClass* Class : Candidates)
+            {
+                if (UFunction* Function = Class ? Class->FindFunctionByName(*MemberName) : nullptr)
+                {
+                    return Function;
+                }
+            }
+            return nullptr;
+        }
+
+        bool HasVariable(UBlueprint& Blueprint, FName Name)
+        {
+            for (const FBPVariableDescription& Variable : Blueprint.NewVariables)
+            {
+                if (Variable.VarName == Name)
+                {
+                    return true;
+                }
+            }
+            return Blueprint.GeneratedClass && Blueprint.GeneratedClass->FindPropertyByName(Name);
+        }
+
+        bool ResolveNodeSpec(UBlueprint& Blueprint, FNodeSpec& Spec, FString& OutError, FString& OutErrorCode)
+        {
+            const FString& Type = Spec.Type;
+            auto Field = [&Spec](const TCHAR* Name)
+            {
+                FString Value;
+                Spec.Json->TryGetStringField(Name, Value);
+                return Value;
+            };
+
+            if (const TTuple<FString, FString>* Shortcut = GetFunctionShortcuts().Find(Type))
+            {
+                UClass* Class = ResolveShortcutClass(Shortcut->Get<0>());
+                Spec.Kind = ENodeKind::CallFunction;
+                Spec.Function = Class ? Class->FindFunctionByName(*Shortcut->Get<1>()) : nullptr;
+                if (!Spec.Function)
+                {
+                    OutError = FString::Printf(TEXT("Node '%s': could not find function '%s::%s'"), *Spec.Key,
+                        *Shortcut->Get<0>(), *Shortcut->Get<1>());
+                    OutErrorCode = TEXT("FUNCTION_NOT_FOUND");
+                    return false;
+                }
+                return true;
+            }
+
+            if (Type == TEXT("VariableGet") || Type == TEXT("K2Node_VariableGet") ||
+                Type == TEXT("VariableSet") || Type == TEXT("K2Node_VariableSet"))
+            {
+                Spec.Kind = Type.Contains(TEXT("Get")) ? ENodeKind::VariableGet : ENodeKind::VariableSet;
+                Spec.MemberName = FName(*Field(TEXT("variableName")));
+                if (Spec.MemberName.IsNone() || !HasVariable(Blueprint, Spec.MemberName))
+                {
+                    OutError = FString::Printf(TEXT("Node '%s': variable '%s' not found"), *Spec.Key, *Spec.MemberName.ToString());
+                    OutErrorCode = TEXT("VARIABLE_NOT_FOUND");
+                    return false;
+                }
+                return true;
+            }
+
+            if (Type == TEXT("CallFunction") || Type == TEXT("K2Node_CallFunction") || Type == TEXT("FunctionCall"))
+            {
+                FString MemberClass = Field(TEXT("memberClass"));
+                FString MemberName = Field(TEXT("memberName"));
+                const FString Function = Field(TEXT("function"));
+                if (!Function.IsEmpty() && !Function.Split(TEXT("."), &MemberClass, &MemberName, ESearchCase::IgnoreCase,
+                                                           ESearchDir::FromEnd))
+                {
+                    MemberName = Function;
+                }
+                Spec.Kind = ENodeKind::CallFunction;
+                Spec.Function = MemberName.IsEmpty() ? nullptr : ResolveFunction(Blueprint, MemberClass, MemberName);
+                if (!Spec.Function)
+                {
+                    OutError = FString::Printf(TEXT("Node '%s': function '%s' not found"), *Spec.Key, *MemberName);
+                    OutErrorCode = TEXT("FUNCTION_NOT_FOUND");
+                    return false;
+                }
+                return true;
+            }
+
+            if (Type == TEXT("Event") || Type == TEXT("K2Node_Event"))
+            {
+                static const TMap<FString, FString> EventAliases = {
+                    {TEXT("BeginPlay"), TEXT("ReceiveBeginPlay")},
+                    {TEXT("Tick"), TEXT("ReceiveTick")},
+                    {TEXT("EndPlay"), TEXT("ReceiveEndPlay")}
+                };
+                FString EventName = Field(TEXT("eventName"));
+                if (const FString* Alias = EventAliases.Find(EventName))
+                {
+                    EventName = *Alias;
+                }
+                const FString MemberClass = Field(TEXT("memberClass"));
+                Spec.Kind = ENodeKind::Event;
+                if (!MemberClass.IsEmpty())
+                {
+                    Spec.Class = ResolveUClass(MemberClass);
+                    Spec.Function = Spec.Class ? Spec.Class->FindFunctionByName(*EventName) : nullptr;
+                }
+                else
+                {
+                    for (UClass* Class = Blueprint.ParentClass; Class && !Spec.Function; Class = Class->GetSuperClass())
+                    {
+                        Spec.Function = Class->FindFunctionByName(*EventName, EIncludeSuperFlag::ExcludeSuper);
+                        Spec.Class = Spec.Function ? Class : nullptr;
+                    }
+                }
+                if (EventName.IsEmpty() || !Spec.Function || !Spec.Class)
+                {
+                    OutError = FString::Printf(TEXT("Node '%s': event '%s' not found"), *Spec.Key, *EventName);
+                    OutErrorCode = TEXT("EVENT_NOT_FOUND");
+                    return false;
+                }
+                Spec.MemberName = Spec.Function->GetFName();
+                return true;
+            }
+
+            if (Type == TEXT("CustomEvent") || Type == TEXT("K2Node_CustomEvent"))
+            {
+                Spec.Kind = ENodeKind::CustomEvent;
+                Spec.MemberName = FName(*Field(TEXT("eventName")));
+                if (Spec.MemberName.IsNone())
+                {
+                    OutError = FString::Printf(TEXT("Node '%s': CustomEvent needs 'eventName'"), *Spec.Key);
+                    OutErrorCode = TEXT("INVALID_ARGUMENT");
+                    return false;
+                }
+                return true;
+            }
+
+            if (Type == TEXT("Cast") || Type.StartsWith(TEXT("CastTo")))
+            {
+                FString TargetClass = Field(TEXT("targetClass"));
+                if (TargetClass.IsEmpty() && Type.StartsWith(TEXT("CastTo")))
+                {
+                    TargetClass = Type.Mid(6);
+                }
+                Spec.Kind = ENodeKind::Cast;
+                Spec.Class = ResolveUClass(TargetClass);
+                if (!Spec.Class)
+                {
+                    OutError = FString::Printf(TEXT("Node '%s': class '%s' not found"), *Spec.Key, *TargetClass);
+                    OutErrorCode = TEXT("CLASS_NOT_FOUND");
+                    return false;
+                }
+                return true;
+            }
+
+            if (Type == TEXT("InputAxisEvent") || Type == TEXT("K2Node_InputAxisEvent"))
+            {
+                Spec.Kind = ENodeKind::InputAxisEvent;
+                Spec.MemberName = FName(*Field(TEXT("inputAxisName")));
+                if (Spec.MemberName.IsNone())
+                {
+                    OutError = FString::Printf(TEXT("Node '%s': InputAxisEvent needs 'inputAxisName'"), *Spec.Key);
+                    OutErrorCode = TEXT("INVALID_ARGUMENT");
+                    return false;
+                }
+                return true;
+            }
+
+            Spec.Kind = ENodeKind::Generic;
+            Spec.Class = FindNodeClass(Type);
+            if (!Spec.Class)
+            {
+                OutError = FString::Printf(TEXT("Node '%s': node type '%s' not found. Use list_node_types to see available types."),
+                    *Spec.Key, *Type);
+                OutErrorCode = TEXT("NODE_TYPE_NOT_FOUND");
+                return false;
+            }
+            return true;
+        }
+
+        /** The node is what the spec asks for (same class and member), so it can be kept. */
+        bool NodeMatchesSpec(const UEdGraphNode& Node, const FNodeSpec& Spec)
+        {
+            switch (Spec.Kind)
+            {
+            case ENodeKind::CallFunction:
+            {
+                const UK2Node_CallFunction* Call = Cast<UK2Node_CallFunction>(&Node);
+                return Call && Call->GetClass() == UK2Node_CallFunction::StaticClass() && Call->GetTargetFunction() == Spec.Function;
+            }
+            case ENodeKind::VariableGet:
+                return Node.GetClass() == UK2Node_VariableGet::StaticClass() &&
+                    CastChecked<UK2Node_VariableGet>(&Node)->VariableReference.GetMemberName() == Spec.MemberName;
+            case ENodeKind::VariableSet:
+                return Node.GetClass() == UK2Node_VariableSet::StaticClass() &&
+                    CastChecked<UK2Node_VariableSet>(&Node)->VariableReference.GetMemberName() == Spec.MemberName;
+            case ENodeKind::Event:
+                return Node.GetClass() == UK2Node_Event::StaticClass() &&
+                    CastChecked<UK2Node_Event>(&Node)->EventReference.GetMemberName() == Spec.MemberName;
+            case ENodeKind::CustomEvent:
+            {
+                const UK2Node_CustomEvent* Event = Cast<UK2Node_CustomEvent>(&Node);
+                return Event && Event->CustomFunctionName == Spec.MemberName;
+            }
+            case ENodeKind::Cast:
+            {
+                const UK2Node_DynamicCast* CastNode = Cast<UK2Node_DynamicCast>(&Node);
+                return CastNode && CastNode->TargetType == Spec.Class;
+            }
+            case ENodeKind::InputAxisEvent:
+            {
+                const UK2Node_InputAxisEvent* Input = Cast<UK2Node_InputAxisEvent>(&Node);
+                return Input && Input->InputAxisName == Spec.MemberName;
+            }
+            default:
+                return Node.GetClass() == Spec.Class;
+            }
+        }
+
+        template <typename TNode, typename TInit>
+        UEdGraphNode* CreateWith(UEdGraph& Graph, const FVector2D& Position, TInit&& Init)
+        {
+            FGraphNodeCreator<TNode> Creator(Graph);
+            TNode* Node = Creator.CreateNode(false);
+            Init(*Node);
+            Node->NodePosX = static_cast<int32>(Position.X);
+            Node->NodePosY = static_cast<int32>(Position.Y);
+            // Finalize creates the GUID, calls PostPlacedNewNode and allocates pins
+            Creator.Finalize();
+            return Node;
+        }
+
+        UEdGraphNode* CreateNode(UEdGraph& Graph, const FNodeSpec& Spec, const FVector2D& Position)
+        {
+            switch (Spec.Kind)
+            {
+            case ENodeKind::CallFunction:
+                return CreateWith<UK2Node_CallFunction>(Graph, Position,
+                    [&Spec](UK2Node_CallFunction& Node) { Node.SetFromFunction(Spec.Function); });
+            case ENodeKind::VariableGet:
+                return CreateWith<UK2Node_VariableGet>(Graph, Position,
+                    [&Spec](UK2Node_VariableGet& Node) { Node.VariableReference.SetSelfMember(Spec.MemberName); });
+            case ENodeKind::VariableSet:
+                return CreateWith<UK2Node_VariableSet>(Graph, Position,
+                    [&Spec](UK2Node_VariableSet& Node) { Node.VariableReference.SetSelfMember(Spec.MemberName); });
+            case ENodeKind::Event:
+                return CreateWith<UK2Node_Event>(Graph, Position, [&Spec](UK2Node_Event& Node)
+                {
+                    Node.EventReference.SetFromField<UFunction>(Spec.Function, false);
+                    Node.bOverrideFunction = true;
+                });
+            case ENodeKind::CustomEvent:
+                return CreateWith<UK2Node_CustomEvent>(Graph, Position,
+                    [&Spec](UK2Node_CustomEvent& Node) { Node.CustomFunctionName = Spec.MemberName; });
+            case ENodeKind::Cast:
+                return CreateWith<UK2Node_DynamicCast>(Graph, Position,
+                    [&Spec](UK2Node_DynamicCast& Node) { Node.TargetType = Spec.Class; });
+            case ENodeKind::InputAxisEvent:
+                return CreateWith<UK2Node_InputAxisEvent>(Graph, Position,
+                    [&Spec](UK2Node_InputAxisEvent& Node) { Node.InputAxisName = Spec.MemberName; });
+            default:
+            {
+                // As create_node's dynamic fallback
+                UEdGraphNode* Node = NewObject<UEdGraphNode>(&Graph, Spec.Class, NAME_None, RF_Transactional);
+                Graph.AddNode(Node, false, false);
+                Node->CreateNewGuid();
+                Node->PostPlacedNewNode();
+                Node->AllocateDefaultPins();
+                Node->NodePosX = static_cast<int32>(Position.X);
+                Node->NodePosY = static_cast<int32>(Position.Y);
+                return Node;
+            }
+            }
+        }
+
+        UEdGraphPin* FindPinByName(UEdGraphNode& Node, const FString& PinName)
+        {
+            if (UEdGraphPin* Pin = Node.FindPin(*PinName))
+            {
+                return Pin;
+            }
+            for (UEdGraphPin* Pin : Node.Pins)
+            {
+                if (Pin && Pin->PinName.ToString().Equals(PinName, ESearchCase::IgnoreCase))
+                {
+                    return Pin;
+                }
+            }
+            return nullptr;
+        }
+
+        UEdGraphNode* FindNodeByIdOrName(UEdGraph& Graph, const FString& Id)
+        {
+            for (UEdGraphNode* Node : Graph.Nodes)
+            {
+                if (Node && (Node->NodeGuid.ToString().Equals(Id, ESearchCase::IgnoreCase) ||
+                             Node->GetName().Equals(Id, ESearchCase::IgnoreCase)))
+                {
+                    return Node;
+                }
+            }
+            return nullptr;
+        }
+
+        /** "key.Pin" or the separate node / pin fields. */
+        bool ParseEndpoint(const TSharedPtr<FJsonObject>& Json, const TCHAR* NodeField, const TCHAR* PinField,
+                           FString& OutNode, FString& OutPin)
+        {
+            FString Value;
+            Json->TryGetStringField(NodeField, Value);
+            Json->TryGetStringField(PinField, OutPin);
+            if (OutPin.IsEmpty())
+            {
+                return Value.Split(TEXT("."), &OutNode, &OutPin) && !OutNode.IsEmpty() && !OutPin.IsEmpty();
+            }
+            OutNode = Value;
+            return !OutNode.IsEmpty();
+        }
+
+        const TCHAR* StatusName(EBlueprintStatus Status)
+        {
+            switch (Status)
+            {
+            case BS_Dirty: return TEXT("dirty");
+            case BS_Error: return TEXT("error");
+            case BS_UpToDate: return TEXT("upToDate");
+            case BS_UpToDateWithWarnings: return TEXT("upToDateWithWarnings");
+            case BS_BeingCreated: return TEXT("beingCreated");
+            default: return TEXT("unknown");
+            }
+        }
+#endif // WITH_EDITOR
+    }
+
+    const TTuple<FString, FString>* FindFunctionShortcut(const FString& NodeType)
+    {
+        return GetFunctionShortcuts().Find(NodeType);
+    }
+
+    UClass* FindNodeClass(const FString& NodeType)
+    {
+        FString ResolvedName = NodeType;
+        if (const FString* Alias = GetNodeTypeAliases().Find(NodeType))
+        {
+            ResolvedName = *Alias;
+        }
+
+        TArray<FString> NamesToTry;
+        NamesToTry.Add(ResolvedName);
+        NamesToTry.Add(FString::Printf(TEXT("K2Node_%s"), *ResolvedName));
+        NamesToTry.Add(FString::Printf(TEXT("UK2Node_%s"), *ResolvedName));
+        if (ResolvedName != NodeType)
+        {
+            NamesToTry.Add(NodeType);
+            NamesToTry.Add(FString::Printf(TEXT("K2Node_%s"), *NodeType));
+            NamesToTry.Add(FString::Printf(TEXT("UK2Node_%s"), *NodeType));
+        }
+
+#if WITH_EDITOR
+        for (TObjectIterator<UClass> It; It; ++It)
+        {
+            if (!It->IsChildOf(UEdGraphNode::StaticClass()) || It->HasAnyClassFlags(CLASS_Abstract))
+            {
+                continue;
+            }
+            const FString ClassName = It->GetName();
+            for (const FString& Name : NamesToTry)
+            {
+                if (ClassName.Equals(Name, ESearchCase::IgnoreCase))
+                {
+                    return *It;
+                }
+            }
+        }
+#endif
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> FApplyResult::ToJson() const
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetNumberField(TEXT("created"), Created);
+        Json->SetNumberField(TEXT("updated"), Updated);
+        Json->SetNumberField(TEXT("replaced"), Replaced);
+        Json->SetNumberField(TEXT("deleted"), Deleted);
+        Json->SetNumberField(TEXT("linked"), Linked);
+        Json->SetNumberField(TEXT("unlinked"), Unlinked);
+        Json->SetNumberField(TEXT("defaultsSet"), DefaultsSet);
+        Json->SetBoolField(TEXT("compileRequested"), bCompileRequested);
+        Json->SetBoolField(TEXT("compileDeferred"), bCompileDeferred);
+        Json->SetStringField(TEXT("blueprintStatus"), BlueprintStatus);
+        Json->SetNumberField(TEXT("applyMs"), ApplySeconds * 1000.0);
+        Json->SetNumberField(TEXT("compileMs"), CompileSeconds * 1000.0);
+        Json->SetObjectField(TEXT("nodeIds"), NodeIds.IsValid() ? NodeIds : MakeShared<FJsonObject>());
+
+        TArray<TSharedPtr<FJsonValue>> WarningValues;
+        for (const FString& Warning : Warnings)
+        {
+            WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+        }
+        Json->SetArrayField(TEXT("warnings"), WarningValues);
+        return Json;
+    }
+
+    bool Apply(UBlueprint* Blueprint, UEdGraph* Graph, const TSharedPtr<FJsonObject>& Spec, bool bCompile,
+               FApplyResult& OutResult, FString& OutError, FString& OutErrorCode)
+    {
+#if WITH_EDITOR
+        const double StartSeconds = FPlatformTime::Seconds();
+        OutResult = FApplyResult();
+        OutResult.NodeIds = MakeShared<FJsonObject>();
+        OutErrorCode = TEXT("INVALID_SPEC");
+
+        if (!Blueprint || !Graph || !Spec.IsValid())
+        {
+            OutError = TEXT("Missing blueprint, graph or spec");
+            return false;
+        }
+
+        bool bPrune = false;
+        Spec->TryGetBoolField(TEXT("prune"), bPrune);
+
+        // ---- Resolve and validate, before anything is modified -------------
+        TArray<FNodeSpec> Nodes;
+        TMap<FString, int32> NodeByKey;
+        const TArray<TSharedPtr<FJsonValue>>* NodeValues = nullptr;
+        if (Spec->TryGetArrayField(TEXT("nodes"), NodeValues))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *NodeValues)
+            {
+                const TSharedPtr<FJsonObject>* Json = nullptr;
+                if (!Value.IsValid() || !Value->TryGetObject(Json))
+                {
+                    OutError = TEXT("'nodes' must be an array of objects");
+                    return false;
+                }
+                FNodeSpec Node;
+                Node.Json = *Json;
+                Node.Json->TryGetStringField(TEXT("key"), Node.Key);
+                Node.Json->TryGetStringField(TEXT("type"), Node.Type);
+                if (Node.Key.IsEmpty() || Node.Type.IsEmpty())
+                {
+                    OutError = TEXT("Every node needs a 'key' and a 'type'");
+                    return false;
+                }
+                if (Node.Key.Contains(TEXT(".")))
+                {
+                    OutError = FString::Printf(TEXT("Node key '%s' must not contain '.'"), *Node.Key);
+                    return false;
+                }
+                if (NodeByKey.Contains(Node.Key))
+                {
+                    OutError = FString::Printf(TEXT("Node key '%s' is listed twice"), *Node.Key);
+                    return false;
+                }
+                if (!ResolveNodeSpec(*Blueprint, Node, OutError, OutErrorCode))
+                {
+                    return false;
+                }
+                double X = 0.0, Y = 0.0;
+                const bool bHasX = Node.Json->TryGetNumberField(TEXT("x"), X);
+                const bool bHasY = Node.Json->TryGetNumberField(TEXT("y"), Y);
+                if (bHasX || bHasY)
+                {
+                    Node.Position = FVector2D(X, Y);
+                }
+                NodeByKey.Add(Node.Key, Nodes.Num());
+                Nodes.Add(MoveTemp(Node));
+            }
+        }
+
+        TArray<FLinkSpec> Links;
+        const TArray<TSharedPtr<FJsonValue>>* LinkValues = nullptr;
+        if (Spec->TryGetArrayField(TEXT("links"), LinkValues))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *LinkValues)
+            {
+                const TSharedPtr<FJsonObject>* Json = nullptr;
+                FLinkSpec Link;
+                if (!Value.IsValid() || !Value->TryGetObject(Json) ||
+                    !ParseEndpoint(*Json, TEXT("from"), TEXT("fromPin"), Link.FromNode, Link.FromPin) ||
+                    !ParseEndpoint(*Json, TEXT("to"), TEXT("toPin"), Link.ToNode, Link.ToPin))
+                {
+                    OutError = TEXT("Every link needs 'from' and 'to' as '<key>.<Pin>'");
+                    return false;
+                }
+                for (const FString* Endpoint : {&Link.FromNode, &Link.ToNode})
+                {
+                    if (!NodeByKey.Contains(*Endpoint) && !FindNodeByIdOrName(*Graph, *Endpoint))
+                    {
+                        OutError = FString::Printf(TEXT("Link endpoint '%s' is neither a spec key nor a node in the graph"), **Endpoint);
+                        OutErrorCode = TEXT("NODE_NOT_FOUND");
+                        return false;
+                    }
+                }
+                Links.Add(MoveTemp(Link));
+            }
+        }
+
+        OutErrorCode.Reset();
+        const UEdGraphSchema* Schema = Graph->GetSchema();
+        bool bStructural = false;
+        {
+            const FScopedTransaction Transaction(FText::FromString(TEXT("Apply Blueprint Graph")));
+            Blueprint->Modify();
+            Graph->Modify();
+
+            // ---- Match ----------------------------------------------------------
+            TSet<UEdGraphNode*> Claimed;
+            for (FNodeSpec& Node : Nodes)
+            {
+                const FGuid Guid = KeyGuid(*Graph, Node.Key);
+                for (UEdGraphNode* Existing : Graph->Nodes)
+                {
+                    if (Existing && Existing->NodeGuid == Guid)
+                    {
+                        Node.Node = Existing;
+                        break;
+                    }
+                }
+                if (!Node.Node)
+                {
+                    UEdGraphNode* Named = FindNodeByIdOrName(*Graph, Node.Key);
+                    Node.Node = Named && !Claimed.Contains(Named) ? Named : nullptr;
+                }
+                if (!Node.Node && (Node.Kind == ENodeKind::Event || Node.Kind == ENodeKind::CustomEvent))
+                {
+                    // Overridden and custom events are unique per class; adopt the existing one
+                    for (UEdGraphNode* Existing : Graph->Nodes)
+                    {
+                        if (Existing && !Claimed.Contains(Existing) && NodeMatchesSpec(*Existing, Node))
+                        {
+                            Node.Node = Existing;
+                            break;
+                        }
+                    }
+                }
+                if (Node.Node)
+                {
+                    Claimed.Add(Node.Node);
+                }
+            }
+
+            // ---- Prune ----------------------------------------------------------
+            if (bPrune)
+            {
+                TArray<UEdGraphNode*> ToRemove;
+                for (UEdGraphNode* Existing : Graph->Nodes)
+                {
+                    if (Existing && !Claimed.Contains(Existing) && Existing->CanUserDeleteNode())
+                    {
+                        ToRemove.Add(Existing);
+                    }
+                }
+                for (UEdGraphNode* Existing : ToRemove)
+                {
+                    FBlueprintEditorUtils::RemoveNode(Blueprint, Existing, true);
+                    ++OutResult.Deleted;
+                }
+            }
+
+            // ---- Create, replace, update ----------------------------------------
+            int32 AutoIndex = 0;
+            for (FNodeSpec& Node : Nodes)
+            {
+                if (Node.Node && !NodeMatchesSpec(*Node.Node, Node))
+                {
+                    if (!Node.Position.IsSet())
+                    {
+                        Node.Position = FVector2D(static_cast<double>(Node.Node->NodePosX), static_cast<double>(Node.Node->NodePosY));
+                    }
+                    FBlueprintEditorUtils::RemoveNode(Blueprint, Node.Node, true);
+                    Node.Node = nullptr;
+                    ++OutResult.Replaced;
+                }
+                else if (Node.Node)
+                {
+                    Node.Node->Modify();
+                    if (Node.Position.IsSet())
+                    {
+                        Node.Node->NodePosX = static_cast<int32>(Node.Position->X);
+                        Node.Node->NodePosY = static_cast<int32>(Node.Position->Y);
+                    }
+                    ++OutResult.Updated;
+                }
+
+                if (!Node.Node)
+                {
+                    // Unplaced new nodes go on a grid so they do not stack
+                    const FVector2D Position = Node.Position.Get(FVector2D((AutoIndex % 8) * 320.0, (AutoIndex / 8) * 200.0));
+                    ++AutoIndex;
+                    Node.Node = CreateNode(*Graph, Node, Position);
+                    Node.Node->NodeGuid = KeyGuid(*Graph, Node.Key);
+                    ++OutResult.Created;
+                }
+
+                FString Comment;
+                if (Node.Json->TryGetStringField(TEXT("comment"), Comment) && Node.Node->NodeComment != Comment)
+                {
+                    Node.Node->NodeComment = Comment;
+                    Node.Node->bCommentBubbleVisible = !Comment.IsEmpty();
+                }
+
+                const TSharedPtr<FJsonObject>* Pins = nullptr;
+                if (Node.Json->TryGetObjectField(TEXT("pins"), Pins))
+                {
+                    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Pins)->Values)
+                    {
+                        UEdGraphPin* Pin = FindPinByName(*Node.Node, Pair.Key);
+                        FString Value;
+                        if (!Pin || Pin->Direction != EGPD_Input)
+                        {
+                            OutResult.Warnings.Add(FString::Printf(TEXT("%s: no input pin '%s'"), *Node.Key, *Pair.Key));
+                        }
+                        else if (!Pair.Value.IsValid() || !Pair.Value->TryGetString(Value))
+                        {
+                            OutResult.Warnings.Add(FString::Printf(TEXT("%s.%s: default must be a string, number or bool"),
+                                *Node.Key, *Pair.Key));
+                        }
+                        else if (Pin->GetDefaultAsString() != Value)
+                        {
+                            Schema->TrySetDefaultValue(*Pin, Value);
+                            ++OutResult.DefaultsSet;
+                        }
+                    }
+                }
+            }
+
+            // ---- Links ----------------------------------------------------------
+            auto ResolveNode = [&](const FString& Ref) -> UEdGraphNode*
+            {
+                const int32* Index = NodeByKey.Find(Ref);
+                return Index ? Nodes[*Index].Node : FindNodeByIdOrName(*Graph, Ref);
+            };
+
+            TSet<TPair<UEdGraphPin*, UEdGraphPin*>> Desired;
+            for (const FLinkSpec& Link : Links)
+            {
+                UEdGraphNode* FromNode = ResolveNode(Link.FromNode);
+                UEdGraphNode* ToNode = ResolveNode(Link.ToNode);
+                UEdGraphPin* FromPin = FromNode ? FindPinByName(*FromNode, Link.FromPin) : nullptr;
+                UEdGraphPin* ToPin = ToNode ? FindPinByName(*ToNode, Link.ToPin) : nullptr;
+                if (!FromPin || !ToPin)
+                {
+                    OutResult.Warnings.Add(FString::Printf(TEXT("Link %s.%s -> %s.%s: pin not found"), *Link.FromNode,
+                        *Link.FromPin, *Link.ToNode, *Link.ToPin));
+                    continue;
+                }
+                // Store as (output, input) whichever way round it was written
+                if (FromPin->Direction == EGPD_Input)
+                {
+                    Swap(FromPin, ToPin);
+                }
+                Desired.Add(TPair<UEdGraphPin*, UEdGraphPin*>(FromPin, ToPin));
+            }
+
+            TSet<UEdGraphNode*> SpecNodes;
+            for (const FNodeSpec& Node : Nodes)
+            {
+                SpecNodes.Add(Node.Node);
+            }
+            for (UEdGraphNode* Node : SpecNodes)
+            {
+                for (UEdGraphPin* Pin : Node->Pins)
+                {
+                    if (!Pin || Pin->Direction != EGPD_Output)
+                    {
+                        continue;
+                    }
+                    const TArray<UEdGraphPin*> LinkedTo = Pin->LinkedTo;
+                    for (UEdGraphPin* Other : LinkedTo)
+                    {
+                        if (Other && SpecNodes.Contains(Other->GetOwningNode()) &&
+                            !Desired.Contains(TPair<UEdGraphPin*, UEdGraphPin*>(Pin, Other)))
+                        {
+                            Schema->BreakSinglePinLink(Pin, Other);
+                            ++OutResult.Unlinked;
+                        }
+                    }
+                }
+            }
+            for (const TPair<UEdGraphPin*, UEdGraphPin*>& Link : Desired)
+            {
+                if (Link.Key->LinkedTo.Contains(Link.Value))
+                {
+                    continue;
+                }
+                if (Schema->TryCreateConnection(Link.Key, Link.Value))
+                {
+                    ++OutResult.Linked;
+                }
+                else
+                {
+                    OutResult.Warnings.Add(FString::Printf(TEXT("Link %s.%s -> %s.%s rejected by the schema"),
+                        *Link.Key->GetOwningNode()->GetName(), *Link.Key->PinName.ToString(),
+                        *Link.Value->GetOwningNode()->GetName(), *Link.Value->PinName.ToString()));
+                }
+            }
+
+            for (const FNodeSpec& Node : Nodes)
+            {
+                TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+                Json->SetStringField(TEXT("nodeId"), Node.Node->NodeGuid.ToString());
+                Json->SetStringField(TEXT("nodeName"), Node.Node->GetName());
+                Json->SetStringField(TEXT("nodeClass"), Node.Node->GetClass()->GetName());
+                OutResult.NodeIds->SetObjectField(Node.Key, Json);
+            }
+
+            // One modification notice for the whole spec
+            bStructural = OutResult.Created + OutResult.Replaced + OutResult.Deleted > 0;
+            Graph->NotifyGraphChanged();
+            if (bStructural)
+            {
+                FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+            }
+            else
+            {
+                FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+            }
+        }
+        OutResult.ApplySeconds = FPlatformTime::Seconds() - StartSeconds;
+
+        if (bCompile)
+        {
+            const double CompileStart = FPlatformTime::Seconds();
+            OutResult.bCompileDeferred = McpCompileScheduler::IsDeferring();
+            McpSafeCompileBlueprint(Blueprint);
+            OutResult.bCompileRequested = true;
+            OutResult.CompileSeconds = FPlatformTime::Seconds() - CompileStart;
+        }
+        OutResult.BlueprintStatus = StatusName(Blueprint->Status);
+        return true;
+#else
+        OutError = TEXT("apply_graph requires the editor");
+        OutErrorCode = TEXT("EDITOR_ONLY");
+        return false;
+#endif
+    }
+}
@@ -0,0 +1,99 @@
+// =============================================================================
+// McpBlueprintGraphSpec.h
+// =============================================================================
+// Declarative Blueprint graphs for manage_blueprint_graph apply_graph.
+//
+// create_node, connect_pins, set_pin_default_value and delete_node change one
+// node or link per request, and each one re-resolves the graph and saves the
+// Blueprint. A spec describes the nodes, pin defaults and links of a graph
+// instead; Apply diffs it against the graph in one transaction:
+//
+//   - every spec node has a key; a node created for a key gets a GUID derived
+//     from the graph name and the key, so the key finds it again on later
+//     applies. A key may also name an existing node by GUID or object name,
+//     and an unmatched event node adopts an existing event of the same name.
+//   - matched nodes whose type or member changed are replaced, the others are
+//     moved and have their pin defaults updated in place
+//   - links between spec nodes are made exactly as listed: missing links are
+//     created and links between two spec nodes that the spec does not list
+//     are broken. Links to nodes outside the spec are kept.
+//   - with prune, deletable nodes the spec does not mention are removed
+//
+// The Blueprint is marked modified once and compiled once at the end (the
+// compile follows McpCompileScheduler like any other edit).
+//
+// SPEC:
+//   {
+//     "nodes": [ { "key", "type", "x", "y", "comment",
+//                  "function": "Class.Function" | "memberName" + "memberClass",
+//                  "variableName", "eventName", "targetClass", "inputAxisName",
+//                  "pins": { "<InputPin>": "<default value>" } } ],
+//     "links": [ { "from": "<key>.<Pin>", "to": "<key>.<Pin>" } ],
+//     "prune": false
+//   }
+// "type" takes the create_node names: CallFunction (or a shortcut such as
+// PrintString), VariableGet, VariableSet, Event, CustomEvent, Cast /
+// CastTo<Class>, InputAxisEvent, Branch, Sequence, ..., or any node class.
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UBlueprint;
+class UEdGraph;
+
+namespace McpBlueprintGraphSpec
+{
+    struct FApplyResult
+    {
+        int32 Created = 0;
+        int32 Updated = 0;
+        int32 Replaced = 0;
+        int32 Deleted = 0;
+        int32 Linked = 0;
+        int32 Unlinked = 0;
+        int32 DefaultsSet = 0;
+
+        /** McpSafeCompileBlueprint ran (false with compile: false). */
+        bool bCompileRequested = false;
+
+        /** The compile was deferred to McpCompileScheduler. */
+        bool bCompileDeferred = false;
+
+        /** Blueprint status after the compile: upToDate, dirty, error, ... */
+        FString BlueprintStatus;
+
+        double ApplySeconds = 0.0;
+        double CompileSeconds = 0.0;
+
+        /** Spec key -> { nodeId, nodeName, nodeClass } of the node it resolved to. */
+        TSharedPtr<FJsonObject> NodeIds;
+
+        /** Non-fatal problems: unknown pins, rejected links or defaults. */
+        TArray<FString> Warnings;
+
+        TSharedPtr<FJsonObject> ToJson() const;
+    };
+
+    /**
+     * Diff Spec against Graph and apply it in one transaction, then compile
+     * once (unless bCompile is false). Node types, functions, variables,
+     * events and link endpoints are validated before anything changes; on
+     * failure nothing is modified and OutError / OutErrorCode describe it.
+     */
+    bool Apply(UBlueprint* Blueprint, UEdGraph* Graph, const TSharedPtr<FJsonObject>& Spec, bool bCompile,
+               FApplyResult& OutResult, FString& OutError, FString& OutErrorCode);
+
+    /** The class and function behind a create_node shortcut (PrintString, Delay, ...). */
+    const TTuple<FString, FString>* FindFunctionShortcut(const FString& NodeType);
+
+    /** A node class by create_node alias (Branch, Sequence, ...) or class name, with or without K2Node_. */
+    UClass* FindNodeClass(const FString& NodeType);
+}
@@ -729,6 +729,21 @@ bool FMcpBridgeWebSocket::Send(const void *Data, SIZE_T Length) {
   return SendTextFrame(Data, Length);
 }
 
+bool FMcpBridgeWebSocket::SendBinary(const void *Data, SIZE_T Length) {
+  if (!IsConnected()) {
+    return false;
+  }
+  if (bUseTls) {
+    if (!SslHandle) {
+      return false;
+    }
+  } else if (!Socket) {
+    return false;
+  }
+
+  return SendDataFrame(OpCodeBinary, Data, Length);
+}
+
 bool FMcpBridgeWebSocket::IsConnected() const { return bConnected; }
 
 bool FMcpBridgeWebSocket::IsListening() const { return bListening; }
@@ -1608,10 +1623,15 @@ bool FMcpBridgeWebSocket::SendCloseFrame(int32 StatusCode,
 }
 
 bool FMcpBridgeWebSocket::SendTextFrame(const void *Data, SIZE_T Length) {
+  return SendDataFrame(OpCodeText, Data, Length);
+}
+
+bool FMcpBridgeWebSocket::SendDataFrame(const uint8 DataOpCode,
+                                        const void *Data, SIZE_T Length) {
   const uint8 *Raw = static_cast<const uint8 *>(Data);
   TArray<uint8> Frame;
 
-  const uint8 Header = 0x80 | OpCodeText;
+  const uint8 Header = 0x80 | (DataOpCode & 0x0F);
   Frame.Add(Header);
 
   const bool bMask = !bServerAcceptedConnection;
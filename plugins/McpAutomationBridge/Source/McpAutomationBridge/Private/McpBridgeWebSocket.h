@@ -43,6 +43,8 @@ public:
     void Close(int32 StatusCode = 1000, const FString& Reason = FString());
     bool Send(const FString& Data);
     bool Send(const void* Data, SIZE_T Length);
+    /** Send a binary frame (used for viewport stream frames). */
+    bool SendBinary(const void* Data, SIZE_T Length);
     bool IsConnected() const;
     bool IsListening() const;
 
@@ -94,6 +96,7 @@ private:
     bool SendFrame(const TArray<uint8>& Frame);
     bool SendCloseFrame(int32 StatusCode, const FString& Reason);
     bool SendTextFrame(const void* Data, SIZE_T Length);
+    bool SendDataFrame(uint8 DataOpCode, const void* Data, SIZE_T Length);
     bool SendControlFrame(uint8 ControlOpCode, const TArray<uint8>& Payload);
     void HandleTextPayload(const TArray<uint8>& Payload);
     void ResetFragmentState();
@@ -0,0 +1,1074 @@
+// =============================================================================
+// McpBuildJobs.cpp
+// =============================================================================
+// Implementation of background build-process supervision and diagnostic parsing.
+// =============================================================================
+
+#include "McpBuildJobs.h"
+
+#include "Async/Async.h"
+#include "Dom/JsonValue.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTime.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Internationalization/Regex.h"
+#include "Misc/App.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace McpBuildJobs
+{
+    namespace
+    {
+        constexpr int32 MAX_CONCURRENT_JOBS = 4;
+        constexpr int32 MAX_FINISHED_JOBS = 16;
+        // Output lines kept per job for get_ubt_job; older lines are dropped
+        constexpr int32 MAX_RETAINED_LINES = 4000;
+        constexpr int32 OUTPUT_TAIL_LINES = 400;
+        constexpr int32 MAX_DIAGNOSTICS = 500;
+        constexpr int32 MAX_LINES_PER_PROGRESS = 20;
+        constexpr double PROGRESS_INTERVAL_SECONDS = 1.0;
+        constexpr double HEARTBEAT_SECONDS = 10.0;
+        constexpr float POLL_INTERVAL_SECONDS = 0.05f;
+
+        enum class EJobState : uint8
+        {
+            Queued,
+            Running,
+            Succeeded,
+            Failed,
+            Cancelled,
+            TimedOut
+        };
+
+        const TCHAR* StateName(EJobState State)
+        {
+            switch (State)
+            {
+            case EJobState::Queued:    return TEXT("queued");
+            case EJobState::Running:   return TEXT("running");
+            case EJobState::Succeeded: return TEXT("succeeded");
+            case EJobState::Failed:    return TEXT("failed");
+            case EJobState::Cancelled: return TEXT("cancelled");
+            case EJobState::TimedOut:  return TEXT("timed_out");
+            }
+            return TEXT("unknown");
+        }
+
+        bool IsFinished(EJobState State)
+        {
+            return State != EJobState::Queued && State != EJobState::Running;
+        }
+
+        struct FJob : public TSharedFromThis<FJob, ESPMode::ThreadSafe>
+        {
+            FString Id;
+            FJobSpec Spec;
+
+            // Game thread only
+            FProgressSink OnProgress;
+            FCompletionSink OnComplete;
+            FRunnableThread* Thread = nullptr;
+            TUniquePtr<FRunnable> Runnable;
+
+            std::atomic<bool> bCancelRequested{false};
+
+            // Shared with the worker; guarded by Mutex
+            mutable FCriticalSection Mutex;
+            EJobState State = EJobState::Queued;
+            FString LaunchError;
+            int32 ReturnCode = -1;
+            double QueuedTime = 0.0;
+            double StartTime = 0.0;
+            double EndTime = 0.0;
+            TArray<FString> Lines;
+            int32 FirstLineIndex = 0;
+            int32 TotalLines = 0;
+            TArray<FDiagnostic> Diagnostics;
+            TSet<uint32> DiagnosticHashes;
+            int32 ErrorCount = 0;
+            int32 WarningCount = 0;
+            int32 ActionsDone = 0;
+            int32 ActionsTotal = 0;
+            // Automation test jobs only
+            int32 TestsFound = 0;
+            int32 TestsPassed = 0;
+            int32 TestsFailed = 0;
+            int32 TestsSkipped = 0;
+            TArray<FString> FailedTests;
+        };
+
+        using FJobPtr = TSharedPtr<FJob, ESPMode::ThreadSafe>;
+
+        struct FRegistry
+        {
+            TMap<FString, FJobPtr> Jobs;
+            TArray<FString> Queue;
+            TArray<FString> Running;
+            TArray<FString> Finished;
+        };
+
+        // Game thread only
+        FRegistry& GetRegistry()
+        {
+            static FRegistry Registry;
+            return Registry;
+        }
+
+        /** "[12/345] Compile Module.Foo.cpp" -> 12, 345 */
+        bool ParseActionCounter(const FString& Line, int32& OutDone, int32& OutTotal)
+        {
+            if (!Line.StartsWith(TEXT("[")))
+            {
+                return false;
+            }
+            int32 Slash = INDEX_NONE;
+            int32 Close = INDEX_NONE;
+            if (!Line.FindChar(TEXT('/'), Slash) || !Line.FindChar(TEXT(']'), Close) || Slash > Close)
+            {
+                return false;
+            }
+            const FString Done = Line.Mid(1, Slash - 1);
+            const FString Total = Line.Mid(Slash + 1, Close - Slash - 1);
+            if (!Done.IsNumeric() || !Total.IsNumeric())
+            {
+                return false;
+            }
+            OutDone = FCString::Atoi(*Done);
+            OutTotal = FCString::Atoi(*Total);
+            return OutTotal > 0;
+        }
+
+        enum class ETestLine : uint8
+        {
+            None,
+            Found,
+            Passed,
+            Failed,
+            Skipped
+        };
+
+        /**
+         * "... Found 12 Automation Tests, based on 'Project.'" -> Found, 12
+         * "... Test Completed. Result={Fail} Name={Foo} Path={Project.Foo}" -> Failed, "Project.Foo"
+         */
+        ETestLine ParseTestLine(const FString& Line, int32& OutFound, FString& OutTestPath)
+        {
+            static const FRegexPattern FoundPattern(TEXT("Found (\\d+) Automation Tests"));
+            static const FRegexPattern CompletedPattern(
+                TEXT("Test Completed\\. Result=\\{(\\w+)\\}(?: Name=\\{([^}]*)\\})?(?: Path=\\{([^}]*)\\})?"));
+
+            if (Line.Contains(TEXT("Automation Tests")))
+            {
+                FRegexMatcher Matcher(FoundPattern, Line);
+                if (Matcher.FindNext())
+                {
+                    OutFound = FCString::Atoi(*Matcher.GetCaptureGroup(1));
+                    return ETestLine::Found;
+                }
+            }
+            if (!Line.Contains(TEXT("Test Completed")))
+            {
+                return ETestLine::None;
+            }
+            FRegexMatcher Matcher(CompletedPattern, Line);
+            if (!Matcher.FindNext())
+            {
+                return ETestLine::None;
+            }
+            const FString Outcome = Matcher.GetCaptureGroup(1);
+            OutTestPath = Matcher.GetCaptureGroup(3).IsEmpty() ? Matcher.GetCaptureGroup(2) : Matcher.GetCaptureGroup(3);
+            if (Outcome.Equals(TEXT("Success"), ESearchCase::IgnoreCase))
+            {
+                return ETestLine::Passed;
+            }
+            if (Outcome.Equals(TEXT("Skipped"), ESearchCase::IgnoreCase) || Outcome.Equals(TEXT("NotRun"), ESearchCase::IgnoreCase))
+            {
+                return ETestLine::Skipped;
+            }
+            return ETestLine::Failed;
+        }
+
+        float PercentOf(const FJob& Job)
+        {
+            if (Job.Spec.bAutomationTests)
+            {
+                const int32 Completed = Job.TestsPassed + Job.TestsFailed + Job.TestsSkipped;
+                return Job.TestsFound > 0
+                    ? FMath::Clamp(100.0f * Completed / Job.TestsFound, 0.0f, 100.0f)
+                    : -1.0f;
+            }
+            return Job.ActionsTotal > 0
+                ? FMath::Clamp(100.0f * Job.ActionsDone / Job.ActionsTotal, 0.0f, 100.0f)
+                : -1.0f;
+        }
+
+        class FJobRunnable : public FRunnable
+        {
+        public:
+            explicit FJobRunnable(const FJobPtr& InJob)
+                : Job(InJob)
+            {
+            }
+
+            virtual uint32 Run() override
+            {
+                void* ReadPipe = nullptr;
+                void* WritePipe = nullptr;
+                if (!FPlatformProcess::CreatePipe(ReadPipe, WritePipe))
+                {
+                    Complete(EJobState::Failed, -1, TEXT("Failed to create output pipe"));
+                    return 0;
+                }
+
+                // stdout and stderr both arrive through WritePipe
+                FProcHandle Process = FPlatformProcess::CreateProc(
+                    *Job->Spec.Executable, *Job->Spec.Arguments,
+                    false,    // bLaunchDetached
+                    true,     // bLaunchHidden
+                    true,     // bLaunchReallyHidden
+                    nullptr,  // OutProcessID
+                    0,        // PriorityModifier
+                    nullptr,  // OptionalWorkingDirectory
+                    WritePipe);
+
+                if (!Process.IsValid())
+                {
+                    FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+                    Complete(EJobState::Failed, -1,
+                        FString::Printf(TEXT("Failed to launch %s"), *Job->Spec.Executable));
+                    return 0;
+                }
+
+                const double StartTime = FPlatformTime::Seconds();
+                LastReportTime = StartTime;
+                EJobState Outcome = EJobState::Succeeded;
+
+                while (true)
+                {
+                    // Sample before reading so output written just before exit is not lost
+                    const bool bRunning = FPlatformProcess::IsProcRunning(Process);
+                    AppendOutput(FPlatformProcess::ReadPipe(ReadPipe));
+                    if (!bRunning)
+                    {
+                        break;
+                    }
+                    if (Job->bCancelRequested.load())
+                    {
+                        FPlatformProcess::TerminateProc(Process, true);
+                        Outcome = EJobState::Cancelled;
+                        break;
+                    }
+                    if (FPlatformTime::Seconds() - StartTime > Job->Spec.TimeoutSeconds)
+                    {
+                        FPlatformProcess::TerminateProc(Process, true);
+                        Outcome = EJobState::TimedOut;
+                        break;
+                    }
+                    ReportProgress(false);
+                    FPlatformProcess::Sleep(POLL_INTERVAL_SECONDS);
+                }
+
+                AppendOutput(FPlatformProcess::ReadPipe(ReadPipe));
+                if (!PartialLine.IsEmpty())
+                {
+                    AddLine(PartialLine);
+                    PartialLine.Reset();
+                }
+                ReportProgress(true);
+
+                int32 ReturnCode = -1;
+                if (Outcome == EJobState::Succeeded)
+                {
+                    FPlatformProcess::GetProcReturnCode(Process, &ReturnCode);
+                    Outcome = ReturnCode == 0 ? EJobState::Succeeded : EJobState::Failed;
+                }
+                FPlatformProcess::CloseProc(Process);
+                FPlatformProcess::ClosePipe(ReadPipe, WritePipe);
+
+                Complete(Outcome, ReturnCode, FString());
+                return 0;
+            }
+
+            virtual void Stop() override
+            {
+                Job->bCancelRequested.store(true);
+            }
+
+        private:
+            void AppendOutput(const FString& Chunk)
+            {
+                if (Chunk.IsEmpty())
+                {
+                    return;
+                }
+                PartialLine += Chunk;
+
+                int32 LineStart = 0;
+                int32 NewLine = INDEX_NONE;
+                while ((NewLine = PartialLine.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, LineStart)) != INDEX_NONE)
+                {
+                    AddLine(PartialLine.Mid(LineStart, NewLine - LineStart));
+                    LineStart = NewLine + 1;
+                }
+                PartialLine.RightChopInline(LineStart);
+            }
+
+            void AddLine(FString Line)
+            {
+                Line.TrimEndInline();
+                if (Line.IsEmpty())
+                {
+                    return;
+                }
+
+                FDiagnostic Diagnostic;
+                const bool bDiagnostic = ParseDiagnostic(Line, Diagnostic);
+                int32 Done = 0;
+                int32 Total = 0;
+                const bool bCounter = !bDiagnostic && !Job->Spec.bAutomationTests && ParseActionCounter(Line, Done, Total);
+                int32 TestsFound = 0;
+                FString TestPath;
+                const ETestLine TestLine = Job->Spec.bAutomationTests
+                    ? ParseTestLine(Line, TestsFound, TestPath) : ETestLine::None;
+
+                {
+                    FScopeLock Lock(&Job->Mutex);
+                    if (bDiagnostic)
+                    {
+                        // MSVC and UBT both echo some diagnostics; count each once
+                        const uint32 Hash = GetTypeHash(Line);
+                        if (!Job->DiagnosticHashes.Contains(Hash))
+                        {
+                            Job->DiagnosticHashes.Add(Hash);
+                            (Diagnostic.Severity == TEXT("error") ? Job->ErrorCount : Job->WarningCount)++;
+                            if (Job->Diagnostics.Num() < MAX_DIAGNOSTICS)
+                            {
+                                Job->Diagnostics.Add(Diagnostic);
+                            }
+                        }
+                    }
+                    else if (bCounter)
+                    {
+                        Job->ActionsDone = FMath::Max(Job->ActionsDone, Done);
+                        Job->ActionsTotal = FMath::Max(Job->ActionsTotal, Total);
+                    }
+
+                    switch (TestLine)
+                    {
+                    case ETestLine::Found:
+                        Job->TestsFound = FMath::Max(Job->TestsFound, TestsFound);
+                        break;
+                    case ETestLine::Passed:
+                        ++Job->TestsPassed;
+                        break;
+                    case ETestLine::Skipped:
+                        ++Job->TestsSkipped;
+                        break;
+                    case ETestLine::Failed:
+                        ++Job->TestsFailed;
+                        if (Job->FailedTests.Num() < MAX_DIAGNOSTICS)
+                        {
+                            Job->FailedTests.Add(TestPath);
+                        }
+                        break;
+                    default:
+                        break;
+                    }
+
+                    Job->Lines.Add(Line);
+                    ++Job->TotalLines;
+                    // Trim in chunks so the array is not shifted on every line
+                    if (Job->Lines.Num() > MAX_RETAINED_LINES + MAX_RETAINED_LINES / 8)
+                    {
+                        const int32 Drop = Job->Lines.Num() - MAX_RETAINED_LINES;
+                        Job->Lines.RemoveAt(0, Drop);
+                        Job->FirstLineIndex += Drop;
+                    }
+                }
+
+                if (UnreportedLines.Num() >= MAX_LINES_PER_PROGRESS)
+                {
+                    UnreportedLines.RemoveAt(0);
+                }
+                UnreportedLines.Add(MoveTemp(Line));
+                ++UnreportedCount;
+            }
+
+            void ReportProgress(bool bForce)
+            {
+                const double Now = FPlatformTime::Seconds();
+                const bool bHaveLines = UnreportedCount > 0;
+                const bool bDue = bHaveLines
+                    ? bForce || Now - LastReportTime >= PROGRESS_INTERVAL_SECONDS
+                    : !bForce && Now - LastReportTime >= HEARTBEAT_SECONDS;
+                if (!bDue)
+                {
+                    return;
+                }
+
+                float Percent = -1.0f;
+                {
+                    FScopeLock Lock(&Job->Mutex);
+                    Percent = PercentOf(*Job);
+                }
+                // Repeating an unchanged percent makes clients treat the job as stalled
+                const float SentPercent = Percent >= 0.0f && Percent != LastPercent ? Percent : -1.0f;
+                if (SentPercent >= 0.0f)
+                {
+                    LastPercent = Percent;
+                }
+
+                FString Message;
+                if (bHaveLines)
+                {
+                    if (UnreportedCount > UnreportedLines.Num())
+                    {
+                        Message = FString::Printf(TEXT("(%d lines omitted)\n"), UnreportedCount - UnreportedLines.Num());
+                    }
+                    Message += FString::Join(UnreportedLines, TEXT("\n"));
+                }
+                else
+                {
+                    Message = FString::Printf(TEXT("%s: running (%.0fs)"), *Job->Spec.Label, Now - StartSeconds());
+                }
+                UnreportedLines.Reset();
+                UnreportedCount = 0;
+                LastReportTime = Now;
+
+                TWeakPtr<FJob, ESPMode::ThreadSafe> WeakJob = Job;
+                AsyncTask(ENamedThreads::GameThread, [WeakJob, SentPercent, Message = MoveTemp(Message)]()
+                {
+                    FJobPtr Pinned = WeakJob.Pin();
+                    if (Pinned.IsValid() && Pinned->OnProgress)
+                    {
+                        Pinned->OnProgress(SentPercent, Message);
+                    }
+                });
+            }
+
+            double StartSeconds() const
+            {
+                FScopeLock Lock(&Job->Mutex);
+                return Job->StartTime;
+            }
+
+            void Complete(EJobState Outcome, int32 ReturnCode, const FString& LaunchError)
+            {
+                {
+                    FScopeLock Lock(&Job->Mutex);
+                    Job->State = Outcome;
+                    Job->ReturnCode = ReturnCode;
+                    Job->LaunchError = LaunchError;
+                    Job->EndTime = FPlatformTime::Seconds();
+                }
+                const FString Id = Job->Id;
+                AsyncTask(ENamedThreads::GameThread, [Id]() { FinishJob(Id); });
+            }
+
+            static void FinishJob(const FString& Id);
+
+            FJobPtr Job;
+            FString PartialLine;
+            TArray<FString> UnreportedLines;
+            int32 UnreportedCount = 0;
+            double LastReportTime = 0.0;
+            float LastPercent = -1.0f;
+        };
+
+        TArray<TSharedPtr<FJsonValue>> DiagnosticsToJson(const TArray<FDiagnostic>& Diagnostics)
+        {
+            TArray<TSharedPtr<FJsonValue>> Values;
+            Values.Reserve(Diagnostics.Num());
+            for (const FDiagnostic& Diagnostic : Diagnostics)
+            {
+                Values.Add(MakeShared<FJsonValueObject>(DiagnosticToJson(Diagnostic)));
+            }
+            return Values;
+        }
+
+        // Caller holds Job.Mutex
+        void WriteSummary(const FJob& Job, const TSharedPtr<FJsonObject>& Json)
+        {
+            const double Now = FPlatformTime::Seconds();
+            const bool bStarted = Job.StartTime > 0.0;
+            const double End = IsFinished(Job.State) ? Job.EndTime : Now;
+
+            Json->SetStringField(TEXT("jobId"), Job.Id);
+            Json->SetStringField(TEXT("label"), Job.Spec.Label);
+            Json->SetStringField(TEXT("state"), StateName(Job.State));
+            Json->SetNumberField(TEXT("queueMs"), ((bStarted ? Job.StartTime : End) - Job.QueuedTime) * 1000.0);
+            Json->SetNumberField(TEXT("durationMs"), bStarted ? (End - Job.StartTime) * 1000.0 : 0.0);
+            Json->SetNumberField(TEXT("actionsCompleted"), Job.ActionsDone);
+            Json->SetNumberField(TEXT("actionsTotal"), Job.ActionsTotal);
+            Json->SetNumberField(TEXT("percent"), FMath::Max(0.0f, PercentOf(Job)));
+            Json->SetNumberField(TEXT("errorCount"), Job.ErrorCount);
+            Json->SetNumberField(TEXT("warningCount"), Job.WarningCount);
+            Json->SetNumberField(TEXT("totalLines"), Job.TotalLines);
+            if (IsFinished(Job.State))
+            {
+                Json->SetNumberField(TEXT("returnCode"), Job.ReturnCode);
+            }
+            if (Job.Spec.bAutomationTests)
+            {
+                TSharedPtr<FJsonObject> Tests = MakeShared<FJsonObject>();
+                Tests->SetNumberField(TEXT("found"), Job.TestsFound);
+                Tests->SetNumberField(TEXT("passed"), Job.TestsPassed);
+                Tests->SetNumberField(TEXT("failed"), Job.TestsFailed);
+                Tests->SetNumberField(TEXT("skipped"), Job.TestsSkipped);
+                TArray<TSharedPtr<FJsonValue>> Failed;
+                for (const FString& Path : Job.FailedTests)
+                {
+                    Failed.Add(MakeShared<FJsonValueString>(Path));
+                }
+                Tests->SetArrayField(TEXT("failedTests"), Failed);
+                Json->SetObjectField(TEXT("tests"), Tests);
+            }
+        }
+
+        TSharedPtr<FJsonObject> BuildResult(const FJob& Job)
+        {
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            FScopeLock Lock(&Job.Mutex);
+            WriteSummary(Job, Result);
+
+            const int32 TailCount = FMath::Min(OUTPUT_TAIL_LINES, Job.Lines.Num());
+            TArray<FString> Tail(Job.Lines.GetData() + Job.Lines.Num() - TailCount, TailCount);
+            Result->SetStringField(TEXT("output"), FString::Join(Tail, TEXT("\n")));
+            Result->SetBoolField(TEXT("outputTruncated"), TailCount < Job.TotalLines);
+            Result->SetArrayField(TEXT("diagnostics"), DiagnosticsToJson(Job.Diagnostics));
+            Result->SetBoolField(TEXT("diagnosticsTruncated"),
+                Job.Diagnostics.Num() < Job.ErrorCount + Job.WarningCount);
+            Result->SetStringField(TEXT("executable"), Job.Spec.Executable);
+            Result->SetStringField(TEXT("arguments"), Job.Spec.Arguments);
+            Result->SetBoolField(TEXT("timedOut"), Job.State == EJobState::TimedOut);
+            Result->SetBoolField(TEXT("cancelled"), Job.State == EJobState::Cancelled);
+            return Result;
+        }
+
+        void RetireFinished(const FString& Id)
+        {
+            FRegistry& Registry = GetRegistry();
+            Registry.Finished.Add(Id);
+            while (Registry.Finished.Num() > MAX_FINISHED_JOBS)
+            {
+                Registry.Jobs.Remove(Registry.Finished[0]);
+                Registry.Finished.RemoveAt(0);
+            }
+        }
+
+        void NotifyComplete(const FJobPtr& Job)
+        {
+            TSharedPtr<FJsonObject> Result = BuildResult(*Job);
+
+            EJobState State;
+            int32 ReturnCode;
+            int32 ErrorCount;
+            int32 TestsFailed;
+            int32 TestsPassed;
+            FString LaunchError;
+            {
+                FScopeLock Lock(&Job->Mutex);
+                State = Job->State;
+                ReturnCode = Job->ReturnCode;
+                ErrorCount = Job->ErrorCount;
+                TestsFailed = Job->TestsFailed;
+                TestsPassed = Job->TestsPassed;
+                LaunchError = Job->LaunchError;
+            }
+
+            bool bSuccess = false;
+            FString Message;
+            FString ErrorCode;
+            switch (State)
+            {
+            case EJobState::Succeeded:
+                // The editor can exit cleanly after failed tests, so the counts decide
+                if (Job->Spec.bAutomationTests && TestsFailed > 0)
+                {
+                    Message = FString::Printf(TEXT("%s: %d tests failed, %d passed"), *Job->Spec.Label, TestsFailed, TestsPassed);
+                    ErrorCode = Job->Spec.FailureErrorCode;
+                    break;
+                }
+                bSuccess = true;
+                Message = Job->Spec.bAutomationTests
+                    ? FString::Printf(TEXT("%s: %d tests passed"), *Job->Spec.Label, TestsPassed)
+                    : FString::Printf(TEXT("%s completed successfully"), *Job->Spec.Label);
+                break;
+            case EJobState::Cancelled:
+                Message = FString::Printf(TEXT("%s was cancelled"), *Job->Spec.Label);
+                ErrorCode = TEXT("CANCELLED");
+                break;
+            case EJobState::TimedOut:
+                Message = FString::Printf(TEXT("%s timed out after %.0f seconds"), *Job->Spec.Label, Job->Spec.TimeoutSeconds);
+                ErrorCode = TEXT("TIMEOUT");
+                break;
+            default:
+                if (!LaunchError.IsEmpty())
+                {
+                    Message = LaunchError;
+                    ErrorCode = TEXT("PROCESS_LAUNCH_FAILED");
+                }
+                else
+                {
+                    Message = FString::Printf(TEXT("%s failed with code %d (%d errors)"),
+                        *Job->Spec.Label, ReturnCode, ErrorCount);
+                    ErrorCode = Job->Spec.FailureErrorCode;
+                }
+                break;
+            }
+
+            // Drop the sinks before invoking so nothing they capture outlives the job
+            FCompletionSink OnComplete = MoveTemp(Job->OnComplete);
+            Job->OnProgress = nullptr;
+            if (OnComplete)
+            {
+                OnComplete(bSuccess, Message, Result, ErrorCode);
+            }
+        }
+
+        void StartQueuedJobs()
+        {
+            FRegistry& Registry = GetRegistry();
+            while (Registry.Running.Num() < MAX_CONCURRENT_JOBS && Registry.Queue.Num() > 0)
+            {
+                const FString Id = Registry.Queue[0];
+                Registry.Queue.RemoveAt(0);
+                FJobPtr Job = Registry.Jobs.FindRef(Id);
+                if (!Job.IsValid())
+                {
+                    continue;
+                }
+
+                {
+                    FScopeLock Lock(&Job->Mutex);
+                    Job->State = EJobState::Running;
+                    Job->StartTime = FPlatformTime::Seconds();
+                }
+                Registry.Running.Add(Id);
+
+                Job->Runnable = MakeUnique<FJobRunnable>(Job);
+                Job->Thread = FRunnableThread::Create(Job->Runnable.Get(),
+                    *FString::Printf(TEXT("McpBuildJob_%s"), *Id), 0, TPri_BelowNormal);
+                if (!Job->Thread)
+                {
+                    Registry.Running.Remove(Id);
+                    Job->Runnable.Reset();
+                    {
+                        FScopeLock Lock(&Job->Mutex);
+                        Job->State = EJobState::Failed;
+                        Job->LaunchError = TEXT("Failed to create build job thread");
+                        Job->EndTime = FPlatformTime::Seconds();
+                    }
+                    RetireFinished(Id);
+                    NotifyComplete(Job);
+                }
+            }
+        }
+
+        void FJobRunnable::FinishJob(const FString& Id)
+        {
+            FRegistry& Registry = GetRegistry();
+            FJobPtr Job = Registry.Jobs.FindRef(Id);
+            if (!Job.IsValid() || !Registry.Running.Contains(Id))
+            {
+                // Already torn down by CancelAll
+                return;
+            }
+
+            // The worker has returned from Run(); this only joins the OS thread
+            if (Job->Thread)
+            {
+                Job->Thread->WaitForCompletion();
+                delete Job->Thread;
+                Job->Thread = nullptr;
+            }
+            Job->Runnable.Reset();
+
+            Registry.Running.Remove(Id);
+            RetireFinished(Id);
+            NotifyComplete(Job);
+            StartQueuedJobs();
+        }
+
+        FString QuoteIfNeeded(const FString& Value)
+        {
+            return Value.Contains(TEXT(" ")) && !Value.StartsWith(TEXT("\"")) ? FString::Printf(TEXT("\"%s\""), *Value) : Value;
+        }
+    }
+
+    bool MakeUbtJobSpec(const FString& Target, const FString& Platform, const FString& Configuration,
+                        const FString& AdditionalArgs, FJobSpec& OutSpec, FString& OutError)
+    {
+#if PLATFORM_WINDOWS
+        const FString BatchFile = TEXT("Build/BatchFiles/Build.bat");
+#else
+        const FString BatchFile = TEXT("Build/BatchFiles/Build.sh");
+#endif
+        const FString UbtPath = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::EngineDir(), BatchFile));
+        if (!FPaths::FileExists(UbtPath))
+        {
+            OutError = FString::Printf(TEXT("UBT not found at: %s"), *UbtPath);
+            return false;
+        }
+
+        FString ResolvedPlatform = Platform;
+        if (ResolvedPlatform.IsEmpty())
+        {
+#if PLATFORM_WINDOWS
+            ResolvedPlatform = TEXT("Win64");
+#elif PLATFORM_MAC
+            ResolvedPlatform = TEXT("Mac");
+#else
+            ResolvedPlatform = TEXT("Linux");
+#endif
+        }
+        const FString ResolvedConfiguration = Configuration.IsEmpty() ? FString(TEXT("Development")) : Configuration;
+
+        TArray<FString> Args;
+        if (!Target.IsEmpty())
+        {
+            Args.Add(Target);
+        }
+        Args.Add(ResolvedPlatform);
+        Args.Add(ResolvedConfiguration);
+
+        // Project targets only resolve when UBT is told which project to load
+        const FString ProjectPath = FPaths::IsProjectFilePathSet()
+            ? FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()) : FString();
+        if (!ProjectPath.IsEmpty() && FPaths::FileExists(ProjectPath) &&
+            !AdditionalArgs.Contains(TEXT("-project="), ESearchCase::IgnoreCase))
+        {
+            Args.Add(FString::Printf(TEXT("-project=%s"), *QuoteIfNeeded(ProjectPath)));
+        }
+        if (!AdditionalArgs.IsEmpty())
+        {
+            Args.Add(AdditionalArgs);
+        }
+
+        OutSpec.Label = FString::Printf(TEXT("UBT %s %s %s"),
+            Target.IsEmpty() ? FApp::GetProjectName() : *Target, *ResolvedPlatform, *ResolvedConfiguration);
+        OutSpec.Executable = UbtPath;
+        OutSpec.Arguments = FString::Join(Args, TEXT(" "));
+        OutSpec.FailureErrorCode = TEXT("UBT_FAILED");
+        return true;
+    }
+
+    bool MakeAutomationTestJobSpec(const FString& Filter, FJobSpec& OutSpec, FString& OutError)
+    {
+        // The filter lands inside -ExecCmds="...", where ; separates console commands
+        for (const TCHAR* Forbidden : {TEXT("\""), TEXT(";"), TEXT("\n"), TEXT("\r"), TEXT("|"), TEXT("&"), TEXT("<"), TEXT(">"), TEXT("`")})
+        {
+            if (Filter.Contains(Forbidden))
+            {
+                OutError = TEXT("Test filter contains forbidden characters (quotes, newlines, ;, |, &, <, >, `)");
+                return false;
+            }
+        }
+
+        const FString ProjectPath = FPaths::IsProjectFilePathSet()
+            ? FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()) : FString();
+        if (ProjectPath.IsEmpty() || !FPaths::FileExists(ProjectPath))
+        {
+            OutError = TEXT("No .uproject is loaded to run tests against");
+            return false;
+        }
+
+        // Prefer the console build of the running editor so output reaches the pipe
+        FString EditorPath = FPlatformProcess::ExecutablePath();
+#if PLATFORM_WINDOWS
+        const FString BaseName = FPaths::GetBaseFilename(EditorPath);
+        const FString CmdPath = FPaths::Combine(FPaths::GetPath(EditorPath), BaseName + TEXT("-Cmd.exe"));
+        if (!BaseName.EndsWith(TEXT("-Cmd")) && FPaths::FileExists(CmdPath))
+        {
+            EditorPath = CmdPath;
+        }
+#endif
+        if (!FPaths::FileExists(EditorPath))
+        {
+            OutError = FString::Printf(TEXT("Editor executable not found at: %s"), *EditorPath);
+            return false;
+        }
+
+        const FString TestCommand = Filter.IsEmpty()
+            ? FString(TEXT("Automation RunAll"))
+            : FString::Printf(TEXT("Automation RunTests %s"), *Filter);
+
+        TArray<FString> Args;
+        Args.Add(QuoteIfNeeded(ProjectPath));
+        Args.Add(FString::Printf(TEXT("-ExecCmds=\"%s;Quit\""), *TestCommand));
+        Args.Add(TEXT("-TestExit=\"Automation Test Queue Empty\""));
+        Args.Add(TEXT("-unattended -nopause -nosplash -NullRHI -nosound -stdout -FullStdOutLogOutput"));
+
+        OutSpec.Label = FString::Printf(TEXT("Tests %s"), Filter.IsEmpty() ? TEXT("(all)") : *Filter);
+        OutSpec.Executable = EditorPath;
+        OutSpec.Arguments = FString::Join(Args, TEXT(" "));
+        OutSpec.FailureErrorCode = TEXT("TESTS_FAILED");
+        OutSpec.bAutomationTests = true;
+        return true;
+    }
+
+    FString Start(const FJobSpec& Spec, FProgressSink OnProgress, FCompletionSink OnComplete)
+    {
+        check(IsInGameThread());
+
+        FJobPtr Job = MakeShared<FJob, ESPMode::ThreadSafe>();
+        Job->Id = FString::Printf(TEXT("build_%s"), *FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(8).ToLower());
+        Job->Spec = Spec;
+        Job->OnProgress = MoveTemp(OnProgress);
+        Job->OnComplete = MoveTemp(OnComplete);
+        Job->QueuedTime = FPlatformTime::Seconds();
+
+        FRegistry& Registry = GetRegistry();
+        Registry.Jobs.Add(Job->Id, Job);
+        Registry.Queue.Add(Job->Id);
+
+        const FString Id = Job->Id;
+        StartQueuedJobs();
+        return Id;
+    }
+
+    bool Cancel(const FString& JobId, FString& OutState)
+    {
+        check(IsInGameThread());
+
+        FRegistry& Registry = GetRegistry();
+        FJobPtr Job = Registry.Jobs.FindRef(JobId);
+        if (!Job.IsValid())
+        {
+            return false;
+        }
+
+        if (Registry.Queue.Remove(JobId) > 0)
+        {
+            {
+                FScopeLock Lock(&Job->Mutex);
+                Job->State = EJobState::Cancelled;
+                Job->EndTime = FPlatformTime::Seconds();
+            }
+            RetireFinished(JobId);
+            NotifyComplete(Job);
+            OutState = StateName(EJobState::Cancelled);
+            return true;
+        }
+
+        if (Registry.Running.Contains(JobId))
+        {
+            // The worker terminates the process tree and completes the job
+            Job->bCancelRequested.store(true);
+            OutState = TEXT("cancelling");
+            return true;
+        }
+
+        FScopeLock Lock(&Job->Mutex);
+        OutState = StateName(Job->State);
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> GetJob(const FString& JobId, int32 SinceLine, int32 MaxLines)
+    {
+        check(IsInGameThread());
+
+        FJobPtr Job = GetRegistry().Jobs.FindRef(JobId);
+        if (!Job.IsValid())
+        {
+            return nullptr;
+        }
+
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        FScopeLock Lock(&Job->Mutex);
+        WriteSummary(*Job, Json);
+
+        const int32 From = FMath::Max(SinceLine, Job->FirstLineIndex);
+        const int32 Count = FMath::Clamp(Job->TotalLines - From, 0, FMath::Max(0, MaxLines));
+        TArray<TSharedPtr<FJsonValue>> Lines;
+        Lines.Reserve(Count);
+        for (int32 Index = From; Index < From + Count; ++Index)
+        {
+            Lines.Add(MakeShared<FJsonValueString>(Job->Lines[Index - Job->FirstLineIndex]));
+        }
+        Json->SetArrayField(TEXT("lines"), Lines);
+        Json->SetNumberField(TEXT("firstLine"), From);
+        Json->SetNumberField(TEXT("nextLine"), From + Count);
+        Json->SetNumberField(TEXT("linesDropped"), FMath::Max(0, Job->FirstLineIndex - SinceLine));
+        Json->SetArrayField(TEXT("diagnostics"), DiagnosticsToJson(Job->Diagnostics));
+
+        if (IsFinished(Job->State) && !Job->LaunchError.IsEmpty())
+        {
+            Json->SetStringField(TEXT("error"), Job->LaunchError);
+        }
+        return Json;
+    }
+
+    TSharedPtr<FJsonObject> ListJobs()
+    {
+        check(IsInGameThread());
+
+        const FRegistry& Registry = GetRegistry();
+        TArray<TSharedPtr<FJsonValue>> Jobs;
+        auto AddJobs = [&Registry, &Jobs](const TArray<FString>& Ids)
+        {
+            for (const FString& Id : Ids)
+            {
+                if (const FJobPtr* Job = Registry.Jobs.Find(Id))
+                {
+                    TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                    FScopeLock Lock(&(*Job)->Mutex);
+                    WriteSummary(**Job, Entry);
+                    Jobs.Add(MakeShared<FJsonValueObject>(Entry));
+                }
+            }
+        };
+        AddJobs(Registry.Running);
+        AddJobs(Registry.Queue);
+        AddJobs(Registry.Finished);
+
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetArrayField(TEXT("jobs"), Jobs);
+        Json->SetNumberField(TEXT("running"), Registry.Running.Num());
+        Json->SetNumberField(TEXT("queued"), Registry.Queue.Num());
+        Json->SetNumberField(TEXT("finished"), Registry.Finished.Num());
+        Json->SetNumberField(TEXT("maxConcurrent"), MAX_CONCURRENT_JOBS);
+        return Json;
+    }
+
+    void CancelAll()
+    {
+        FRegistry& Registry = GetRegistry();
+        for (const FString& Id : Registry.Running)
+        {
+            FJobPtr Job = Registry.Jobs.FindRef(Id);
+            if (Job.IsValid() && Job->Thread)
+            {
+                // Kill() calls Stop() and waits for the worker to terminate the process
+                Job->Thread->Kill(true);
+                delete Job->Thread;
+                Job->Thread = nullptr;
+                Job->Runnable.Reset();
+            }
+        }
+        Registry.Jobs.Reset();
+        Registry.Queue.Reset();
+        Registry.Running.Reset();
+        Registry.Finished.Reset();
+    }
+
+    bool ParseDiagnostic(const FString& Line, FDiagnostic& OutDiagnostic)
+    {
+        // Most lines are neither; skip the regex work for them
+        if (!Line.Contains(TEXT("error"), ESearchCase::IgnoreCase) &&
+            !Line.Contains(TEXT("warning"), ESearchCase::IgnoreCase))
+        {
+            return false;
+        }
+
+        auto Normalize = [](const FString& Severity)
+        {
+            return Severity.Contains(TEXT("error"), ESearchCase::IgnoreCase) ? FString(TEXT("error")) : FString(TEXT("warning"));
+        };
+
+        // MSVC: File.cpp(12,5): error C2065: 'x': undeclared identifier
+        static const FRegexPattern MsvcPattern(
+            TEXT("^\\s*(.+?)\\((\\d+)(?:,(\\d+))?\\)\\s*:\\s*(fatal error|error|warning)\\s+([A-Za-z]+\\d+)\\s*:\\s*(.*)$"));
+        {
+            FRegexMatcher Matcher(MsvcPattern, Line);
+            if (Matcher.FindNext())
+            {
+                OutDiagnostic.File = Matcher.GetCaptureGroup(1);
+                OutDiagnostic.Line = FCString::Atoi(*Matcher.GetCaptureGroup(2));
+                OutDiagnostic.Column = FCString::Atoi(*Matcher.GetCaptureGroup(3));
+                OutDiagnostic.Severity = Normalize(Matcher.GetCaptureGroup(4));
+                OutDiagnostic.Code = Matcher.GetCaptureGroup(5);
+                OutDiagnostic.Message = Matcher.GetCaptureGroup(6);
+                return true;
+            }
+        }
+
+        // Clang / GCC: File.cpp:12:5: error: use of undeclared identifier 'x'
+        static const FRegexPattern ClangPattern(
+            TEXT("^\\s*(.+?):(\\d+):(?:(\\d+):)?\\s*(fatal error|error|warning):\\s*(.*)$"));
+        {
+            FRegexMatcher Matcher(ClangPattern, Line);
+            if (Matcher.FindNext())
+            {
+                OutDiagnostic.File = Matcher.GetCaptureGroup(1);
+                OutDiagnostic.Line = FCString::Atoi(*Matcher.GetCaptureGroup(2));
+                OutDiagnostic.Column = FCString::Atoi(*Matcher.GetCaptureGroup(3));
+                OutDiagnostic.Severity = Normalize(Matcher.GetCaptureGroup(4));
+                OutDiagnostic.Message = Matcher.GetCaptureGroup(5);
+                return true;
+            }
+        }
+
+        // MSVC linker / tools without a line: Foo.obj : error LNK2019: unresolved external symbol ...
+        static const FRegexPattern LinkerPattern(
+            TEXT("^\\s*(.*?)\\s*:\\s*(fatal error|error|warning)\\s+([A-Za-z]+\\d+)\\s*:\\s*(.*)$"));
+        {
+            FRegexMatcher Matcher(LinkerPattern, Line);
+            if (Matcher.FindNext())
+            {
+                OutDiagnostic.File = Matcher.GetCaptureGroup(1);
+                OutDiagnostic.Severity = Normalize(Matcher.GetCaptureGroup(2));
+                OutDiagnostic.Code = Matcher.GetCaptureGroup(3);
+                OutDiagnostic.Message = Matcher.GetCaptureGroup(4);
+                return true;
+            }
+        }
+
+        // lld / clang driver: ld.lld: error: undefined symbol: ...
+        static const FRegexPattern DriverPattern(
+            TEXT("^\\s*(ld(?:\\.lld)?|lld-link|clang(?:\\+\\+)?|ld64\\.lld)\\s*:\\s*(error|warning)\\s*:\\s*(.*)$"));
+        {
+            FRegexMatcher Matcher(DriverPattern, Line);
+            if (Matcher.FindNext())
+            {
+                OutDiagnostic.File = Matcher.GetCaptureGroup(1);
+                OutDiagnostic.Severity = Normalize(Matcher.GetCaptureGroup(2));
+                OutDiagnostic.Message = Matcher.GetCaptureGroup(3);
+                return true;
+            }
+        }
+
+        // UBT itself: ERROR: Could not find definition for module 'Foo'
+        static const TCHAR* const UbtPrefixes[] = { TEXT("ERROR:"), TEXT("WARNING:") };
+        const FString Trimmed = Line.TrimStart();
+        for (const TCHAR* Prefix : UbtPrefixes)
+        {
+            if (Trimmed.StartsWith(Prefix, ESearchCase::IgnoreCase))
+            {
+                OutDiagnostic.Severity = Normalize(Prefix);
+                OutDiagnostic.Message = Trimmed.RightChop(FCString::Strlen(Prefix)).TrimStart();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> DiagnosticToJson(const FDiagnostic& Diagnostic)
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetStringField(TEXT("severity"), Diagnostic.Severity);
+        if (!Diagnostic.File.IsEmpty())
+        {
+            Json->SetStringField(TEXT("file"), Diagnostic.File);
+        }
+        if (Diagnostic.Line > 0)
+        {
+            Json->SetNumberField(TEXT("line"), Diagnostic.Line);
+        }
+        if (Diagnostic.Column > 0)
+        {
+            Json->SetNumberField(TEXT("column"), Diagnostic.Column);
+        }
+        if (!Diagnostic.Code.IsEmpty())
+        {
+            Json->SetStringField(TEXT("code"), Diagnostic.Code);
+        }
+        Json->SetStringField(TEXT("message"), Diagnostic.Message);
+        return Json;
+    }
+}
@@ -0,0 +1,123 @@
+// =============================================================================
+// McpBuildJobs.h
+// =============================================================================
+// Background supervision of external build processes (UnrealBuildTool, and
+// headless editor instances running automation tests for run_tests).
+//
+// run_ubt used to launch UBT and then loop on IsProcRunning / ReadPipe / Sleep
+// inside the handler, which held the game thread - and every other automation
+// request - for the whole build. Each job now owns an FRunnable thread that
+// launches the process, reads its merged stdout/stderr, splits the output into
+// lines, parses compiler, linker and UBT diagnostics plus the "[n/m]" action
+// counter, and enforces the timeout. The game thread only receives throttled
+// progress callbacks carrying the newest lines and one completion callback
+// with the structured result.
+//
+// Up to MaxConcurrentJobs processes run at once; further jobs wait in a FIFO
+// queue. Cancelling a job terminates its process tree. Finished jobs stay
+// queryable (output tail, diagnostics, timings) until MaxFinishedJobs newer
+// jobs have finished, so a client can start a build without waiting and poll
+// it with get_ubt_job.
+//
+// Test jobs run "Automation RunTests" in a separate UnrealEditor-Cmd process
+// with -NullRHI, so the editor serving requests never runs the tests itself.
+// Their "Found N Automation Tests" and "Test Completed" log lines drive the
+// progress percent and the passed / failed / skipped counts.
+//
+// Start, Cancel, GetJob and ListJobs are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpBuildJobs
+{
+    /** One compiler / linker / UBT diagnostic parsed from a build output line. */
+    struct FDiagnostic
+    {
+        /** "error" or "warning". */
+        FString Severity;
+        FString File;
+        int32 Line = 0;
+        int32 Column = 0;
+        /** Tool-specific code such as C2065 or LNK2019 (empty for clang and UBT messages). */
+        FString Code;
+        FString Message;
+    };
+
+    struct FJobSpec
+    {
+        /** Human-readable name used in progress messages and job listings. */
+        FString Label;
+        FString Executable;
+        FString Arguments;
+        /** The process tree is terminated once it has run this long. */
+        double TimeoutSeconds = 3600.0;
+        /** Error code reported when the process exits non-zero. */
+        FString FailureErrorCode = TEXT("PROCESS_FAILED");
+        /** Parse automation test results from the output; a failed test fails the job. */
+        bool bAutomationTests = false;
+    };
+
+    /**
+     * Progress for a running job: Percent is derived from UBT's "[n/m]" counter
+     * and is negative when it has not changed since the previous call; Message
+     * holds the output lines produced since then. Runs on the game thread.
+     */
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+
+    /**
+     * Final outcome of a job (state, returnCode, diagnostics, output tail,
+     * timings). ErrorCode is empty on success. Runs on the game thread.
+     */
+    using FCompletionSink = TFunction<void(bool bSuccess, const FString& Message,
+                                           const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)>;
+
+    /**
+     * Build the UBT launcher (Build.bat / Build.sh) command line. Platform and
+     * configuration default to the host platform and Development; the current
+     * .uproject is passed unless AdditionalArgs already names one.
+     */
+    bool MakeUbtJobSpec(const FString& Target, const FString& Platform, const FString& Configuration,
+                        const FString& AdditionalArgs, FJobSpec& OutSpec, FString& OutError);
+
+    /**
+     * Build the command line that runs the automation tests matching Filter
+     * (all tests when empty) in a headless UnrealEditor-Cmd on the current
+     * project. Fails when the filter could chain console commands.
+     */
+    bool MakeAutomationTestJobSpec(const FString& Filter, FJobSpec& OutSpec, FString& OutError);
+
+    /** Start the job now if a slot is free, otherwise queue it. Returns the job id. */
+    FString Start(const FJobSpec& Spec, FProgressSink OnProgress, FCompletionSink OnComplete);
+
+    /**
+     * Request cancellation. Queued jobs complete immediately as cancelled;
+     * running jobs terminate their process tree and complete from the worker.
+     * Returns false if the id is unknown or the job already finished.
+     */
+    bool Cancel(const FString& JobId, FString& OutState);
+
+    /**
+     * Job snapshot, or null if the id is unknown. Output lines from SinceLine
+     * (absolute line index) onwards are included, up to MaxLines; the
+     * response's nextLine is the cursor for the following call.
+     */
+    TSharedPtr<FJsonObject> GetJob(const FString& JobId, int32 SinceLine, int32 MaxLines);
+
+    /** Summary of queued, running and recently finished jobs. */
+    TSharedPtr<FJsonObject> ListJobs();
+
+    /** Terminate every running process and drop queued jobs (subsystem shutdown). */
+    void CancelAll();
+
+    /** Parse one output line. Returns false if the line is not a diagnostic. */
+    bool ParseDiagnostic(const FString& Line, FDiagnostic& OutDiagnostic);
+
+    TSharedPtr<FJsonObject> DiagnosticToJson(const FDiagnostic& Diagnostic);
+}
@@ -0,0 +1,444 @@
+// =============================================================================
+// McpCompileScheduler.cpp
+// =============================================================================
+// Implementation of deferred, once-per-Blueprint compilation.
+// =============================================================================
+
+#include "McpCompileScheduler.h"
+#include "McpAutomationBridgeSettings.h"
+#include "McpRequestProfiler.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+
+#if WITH_EDITOR
+#include "Engine/Blueprint.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "RenderingThread.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcpCompileScheduler, Log, All);
+
+namespace McpCompileScheduler
+{
+    namespace
+    {
+        struct FPendingCompile
+        {
+            TWeakObjectPtr<UBlueprint> Blueprint;
+            bool bStructural = false;
+            int32 Requests = 0;
+        };
+
+        struct FState
+        {
+            /** Queued Blueprints keyed by path name. */
+            TMap<FString, FPendingCompile> Pending;
+
+            ERequestKind CurrentKind = ERequestKind::Other;
+            double LastActivitySeconds = 0.0;
+            bool bFlushing = false;
+
+            int64 TotalRequested = 0;
+            int64 TotalDeferred = 0;
+            int64 TotalCompiles = 0;
+            int64 TotalImmediateCompiles = 0;
+            int64 TotalFailed = 0;
+            int64 TotalFlushes = 0;
+            double TotalCompileSeconds = 0.0;
+
+            TSharedPtr<FJsonObject> LastFlush;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        const UMcpAutomationBridgeSettings* GetSettings()
+        {
+            return GetDefault<UMcpAutomationBridgeSettings>();
+        }
+
+        FString NormalizeActionKey(const FString& Action)
+        {
+            FString Key;
+            Key.Reserve(Action.Len());
+            for (const TCHAR C : Action)
+            {
+                if (FChar::IsAlnum(C))
+                {
+                    Key.AppendChar(FChar::ToLower(C));
+                }
+            }
+            return Key;
+        }
+
+        // Keys are normalized action names: flat bridge actions ("blueprint_add_variable")
+        // on their own, tool actions as "<tool>:<action>" ("manage_blueprint" +
+        // "add_component"), so a verb shared with another tool (control_actor
+        // add_component, another tool's compile) stays Other.
+        const TSet<FString>& GetStructuralActions()
+        {
+            static const TSet<FString> Actions = {
+                TEXT("blueprintaddvariable"), TEXT("manageblueprint:addvariable"),
+                TEXT("blueprintremovevariable"), TEXT("manageblueprint:removevariable"),
+                TEXT("blueprintrenamevariable"), TEXT("manageblueprint:renamevariable"),
+                TEXT("blueprintsetvariablemetadata"), TEXT("manageblueprint:setvariablemetadata"),
+                TEXT("blueprintaddfunction"), TEXT("manageblueprint:addfunction"),
+                TEXT("blueprintaddevent"), TEXT("manageblueprint:addevent"),
+                TEXT("blueprintremoveevent"), TEXT("manageblueprint:removeevent"),
+                TEXT("blueprintaddconstructionscript"), TEXT("manageblueprint:addconstructionscript"),
+                TEXT("blueprintmodifyscs"), TEXT("manageblueprint:modifyscs"),
+                TEXT("addscscomponent"), TEXT("manageblueprint:addscscomponent"),
+                TEXT("removescscomponent"), TEXT("manageblueprint:removescscomponent"),
+                TEXT("reparentscscomponent"), TEXT("manageblueprint:reparentscscomponent"),
+                TEXT("manageblueprint:addcomponent"), TEXT("manageblueprint:removecomponent"),
+                TEXT("managenetworking:createrpcfunction")
+            };
+            return Actions;
+        }
+
+        const TSet<FString>& GetValueActions()
+        {
+            static const TSet<FString> Actions = {
+                TEXT("blueprintsetdefault"), TEXT("manageblueprint:setdefault"),
+                TEXT("setscscomponentproperty"), TEXT("manageblueprint:setscsproperty"),
+                TEXT("setscscomponenttransform"), TEXT("manageblueprint:setscstransform"),
+                TEXT("managenetworking:setpropertyreplicated"), TEXT("managenetworking:setreplicationcondition"),
+                TEXT("managenetworking:setreplicatedusing"), TEXT("managenetworking:configurepushmodel"),
+                TEXT("managenetworking:configurenetupdatefrequency"), TEXT("managenetworking:configurenetpriority"),
+                TEXT("managenetworking:setnetdormancy"), TEXT("managenetworking:configurenetculldistance"),
+                TEXT("managenetworking:setalwaysrelevant"), TEXT("managenetworking:setonlyrelevanttoowner"),
+                TEXT("managenetworking:configurerpcvalidation"), TEXT("managenetworking:setrpcreliability"),
+                TEXT("managenetworking:configurereplicatedmovement")
+            };
+            return Actions;
+        }
+
+        const TSet<FString>& GetNeutralActions()
+        {
+            static const TSet<FString> Actions = {
+                TEXT("blueprintcompile"), TEXT("manageblueprint:compile"),
+                TEXT("blueprintflushcompiles"), TEXT("manageblueprint:flushcompiles"),
+                TEXT("blueprintgetcompilequeue"), TEXT("manageblueprint:getcompilequeue"),
+                TEXT("blueprintbenchmarkcompiles"), TEXT("manageblueprint:benchmarkcompiles"),
+                TEXT("manageasset:flushsaves"), TEXT("manageasset:getsavequeue")
+            };
+            return Actions;
+        }
+
+        int32 GetBlueprintDepth(const UBlueprint* Blueprint)
+        {
+            int32 Depth = 0;
+#if WITH_EDITOR
+            for (UClass* Parent = Blueprint->ParentClass; Parent; Parent = Parent->GetSuperClass())
+            {
+                if (Cast<UBlueprint>(Parent->ClassGeneratedBy))
+                {
+                    ++Depth;
+                }
+            }
+#endif
+            return Depth;
+        }
+    }
+
+    ERequestKind ClassifyRequest(const FString& Action, const TSharedPtr<FJsonObject>& Payload)
+    {
+        const FString ToolKey = NormalizeActionKey(Action);
+        TArray<FString, TInlineAllocator<3>> Keys;
+        if (Payload.IsValid())
+        {
+            FString Value;
+            if (Payload->TryGetStringField(TEXT("subAction"), Value) && !Value.IsEmpty())
+            {
+                Keys.Add(ToolKey + TEXT(":") + NormalizeActionKey(Value));
+            }
+            if (Payload->TryGetStringField(TEXT("action"), Value) && !Value.IsEmpty())
+            {
+                Keys.Add(ToolKey + TEXT(":") + NormalizeActionKey(Value));
+            }
+        }
+        Keys.Add(ToolKey);
+
+        for (const FString& Key : Keys)
+        {
+            if (GetStructuralActions().Contains(Key))
+            {
+                return ERequestKind::Structural;
+            }
+            if (GetValueActions().Contains(Key))
+            {
+                return ERequestKind::Value;
+            }
+            if (GetNeutralActions().Contains(Key))
+            {
+                return ERequestKind::Neutral;
+            }
+        }
+        return ERequestKind::Other;
+    }
+
+    bool IsDeferring()
+    {
+        const FState& State = GetState();
+        const UMcpAutomationBridgeSettings* Settings = GetSettings();
+        return IsInGameThread() && !State.bFlushing &&
+               (State.CurrentKind == ERequestKind::Structural || State.CurrentKind == ERequestKind::Value) &&
+               Settings && Settings->bBatchBlueprintCompiles;
+    }
+
+    void MarkDirty(UBlueprint* Blueprint)
+    {
+        if (!Blueprint)
+        {
+            return;
+        }
+        check(IsInGameThread());
+
+        FState& State = GetState();
+        ++State.TotalRequested;
+        ++State.TotalDeferred;
+
+        FPendingCompile& Entry = State.Pending.FindOrAdd(Blueprint->GetPathName());
+        Entry.Blueprint = Blueprint;
+        Entry.bStructural |= State.CurrentKind == ERequestKind::Structural;
+        ++Entry.Requests;
+    }
+
+    bool CompileNow(UBlueprint* Blueprint)
+    {
+        if (!Blueprint)
+        {
+            return false;
+        }
+
+        FState& State = GetState();
+        if (!State.bFlushing)
+        {
+            // Direct compile outside a flush: counts as its own request
+            State.Pending.Remove(Blueprint->GetPathName());
+            ++State.TotalRequested;
+            ++State.TotalImmediateCompiles;
+        }
+
+#if WITH_EDITOR
+        McpRequestProfiler::FPhaseScope CompilePhase(McpRequestProfiler::EPhase::Compile);
+        const double Start = FPlatformTime::Seconds();
+
+        // Compiling can trigger Slate UI updates (progress bars, compiler
+        // logs); flush around it so they cannot race the render thread.
+        FlushRenderingCommands();
+        // Note: FKismetEditorUtilities::CompileBlueprint returns void in UE 5.7+
+        FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::SkipGarbageCollection);
+        FlushRenderingCommands();
+
+        ++State.TotalCompiles;
+        State.TotalCompileSeconds += FPlatformTime::Seconds() - Start;
+
+        const bool bSuccess = Blueprint->Status == EBlueprintStatus::BS_UpToDate ||
+                              Blueprint->Status == EBlueprintStatus::BS_UpToDateWithWarnings;
+        if (!bSuccess)
+        {
+            ++State.TotalFailed;
+        }
+        return bSuccess;
+#else
+        return true;
+#endif
+    }
+
+    FFlushResult Flush(const FString& Reason, bool bStructuralOnly)
+    {
+        FFlushResult Result;
+        Result.Reason = Reason;
+
+        FState& State = GetState();
+        if (State.bFlushing || State.Pending.Num() == 0)
+        {
+            return Result;
+        }
+        check(IsInGameThread());
+
+        TGuardValue<bool> FlushGuard(State.bFlushing, true);
+        McpRequestProfiler::FPhaseScope CompilePhase(McpRequestProfiler::EPhase::Compile);
+
+        TArray<UBlueprint*> ToCompile;
+        for (auto It = State.Pending.CreateIterator(); It; ++It)
+        {
+            if (bStructuralOnly && !It.Value().bStructural)
+            {
+                continue;
+            }
+            UBlueprint* Blueprint = It.Value().Blueprint.Get();
+            if (IsValid(Blueprint))
+            {
+                ToCompile.Add(Blueprint);
+            }
+            else
+            {
+                ++Result.Skipped;
+            }
+            It.RemoveCurrent();
+        }
+
+        // Parents first, so a child compile sees its parent's final layout
+        ToCompile.StableSort([](const UBlueprint& A, const UBlueprint& B)
+        {
+            return GetBlueprintDepth(&A) < GetBlueprintDepth(&B);
+        });
+
+        const double Start = FPlatformTime::Seconds();
+        for (UBlueprint* Blueprint : ToCompile)
+        {
+            if (!CompileNow(Blueprint))
+            {
+                Result.FailedBlueprints.Add(Blueprint->GetPathName());
+            }
+            ++Result.Compiled;
+        }
+        Result.CompileSeconds = FPlatformTime::Seconds() - Start;
+
+        ++State.TotalFlushes;
+        State.LastFlush = FlushResultToJson(Result);
+
+        if (Result.FailedBlueprints.Num() > 0)
+        {
+            UE_LOG(LogMcpCompileScheduler, Warning,
+                TEXT("Compile flush (%s): %d of %d Blueprints have errors: %s"),
+                *Reason, Result.FailedBlueprints.Num(), Result.Compiled,
+                *FString::Join(Result.FailedBlueprints, TEXT(", ")));
+        }
+        UE_LOG(LogMcpCompileScheduler, Verbose,
+            TEXT("Compile flush (%s): compiled=%d skipped=%d %.1fms"),
+            *Reason, Result.Compiled, Result.Skipped, Result.CompileSeconds * 1000.0);
+
+        return Result;
+    }
+
+    int32 NumPending()
+    {
+        return GetState().Pending.Num();
+    }
+
+    void Tick(bool bRequestInFlight)
+    {
+        FState& State = GetState();
+        if (State.Pending.Num() == 0 || State.bFlushing || bRequestInFlight)
+        {
+            return;
+        }
+        if (GIsSavingPackage || IsGarbageCollecting() || IsAsyncLoading())
+        {
+            return;
+        }
+
+        const UMcpAutomationBridgeSettings* Settings = GetSettings();
+        const float IdleSeconds = Settings ? Settings->CompileFlushIdleSeconds : 0.0f;
+        if (FPlatformTime::Seconds() - State.LastActivitySeconds >= IdleSeconds)
+        {
+            Flush(TEXT("idle"));
+        }
+    }
+
+    TSharedPtr<FJsonObject> GetStatus(bool bIncludeBlueprints)
+    {
+        const FState& State = GetState();
+        const UMcpAutomationBridgeSettings* Settings = GetSettings();
+
+        TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+        Status->SetBoolField(TEXT("batching"), Settings && Settings->bBatchBlueprintCompiles);
+        Status->SetNumberField(TEXT("idleFlushSeconds"), Settings ? Settings->CompileFlushIdleSeconds : 0.0);
+        Status->SetNumberField(TEXT("pending"), State.Pending.Num());
+
+        if (bIncludeBlueprints)
+        {
+            TArray<TSharedPtr<FJsonValue>> Blueprints;
+            for (const TPair<FString, FPendingCompile>& Entry : State.Pending)
+            {
+                TSharedPtr<FJsonObject> Item = MakeShared<FJsonObject>();
+                Item->SetStringField(TEXT("blueprint"), Entry.Key);
+                Item->SetBoolField(TEXT("structural"), Entry.Value.bStructural);
+                Item->SetNumberField(TEXT("deferredCompiles"), Entry.Value.Requests);
+                Blueprints.Add(MakeShared<FJsonValueObject>(Item));
+            }
+            Status->SetArrayField(TEXT("pendingBlueprints"), Blueprints);
+        }
+
+        // compilesAvoided: compile requests that did not turn into a compile
+        // (still-queued requests are not counted yet)
+        int64 QueuedRequests = 0;
+        for (const TPair<FString, FPendingCompile>& Entry : State.Pending)
+        {
+            QueuedRequests += Entry.Value.Requests;
+        }
+        TSharedPtr<FJsonObject> Totals = MakeShared<FJsonObject>();
+        Totals->SetNumberField(TEXT("compileRequests"), static_cast<double>(State.TotalRequested));
+        Totals->SetNumberField(TEXT("deferred"), static_cast<double>(State.TotalDeferred));
+        Totals->SetNumberField(TEXT("compiles"), static_cast<double>(State.TotalCompiles));
+        Totals->SetNumberField(TEXT("immediateCompiles"), static_cast<double>(State.TotalImmediateCompiles));
+        Totals->SetNumberField(TEXT("compilesAvoided"),
+            static_cast<double>(FMath::Max<int64>(0, State.TotalRequested - State.TotalCompiles - QueuedRequests)));
+        Totals->SetNumberField(TEXT("failed"), static_cast<double>(State.TotalFailed));
+        Totals->SetNumberField(TEXT("flushes"), static_cast<double>(State.TotalFlushes));
+        Totals->SetNumberField(TEXT("compileMs"), State.TotalCompileSeconds * 1000.0);
+        Status->SetObjectField(TEXT("totals"), Totals);
+
+        if (State.LastFlush.IsValid())
+        {
+            Status->SetObjectField(TEXT("lastFlush"), State.LastFlush);
+        }
+        return Status;
+    }
+
+    TSharedPtr<FJsonObject> FlushResultToJson(const FFlushResult& Result)
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetStringField(TEXT("reason"), Result.Reason);
+        Json->SetNumberField(TEXT("compiled"), Result.Compiled);
+        Json->SetNumberField(TEXT("skipped"), Result.Skipped);
+        Json->SetNumberField(TEXT("compileMs"), Result.CompileSeconds * 1000.0);
+
+        TArray<TSharedPtr<FJsonValue>> Failed;
+        for (const FString& Path : Result.FailedBlueprints)
+        {
+            Failed.Add(MakeShared<FJsonValueString>(Path));
+        }
+        Json->SetArrayField(TEXT("failedBlueprints"), Failed);
+        return Json;
+    }
+
+    FScopedRequest::FScopedRequest(ERequestKind Kind)
+    {
+        FState& State = GetState();
+        PreviousKind = State.CurrentKind;
+        State.LastActivitySeconds = FPlatformTime::Seconds();
+
+        switch (Kind)
+        {
+        case ERequestKind::Value:
+            // The edit reads the generated class; make its layout current
+            Flush(TEXT("dependent_read"), /*bStructuralOnly=*/true);
+            break;
+        case ERequestKind::Other:
+            Flush(TEXT("dependent_read"));
+            break;
+        default:
+            break;
+        }
+
+        State.CurrentKind = Kind;
+    }
+
+    FScopedRequest::~FScopedRequest()
+    {
+        FState& State = GetState();
+        State.CurrentKind = PreviousKind;
+        State.LastActivitySeconds = FPlatformTime::Seconds();
+    }
+}
@@ -0,0 +1,107 @@
+// =============================================================================
+// McpCompileScheduler.h
+// =============================================================================
+// Batches Blueprint compilation across automation requests.
+//
+// Edit handlers call McpSafeCompileBlueprint after almost every mutation, so a
+// script that adds 30 variables and components to one Blueprint used to
+// compile it 30 times. Each request is now classified before dispatch:
+//
+//   Structural  - edits Blueprint data only (add/remove/rename variable, add
+//                 function/event, SCS add/remove/reparent, create RPC).
+//                 Compiles requested while it runs are deferred; the Blueprint
+//                 is marked structurally dirty.
+//   Value       - reads the generated class or CDO to apply its edit (set
+//                 default, replication flags, SCS component properties).
+//                 Structurally dirty Blueprints are compiled first so the class
+//                 is current; the request's own compile is then deferred.
+//   Neutral     - compile/save queue control; no flush, no deferral.
+//   Other       - everything else. All dirty Blueprints are compiled before
+//                 dispatch, and compiles inside the request run immediately.
+//
+// Deferred compiles are flushed once per Blueprint when the bridge goes idle,
+// when a deferred-request queue drains, before asset saves are flushed, on
+// manage_blueprint flush_compiles, and on shutdown. Parents compile before
+// children.
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UBlueprint;
+
+namespace McpCompileScheduler
+{
+    enum class ERequestKind : uint8
+    {
+        Other,
+        Structural,
+        Value,
+        Neutral
+    };
+
+    struct FFlushResult
+    {
+        FString Reason;
+
+        /** Blueprints compiled by this flush. */
+        int32 Compiled = 0;
+
+        /** Blueprints left in BS_Error after compiling. */
+        TArray<FString> FailedBlueprints;
+
+        /** Queued Blueprints that were deleted before the flush. */
+        int32 Skipped = 0;
+
+        double CompileSeconds = 0.0;
+    };
+
+    /** Classify a request by its tool (Action) plus payload action / subAction, or by a flat bridge action. */
+    ERequestKind ClassifyRequest(const FString& Action, const TSharedPtr<FJsonObject>& Payload);
+
+    /** True when McpSafeCompileBlueprint should mark the Blueprint dirty instead of compiling. */
+    bool IsDeferring();
+
+    /** Queue a Blueprint for the next flush. */
+    void MarkDirty(UBlueprint* Blueprint);
+
+    /** Compile one Blueprint now and drop it from the queue. */
+    bool CompileNow(UBlueprint* Blueprint);
+
+    /** Compile every queued Blueprint (or only structurally dirty ones) once. */
+    FFlushResult Flush(const FString& Reason, bool bStructuralOnly = false);
+
+    int32 NumPending();
+
+    /** Flush once the bridge has been idle long enough. Called from the subsystem ticker. */
+    void Tick(bool bRequestInFlight);
+
+    /** Queue contents, settings and lifetime compile telemetry. */
+    TSharedPtr<FJsonObject> GetStatus(bool bIncludeBlueprints);
+
+    TSharedPtr<FJsonObject> FlushResultToJson(const FFlushResult& Result);
+
+    /**
+     * Applies the request's compile policy for the lifetime of the scope:
+     * flushes what the request depends on, then enables deferral for
+     * Structural and Value requests.
+     */
+    struct FScopedRequest
+    {
+        explicit FScopedRequest(ERequestKind Kind);
+        ~FScopedRequest();
+
+        FScopedRequest(const FScopedRequest&) = delete;
+        FScopedRequest& operator=(const FScopedRequest&) = delete;
+
+    private:
+        ERequestKind PreviousKind;
+    };
+}
@@ -6,6 +6,7 @@
 #include "McpAutomationBridgeSettings.h"
 #include "McpAutomationBridgeSubsystem.h"
 #include "McpBridgeWebSocket.h"
+#include "McpRequestProfiler.h"
 #include "Misc/Guid.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
@@ -532,7 +533,10 @@ void FMcpConnectionManager::HandleMessage(
 
   TSharedPtr<FJsonObject> RootObj;
   TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
-  if (!FJsonSerializer::Deserialize(Reader, RootObj) || !RootObj.IsValid()) {
+  const double ParseStartSeconds = FPlatformTime::Seconds();
+  const bool bParsed = FJsonSerializer::Deserialize(Reader, RootObj);
+  const double ParseSeconds = FPlatformTime::Seconds() - ParseStartSeconds;
+  if (!bParsed || !RootObj.IsValid()) {
     UE_LOG(LogMcpAutomationBridgeSubsystem, Warning,
            TEXT("Failed to parse incoming automation message JSON: %s"),
            *SanitizeForLogConnMgr(Message));
@@ -649,6 +653,8 @@ void FMcpConnectionManager::HandleMessage(
       PendingRequestsToSockets.Add(RequestId, Socket);
     }
 
+    McpRequestProfiler::BeginRequest(RequestId, Action, ParseSeconds);
+
     // Dispatch to subsystem via callback
     if (OnMessageReceived.IsBound()) {
       OnMessageReceived.Execute(RequestId, Action, Payload, Socket);
@@ -814,9 +820,13 @@ void FMcpConnectionManager::SendAutomationResponse(
     Response->SetObjectField(TEXT("result"), Result.ToSharedRef());
 
   FString Serialized;
-  const TSharedRef<TJsonWriter<>> Writer =
-      TJsonWriterFactory<>::Create(&Serialized);
-  FJsonSerializer::Serialize(Response, Writer);
+  {
+    McpRequestProfiler::FPhaseScope SerializePhase(
+        McpRequestProfiler::EPhase::Serialize, RequestId);
+    const TSharedRef<TJsonWriter<>> Writer =
+        TJsonWriterFactory<>::Create(&Serialized);
+    FJsonSerializer::Serialize(Response, Writer);
+  }
 
   // Get action from telemetry for better logging context
   FString ActionName = TEXT("unknown");
@@ -861,6 +871,8 @@ void FMcpConnectionManager::SendAutomationResponse(
 
   RecordAutomationTelemetry(RequestId, bSuccess, Message, ErrorCode);
 
+  McpRequestProfiler::FPhaseScope SendPhase(
+      McpRequestProfiler::EPhase::Send, RequestId);
   bool bSent = false;
   TArray<FString> AttemptDetails;
   const int MaxAttempts = 3;
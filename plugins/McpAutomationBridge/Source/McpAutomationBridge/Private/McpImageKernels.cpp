@@ -0,0 +1,561 @@
+// =============================================================================
+// McpImageKernels.cpp
+// =============================================================================
+// Implementation of the shared BGRA8 image kernels used by the texture handlers.
+// =============================================================================
+
+#include "McpImageKernels.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace McpImageKernels
+{
+    namespace
+    {
+        // Pixels per work item for flat (non-spatial) kernels.
+        constexpr int64 PIXEL_CHUNK = 64 * 1024;
+
+        // Largest blur radius; keeps horizontal sums inside uint16.
+        constexpr int32 MAX_BLUR_RADIUS = 64;
+
+        int32 GetNumTiles(int64 NumItems, int64 MinItemsPerTile)
+        {
+            const int32 Workers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+            const int64 ByWorkers = static_cast<int64>(Workers) * 4;
+            const int64 BySize = FMath::Max<int64>(1, NumItems / FMath::Max<int64>(1, MinItemsPerTile));
+            return static_cast<int32>(FMath::Clamp<int64>(FMath::Min(ByWorkers, BySize), 1, NumItems));
+        }
+
+        void ParallelForPixels(int64 NumPixels, TFunctionRef<void(int64 Begin, int64 End)> Body)
+        {
+            if (NumPixels <= 0)
+            {
+                return;
+            }
+            const int32 NumChunks = static_cast<int32>((NumPixels + PIXEL_CHUNK - 1) / PIXEL_CHUNK);
+            ParallelFor(NumChunks, [&](int32 ChunkIndex)
+            {
+                const int64 Begin = static_cast<int64>(ChunkIndex) * PIXEL_CHUNK;
+                Body(Begin, FMath::Min(Begin + PIXEL_CHUNK, NumPixels));
+            }, NumChunks == 1);
+        }
+
+        // Horizontal box sums of one BGRA row into an interleaved BGR uint16 row.
+        void HorizontalBoxSums(const uint8* Row, int32 Width, int32 Radius, uint16* OutSums)
+        {
+            const int32 LastX = Width - 1;
+            for (int32 C = 0; C < 3; ++C)
+            {
+                int32 Sum = 0;
+                for (int32 K = -Radius; K <= Radius; ++K)
+                {
+                    Sum += Row[FMath::Clamp(K, 0, LastX) * 4 + C];
+                }
+                for (int32 X = 0; X < Width; ++X)
+                {
+                    OutSums[X * 3 + C] = static_cast<uint16>(Sum);
+                    Sum += Row[FMath::Min(X + Radius + 1, LastX) * 4 + C];
+                    Sum -= Row[FMath::Max(X - Radius, 0) * 4 + C];
+                }
+            }
+        }
+
+        float EvaluateBlend(EBlendMode Mode, float Base, float Overlay)
+        {
+            switch (Mode)
+            {
+            case EBlendMode::Multiply: return Base * Overlay;
+            case EBlendMode::Screen:   return 1.0f - (1.0f - Base) * (1.0f - Overlay);
+            case EBlendMode::Overlay:  return Base < 0.5f ? 2.0f * Base * Overlay : 1.0f - 2.0f * (1.0f - Base) * (1.0f - Overlay);
+            case EBlendMode::Add:      return FMath::Min(Base + Overlay, 1.0f);
+            default:                   return Overlay;
+            }
+        }
+    }
+
+    EBlendMode ParseBlendMode(const FString& Name)
+    {
+        if (Name.Equals(TEXT("Multiply"), ESearchCase::IgnoreCase)) return EBlendMode::Multiply;
+        if (Name.Equals(TEXT("Screen"), ESearchCase::IgnoreCase))   return EBlendMode::Screen;
+        if (Name.Equals(TEXT("Overlay"), ESearchCase::IgnoreCase))  return EBlendMode::Overlay;
+        if (Name.Equals(TEXT("Add"), ESearchCase::IgnoreCase))      return EBlendMode::Add;
+        return EBlendMode::Normal;
+    }
+
+    void ParallelForRows(int32 Height, TFunctionRef<void(int32 RowBegin, int32 RowEnd)> Body)
+    {
+        if (Height <= 0)
+        {
+            return;
+        }
+        const int32 NumTiles = GetNumTiles(Height, 8);
+        const int32 RowsPerTile = (Height + NumTiles - 1) / NumTiles;
+        ParallelFor(NumTiles, [&](int32 TileIndex)
+        {
+            const int32 Begin = TileIndex * RowsPerTile;
+            const int32 End = FMath::Min(Begin + RowsPerTile, Height);
+            if (Begin < End)
+            {
+                Body(Begin, End);
+            }
+        }, NumTiles == 1);
+    }
+
+    void BoxBlur(uint8* Data, int32 Width, int32 Height, int32 Radius)
+    {
+        if (!Data || Width <= 0 || Height <= 0)
+        {
+            return;
+        }
+        Radius = FMath::Clamp(Radius, 1, MAX_BLUR_RADIUS);
+
+        TArray<uint8> Original;
+        Original.SetNumUninitialized(static_cast<int64>(Width) * Height * 4);
+        FMemory::Memcpy(Original.GetData(), Data, Original.Num());
+        const uint8* Src = Original.GetData();
+
+        const int32 KernelSize = Radius * 2 + 1;
+        const uint32 KernelArea = static_cast<uint32>(KernelSize * KernelSize);
+        const int32 LastY = Height - 1;
+        const int64 RowBytes = static_cast<int64>(Width) * 4;
+
+        // Each tile keeps a running vertical sum of horizontal sums, so every
+        // output pixel costs a constant number of adds regardless of radius.
+        ParallelForRows(Height, [&](int32 RowBegin, int32 RowEnd)
+        {
+            TArray<uint32> ColumnSums;
+            ColumnSums.SetNumZeroed(Width * 3);
+            TArray<uint16> RowSums;
+            RowSums.SetNumUninitialized(Width * 3);
+            uint32* Col = ColumnSums.GetData();
+            uint16* Hor = RowSums.GetData();
+
+            for (int32 K = RowBegin - Radius; K <= RowBegin + Radius; ++K)
+            {
+                HorizontalBoxSums(Src + FMath::Clamp(K, 0, LastY) * RowBytes, Width, Radius, Hor);
+                for (int32 I = 0; I < Width * 3; ++I)
+                {
+                    Col[I] += Hor[I];
+                }
+            }
+
+            for (int32 Y = RowBegin; Y < RowEnd; ++Y)
+            {
+                uint8* Dst = Data + Y * RowBytes;
+                for (int32 X = 0; X < Width; ++X)
+                {
+                    Dst[X * 4 + 0] = static_cast<uint8>(Col[X * 3 + 0] / KernelArea);
+                    Dst[X * 4 + 1] = static_cast<uint8>(Col[X * 3 + 1] / KernelArea);
+                    Dst[X * 4 + 2] = static_cast<uint8>(Col[X * 3 + 2] / KernelArea);
+                }
+
+                if (Y + 1 < RowEnd)
+                {
+                    HorizontalBoxSums(Src + FMath::Min(Y + Radius + 1, LastY) * RowBytes, Width, Radius, Hor);
+                    for (int32 I = 0; I < Width * 3; ++I)
+                    {
+                        Col[I] += Hor[I];
+                    }
+                    HorizontalBoxSums(Src + FMath::Max(Y - Radius, 0) * RowBytes, Width, Radius, Hor);
+                    for (int32 I = 0; I < Width * 3; ++I)
+                    {
+                        Col[I] -= Hor[I];
+                    }
+                }
+            }
+        });
+    }
+
+    void Sharpen(uint8* Data, int32 Width, int32 Height, float Amount)
+    {
+        if (!Data || Width < 3 || Height < 3)
+        {
+            return;
+        }
+
+        TArray<uint8> Original;
+        Original.SetNumUninitialized(static_cast<int64>(Width) * Height * 4);
+        FMemory::Memcpy(Original.GetData(), Data, Original.Num());
+        const uint8* Src = Original.GetData();
+
+        const float CenterWeight = 1.0f + 4.0f * Amount;
+        const int64 RowBytes = static_cast<int64>(Width) * 4;
+
+        // Interior rows only; the one-pixel border keeps its original value.
+        ParallelForRows(Height - 2, [&](int32 RowBegin, int32 RowEnd)
+        {
+            for (int32 Y = RowBegin + 1; Y < RowEnd + 1; ++Y)
+            {
+                const uint8* Up = Src + (Y - 1) * RowBytes;
+                const uint8* Mid = Src + Y * RowBytes;
+                const uint8* Down = Src + (Y + 1) * RowBytes;
+                uint8* Dst = Data + Y * RowBytes;
+                for (int32 I = 4; I < (Width - 1) * 4; ++I)
+                {
+                    if ((I & 3) == 3)
+                    {
+                        continue;
+                    }
+                    const float Neighbours = static_cast<float>(Mid[I - 4] + Mid[I + 4] + Up[I] + Down[I]);
+                    const float Sharpened = Mid[I] * CenterWeight - Amount * Neighbours;
+                    Dst[I] = static_cast<uint8>(FMath::Clamp(Sharpened, 0.0f, 255.0f));
+                }
+            }
+        });
+    }
+
+    void BuildIdentityLUT(uint8 OutLUT[256])
+    {
+        for (int32 I = 0; I < 256; ++I)
+        {
+            OutLUT[I] = static_cast<uint8>(I);
+        }
+    }
+
+    void BuildLevelsLUT(float InBlack, float InWhite, float Gamma, float OutBlack, float OutWhite, uint8 OutLUT[256])
+    {
+        const float InRange = FMath::Max(InWhite - InBlack, 0.001f);
+        const float OutRange = OutWhite - OutBlack;
+        const float InvGamma = 1.0f / FMath::Max(Gamma, 0.01f);
+        for (int32 I = 0; I < 256; ++I)
+        {
+            float Val = I / 255.0f;
+            Val = FMath::Clamp((Val - InBlack) / InRange, 0.0f, 1.0f);
+            Val = FMath::Pow(Val, InvGamma);
+            Val = OutBlack + Val * OutRange;
+            OutLUT[I] = static_cast<uint8>(FMath::Clamp(Val * 255.0f, 0.0f, 255.0f));
+        }
+    }
+
+    void BuildCurveLUT(const TArray<float>& Input, const TArray<float>& Output, uint8 OutLUT[256])
+    {
+        if (Input.Num() < 2 || Output.Num() < 2 || Input.Num() != Output.Num())
+        {
+            BuildIdentityLUT(OutLUT);
+            return;
+        }
+
+        for (int32 I = 0; I < 256; ++I)
+        {
+            const float NormalizedInput = static_cast<float>(I) / 255.0f;
+            float Mapped = NormalizedInput;
+
+            if (NormalizedInput < Input[0])
+            {
+                Mapped = Output[0];
+            }
+            else if (NormalizedInput > Input.Last())
+            {
+                Mapped = Output.Last();
+            }
+            else
+            {
+                for (int32 J = 0; J < Input.Num() - 1; ++J)
+                {
+                    if (NormalizedInput >= Input[J] && NormalizedInput <= Input[J + 1])
+                    {
+                        const float SegmentRange = Input[J + 1] - Input[J];
+                        Mapped = SegmentRange > SMALL_NUMBER
+                            ? FMath::Lerp(Output[J], Output[J + 1], (NormalizedInput - Input[J]) / SegmentRange)
+                            : Output[J];
+                        break;
+                    }
+                }
+            }
+
+            OutLUT[I] = static_cast<uint8>(FMath::Clamp(Mapped * 255.0f, 0.0f, 255.0f));
+        }
+    }
+
+    void ApplyLUT(uint8* Data, int64 NumPixels, const uint8* LutB, const uint8* LutG, const uint8* LutR, const uint8* LutA)
+    {
+        if (!Data)
+        {
+            return;
+        }
+
+        // Substitute identity tables so the inner loop has no per-channel branches.
+        uint8 Identity[256];
+        BuildIdentityLUT(Identity);
+        const uint8* B = LutB ? LutB : Identity;
+        const uint8* G = LutG ? LutG : Identity;
+        const uint8* R = LutR ? LutR : Identity;
+        const uint8* A = LutA ? LutA : Identity;
+
+        ParallelForPixels(NumPixels, [&](int64 Begin, int64 End)
+        {
+            uint8* P = Data + Begin * 4;
+            for (int64 I = Begin; I < End; ++I, P += 4)
+            {
+                P[0] = B[P[0]];
+                P[1] = G[P[1]];
+                P[2] = R[P[2]];
+                P[3] = A[P[3]];
+            }
+        });
+    }
+
+    void Desaturate(uint8* Data, int64 NumPixels, float Amount)
+    {
+        if (!Data)
+        {
+            return;
+        }
+
+        // Rec.709 weights in 16.16 fixed point (sum to 65536) and an 8-bit lerp factor.
+        const uint32 Mix = static_cast<uint32>(FMath::RoundToInt(FMath::Clamp(Amount, 0.0f, 1.0f) * 256.0f));
+        const uint32 Keep = 256 - Mix;
+
+        ParallelForPixels(NumPixels, [&](int64 Begin, int64 End)
+        {
+            uint8* P = Data + Begin * 4;
+            for (int64 I = Begin; I < End; ++I, P += 4)
+            {
+                const uint32 B = P[0];
+                const uint32 G = P[1];
+                const uint32 R = P[2];
+                const uint32 Gray = (13933u * R + 46871u * G + 4732u * B) >> 16;
+                P[0] = static_cast<uint8>((B * Keep + Gray * Mix) >> 8);
+                P[1] = static_cast<uint8>((G * Keep + Gray * Mix) >> 8);
+                P[2] = static_cast<uint8>((R * Keep + Gray * Mix) >> 8);
+            }
+        });
+    }
+
+    void Blend(const uint8* Base, const uint8* Overlay, uint8* Out, int64 NumPixels, EBlendMode Mode, float Opacity)
+    {
+        if (!Base || !Overlay || !Out)
+        {
+            return;
+        }
+
+        // Every mode is a pure function of (base, overlay) bytes, so precompute
+        // the full 256x256 table once; the pixel loop is then three lookups.
+        Opacity = FMath::Clamp(Opacity, 0.0f, 1.0f);
+        TArray<uint8> Table;
+        Table.SetNumUninitialized(256 * 256);
+        for (int32 B = 0; B < 256; ++B)
+        {
+            const float BaseValue = B / 255.0f;
+            for (int32 O = 0; O < 256; ++O)
+            {
+                const float Result = FMath::Lerp(BaseValue, EvaluateBlend(Mode, BaseValue, O / 255.0f), Opacity);
+                Table[(B << 8) | O] = static_cast<uint8>(FMath::Clamp(Result * 255.0f, 0.0f, 255.0f));
+            }
+        }
+        const uint8* T = Table.GetData();
+
+        ParallelForPixels(NumPixels, [&](int64 Begin, int64 End)
+        {
+            const uint8* BP = Base + Begin * 4;
+            const uint8* OP = Overlay + Begin * 4;
+            uint8* DP = Out + Begin * 4;
+            for (int64 I = Begin; I < End; ++I, BP += 4, OP += 4, DP += 4)
+            {
+                const uint8 Alpha = BP[3];
+                DP[0] = T[(BP[0] << 8) | OP[0]];
+                DP[1] = T[(BP[1] << 8) | OP[1]];
+                DP[2] = T[(BP[2] << 8) | OP[2]];
+                DP[3] = Alpha;
+            }
+        });
+    }
+
+    void ResizeBilinear(const uint8* Src, int32 SrcWidth, int32 SrcHeight, uint8* Dst, int32 DstWidth, int32 DstHeight)
+    {
+        if (!Src || !Dst || SrcWidth <= 0 || SrcHeight <= 0 || DstWidth <= 0 || DstHeight <= 0)
+        {
+            return;
+        }
+
+        const float ScaleX = DstWidth > 1 ? static_cast<float>(SrcWidth - 1) / static_cast<float>(DstWidth - 1) : 0.0f;
+        const float ScaleY = DstHeight > 1 ? static_cast<float>(SrcHeight - 1) / static_cast<float>(DstHeight - 1) : 0.0f;
+
+        // Column taps are shared by every row.
+        TArray<int32> X0, X1;
+        TArray<float> FracX;
+        X0.SetNumUninitialized(DstWidth);
+        X1.SetNumUninitialized(DstWidth);
+        FracX.SetNumUninitialized(DstWidth);
+        for (int32 X = 0; X < DstWidth; ++X)
+        {
+            const float U = X * ScaleX;
+            const int32 Left = FMath::Min(FMath::FloorToInt(U), SrcWidth - 1);
+            X0[X] = Left * 4;
+            X1[X] = FMath::Min(Left + 1, SrcWidth - 1) * 4;
+            FracX[X] = U - Left;
+        }
+
+        const int64 SrcRowBytes = static_cast<int64>(SrcWidth) * 4;
+        const int64 DstRowBytes = static_cast<int64>(DstWidth) * 4;
+
+        ParallelForRows(DstHeight, [&](int32 RowBegin, int32 RowEnd)
+        {
+            for (int32 Y = RowBegin; Y < RowEnd; ++Y)
+            {
+                const float V = Y * ScaleY;
+                const int32 Top = FMath::Min(FMath::FloorToInt(V), SrcHeight - 1);
+                const float FracY = V - Top;
+                const uint8* Row0 = Src + Top * SrcRowBytes;
+                const uint8* Row1 = Src + FMath::Min(Top + 1, SrcHeight - 1) * SrcRowBytes;
+                uint8* Out = Dst + Y * DstRowBytes;
+
+                for (int32 X = 0; X < DstWidth; ++X)
+                {
+                    const uint8* P00 = Row0 + X0[X];
+                    const uint8* P10 = Row0 + X1[X];
+                    const uint8* P01 = Row1 + X0[X];
+                    const uint8* P11 = Row1 + X1[X];
+                    const float FX = FracX[X];
+                    for (int32 C = 0; C < 4; ++C)
+                    {
+                        const float Upper = P00[C] + (P10[C] - P00[C]) * FX;
+                        const float Lower = P01[C] + (P11[C] - P01[C]) * FX;
+                        Out[X * 4 + C] = static_cast<uint8>(Upper + (Lower - Upper) * FracY);
+                    }
+                }
+            }
+        });
+    }
+
+    void ExtractChannel(const uint8* Src, int64 NumPixels, int32 ChannelIndex, uint8* OutPlane)
+    {
+        if (!Src || !OutPlane || ChannelIndex < 0 || ChannelIndex > 3)
+        {
+            return;
+        }
+        ParallelForPixels(NumPixels, [&](int64 Begin, int64 End)
+        {
+            const uint8* P = Src + Begin * 4 + ChannelIndex;
+            for (int64 I = Begin; I < End; ++I, P += 4)
+            {
+                OutPlane[I] = *P;
+            }
+        });
+    }
+
+    void InterleaveChannels(const uint8* PlaneB, const uint8* PlaneG, const uint8* PlaneR, const uint8* PlaneA,
+                            int64 NumPixels, uint8* OutBGRA, uint8 DefaultColor, uint8 DefaultAlpha)
+    {
+        if (!OutBGRA)
+        {
+            return;
+        }
+        const uint8* Planes[4] = { PlaneB, PlaneG, PlaneR, PlaneA };
+        const uint8 Defaults[4] = { DefaultColor, DefaultColor, DefaultColor, DefaultAlpha };
+
+        ParallelForPixels(NumPixels, [&](int64 Begin, int64 End)
+        {
+            // One channel at a time keeps each inner loop a simple strided copy or fill.
+            for (int32 C = 0; C < 4; ++C)
+            {
+                uint8* P = OutBGRA + Begin * 4 + C;
+                if (const uint8* Plane = Planes[C])
+                {
+                    for (int64 I = Begin; I < End; ++I, P += 4)
+                    {
+                        *P = Plane[I];
+                    }
+                }
+                else
+                {
+                    const uint8 Value = Defaults[C];
+                    for (int64 I = Begin; I < End; ++I, P += 4)
+                    {
+                        *P = Value;
+                    }
+                }
+            }
+        });
+    }
+
+    TSharedPtr<FJsonObject> RunBenchmark(const TArray<int32>& Sizes, int32 Iterations)
+    {
+        TSharedPtr<FJsonObject> Report = MakeShared<FJsonObject>();
+        Iterations = FMath::Clamp(Iterations, 1, 20);
+
+        TArray<TSharedPtr<FJsonValue>> Results;
+        TArray<TSharedPtr<FJsonValue>> SizeValues;
+
+        for (int32 RequestedSize : Sizes)
+        {
+            const int32 Size = FMath::Clamp(RequestedSize, 64, 8192);
+            const int64 NumPixels = static_cast<int64>(Size) * Size;
+            const double Megapixels = NumPixels / 1.0e6;
+            SizeValues.Add(MakeShared<FJsonValueNumber>(Size));
+
+            TArray<uint8> Image;
+            TArray<uint8> Pristine;
+            TArray<uint8> Scratch;
+            Pristine.SetNumUninitialized(NumPixels * 4);
+            FRandomStream Random(Size);
+            uint32* Words = reinterpret_cast<uint32*>(Pristine.GetData());
+            for (int64 I = 0; I < NumPixels; ++I)
+            {
+                Words[I] = Random.GetUnsignedInt();
+            }
+            Image = Pristine;
+
+            uint8 LevelsLUT[256];
+            uint8 CurveLUT[256];
+            uint8 InvertLUT[256];
+            BuildLevelsLUT(0.1f, 0.9f, 1.2f, 0.0f, 1.0f, LevelsLUT);
+            BuildCurveLUT({ 0.0f, 0.25f, 0.75f, 1.0f }, { 0.0f, 0.2f, 0.8f, 1.0f }, CurveLUT);
+            for (int32 I = 0; I < 256; ++I)
+            {
+                InvertLUT[I] = static_cast<uint8>(255 - I);
+            }
+
+            auto Measure = [&](const TCHAR* Kernel, TFunctionRef<void()> Body)
+            {
+                double Best = TNumericLimits<double>::Max();
+                double Total = 0.0;
+                for (int32 Iter = 0; Iter < Iterations; ++Iter)
+                {
+                    FMemory::Memcpy(Image.GetData(), Pristine.GetData(), Pristine.Num());
+                    const double Start = FPlatformTime::Seconds();
+                    Body();
+                    const double Elapsed = FPlatformTime::Seconds() - Start;
+                    Best = FMath::Min(Best, Elapsed);
+                    Total += Elapsed;
+                }
+
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("kernel"), Kernel);
+                Entry->SetNumberField(TEXT("size"), Size);
+                Entry->SetNumberField(TEXT("megapixels"), Megapixels);
+                Entry->SetNumberField(TEXT("bestMs"), Best * 1000.0);
+                Entry->SetNumberField(TEXT("avgMs"), Total / Iterations * 1000.0);
+                Entry->SetNumberField(TEXT("mpPerSec"), Best > 0.0 ? Megapixels / Best : 0.0);
+                Results.Add(MakeShared<FJsonValueObject>(Entry));
+            };
+
+            Measure(TEXT("blur_r4"), [&]() { BoxBlur(Image.GetData(), Size, Size, 4); });
+            Measure(TEXT("blur_r32"), [&]() { BoxBlur(Image.GetData(), Size, Size, 32); });
+            Measure(TEXT("sharpen"), [&]() { Sharpen(Image.GetData(), Size, Size, 1.0f); });
+            Measure(TEXT("adjust_levels"), [&]() { ApplyLUT(Image.GetData(), NumPixels, LevelsLUT, LevelsLUT, LevelsLUT, nullptr); });
+            Measure(TEXT("adjust_curves"), [&]() { ApplyLUT(Image.GetData(), NumPixels, CurveLUT, CurveLUT, CurveLUT, nullptr); });
+            Measure(TEXT("invert"), [&]() { ApplyLUT(Image.GetData(), NumPixels, InvertLUT, InvertLUT, InvertLUT, nullptr); });
+            Measure(TEXT("desaturate"), [&]() { Desaturate(Image.GetData(), NumPixels, 1.0f); });
+
+            Scratch.SetNumUninitialized(NumPixels * 4);
+            Measure(TEXT("combine_overlay"), [&]() { Blend(Image.GetData(), Pristine.GetData(), Scratch.GetData(), NumPixels, EBlendMode::Overlay, 0.75f); });
+            Measure(TEXT("resize_half"), [&]() { ResizeBilinear(Image.GetData(), Size, Size, Scratch.GetData(), Size / 2, Size / 2); });
+            Measure(TEXT("channel_pack"), [&]()
+            {
+                uint8* Plane = Scratch.GetData();
+                ExtractChannel(Image.GetData(), NumPixels, 2, Plane);
+                InterleaveChannels(Plane, Plane, Plane, nullptr, NumPixels, Image.GetData());
+            });
+            Scratch.Empty();
+        }
+
+        Report->SetArrayField(TEXT("sizes"), SizeValues);
+        Report->SetNumberField(TEXT("iterations"), Iterations);
+        Report->SetNumberField(TEXT("workerThreads"), FTaskGraphInterface::Get().GetNumWorkerThreads());
+        Report->SetArrayField(TEXT("results"), Results);
+        return Report;
+    }
+}
@@ -0,0 +1,93 @@
+// =============================================================================
+// McpImageKernels.h
+// =============================================================================
+// Shared CPU image kernels for the texture authoring handlers.
+//
+// All kernels operate on tightly packed 8-bit BGRA buffers (the layout of
+// FTextureSource mip 0 for TSF_BGRA8) and split work into row tiles with
+// ParallelFor. Inner loops are branch-free over contiguous bytes so the
+// compiler can vectorize them; per-channel tone operations go through 256-entry
+// lookup tables.
+//
+// KERNELS:
+//   - BoxBlur          : separable sliding-window box blur, O(1) per pixel
+//   - Sharpen          : 4-neighbour unsharp kernel
+//   - ApplyLUT         : per-channel 256-entry table (levels, curves, invert)
+//   - Desaturate       : Rec.709 luminance in fixed point, lerped by amount
+//   - Blend            : Normal/Multiply/Screen/Overlay/Add with opacity
+//   - ResizeBilinear   : bilinear resample with precomputed column taps
+//   - ExtractChannel / InterleaveChannels : planar <-> BGRA conversion
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpImageKernels
+{
+    enum class EBlendMode : uint8
+    {
+        Normal,
+        Multiply,
+        Screen,
+        Overlay,
+        Add
+    };
+
+    /** Parse a blend mode name (case-insensitive); unknown names map to Normal. */
+    EBlendMode ParseBlendMode(const FString& Name);
+
+    /**
+     * Run Body over [RowBegin, RowEnd) tiles covering Height rows in parallel.
+     * Tiles are sized so each worker gets several, keeping load balanced.
+     */
+    void ParallelForRows(int32 Height, TFunctionRef<void(int32 RowBegin, int32 RowEnd)> Body);
+
+    /** Box blur of B, G and R with clamp-to-edge sampling; alpha is untouched. */
+    void BoxBlur(uint8* Data, int32 Width, int32 Height, int32 Radius);
+
+    /** Sharpen B, G and R of interior pixels: center * (1 + 4a) - a * neighbours. */
+    void Sharpen(uint8* Data, int32 Width, int32 Height, float Amount);
+
+    /** Fill an identity table. */
+    void BuildIdentityLUT(uint8 OutLUT[256]);
+
+    /** Input black/white point, gamma and output black/white point in 0-1. */
+    void BuildLevelsLUT(float InBlack, float InWhite, float Gamma, float OutBlack, float OutWhite, uint8 OutLUT[256]);
+
+    /**
+     * Piecewise-linear curve through (Input[i], Output[i]) in 0-1. Falls back to
+     * identity when there are fewer than 2 points or the arrays differ in length.
+     */
+    void BuildCurveLUT(const TArray<float>& Input, const TArray<float>& Output, uint8 OutLUT[256]);
+
+    /** Apply per-channel tables in place. A null table leaves that channel unchanged. */
+    void ApplyLUT(uint8* Data, int64 NumPixels, const uint8* LutB, const uint8* LutG, const uint8* LutR, const uint8* LutA);
+
+    /** Lerp B, G and R towards Rec.709 luminance by Amount (0-1). */
+    void Desaturate(uint8* Data, int64 NumPixels, float Amount);
+
+    /** Blend Overlay onto Base into Out (may alias Base). Keeps base alpha. */
+    void Blend(const uint8* Base, const uint8* Overlay, uint8* Out, int64 NumPixels, EBlendMode Mode, float Opacity);
+
+    /** Bilinear resample of a BGRA buffer; corner pixels map to corner pixels. */
+    void ResizeBilinear(const uint8* Src, int32 SrcWidth, int32 SrcHeight, uint8* Dst, int32 DstWidth, int32 DstHeight);
+
+    /** Copy one BGRA channel (0=B, 1=G, 2=R, 3=A) into a planar buffer. */
+    void ExtractChannel(const uint8* Src, int64 NumPixels, int32 ChannelIndex, uint8* OutPlane);
+
+    /** Interleave planar channels into BGRA. A null plane writes the default value for that channel. */
+    void InterleaveChannels(const uint8* PlaneB, const uint8* PlaneG, const uint8* PlaneR, const uint8* PlaneA,
+                            int64 NumPixels, uint8* OutBGRA, uint8 DefaultColor = 0, uint8 DefaultAlpha = 255);
+
+    /**
+     * Time every kernel on synthetic square images of the given sizes and
+     * report megapixels per second. Each kernel runs Iterations times and the
+     * best run is reported.
+     */
+    TSharedPtr<FJsonObject> RunBenchmark(const TArray<int32>& Sizes, int32 Iterations);
+}
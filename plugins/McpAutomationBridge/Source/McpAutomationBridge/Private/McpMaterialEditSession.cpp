@@ -0,0 +1,445 @@
+// =============================================================================
+// McpMaterialEditSession.cpp
+// =============================================================================
+// Implementation of deferred material compiles and shader compile waits.
+// =============================================================================
+
+#include "McpMaterialEditSession.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialExpression.h"
+#include "MaterialShared.h"
+#include "RHI.h"
+#include "ShaderCompiler.h"
+#include "UObject/WeakObjectPtr.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcpMaterialEditSession, Log, All);
+
+namespace McpMaterialEditSession
+{
+    namespace
+    {
+        constexpr double PROGRESS_INTERVAL_SECONDS = 0.25;
+
+        struct FSession
+        {
+            TWeakObjectPtr<UMaterial> Material;
+            FString MaterialPath;
+            double OpenedSeconds = 0.0;
+            double Deadline = 0.0;
+            int32 DeferredEdits = 0;
+        };
+
+        struct FCompileWait
+        {
+            TWeakObjectPtr<UMaterial> Material;
+            double StartSeconds = 0.0;
+            double TimeoutSeconds = 0.0;
+            double LastProgressSeconds = 0.0;
+            FCompileResult Result;
+            FProgressSink OnProgress;
+            FCompileSink OnComplete;
+        };
+
+        struct FState
+        {
+            TArray<FSession> Sessions;
+            TArray<TUniquePtr<FCompileWait>> Waits;
+
+            int64 TotalSessions = 0;
+            int64 TotalDeferredEdits = 0;
+            int64 TotalCompiles = 0;
+            int64 TotalWaits = 0;
+
+            TSharedPtr<FJsonObject> LastCommit;
+            TSharedPtr<FJsonObject> LastCompile;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        int32 FindSession(const FState& State, const UMaterial* Material)
+        {
+            return State.Sessions.IndexOfByPredicate([Material](const FSession& Session)
+            {
+                return Session.Material.Get() == Material;
+            });
+        }
+
+        int32 GetRemainingShaderJobs()
+        {
+            return GShaderCompilingManager ? GShaderCompilingManager->GetNumRemainingJobs() : 0;
+        }
+
+        /** True once the material's shader map for the max feature level is no longer being compiled or cached. */
+        bool IsCompilationFinished(UMaterial& Material)
+        {
+            const FMaterialResource* Resource = Material.GetMaterialResource(GMaxRHIFeatureLevel);
+            return !Resource || Resource->IsCompilationFinished();
+        }
+
+        /** Compile errors of the material resource; "(Node X)" prefixes name the failing node. */
+        void ReadCompileErrors(UMaterial& Material, FCompileResult& Result)
+        {
+            const FMaterialResource* Resource = Material.GetMaterialResource(GMaxRHIFeatureLevel);
+            if (!Resource)
+            {
+                return;
+            }
+
+            for (const FString& Message : Resource->GetCompileErrors())
+            {
+                FCompileError& Error = Result.Errors.AddDefaulted_GetRef();
+                Error.Message = Message;
+
+                const int32 NodeStart = Message.Find(TEXT("(Node "));
+                if (NodeStart != INDEX_NONE)
+                {
+                    const int32 NameStart = NodeStart + 6;
+                    const int32 NameEnd = Message.Find(TEXT(")"), ESearchCase::CaseSensitive, ESearchDir::FromStart, NameStart);
+                    if (NameEnd > NameStart)
+                    {
+                        Error.NodeName = Message.Mid(NameStart, NameEnd - NameStart);
+                    }
+                }
+            }
+
+#if WITH_EDITOR
+            for (const auto& ErrorExpression : Resource->GetErrorExpressions())
+            {
+                const UMaterialExpression* Expression = ErrorExpression;
+                if (!Expression)
+                {
+                    continue;
+                }
+                TSharedPtr<FJsonObject> Node = MakeShared<FJsonObject>();
+                Node->SetStringField(TEXT("nodeId"), Expression->MaterialExpressionGuid.ToString());
+                Node->SetStringField(TEXT("name"), Expression->GetName());
+                Node->SetStringField(TEXT("class"), Expression->GetClass()->GetName());
+                Result.ErrorNodes.Add(MakeShared<FJsonValueObject>(Node));
+            }
+#endif
+        }
+
+        FCommitResult CommitAt(FState& State, int32 Index, const FString& Reason, double Now)
+        {
+            const FSession Session = State.Sessions[Index];
+            State.Sessions.RemoveAt(Index);
+
+            FCommitResult Result;
+            Result.MaterialPath = Session.MaterialPath;
+            Result.DeferredEdits = Session.DeferredEdits;
+            Result.OpenSeconds = Now - Session.OpenedSeconds;
+
+            UMaterial* Material = Session.Material.Get();
+            if (Material && Session.DeferredEdits > 0)
+            {
+                Recompile(Material);
+                Result.bCompiled = true;
+            }
+
+            UE_LOG(LogMcpMaterialEditSession, Verbose, TEXT("Material edit session for %s committed (%s): %d deferred edits"),
+                *Session.MaterialPath, *Reason, Session.DeferredEdits);
+
+            State.LastCommit = CommitResultToJson(Result);
+            State.LastCommit->SetStringField(TEXT("reason"), Reason);
+            return Result;
+        }
+
+        void CompleteWait(FState& State, TUniquePtr<FCompileWait> Wait, double Now)
+        {
+            Wait->Result.CompileSeconds = Now - Wait->StartSeconds;
+            if (UMaterial* Material = Wait->Material.Get())
+            {
+                ReadCompileErrors(*Material, Wait->Result);
+            }
+            State.LastCompile = CompileResultToJson(Wait->Result);
+            if (Wait->OnComplete)
+            {
+                Wait->OnComplete(Wait->Result);
+            }
+        }
+
+        void TickWaits(FState& State, double Now)
+        {
+            if (State.Waits.Num() == 0)
+            {
+                return;
+            }
+
+            const int32 RemainingJobs = GetRemainingShaderJobs();
+            TArray<TUniquePtr<FCompileWait>> Finished;
+            for (int32 Index = 0; Index < State.Waits.Num();)
+            {
+                FCompileWait& Wait = *State.Waits[Index];
+                Wait.Result.PeakShaderJobs = FMath::Max(Wait.Result.PeakShaderJobs, RemainingJobs);
+
+                bool bDone = true;
+                UMaterial* Material = Wait.Material.Get();
+                if (!Material)
+                {
+                    Wait.Result.bMaterialLost = true;
+                }
+                else if (IsCompilationFinished(*Material))
+                {
+                    Wait.Result.bFinished = true;
+                }
+                else if (Now - Wait.StartSeconds >= Wait.TimeoutSeconds)
+                {
+                    // Reported as not finished
+                }
+                else
+                {
+                    bDone = false;
+                    if (Wait.OnProgress && Now - Wait.LastProgressSeconds >= PROGRESS_INTERVAL_SECONDS)
+                    {
+                        Wait.LastProgressSeconds = Now;
+                        const int32 Peak = Wait.Result.PeakShaderJobs;
+                        const float Percent = Peak > 0 ? 100.0f * static_cast<float>(Peak - RemainingJobs) / Peak : 0.0f;
+                        Wait.OnProgress(Percent, RemainingJobs > 0
+                            ? FString::Printf(TEXT("Compiling shaders: %d jobs remaining"), RemainingJobs)
+                            : FString(TEXT("Waiting for the material shader map")));
+                    }
+                }
+
+                if (bDone)
+                {
+                    Finished.Add(MoveTemp(State.Waits[Index]));
+                    State.Waits.RemoveAt(Index);
+                }
+                else
+                {
+                    ++Index;
+                }
+            }
+
+            // Complete after the sweep; completion sinks may start new waits
+            for (TUniquePtr<FCompileWait>& Wait : Finished)
+            {
+                CompleteWait(State, MoveTemp(Wait), Now);
+            }
+        }
+    }
+
+    bool Begin(UMaterial* Material, double MaxSeconds, FString& OutError)
+    {
+        FState& State = GetState();
+        if (!Material)
+        {
+            OutError = TEXT("Material is null");
+            return false;
+        }
+        if (FindSession(State, Material) != INDEX_NONE)
+        {
+            OutError = FString::Printf(TEXT("An edit session for %s is already open"), *Material->GetPathName());
+            return false;
+        }
+
+        const double Now = FPlatformTime::Seconds();
+        FSession& Session = State.Sessions.AddDefaulted_GetRef();
+        Session.Material = Material;
+        Session.MaterialPath = Material->GetPathName();
+        Session.OpenedSeconds = Now;
+        Session.Deadline = Now + MaxSeconds;
+        ++State.TotalSessions;
+        return true;
+    }
+
+    bool IsOpen(const UMaterial* Material)
+    {
+        return Material && FindSession(GetState(), Material) != INDEX_NONE;
+    }
+
+    bool NotifyEdited(UMaterial* Material)
+    {
+        if (!Material)
+        {
+            return false;
+        }
+
+        FState& State = GetState();
+        const int32 Index = FindSession(State, Material);
+        if (Index == INDEX_NONE)
+        {
+            Material->PostEditChange();
+            Material->MarkPackageDirty();
+            ++State.TotalCompiles;
+            return false;
+        }
+
+        Material->MarkPackageDirty();
+        ++State.Sessions[Index].DeferredEdits;
+        ++State.TotalDeferredEdits;
+        return true;
+    }
+
+    FCommitResult Commit(UMaterial* Material, const FString& Reason)
+    {
+        FState& State = GetState();
+        const int32 Index = Material ? FindSession(State, Material) : INDEX_NONE;
+        if (Index == INDEX_NONE)
+        {
+            FCommitResult Result;
+            Result.MaterialPath = Material ? Material->GetPathName() : FString();
+            return Result;
+        }
+        return CommitAt(State, Index, Reason, FPlatformTime::Seconds());
+    }
+
+    void Recompile(UMaterial* Material)
+    {
+        if (!Material)
+        {
+            return;
+        }
+        Material->PreEditChange(nullptr);
+        Material->PostEditChange();
+        Material->MarkPackageDirty();
+        ++GetState().TotalCompiles;
+    }
+
+    void CommitAll(const FString& Reason)
+    {
+        FState& State = GetState();
+        const double Now = FPlatformTime::Seconds();
+        while (State.Sessions.Num() > 0)
+        {
+            CommitAt(State, State.Sessions.Num() - 1, Reason, Now);
+        }
+    }
+
+    void WaitForCompile(UMaterial* Material, double TimeoutSeconds, FProgressSink OnProgress,
+                        FCompileSink OnComplete)
+    {
+        FState& State = GetState();
+        ++State.TotalWaits;
+
+        const double Now = FPlatformTime::Seconds();
+        TUniquePtr<FCompileWait> Wait = MakeUnique<FCompileWait>();
+        Wait->Material = Material;
+        Wait->StartSeconds = Now;
+        Wait->TimeoutSeconds = TimeoutSeconds;
+        Wait->Result.MaterialPath = Material ? Material->GetPathName() : FString();
+        Wait->Result.PeakShaderJobs = GetRemainingShaderJobs();
+        Wait->OnProgress = MoveTemp(OnProgress);
+        Wait->OnComplete = MoveTemp(OnComplete);
+
+        // Shader maps found in the DDC finish inside PostEditChange; answer right away
+        if (!Material || IsCompilationFinished(*Material))
+        {
+            Wait->Result.bFinished = Material != nullptr;
+            Wait->Result.bMaterialLost = Material == nullptr;
+            CompleteWait(State, MoveTemp(Wait), Now);
+            return;
+        }
+        State.Waits.Add(MoveTemp(Wait));
+    }
+
+    void CancelWaits()
+    {
+        GetState().Waits.Reset();
+    }
+
+    void Tick()
+    {
+        FState& State = GetState();
+        const double Now = FPlatformTime::Seconds();
+
+        for (int32 Index = State.Sessions.Num() - 1; Index >= 0; --Index)
+        {
+            const FSession& Session = State.Sessions[Index];
+            if (!Session.Material.IsValid())
+            {
+                State.Sessions.RemoveAt(Index);
+            }
+            else if (Now >= Session.Deadline)
+            {
+                UE_LOG(LogMcpMaterialEditSession, Warning,
+                    TEXT("Material edit session for %s was not committed within its time limit; compiling now"),
+                    *Session.MaterialPath);
+                CommitAt(State, Index, TEXT("session_expired"), Now);
+            }
+        }
+
+        TickWaits(State, Now);
+    }
+
+    TSharedPtr<FJsonObject> GetStatus()
+    {
+        const FState& State = GetState();
+        const double Now = FPlatformTime::Seconds();
+
+        TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+        TArray<TSharedPtr<FJsonValue>> Sessions;
+        for (const FSession& Session : State.Sessions)
+        {
+            TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+            Json->SetStringField(TEXT("assetPath"), Session.MaterialPath);
+            Json->SetNumberField(TEXT("deferredEdits"), Session.DeferredEdits);
+            Json->SetNumberField(TEXT("openMs"), (Now - Session.OpenedSeconds) * 1000.0);
+            Json->SetNumberField(TEXT("expiresInSeconds"), FMath::Max(0.0, Session.Deadline - Now));
+            Sessions.Add(MakeShared<FJsonValueObject>(Json));
+        }
+        Status->SetArrayField(TEXT("openSessions"), Sessions);
+        Status->SetNumberField(TEXT("pendingCompileWaits"), State.Waits.Num());
+        Status->SetNumberField(TEXT("remainingShaderJobs"), GetRemainingShaderJobs());
+
+        TSharedPtr<FJsonObject> Totals = MakeShared<FJsonObject>();
+        Totals->SetNumberField(TEXT("sessions"), static_cast<double>(State.TotalSessions));
+        Totals->SetNumberField(TEXT("deferredEdits"), static_cast<double>(State.TotalDeferredEdits));
+        Totals->SetNumberField(TEXT("compiles"), static_cast<double>(State.TotalCompiles));
+        Totals->SetNumberField(TEXT("compileWaits"), static_cast<double>(State.TotalWaits));
+        Status->SetObjectField(TEXT("totals"), Totals);
+
+        if (State.LastCommit.IsValid())
+        {
+            Status->SetObjectField(TEXT("lastCommit"), State.LastCommit);
+        }
+        if (State.LastCompile.IsValid())
+        {
+            Status->SetObjectField(TEXT("lastCompile"), State.LastCompile);
+        }
+        return Status;
+    }
+
+    TSharedPtr<FJsonObject> CommitResultToJson(const FCommitResult& Result)
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetStringField(TEXT("assetPath"), Result.MaterialPath);
+        Json->SetNumberField(TEXT("deferredEdits"), Result.DeferredEdits);
+        Json->SetNumberField(TEXT("openMs"), Result.OpenSeconds * 1000.0);
+        Json->SetBoolField(TEXT("compiled"), Result.bCompiled);
+        return Json;
+    }
+
+    TSharedPtr<FJsonObject> CompileResultToJson(const FCompileResult& Result)
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetStringField(TEXT("assetPath"), Result.MaterialPath);
+        Json->SetBoolField(TEXT("finished"), Result.bFinished);
+        Json->SetBoolField(TEXT("success"), Result.bFinished && Result.Errors.Num() == 0);
+        Json->SetNumberField(TEXT("compileMs"), Result.CompileSeconds * 1000.0);
+        Json->SetNumberField(TEXT("peakShaderJobs"), Result.PeakShaderJobs);
+        Json->SetNumberField(TEXT("errorCount"), Result.Errors.Num());
+
+        TArray<TSharedPtr<FJsonValue>> Errors;
+        for (const FCompileError& Error : Result.Errors)
+        {
+            TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+            ErrorJson->SetStringField(TEXT("message"), Error.Message);
+            if (!Error.NodeName.IsEmpty())
+            {
+                ErrorJson->SetStringField(TEXT("node"), Error.NodeName);
+            }
+            Errors.Add(MakeShared<FJsonValueObject>(ErrorJson));
+        }
+        Json->SetArrayField(TEXT("errors"), Errors);
+        Json->SetArrayField(TEXT("errorNodes"), Result.ErrorNodes);
+        return Json;
+    }
+}
@@ -0,0 +1,130 @@
+// =============================================================================
+// McpMaterialEditSession.h
+// =============================================================================
+// Material edit sessions and shader compile waits for manage_material_authoring.
+//
+// Every graph edit (add_math_node, connect_nodes, add_texture_sample, ...)
+// used to finish with UMaterial::PostEditChange, which recompiles the
+// material's shaders. Building a 40-node material therefore queued 40
+// recompiles, each superseding the last, in the shader compiling manager.
+//
+// begin_material_edit opens a session for one material. While it is open the
+// handlers call NotifyEdited instead of PostEditChange: the edit is applied to
+// the graph and the package is marked dirty, but nothing compiles.
+// commit_material_edit closes the session and runs one PostEditChange, so the
+// whole batch costs a single compile. Sessions not committed within their
+// maxSeconds are committed on the ticker so a material is never left stale.
+//
+// WaitForCompile polls the material's shader map on the ticker, reports the
+// shader jobs remaining in the compiling manager, and hands back the compile
+// errors of the material resource once compilation has finished.
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UMaterial;
+
+namespace McpMaterialEditSession
+{
+    struct FCommitResult
+    {
+        FString MaterialPath;
+
+        /** Edits applied without a compile while the session was open. */
+        int32 DeferredEdits = 0;
+
+        double OpenSeconds = 0.0;
+
+        /** PostEditChange ran (skipped when the session saw no edits). */
+        bool bCompiled = false;
+    };
+
+    struct FCompileError
+    {
+        FString Message;
+
+        /** Node named by the "(Node X)" prefix of the message, when present. */
+        FString NodeName;
+    };
+
+    struct FCompileResult
+    {
+        FString MaterialPath;
+
+        /** The shader map of the material finished compiling before the wait ended. */
+        bool bFinished = false;
+
+        /** The material was garbage collected during the wait. */
+        bool bMaterialLost = false;
+
+        double CompileSeconds = 0.0;
+
+        /** Largest number of shader jobs queued in the compiling manager during the wait. */
+        int32 PeakShaderJobs = 0;
+
+        TArray<FCompileError> Errors;
+
+        /** Expressions the translator flagged, as {nodeId, name, class} objects. */
+        TArray<TSharedPtr<FJsonValue>> ErrorNodes;
+    };
+
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+    using FCompileSink = TFunction<void(const FCompileResult& Result)>;
+
+    /**
+     * Open a session for Material. Edits reported through NotifyEdited are
+     * deferred until Commit or until MaxSeconds pass. False with OutError
+     * when a session for the material is already open.
+     */
+    bool Begin(UMaterial* Material, double MaxSeconds, FString& OutError);
+
+    bool IsOpen(const UMaterial* Material);
+
+    /**
+     * Finish a graph edit on Material. Outside a session this runs
+     * PostEditChange (one compile) as before; inside a session it only marks
+     * the package dirty and counts the edit. Returns true when deferred.
+     */
+    bool NotifyEdited(UMaterial* Material);
+
+    /**
+     * Close the session for Material and compile once when edits were
+     * deferred. Without an open session this returns an empty result with
+     * bCompiled false.
+     */
+    FCommitResult Commit(UMaterial* Material, const FString& Reason);
+
+    /** Force one compile of Material (compile_material), whether or not a session is open. */
+    void Recompile(UMaterial* Material);
+
+    /** Commit every open session (subsystem shutdown). */
+    void CommitAll(const FString& Reason);
+
+    /**
+     * Report remaining shader jobs until Material's shader map for the max
+     * feature level has finished compiling, or TimeoutSeconds pass.
+     * OnComplete runs on a later tick, or right away when nothing compiles.
+     */
+    void WaitForCompile(UMaterial* Material, double TimeoutSeconds, FProgressSink OnProgress,
+                        FCompileSink OnComplete);
+
+    /** Drop compile waits (subsystem shutdown). Completions are not reported. */
+    void CancelWaits();
+
+    /** Expire sessions past their deadline and advance compile waits. Called from the subsystem ticker. */
+    void Tick();
+
+    /** Open sessions, pending waits, shader jobs and lifetime totals. */
+    TSharedPtr<FJsonObject> GetStatus();
+
+    TSharedPtr<FJsonObject> CommitResultToJson(const FCommitResult& Result);
+    TSharedPtr<FJsonObject> CompileResultToJson(const FCompileResult& Result);
+}
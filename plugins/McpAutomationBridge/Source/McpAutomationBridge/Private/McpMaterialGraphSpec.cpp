@@ -0,0 +1,1519 @@
+// =============================================================================
+// McpMaterialGraphSpec.cpp
+// =============================================================================
+// Implementation of declarative material graph diff/apply and its benchmark.
+// =============================================================================
+
+#include "McpMaterialGraphSpec.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpVersionCompatibility.h"
+#include "McpMaterialEditSession.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialExpression.h"
+#include "Materials/MaterialExpressionComment.h"
+#include "Materials/MaterialExpressionConstant.h"
+#include "Materials/MaterialExpressionConstant2Vector.h"
+#include "Materials/MaterialExpressionConstant3Vector.h"
+#include "Materials/MaterialExpressionConstant4Vector.h"
+#include "Materials/MaterialExpressionMaterialFunctionCall.h"
+#include "Materials/MaterialExpressionParameter.h"
+#include "Materials/MaterialExpressionScalarParameter.h"
+#include "Materials/MaterialExpressionStaticBoolParameter.h"
+#include "Materials/MaterialExpressionTextureBase.h"
+#include "Materials/MaterialExpressionTextureSampleParameter.h"
+#include "Materials/MaterialExpressionVectorParameter.h"
+#include "Materials/MaterialFunctionInterface.h"
+#include "Engine/Texture.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_EDITOR
+#include "ScopedTransaction.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcpMaterialGraphSpec, Log, All);
+
+namespace McpMaterialGraphSpec
+{
+    namespace
+    {
+        const TCHAR* const MAIN_NODE_KEY = TEXT("Main");
+
+        /** Main material inputs addressable as "Main.<name>". */
+        const TCHAR* const MAIN_INPUT_NAMES[] = {
+            TEXT("BaseColor"), TEXT("Metallic"), TEXT("Specular"), TEXT("Roughness"),
+            TEXT("EmissiveColor"), TEXT("Opacity"), TEXT("OpacityMask"), TEXT("Normal"),
+            TEXT("WorldPositionOffset"), TEXT("SubsurfaceColor"), TEXT("AmbientOcclusion"),
+            TEXT("Refraction"), TEXT("PixelDepthOffset"), TEXT("ClearCoat"), TEXT("ClearCoatRoughness")
+        };
+
+        struct FBenchmarkRun;
+
+        struct FState
+        {
+            TSharedPtr<FBenchmarkRun> Benchmark;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        // ---------------------------------------------------------------------
+        // Text form
+        // ---------------------------------------------------------------------
+
+        /** Split on whitespace; double quotes group, backslash escapes inside quotes. */
+        TArray<FString> Tokenize(const FString& Line)
+        {
+            TArray<FString> Tokens;
+            FString Current;
+            bool bInQuotes = false;
+            bool bHasToken = false;
+            for (int32 Index = 0; Index < Line.Len(); ++Index)
+            {
+                const TCHAR C = Line[Index];
+                if (bInQuotes)
+                {
+                    if (C == TEXT('\\') && Index + 1 < Line.Len())
+                    {
+                        Current.AppendChar(Line[++Index]);
+                    }
+                    else if (C == TEXT('"'))
+                    {
+                        bInQuotes = false;
+                    }
+                    else
+                    {
+                        Current.AppendChar(C);
+                    }
+                }
+                else if (C == TEXT('"'))
+                {
+                    bInQuotes = true;
+                    bHasToken = true;
+                }
+                else if (FChar::IsWhitespace(C))
+                {
+                    if (bHasToken)
+                    {
+                        Tokens.Add(MoveTemp(Current));
+                        Current.Reset();
+                        bHasToken = false;
+                    }
+                }
+                else
+                {
+                    Current.AppendChar(C);
+                    bHasToken = true;
+                }
+            }
+            if (bHasToken)
+            {
+                Tokens.Add(MoveTemp(Current));
+            }
+            return Tokens;
+        }
+
+        /** Number, bool, comma-separated number list, or string. */
+        TSharedPtr<FJsonValue> ParseTextValue(const FString& Text)
+        {
+            if (Text.Equals(TEXT("true"), ESearchCase::IgnoreCase))
+            {
+                return MakeShared<FJsonValueBoolean>(true);
+            }
+            if (Text.Equals(TEXT("false"), ESearchCase::IgnoreCase))
+            {
+                return MakeShared<FJsonValueBoolean>(false);
+            }
+            if (Text.IsNumeric())
+            {
+                return MakeShared<FJsonValueNumber>(FCString::Atod(*Text));
+            }
+            if (Text.Contains(TEXT(",")))
+            {
+                TArray<FString> Parts;
+                Text.ParseIntoArray(Parts, TEXT(","), true);
+                TArray<TSharedPtr<FJsonValue>> Numbers;
+                for (const FString& Part : Parts)
+                {
+                    const FString Trimmed = Part.TrimStartAndEnd();
+                    if (!Trimmed.IsNumeric())
+                    {
+                        return MakeShared<FJsonValueString>(Text);
+                    }
+                    Numbers.Add(MakeShared<FJsonValueNumber>(FCString::Atod(*Trimmed)));
+                }
+                return MakeShared<FJsonValueArray>(Numbers);
+            }
+            return MakeShared<FJsonValueString>(Text);
+        }
+
+        bool IsNodeField(const FString& Field)
+        {
+            static const TSet<FString> Fields = {
+                TEXT("x"), TEXT("y"), TEXT("parameterName"), TEXT("group"),
+                TEXT("defaultValue"), TEXT("texture"), TEXT("function")
+            };
+            return Fields.Contains(Field);
+        }
+
+        /** Apply field=value tokens from Start onward to Node; unknown fields go to "properties". */
+        bool ParseAssignments(const TArray<FString>& Tokens, int32 Start, const TSharedPtr<FJsonObject>& Node,
+                              bool bAllowProperties, FString& OutError)
+        {
+            TSharedPtr<FJsonObject> Properties;
+            for (int32 Index = Start; Index < Tokens.Num(); ++Index)
+            {
+                FString Field, Value;
+                if (!Tokens[Index].Split(TEXT("="), &Field, &Value) || Field.IsEmpty())
+                {
+                    OutError = FString::Printf(TEXT("expected field=value, got '%s'"), *Tokens[Index]);
+                    return false;
+                }
+                if (IsNodeField(Field))
+                {
+                    Node->SetField(Field, ParseTextValue(Value));
+                }
+                else if (bAllowProperties)
+                {
+                    if (!Properties.IsValid())
+                    {
+                        Properties = MakeShared<FJsonObject>();
+                        Node->SetObjectField(TEXT("properties"), Properties);
+                    }
+                    Properties->SetField(Field, ParseTextValue(Value));
+                }
+                else
+                {
+                    OutError = FString::Printf(TEXT("unknown field '%s'"), *Field);
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /** "Key" or "Key.Pin" -> (Key, Pin). */
+        void SplitEndpoint(const FString& Endpoint, FString& OutKey, FString& OutPin)
+        {
+            if (!Endpoint.Split(TEXT("."), &OutKey, &OutPin, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+            {
+                OutKey = Endpoint;
+                OutPin.Reset();
+            }
+        }
+
+#if WITH_EDITOR
+        // ---------------------------------------------------------------------
+        // Graph access
+        // ---------------------------------------------------------------------
+
+        FExpressionInput* FindMainInput(UMaterial& Material, const FString& Name)
+        {
+#if WITH_EDITORONLY_DATA
+#define MCP_MAIN_INPUT(InputName) \
+            if (Name.Equals(TEXT(#InputName), ESearchCase::IgnoreCase)) { return &MCP_GET_MATERIAL_INPUT(&Material, InputName); }
+            MCP_MAIN_INPUT(BaseColor)
+            MCP_MAIN_INPUT(Metallic)
+            MCP_MAIN_INPUT(Specular)
+            MCP_MAIN_INPUT(Roughness)
+            MCP_MAIN_INPUT(EmissiveColor)
+            MCP_MAIN_INPUT(Opacity)
+            MCP_MAIN_INPUT(OpacityMask)
+            MCP_MAIN_INPUT(Normal)
+            MCP_MAIN_INPUT(WorldPositionOffset)
+            MCP_MAIN_INPUT(SubsurfaceColor)
+            MCP_MAIN_INPUT(AmbientOcclusion)
+            MCP_MAIN_INPUT(Refraction)
+            MCP_MAIN_INPUT(PixelDepthOffset)
+            MCP_MAIN_INPUT(ClearCoat)
+            MCP_MAIN_INPUT(ClearCoatRoughness)
+#undef MCP_MAIN_INPUT
+#endif
+            return nullptr;
+        }
+
+        /** Input by display name, index, or the name of its FExpressionInput property. Empty name = first input. */
+        FExpressionInput* FindExpressionInput(UMaterialExpression& Expression, const FString& Name)
+        {
+            const bool bIsIndex = Name.IsNumeric();
+            const int32 WantedIndex = bIsIndex ? FCString::Atoi(*Name) : INDEX_NONE;
+            for (int32 Index = 0;; ++Index)
+            {
+                FExpressionInput* Input = Expression.GetInput(Index);
+                if (!Input)
+                {
+                    break;
+                }
+                if ((Name.IsEmpty() && Index == 0) || Index == WantedIndex ||
+                    Expression.GetInputName(Index).ToString().Equals(Name, ESearchCase::IgnoreCase))
+                {
+                    return Input;
+                }
+            }
+
+            FStructProperty* Property = CastField<FStructProperty>(Expression.GetClass()->FindPropertyByName(FName(*Name)));
+            if (Property && Property->Struct && Property->Struct->GetName() == TEXT("ExpressionInput"))
+            {
+                return Property->ContainerPtrToValuePtr<FExpressionInput>(&Expression);
+            }
+            return nullptr;
+        }
+
+        template <typename FunctorType>
+        void ForEachInput(UMaterialExpression& Expression, FunctorType&& Functor)
+        {
+            for (int32 Index = 0;; ++Index)
+            {
+                FExpressionInput* Input = Expression.GetInput(Index);
+                if (!Input)
+                {
+                    break;
+                }
+                Functor(*Input);
+            }
+        }
+
+        /** Output by index or output name; -1 when the expression has no such output. */
+        int32 ResolveOutputIndex(UMaterialExpression& Expression, const FString& Output)
+        {
+            if (Output.IsEmpty())
+            {
+                return 0;
+            }
+            TArray<FExpressionOutput>& Outputs = Expression.GetOutputs();
+            if (Output.IsNumeric())
+            {
+                const int32 Index = FCString::Atoi(*Output);
+                return Outputs.IsValidIndex(Index) ? Index : INDEX_NONE;
+            }
+            for (int32 Index = 0; Index < Outputs.Num(); ++Index)
+            {
+                if (Outputs[Index].OutputName.ToString().Equals(Output, ESearchCase::IgnoreCase))
+                {
+                    return Index;
+                }
+            }
+            return INDEX_NONE;
+        }
+
+        FString ToObjectName(const FString& Key)
+        {
+            FString Name = Key;
+            for (TCHAR& C : Name)
+            {
+                if (FChar::IsWhitespace(C) || FCString::Strchr(INVALID_OBJECTNAME_CHARACTERS, C))
+                {
+                    C = TEXT('_');
+                }
+            }
+            return Name;
+        }
+
+        UClass* ResolveExpressionClass(const FString& Type)
+        {
+            static const TMap<FString, FString> Aliases = {
+                {TEXT("Lerp"), TEXT("LinearInterpolate")},
+                {TEXT("Float"), TEXT("Constant")},
+                {TEXT("Scalar"), TEXT("Constant")},
+                {TEXT("Color"), TEXT("Constant3Vector")},
+                {TEXT("Vector3"), TEXT("Constant3Vector")},
+                {TEXT("TexCoord"), TEXT("TextureCoordinate")},
+                {TEXT("VertexNormal"), TEXT("VertexNormalWS")},
+                {TEXT("ReflectionVector"), TEXT("ReflectionVectorWS")},
+                {TEXT("StaticSwitch"), TEXT("StaticSwitchParameter")},
+                {TEXT("Append"), TEXT("AppendVector")},
+                {TEXT("FunctionCall"), TEXT("MaterialFunctionCall")}
+            };
+            const FString* Alias = Aliases.Find(Type);
+            const FString Name = Alias ? *Alias : Type;
+
+            UClass* Class = nullptr;
+            if (!Name.Contains(TEXT(".")) && !Name.Contains(TEXT("/")))
+            {
+                const FString ShortName = Name.StartsWith(TEXT("MaterialExpression")) ? Name : TEXT("MaterialExpression") + Name;
+                Class = FindObject<UClass>(nullptr, *(TEXT("/Script/Engine.") + ShortName));
+                if (!Class)
+                {
+                    Class = ResolveClassByName(ShortName);
+                }
+            }
+            if (!Class || !Class->IsChildOf(UMaterialExpression::StaticClass()))
+            {
+                Class = ResolveClassByName(Name);
+            }
+            if (!Class || !Class->IsChildOf(UMaterialExpression::StaticClass()) ||
+                Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
+            {
+                return nullptr;
+            }
+            return Class;
+        }
+
+        bool ReadColor(const TSharedPtr<FJsonValue>& Value, FLinearColor& OutColor)
+        {
+            if (!Value.IsValid())
+            {
+                return false;
+            }
+            const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+            if (Value->TryGetArray(Array) && Array->Num() >= 3)
+            {
+                OutColor = FLinearColor((*Array)[0]->AsNumber(), (*Array)[1]->AsNumber(), (*Array)[2]->AsNumber(),
+                                        Array->Num() > 3 ? (*Array)[3]->AsNumber() : 1.0);
+                return true;
+            }
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (Value->TryGetObject(Object))
+            {
+                double R = 0.0, G = 0.0, B = 0.0, A = 1.0;
+                (*Object)->TryGetNumberField(TEXT("r"), R);
+                (*Object)->TryGetNumberField(TEXT("g"), G);
+                (*Object)->TryGetNumberField(TEXT("b"), B);
+                (*Object)->TryGetNumberField(TEXT("a"), A);
+                OutColor = FLinearColor(R, G, B, A);
+                return true;
+            }
+            double Scalar = 0.0;
+            if (Value->TryGetNumber(Scalar))
+            {
+                OutColor = FLinearColor(Scalar, Scalar, Scalar, 1.0);
+                return true;
+            }
+            return false;
+        }
+
+        // ---------------------------------------------------------------------
+        // Spec normalization
+        // ---------------------------------------------------------------------
+
+        struct FNodeSpec
+        {
+            FString Key;
+            FString ObjectName;
+            UClass* Class = nullptr;
+            TSharedPtr<FJsonObject> Json;
+            UMaterialExpression* Expression = nullptr;
+            bool bCreated = false;
+        };
+
+        struct FEdgeSpec
+        {
+            FString From;
+            FString Output;
+            FString To;
+            FString Input;
+        };
+
+        /** Turn a "parameters" entry into a node entry keyed by the parameter name. */
+        TSharedPtr<FJsonObject> ParameterToNode(const TSharedPtr<FJsonObject>& Parameter, FString& OutError)
+        {
+            FString Name, Type;
+            Parameter->TryGetStringField(TEXT("name"), Name);
+            Parameter->TryGetStringField(TEXT("type"), Type);
+            if (Name.IsEmpty())
+            {
+                OutError = TEXT("parameter without 'name'");
+                return nullptr;
+            }
+
+            static const TMap<FString, FString> Types = {
+                {TEXT("scalar"), TEXT("ScalarParameter")},
+                {TEXT("vector"), TEXT("VectorParameter")},
+                {TEXT("texture"), TEXT("TextureSampleParameter2D")},
+                {TEXT("switch"), TEXT("StaticSwitchParameter")}
+            };
+            const FString* NodeType = Types.Find(Type.ToLower());
+            if (!NodeType)
+            {
+                OutError = FString::Printf(TEXT("parameter '%s' has type '%s' (expected scalar, vector, texture or switch)"),
+                    *Name, *Type);
+                return nullptr;
+            }
+
+            TSharedPtr<FJsonObject> Node = MakeShared<FJsonObject>();
+            Node->Values = Parameter->Values;
+            Node->RemoveField(TEXT("name"));
+            Node->SetStringField(TEXT("key"), Name);
+            Node->SetStringField(TEXT("type"), *NodeType);
+            Node->SetStringField(TEXT("parameterName"), Name);
+            return Node;
+        }
+
+        bool ReadEdge(const TSharedPtr<FJsonObject>& Json, FEdgeSpec& OutEdge, FString& OutError)
+        {
+            Json->TryGetStringField(TEXT("from"), OutEdge.From);
+            Json->TryGetStringField(TEXT("to"), OutEdge.To);
+            Json->TryGetStringField(TEXT("input"), OutEdge.Input);
+
+            double OutputIndex = 0.0;
+            if (!Json->TryGetStringField(TEXT("output"), OutEdge.Output) && Json->TryGetNumberField(TEXT("output"), OutputIndex))
+            {
+                OutEdge.Output = FString::FromInt(static_cast<int32>(OutputIndex));
+            }
+            if (OutEdge.From.IsEmpty())
+            {
+                OutError = TEXT("edge without 'from'");
+                return false;
+            }
+            if (OutEdge.To.IsEmpty())
+            {
+                OutEdge.To = MAIN_NODE_KEY;
+            }
+            if (OutEdge.To.Equals(MAIN_NODE_KEY, ESearchCase::IgnoreCase) && OutEdge.Input.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("edge from '%s' to Main needs an 'input'"), *OutEdge.From);
+                return false;
+            }
+            return true;
+        }
+
+        /** Lookup tables over the material's expressions, built once per apply. */
+        struct FExpressionIndex
+        {
+            TMap<FString, UMaterialExpression*> ByName;
+            TMap<FString, UMaterialExpression*> ByGuid;
+            TMap<FName, UMaterialExpression*> ByParameter;
+
+            void Build(UMaterial& Material)
+            {
+                for (UMaterialExpression* Expression : MCP_GET_MATERIAL_EXPRESSIONS(&Material))
+                {
+                    if (!Expression)
+                    {
+                        continue;
+                    }
+                    ByName.Add(Expression->GetName(), Expression);
+                    ByGuid.Add(Expression->MaterialExpressionGuid.ToString(), Expression);
+                    if (Expression->HasAParameterName())
+                    {
+                        ByParameter.Add(Expression->GetParameterName(), Expression);
+                    }
+                }
+            }
+
+            UMaterialExpression* Find(const FString& Id) const
+            {
+                if (UMaterialExpression* const* Found = ByName.Find(ToObjectName(Id)))
+                {
+                    return *Found;
+                }
+                if (UMaterialExpression* const* Found = ByGuid.Find(Id))
+                {
+                    return *Found;
+                }
+                UMaterialExpression* const* Found = ByParameter.Find(FName(*Id));
+                return Found ? *Found : nullptr;
+            }
+        };
+
+        void AddExpression(UMaterial& Material, UMaterialExpression* Expression)
+        {
+#if WITH_EDITORONLY_DATA
+            Expression->Material = &Material;
+            MCP_GET_MATERIAL_EXPRESSIONS(&Material).Add(Expression);
+#endif
+        }
+
+        void RemoveExpression(UMaterial& Material, UMaterialExpression* Expression)
+        {
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+            Material.GetExpressionCollection().RemoveExpression(Expression);
+#else
+            Material.Expressions.Remove(Expression);
+#endif
+            Material.RemoveExpressionParameter(Expression);
+        }
+
+        /** Position, parameter fields, default value, texture, function and reflected properties. */
+        void ApplyNodeFields(FNodeSpec& Node, int32 NodeIndex, TArray<FString>& Warnings)
+        {
+            UMaterialExpression* Expression = Node.Expression;
+            const TSharedPtr<FJsonObject>& Json = Node.Json;
+
+            double X = 0.0, Y = 0.0;
+            const bool bHasX = Json->TryGetNumberField(TEXT("x"), X);
+            const bool bHasY = Json->TryGetNumberField(TEXT("y"), Y);
+            if (bHasX || bHasY || Node.bCreated)
+            {
+                // New nodes without a position go into columns of 20, left of the main node
+                Expression->MaterialExpressionEditorX = bHasX ? static_cast<int32>(X) : -400 - 300 * (NodeIndex / 20);
+                Expression->MaterialExpressionEditorY = bHasY ? static_cast<int32>(Y) : 150 * (NodeIndex % 20);
+            }
+
+            FString ParameterName;
+            if (Json->TryGetStringField(TEXT("parameterName"), ParameterName) && !ParameterName.IsEmpty())
+            {
+                if (Expression->HasAParameterName())
+                {
+                    Expression->SetParameterName(FName(*ParameterName));
+                }
+                else
+                {
+                    Warnings.Add(FString::Printf(TEXT("%s: %s has no parameter name"), *Node.Key, *Node.Class->GetName()));
+                }
+            }
+
+            FString Group;
+            if (Json->TryGetStringField(TEXT("group"), Group))
+            {
+                if (UMaterialExpressionParameter* Parameter = Cast<UMaterialExpressionParameter>(Expression))
+                {
+                    Parameter->Group = FName(*Group);
+                }
+                else if (UMaterialExpressionTextureSampleParameter* TextureParameter = Cast<UMaterialExpressionTextureSampleParameter>(Expression))
+                {
+                    TextureParameter->Group = FName(*Group);
+                }
+            }
+
+            const TSharedPtr<FJsonValue> DefaultValue = Json->TryGetField(TEXT("defaultValue"));
+            if (DefaultValue.IsValid())
+            {
+                FLinearColor Color;
+                if (UMaterialExpressionScalarParameter* Scalar = Cast<UMaterialExpressionScalarParameter>(Expression))
+                {
+                    Scalar->DefaultValue = DefaultValue->AsNumber();
+                }
+                else if (UMaterialExpressionVectorParameter* Vector = Cast<UMaterialExpressionVectorParameter>(Expression))
+                {
+                    if (ReadColor(DefaultValue, Color))
+                    {
+                        Vector->DefaultValue = Color;
+                    }
+                }
+                else if (UMaterialExpressionStaticBoolParameter* Switch = Cast<UMaterialExpressionStaticBoolParameter>(Expression))
+                {
+                    Switch->DefaultValue = DefaultValue->AsBool();
+                }
+                else if (UMaterialExpressionConstant* Constant = Cast<UMaterialExpressionConstant>(Expression))
+                {
+                    Constant->R = DefaultValue->AsNumber();
+                }
+                else if (UMaterialExpressionConstant2Vector* Constant2 = Cast<UMaterialExpressionConstant2Vector>(Expression))
+                {
+                    if (ReadColor(DefaultValue, Color))
+                    {
+                        Constant2->R = Color.R;
+                        Constant2->G = Color.G;
+                    }
+                }
+                else if (UMaterialExpressionConstant3Vector* Constant3 = Cast<UMaterialExpressionConstant3Vector>(Expression))
+                {
+                    if (ReadColor(DefaultValue, Color))
+                    {
+                        Constant3->Constant = Color;
+                    }
+                }
+                else if (UMaterialExpressionConstant4Vector* Constant4 = Cast<UMaterialExpressionConstant4Vector>(Expression))
+                {
+                    if (ReadColor(DefaultValue, Color))
+                    {
+                        Constant4->Constant = Color;
+                    }
+                }
+                else
+                {
+                    FProperty* Property = Expression->GetClass()->FindPropertyByName(TEXT("DefaultValue"));
+                    FString Error;
+                    if (!Property || !ApplyJsonValueToProperty(Expression, Property, DefaultValue, Error))
+                    {
+                        Warnings.Add(FString::Printf(TEXT("%s: defaultValue not applied to %s%s%s"), *Node.Key,
+                            *Node.Class->GetName(), Error.IsEmpty() ? TEXT("") : TEXT(": "), *Error));
+                    }
+                }
+            }
+
+            FString TexturePath;
+            if (Json->TryGetStringField(TEXT("texture"), TexturePath) && !TexturePath.IsEmpty())
+            {
+                UMaterialExpressionTextureBase* TextureExpression = Cast<UMaterialExpressionTextureBase>(Expression);
+                const FString SafePath = SanitizeProjectRelativePath(TexturePath);
+                UTexture* Texture = SafePath.IsEmpty() ? nullptr : LoadObject<UTexture>(nullptr, *SafePath);
+                if (!TextureExpression)
+                {
+                    Warnings.Add(FString::Printf(TEXT("%s: %s does not take a texture"), *Node.Key, *Node.Class->GetName()));
+                }
+                else if (!Texture)
+                {
+                    Warnings.Add(FString::Printf(TEXT("%s: texture '%s' not found"), *Node.Key, *TexturePath));
+                }
+                else
+                {
+                    TextureExpression->Texture = Texture;
+                    TextureExpression->AutoSetSampleType();
+                }
+            }
+
+            FString FunctionPath;
+            if (Json->TryGetStringField(TEXT("function"), FunctionPath) && !FunctionPath.IsEmpty())
+            {
+                UMaterialExpressionMaterialFunctionCall* Call = Cast<UMaterialExpressionMaterialFunctionCall>(Expression);
+                const FString SafePath = SanitizeProjectRelativePath(FunctionPath);
+                UMaterialFunctionInterface* Function = SafePath.IsEmpty() ? nullptr : LoadObject<UMaterialFunctionInterface>(nullptr, *SafePath);
+                if (!Call)
+                {
+                    Warnings.Add(FString::Printf(TEXT("%s: %s does not call a function"), *Node.Key, *Node.Class->GetName()));
+                }
+                else if (!Function)
+                {
+                    Warnings.Add(FString::Printf(TEXT("%s: material function '%s' not found"), *Node.Key, *FunctionPath));
+                }
+                else if (Call->MaterialFunction != Function)
+                {
+                    Call->SetMaterialFunction(Function);
+                }
+            }
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (Json->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+                {
+                    FProperty* Property = Expression->GetClass()->FindPropertyByName(FName(*Pair.Key));
+                    FString Error;
+                    if (!Property)
+                    {
+                        Warnings.Add(FString::Printf(TEXT("%s: %s has no property '%s'"), *Node.Key,
+                            *Node.Class->GetName(), *Pair.Key));
+                    }
+                    else if (!ApplyJsonValueToProperty(Expression, Property, Pair.Value, Error))
+                    {
+                        Warnings.Add(FString::Printf(TEXT("%s.%s: %s"), *Node.Key, *Pair.Key, *Error));
+                    }
+                }
+            }
+        }
+#endif // WITH_EDITOR
+
+        // ---------------------------------------------------------------------
+        // Benchmark
+        // ---------------------------------------------------------------------
+
+        TSharedPtr<FJsonObject> MakeNode(const FString& Key, const FString& Type, double X, double Y)
+        {
+            TSharedPtr<FJsonObject> Node = MakeShared<FJsonObject>();
+            Node->SetStringField(TEXT("key"), Key);
+            Node->SetStringField(TEXT("type"), Type);
+            Node->SetNumberField(TEXT("x"), X);
+            Node->SetNumberField(TEXT("y"), Y);
+            return Node;
+        }
+
+        TSharedPtr<FJsonValue> MakeEdge(const FString& From, const FString& To, const FString& Input)
+        {
+            TSharedPtr<FJsonObject> Edge = MakeShared<FJsonObject>();
+            Edge->SetStringField(TEXT("from"), From);
+            Edge->SetStringField(TEXT("to"), To);
+            Edge->SetStringField(TEXT("input"), Input);
+            return MakeShared<FJsonValueObject>(Edge);
+        }
+
+        /**
+         * A tint multiplied by a chain of scalar parameters into BaseColor, a
+         * salted constant added at the end (forces a shader map miss in the
+         * DDC), and roughness/metallic/specular parameters.
+         */
+        TSharedPtr<FJsonObject> MakeBenchmarkSpec(int32 NodeCount, double Salt)
+        {
+            TArray<TSharedPtr<FJsonValue>> Nodes;
+            TArray<TSharedPtr<FJsonValue>> Edges;
+            auto AddNode = [&Nodes](const TSharedPtr<FJsonObject>& Node)
+            {
+                Nodes.Add(MakeShared<FJsonValueObject>(Node));
+            };
+
+            TSharedPtr<FJsonObject> Tint = MakeNode(TEXT("Tint"), TEXT("VectorParameter"), -3000, 0);
+            Tint->SetStringField(TEXT("parameterName"), TEXT("Tint"));
+            AddNode(Tint);
+
+            constexpr int32 FixedNodes = 6;
+            const int32 Pairs = (NodeCount - FixedNodes) / 2;
+            FString Previous = TEXT("Tint");
+            for (int32 Index = 0; Index < Pairs; ++Index)
+            {
+                const FString ScaleKey = FString::Printf(TEXT("Scale_%d"), Index);
+                const FString MultiplyKey = FString::Printf(TEXT("Multiply_%d"), Index);
+                TSharedPtr<FJsonObject> Scale = MakeNode(ScaleKey, TEXT("ScalarParameter"), -2800 + 50 * Index, 200 + 100 * (Index % 10));
+                Scale->SetStringField(TEXT("parameterName"), ScaleKey);
+                Scale->SetNumberField(TEXT("defaultValue"), 1.0);
+                AddNode(Scale);
+                AddNode(MakeNode(MultiplyKey, TEXT("Multiply"), -2700 + 50 * Index, 0));
+                Edges.Add(MakeEdge(Previous, MultiplyKey, TEXT("A")));
+                Edges.Add(MakeEdge(ScaleKey, MultiplyKey, TEXT("B")));
+                Previous = MultiplyKey;
+            }
+
+            TSharedPtr<FJsonObject> SaltNode = MakeNode(TEXT("Salt"), TEXT("Constant"), -400, 200);
+            SaltNode->SetNumberField(TEXT("defaultValue"), Salt);
+            AddNode(SaltNode);
+            AddNode(MakeNode(TEXT("SaltAdd"), TEXT("Add"), -250, 0));
+            Edges.Add(MakeEdge(Previous, TEXT("SaltAdd"), TEXT("A")));
+            Edges.Add(MakeEdge(TEXT("Salt"), TEXT("SaltAdd"), TEXT("B")));
+            Edges.Add(MakeEdge(TEXT("SaltAdd"), MAIN_NODE_KEY, TEXT("BaseColor")));
+
+            TSharedPtr<FJsonObject> Rough = MakeNode(TEXT("Rough"), TEXT("ScalarParameter"), -500, 400);
+            Rough->SetStringField(TEXT("parameterName"), TEXT("Smoothness"));
+            AddNode(Rough);
+            AddNode(MakeNode(TEXT("RoughInvert"), TEXT("OneMinus"), -250, 400));
+            Edges.Add(MakeEdge(TEXT("Rough"), TEXT("RoughInvert"), TEXT("Input")));
+            Edges.Add(MakeEdge(TEXT("RoughInvert"), MAIN_NODE_KEY, TEXT("Roughness")));
+
+            TSharedPtr<FJsonObject> Metal = MakeNode(TEXT("Metal"), TEXT("ScalarParameter"), -250, 550);
+            Metal->SetStringField(TEXT("parameterName"), TEXT("Metallic"));
+            AddNode(Metal);
+            Edges.Add(MakeEdge(TEXT("Metal"), MAIN_NODE_KEY, TEXT("Metallic")));
+
+            if ((NodeCount - FixedNodes) % 2 != 0)
+            {
+                TSharedPtr<FJsonObject> Specular = MakeNode(TEXT("Spec"), TEXT("ScalarParameter"), -250, 700);
+                Specular->SetStringField(TEXT("parameterName"), TEXT("Specular"));
+                AddNode(Specular);
+                Edges.Add(MakeEdge(TEXT("Spec"), MAIN_NODE_KEY, TEXT("Specular")));
+            }
+
+            TSharedPtr<FJsonObject> Spec = MakeShared<FJsonObject>();
+            Spec->SetArrayField(TEXT("nodes"), Nodes);
+            Spec->SetArrayField(TEXT("edges"), Edges);
+            return Spec;
+        }
+
+        struct FPhaseResult
+        {
+            int32 Requests = 0;
+            int32 Compiles = 0;
+            double AuthoringSeconds = 0.0;
+            double ShaderWaitSeconds = 0.0;
+            int32 PeakShaderJobs = 0;
+            int32 CompileErrors = 0;
+            bool bFinished = false;
+
+            TSharedPtr<FJsonObject> ToJson() const
+            {
+                TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+                Json->SetNumberField(TEXT("requests"), Requests);
+                Json->SetNumberField(TEXT("compiles"), Compiles);
+                Json->SetNumberField(TEXT("authoringMs"), AuthoringSeconds * 1000.0);
+                Json->SetNumberField(TEXT("shaderWaitMs"), ShaderWaitSeconds * 1000.0);
+                Json->SetNumberField(TEXT("totalMs"), (AuthoringSeconds + ShaderWaitSeconds) * 1000.0);
+                Json->SetNumberField(TEXT("peakShaderJobs"), PeakShaderJobs);
+                Json->SetNumberField(TEXT("compileErrors"), CompileErrors);
+                Json->SetBoolField(TEXT("shadersFinished"), bFinished);
+                return Json;
+            }
+        };
+
+        struct FBenchmarkRun
+        {
+            int32 NodeCount = 0;
+            int32 EdgeCount = 0;
+            double TimeoutSeconds = 0.0;
+            double StartSeconds = 0.0;
+            FProgressSink OnProgress;
+            FCompletionSink OnComplete;
+            TArray<TStrongObjectPtr<UMaterial>> Materials;
+            FPhaseResult Batched;
+            FPhaseResult Incremental;
+        };
+
+        void FinishBenchmark(const TSharedPtr<FBenchmarkRun>& Run, bool bSuccess, const FString& Message, const FString& ErrorCode)
+        {
+            GetState().Benchmark.Reset();
+
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetNumberField(TEXT("nodeCount"), Run->NodeCount);
+            Result->SetNumberField(TEXT("edgeCount"), Run->EdgeCount);
+            Result->SetObjectField(TEXT("batched"), Run->Batched.ToJson());
+            Result->SetObjectField(TEXT("incremental"), Run->Incremental.ToJson());
+            const double BatchedTotal = Run->Batched.AuthoringSeconds + Run->Batched.ShaderWaitSeconds;
+            const double IncrementalTotal = Run->Incremental.AuthoringSeconds + Run->Incremental.ShaderWaitSeconds;
+            if (bSuccess && BatchedTotal > 0.0)
+            {
+                Result->SetNumberField(TEXT("speedup"), IncrementalTotal / BatchedTotal);
+            }
+            Result->SetNumberField(TEXT("benchmarkMs"), (FPlatformTime::Seconds() - Run->StartSeconds) * 1000.0);
+
+            Run->Materials.Reset();
+
+            if (Run->OnComplete)
+            {
+                Run->OnComplete(bSuccess, Message, Result, ErrorCode);
+            }
+        }
+
+        void RunPhase(const TSharedPtr<FBenchmarkRun>& Run, bool bBatched);
+    }
+
+    // =========================================================================
+    // Result
+    // =========================================================================
+
+    TSharedPtr<FJsonObject> FApplyResult::ToJson() const
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetNumberField(TEXT("created"), Created);
+        Json->SetNumberField(TEXT("updated"), Updated);
+        Json->SetNumberField(TEXT("replaced"), Replaced);
+        Json->SetNumberField(TEXT("deleted"), Deleted);
+        Json->SetNumberField(TEXT("connected"), Connected);
+        Json->SetNumberField(TEXT("disconnected"), Disconnected);
+        Json->SetNumberField(TEXT("materialPropertiesSet"), MaterialPropertiesSet);
+        Json->SetBoolField(TEXT("compiled"), bCompiled);
+        Json->SetNumberField(TEXT("applyMs"), ApplySeconds * 1000.0);
+        Json->SetObjectField(TEXT("nodeIds"), NodeIds.IsValid() ? NodeIds : MakeShared<FJsonObject>());
+
+        TArray<TSharedPtr<FJsonValue>> WarningValues;
+        for (const FString& Warning : Warnings)
+        {
+            WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+        }
+        Json->SetArrayField(TEXT("warnings"), WarningValues);
+        return Json;
+    }
+
+    // =========================================================================
+    // Text form
+    // =========================================================================
+
+    bool ParseText(const FString& Text, TSharedPtr<FJsonObject>& OutSpec, FString& OutError)
+    {
+        TArray<FString> Lines;
+        Text.ParseIntoArrayLines(Lines, false);
+
+        TArray<TSharedPtr<FJsonValue>> Nodes;
+        TArray<TSharedPtr<FJsonValue>> Parameters;
+        TArray<TSharedPtr<FJsonValue>> Edges;
+        TSharedPtr<FJsonObject> MaterialProperties = MakeShared<FJsonObject>();
+        OutSpec = MakeShared<FJsonObject>();
+
+        for (int32 LineIndex = 0; LineIndex < Lines.Num(); ++LineIndex)
+        {
+            FString Line = Lines[LineIndex];
+            int32 CommentStart = INDEX_NONE;
+            if (Line.FindChar(TEXT('#'), CommentStart))
+            {
+                Line.LeftInline(CommentStart);
+            }
+            const TArray<FString> Tokens = Tokenize(Line);
+            if (Tokens.Num() == 0)
+            {
+                continue;
+            }
+
+            FString Error;
+            const FString& Statement = Tokens[0];
+            if (Statement == TEXT("node") || Statement == TEXT("param"))
+            {
+                if (Tokens.Num() < 3)
+                {
+                    Error = FString::Printf(TEXT("'%s' needs a key and a type"), *Statement);
+                }
+                else
+                {
+                    TSharedPtr<FJsonObject> Node = MakeShared<FJsonObject>();
+                    Node->SetStringField(Statement == TEXT("node") ? TEXT("key") : TEXT("name"), Tokens[1]);
+                    Node->SetStringField(TEXT("type"), Tokens[2]);
+                    if (ParseAssignments(Tokens, 3, Node, Statement == TEXT("node"), Error))
+                    {
+                        (Statement == TEXT("node") ? Nodes : Parameters).Add(MakeShared<FJsonValueObject>(Node));
+                    }
+                }
+            }
+            else if (Statement == TEXT("edge"))
+            {
+                if (Tokens.Num() != 4 || Tokens[2] != TEXT("->"))
+                {
+                    Error = TEXT("expected 'edge <from>[.<output>] -> <to>.<input>'");
+                }
+                else
+                {
+                    FString From, Output, To, Input;
+                    SplitEndpoint(Tokens[1], From, Output);
+                    SplitEndpoint(Tokens[3], To, Input);
+                    TSharedPtr<FJsonObject> Edge = MakeShared<FJsonObject>();
+                    Edge->SetStringField(TEXT("from"), From);
+                    if (!Output.IsEmpty())
+                    {
+                        Edge->SetStringField(TEXT("output"), Output);
+                    }
+                    Edge->SetStringField(TEXT("to"), To);
+                    Edge->SetStringField(TEXT("input"), Input);
+                    Edges.Add(MakeShared<FJsonValueObject>(Edge));
+                }
+            }
+            else if (Statement == TEXT("set"))
+            {
+                FString Field, Value;
+                if (Tokens.Num() != 2 || !Tokens[1].Split(TEXT("="), &Field, &Value) || Field.IsEmpty())
+                {
+                    Error = TEXT("expected 'set <Property>=<value>'");
+                }
+                else
+                {
+                    MaterialProperties->SetField(Field, ParseTextValue(Value));
+                }
+            }
+            else if (Statement == TEXT("prune"))
+            {
+                if (Tokens.Num() != 2)
+                {
+                    Error = TEXT("expected 'prune <true|false>'");
+                }
+                else
+                {
+                    OutSpec->SetBoolField(TEXT("prune"), Tokens[1].ToBool());
+                }
+            }
+            else
+            {
+                Error = FString::Printf(TEXT("unknown statement '%s'"), *Statement);
+            }
+
+            if (!Error.IsEmpty())
+            {
+                OutError = FString::Printf(TEXT("line %d: %s"), LineIndex + 1, *Error);
+                OutSpec.Reset();
+                return false;
+            }
+        }
+
+        OutSpec->SetArrayField(TEXT("nodes"), Nodes);
+        OutSpec->SetArrayField(TEXT("parameters"), Parameters);
+        OutSpec->SetArrayField(TEXT("edges"), Edges);
+        if (MaterialProperties->Values.Num() > 0)
+        {
+            OutSpec->SetObjectField(TEXT("materialProperties"), MaterialProperties);
+        }
+        return true;
+    }
+
+    // =========================================================================
+    // Apply
+    // =========================================================================
+
+    bool Apply(UMaterial* Material, const TSharedPtr<FJsonObject>& Spec, FApplyResult& OutResult,
+               FString& OutError, FString& OutErrorCode)
+    {
+#if WITH_EDITOR
+        const double StartSeconds = FPlatformTime::Seconds();
+        OutResult = FApplyResult();
+        OutResult.NodeIds = MakeShared<FJsonObject>();
+        OutErrorCode = TEXT("INVALID_SPEC");
+
+        if (!Material || !Spec.IsValid())
+        {
+            OutError = TEXT("Missing material or spec");
+            return false;
+        }
+#if WITH_EDITORONLY_DATA && ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+        if (!Material->GetEditorOnlyData())
+        {
+            OutError = TEXT("Material has no editor-only data");
+            OutErrorCode = TEXT("NOT_SUPPORTED");
+            return false;
+        }
+#endif
+
+        bool bPrune = false;
+        Spec->TryGetBoolField(TEXT("prune"), bPrune);
+
+        // ---- Normalize and validate, before anything is modified -------------
+        TArray<FNodeSpec> Nodes;
+        TMap<FString, int32> NodeByKey;
+        auto AddNodeSpec = [&](const TSharedPtr<FJsonObject>& Json) -> bool
+        {
+            FNodeSpec Node;
+            Node.Json = Json;
+            FString Type;
+            Json->TryGetStringField(TEXT("key"), Node.Key);
+            Json->TryGetStringField(TEXT("type"), Type);
+            if (Node.Key.IsEmpty() || Type.IsEmpty())
+            {
+                OutError = TEXT("Every node needs a 'key' and a 'type'");
+                return false;
+            }
+            if (Node.Key.Equals(MAIN_NODE_KEY, ESearchCase::IgnoreCase))
+            {
+                OutError = TEXT("'Main' is reserved for the material's main node");
+                return false;
+            }
+            if (NodeByKey.Contains(Node.Key))
+            {
+                OutError = FString::Printf(TEXT("Duplicate node key '%s'"), *Node.Key);
+                return false;
+            }
+            Node.Class = ResolveExpressionClass(Type);
+            if (!Node.Class)
+            {
+                OutError = FString::Printf(TEXT("Node '%s': unknown expression type '%s'"), *Node.Key, *Type);
+                OutErrorCode = TEXT("UNKNOWN_TYPE");
+                return false;
+            }
+            Node.ObjectName = ToObjectName(Node.Key);
+            NodeByKey.Add(Node.Key, Nodes.Add(MoveTemp(Node)));
+            return true;
+        };
+
+        const TArray<TSharedPtr<FJsonValue>>* NodeValues = nullptr;
+        if (Spec->TryGetArrayField(TEXT("nodes"), NodeValues))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *NodeValues)
+            {
+                const TSharedPtr<FJsonObject>* Json = nullptr;
+                if (!Value.IsValid() || !Value->TryGetObject(Json))
+                {
+                    OutError = TEXT("'nodes' must be an array of objects");
+                    return false;
+                }
+                if (!AddNodeSpec(*Json))
+                {
+                    return false;
+                }
+            }
+        }
+        const TArray<TSharedPtr<FJsonValue>>* ParameterValues = nullptr;
+        if (Spec->TryGetArrayField(TEXT("parameters"), ParameterValues))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *ParameterValues)
+            {
+                const TSharedPtr<FJsonObject>* Json = nullptr;
+                if (!Value.IsValid() || !Value->TryGetObject(Json))
+                {
+                    OutError = TEXT("'parameters' must be an array of objects");
+                    return false;
+                }
+                TSharedPtr<FJsonObject> Node = ParameterToNode(*Json, OutError);
+                if (!Node.IsValid() || !AddNodeSpec(Node))
+                {
+                    return false;
+                }
+            }
+        }
+
+        FExpressionIndex Index;
+        Index.Build(*Material);
+
+        TArray<FEdgeSpec> Edges;
+        const TArray<TSharedPtr<FJsonValue>>* EdgeValues = nullptr;
+        if (Spec->TryGetArrayField(TEXT("edges"), EdgeValues))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *EdgeValues)
+            {
+                const TSharedPtr<FJsonObject>* Json = nullptr;
+                FEdgeSpec Edge;
+                if (!Value.IsValid() || !Value->TryGetObject(Json))
+                {
+                    OutError = TEXT("'edges' must be an array of objects");
+                    return false;
+                }
+                if (!ReadEdge(*Json, Edge, OutError))
+                {
+                    return false;
+                }
+                // Endpoints outside the spec must exist and survive the prune
+                for (const FString* Endpoint : {&Edge.From, &Edge.To})
+                {
+                    if (Endpoint == &Edge.To && Edge.To.Equals(MAIN_NODE_KEY, ESearchCase::IgnoreCase))
+                    {
+                        continue;
+                    }
+                    if (!NodeByKey.Contains(*Endpoint) && (bPrune || !Index.Find(*Endpoint)))
+                    {
+                        OutError = FString::Printf(TEXT("Edge endpoint '%s' is not a node of the spec%s"), **Endpoint,
+                            bPrune ? TEXT(" (nodes outside the spec are pruned)") : TEXT(" or the material"));
+                        return false;
+                    }
+                }
+                if (Edge.To.Equals(MAIN_NODE_KEY, ESearchCase::IgnoreCase) && !FindMainInput(*Material, Edge.Input))
+                {
+                    OutError = FString::Printf(TEXT("Unknown main material input '%s'"), *Edge.Input);
+                    OutErrorCode = TEXT("INVALID_PIN");
+                    return false;
+                }
+                Edges.Add(MoveTemp(Edge));
+            }
+        }
+
+        const TSharedPtr<FJsonObject>* MaterialProperties = nullptr;
+        Spec->TryGetObjectField(TEXT("materialProperties"), MaterialProperties);
+        if (MaterialProperties)
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*MaterialProperties)->Values)
+            {
+                if (!UMaterial::StaticClass()->FindPropertyByName(FName(*Pair.Key)))
+                {
+                    OutError = FString::Printf(TEXT("Material has no property '%s'"), *Pair.Key);
+                    return false;
+                }
+            }
+        }
+
+        // ---- Apply in one transaction --------------------------------------
+        const FScopedTransaction Transaction(FText::FromString(TEXT("Apply Material Graph")));
+        Material->Modify();
+        OutErrorCode.Reset();
+
+        if (MaterialProperties)
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*MaterialProperties)->Values)
+            {
+                FString Error;
+                if (ApplyJsonValueToProperty(Material, UMaterial::StaticClass()->FindPropertyByName(FName(*Pair.Key)),
+                                             Pair.Value, Error))
+                {
+                    ++OutResult.MaterialPropertiesSet;
+                }
+                else
+                {
+                    OutResult.Warnings.Add(FString::Printf(TEXT("Material.%s: %s"), *Pair.Key, *Error));
+                }
+            }
+        }
+
+        // Match spec nodes to expressions: object name, GUID, then parameter name
+        TSet<UMaterialExpression*> Claimed;
+        TArray<UMaterialExpression*> Removed;
+        for (FNodeSpec& Node : Nodes)
+        {
+            UMaterialExpression* Existing = Index.Find(Node.Key);
+            if (!Existing)
+            {
+                FString ParameterName;
+                if (Node.Json->TryGetStringField(TEXT("parameterName"), ParameterName))
+                {
+                    UMaterialExpression* const* ByParameter = Index.ByParameter.Find(FName(*ParameterName));
+                    Existing = ByParameter ? *ByParameter : nullptr;
+                }
+            }
+            if (Existing && Claimed.Contains(Existing))
+            {
+                Existing = nullptr;
+            }
+            if (Existing && Existing->GetClass() == Node.Class)
+            {
+                Existing->Modify();
+                Node.Expression = Existing;
+                Claimed.Add(Existing);
+                ++OutResult.Updated;
+            }
+            else if (Existing)
+            {
+                // Class changed: the old expression goes, a new one takes the key
+                Removed.Add(Existing);
+                Claimed.Add(Existing);
+                ++OutResult.Replaced;
+            }
+        }
+
+        // Expressions the spec does not mention
+        if (bPrune)
+        {
+            for (UMaterialExpression* Expression : MCP_GET_MATERIAL_EXPRESSIONS(Material))
+            {
+                if (Expression && !Claimed.Contains(Expression) && !Expression->IsA<UMaterialExpressionComment>())
+                {
+                    Removed.Add(Expression);
+                    ++OutResult.Deleted;
+                }
+            }
+        }
+        TSet<UMaterialExpression*> RemovedSet(Removed);
+        for (UMaterialExpression* Expression : Removed)
+        {
+            Expression->Modify();
+            RemoveExpression(*Material, Expression);
+        }
+
+        // Create the missing nodes under their key
+        for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+        {
+            FNodeSpec& Node = Nodes[NodeIndex];
+            if (Node.Expression)
+            {
+                continue;
+            }
+
+            FName ObjectName(*Node.ObjectName);
+            if (UObject* Taken = StaticFindObjectFast(UObject::StaticClass(), Material, ObjectName))
+            {
+                UMaterialExpression* TakenExpression = Cast<UMaterialExpression>(Taken);
+                if (TakenExpression && RemovedSet.Contains(TakenExpression))
+                {
+                    Taken->Rename(nullptr, Material, REN_DontCreateRedirectors);
+                }
+                else
+                {
+                    ObjectName = MakeUniqueObjectName(Material, Node.Class, ObjectName);
+                    OutResult.Warnings.Add(FString::Printf(TEXT("%s: name in use, created as %s"),
+                        *Node.Key, *ObjectName.ToString()));
+                }
+            }
+
+            Node.Expression = NewObject<UMaterialExpression>(Material, Node.Class, ObjectName, RF_Transactional);
+            Node.bCreated = true;
+            AddExpression(*Material, Node.Expression);
+            ++OutResult.Created;
+        }
+
+        for (int32 NodeIndex = 0; NodeIndex < Nodes.Num(); ++NodeIndex)
+        {
+            ApplyNodeFields(Nodes[NodeIndex], NodeIndex, OutResult.Warnings);
+        }
+
+        // Edges
+        auto ResolveEndpoint = [&](const FString& Key) -> UMaterialExpression*
+        {
+            if (const int32* NodeIndex = NodeByKey.Find(Key))
+            {
+                return Nodes[*NodeIndex].Expression;
+            }
+            UMaterialExpression* Found = Index.Find(Key);
+            return RemovedSet.Contains(Found) ? nullptr : Found;
+        };
+
+        TSet<FExpressionInput*> Touched;
+        for (const FEdgeSpec& Edge : Edges)
+        {
+            UMaterialExpression* Source = ResolveEndpoint(Edge.From);
+            const bool bToMain = Edge.To.Equals(MAIN_NODE_KEY, ESearchCase::IgnoreCase);
+            UMaterialExpression* Target = bToMain ? nullptr : ResolveEndpoint(Edge.To);
+            if (!Source || (!bToMain && !Target))
+            {
+                OutResult.Warnings.Add(FString::Printf(TEXT("Edge %s -> %s: endpoint was replaced"), *Edge.From, *Edge.To));
+                continue;
+            }
+
+            FExpressionInput* Input = bToMain ? FindMainInput(*Material, Edge.Input) : FindExpressionInput(*Target, Edge.Input);
+            if (!Input)
+            {
+                OutResult.Warnings.Add(FString::Printf(TEXT("Edge %s -> %s: %s has no input '%s'"), *Edge.From, *Edge.To,
+                    *Target->GetClass()->GetName(), *Edge.Input));
+                continue;
+            }
+            const int32 OutputIndex = ResolveOutputIndex(*Source, Edge.Output);
+            if (OutputIndex == INDEX_NONE)
+            {
+                OutResult.Warnings.Add(FString::Printf(TEXT("Edge %s -> %s: %s has no output '%s'"), *Edge.From, *Edge.To,
+                    *Source->GetClass()->GetName(), *Edge.Output));
+                continue;
+            }
+
+            Touched.Add(Input);
+            if (Input->Expression != Source || Input->OutputIndex != OutputIndex)
+            {
+                if (Target && !NodeByKey.Contains(Edge.To))
+                {
+                    Target->Modify();
+                }
+                Input->Connect(OutputIndex, Source);
+                ++OutResult.Connected;
+            }
+        }
+
+        // Inputs the spec leaves unconnected, and links into removed expressions
+        auto ClearInput = [&](UObject* Owner, FExpressionInput& Input, bool bUntouchedClears)
+        {
+            if (!Input.Expression)
+            {
+                return;
+            }
+            const bool bDangling = RemovedSet.Contains(Input.Expression);
+            if (bDangling || (bUntouchedClears && !Touched.Contains(&Input)))
+            {
+                Owner->Modify();
+                Input.Expression = nullptr;
+                ++OutResult.Disconnected;
+            }
+        };
+
+        TSet<UMaterialExpression*> SpecExpressions;
+        for (const FNodeSpec& Node : Nodes)
+        {
+            SpecExpressions.Add(Node.Expression);
+        }
+        for (UMaterialExpression* Expression : MCP_GET_MATERIAL_EXPRESSIONS(Material))
+        {
+            if (Expression)
+            {
+                const bool bSpecNode = SpecExpressions.Contains(Expression);
+                ForEachInput(*Expression, [&](FExpressionInput& Input) { ClearInput(Expression, Input, bPrune && bSpecNode); });
+            }
+        }
+        for (const TCHAR* MainInputName : MAIN_INPUT_NAMES)
+        {
+            if (FExpressionInput* Input = FindMainInput(*Material, MainInputName))
+            {
+                ClearInput(Material, *Input, bPrune);
+            }
+        }
+
+        for (const FNodeSpec& Node : Nodes)
+        {
+            TSharedPtr<FJsonObject> Id = MakeShared<FJsonObject>();
+            Id->SetStringField(TEXT("nodeId"), Node.Expression->MaterialExpressionGuid.ToString());
+            Id->SetStringField(TEXT("name"), Node.Expression->GetName());
+            Id->SetStringField(TEXT("class"), Node.Class->GetName());
+            Id->SetBoolField(TEXT("created"), Node.bCreated);
+            OutResult.NodeIds->SetObjectField(Node.Key, Id);
+        }
+
+        // One compile for the whole spec (deferred while an edit session is open)
+        OutResult.bCompiled = !McpMaterialEditSession::NotifyEdited(Material);
+        OutResult.ApplySeconds = FPlatformTime::Seconds() - StartSeconds;
+        return true;
+#else
+        OutError = TEXT("apply_material_graph requires the editor");
+        OutErrorCode = TEXT("EDITOR_ONLY");
+        return false;
+#endif
+    }
+
+    // =========================================================================
+    // Benchmark
+    // =========================================================================
+
+    namespace
+    {
+        /** Build the spec on a fresh transient material, then wait for its shaders. */
+        void RunPhase(const TSharedPtr<FBenchmarkRun>& Run, bool bBatched)
+        {
+            FPhaseResult& Phase = bBatched ? Run->Batched : Run->Incremental;
+            const FString Label = bBatched ? TEXT("batched") : TEXT("incremental");
+
+            UPackage* Package = GetTransientPackage();
+            UMaterial* Material = NewObject<UMaterial>(Package,
+                MakeUniqueObjectName(Package, UMaterial::StaticClass(), TEXT("MCP_MaterialGraphBenchmark")), RF_Transient);
+            Run->Materials.Emplace(Material);
+
+            const TSharedPtr<FJsonObject> Spec = MakeBenchmarkSpec(Run->NodeCount, FMath::FRand() * 1000.0 + Run->Materials.Num());
+            const TArray<TSharedPtr<FJsonValue>>& Nodes = Spec->GetArrayField(TEXT("nodes"));
+            const TArray<TSharedPtr<FJsonValue>>& Edges = Spec->GetArrayField(TEXT("edges"));
+            Run->EdgeCount = Edges.Num();
+
+            FString Error, ErrorCode;
+            FApplyResult Applied;
+            auto ApplyOne = [&](const TSharedPtr<FJsonObject>& PartSpec) -> bool
+            {
+                ++Phase.Requests;
+                if (!Apply(Material, PartSpec, Applied, Error, ErrorCode))
+                {
+                    return false;
+                }
+                Phase.Compiles += Applied.bCompiled ? 1 : 0;
+                return true;
+            };
+
+            const double AuthoringStart = FPlatformTime::Seconds();
+            bool bOk = true;
+            if (bBatched)
+            {
+                bOk = ApplyOne(Spec);
+            }
+            else
+            {
+                // One request per node and per edge, as add_* / connect_nodes would send
+                for (int32 Index = 0; bOk && Index < Nodes.Num() + Edges.Num(); ++Index)
+                {
+                    TSharedPtr<FJsonObject> PartSpec = MakeShared<FJsonObject>();
+                    PartSpec->SetBoolField(TEXT("prune"), false);
+                    PartSpec->SetArrayField(Index < Nodes.Num() ? TEXT("nodes") : TEXT("edges"),
+                        TArray<TSharedPtr<FJsonValue>>{Index < Nodes.Num() ? Nodes[Index] : Edges[Index - Nodes.Num()]});
+                    bOk = ApplyOne(PartSpec);
+                }
+            }
+            Phase.AuthoringSeconds = FPlatformTime::Seconds() - AuthoringStart;
+            if (!bOk)
+            {
+                FinishBenchmark(Run, false, FString::Printf(TEXT("Benchmark %s build failed: %s"), *Label, *Error), ErrorCode);
+                return;
+            }
+
+            if (Run->OnProgress)
+            {
+                Run->OnProgress(bBatched ? 10.0f : 55.0f, FString::Printf(TEXT("%s build done in %.0f ms (%d compiles); waiting for shaders"),
+                    *Label, Phase.AuthoringSeconds * 1000.0, Phase.Compiles));
+            }
+
+            const double Remaining = FMath::Max(1.0, Run->TimeoutSeconds - (FPlatformTime::Seconds() - Run->StartSeconds));
+            const float ProgressBase = bBatched ? 10.0f : 55.0f;
+            McpMaterialEditSession::WaitForCompile(Material, Remaining,
+                [Run, ProgressBase, Label](float Percent, const FString& Message)
+                {
+                    if (Run->OnProgress)
+                    {
+                        Run->OnProgress(ProgressBase + Percent * 0.4f, Label + TEXT(": ") + Message);
+                    }
+                },
+                [Run, bBatched](const McpMaterialEditSession::FCompileResult& Compile)
+                {
+                    FPhaseResult& Done = bBatched ? Run->Batched : Run->Incremental;
+                    Done.ShaderWaitSeconds = Compile.CompileSeconds;
+                    Done.PeakShaderJobs = Compile.PeakShaderJobs;
+                    Done.CompileErrors = Compile.Errors.Num();
+                    Done.bFinished = Compile.bFinished;
+                    if (!Compile.bFinished)
+                    {
+                        FinishBenchmark(Run, false, TEXT("Benchmark shaders did not finish compiling in time"), TEXT("TIMEOUT"));
+                    }
+                    else if (bBatched)
+                    {
+                        // Batched first: the incremental run leaves superseded jobs behind
+                        RunPhase(Run, false);
+                    }
+                    else
+                    {
+                        FinishBenchmark(Run, true, FString::Printf(
+                            TEXT("%d-node material: incremental %.0f ms (%d compiles), batched %.0f ms (1 compile)"),
+                            Run->NodeCount,
+                            (Run->Incremental.AuthoringSeconds + Run->Incremental.ShaderWaitSeconds) * 1000.0,
+                            Run->Incremental.Compiles,
+                            (Run->Batched.AuthoringSeconds + Run->Batched.ShaderWaitSeconds) * 1000.0),
+                            FString());
+                    }
+                });
+        }
+    }
+
+    bool StartBenchmark(int32 NodeCount, double TimeoutSeconds, FProgressSink OnProgress,
+                        FCompletionSink OnComplete, FString& OutError)
+    {
+        FState& State = GetState();
+        if (State.Benchmark.IsValid())
+        {
+            OutError = TEXT("A material graph benchmark is already running");
+            return false;
+        }
+
+        TSharedPtr<FBenchmarkRun> Run = MakeShared<FBenchmarkRun>();
+        Run->NodeCount = FMath::Clamp(NodeCount, 10, 1000);
+        Run->TimeoutSeconds = TimeoutSeconds;
+        Run->StartSeconds = FPlatformTime::Seconds();
+        Run->OnProgress = MoveTemp(OnProgress);
+        Run->OnComplete = MoveTemp(OnComplete);
+        State.Benchmark = Run;
+
+        UE_LOG(LogMcpMaterialGraphSpec, Log, TEXT("Material graph benchmark: %d nodes"), Run->NodeCount);
+        RunPhase(Run, true);
+        return true;
+    }
+
+    bool IsBenchmarkRunning()
+    {
+        return GetState().Benchmark.IsValid();
+    }
+
+    void CancelBenchmark()
+    {
+        TSharedPtr<FBenchmarkRun> Run = MoveTemp(GetState().Benchmark);
+        if (Run.IsValid())
+        {
+            Run->OnProgress = nullptr;
+            Run->OnComplete = nullptr;
+            Run->Materials.Reset();
+        }
+    }
+}
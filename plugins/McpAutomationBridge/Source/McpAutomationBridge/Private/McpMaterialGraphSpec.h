@@ -0,0 +1,110 @@
+// =============================================================================
+// McpMaterialGraphSpec.h
+// =============================================================================
+// Declarative material graphs for manage_material_authoring apply_material_graph.
+//
+// A spec lists the nodes, parameters and edges of a material graph. Apply
+// diffs it against the material in one pass and one transaction:
+//
+//   - nodes are matched to expressions by key (object name, GUID, or the
+//     parameter name of a parameter node of the same class); matched nodes
+//     are updated in place, nodes whose class changed are replaced, new
+//     nodes are created with the key as their object name
+//   - the inputs of every spec node are set from the edges; with prune
+//     (off by default) inputs without an edge are cleared, and so are main
+//     material inputs without an edge
+//   - with prune, expressions the spec does not mention are deleted
+//     (comments are kept)
+//
+// Edits finish with one McpMaterialEditSession::NotifyEdited, so the whole
+// spec costs a single compile (or none while an edit session is open).
+//
+// JSON SPEC:
+//   {
+//     "nodes": [ { "key", "type", "x", "y", "parameterName", "group",
+//                  "defaultValue", "texture", "function", "properties": {} } ],
+//     "parameters": [ { "name", "type": scalar|vector|texture|switch,
+//                       "defaultValue", "group", "x", "y" } ],
+//     "edges": [ { "from", "output", "to", "input" } ],   // to "Main" = material
+//     "materialProperties": { "BlendMode": "BLEND_Masked", ... },
+//     "prune": false
+//   }
+//
+// TEXT SPEC (one statement per line, '#' starts a comment):
+//   node <key> <type> [field=value ...]      fields as above, others are properties
+//   param <name> <scalar|vector|texture|switch> [field=value ...]
+//   edge <from>[.<output>] -> <to>.<input>
+//   set <MaterialProperty>=<value>
+//   prune <true|false>
+// Values are numbers, true/false, comma-separated number lists, or strings
+// (double-quoted when they contain spaces).
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UMaterial;
+
+namespace McpMaterialGraphSpec
+{
+    struct FApplyResult
+    {
+        int32 Created = 0;
+        int32 Updated = 0;
+        int32 Replaced = 0;
+        int32 Deleted = 0;
+        int32 Connected = 0;
+        int32 Disconnected = 0;
+        int32 MaterialPropertiesSet = 0;
+
+        /** The material was recompiled (false when an edit session deferred it). */
+        bool bCompiled = false;
+
+        double ApplySeconds = 0.0;
+
+        /** Spec key -> { nodeId, name, class } of the expression it resolved to. */
+        TSharedPtr<FJsonObject> NodeIds;
+
+        /** Non-fatal problems: unknown properties, pins or outputs. */
+        TArray<FString> Warnings;
+
+        TSharedPtr<FJsonObject> ToJson() const;
+    };
+
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+    using FCompletionSink = TFunction<void(bool bSuccess, const FString& Message,
+                                           const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)>;
+
+    /** Parse the text form into the JSON form. False with OutError naming the line. */
+    bool ParseText(const FString& Text, TSharedPtr<FJsonObject>& OutSpec, FString& OutError);
+
+    /**
+     * Diff Spec against Material and apply it in one transaction with one
+     * compile. The spec is validated (node types, duplicate keys, edge
+     * endpoints) before anything changes; on failure nothing is modified and
+     * OutError / OutErrorCode describe the problem.
+     */
+    bool Apply(UMaterial* Material, const TSharedPtr<FJsonObject>& Spec, FApplyResult& OutResult,
+               FString& OutError, FString& OutErrorCode);
+
+    /**
+     * Build a NodeCount-node master material twice on transient materials:
+     * once with one apply per node and per edge (one compile each, as the
+     * incremental actions do) and once with a single apply. Each run waits
+     * for its shaders; the report has authoring, shader wait and total time.
+     */
+    bool StartBenchmark(int32 NodeCount, double TimeoutSeconds, FProgressSink OnProgress,
+                        FCompletionSink OnComplete, FString& OutError);
+
+    bool IsBenchmarkRunning();
+
+    /** Drop the benchmark and its transient materials (subsystem shutdown). Completion is not reported. */
+    void CancelBenchmark();
+}
@@ -0,0 +1,682 @@
+// =============================================================================
+// McpMemoryReport.cpp
+// =============================================================================
+// Implementation of structured memory snapshots and snapshot diffs.
+// =============================================================================
+
+#include "McpMemoryReport.h"
+#include "McpVersionCompatibility.h"
+#include "McpAutomationBridgeHelpers.h"
+
+#include "DynamicRHI.h"
+#include "Engine/Engine.h"
+#include "Engine/Texture.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/App.h"
+#include "Misc/DateTime.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "RHI.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/UObjectIterator.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+namespace McpMemoryReport
+{
+    namespace
+    {
+        constexpr int32 MAX_RECENT_SNAPSHOTS = 8;
+        constexpr int32 MAX_LARGEST_TEXTURES = 20;
+        constexpr double KB = 1024.0;
+        constexpr double MB = 1024.0 * 1024.0;
+
+        TArray<TSharedPtr<FJsonObject>>& GetRecent()
+        {
+            static TArray<TSharedPtr<FJsonObject>> Recent;
+            return Recent;
+        }
+
+        FString GetSnapshotDir()
+        {
+            return FPaths::ConvertRelativePathToFull(
+                FPaths::Combine(FPaths::ProfilingDir(), TEXT("MemReports"), TEXT("Mcp")));
+        }
+
+        double GetNumber(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field)
+        {
+            double Value = 0.0;
+            if (Object.IsValid())
+            {
+                Object->TryGetNumberField(Field, Value);
+            }
+            return Value;
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* GetArray(const TSharedPtr<FJsonObject>& Object, const TCHAR* Section,
+                                                       const TCHAR* Field)
+        {
+            const TSharedPtr<FJsonObject>* SectionObject = nullptr;
+            const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+            if (Object.IsValid() && Object->TryGetObjectField(Section, SectionObject) &&
+                (*SectionObject)->TryGetArrayField(Field, Array))
+            {
+                return Array;
+            }
+            return nullptr;
+        }
+
+        /** "ResExcDedSysKB" -> "resourceDedicatedSystemBytes"; unknown columns keep their name. */
+        FString ObjListColumnKey(const FString& Header)
+        {
+            static const TMap<FString, FString> KnownColumns = {
+                { TEXT("Count"), TEXT("count") },
+                { TEXT("NumKB"), TEXT("serializedBytes") },
+                { TEXT("MaxKB"), TEXT("serializedMaxBytes") },
+                { TEXT("ResExcKB"), TEXT("resourceBytes") },
+                { TEXT("ResExcDedSysKB"), TEXT("resourceDedicatedSystemBytes") },
+                { TEXT("ResExcDedVidKB"), TEXT("resourceDedicatedVideoBytes") },
+                { TEXT("ResExcUnkKB"), TEXT("resourceUnknownBytes") },
+            };
+            if (const FString* Known = KnownColumns.Find(Header))
+            {
+                return *Known;
+            }
+            FString Key = Header.EndsWith(TEXT("KB")) ? Header.LeftChop(2) + TEXT("Bytes") : Header;
+            if (Key.Len() > 0)
+            {
+                Key[0] = FChar::ToLower(Key[0]);
+            }
+            return Key;
+        }
+
+        /**
+         * Parse the class table printed by "obj list":
+         *
+         *      Class    Count      NumKB      MaxKB   ResExcKB ...
+         *   StaticMesh     1234    1234.56    2345.67    3456.78 ...
+         *   12345 Objects (Total: 123.456M / Max: ...)
+         */
+        TSharedPtr<FJsonObject> ParseObjList(const TArray<FString>& CapturedLines)
+        {
+            TArray<FString> Header;
+            TArray<bool> HeaderIsKB;
+            TArray<TSharedPtr<FJsonObject>> Classes;
+            int64 TotalObjects = 0;
+            double TotalSerialized = 0.0;
+            double TotalResource = 0.0;
+
+            TArray<FString> Lines;
+            for (const FString& Captured : CapturedLines)
+            {
+                TArray<FString> Split;
+                Captured.ParseIntoArrayLines(Split);
+                Lines.Append(MoveTemp(Split));
+            }
+
+            for (const FString& Line : Lines)
+            {
+                TArray<FString> Tokens;
+                Line.ParseIntoArrayWS(Tokens);
+                if (Tokens.Num() < 2)
+                {
+                    continue;
+                }
+
+                if (Header.Num() == 0)
+                {
+                    if (Tokens[0] == TEXT("Class") && Tokens.Contains(TEXT("Count")))
+                    {
+                        Header = Tokens;
+                        for (const FString& Column : Header)
+                        {
+                            HeaderIsKB.Add(Column.EndsWith(TEXT("KB")));
+                        }
+                    }
+                    continue;
+                }
+
+                if (Tokens[1] == TEXT("Objects") && Tokens[0].IsNumeric())
+                {
+                    TotalObjects = FCString::Atoi64(*Tokens[0]);
+                    break;
+                }
+                if (Tokens.Num() != Header.Num() || !Tokens[1].IsNumeric())
+                {
+                    continue;
+                }
+
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("name"), Tokens[0]);
+                double Serialized = 0.0;
+                double Resource = 0.0;
+                for (int32 Column = 1; Column < Header.Num(); ++Column)
+                {
+                    const FString Key = ObjListColumnKey(Header[Column]);
+                    const double Value = FCString::Atod(*Tokens[Column]) * (HeaderIsKB[Column] ? KB : 1.0);
+                    Entry->SetNumberField(Key, FMath::RoundToDouble(Value));
+                    if (Key == TEXT("serializedBytes"))
+                    {
+                        Serialized = Value;
+                    }
+                    else if (Key == TEXT("resourceBytes"))
+                    {
+                        Resource = Value;
+                    }
+                }
+                Entry->SetNumberField(TEXT("totalBytes"), FMath::RoundToDouble(Serialized + Resource));
+                TotalSerialized += Serialized;
+                TotalResource += Resource;
+                Classes.Add(Entry);
+            }
+
+            Classes.Sort([](const TSharedPtr<FJsonObject>& A, const TSharedPtr<FJsonObject>& B)
+            {
+                return A->GetNumberField(TEXT("totalBytes")) > B->GetNumberField(TEXT("totalBytes"));
+            });
+
+            TArray<TSharedPtr<FJsonValue>> ClassValues;
+            ClassValues.Reserve(Classes.Num());
+            for (const TSharedPtr<FJsonObject>& Entry : Classes)
+            {
+                ClassValues.Add(MakeShared<FJsonValueObject>(Entry));
+            }
+
+            TSharedPtr<FJsonObject> Objects = MakeShared<FJsonObject>();
+            Objects->SetBoolField(TEXT("parsed"), Header.Num() > 0);
+            Objects->SetNumberField(TEXT("totalObjects"), static_cast<double>(TotalObjects));
+            Objects->SetNumberField(TEXT("classCount"), Classes.Num());
+            Objects->SetNumberField(TEXT("serializedBytes"), FMath::RoundToDouble(TotalSerialized));
+            Objects->SetNumberField(TEXT("resourceBytes"), FMath::RoundToDouble(TotalResource));
+            Objects->SetArrayField(TEXT("classes"), ClassValues);
+            return Objects;
+        }
+
+        TSharedPtr<FJsonObject> CaptureObjects(TArray<FString>& OutRawLines)
+        {
+            FMcpOutputCapture Capture;
+            UWorld* World = nullptr;
+#if WITH_EDITOR
+            World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+#endif
+            GEngine->Exec(World, TEXT("obj list"), Capture);
+            OutRawLines = Capture.Consume();
+            return ParseObjList(OutRawLines);
+        }
+
+        TSharedPtr<FJsonObject> CapturePlatform()
+        {
+            const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+            TSharedPtr<FJsonObject> Platform = MakeShared<FJsonObject>();
+            Platform->SetNumberField(TEXT("usedPhysicalBytes"), static_cast<double>(Stats.UsedPhysical));
+            Platform->SetNumberField(TEXT("peakUsedPhysicalBytes"), static_cast<double>(Stats.PeakUsedPhysical));
+            Platform->SetNumberField(TEXT("usedVirtualBytes"), static_cast<double>(Stats.UsedVirtual));
+            Platform->SetNumberField(TEXT("peakUsedVirtualBytes"), static_cast<double>(Stats.PeakUsedVirtual));
+            Platform->SetNumberField(TEXT("availablePhysicalBytes"), static_cast<double>(Stats.AvailablePhysical));
+            Platform->SetNumberField(TEXT("totalPhysicalBytes"), static_cast<double>(Stats.TotalPhysical));
+            return Platform;
+        }
+
+        TSharedPtr<FJsonObject> CaptureTextures()
+        {
+            struct FGroupTotals
+            {
+                int32 Count = 0;
+                double Bytes = 0.0;
+            };
+            TMap<FString, FGroupTotals> Groups;
+            TArray<TPair<double, UTexture*>> Sized;
+            double TotalBytes = 0.0;
+
+            for (TObjectIterator<UTexture> It; It; ++It)
+            {
+                UTexture* Texture = *It;
+                if (!IsValid(Texture) || Texture->HasAnyFlags(RF_ClassDefaultObject))
+                {
+                    continue;
+                }
+                const double Bytes = static_cast<double>(Texture->CalcTextureMemorySizeEnum(TMC_ResidentMips));
+                FGroupTotals& Group = Groups.FindOrAdd(
+                    UTexture::GetTextureGroupString(static_cast<TextureGroup>(Texture->LODGroup.GetValue())));
+                ++Group.Count;
+                Group.Bytes += Bytes;
+                TotalBytes += Bytes;
+                Sized.Emplace(Bytes, Texture);
+            }
+
+            TArray<TSharedPtr<FJsonValue>> GroupValues;
+            Groups.ValueSort([](const FGroupTotals& A, const FGroupTotals& B) { return A.Bytes > B.Bytes; });
+            for (const TPair<FString, FGroupTotals>& Group : Groups)
+            {
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("name"), Group.Key);
+                Entry->SetNumberField(TEXT("count"), Group.Value.Count);
+                Entry->SetNumberField(TEXT("residentBytes"), Group.Value.Bytes);
+                GroupValues.Add(MakeShared<FJsonValueObject>(Entry));
+            }
+
+            Sized.Sort([](const TPair<double, UTexture*>& A, const TPair<double, UTexture*>& B) { return A.Key > B.Key; });
+            const int32 LargestCount = FMath::Min(MAX_LARGEST_TEXTURES, Sized.Num());
+            TArray<TSharedPtr<FJsonValue>> Largest;
+            for (int32 Index = 0; Index < LargestCount; ++Index)
+            {
+                UTexture* Texture = Sized[Index].Value;
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("path"), Texture->GetPathName());
+                Entry->SetStringField(TEXT("group"),
+                    UTexture::GetTextureGroupString(static_cast<TextureGroup>(Texture->LODGroup.GetValue())));
+                Entry->SetNumberField(TEXT("width"), Texture->GetSurfaceWidth());
+                Entry->SetNumberField(TEXT("height"), Texture->GetSurfaceHeight());
+                Entry->SetBoolField(TEXT("neverStream"), Texture->NeverStream != 0);
+                Entry->SetNumberField(TEXT("residentBytes"), Sized[Index].Key);
+                Largest.Add(MakeShared<FJsonValueObject>(Entry));
+            }
+
+            TSharedPtr<FJsonObject> Textures = MakeShared<FJsonObject>();
+            Textures->SetNumberField(TEXT("count"), Sized.Num());
+            Textures->SetNumberField(TEXT("residentBytes"), TotalBytes);
+            Textures->SetArrayField(TEXT("byGroup"), GroupValues);
+            Textures->SetArrayField(TEXT("largest"), Largest);
+
+            if (IConsoleVariable* PoolSize = IConsoleManager::Get().FindConsoleVariable(TEXT("r.Streaming.PoolSize")))
+            {
+                Textures->SetNumberField(TEXT("streamingPoolBytes"), PoolSize->GetInt() * MB);
+            }
+
+            FTextureMemoryStats PoolStats;
+            RHIGetTextureMemoryStats(PoolStats);
+            TSharedPtr<FJsonObject> Pool = MakeShared<FJsonObject>();
+            Pool->SetNumberField(TEXT("dedicatedVideoBytes"), static_cast<double>(PoolStats.DedicatedVideoMemory));
+            Pool->SetNumberField(TEXT("dedicatedSystemBytes"), static_cast<double>(PoolStats.DedicatedSystemMemory));
+            Pool->SetNumberField(TEXT("sharedSystemBytes"), static_cast<double>(PoolStats.SharedSystemMemory));
+            Pool->SetNumberField(TEXT("totalGraphicsBytes"), static_cast<double>(PoolStats.TotalGraphicsMemory));
+            Pool->SetNumberField(TEXT("streamingBytes"), static_cast<double>(PoolStats.StreamingMemorySize));
+            Pool->SetNumberField(TEXT("nonStreamingBytes"), static_cast<double>(PoolStats.NonStreamingMemorySize));
+            Pool->SetNumberField(TEXT("poolSizeBytes"), static_cast<double>(PoolStats.TexturePoolSize));
+            Textures->SetObjectField(TEXT("pool"), Pool);
+            return Textures;
+        }
+
+        TSharedPtr<FJsonObject> CaptureLLM()
+        {
+            TSharedPtr<FJsonObject> LLM = MakeShared<FJsonObject>();
+#if ENABLE_LOW_LEVEL_MEM_TRACKER && ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+            if (FLowLevelMemTracker::IsEnabled())
+            {
+                auto TagsFor = [](ELLMTracker Tracker)
+                {
+                    TMap<FName, uint64> Amounts;
+                    FLowLevelMemTracker::Get().GetTrackedTagsNamesWithAmount(Amounts, Tracker, ELLMTagSet::None);
+                    Amounts.ValueSort([](uint64 A, uint64 B) { return A > B; });
+
+                    TArray<TSharedPtr<FJsonValue>> Tags;
+                    for (const TPair<FName, uint64>& Tag : Amounts)
+                    {
+                        TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                        Entry->SetStringField(TEXT("name"), Tag.Key.ToString());
+                        Entry->SetNumberField(TEXT("bytes"), static_cast<double>(Tag.Value));
+                        Tags.Add(MakeShared<FJsonValueObject>(Entry));
+                    }
+                    return Tags;
+                };
+                LLM->SetBoolField(TEXT("enabled"), true);
+                LLM->SetArrayField(TEXT("tags"), TagsFor(ELLMTracker::Default));
+                LLM->SetArrayField(TEXT("platformTags"), TagsFor(ELLMTracker::Platform));
+                return LLM;
+            }
+#endif
+            LLM->SetBoolField(TEXT("enabled"), false);
+            LLM->SetStringField(TEXT("hint"), TEXT("Start the editor with -llm to collect LLM tag stats"));
+            return LLM;
+        }
+
+        void Remember(const TSharedPtr<FJsonObject>& Snapshot)
+        {
+            TArray<TSharedPtr<FJsonObject>>& Recent = GetRecent();
+            Recent.Add(Snapshot);
+            if (Recent.Num() > MAX_RECENT_SNAPSHOTS)
+            {
+                Recent.RemoveAt(0);
+            }
+        }
+
+        /**
+         * Match entries of two name-keyed arrays and rank them by RankField
+         * growth. Each output entry holds the current value and delta of every
+         * field in Fields.
+         */
+        TSharedPtr<FJsonObject> DiffEntries(const TArray<TSharedPtr<FJsonValue>>* BaseEntries,
+                                            const TArray<TSharedPtr<FJsonValue>>* CurrentEntries,
+                                            const TArray<FString>& Fields, const FString& RankField, int32 Limit)
+        {
+            TMap<FString, TSharedPtr<FJsonObject>> Base;
+            TMap<FString, TSharedPtr<FJsonObject>> Current;
+            auto Index = [](const TArray<TSharedPtr<FJsonValue>>* Entries, TMap<FString, TSharedPtr<FJsonObject>>& Out)
+            {
+                if (!Entries)
+                {
+                    return;
+                }
+                for (const TSharedPtr<FJsonValue>& Value : *Entries)
+                {
+                    const TSharedPtr<FJsonObject>* Entry = nullptr;
+                    FString Name;
+                    if (Value.IsValid() && Value->TryGetObject(Entry) && (*Entry)->TryGetStringField(TEXT("name"), Name))
+                    {
+                        Out.Add(Name, *Entry);
+                    }
+                }
+            };
+            Index(BaseEntries, Base);
+            Index(CurrentEntries, Current);
+
+            TSet<FString> Names;
+            Base.GetKeys(Names);
+            for (const TPair<FString, TSharedPtr<FJsonObject>>& Entry : Current)
+            {
+                Names.Add(Entry.Key);
+            }
+
+            TArray<TSharedPtr<FJsonObject>> Changes;
+            int32 Added = 0;
+            int32 Removed = 0;
+            double RankDeltaTotal = 0.0;
+            for (const FString& Name : Names)
+            {
+                const TSharedPtr<FJsonObject> Before = Base.FindRef(Name);
+                const TSharedPtr<FJsonObject> After = Current.FindRef(Name);
+                TSharedPtr<FJsonObject> Change = MakeShared<FJsonObject>();
+                Change->SetStringField(TEXT("name"), Name);
+                Change->SetStringField(TEXT("status"), !Before.IsValid() ? TEXT("added") : !After.IsValid() ? TEXT("removed") : TEXT("changed"));
+                Added += Before.IsValid() ? 0 : 1;
+                Removed += After.IsValid() ? 0 : 1;
+
+                bool bChanged = false;
+                for (const FString& Field : Fields)
+                {
+                    const double AfterValue = GetNumber(After, *Field);
+                    const double Delta = AfterValue - GetNumber(Before, *Field);
+                    Change->SetNumberField(Field, AfterValue);
+                    Change->SetNumberField(Field + TEXT("Delta"), Delta);
+                    bChanged |= Delta != 0.0;
+                    if (Field == RankField)
+                    {
+                        RankDeltaTotal += Delta;
+                    }
+                }
+                if (bChanged)
+                {
+                    Changes.Add(Change);
+                }
+            }
+
+            const FString RankDeltaField = RankField + TEXT("Delta");
+            Changes.Sort([&RankDeltaField](const TSharedPtr<FJsonObject>& A, const TSharedPtr<FJsonObject>& B)
+            {
+                return A->GetNumberField(RankDeltaField) > B->GetNumberField(RankDeltaField);
+            });
+
+            TArray<TSharedPtr<FJsonValue>> Grown;
+            for (int32 I = 0; I < Changes.Num() && Grown.Num() < Limit; ++I)
+            {
+                if (Changes[I]->GetNumberField(RankDeltaField) <= 0.0)
+                {
+                    break;
+                }
+                Grown.Add(MakeShared<FJsonValueObject>(Changes[I]));
+            }
+            TArray<TSharedPtr<FJsonValue>> Shrunk;
+            for (int32 I = Changes.Num() - 1; I >= 0 && Shrunk.Num() < Limit; --I)
+            {
+                if (Changes[I]->GetNumberField(RankDeltaField) >= 0.0)
+                {
+                    break;
+                }
+                Shrunk.Add(MakeShared<FJsonValueObject>(Changes[I]));
+            }
+
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetNumberField(RankDeltaField, RankDeltaTotal);
+            Result->SetNumberField(TEXT("changed"), Changes.Num());
+            Result->SetNumberField(TEXT("added"), Added);
+            Result->SetNumberField(TEXT("removed"), Removed);
+            Result->SetArrayField(TEXT("grown"), Grown);
+            Result->SetArrayField(TEXT("shrunk"), Shrunk);
+            return Result;
+        }
+
+        TSharedPtr<FJsonObject> DiffFields(const TSharedPtr<FJsonObject>& Base, const TSharedPtr<FJsonObject>& Current,
+                                           const TCHAR* Section, const TArray<FString>& Fields)
+        {
+            const TSharedPtr<FJsonObject>* BaseSection = nullptr;
+            const TSharedPtr<FJsonObject>* CurrentSection = nullptr;
+            Base->TryGetObjectField(Section, BaseSection);
+            Current->TryGetObjectField(Section, CurrentSection);
+
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            for (const FString& Field : Fields)
+            {
+                const double After = GetNumber(CurrentSection ? *CurrentSection : nullptr, *Field);
+                const double Before = GetNumber(BaseSection ? *BaseSection : nullptr, *Field);
+                Result->SetNumberField(Field, After);
+                Result->SetNumberField(Field + TEXT("Delta"), After - Before);
+            }
+            return Result;
+        }
+    }
+
+    TSharedPtr<FJsonObject> Capture(const FCaptureOptions& Options, FString& OutFilePath)
+    {
+        check(IsInGameThread());
+
+        const double Start = FPlatformTime::Seconds();
+        const FDateTime Now = FDateTime::UtcNow();
+        const FString SnapshotId = FString::Printf(TEXT("mem_%s_%s"), *Now.ToString(TEXT("%Y%m%d_%H%M%S")),
+            *FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(4).ToLower());
+
+        TSharedPtr<FJsonObject> Snapshot = MakeShared<FJsonObject>();
+        Snapshot->SetStringField(TEXT("snapshotId"), SnapshotId);
+        Snapshot->SetStringField(TEXT("label"), Options.Label);
+        Snapshot->SetStringField(TEXT("timestamp"), Now.ToIso8601());
+        Snapshot->SetStringField(TEXT("projectName"), FApp::GetProjectName());
+        Snapshot->SetStringField(TEXT("engineVersion"), FEngineVersion::Current().ToString());
+
+        TSharedPtr<FJsonObject> Timings = MakeShared<FJsonObject>();
+        Snapshot->SetObjectField(TEXT("platform"), CapturePlatform());
+
+        TArray<FString> RawObjList;
+        if (Options.bObjects && GEngine)
+        {
+            const double SectionStart = FPlatformTime::Seconds();
+            Snapshot->SetObjectField(TEXT("objects"), CaptureObjects(RawObjList));
+            Timings->SetNumberField(TEXT("objectsMs"), (FPlatformTime::Seconds() - SectionStart) * 1000.0);
+        }
+        if (Options.bTextures)
+        {
+            const double SectionStart = FPlatformTime::Seconds();
+            Snapshot->SetObjectField(TEXT("textures"), CaptureTextures());
+            Timings->SetNumberField(TEXT("texturesMs"), (FPlatformTime::Seconds() - SectionStart) * 1000.0);
+        }
+        if (Options.bLLM)
+        {
+            const double SectionStart = FPlatformTime::Seconds();
+            Snapshot->SetObjectField(TEXT("llm"), CaptureLLM());
+            Timings->SetNumberField(TEXT("llmMs"), (FPlatformTime::Seconds() - SectionStart) * 1000.0);
+        }
+        Timings->SetNumberField(TEXT("totalMs"), (FPlatformTime::Seconds() - Start) * 1000.0);
+        Snapshot->SetObjectField(TEXT("timings"), Timings);
+
+        Remember(Snapshot);
+
+        const FString FilePath = FPaths::Combine(GetSnapshotDir(), SnapshotId + TEXT(".json"));
+        FString WriteError;
+        OutFilePath = WriteSnapshot(Snapshot, FilePath, WriteError) ? FilePath : FString();
+        if (!WriteError.IsEmpty())
+        {
+            UE_LOG(LogMcpAutomationBridgeSubsystem, Warning, TEXT("McpMemoryReport: %s"), *WriteError);
+        }
+
+        if (Options.bWriteRawText && RawObjList.Num() > 0)
+        {
+            FFileHelper::SaveStringArrayToFile(RawObjList, *FPaths::Combine(GetSnapshotDir(), SnapshotId + TEXT(".objlist.txt")));
+        }
+        return Snapshot;
+    }
+
+    bool WriteSnapshot(const TSharedPtr<FJsonObject>& Snapshot, const FString& FilePath, FString& OutError)
+    {
+        FString Serialized;
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+            TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Serialized);
+        if (!Snapshot.IsValid() || !FJsonSerializer::Serialize(Snapshot.ToSharedRef(), Writer))
+        {
+            OutError = TEXT("Failed to serialize memory snapshot");
+            return false;
+        }
+
+        IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+        if (!FFileHelper::SaveStringToFile(Serialized, *FilePath, FFileHelper::EEncodingOptions::ForceUTF8WithoutBOM))
+        {
+            OutError = FString::Printf(TEXT("Failed to write memory snapshot to %s"), *FilePath);
+            return false;
+        }
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> FindSnapshot(const FString& SnapshotId)
+    {
+        for (const TSharedPtr<FJsonObject>& Snapshot : GetRecent())
+        {
+            if (Snapshot->GetStringField(TEXT("snapshotId")) == SnapshotId)
+            {
+                return Snapshot;
+            }
+        }
+
+        FString Ignored;
+        const FString FilePath = FPaths::Combine(GetSnapshotDir(), SnapshotId + TEXT(".json"));
+        return FPaths::FileExists(FilePath) ? LoadSnapshotFile(FilePath, Ignored) : nullptr;
+    }
+
+    TSharedPtr<FJsonObject> LoadSnapshotFile(const FString& FilePath, FString& OutError)
+    {
+        FString Contents;
+        if (!FFileHelper::LoadFileToString(Contents, *FilePath))
+        {
+            OutError = FString::Printf(TEXT("Memory snapshot not found: %s"), *FilePath);
+            return nullptr;
+        }
+
+        TSharedPtr<FJsonObject> Snapshot;
+        TSharedRef<TJsonReader<TCHAR>> Reader = TJsonReaderFactory<TCHAR>::Create(Contents);
+        if (!FJsonSerializer::Deserialize(Reader, Snapshot) || !Snapshot.IsValid() ||
+            !Snapshot->HasTypedField<EJson::String>(TEXT("snapshotId")))
+        {
+            OutError = FString::Printf(TEXT("Not a memory snapshot file: %s"), *FilePath);
+            return nullptr;
+        }
+        return Snapshot;
+    }
+
+    bool IsSnapshotId(const FString& Value)
+    {
+        if (Value.IsEmpty())
+        {
+            return false;
+        }
+        for (const TCHAR Char : Value)
+        {
+            if (!FChar::IsAlnum(Char) && Char != TEXT('_') && Char != TEXT('-'))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    TSharedPtr<FJsonObject> Summarize(const TSharedPtr<FJsonObject>& Snapshot, int32 TopClasses)
+    {
+        TSharedPtr<FJsonObject> Summary = MakeShared<FJsonObject>();
+        Summary->Values = Snapshot->Values;
+
+        const TSharedPtr<FJsonObject>* Objects = nullptr;
+        const TArray<TSharedPtr<FJsonValue>>* Classes = nullptr;
+        if (Snapshot->TryGetObjectField(TEXT("objects"), Objects) && (*Objects)->TryGetArrayField(TEXT("classes"), Classes) &&
+            Classes->Num() > TopClasses)
+        {
+            TSharedPtr<FJsonObject> Trimmed = MakeShared<FJsonObject>();
+            Trimmed->Values = (*Objects)->Values;
+            Trimmed->SetArrayField(TEXT("classes"), TArray<TSharedPtr<FJsonValue>>(Classes->GetData(), FMath::Max(0, TopClasses)));
+            Trimmed->SetBoolField(TEXT("classesTruncated"), true);
+            Summary->SetObjectField(TEXT("objects"), Trimmed);
+        }
+        return Summary;
+    }
+
+    TSharedPtr<FJsonObject> Diff(const TSharedPtr<FJsonObject>& Baseline, const TSharedPtr<FJsonObject>& Current,
+                                 int32 Limit)
+    {
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetStringField(TEXT("baselineId"), Baseline->GetStringField(TEXT("snapshotId")));
+        Result->SetStringField(TEXT("currentId"), Current->GetStringField(TEXT("snapshotId")));
+        Result->SetStringField(TEXT("baselineLabel"), Baseline->GetStringField(TEXT("label")));
+        Result->SetStringField(TEXT("currentLabel"), Current->GetStringField(TEXT("label")));
+
+        FDateTime BaselineTime;
+        FDateTime CurrentTime;
+        if (FDateTime::ParseIso8601(*Baseline->GetStringField(TEXT("timestamp")), BaselineTime) &&
+            FDateTime::ParseIso8601(*Current->GetStringField(TEXT("timestamp")), CurrentTime))
+        {
+            Result->SetNumberField(TEXT("elapsedSeconds"), (CurrentTime - BaselineTime).GetTotalSeconds());
+        }
+
+        Result->SetObjectField(TEXT("platform"), DiffFields(Baseline, Current, TEXT("platform"),
+            { TEXT("usedPhysicalBytes"), TEXT("peakUsedPhysicalBytes"), TEXT("usedVirtualBytes"), TEXT("availablePhysicalBytes") }));
+
+        if (Baseline->HasField(TEXT("objects")) && Current->HasField(TEXT("objects")))
+        {
+            TSharedPtr<FJsonObject> Objects = DiffFields(Baseline, Current, TEXT("objects"),
+                { TEXT("totalObjects"), TEXT("serializedBytes"), TEXT("resourceBytes") });
+            Objects->SetObjectField(TEXT("classes"), DiffEntries(
+                GetArray(Baseline, TEXT("objects"), TEXT("classes")), GetArray(Current, TEXT("objects"), TEXT("classes")),
+                { TEXT("totalBytes"), TEXT("count"), TEXT("serializedBytes"), TEXT("resourceBytes") }, TEXT("totalBytes"), Limit));
+            Result->SetObjectField(TEXT("objects"), Objects);
+        }
+
+        if (Baseline->HasField(TEXT("textures")) && Current->HasField(TEXT("textures")))
+        {
+            TSharedPtr<FJsonObject> Textures = DiffFields(Baseline, Current, TEXT("textures"),
+                { TEXT("count"), TEXT("residentBytes") });
+            Textures->SetObjectField(TEXT("byGroup"), DiffEntries(
+                GetArray(Baseline, TEXT("textures"), TEXT("byGroup")), GetArray(Current, TEXT("textures"), TEXT("byGroup")),
+                { TEXT("residentBytes"), TEXT("count") }, TEXT("residentBytes"), Limit));
+            Result->SetObjectField(TEXT("textures"), Textures);
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* BaseTags = GetArray(Baseline, TEXT("llm"), TEXT("tags"));
+        const TArray<TSharedPtr<FJsonValue>>* CurrentTags = GetArray(Current, TEXT("llm"), TEXT("tags"));
+        if (BaseTags && CurrentTags)
+        {
+            TSharedPtr<FJsonObject> LLM = MakeShared<FJsonObject>();
+            LLM->SetObjectField(TEXT("tags"), DiffEntries(BaseTags, CurrentTags, { TEXT("bytes") }, TEXT("bytes"), Limit));
+            LLM->SetObjectField(TEXT("platformTags"), DiffEntries(
+                GetArray(Baseline, TEXT("llm"), TEXT("platformTags")), GetArray(Current, TEXT("llm"), TEXT("platformTags")),
+                { TEXT("bytes") }, TEXT("bytes"), Limit));
+            Result->SetObjectField(TEXT("llm"), LLM);
+        }
+        else
+        {
+            Result->SetStringField(TEXT("llmSkipped"), TEXT("LLM tag stats missing from one or both snapshots"));
+        }
+        return Result;
+    }
+}
@@ -0,0 +1,78 @@
+// =============================================================================
+// McpMemoryReport.h
+// =============================================================================
+// Structured memory snapshots for generate_memory_report and diffs between
+// them for diff_memory_reports.
+//
+// "memreport" writes a text file under Saved/Profiling/MemReports and returns
+// nothing to the caller. A snapshot instead collects the same sources in
+// process and keeps them as JSON:
+//
+//   - platform: FPlatformMemory stats (used / peak / available physical and
+//     virtual bytes).
+//   - objects:  "obj list" captured through an FOutputDevice and parsed into
+//     per-class counts and sizes. Columns are read from the header row, so
+//     engine versions that add or drop columns still parse.
+//   - textures: resident bytes per texture group and the largest textures,
+//     plus the RHI texture pool and r.Streaming.PoolSize.
+//   - llm:      per-tag bytes from FLowLevelMemTracker when the editor runs
+//     with -llm.
+//
+// Every snapshot is written to Saved/Profiling/MemReports/Mcp/<snapshotId>.json
+// (and kept in memory for the last MaxRecentSnapshots captures), so a diff can
+// compare snapshots taken in different editor sessions or builds.
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpMemoryReport
+{
+    struct FCaptureOptions
+    {
+        /** Free-form label stored with the snapshot (e.g. a build number). */
+        FString Label;
+        bool bObjects = true;
+        bool bTextures = true;
+        bool bLLM = true;
+        /** Also write the raw "obj list" text next to the snapshot file. */
+        bool bWriteRawText = false;
+    };
+
+    /**
+     * Capture a snapshot, keep it in memory and write it to the default
+     * snapshot folder. OutFilePath receives the written file (empty on
+     * write failure; the snapshot is still returned).
+     */
+    TSharedPtr<FJsonObject> Capture(const FCaptureOptions& Options, FString& OutFilePath);
+
+    /** Write a snapshot to an absolute file path. */
+    bool WriteSnapshot(const TSharedPtr<FJsonObject>& Snapshot, const FString& FilePath, FString& OutError);
+
+    /** Look up a snapshot by id: recent captures first, then the default folder. */
+    TSharedPtr<FJsonObject> FindSnapshot(const FString& SnapshotId);
+
+    /** Load a snapshot file written by Capture or WriteSnapshot. */
+    TSharedPtr<FJsonObject> LoadSnapshotFile(const FString& FilePath, FString& OutError);
+
+    /** True if Value is shaped like a snapshot id rather than a file path. */
+    bool IsSnapshotId(const FString& Value);
+
+    /** Response-sized copy of a snapshot: only the TopClasses largest classes. */
+    TSharedPtr<FJsonObject> Summarize(const TSharedPtr<FJsonObject>& Snapshot, int32 TopClasses);
+
+    /**
+     * Compare two snapshots. Classes, LLM tags and texture groups are ranked
+     * by byte growth; up to Limit entries are returned for growth and for
+     * shrinkage in each section.
+     */
+    TSharedPtr<FJsonObject> Diff(const TSharedPtr<FJsonObject>& Baseline, const TSharedPtr<FJsonObject>& Current,
+                                 int32 Limit);
+}
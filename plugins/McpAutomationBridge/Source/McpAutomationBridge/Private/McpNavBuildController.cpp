@@ -0,0 +1,1001 @@
+// =============================================================================
+// McpNavBuildController.cpp
+// =============================================================================
+// Implementation of paused, tile-scoped navmesh rebuilds.
+// =============================================================================
+
+#include "McpNavBuildController.h"
+#include "McpAutomationBridgeSettings.h"
+
+#include "Components/PrimitiveComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Dom/JsonValue.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "NavigationSystem.h"
+#include "NavMesh/RecastNavMesh.h"
+#include "UObject/WeakObjectPtr.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcpNavBuildController, Log, All);
+
+namespace McpNavBuildController
+{
+    namespace
+    {
+        constexpr double PROGRESS_INTERVAL_SECONDS = 0.25;
+
+        /** Ticks to wait before an untouched navmesh counts as up to date (octree updates land on the next tick). */
+        constexpr int32 MIN_IDLE_TICKS = 2;
+
+        /** Dirty tiles tracked individually; larger changes only grow the bounds. */
+        constexpr int32 MAX_TRACKED_TILES = 65536;
+
+        enum EPauseOwner : uint8
+        {
+            PauseAuto = 1 << 0,
+            PauseBatch = 1 << 1,
+            PauseBenchmark = 1 << 2
+        };
+
+        /** Watches the navigation system until it has nothing left to build. */
+        struct FBuildProbe
+        {
+            int32 Ticks = 0;
+            int32 PeakTasks = 0;
+            int32 Remaining = 0;
+            bool bSawWork = false;
+
+            void Reset()
+            {
+                *this = FBuildProbe();
+            }
+
+            /** True once there are no dirty areas and no tile tasks left. */
+            bool Poll(UNavigationSystemV1& NavSys)
+            {
+                ++Ticks;
+                Remaining = NavSys.GetNumRemainingBuildTasks();
+                PeakTasks = FMath::Max(PeakTasks, Remaining);
+                const bool bBusy = Remaining > 0 || NavSys.HasDirtyAreasQueued() || NavSys.IsNavigationBuildInProgress();
+                bSawWork |= bBusy;
+                return !bBusy && (bSawWork || Ticks >= MIN_IDLE_TICKS);
+            }
+
+            float GetPercent() const
+            {
+                return PeakTasks > 0 ? 100.0f * static_cast<float>(PeakTasks - Remaining) / PeakTasks : 0.0f;
+            }
+        };
+
+        struct FWait
+        {
+            double StartSeconds = 0.0;
+            double TimeoutSeconds = 0.0;
+            double LastProgressSeconds = 0.0;
+            FBuildProbe Probe;
+            FRebuildResult Result;
+            FProgressSink OnProgress;
+            FRebuildSink OnComplete;
+        };
+
+        enum class EBenchmarkPhase : uint8
+        {
+            Settle,
+            PerPlacement,
+            CleanupPerPlacement,
+            Batched,
+            CleanupBatched
+        };
+
+        struct FBenchmarkRun
+        {
+            FBenchmarkSettings Settings;
+            FProgressSink OnProgress;
+            FCompletionSink OnComplete;
+
+            TWeakObjectPtr<UWorld> World;
+            TWeakObjectPtr<UStaticMesh> Mesh;
+            FVector Origin = FVector::ZeroVector;
+            double TileSize = 0.0;
+
+            EBenchmarkPhase Phase = EBenchmarkPhase::Settle;
+            double StartSeconds = 0.0;
+            double PhaseStart = 0.0;
+            double LastProgressSeconds = 0.0;
+            int32 NextIndex = 0;
+            bool bWaiting = false;
+            double WaitStart = 0.0;
+            FBuildProbe Probe;
+            TArray<TWeakObjectPtr<AActor>> Actors;
+
+            double PerPlacementTotalSeconds = 0.0;
+            double PerPlacementRebuildSeconds = 0.0;
+            double PerPlacementMaxRebuildSeconds = 0.0;
+            int32 PerPlacementTileTasks = 0;
+
+            double BatchedTotalSeconds = 0.0;
+            double BatchedPlacementSeconds = 0.0;
+            double BatchedRebuildSeconds = 0.0;
+            int32 BatchedTileTasks = 0;
+            int32 BatchedDirtyTiles = 0;
+        };
+
+        struct FState
+        {
+            uint8 PauseOwners = 0;
+            TWeakObjectPtr<UNavigationSystemV1> LockedNavSys;
+            double PausedSince = 0.0;
+            double BatchDeadline = 0.0;
+            double LastActivitySeconds = 0.0;
+
+            /** GFrameCounter when the last request that may change nav-relevant geometry ran. */
+            uint64 LastGeometryRequestFrame = 0;
+
+            /** Nav-relevant actor changes since the lock was taken. */
+            int32 DirtyActorChanges = 0;
+            FBox DirtyBounds = FBox(ForceInit);
+            TSet<FIntPoint> DirtyTiles;
+            double TileSize = 0.0;
+
+            FDelegateHandle ActorAddedHandle;
+            FDelegateHandle ActorDeletedHandle;
+            FDelegateHandle ActorMovedHandle;
+
+            TArray<TUniquePtr<FWait>> Waits;
+            TUniquePtr<FBenchmarkRun> Benchmark;
+
+            int64 TotalPauses = 0;
+            int64 TotalActorChanges = 0;
+            int64 TotalWaits = 0;
+            double TotalRebuildSeconds = 0.0;
+
+            TSharedPtr<FJsonObject> LastRebuild;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        const UMcpAutomationBridgeSettings* GetSettings()
+        {
+            return GetDefault<UMcpAutomationBridgeSettings>();
+        }
+
+        FString NormalizeActionKey(const FString& Action)
+        {
+            FString Key;
+            Key.Reserve(Action.Len());
+            for (const TCHAR C : Action)
+            {
+                if (FChar::IsAlnum(C))
+                {
+                    Key.AppendChar(FChar::ToLower(C));
+                }
+            }
+            return Key;
+        }
+
+        const TSet<FString>& GetNeutralActions()
+        {
+            static const TSet<FString> Actions = {
+                TEXT("beginnavbatch"), TEXT("endnavbatch"),
+                TEXT("getnavbuildstatus"), TEXT("benchmarknavrebuild")
+            };
+            return Actions;
+        }
+
+        const TSet<FString>& GetNavigationActions()
+        {
+            static const TSet<FString> Actions = {
+                TEXT("managenavigation"), TEXT("manageai"), TEXT("managebehaviortree"),
+                TEXT("managelevel"), TEXT("controleditor")
+            };
+            return Actions;
+        }
+
+        UWorld* GetEditorWorld()
+        {
+#if WITH_EDITOR
+            return GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+#else
+            return nullptr;
+#endif
+        }
+
+        UNavigationSystemV1* GetNavSys(UWorld* World)
+        {
+            return World ? FNavigationSystem::GetCurrent<UNavigationSystemV1>(World) : nullptr;
+        }
+
+        double GetTileSize(UNavigationSystemV1& NavSys)
+        {
+            const ARecastNavMesh* NavMesh = Cast<ARecastNavMesh>(NavSys.GetDefaultNavDataInstance());
+            return NavMesh ? NavMesh->TileSizeUU : 0.0;
+        }
+
+        TSharedPtr<FJsonObject> VectorToJson(const FVector& Vector)
+        {
+            TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+            Json->SetNumberField(TEXT("x"), Vector.X);
+            Json->SetNumberField(TEXT("y"), Vector.Y);
+            Json->SetNumberField(TEXT("z"), Vector.Z);
+            return Json;
+        }
+
+        TSharedPtr<FJsonObject> BoxToJson(const FBox& Box)
+        {
+            TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+            Json->SetObjectField(TEXT("min"), VectorToJson(Box.Min));
+            Json->SetObjectField(TEXT("max"), VectorToJson(Box.Max));
+            return Json;
+        }
+
+        /** Record the bounds and tiles of a nav-relevant actor added, moved or deleted while paused. */
+        void NoteActorChange(AActor* Actor)
+        {
+            FState& State = GetState();
+            const UNavigationSystemV1* NavSys = State.LockedNavSys.Get();
+            if (!Actor || !NavSys || Actor->GetWorld() != NavSys->GetWorld())
+            {
+                return;
+            }
+
+            bool bRelevant = false;
+            FBox Bounds(ForceInit);
+            Actor->ForEachComponent<UPrimitiveComponent>(false, [&](UPrimitiveComponent* Component)
+            {
+                if (Component->IsRegistered() && Component->CanEverAffectNavigation())
+                {
+                    bRelevant = true;
+                    Bounds += Component->Bounds.GetBox();
+                }
+            });
+            if (!bRelevant)
+            {
+                return;
+            }
+
+            ++State.DirtyActorChanges;
+            ++State.TotalActorChanges;
+            if (!Bounds.IsValid)
+            {
+                return;
+            }
+            State.DirtyBounds += Bounds;
+
+            if (State.TileSize <= 0.0)
+            {
+                return;
+            }
+            const int32 MinX = FMath::FloorToInt(Bounds.Min.X / State.TileSize);
+            const int32 MaxX = FMath::FloorToInt(Bounds.Max.X / State.TileSize);
+            const int32 MinY = FMath::FloorToInt(Bounds.Min.Y / State.TileSize);
+            const int32 MaxY = FMath::FloorToInt(Bounds.Max.Y / State.TileSize);
+            for (int32 X = MinX; X <= MaxX && State.DirtyTiles.Num() < MAX_TRACKED_TILES; ++X)
+            {
+                for (int32 Y = MinY; Y <= MaxY && State.DirtyTiles.Num() < MAX_TRACKED_TILES; ++Y)
+                {
+                    State.DirtyTiles.Add(FIntPoint(X, Y));
+                }
+            }
+        }
+
+        void BindActorDelegates(FState& State)
+        {
+#if WITH_EDITOR
+            if (GEngine)
+            {
+                State.ActorAddedHandle = GEngine->OnLevelActorAdded().AddStatic(&NoteActorChange);
+                State.ActorDeletedHandle = GEngine->OnLevelActorDeleted().AddStatic(&NoteActorChange);
+                State.ActorMovedHandle = GEngine->OnActorMoved().AddStatic(&NoteActorChange);
+            }
+#endif
+        }
+
+        void UnbindActorDelegates(FState& State)
+        {
+#if WITH_EDITOR
+            if (GEngine)
+            {
+                GEngine->OnLevelActorAdded().Remove(State.ActorAddedHandle);
+                GEngine->OnLevelActorDeleted().Remove(State.ActorDeletedHandle);
+                GEngine->OnActorMoved().Remove(State.ActorMovedHandle);
+            }
+#endif
+            State.ActorAddedHandle.Reset();
+            State.ActorDeletedHandle.Reset();
+            State.ActorMovedHandle.Reset();
+        }
+
+        /** Take the build lock on the editor world's navigation system for Owner. */
+        bool AddPause(uint8 Owner)
+        {
+            FState& State = GetState();
+            if (State.PauseOwners == 0)
+            {
+                UNavigationSystemV1* NavSys = GetNavSys(GetEditorWorld());
+                if (!NavSys)
+                {
+                    return false;
+                }
+                NavSys->AddNavigationBuildLock(ENavigationBuildLock::Custom);
+                State.LockedNavSys = NavSys;
+                State.PausedSince = FPlatformTime::Seconds();
+                State.DirtyActorChanges = 0;
+                State.DirtyBounds = FBox(ForceInit);
+                State.DirtyTiles.Reset();
+                State.TileSize = GetTileSize(*NavSys);
+                BindActorDelegates(State);
+                ++State.TotalPauses;
+            }
+            State.PauseOwners |= Owner;
+            return true;
+        }
+
+        /**
+         * Drop Owners from the pause. When no owner is left the lock is
+         * released without a full rebuild, so the navigation system builds
+         * only the dirty areas it collected. Returns true (and the dirty
+         * summary) when this call released the lock.
+         */
+        bool RemovePause(uint8 Owners, const FString& Reason, FRebuildResult* OutSummary = nullptr)
+        {
+            FState& State = GetState();
+            if ((State.PauseOwners & Owners) == 0)
+            {
+                return false;
+            }
+            State.PauseOwners &= ~Owners;
+            if (State.PauseOwners != 0)
+            {
+                return false;
+            }
+
+            UnbindActorDelegates(State);
+            if (OutSummary)
+            {
+                OutSummary->DirtyActorChanges = State.DirtyActorChanges;
+                OutSummary->DirtyTiles = State.DirtyTiles.Num();
+                OutSummary->DirtyBounds = State.DirtyBounds;
+                OutSummary->PausedSeconds = FPlatformTime::Seconds() - State.PausedSince;
+            }
+            if (UNavigationSystemV1* NavSys = State.LockedNavSys.Get())
+            {
+                NavSys->RemoveNavigationBuildLock(ENavigationBuildLock::Custom,
+                    UNavigationSystemV1::ELockRemovalRebuildAction::NoRebuild);
+            }
+            State.LockedNavSys.Reset();
+
+            UE_LOG(LogMcpNavBuildController, Verbose,
+                TEXT("Navmesh build resumed (%s): %d actor changes, ~%d tiles, paused %.1fms"),
+                *Reason, State.DirtyActorChanges, State.DirtyTiles.Num(),
+                (FPlatformTime::Seconds() - State.PausedSince) * 1000.0);
+            return true;
+        }
+
+        void CompleteWait(FState& State, TUniquePtr<FWait> Wait, double Now)
+        {
+            Wait->Result.RebuildSeconds = Now - Wait->StartSeconds;
+            Wait->Result.PeakTileTasks = Wait->Probe.PeakTasks;
+            State.TotalRebuildSeconds += Wait->Result.RebuildSeconds;
+            State.LastRebuild = RebuildResultToJson(Wait->Result);
+            if (Wait->OnComplete)
+            {
+                Wait->OnComplete(Wait->Result);
+            }
+        }
+
+        void TickWaits(FState& State, double Now)
+        {
+            if (State.Waits.Num() == 0)
+            {
+                return;
+            }
+
+            UNavigationSystemV1* NavSys = GetNavSys(GetEditorWorld());
+            TArray<TUniquePtr<FWait>> Finished;
+            for (int32 Index = 0; Index < State.Waits.Num();)
+            {
+                FWait& Wait = *State.Waits[Index];
+                bool bDone = true;
+                if (!NavSys)
+                {
+                    // World torn down mid-wait
+                }
+                else if (State.PauseOwners == 0 && NavSys->IsNavigationBuildingLocked())
+                {
+                    Wait.Result.bLockedExternally = true;
+                }
+                else if (Wait.Probe.Poll(*NavSys))
+                {
+                    Wait.Result.bUpToDate = true;
+                }
+                else if (Now - Wait.StartSeconds >= Wait.TimeoutSeconds)
+                {
+                    // Reported as not up to date
+                }
+                else
+                {
+                    bDone = false;
+                    if (Wait.OnProgress && Now - Wait.LastProgressSeconds >= PROGRESS_INTERVAL_SECONDS)
+                    {
+                        Wait.LastProgressSeconds = Now;
+                        Wait.OnProgress(Wait.Probe.GetPercent(), Wait.Probe.Remaining > 0
+                            ? FString::Printf(TEXT("Rebuilding navmesh: %d of %d tiles done"),
+                                Wait.Probe.PeakTasks - Wait.Probe.Remaining, Wait.Probe.PeakTasks)
+                            : FString(TEXT("Waiting for dirty navmesh areas")));
+                    }
+                }
+
+                if (bDone)
+                {
+                    Finished.Add(MoveTemp(State.Waits[Index]));
+                    State.Waits.RemoveAt(Index);
+                }
+                else
+                {
+                    ++Index;
+                }
+            }
+
+            for (TUniquePtr<FWait>& Wait : Finished)
+            {
+                CompleteWait(State, MoveTemp(Wait), Now);
+            }
+        }
+
+#if WITH_EDITOR
+        void SpawnBenchmarkActor(FBenchmarkRun& Run, UWorld& World)
+        {
+            const double RowLength = (Run.Settings.ActorCount - 1) * Run.Settings.Spacing;
+            const FVector Location = Run.Origin + FVector(
+                -0.5 * RowLength + Run.NextIndex * Run.Settings.Spacing, 0.0, 50.0 * Run.Settings.ActorScale);
+
+            FActorSpawnParameters Params;
+            Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            Params.ObjectFlags |= RF_Transient;
+            AStaticMeshActor* Actor = World.SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator, Params);
+            if (!Actor)
+            {
+                return;
+            }
+            Actor->SetActorLabel(FString::Printf(TEXT("McpNavBenchmark_%d"), Run.NextIndex));
+            Actor->SetActorScale3D(FVector(Run.Settings.ActorScale));
+            Actor->GetStaticMeshComponent()->SetStaticMesh(Run.Mesh.Get());
+            // The added event fired before the mesh was set; record the final bounds
+            NoteActorChange(Actor);
+            Run.Actors.Add(Actor);
+        }
+
+        void DestroyBenchmarkActors(FBenchmarkRun& Run)
+        {
+            UWorld* World = Run.World.Get();
+            for (const TWeakObjectPtr<AActor>& Actor : Run.Actors)
+            {
+                if (World && Actor.IsValid())
+                {
+                    World->EditorDestroyActor(Actor.Get(), false);
+                }
+            }
+            Run.Actors.Reset();
+        }
+#endif
+
+        TSharedPtr<FJsonObject> BuildBenchmarkResult(const FBenchmarkRun& Run)
+        {
+            const int32 Count = Run.Settings.ActorCount;
+
+            TSharedPtr<FJsonObject> PerPlacement = MakeShared<FJsonObject>();
+            PerPlacement->SetNumberField(TEXT("totalMs"), Run.PerPlacementTotalSeconds * 1000.0);
+            PerPlacement->SetNumberField(TEXT("rebuildMs"), Run.PerPlacementRebuildSeconds * 1000.0);
+            PerPlacement->SetNumberField(TEXT("rebuilds"), Count);
+            PerPlacement->SetNumberField(TEXT("avgRebuildMs"), Run.PerPlacementRebuildSeconds * 1000.0 / Count);
+            PerPlacement->SetNumberField(TEXT("maxRebuildMs"), Run.PerPlacementMaxRebuildSeconds * 1000.0);
+            PerPlacement->SetNumberField(TEXT("tileTasks"), Run.PerPlacementTileTasks);
+
+            TSharedPtr<FJsonObject> Batched = MakeShared<FJsonObject>();
+            Batched->SetNumberField(TEXT("totalMs"), Run.BatchedTotalSeconds * 1000.0);
+            Batched->SetNumberField(TEXT("placementMs"), Run.BatchedPlacementSeconds * 1000.0);
+            Batched->SetNumberField(TEXT("rebuildMs"), Run.BatchedRebuildSeconds * 1000.0);
+            Batched->SetNumberField(TEXT("rebuilds"), 1);
+            Batched->SetNumberField(TEXT("tileTasks"), Run.BatchedTileTasks);
+            Batched->SetNumberField(TEXT("estimatedDirtyTiles"), Run.BatchedDirtyTiles);
+
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetNumberField(TEXT("actorCount"), Count);
+            Result->SetNumberField(TEXT("spacing"), Run.Settings.Spacing);
+            Result->SetNumberField(TEXT("actorScale"), Run.Settings.ActorScale);
+            Result->SetObjectField(TEXT("location"), VectorToJson(Run.Origin));
+            Result->SetNumberField(TEXT("tileSizeUU"), Run.TileSize);
+            Result->SetObjectField(TEXT("perPlacement"), PerPlacement);
+            Result->SetObjectField(TEXT("batched"), Batched);
+            Result->SetNumberField(TEXT("rebuildSpeedup"), Run.BatchedRebuildSeconds > 0.0
+                ? Run.PerPlacementRebuildSeconds / Run.BatchedRebuildSeconds : 0.0);
+            Result->SetNumberField(TEXT("totalSpeedup"), Run.BatchedTotalSeconds > 0.0
+                ? Run.PerPlacementTotalSeconds / Run.BatchedTotalSeconds : 0.0);
+            return Result;
+        }
+
+        void FinishBenchmark(bool bSuccess, const FString& Message, const TSharedPtr<FJsonObject>& Result,
+                             const FString& ErrorCode)
+        {
+            FState& State = GetState();
+            TUniquePtr<FBenchmarkRun> Run = MoveTemp(State.Benchmark);
+            if (!Run)
+            {
+                return;
+            }
+#if WITH_EDITOR
+            DestroyBenchmarkActors(*Run);
+#endif
+            RemovePause(PauseBenchmark, TEXT("benchmark"));
+            if (Run->OnComplete)
+            {
+                Run->OnComplete(bSuccess, Message, Result, ErrorCode);
+            }
+        }
+
+        void TickBenchmark(FState& State, double Now)
+        {
+#if WITH_EDITOR
+            FBenchmarkRun* Run = State.Benchmark.Get();
+            if (!Run)
+            {
+                return;
+            }
+            if (Now - Run->StartSeconds >= Run->Settings.TimeoutSeconds)
+            {
+                FinishBenchmark(false, FString::Printf(TEXT("Navigation rebuild benchmark timed out after %.0f s"),
+                    Run->Settings.TimeoutSeconds), nullptr, TEXT("TIMEOUT"));
+                return;
+            }
+            UWorld* World = Run->World.Get();
+            UNavigationSystemV1* NavSys = GetNavSys(World);
+            if (!World || !NavSys || World != GetEditorWorld())
+            {
+                FinishBenchmark(false, TEXT("Editor world changed during the navigation rebuild benchmark"),
+                    nullptr, TEXT("NO_WORLD"));
+                return;
+            }
+
+            const int32 Count = Run->Settings.ActorCount;
+            switch (Run->Phase)
+            {
+            case EBenchmarkPhase::Settle:
+                if (Run->Probe.Poll(*NavSys))
+                {
+                    Run->Phase = EBenchmarkPhase::PerPlacement;
+                    Run->PhaseStart = Now;
+                    Run->NextIndex = 0;
+                    Run->bWaiting = false;
+                }
+                break;
+
+            case EBenchmarkPhase::PerPlacement:
+                // Place one actor, then wait for its dirty-area rebuild
+                if (!Run->bWaiting)
+                {
+                    SpawnBenchmarkActor(*Run, *World);
+                    Run->bWaiting = true;
+                    Run->WaitStart = Now;
+                    Run->Probe.Reset();
+                }
+                else if (Run->Probe.Poll(*NavSys))
+                {
+                    const double RebuildSeconds = Now - Run->WaitStart;
+                    Run->PerPlacementRebuildSeconds += RebuildSeconds;
+                    Run->PerPlacementMaxRebuildSeconds = FMath::Max(Run->PerPlacementMaxRebuildSeconds, RebuildSeconds);
+                    Run->PerPlacementTileTasks += Run->Probe.PeakTasks;
+                    Run->bWaiting = false;
+                    if (++Run->NextIndex >= Count)
+                    {
+                        Run->PerPlacementTotalSeconds = Now - Run->PhaseStart;
+                        Run->Phase = EBenchmarkPhase::CleanupPerPlacement;
+                    }
+                }
+                break;
+
+            case EBenchmarkPhase::CleanupPerPlacement:
+            case EBenchmarkPhase::CleanupBatched:
+                // Delete the row under one pause and let the navmesh settle
+                if (!Run->bWaiting)
+                {
+                    AddPause(PauseBenchmark);
+                    DestroyBenchmarkActors(*Run);
+                    RemovePause(PauseBenchmark, TEXT("benchmark_cleanup"));
+                    Run->bWaiting = true;
+                    Run->Probe.Reset();
+                }
+                else if (Run->Probe.Poll(*NavSys))
+                {
+                    if (Run->Phase == EBenchmarkPhase::CleanupBatched)
+                    {
+                        FinishBenchmark(true, FString::Printf(
+                            TEXT("%d placements: %.0f ms rebuilding after each, %.0f ms rebuilding once"),
+                            Count, Run->PerPlacementRebuildSeconds * 1000.0, Run->BatchedRebuildSeconds * 1000.0),
+                            BuildBenchmarkResult(*Run), FString());
+                        return;
+                    }
+                    Run->Phase = EBenchmarkPhase::Batched;
+                    Run->PhaseStart = Now;
+                    Run->NextIndex = 0;
+                    Run->bWaiting = false;
+                    AddPause(PauseBenchmark);
+                }
+                break;
+
+            case EBenchmarkPhase::Batched:
+                // Place the whole row paused, then rebuild once
+                if (!Run->bWaiting)
+                {
+                    SpawnBenchmarkActor(*Run, *World);
+                    if (++Run->NextIndex >= Count)
+                    {
+                        FRebuildResult Summary;
+                        RemovePause(PauseBenchmark, TEXT("benchmark"), &Summary);
+                        Run->BatchedPlacementSeconds = Now - Run->PhaseStart;
+                        Run->BatchedDirtyTiles = Summary.DirtyTiles;
+                        Run->bWaiting = true;
+                        Run->WaitStart = Now;
+                        Run->Probe.Reset();
+                    }
+                }
+                else if (Run->Probe.Poll(*NavSys))
+                {
+                    Run->BatchedRebuildSeconds = Now - Run->WaitStart;
+                    Run->BatchedTotalSeconds = Now - Run->PhaseStart;
+                    Run->BatchedTileTasks = Run->Probe.PeakTasks;
+                    Run->Phase = EBenchmarkPhase::CleanupBatched;
+                    Run->bWaiting = false;
+                }
+                break;
+            }
+
+            if (Run->OnProgress && Now - Run->LastProgressSeconds >= PROGRESS_INTERVAL_SECONDS)
+            {
+                Run->LastProgressSeconds = Now;
+                const bool bBatchedHalf = Run->Phase >= EBenchmarkPhase::Batched;
+                const float Percent = (bBatchedHalf ? 50.0f : 0.0f) +
+                    50.0f * FMath::Min(Run->NextIndex, Count) / FMath::Max(Count, 1);
+                Run->OnProgress(Percent, FString::Printf(TEXT("%s: %d of %d actors placed"),
+                    bBatchedHalf ? TEXT("Batched rebuild") : TEXT("Rebuild per placement"),
+                    FMath::Min(Run->NextIndex, Count), Count));
+            }
+#endif
+        }
+    }
+
+    ERequestKind ClassifyRequest(const FString& Action, const TSharedPtr<FJsonObject>& Payload)
+    {
+        FString SubAction;
+        if (Payload.IsValid() && Payload->TryGetStringField(TEXT("subAction"), SubAction) &&
+            GetNeutralActions().Contains(NormalizeActionKey(SubAction)))
+        {
+            return ERequestKind::Neutral;
+        }
+        return GetNavigationActions().Contains(NormalizeActionKey(Action))
+            ? ERequestKind::Navigation
+            : ERequestKind::Other;
+    }
+
+    bool IsPaused()
+    {
+        return GetState().PauseOwners != 0;
+    }
+
+    bool IsRebuildPending()
+    {
+        const FState& State = GetState();
+        if ((State.PauseOwners & (PauseBatch | PauseBenchmark)) != 0)
+        {
+            return false;
+        }
+        if (State.PauseOwners != 0 || GFrameCounter <= State.LastGeometryRequestFrame + MIN_IDLE_TICKS)
+        {
+            return true;
+        }
+        UNavigationSystemV1* NavSys = GetNavSys(GetEditorWorld());
+        return NavSys && (NavSys->GetNumRemainingBuildTasks() > 0 || NavSys->HasDirtyAreasQueued() ||
+                          NavSys->IsNavigationBuildInProgress());
+    }
+
+    bool BeginBatch(double MaxSeconds, FString& OutError)
+    {
+        check(IsInGameThread());
+        if (!AddPause(PauseBatch))
+        {
+            OutError = TEXT("Navigation system not available");
+            return false;
+        }
+        GetState().BatchDeadline = FPlatformTime::Seconds() + MaxSeconds;
+        return true;
+    }
+
+    bool IsBatchOpen()
+    {
+        return (GetState().PauseOwners & PauseBatch) != 0;
+    }
+
+    FRebuildResult Release(const FString& Reason)
+    {
+        FRebuildResult Summary;
+        Summary.Reason = Reason;
+        RemovePause(PauseAuto | PauseBatch, Reason, &Summary);
+        return Summary;
+    }
+
+    void WaitForRebuild(const FString& Reason, double TimeoutSeconds, FProgressSink OnProgress,
+                        FRebuildSink OnComplete)
+    {
+        check(IsInGameThread());
+        FState& State = GetState();
+
+        const double Now = FPlatformTime::Seconds();
+        TUniquePtr<FWait> Wait = MakeUnique<FWait>();
+        Wait->Result = Release(Reason);
+        Wait->StartSeconds = Now;
+        Wait->LastProgressSeconds = Now;
+        Wait->TimeoutSeconds = TimeoutSeconds;
+        Wait->OnProgress = MoveTemp(OnProgress);
+        Wait->OnComplete = MoveTemp(OnComplete);
+        ++State.TotalWaits;
+
+        if (!GetNavSys(GetEditorWorld()))
+        {
+            CompleteWait(State, MoveTemp(Wait), Now);
+            return;
+        }
+        State.Waits.Add(MoveTemp(Wait));
+    }
+
+    bool StartBenchmark(const FBenchmarkSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                        FString& OutError, FString& OutErrorCode)
+    {
+        check(IsInGameThread());
+        FState& State = GetState();
+        if (State.Benchmark)
+        {
+            OutError = TEXT("A navigation rebuild benchmark is already running");
+            OutErrorCode = TEXT("BUSY");
+            return false;
+        }
+        if (IsBatchOpen())
+        {
+            OutError = TEXT("A navigation batch is open; end it with end_nav_batch first");
+            OutErrorCode = TEXT("BATCH_OPEN");
+            return false;
+        }
+#if WITH_EDITOR
+        UWorld* World = GetEditorWorld();
+        UNavigationSystemV1* NavSys = GetNavSys(World);
+        if (!NavSys)
+        {
+            OutError = TEXT("Navigation system not available");
+            OutErrorCode = TEXT("NO_NAV_SYS");
+            return false;
+        }
+        const ANavigationData* NavData = NavSys->GetDefaultNavDataInstance();
+        if (!Cast<ARecastNavMesh>(NavData))
+        {
+            OutError = TEXT("No RecastNavMesh in the level; add a NavMeshBoundsVolume first");
+            OutErrorCode = TEXT("NO_NAVMESH");
+            return false;
+        }
+        UStaticMesh* Mesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+        if (!Mesh)
+        {
+            OutError = TEXT("Engine cube mesh /Engine/BasicShapes/Cube not found");
+            OutErrorCode = TEXT("NOT_FOUND");
+            return false;
+        }
+
+        TUniquePtr<FBenchmarkRun> Run = MakeUnique<FBenchmarkRun>();
+        Run->Settings = Settings;
+        Run->OnProgress = MoveTemp(OnProgress);
+        Run->OnComplete = MoveTemp(OnComplete);
+        Run->World = World;
+        Run->Mesh = Mesh;
+        Run->TileSize = GetTileSize(*NavSys);
+        Run->Origin = Settings.Location.IsSet() ? Settings.Location.GetValue() : NavData->GetBounds().GetCenter();
+
+        FNavLocation Projected;
+        const FVector Extent(Settings.Spacing, Settings.Spacing, 100000.0);
+        if (NavSys->ProjectPointToNavigation(Run->Origin, Projected, Extent))
+        {
+            Run->Origin = Projected.Location;
+        }
+
+        // Measure from a settled navmesh with no pause of ours in effect
+        RemovePause(PauseAuto, TEXT("benchmark"));
+        Run->StartSeconds = FPlatformTime::Seconds();
+        Run->PhaseStart = Run->StartSeconds;
+        Run->LastProgressSeconds = Run->StartSeconds;
+        State.Benchmark = MoveTemp(Run);
+        return true;
+#else
+        OutError = TEXT("Navigation rebuild benchmark requires an editor build");
+        OutErrorCode = TEXT("NOT_IMPLEMENTED");
+        return false;
+#endif
+    }
+
+    bool IsBenchmarkRunning()
+    {
+        return GetState().Benchmark.IsValid();
+    }
+
+    void CancelAll()
+    {
+        FState& State = GetState();
+        State.Waits.Reset();
+        if (State.Benchmark)
+        {
+            State.Benchmark->OnComplete = nullptr;
+            FinishBenchmark(false, TEXT("Benchmark cancelled"), nullptr, TEXT("CANCELLED"));
+        }
+        RemovePause(PauseAuto | PauseBatch | PauseBenchmark, TEXT("shutdown"));
+    }
+
+    void Tick(bool bRequestInFlight)
+    {
+        FState& State = GetState();
+        const double Now = FPlatformTime::Seconds();
+
+        if (State.PauseOwners != 0 && !State.LockedNavSys.IsValid())
+        {
+            // The world was torn down with the lock; nothing left to release
+            RemovePause(State.PauseOwners, TEXT("world_changed"));
+        }
+        if ((State.PauseOwners & PauseBatch) != 0 && Now >= State.BatchDeadline)
+        {
+            UE_LOG(LogMcpNavBuildController, Warning,
+                TEXT("Navigation batch was not ended within its time limit; resuming navmesh builds"));
+            RemovePause(PauseBatch, TEXT("batch_expired"));
+        }
+        if ((State.PauseOwners & PauseAuto) != 0 && !bRequestInFlight)
+        {
+            const UMcpAutomationBridgeSettings* Settings = GetSettings();
+            const float IdleSeconds = Settings ? Settings->NavRebuildIdleSeconds : 0.0f;
+            if (Now - State.LastActivitySeconds >= IdleSeconds)
+            {
+                RemovePause(PauseAuto, TEXT("idle"));
+            }
+        }
+
+        TickWaits(State, Now);
+        TickBenchmark(State, Now);
+    }
+
+    TSharedPtr<FJsonObject> GetStatus()
+    {
+        const FState& State = GetState();
+        const UMcpAutomationBridgeSettings* Settings = GetSettings();
+        const double Now = FPlatformTime::Seconds();
+
+        TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+        Status->SetBoolField(TEXT("batching"), Settings && Settings->bBatchNavigationRebuilds);
+        Status->SetNumberField(TEXT("idleRebuildSeconds"), Settings ? Settings->NavRebuildIdleSeconds : 0.0);
+        Status->SetBoolField(TEXT("paused"), State.PauseOwners != 0);
+
+        TArray<TSharedPtr<FJsonValue>> Owners;
+        if (State.PauseOwners & PauseAuto)
+        {
+            Owners.Add(MakeShared<FJsonValueString>(TEXT("auto")));
+        }
+        if (State.PauseOwners & PauseBatch)
+        {
+            Owners.Add(MakeShared<FJsonValueString>(TEXT("batch")));
+        }
+        if (State.PauseOwners & PauseBenchmark)
+        {
+            Owners.Add(MakeShared<FJsonValueString>(TEXT("benchmark")));
+        }
+        Status->SetArrayField(TEXT("pausedBy"), Owners);
+
+        if (State.PauseOwners != 0)
+        {
+            Status->SetNumberField(TEXT("pausedMs"), (Now - State.PausedSince) * 1000.0);
+            Status->SetNumberField(TEXT("dirtyActorChanges"), State.DirtyActorChanges);
+            Status->SetNumberField(TEXT("estimatedDirtyTiles"), State.DirtyTiles.Num());
+            if (State.DirtyBounds.IsValid)
+            {
+                Status->SetObjectField(TEXT("dirtyBounds"), BoxToJson(State.DirtyBounds));
+            }
+        }
+        if (State.PauseOwners & PauseBatch)
+        {
+            Status->SetNumberField(TEXT("batchExpiresInSeconds"), FMath::Max(0.0, State.BatchDeadline - Now));
+        }
+
+        if (UNavigationSystemV1* NavSys = GetNavSys(GetEditorWorld()))
+        {
+            TSharedPtr<FJsonObject> Navigation = MakeShared<FJsonObject>();
+            Navigation->SetBoolField(TEXT("buildInProgress"), NavSys->IsNavigationBuildInProgress());
+            Navigation->SetBoolField(TEXT("buildLocked"), NavSys->IsNavigationBuildingLocked());
+            Navigation->SetBoolField(TEXT("dirtyAreasQueued"), NavSys->HasDirtyAreasQueued());
+            Navigation->SetNumberField(TEXT("remainingTileTasks"), NavSys->GetNumRemainingBuildTasks());
+            Navigation->SetNumberField(TEXT("runningTileTasks"), NavSys->GetNumRunningBuildTasks());
+            Navigation->SetNumberField(TEXT("tileSizeUU"), GetTileSize(*NavSys));
+            Status->SetObjectField(TEXT("navigation"), Navigation);
+        }
+
+        Status->SetNumberField(TEXT("pendingWaits"), State.Waits.Num());
+        Status->SetBoolField(TEXT("benchmarkRunning"), State.Benchmark.IsValid());
+
+        TSharedPtr<FJsonObject> Totals = MakeShared<FJsonObject>();
+        Totals->SetNumberField(TEXT("pauses"), static_cast<double>(State.TotalPauses));
+        Totals->SetNumberField(TEXT("actorChangesBatched"), static_cast<double>(State.TotalActorChanges));
+        Totals->SetNumberField(TEXT("rebuildWaits"), static_cast<double>(State.TotalWaits));
+        Totals->SetNumberField(TEXT("rebuildMs"), State.TotalRebuildSeconds * 1000.0);
+        Status->SetObjectField(TEXT("totals"), Totals);
+
+        if (State.LastRebuild.IsValid())
+        {
+            Status->SetObjectField(TEXT("lastRebuild"), State.LastRebuild);
+        }
+        return Status;
+    }
+
+    TSharedPtr<FJsonObject> RebuildResultToJson(const FRebuildResult& Result)
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetStringField(TEXT("reason"), Result.Reason);
+        Json->SetBoolField(TEXT("upToDate"), Result.bUpToDate);
+        if (Result.bLockedExternally)
+        {
+            Json->SetBoolField(TEXT("lockedExternally"), true);
+        }
+        Json->SetNumberField(TEXT("rebuildMs"), Result.RebuildSeconds * 1000.0);
+        Json->SetNumberField(TEXT("peakTileTasks"), Result.PeakTileTasks);
+        Json->SetNumberField(TEXT("pausedMs"), Result.PausedSeconds * 1000.0);
+        Json->SetNumberField(TEXT("dirtyActorChanges"), Result.DirtyActorChanges);
+        Json->SetNumberField(TEXT("estimatedDirtyTiles"), Result.DirtyTiles);
+        if (Result.DirtyBounds.IsValid)
+        {
+            Json->SetObjectField(TEXT("dirtyBounds"), BoxToJson(Result.DirtyBounds));
+        }
+        return Json;
+    }
+
+    FScopedRequest::FScopedRequest(ERequestKind Kind)
+    {
+        FState& State = GetState();
+        State.LastActivitySeconds = FPlatformTime::Seconds();
+
+        switch (Kind)
+        {
+        case ERequestKind::Navigation:
+            // The request reads the navmesh; let it catch up first
+            RemovePause(PauseAuto, TEXT("dependent_read"));
+            break;
+        case ERequestKind::Other:
+        {
+            State.LastGeometryRequestFrame = GFrameCounter;
+
+            // Waits and the benchmark measure the navmesh; do not stall them
+            const UMcpAutomationBridgeSettings* Settings = GetSettings();
+            if (Settings && Settings->bBatchNavigationRebuilds && State.Waits.Num() == 0 && !State.Benchmark)
+            {
+                AddPause(PauseAuto);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    FScopedRequest::~FScopedRequest()
+    {
+        GetState().LastActivitySeconds = FPlatformTime::Seconds();
+    }
+}
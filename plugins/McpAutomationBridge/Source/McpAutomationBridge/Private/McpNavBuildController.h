@@ -0,0 +1,172 @@
+// =============================================================================
+// McpNavBuildController.h
+// =============================================================================
+// Batches navmesh rebuilds across automation requests.
+//
+// Every actor an agent places, moves or deletes dirties the navmesh, and the
+// navigation system rebuilds the touched tiles on its next tick. A script that
+// places 100 actors in a row therefore runs 100 small rebuilds, or ends with a
+// rebuild_navigation that throws the navmesh away and builds it again.
+//
+// The controller pauses navmesh building of the editor world with a
+// navigation build lock. While paused the navigation system keeps collecting
+// dirty areas but does not build them; the controller also records the bounds
+// and tiles of the nav-relevant actors added, moved or deleted. Releasing the
+// lock hands the accumulated dirty areas to the generator in one go, which
+// rebuilds only the touched tiles asynchronously.
+//
+// Building is paused by any of three owners:
+//
+//   Auto      - held while automation requests keep arriving, released when
+//               the bridge has been idle for NavRebuildIdleSeconds, or before
+//               a request that reads navigation (manage_navigation, manage_ai,
+//               manage_behavior_tree, manage_level, control_editor). The
+//               navigation queries (find_paths, reachability_matrix, ...)
+//               also wait for the released tiles to rebuild before they run.
+//   Batch     - manage_navigation begin_nav_batch .. end_nav_batch. Spans
+//               agent think time; expires after its maxSeconds.
+//   Benchmark - benchmark_nav_rebuild while it places actors.
+//
+// WaitForRebuild releases the Auto and Batch owners and reports tile progress
+// until the navmesh has no dirty areas and no running tile tasks.
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpNavBuildController
+{
+    enum class ERequestKind : uint8
+    {
+        /** May change nav-relevant geometry; pauses building for the burst. */
+        Other,
+        /** Reads or rebuilds navigation; releases the Auto pause first. */
+        Navigation,
+        /** Build control (batch, status, benchmark); no pause, no release. */
+        Neutral
+    };
+
+    struct FRebuildResult
+    {
+        FString Reason;
+
+        /** The navmesh had no dirty areas and no tile tasks when the wait ended. */
+        bool bUpToDate = false;
+
+        /** Building was locked by someone else (e.g. auto-update disabled in the editor). */
+        bool bLockedExternally = false;
+
+        /** From releasing the lock until the navmesh was up to date. */
+        double RebuildSeconds = 0.0;
+
+        /** Largest number of tile tasks queued at once during the rebuild. */
+        int32 PeakTileTasks = 0;
+
+        /** How long building was paused before the release. */
+        double PausedSeconds = 0.0;
+
+        /** Nav-relevant actor changes and the tiles they overlap, accumulated while paused. */
+        int32 DirtyActorChanges = 0;
+        int32 DirtyTiles = 0;
+        FBox DirtyBounds = FBox(ForceInit);
+    };
+
+    struct FBenchmarkSettings
+    {
+        int32 ActorCount = 100;
+        /** Distance between actors of the row (X axis). */
+        double Spacing = 300.0;
+        /** Uniform scale of the 100 uu engine cube placed for each actor. */
+        double ActorScale = 2.0;
+        /** Centre of the row; projected onto the navmesh. Defaults to the navmesh bounds centre. */
+        TOptional<FVector> Location;
+        /** Upper bound for the whole run, cleanup included. */
+        double TimeoutSeconds = 240.0;
+    };
+
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+    using FRebuildSink = TFunction<void(const FRebuildResult& Result)>;
+    using FCompletionSink = TFunction<void(bool bSuccess, const FString& Message,
+                                           const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)>;
+
+    /** Classify a request by its action / subAction. */
+    ERequestKind ClassifyRequest(const FString& Action, const TSharedPtr<FJsonObject>& Payload);
+
+    bool IsPaused();
+
+    /**
+     * True when a navigation query would read a stale navmesh: building is
+     * paused by the Auto owner, the navigation system still has dirty areas
+     * or tile tasks, or a request that may have moved nav-relevant geometry
+     * ran within the last few frames (its octree updates land on a later
+     * tick). False inside an explicit batch or the rebuild benchmark, whose
+     * reads see the navmesh as it was when building was paused.
+     */
+    bool IsRebuildPending();
+
+    /**
+     * Open an explicit batch (begin_nav_batch). Building stays paused until
+     * Release / WaitForRebuild, or for MaxSeconds. False with OutError when the
+     * editor world has no navigation system.
+     */
+    bool BeginBatch(double MaxSeconds, FString& OutError);
+
+    bool IsBatchOpen();
+
+    /**
+     * Release the Auto and Batch pauses without waiting. Returns the summary
+     * of what had accumulated; the rebuild fields are left at zero.
+     */
+    FRebuildResult Release(const FString& Reason);
+
+    /**
+     * Release the Auto and Batch pauses, then report tile progress until the
+     * navmesh is up to date or TimeoutSeconds pass. OnComplete runs on a
+     * later tick (or right away when there is no navigation system).
+     */
+    void WaitForRebuild(const FString& Reason, double TimeoutSeconds, FProgressSink OnProgress,
+                        FRebuildSink OnComplete);
+
+    /**
+     * Place Settings.ActorCount cubes in a row twice: once waiting for the
+     * navmesh after every placement, once paused and rebuilt once at the end.
+     * Reports the total rebuild time of both. Returns false with OutError and
+     * OutErrorCode when it cannot start.
+     */
+    bool StartBenchmark(const FBenchmarkSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                        FString& OutError, FString& OutErrorCode);
+
+    bool IsBenchmarkRunning();
+
+    /** Drop waits and the benchmark (subsystem shutdown) and release the lock. Completions are not reported. */
+    void CancelAll();
+
+    /** Release the Auto pause once the bridge has been idle long enough and advance waits. Called from the subsystem ticker. */
+    void Tick(bool bRequestInFlight);
+
+    /** Pause owners, accumulated dirty bounds, navigation build state and lifetime totals. */
+    TSharedPtr<FJsonObject> GetStatus();
+
+    TSharedPtr<FJsonObject> RebuildResultToJson(const FRebuildResult& Result);
+
+    /**
+     * Applies the request's navigation policy: Navigation requests release
+     * the Auto pause before dispatch, Other requests pause building until
+     * the bridge goes idle.
+     */
+    struct FScopedRequest
+    {
+        explicit FScopedRequest(ERequestKind Kind);
+        ~FScopedRequest();
+
+        FScopedRequest(const FScopedRequest&) = delete;
+        FScopedRequest& operator=(const FScopedRequest&) = delete;
+    };
+}
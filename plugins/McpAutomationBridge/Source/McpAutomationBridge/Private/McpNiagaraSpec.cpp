@@ -0,0 +1,1660 @@
+// =============================================================================
+// McpNiagaraSpec.cpp
+// =============================================================================
+// Implementation of declarative Niagara system apply, compile waits and the
+// batched-versus-incremental benchmark.
+// =============================================================================
+
+#include "McpVersionCompatibility.h"  // MUST be first
+#include "McpNiagaraSpec.h"
+#include "McpAutomationBridgeHelpers.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/Package.h"
+#include "UObject/StrongObjectPtr.h"
+#include "UObject/WeakObjectPtr.h"
+
+#if WITH_EDITOR && ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+#define MCP_HAS_NIAGARA_SPEC 1
+#include "NiagaraSystem.h"
+#include "NiagaraEmitter.h"
+#include "NiagaraEmitterHandle.h"
+#include "NiagaraScript.h"
+#include "NiagaraScriptSource.h"
+#include "NiagaraGraph.h"
+#include "NiagaraNodeFunctionCall.h"
+#include "NiagaraNodeOutput.h"
+#include "NiagaraParameterHandle.h"
+#include "NiagaraParameterStore.h"
+#include "NiagaraTypes.h"
+#include "NiagaraRendererProperties.h"
+#include "NiagaraSpriteRendererProperties.h"
+#include "NiagaraMeshRendererProperties.h"
+#include "NiagaraRibbonRendererProperties.h"
+#include "NiagaraLightRendererProperties.h"
+#include "ViewModels/Stack/NiagaraStackGraphUtilities.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+#include "ScopedTransaction.h"
+#include "ShaderCompiler.h"
+#else
+#define MCP_HAS_NIAGARA_SPEC 0
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcpNiagaraSpec, Log, All);
+
+namespace McpNiagaraSpec
+{
+    namespace
+    {
+        constexpr double PROGRESS_INTERVAL_SECONDS = 0.25;
+
+        struct FBenchmarkRun;
+
+#if MCP_HAS_NIAGARA_SPEC
+        struct FCompileWait
+        {
+            TWeakObjectPtr<UNiagaraSystem> System;
+            double StartSeconds = 0.0;
+            double TimeoutSeconds = 0.0;
+            double LastProgressSeconds = 0.0;
+            /** Set once the VM scripts are done; the rest of the wait is GPU shaders. */
+            double ScriptsDoneSeconds = 0.0;
+            FProgressSink OnProgress;
+            FCompileSink OnComplete;
+            FCompileResult Result;
+        };
+#endif
+
+        struct FState
+        {
+#if MCP_HAS_NIAGARA_SPEC
+            TArray<TUniquePtr<FCompileWait>> Waits;
+#endif
+            TSharedPtr<FBenchmarkRun> Benchmark;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+#if MCP_HAS_NIAGARA_SPEC
+        // ---------------------------------------------------------------------
+        // Lookups
+        // ---------------------------------------------------------------------
+
+        struct FModuleAlias
+        {
+            const TCHAR* Name;
+            const TCHAR* ScriptPath;
+            ENiagaraScriptUsage Usage;
+        };
+
+        /** The modules the add_*_module actions add, under the names they use. */
+        const FModuleAlias MODULE_ALIASES[] = {
+            {TEXT("SpawnRate"), TEXT("/Niagara/Modules/Emitter/SpawnRate.SpawnRate"), ENiagaraScriptUsage::EmitterUpdateScript},
+            {TEXT("SpawnBurst"), TEXT("/Niagara/Modules/Emitter/SpawnBurst_Instantaneous.SpawnBurst_Instantaneous"), ENiagaraScriptUsage::EmitterSpawnScript},
+            {TEXT("SpawnPerUnit"), TEXT("/Niagara/Modules/Emitter/SpawnPerUnit.SpawnPerUnit"), ENiagaraScriptUsage::EmitterUpdateScript},
+            {TEXT("InitializeParticle"), TEXT("/Niagara/Modules/Spawn/Initialization/InitializeParticle.InitializeParticle"), ENiagaraScriptUsage::ParticleSpawnScript},
+            {TEXT("ParticleState"), TEXT("/Niagara/Modules/Update/Lifetime/ParticleState.ParticleState"), ENiagaraScriptUsage::ParticleUpdateScript},
+            {TEXT("GravityForce"), TEXT("/Niagara/Modules/Update/Forces/GravityForce.GravityForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+            {TEXT("DragForce"), TEXT("/Niagara/Modules/Update/Forces/DragForce.DragForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+            {TEXT("WindForce"), TEXT("/Niagara/Modules/Update/Forces/WindForce.WindForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+            {TEXT("CurlNoiseForce"), TEXT("/Niagara/Modules/Update/Forces/CurlNoiseForce.CurlNoiseForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+            {TEXT("VortexForce"), TEXT("/Niagara/Modules/Update/Forces/VortexForce.VortexForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+            {TEXT("PointAttractionForce"), TEXT("/Niagara/Modules/Update/Forces/PointAttractionForce.PointAttractionForce"), ENiagaraScriptUsage::ParticleUpdateScript},
+            {TEXT("AddVelocity"), TEXT("/Niagara/Modules/Spawn/Velocity/AddVelocity.AddVelocity"), ENiagaraScriptUsage::ParticleSpawnScript},
+            {TEXT("AddVelocityInCone"), TEXT("/Niagara/Modules/Spawn/Velocity/AddVelocityInCone.AddVelocityInCone"), ENiagaraScriptUsage::ParticleSpawnScript},
+            {TEXT("AddVelocityFromPoint"), TEXT("/Niagara/Modules/Spawn/Velocity/AddVelocityFromPoint.AddVelocityFromPoint"), ENiagaraScriptUsage::ParticleSpawnScript}
+        };
+
+        const FModuleAlias* FindModuleAlias(const FString& Name)
+        {
+            for (const FModuleAlias& Alias : MODULE_ALIASES)
+            {
+                if (Name.Equals(Alias.Name, ESearchCase::IgnoreCase))
+                {
+                    return &Alias;
+                }
+            }
+            return nullptr;
+        }
+
+        bool ParseStage(const FString& Stage, ENiagaraScriptUsage& OutUsage)
+        {
+            static const TMap<FString, ENiagaraScriptUsage> Stages = {
+                {TEXT("emitterspawn"), ENiagaraScriptUsage::EmitterSpawnScript},
+                {TEXT("emitterupdate"), ENiagaraScriptUsage::EmitterUpdateScript},
+                {TEXT("particlespawn"), ENiagaraScriptUsage::ParticleSpawnScript},
+                {TEXT("particleupdate"), ENiagaraScriptUsage::ParticleUpdateScript}
+            };
+            const ENiagaraScriptUsage* Found = Stages.Find(Stage.ToLower());
+            if (Found)
+            {
+                OutUsage = *Found;
+            }
+            return Found != nullptr;
+        }
+
+        FString StageName(ENiagaraScriptUsage Usage)
+        {
+            switch (Usage)
+            {
+            case ENiagaraScriptUsage::EmitterSpawnScript: return TEXT("emitterSpawn");
+            case ENiagaraScriptUsage::EmitterUpdateScript: return TEXT("emitterUpdate");
+            case ENiagaraScriptUsage::ParticleSpawnScript: return TEXT("particleSpawn");
+            case ENiagaraScriptUsage::ParticleUpdateScript: return TEXT("particleUpdate");
+            default: return TEXT("other");
+            }
+        }
+
+        UClass* ResolveRendererClass(const FString& Type)
+        {
+            if (Type.Equals(TEXT("sprite"), ESearchCase::IgnoreCase))
+            {
+                return UNiagaraSpriteRendererProperties::StaticClass();
+            }
+            if (Type.Equals(TEXT("mesh"), ESearchCase::IgnoreCase))
+            {
+                return UNiagaraMeshRendererProperties::StaticClass();
+            }
+            if (Type.Equals(TEXT("ribbon"), ESearchCase::IgnoreCase))
+            {
+                return UNiagaraRibbonRendererProperties::StaticClass();
+            }
+            if (Type.Equals(TEXT("light"), ESearchCase::IgnoreCase))
+            {
+                return UNiagaraLightRendererProperties::StaticClass();
+            }
+            UClass* Class = ResolveClassByName(Type);
+            return Class && Class->IsChildOf(UNiagaraRendererProperties::StaticClass()) &&
+                !Class->HasAnyClassFlags(CLASS_Abstract) ? Class : nullptr;
+        }
+
+        int32 FindEmitterIndex(UNiagaraSystem& System, const FString& Name)
+        {
+            const TArray<FNiagaraEmitterHandle>& Handles = System.GetEmitterHandles();
+            for (int32 Index = 0; Index < Handles.Num(); ++Index)
+            {
+                if (Handles[Index].GetName().ToString().Equals(Name, ESearchCase::IgnoreCase))
+                {
+                    return Index;
+                }
+            }
+            return INDEX_NONE;
+        }
+
+        UNiagaraNodeOutput* FindOutputNode(FVersionedNiagaraEmitterData& EmitterData, ENiagaraScriptUsage Usage)
+        {
+            UNiagaraScriptSource* Source = Cast<UNiagaraScriptSource>(EmitterData.GraphSource);
+            if (!Source || !Source->NodeGraph)
+            {
+                return nullptr;
+            }
+            // UNiagaraGraph::FindOutputNode is not exported in all versions
+            for (UEdGraphNode* Node : Source->NodeGraph->Nodes)
+            {
+                UNiagaraNodeOutput* Output = Cast<UNiagaraNodeOutput>(Node);
+                if (Output && Output->GetUsage() == Usage)
+                {
+                    return Output;
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * A JSON value as a Niagara type and its bytes: numbers are floats,
+         * bools bools, 2/3/4-element arrays vec2/vec3/color, {r,g,b,a} colors
+         * and {x,y,z} vec3; { "type", "value" } picks the type explicitly.
+         */
+        bool ReadTypedValue(const TSharedPtr<FJsonValue>& Value, const FString& ExplicitType,
+                            FNiagaraTypeDefinition& OutType, TArray<uint8>& OutBytes, FString& OutError)
+        {
+            if (!Value.IsValid())
+            {
+                OutError = TEXT("missing value");
+                return false;
+            }
+
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (ExplicitType.IsEmpty() && Value->TryGetObject(Object) && (*Object)->HasField(TEXT("value")))
+            {
+                FString Type;
+                (*Object)->TryGetStringField(TEXT("type"), Type);
+                return ReadTypedValue((*Object)->TryGetField(TEXT("value")), Type.IsEmpty() ? TEXT("auto") : Type,
+                                      OutType, OutBytes, OutError);
+            }
+
+            auto Write = [&OutBytes](const auto& Data)
+            {
+                OutBytes.SetNumUninitialized(sizeof(Data));
+                FMemory::Memcpy(OutBytes.GetData(), &Data, sizeof(Data));
+            };
+
+            const FString Type = ExplicitType.ToLower();
+            const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+            double Number = 0.0;
+            bool bBool = false;
+
+            if (Type == TEXT("int"))
+            {
+                OutType = FNiagaraTypeDefinition::GetIntDef();
+                Write(static_cast<int32>(Value->AsNumber()));
+            }
+            else if (Type == TEXT("bool") || ((Type.IsEmpty() || Type == TEXT("auto")) && Value->TryGetBool(bBool)))
+            {
+                OutType = FNiagaraTypeDefinition::GetBoolDef();
+                Write(FNiagaraBool(Type == TEXT("bool") ? Value->AsBool() : bBool));
+            }
+            else if (Type == TEXT("float") || ((Type.IsEmpty() || Type == TEXT("auto")) && Value->TryGetNumber(Number)))
+            {
+                OutType = FNiagaraTypeDefinition::GetFloatDef();
+                Write(static_cast<float>(Value->AsNumber()));
+            }
+            else if (Value->TryGetArray(Array) && Array->Num() >= 2 && Array->Num() <= 4)
+            {
+                TArray<float> C;
+                for (const TSharedPtr<FJsonValue>& Element : *Array)
+                {
+                    C.Add(static_cast<float>(Element->AsNumber()));
+                }
+                if (Type == TEXT("color") || (Type != TEXT("vector") && C.Num() == 4))
+                {
+                    OutType = FNiagaraTypeDefinition::GetColorDef();
+                    Write(FLinearColor(C[0], C[1], C.IsValidIndex(2) ? C[2] : 0.0f, C.IsValidIndex(3) ? C[3] : 1.0f));
+                }
+                else if (C.Num() == 2 && Type != TEXT("vector"))
+                {
+                    OutType = FNiagaraTypeDefinition::GetVec2Def();
+                    Write(FVector2f(C[0], C[1]));
+                }
+                else
+                {
+                    OutType = FNiagaraTypeDefinition::GetVec3Def();
+                    Write(FVector3f(C[0], C[1], C.IsValidIndex(2) ? C[2] : 0.0f));
+                }
+            }
+            else if (Value->TryGetObject(Object))
+            {
+                const TSharedPtr<FJsonObject>& Fields = *Object;
+                if (Type == TEXT("color") || Fields->HasField(TEXT("r")))
+                {
+                    OutType = FNiagaraTypeDefinition::GetColorDef();
+                    Write(FLinearColor(GetJsonNumberField(Fields, TEXT("r"), 0.0), GetJsonNumberField(Fields, TEXT("g"), 0.0),
+                                       GetJsonNumberField(Fields, TEXT("b"), 0.0), GetJsonNumberField(Fields, TEXT("a"), 1.0)));
+                }
+                else
+                {
+                    OutType = FNiagaraTypeDefinition::GetVec3Def();
+                    Write(FVector3f(GetJsonNumberField(Fields, TEXT("x"), 0.0), GetJsonNumberField(Fields, TEXT("y"), 0.0),
+                                    GetJsonNumberField(Fields, TEXT("z"), 0.0)));
+                }
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("unsupported value for type '%s'"), *ExplicitType);
+                return false;
+            }
+            return true;
+        }
+
+        FName UserParameterName(const FString& Name)
+        {
+            return FName(Name.StartsWith(TEXT("User.")) ? Name : TEXT("User.") + Name);
+        }
+
+        // ---------------------------------------------------------------------
+        // Resolved spec
+        // ---------------------------------------------------------------------
+
+        struct FModuleSpec
+        {
+            FString Name;
+            ENiagaraScriptUsage Usage = ENiagaraScriptUsage::ParticleUpdateScript;
+            UNiagaraScript* Script = nullptr;
+            TOptional<bool> bEnabled;
+            const TSharedPtr<FJsonObject>* Inputs = nullptr;
+        };
+
+        struct FRendererSpec
+        {
+            UClass* Class = nullptr;
+            TSharedPtr<FJsonObject> Json;
+        };
+
+        struct FEmitterSpec
+        {
+            FString Name;
+            TSharedPtr<FJsonObject> Json;
+            UNiagaraEmitter* Source = nullptr;
+            bool bHasModules = false;
+            bool bHasRenderers = false;
+            TArray<FModuleSpec> Modules;
+            TArray<FRendererSpec> Renderers;
+        };
+
+        struct FUserParameterSpec
+        {
+            FNiagaraVariable Variable;
+            TArray<uint8> Bytes;
+            bool bHasValue = false;
+        };
+
+        bool ResolveEmitter(UNiagaraSystem& System, const TSharedPtr<FJsonObject>& Json, FEmitterSpec& Out, FString& OutError,
+                            FString& OutErrorCode)
+        {
+            Out.Json = Json;
+            Json->TryGetStringField(TEXT("name"), Out.Name);
+            if (Out.Name.IsEmpty())
+            {
+                OutError = TEXT("Every emitter needs a 'name'");
+                return false;
+            }
+
+            FString SourcePath;
+            Json->TryGetStringField(TEXT("source"), SourcePath);
+            if (FindEmitterIndex(System, Out.Name) == INDEX_NONE)
+            {
+                const FString SafePath = SanitizeProjectRelativePath(SourcePath);
+                Out.Source = SafePath.IsEmpty() ? nullptr : LoadObject<UNiagaraEmitter>(nullptr, *SafePath);
+                if (!Out.Source)
+                {
+                    OutError = SourcePath.IsEmpty()
+                        ? FString::Printf(TEXT("Emitter '%s' is not in the system; give a 'source' emitter asset to add it"), *Out.Name)
+                        : FString::Printf(TEXT("Emitter '%s': source emitter '%s' not found"), *Out.Name, *SourcePath);
+                    OutErrorCode = SourcePath.IsEmpty() ? TEXT("INVALID_SPEC") : TEXT("ASSET_NOT_FOUND");
+                    return false;
+                }
+            }
+
+            FString SimTarget;
+            if (Json->TryGetStringField(TEXT("simTarget"), SimTarget) &&
+                !SimTarget.Equals(TEXT("cpu"), ESearchCase::IgnoreCase) && !SimTarget.Equals(TEXT("gpu"), ESearchCase::IgnoreCase))
+            {
+                OutError = FString::Printf(TEXT("Emitter '%s': simTarget must be 'cpu' or 'gpu'"), *Out.Name);
+                return false;
+            }
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (Json->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+                {
+                    if (!FVersionedNiagaraEmitterData::StaticStruct()->FindPropertyByName(FName(*Pair.Key)))
+                    {
+                        OutError = FString::Printf(TEXT("Emitter '%s': emitter data has no property '%s'"), *Out.Name, *Pair.Key);
+                        return false;
+                    }
+                }
+            }
+
+            const TArray<TSharedPtr<FJsonValue>>* Modules = nullptr;
+            Out.bHasModules = Json->TryGetArrayField(TEXT("modules"), Modules);
+            if (Out.bHasModules)
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *Modules)
+                {
+                    const TSharedPtr<FJsonObject>* ModuleJson = nullptr;
+                    if (!Value.IsValid() || !Value->TryGetObject(ModuleJson))
+                    {
+                        OutError = FString::Printf(TEXT("Emitter '%s': 'modules' must be an array of objects"), *Out.Name);
+                        return false;
+                    }
+
+                    FModuleSpec Module;
+                    FString AliasName, ScriptPath, Stage;
+                    (*ModuleJson)->TryGetStringField(TEXT("module"), AliasName);
+                    (*ModuleJson)->TryGetStringField(TEXT("script"), ScriptPath);
+                    (*ModuleJson)->TryGetStringField(TEXT("stage"), Stage);
+                    (*ModuleJson)->TryGetStringField(TEXT("name"), Module.Name);
+                    (*ModuleJson)->TryGetObjectField(TEXT("inputs"), Module.Inputs);
+                    bool bEnabled = true;
+                    if ((*ModuleJson)->TryGetBoolField(TEXT("enabled"), bEnabled))
+                    {
+                        Module.bEnabled = bEnabled;
+                    }
+
+                    const FModuleAlias* Alias = AliasName.IsEmpty() ? nullptr : FindModuleAlias(AliasName);
+                    if (!AliasName.IsEmpty() && !Alias)
+                    {
+                        OutError = FString::Printf(TEXT("Emitter '%s': unknown module '%s' (use 'script' for other modules)"),
+                            *Out.Name, *AliasName);
+                        OutErrorCode = TEXT("UNKNOWN_MODULE");
+                        return false;
+                    }
+                    if (Alias && ScriptPath.IsEmpty())
+                    {
+                        ScriptPath = Alias->ScriptPath;
+                    }
+                    if (!Stage.IsEmpty())
+                    {
+                        if (!ParseStage(Stage, Module.Usage))
+                        {
+                            OutError = FString::Printf(TEXT("Emitter '%s': unknown stage '%s'"), *Out.Name, *Stage);
+                            return false;
+                        }
+                    }
+                    else if (Alias)
+                    {
+                        Module.Usage = Alias->Usage;
+                    }
+                    else
+                    {
+                        OutError = FString::Printf(TEXT("Emitter '%s': module script '%s' needs a 'stage'"), *Out.Name, *ScriptPath);
+                        return false;
+                    }
+
+                    const FString SafePath = SanitizeProjectRelativePath(ScriptPath);
+                    Module.Script = SafePath.IsEmpty() ? nullptr : LoadObject<UNiagaraScript>(nullptr, *SafePath);
+                    if (!Module.Script)
+                    {
+                        OutError = FString::Printf(TEXT("Emitter '%s': module script '%s' not found"), *Out.Name, *ScriptPath);
+                        OutErrorCode = TEXT("ASSET_NOT_FOUND");
+                        return false;
+                    }
+                    if (Module.Name.IsEmpty())
+                    {
+                        Module.Name = Alias ? FString(Alias->Name) : Module.Script->GetName();
+                    }
+                    Out.Modules.Add(MoveTemp(Module));
+                }
+            }
+
+            const TArray<TSharedPtr<FJsonValue>>* Renderers = nullptr;
+            Out.bHasRenderers = Json->TryGetArrayField(TEXT("renderers"), Renderers);
+            if (Out.bHasRenderers)
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *Renderers)
+                {
+                    const TSharedPtr<FJsonObject>* RendererJson = nullptr;
+                    FString Type;
+                    if (!Value.IsValid() || !Value->TryGetObject(RendererJson) ||
+                        !(*RendererJson)->TryGetStringField(TEXT("type"), Type))
+                    {
+                        OutError = FString::Printf(TEXT("Emitter '%s': every renderer needs a 'type'"), *Out.Name);
+                        return false;
+                    }
+                    FRendererSpec Renderer;
+                    Renderer.Json = *RendererJson;
+                    Renderer.Class = ResolveRendererClass(Type);
+                    if (!Renderer.Class)
+                    {
+                        OutError = FString::Printf(TEXT("Emitter '%s': unknown renderer type '%s'"), *Out.Name, *Type);
+                        OutErrorCode = TEXT("UNKNOWN_TYPE");
+                        return false;
+                    }
+                    Out.Renderers.Add(MoveTemp(Renderer));
+                }
+            }
+            return true;
+        }
+
+        // ---------------------------------------------------------------------
+        // Apply steps
+        // ---------------------------------------------------------------------
+
+        /** Write a module input as a rapid iteration parameter of every script of the stage. */
+        void SetModuleInput(UNiagaraEmitter& Emitter, FVersionedNiagaraEmitterData& EmitterData, UNiagaraNodeFunctionCall& Module,
+                            ENiagaraScriptUsage Usage, const FString& EmitterName, const FString& InputName,
+                            const TSharedPtr<FJsonValue>& Value, FApplyResult& Result)
+        {
+            FNiagaraTypeDefinition Type;
+            TArray<uint8> Bytes;
+            FString Error;
+            if (!ReadTypedValue(Value, FString(), Type, Bytes, Error))
+            {
+                Result.Warnings.Add(FString::Printf(TEXT("%s.%s.%s: %s"), *EmitterName, *Module.GetFunctionName(), *InputName, *Error));
+                return;
+            }
+
+            const FNiagaraParameterHandle InputHandle = FNiagaraParameterHandle::CreateModuleParameterHandle(FName(*InputName));
+            const FNiagaraParameterHandle AliasedHandle = FNiagaraParameterHandle::CreateAliasedModuleParameterHandle(InputHandle, &Module);
+            if (FNiagaraStackGraphUtilities::GetStackFunctionInputOverridePin(Module, AliasedHandle))
+            {
+                Result.Warnings.Add(FString::Printf(TEXT("%s.%s.%s is linked or dynamic; the local value was set but is not used"),
+                    *EmitterName, *Module.GetFunctionName(), *InputName));
+            }
+
+            const FNiagaraVariable Parameter = FNiagaraStackGraphUtilities::CreateRapidIterationParameter(
+                Emitter.GetUniqueEmitterName(), Usage, AliasedHandle.GetParameterHandleString(), Type);
+
+            TArray<UNiagaraScript*> Scripts;
+            EmitterData.GetScripts(Scripts, false);
+            const bool bParticleStage = Usage == ENiagaraScriptUsage::ParticleSpawnScript || Usage == ENiagaraScriptUsage::ParticleUpdateScript;
+            int32 Written = 0;
+            for (UNiagaraScript* Script : Scripts)
+            {
+                if (!Script)
+                {
+                    continue;
+                }
+                const bool bStageScript = UNiagaraScript::IsEquivalentUsage(Script->GetUsage(), Usage) ||
+                    (bParticleStage && Script->GetUsage() == ENiagaraScriptUsage::ParticleGPUComputeScript);
+                if (!bStageScript)
+                {
+                    continue;
+                }
+                Script->Modify();
+                Script->RapidIterationParameters.SetParameterData(Bytes.GetData(), Parameter, true);
+                ++Written;
+            }
+            if (Written > 0)
+            {
+                ++Result.ModuleInputsSet;
+            }
+            else
+            {
+                Result.Warnings.Add(FString::Printf(TEXT("%s.%s.%s: no %s script to hold the value"), *EmitterName,
+                    *Module.GetFunctionName(), *InputName, *StageName(Usage)));
+            }
+        }
+
+        /** Match or append the spec's modules; with prune, disable the modules it leaves out. */
+        void ApplyModules(UNiagaraEmitter& Emitter, FVersionedNiagaraEmitterData& EmitterData, const FEmitterSpec& Spec,
+                          bool bPrune, FApplyResult& Result, TArray<TSharedPtr<FJsonValue>>& OutModules)
+        {
+            TSet<UNiagaraNodeFunctionCall*> Listed;
+            for (const FModuleSpec& Module : Spec.Modules)
+            {
+                UNiagaraNodeOutput* Output = FindOutputNode(EmitterData, Module.Usage);
+                if (!Output)
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: no %s stage for module %s"), *Spec.Name,
+                        *StageName(Module.Usage), *Module.Name));
+                    continue;
+                }
+
+                TArray<UNiagaraNodeFunctionCall*> StackModules;
+                FNiagaraStackGraphUtilities::GetOrderedModuleNodes(*Output, StackModules);
+                UNiagaraNodeFunctionCall* Node = nullptr;
+                for (UNiagaraNodeFunctionCall* Candidate : StackModules)
+                {
+                    if (Candidate && !Listed.Contains(Candidate) &&
+                        Candidate->GetFunctionName().Equals(Module.Name, ESearchCase::IgnoreCase))
+                    {
+                        Node = Candidate;
+                        break;
+                    }
+                }
+
+                if (Node)
+                {
+                    ++Result.ModulesMatched;
+                }
+                else
+                {
+                    Node = FNiagaraStackGraphUtilities::AddScriptModuleToStack(Module.Script, *Output, INDEX_NONE, Module.Name);
+                    if (!Node)
+                    {
+                        Result.Warnings.Add(FString::Printf(TEXT("%s: could not add module %s"), *Spec.Name, *Module.Name));
+                        continue;
+                    }
+                    ++Result.ModulesAdded;
+                }
+                Listed.Add(Node);
+
+                const bool bWantEnabled = Module.bEnabled.Get(true);
+                if (Node->IsNodeEnabled() != bWantEnabled)
+                {
+                    FNiagaraStackGraphUtilities::SetModuleIsEnabled(*Node, bWantEnabled);
+                    ++Result.ModulesToggled;
+                }
+
+                if (Module.Inputs)
+                {
+                    for (const TPair<FString, TSharedPtr<FJsonValue>>& Input : (*Module.Inputs)->Values)
+                    {
+                        SetModuleInput(Emitter, EmitterData, *Node, Module.Usage, Spec.Name, Input.Key, Input.Value, Result);
+                    }
+                }
+
+                TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+                Json->SetStringField(TEXT("stage"), StageName(Module.Usage));
+                Json->SetStringField(TEXT("name"), Node->GetFunctionName());
+                Json->SetStringField(TEXT("nodeId"), Node->NodeGuid.ToString());
+                Json->SetBoolField(TEXT("enabled"), bWantEnabled);
+                OutModules.Add(MakeShared<FJsonValueObject>(Json));
+            }
+
+            if (!bPrune || !Spec.bHasModules)
+            {
+                return;
+            }
+            const ENiagaraScriptUsage Stages[] = {
+                ENiagaraScriptUsage::EmitterSpawnScript, ENiagaraScriptUsage::EmitterUpdateScript,
+                ENiagaraScriptUsage::ParticleSpawnScript, ENiagaraScriptUsage::ParticleUpdateScript
+            };
+            for (ENiagaraScriptUsage Usage : Stages)
+            {
+                UNiagaraNodeOutput* Output = FindOutputNode(EmitterData, Usage);
+                if (!Output)
+                {
+                    continue;
+                }
+                TArray<UNiagaraNodeFunctionCall*> StackModules;
+                FNiagaraStackGraphUtilities::GetOrderedModuleNodes(*Output, StackModules);
+                for (UNiagaraNodeFunctionCall* Node : StackModules)
+                {
+                    if (Node && !Listed.Contains(Node) && Node->IsNodeEnabled())
+                    {
+                        FNiagaraStackGraphUtilities::SetModuleIsEnabled(*Node, false);
+                        ++Result.ModulesToggled;
+                    }
+                }
+            }
+        }
+
+        void ApplyRendererFields(UNiagaraRendererProperties& Renderer, const TSharedPtr<FJsonObject>& Json,
+                                 const FString& EmitterName, FApplyResult& Result)
+        {
+            bool bEnabled = true;
+            if (Json->TryGetBoolField(TEXT("enabled"), bEnabled))
+            {
+                Renderer.SetIsEnabled(bEnabled);
+            }
+
+            FString MaterialPath;
+            if (Json->TryGetStringField(TEXT("material"), MaterialPath) && !MaterialPath.IsEmpty())
+            {
+                const FString SafePath = SanitizeProjectRelativePath(MaterialPath);
+                UMaterialInterface* Material = SafePath.IsEmpty() ? nullptr : LoadObject<UMaterialInterface>(nullptr, *SafePath);
+                if (!Material)
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: material '%s' not found"), *EmitterName, *MaterialPath));
+                }
+                else if (UNiagaraSpriteRendererProperties* Sprite = Cast<UNiagaraSpriteRendererProperties>(&Renderer))
+                {
+                    Sprite->Material = Material;
+                }
+                else if (UNiagaraRibbonRendererProperties* Ribbon = Cast<UNiagaraRibbonRendererProperties>(&Renderer))
+                {
+                    Ribbon->Material = Material;
+                }
+                else
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: %s does not take a material"), *EmitterName,
+                        *Renderer.GetClass()->GetName()));
+                }
+            }
+
+            FString MeshPath;
+            if (Json->TryGetStringField(TEXT("mesh"), MeshPath) && !MeshPath.IsEmpty())
+            {
+                UNiagaraMeshRendererProperties* MeshRenderer = Cast<UNiagaraMeshRendererProperties>(&Renderer);
+                const FString SafePath = SanitizeProjectRelativePath(MeshPath);
+                UStaticMesh* Mesh = SafePath.IsEmpty() ? nullptr : LoadObject<UStaticMesh>(nullptr, *SafePath);
+                if (!MeshRenderer)
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: %s does not take a mesh"), *EmitterName,
+                        *Renderer.GetClass()->GetName()));
+                }
+                else if (!Mesh)
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: mesh '%s' not found"), *EmitterName, *MeshPath));
+                }
+                else
+                {
+                    if (MeshRenderer->Meshes.Num() == 0)
+                    {
+                        MeshRenderer->Meshes.AddDefaulted();
+                    }
+                    MeshRenderer->Meshes[0].Mesh = Mesh;
+                }
+            }
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (Json->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+                {
+                    FProperty* Property = Renderer.GetClass()->FindPropertyByName(FName(*Pair.Key));
+                    FString Error;
+                    if (!Property)
+                    {
+                        Result.Warnings.Add(FString::Printf(TEXT("%s: %s has no property '%s'"), *EmitterName,
+                            *Renderer.GetClass()->GetName(), *Pair.Key));
+                    }
+                    else if (!ApplyJsonValueToProperty(&Renderer, Property, Pair.Value, Error))
+                    {
+                        Result.Warnings.Add(FString::Printf(TEXT("%s.%s: %s"), *EmitterName, *Pair.Key, *Error));
+                    }
+                }
+            }
+        }
+
+        /** Match renderers of the same class in order, add the missing ones; with prune, remove the rest. */
+        void ApplyRenderers(UNiagaraEmitter& Emitter, const FGuid& Version, FVersionedNiagaraEmitterData& EmitterData,
+                            const FEmitterSpec& Spec, bool bPrune, FApplyResult& Result, TArray<TSharedPtr<FJsonValue>>& OutRenderers)
+        {
+            TArray<UNiagaraRendererProperties*> Existing(EmitterData.GetRenderers());
+            TSet<UNiagaraRendererProperties*> Used;
+            for (const FRendererSpec& RendererSpec : Spec.Renderers)
+            {
+                UNiagaraRendererProperties* Renderer = nullptr;
+                for (UNiagaraRendererProperties* Candidate : Existing)
+                {
+                    if (Candidate && Candidate->GetClass() == RendererSpec.Class && !Used.Contains(Candidate))
+                    {
+                        Renderer = Candidate;
+                        break;
+                    }
+                }
+                if (Renderer)
+                {
+                    Renderer->Modify();
+                    ++Result.RenderersUpdated;
+                }
+                else
+                {
+                    Renderer = NewObject<UNiagaraRendererProperties>(&Emitter, RendererSpec.Class, NAME_None, RF_Transactional);
+                    Emitter.AddRenderer(Renderer, Version);
+                    ++Result.RenderersAdded;
+                }
+                Used.Add(Renderer);
+                ApplyRendererFields(*Renderer, RendererSpec.Json, Spec.Name, Result);
+
+                TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+                Json->SetStringField(TEXT("class"), Renderer->GetClass()->GetName());
+                Json->SetStringField(TEXT("name"), Renderer->GetName());
+                OutRenderers.Add(MakeShared<FJsonValueObject>(Json));
+            }
+
+            if (bPrune && Spec.bHasRenderers)
+            {
+                for (UNiagaraRendererProperties* Renderer : Existing)
+                {
+                    if (Renderer && !Used.Contains(Renderer))
+                    {
+                        Emitter.RemoveRenderer(Renderer, Version);
+                        ++Result.RenderersRemoved;
+                    }
+                }
+            }
+        }
+
+        void ApplyEmitter(UNiagaraSystem& System, int32 HandleIndex, const FEmitterSpec& Spec, bool bPrune, FApplyResult& Result)
+        {
+            FNiagaraEmitterHandle& Handle = System.GetEmitterHandle(HandleIndex);
+            const FVersionedNiagaraEmitter Instance = Handle.GetInstance();
+            UNiagaraEmitter* Emitter = Instance.Emitter;
+            FVersionedNiagaraEmitterData* EmitterData = Handle.GetEmitterData();
+            if (!Emitter || !EmitterData)
+            {
+                Result.Warnings.Add(FString::Printf(TEXT("%s: emitter has no data"), *Spec.Name));
+                return;
+            }
+            Emitter->Modify();
+
+            bool bEnabled = true;
+            if (Spec.Json->TryGetBoolField(TEXT("enabled"), bEnabled) && Handle.GetIsEnabled() != bEnabled)
+            {
+                Handle.SetIsEnabled(bEnabled, System, false);
+            }
+
+            FString SimTarget;
+            if (Spec.Json->TryGetStringField(TEXT("simTarget"), SimTarget))
+            {
+                EmitterData->SimTarget = SimTarget.Equals(TEXT("gpu"), ESearchCase::IgnoreCase)
+                    ? ENiagaraSimTarget::GPUComputeSim : ENiagaraSimTarget::CPUSim;
+            }
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (Spec.Json->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+                {
+                    FProperty* Property = FVersionedNiagaraEmitterData::StaticStruct()->FindPropertyByName(FName(*Pair.Key));
+                    FString Error;
+                    if (ApplyJsonValueToProperty(EmitterData, Property, Pair.Value, Error))
+                    {
+                        ++Result.PropertiesSet;
+                    }
+                    else
+                    {
+                        Result.Warnings.Add(FString::Printf(TEXT("%s.%s: %s"), *Spec.Name, *Pair.Key, *Error));
+                    }
+                }
+            }
+
+            TArray<TSharedPtr<FJsonValue>> Modules;
+            TArray<TSharedPtr<FJsonValue>> Renderers;
+            if (Spec.bHasModules)
+            {
+                if (Cast<UNiagaraScriptSource>(EmitterData->GraphSource))
+                {
+                    ApplyModules(*Emitter, *EmitterData, Spec, bPrune, Result, Modules);
+                }
+                else
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: emitter has no script graph; modules skipped"), *Spec.Name));
+                }
+            }
+            ApplyRenderers(*Emitter, Instance.Version, *EmitterData, Spec, bPrune, Result, Renderers);
+
+            TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+            Json->SetStringField(TEXT("handleId"), Handle.GetId().ToString());
+            Json->SetStringField(TEXT("name"), Handle.GetName().ToString());
+            Json->SetStringField(TEXT("simTarget"), EmitterData->SimTarget == ENiagaraSimTarget::GPUComputeSim ? TEXT("gpu") : TEXT("cpu"));
+            Json->SetBoolField(TEXT("enabled"), Handle.GetIsEnabled());
+            Json->SetArrayField(TEXT("modules"), Modules);
+            Json->SetArrayField(TEXT("renderers"), Renderers);
+            Result.Emitters->SetObjectField(Spec.Name, Json);
+        }
+
+        // ---------------------------------------------------------------------
+        // Compile waits
+        // ---------------------------------------------------------------------
+
+        int32 GetRemainingShaderJobs()
+        {
+            return GShaderCompilingManager ? GShaderCompilingManager->GetNumRemainingJobs() : 0;
+        }
+
+        void CollectScripts(UNiagaraSystem& System, TArray<TPair<FString, UNiagaraScript*>>& OutScripts)
+        {
+            OutScripts.Emplace(TEXT("System"), System.GetSystemSpawnScript());
+            OutScripts.Emplace(TEXT("System"), System.GetSystemUpdateScript());
+            for (const FNiagaraEmitterHandle& Handle : System.GetEmitterHandles())
+            {
+                FVersionedNiagaraEmitterData* EmitterData = Handle.GetEmitterData();
+                if (!EmitterData || !Handle.GetIsEnabled())
+                {
+                    continue;
+                }
+                TArray<UNiagaraScript*> Scripts;
+                EmitterData->GetScripts(Scripts, true);
+                for (UNiagaraScript* Script : Scripts)
+                {
+                    OutScripts.Emplace(Handle.GetName().ToString(), Script);
+                }
+            }
+        }
+
+        void ReadCompileErrors(UNiagaraSystem& System, FCompileResult& Result)
+        {
+            TArray<TPair<FString, UNiagaraScript*>> Scripts;
+            CollectScripts(System, Scripts);
+            for (const TPair<FString, UNiagaraScript*>& Pair : Scripts)
+            {
+                UNiagaraScript* Script = Pair.Value;
+                if (!Script)
+                {
+                    continue;
+                }
+                ++Result.ScriptCount;
+                if (Script->GetLastCompileStatus() != ENiagaraScriptCompileStatus::NCS_Error)
+                {
+                    continue;
+                }
+                const FString ScriptName = FString::Printf(TEXT("%s/%s"), *Pair.Key, *StageName(Script->GetUsage()));
+                int32 Reported = 0;
+                for (const FNiagaraCompileEvent& Event : Script->GetVMExecutableData().LastCompileEvents)
+                {
+                    if (Event.Severity == FNiagaraCompileEventSeverity::Error)
+                    {
+                        Result.Errors.Add({ScriptName, Event.Message});
+                        ++Reported;
+                    }
+                }
+                if (Reported == 0)
+                {
+                    Result.Errors.Add({ScriptName, FString::Printf(TEXT("%s failed to compile"), *Script->GetName())});
+                }
+            }
+        }
+
+        void CompleteWait(TUniquePtr<FCompileWait> Wait, double Now)
+        {
+            if (Wait->ScriptsDoneSeconds > 0.0)
+            {
+                Wait->Result.ScriptSeconds = Wait->ScriptsDoneSeconds - Wait->StartSeconds;
+                Wait->Result.GpuShaderSeconds = Now - Wait->ScriptsDoneSeconds;
+            }
+            else
+            {
+                Wait->Result.ScriptSeconds = Now - Wait->StartSeconds;
+            }
+            if (UNiagaraSystem* System = Wait->System.Get())
+            {
+                ReadCompileErrors(*System, Wait->Result);
+            }
+            if (Wait->OnComplete)
+            {
+                Wait->OnComplete(Wait->Result);
+            }
+        }
+
+        void TickWaits(FState& State, double Now)
+        {
+            if (State.Waits.Num() == 0)
+            {
+                return;
+            }
+
+            const int32 RemainingJobs = GetRemainingShaderJobs();
+            TArray<TUniquePtr<FCompileWait>> Finished;
+            for (int32 Index = 0; Index < State.Waits.Num();)
+            {
+                FCompileWait& Wait = *State.Waits[Index];
+                Wait.Result.PeakShaderJobs = FMath::Max(Wait.Result.PeakShaderJobs, RemainingJobs);
+
+                bool bDone = true;
+                UNiagaraSystem* System = Wait.System.Get();
+                if (!System)
+                {
+                    Wait.Result.bSystemLost = true;
+                }
+                else
+                {
+                    // Applies finished VM compile results to the system's scripts
+                    const bool bScriptsDone = System->PollForCompilationComplete();
+                    if (bScriptsDone && Wait.ScriptsDoneSeconds <= 0.0)
+                    {
+                        Wait.ScriptsDoneSeconds = Now;
+                    }
+                    if (bScriptsDone && !System->HasOutstandingCompilationRequests(true))
+                    {
+                        Wait.Result.bFinished = true;
+                    }
+                    else if (Now - Wait.StartSeconds < Wait.TimeoutSeconds)
+                    {
+                        bDone = false;
+                        if (Wait.OnProgress && Now - Wait.LastProgressSeconds >= PROGRESS_INTERVAL_SECONDS)
+                        {
+                            Wait.LastProgressSeconds = Now;
+                            const int32 Peak = Wait.Result.PeakShaderJobs;
+                            if (!bScriptsDone)
+                            {
+                                Wait.OnProgress(0.0f, FString::Printf(TEXT("Compiling VM scripts (%.1f s)"), Now - Wait.StartSeconds));
+                            }
+                            else
+                            {
+                                const float Percent = Peak > 0 ? 50.0f + 50.0f * static_cast<float>(Peak - RemainingJobs) / Peak : 50.0f;
+                                Wait.OnProgress(Percent, FString::Printf(TEXT("Scripts compiled; GPU shaders: %d jobs remaining"),
+                                    RemainingJobs));
+                            }
+                        }
+                    }
+                }
+
+                if (bDone)
+                {
+                    Finished.Add(MoveTemp(State.Waits[Index]));
+                    State.Waits.RemoveAt(Index);
+                }
+                else
+                {
+                    ++Index;
+                }
+            }
+
+            // Complete after the sweep; completion sinks may start new waits
+            for (TUniquePtr<FCompileWait>& Wait : Finished)
+            {
+                CompleteWait(MoveTemp(Wait), Now);
+            }
+        }
+#endif // MCP_HAS_NIAGARA_SPEC
+
+        // ---------------------------------------------------------------------
+        // Benchmark
+        // ---------------------------------------------------------------------
+
+        /** Modules cycled through for generated emitters, by alias. */
+        const TCHAR* const BENCHMARK_MODULES[] = {
+            TEXT("GravityForce"), TEXT("DragForce"), TEXT("CurlNoiseForce"), TEXT("VortexForce"),
+            TEXT("PointAttractionForce"), TEXT("WindForce"), TEXT("AddVelocity"), TEXT("AddVelocityInCone"),
+            TEXT("AddVelocityFromPoint"), TEXT("InitializeParticle")
+        };
+
+        TSharedPtr<FJsonObject> MakeBenchmarkSpec(const FBenchmarkSettings& Settings)
+        {
+            TArray<TSharedPtr<FJsonValue>> Emitters;
+            TArray<TSharedPtr<FJsonValue>> Parameters;
+            for (int32 EmitterIndex = 0; EmitterIndex < Settings.EmitterCount; ++EmitterIndex)
+            {
+                TArray<TSharedPtr<FJsonValue>> Modules;
+                for (int32 ModuleIndex = 0; ModuleIndex < Settings.ModulesPerEmitter; ++ModuleIndex)
+                {
+                    const TCHAR* Alias = BENCHMARK_MODULES[ModuleIndex % UE_ARRAY_COUNT(BENCHMARK_MODULES)];
+                    TSharedPtr<FJsonObject> Module = MakeShared<FJsonObject>();
+                    Module->SetStringField(TEXT("module"), Alias);
+                    Module->SetStringField(TEXT("name"), FString::Printf(TEXT("%s_%d"), Alias, ModuleIndex));
+                    Modules.Add(MakeShared<FJsonValueObject>(Module));
+                }
+
+                TSharedPtr<FJsonObject> Sprite = MakeShared<FJsonObject>();
+                Sprite->SetStringField(TEXT("type"), TEXT("sprite"));
+
+                TSharedPtr<FJsonObject> Emitter = MakeShared<FJsonObject>();
+                Emitter->SetStringField(TEXT("name"), FString::Printf(TEXT("Bench_%d"), EmitterIndex));
+                Emitter->SetStringField(TEXT("source"), Settings.SourceEmitterPath);
+                Emitter->SetArrayField(TEXT("modules"), Modules);
+                Emitter->SetArrayField(TEXT("renderers"), TArray<TSharedPtr<FJsonValue>>{MakeShared<FJsonValueObject>(Sprite)});
+                Emitters.Add(MakeShared<FJsonValueObject>(Emitter));
+
+                TSharedPtr<FJsonObject> Parameter = MakeShared<FJsonObject>();
+                Parameter->SetStringField(TEXT("name"), FString::Printf(TEXT("Bench_%d_Rate"), EmitterIndex));
+                Parameter->SetStringField(TEXT("type"), TEXT("float"));
+                Parameter->SetNumberField(TEXT("value"), 50.0 + EmitterIndex);
+                Parameters.Add(MakeShared<FJsonValueObject>(Parameter));
+            }
+
+            TSharedPtr<FJsonObject> Spec = MakeShared<FJsonObject>();
+            Spec->SetArrayField(TEXT("emitters"), Emitters);
+            Spec->SetArrayField(TEXT("userParameters"), Parameters);
+            return Spec;
+        }
+
+        /** The spec cut into the requests the incremental actions would send. */
+        TArray<TSharedPtr<FJsonObject>> SplitSpec(const TSharedPtr<FJsonObject>& Spec)
+        {
+            TArray<TSharedPtr<FJsonObject>> Parts;
+            auto MakePart = [](const FString& Field, const TSharedPtr<FJsonObject>& Element)
+            {
+                TSharedPtr<FJsonObject> Part = MakeShared<FJsonObject>();
+                Part->SetArrayField(Field, TArray<TSharedPtr<FJsonValue>>{MakeShared<FJsonValueObject>(Element)});
+                return Part;
+            };
+
+            for (const TSharedPtr<FJsonValue>& Value : Spec->GetArrayField(TEXT("emitters")))
+            {
+                const TSharedPtr<FJsonObject> Emitter = Value->AsObject();
+                const FString Name = Emitter->GetStringField(TEXT("name"));
+
+                TSharedPtr<FJsonObject> AddEmitter = MakeShared<FJsonObject>();
+                AddEmitter->SetStringField(TEXT("name"), Name);
+                AddEmitter->SetStringField(TEXT("source"), Emitter->GetStringField(TEXT("source")));
+                Parts.Add(MakePart(TEXT("emitters"), AddEmitter));
+
+                for (const TCHAR* Field : {TEXT("modules"), TEXT("renderers")})
+                {
+                    for (const TSharedPtr<FJsonValue>& Element : Emitter->GetArrayField(Field))
+                    {
+                        TSharedPtr<FJsonObject> Part = MakeShared<FJsonObject>();
+                        Part->SetStringField(TEXT("name"), Name);
+                        Part->SetArrayField(Field, TArray<TSharedPtr<FJsonValue>>{Element});
+                        Parts.Add(MakePart(TEXT("emitters"), Part));
+                    }
+                }
+            }
+            for (const TSharedPtr<FJsonValue>& Value : Spec->GetArrayField(TEXT("userParameters")))
+            {
+                Parts.Add(MakePart(TEXT("userParameters"), Value->AsObject()));
+            }
+            return Parts;
+        }
+
+        struct FPhaseResult
+        {
+            int32 Requests = 0;
+            int32 CompileRequests = 0;
+            double AuthoringSeconds = 0.0;
+            double CompileWaitSeconds = 0.0;
+            int32 PeakShaderJobs = 0;
+            int32 CompileErrors = 0;
+            bool bFinished = false;
+
+            TSharedPtr<FJsonObject> ToJson() const
+            {
+                TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+                Json->SetNumberField(TEXT("requests"), Requests);
+                Json->SetNumberField(TEXT("compileRequests"), CompileRequests);
+                Json->SetNumberField(TEXT("authoringMs"), AuthoringSeconds * 1000.0);
+                Json->SetNumberField(TEXT("compileWaitMs"), CompileWaitSeconds * 1000.0);
+                Json->SetNumberField(TEXT("totalMs"), (AuthoringSeconds + CompileWaitSeconds) * 1000.0);
+                Json->SetNumberField(TEXT("peakShaderJobs"), PeakShaderJobs);
+                Json->SetNumberField(TEXT("compileErrors"), CompileErrors);
+                Json->SetBoolField(TEXT("compileFinished"), bFinished);
+                return Json;
+            }
+        };
+
+        struct FBenchmarkRun
+        {
+            FBenchmarkSettings Settings;
+            double StartSeconds = 0.0;
+            FProgressSink OnProgress;
+            FCompletionSink OnComplete;
+#if MCP_HAS_NIAGARA_SPEC
+            TStrongObjectPtr<UNiagaraSystem> Template;
+            TArray<TStrongObjectPtr<UNiagaraSystem>> Systems;
+#endif
+            TSharedPtr<FJsonObject> Spec;
+            FPhaseResult Batched;
+            FPhaseResult Incremental;
+        };
+
+        void FinishBenchmark(const TSharedPtr<FBenchmarkRun>& Run, bool bSuccess, const FString& Message, const FString& ErrorCode)
+        {
+            GetState().Benchmark.Reset();
+
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetNumberField(TEXT("emitterCount"), Run->Settings.EmitterCount);
+            Result->SetNumberField(TEXT("modulesPerEmitter"), Run->Settings.ModulesPerEmitter);
+            Result->SetObjectField(TEXT("batched"), Run->Batched.ToJson());
+            Result->SetObjectField(TEXT("incremental"), Run->Incremental.ToJson());
+            const double BatchedTotal = Run->Batched.AuthoringSeconds + Run->Batched.CompileWaitSeconds;
+            const double IncrementalTotal = Run->Incremental.AuthoringSeconds + Run->Incremental.CompileWaitSeconds;
+            if (bSuccess && BatchedTotal > 0.0)
+            {
+                Result->SetNumberField(TEXT("speedup"), IncrementalTotal / BatchedTotal);
+            }
+            Result->SetNumberField(TEXT("benchmarkMs"), (FPlatformTime::Seconds() - Run->StartSeconds) * 1000.0);
+
+#if MCP_HAS_NIAGARA_SPEC
+            Run->Systems.Reset();
+            Run->Template.Reset();
+#endif
+            if (Run->OnComplete)
+            {
+                Run->OnComplete(bSuccess, Message, Result, ErrorCode);
+            }
+        }
+
+#if MCP_HAS_NIAGARA_SPEC
+        /** Build the spec on a fresh transient copy of the template, then wait for its scripts. */
+        void RunPhase(const TSharedPtr<FBenchmarkRun>& Run, bool bBatched)
+        {
+            FPhaseResult& Phase = bBatched ? Run->Batched : Run->Incremental;
+            const FString Label = bBatched ? TEXT("batched") : TEXT("incremental");
+            const float ProgressBase = bBatched ? 5.0f : 52.5f;
+
+            UPackage* Package = GetTransientPackage();
+            UNiagaraSystem* System = DuplicateObject<UNiagaraSystem>(Run->Template.Get(), Package,
+                MakeUniqueObjectName(Package, UNiagaraSystem::StaticClass(), TEXT("MCP_NiagaraSpecBenchmark")));
+            if (!System)
+            {
+                FinishBenchmark(Run, false, TEXT("Could not copy the template system"), TEXT("BENCHMARK_FAILED"));
+                return;
+            }
+            System->ClearFlags(RF_Public | RF_Standalone);
+            System->SetFlags(RF_Transient);
+            Run->Systems.Emplace(System);
+
+            TArray<TSharedPtr<FJsonObject>> Parts;
+            if (bBatched)
+            {
+                Parts.Add(Run->Spec);
+            }
+            else
+            {
+                Parts = SplitSpec(Run->Spec);
+            }
+
+            FString Error, ErrorCode;
+            const double AuthoringStart = FPlatformTime::Seconds();
+            for (const TSharedPtr<FJsonObject>& Part : Parts)
+            {
+                FApplyResult Applied;
+                ++Phase.Requests;
+                if (!Apply(System, Part, Applied, Error, ErrorCode))
+                {
+                    FinishBenchmark(Run, false, FString::Printf(TEXT("Benchmark %s build failed: %s"), *Label, *Error), ErrorCode);
+                    return;
+                }
+                Phase.CompileRequests += Applied.bCompileRequested ? 1 : 0;
+            }
+            Phase.AuthoringSeconds = FPlatformTime::Seconds() - AuthoringStart;
+
+            if (Run->OnProgress)
+            {
+                Run->OnProgress(ProgressBase, FString::Printf(TEXT("%s build done in %.0f ms (%d compile requests); waiting for scripts"),
+                    *Label, Phase.AuthoringSeconds * 1000.0, Phase.CompileRequests));
+            }
+
+            const double Remaining = FMath::Max(1.0, Run->Settings.TimeoutSeconds - (FPlatformTime::Seconds() - Run->StartSeconds));
+            WaitForCompile(System, Remaining,
+                [Run, ProgressBase, Label](float Percent, const FString& Message)
+                {
+                    if (Run->OnProgress)
+                    {
+                        Run->OnProgress(ProgressBase + Percent * 0.45f, Label + TEXT(": ") + Message);
+                    }
+                },
+                [Run, bBatched](const FCompileResult& Compile)
+                {
+                    FPhaseResult& Done = bBatched ? Run->Batched : Run->Incremental;
+                    Done.CompileWaitSeconds = Compile.ScriptSeconds + Compile.GpuShaderSeconds;
+                    Done.PeakShaderJobs = Compile.PeakShaderJobs;
+                    Done.CompileErrors = Compile.Errors.Num();
+                    Done.bFinished = Compile.bFinished;
+                    if (!Compile.bFinished)
+                    {
+                        FinishBenchmark(Run, false, TEXT("Benchmark scripts did not finish compiling in time"), TEXT("TIMEOUT"));
+                    }
+                    else if (bBatched)
+                    {
+                        // Batched first: the incremental run leaves superseded compile jobs behind
+                        RunPhase(Run, false);
+                    }
+                    else
+                    {
+                        FinishBenchmark(Run, true, FString::Printf(
+                            TEXT("%d emitters x %d modules: incremental %.0f ms (%d compile requests), batched %.0f ms (1)"),
+                            Run->Settings.EmitterCount, Run->Settings.ModulesPerEmitter,
+                            (Run->Incremental.AuthoringSeconds + Run->Incremental.CompileWaitSeconds) * 1000.0,
+                            Run->Incremental.CompileRequests,
+                            (Run->Batched.AuthoringSeconds + Run->Batched.CompileWaitSeconds) * 1000.0),
+                            FString());
+                    }
+                });
+        }
+#endif // MCP_HAS_NIAGARA_SPEC
+    }
+
+    // =========================================================================
+    // Result
+    // =========================================================================
+
+    TSharedPtr<FJsonObject> FApplyResult::ToJson() const
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetNumberField(TEXT("emittersAdded"), EmittersAdded);
+        Json->SetNumberField(TEXT("emittersUpdated"), EmittersUpdated);
+        Json->SetNumberField(TEXT("emittersRemoved"), EmittersRemoved);
+        Json->SetNumberField(TEXT("modulesAdded"), ModulesAdded);
+        Json->SetNumberField(TEXT("modulesMatched"), ModulesMatched);
+        Json->SetNumberField(TEXT("modulesToggled"), ModulesToggled);
+        Json->SetNumberField(TEXT("moduleInputsSet"), ModuleInputsSet);
+        Json->SetNumberField(TEXT("renderersAdded"), RenderersAdded);
+        Json->SetNumberField(TEXT("renderersUpdated"), RenderersUpdated);
+        Json->SetNumberField(TEXT("renderersRemoved"), RenderersRemoved);
+        Json->SetNumberField(TEXT("userParametersAdded"), UserParametersAdded);
+        Json->SetNumberField(TEXT("userParametersSet"), UserParametersSet);
+        Json->SetNumberField(TEXT("userParametersRemoved"), UserParametersRemoved);
+        Json->SetNumberField(TEXT("propertiesSet"), PropertiesSet);
+        Json->SetBoolField(TEXT("compileRequested"), bCompileRequested);
+        Json->SetNumberField(TEXT("applyMs"), ApplySeconds * 1000.0);
+        Json->SetObjectField(TEXT("emitters"), Emitters.IsValid() ? Emitters : MakeShared<FJsonObject>());
+
+        TArray<TSharedPtr<FJsonValue>> WarningValues;
+        for (const FString& Warning : Warnings)
+        {
+            WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+        }
+        Json->SetArrayField(TEXT("warnings"), WarningValues);
+        return Json;
+    }
+
+    TSharedPtr<FJsonObject> CompileResultToJson(const FCompileResult& Result)
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetStringField(TEXT("systemPath"), Result.SystemPath);
+        Json->SetBoolField(TEXT("finished"), Result.bFinished);
+        Json->SetBoolField(TEXT("success"), Result.bFinished && Result.Errors.Num() == 0);
+        Json->SetNumberField(TEXT("scriptMs"), Result.ScriptSeconds * 1000.0);
+        Json->SetNumberField(TEXT("gpuShaderMs"), Result.GpuShaderSeconds * 1000.0);
+        Json->SetNumberField(TEXT("peakShaderJobs"), Result.PeakShaderJobs);
+        Json->SetNumberField(TEXT("scriptCount"), Result.ScriptCount);
+        Json->SetNumberField(TEXT("errorCount"), Result.Errors.Num());
+
+        TArray<TSharedPtr<FJsonValue>> Errors;
+        for (const FCompileError& Error : Result.Errors)
+        {
+            TSharedPtr<FJsonObject> ErrorJson = MakeShared<FJsonObject>();
+            ErrorJson->SetStringField(TEXT("script"), Error.Script);
+            ErrorJson->SetStringField(TEXT("message"), Error.Message);
+            Errors.Add(MakeShared<FJsonValueObject>(ErrorJson));
+        }
+        Json->SetArrayField(TEXT("errors"), Errors);
+        return Json;
+    }
+
+    // =========================================================================
+    // Apply
+    // =========================================================================
+
+    bool Apply(UNiagaraSystem* System, const TSharedPtr<FJsonObject>& Spec, FApplyResult& OutResult,
+               FString& OutError, FString& OutErrorCode)
+    {
+#if MCP_HAS_NIAGARA_SPEC
+        const double StartSeconds = FPlatformTime::Seconds();
+        OutResult = FApplyResult();
+        OutResult.Emitters = MakeShared<FJsonObject>();
+        OutErrorCode = TEXT("INVALID_SPEC");
+
+        if (!System || !Spec.IsValid())
+        {
+            OutError = TEXT("Missing system or spec");
+            return false;
+        }
+
+        bool bPrune = false;
+        Spec->TryGetBoolField(TEXT("prune"), bPrune);
+
+        // ---- Resolve and validate, before anything is modified -------------
+        TArray<FEmitterSpec> Emitters;
+        TSet<FString> EmitterNames;
+        const TArray<TSharedPtr<FJsonValue>>* EmitterValues = nullptr;
+        if (Spec->TryGetArrayField(TEXT("emitters"), EmitterValues))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *EmitterValues)
+            {
+                const TSharedPtr<FJsonObject>* Json = nullptr;
+                if (!Value.IsValid() || !Value->TryGetObject(Json))
+                {
+                    OutError = TEXT("'emitters' must be an array of objects");
+                    return false;
+                }
+                FEmitterSpec& Emitter = Emitters.AddDefaulted_GetRef();
+                if (!ResolveEmitter(*System, *Json, Emitter, OutError, OutErrorCode))
+                {
+                    return false;
+                }
+                bool bAlreadyListed = false;
+                EmitterNames.Add(Emitter.Name.ToLower(), &bAlreadyListed);
+                if (bAlreadyListed)
+                {
+                    OutError = FString::Printf(TEXT("Emitter '%s' is listed twice"), *Emitter.Name);
+                    return false;
+                }
+            }
+        }
+
+        TArray<FUserParameterSpec> UserParameters;
+        const TArray<TSharedPtr<FJsonValue>>* ParameterValues = nullptr;
+        if (Spec->TryGetArrayField(TEXT("userParameters"), ParameterValues))
+        {
+            for (const TSharedPtr<FJsonValue>& Value : *ParameterValues)
+            {
+                const TSharedPtr<FJsonObject>* Json = nullptr;
+                FString Name, Type;
+                if (!Value.IsValid() || !Value->TryGetObject(Json) || !(*Json)->TryGetStringField(TEXT("name"), Name) || Name.IsEmpty())
+                {
+                    OutError = TEXT("Every user parameter needs a 'name'");
+                    return false;
+                }
+                (*Json)->TryGetStringField(TEXT("type"), Type);
+
+                FUserParameterSpec& Parameter = UserParameters.AddDefaulted_GetRef();
+                FNiagaraTypeDefinition TypeDef;
+                const TSharedPtr<FJsonValue> ParameterValue = (*Json)->TryGetField(TEXT("value"));
+                Parameter.bHasValue = ParameterValue.IsValid();
+                FString Error;
+                if (Parameter.bHasValue)
+                {
+                    if (!ReadTypedValue(ParameterValue, Type.IsEmpty() ? TEXT("auto") : Type, TypeDef, Parameter.Bytes, Error))
+                    {
+                        OutError = FString::Printf(TEXT("User parameter '%s': %s"), *Name, *Error);
+                        return false;
+                    }
+                }
+                else
+                {
+                    // No value: the type alone decides, default-initialized
+                    static const TMap<FString, FNiagaraTypeDefinition> Types = {
+                        {TEXT("float"), FNiagaraTypeDefinition::GetFloatDef()},
+                        {TEXT("int"), FNiagaraTypeDefinition::GetIntDef()},
+                        {TEXT("bool"), FNiagaraTypeDefinition::GetBoolDef()},
+                        {TEXT("vector"), FNiagaraTypeDefinition::GetVec3Def()},
+                        {TEXT("color"), FNiagaraTypeDefinition::GetColorDef()}
+                    };
+                    const FNiagaraTypeDefinition* Found = Types.Find(Type.IsEmpty() ? TEXT("float") : Type.ToLower());
+                    if (!Found)
+                    {
+                        OutError = FString::Printf(TEXT("User parameter '%s': unknown type '%s'"), *Name, *Type);
+                        return false;
+                    }
+                    TypeDef = *Found;
+                }
+                Parameter.Variable = FNiagaraVariable(TypeDef, UserParameterName(Name));
+            }
+        }
+
+        const TSharedPtr<FJsonObject>* SystemProperties = nullptr;
+        if (Spec->TryGetObjectField(TEXT("systemProperties"), SystemProperties))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*SystemProperties)->Values)
+            {
+                if (!UNiagaraSystem::StaticClass()->FindPropertyByName(FName(*Pair.Key)))
+                {
+                    OutError = FString::Printf(TEXT("Niagara system has no property '%s'"), *Pair.Key);
+                    return false;
+                }
+            }
+        }
+
+        // ---- Apply in one transaction --------------------------------------
+        const FScopedTransaction Transaction(FText::FromString(TEXT("Apply Niagara Spec")));
+        System->Modify();
+        OutErrorCode.Reset();
+
+        if (SystemProperties)
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*SystemProperties)->Values)
+            {
+                FString Error;
+                if (ApplyJsonValueToProperty(System, UNiagaraSystem::StaticClass()->FindPropertyByName(FName(*Pair.Key)),
+                                             Pair.Value, Error))
+                {
+                    ++OutResult.PropertiesSet;
+                }
+                else
+                {
+                    OutResult.Warnings.Add(FString::Printf(TEXT("System.%s: %s"), *Pair.Key, *Error));
+                }
+            }
+        }
+
+        // Emitters: remove unlisted (prune), add missing, then update all listed
+        if (bPrune && EmitterValues)
+        {
+            TArray<FGuid> ToRemove;
+            for (const FNiagaraEmitterHandle& Handle : System->GetEmitterHandles())
+            {
+                if (!EmitterNames.Contains(Handle.GetName().ToString().ToLower()))
+                {
+                    ToRemove.Add(Handle.GetId());
+                }
+            }
+            for (const FGuid& Id : ToRemove)
+            {
+                for (const FNiagaraEmitterHandle& Handle : System->GetEmitterHandles())
+                {
+                    if (Handle.GetId() == Id)
+                    {
+                        System->RemoveEmitterHandle(Handle);
+                        ++OutResult.EmittersRemoved;
+                        break;
+                    }
+                }
+            }
+        }
+
+        for (const FEmitterSpec& Emitter : Emitters)
+        {
+            if (Emitter.Source)
+            {
+                const FNiagaraEmitterHandle Added = System->AddEmitterHandle(*Emitter.Source, FName(*Emitter.Name),
+                    Emitter.Source->GetExposedVersion().VersionGuid);
+                if (!Added.GetName().ToString().Equals(Emitter.Name, ESearchCase::IgnoreCase))
+                {
+                    OutResult.Warnings.Add(FString::Printf(TEXT("Emitter '%s' was added as '%s'"), *Emitter.Name,
+                        *Added.GetName().ToString()));
+                }
+                ++OutResult.EmittersAdded;
+            }
+            else
+            {
+                ++OutResult.EmittersUpdated;
+            }
+
+            const int32 HandleIndex = FindEmitterIndex(*System, Emitter.Name);
+            if (HandleIndex == INDEX_NONE)
+            {
+                OutResult.Warnings.Add(FString::Printf(TEXT("Emitter '%s' not found after adding it"), *Emitter.Name));
+                continue;
+            }
+            ApplyEmitter(*System, HandleIndex, Emitter, bPrune, OutResult);
+        }
+
+        // User parameters
+        FNiagaraUserRedirectionParameterStore& UserStore = System->GetExposedParameters();
+        TSet<FName> ListedParameters;
+        for (const FUserParameterSpec& Parameter : UserParameters)
+        {
+            ListedParameters.Add(Parameter.Variable.GetName());
+            if (!UserStore.FindParameterOffset(Parameter.Variable))
+            {
+                UserStore.AddParameter(Parameter.Variable, true);
+                ++OutResult.UserParametersAdded;
+            }
+            if (Parameter.bHasValue)
+            {
+                UserStore.SetParameterData(Parameter.Bytes.GetData(), Parameter.Variable, true);
+                ++OutResult.UserParametersSet;
+            }
+        }
+        if (bPrune && ParameterValues)
+        {
+            TArray<FNiagaraVariableBase> ToRemove;
+            for (const FNiagaraVariableWithOffset& Existing : UserStore.ReadParameterVariables())
+            {
+                if (!ListedParameters.Contains(Existing.GetName()))
+                {
+                    ToRemove.Add(Existing);
+                }
+            }
+            for (const FNiagaraVariableBase& Variable : ToRemove)
+            {
+                UserStore.RemoveParameter(Variable);
+                ++OutResult.UserParametersRemoved;
+            }
+        }
+
+        // One compile for the whole spec
+        System->RequestCompile(false);
+        System->MarkPackageDirty();
+        OutResult.bCompileRequested = true;
+        OutResult.ApplySeconds = FPlatformTime::Seconds() - StartSeconds;
+        return true;
+#else
+        OutError = TEXT("apply_niagara_spec requires the editor and UE 5.1 or later");
+        OutErrorCode = TEXT("NOT_SUPPORTED");
+        return false;
+#endif
+    }
+
+    // =========================================================================
+    // Compile waits
+    // =========================================================================
+
+    void WaitForCompile(UNiagaraSystem* System, double TimeoutSeconds, FProgressSink OnProgress,
+                        FCompileSink OnComplete)
+    {
+#if MCP_HAS_NIAGARA_SPEC
+        const double Now = FPlatformTime::Seconds();
+        TUniquePtr<FCompileWait> Wait = MakeUnique<FCompileWait>();
+        Wait->System = System;
+        Wait->StartSeconds = Now;
+        Wait->TimeoutSeconds = TimeoutSeconds;
+        Wait->Result.SystemPath = System ? System->GetPathName() : FString();
+        Wait->Result.PeakShaderJobs = GetRemainingShaderJobs();
+        Wait->OnProgress = MoveTemp(OnProgress);
+        Wait->OnComplete = MoveTemp(OnComplete);
+        if (!System)
+        {
+            Wait->Result.bSystemLost = true;
+            CompleteWait(MoveTemp(Wait), Now);
+            return;
+        }
+        GetState().Waits.Add(MoveTemp(Wait));
+#else
+        FCompileResult Result;
+        if (OnComplete)
+        {
+            OnComplete(Result);
+        }
+#endif
+    }
+
+    void Tick()
+    {
+#if MCP_HAS_NIAGARA_SPEC
+        TickWaits(GetState(), FPlatformTime::Seconds());
+#endif
+    }
+
+    // =========================================================================
+    // Benchmark
+    // =========================================================================
+
+    bool StartBenchmark(const FBenchmarkSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                        FString& OutError, FString& OutErrorCode)
+    {
+#if MCP_HAS_NIAGARA_SPEC
+        FState& State = GetState();
+        if (State.Benchmark.IsValid())
+        {
+            OutError = TEXT("A Niagara spec benchmark is already running");
+            OutErrorCode = TEXT("BENCHMARK_RUNNING");
+            return false;
+        }
+
+        const FString TemplatePath = SanitizeProjectRelativePath(Settings.TemplateSystemPath);
+        UNiagaraSystem* Template = TemplatePath.IsEmpty() ? nullptr : LoadObject<UNiagaraSystem>(nullptr, *TemplatePath);
+        if (!Template)
+        {
+            OutError = FString::Printf(TEXT("Template system '%s' not found"), *Settings.TemplateSystemPath);
+            OutErrorCode = TEXT("ASSET_NOT_FOUND");
+            return false;
+        }
+        const FString SourcePath = SanitizeProjectRelativePath(Settings.SourceEmitterPath);
+        if (SourcePath.IsEmpty() || !LoadObject<UNiagaraEmitter>(nullptr, *SourcePath))
+        {
+            OutError = FString::Printf(TEXT("Source emitter '%s' not found"), *Settings.SourceEmitterPath);
+            OutErrorCode = TEXT("ASSET_NOT_FOUND");
+            return false;
+        }
+
+        TSharedPtr<FBenchmarkRun> Run = MakeShared<FBenchmarkRun>();
+        Run->Settings = Settings;
+        Run->Settings.SourceEmitterPath = SourcePath;
+        Run->Settings.EmitterCount = FMath::Clamp(Settings.EmitterCount, 1, 16);
+        Run->Settings.ModulesPerEmitter = FMath::Clamp(Settings.ModulesPerEmitter, 1, 40);
+        Run->StartSeconds = FPlatformTime::Seconds();
+        Run->OnProgress = MoveTemp(OnProgress);
+        Run->OnComplete = MoveTemp(OnComplete);
+        Run->Template.Reset(Template);
+        Run->Spec = MakeBenchmarkSpec(Run->Settings);
+        State.Benchmark = Run;
+
+        UE_LOG(LogMcpNiagaraSpec, Log, TEXT("Niagara spec benchmark: %d emitters x %d modules on %s"),
+            Run->Settings.EmitterCount, Run->Settings.ModulesPerEmitter, *TemplatePath);
+        RunPhase(Run, true);
+        return true;
+#else
+        OutError = TEXT("benchmark_niagara_spec requires the editor and UE 5.1 or later");
+        OutErrorCode = TEXT("NOT_SUPPORTED");
+        return false;
+#endif
+    }
+
+    bool IsBenchmarkRunning()
+    {
+        return GetState().Benchmark.IsValid();
+    }
+
+    void CancelAll()
+    {
+        FState& State = GetState();
+#if MCP_HAS_NIAGARA_SPEC
+        State.Waits.Reset();
+#endif
+        TSharedPtr<FBenchmarkRun> Run = MoveTemp(State.Benchmark);
+        if (Run.IsValid())
+        {
+            Run->OnProgress = nullptr;
+            Run->OnComplete = nullptr;
+#if MCP_HAS_NIAGARA_SPEC
+            Run->Systems.Reset();
+            Run->Template.Reset();
+#endif
+        }
+    }
+}
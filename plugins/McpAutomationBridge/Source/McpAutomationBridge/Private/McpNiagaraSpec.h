@@ -0,0 +1,168 @@
+// =============================================================================
+// McpNiagaraSpec.h
+// =============================================================================
+// Declarative Niagara systems for manage_niagara_authoring apply_niagara_spec.
+//
+// The authoring actions (add_spawn_rate_module, add_force_module,
+// add_sprite_renderer_module, set_parameter_value, ...) change one thing per
+// request, and the system is recompiled for every change that reaches it. A
+// spec describes the whole system instead; Apply diffs it against the system
+// in one transaction and finishes with a single UNiagaraSystem::RequestCompile:
+//
+//   - emitters are matched by handle name; missing ones are added from their
+//     "source" emitter asset; with prune, emitters not listed are removed
+//   - modules are matched per stage by module name (or script asset);
+//     missing ones are appended to the stage; with prune, modules of an
+//     emitter that lists modules but not this one are disabled (not deleted)
+//   - module "inputs" are written as rapid iteration parameters (the values
+//     the stack shows for inputs that are not linked or dynamic)
+//   - renderers are matched by type in order; with prune, extra ones go
+//   - user parameters are matched by name; with prune, others are removed
+//
+// SPEC:
+//   {
+//     "emitters": [ {
+//       "name", "source", "enabled", "simTarget": "cpu" | "gpu",
+//       "properties": { <emitter data property>: value },
+//       "modules": [ { "module" | "script", "stage", "name", "enabled",
+//                      "inputs": { "<Input>": value | { "type", "value" } } } ],
+//       "renderers": [ { "type": sprite|mesh|ribbon|light, "material", "mesh",
+//                        "enabled", "properties": {} } ]
+//     } ],
+//     "userParameters": [ { "name", "type": float|int|bool|vector|color, "value" } ],
+//     "systemProperties": { "WarmupTime": 1.0, ... },
+//     "prune": false
+//   }
+// Stages: emitterSpawn, emitterUpdate, particleSpawn, particleUpdate.
+// "module" accepts the names the authoring actions use (SpawnRate,
+// GravityForce, AddVelocity, ...) and implies the stage; "script" takes any
+// module script asset and needs "stage".
+//
+// WaitForCompile polls the system until its VM scripts and then its GPU
+// shaders have compiled, and collects the compile errors of every script.
+//
+// Requires UE 5.1+ (versioned emitter data and the NiagaraEditor stack
+// utilities). All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UNiagaraSystem;
+
+namespace McpNiagaraSpec
+{
+    struct FApplyResult
+    {
+        int32 EmittersAdded = 0;
+        int32 EmittersUpdated = 0;
+        int32 EmittersRemoved = 0;
+        int32 ModulesAdded = 0;
+        int32 ModulesMatched = 0;
+        int32 ModulesToggled = 0;
+        int32 ModuleInputsSet = 0;
+        int32 RenderersAdded = 0;
+        int32 RenderersUpdated = 0;
+        int32 RenderersRemoved = 0;
+        int32 UserParametersAdded = 0;
+        int32 UserParametersSet = 0;
+        int32 UserParametersRemoved = 0;
+        int32 PropertiesSet = 0;
+
+        /** RequestCompile was issued; every successful apply requests exactly one. */
+        bool bCompileRequested = false;
+
+        double ApplySeconds = 0.0;
+
+        /** Emitter name -> { handleId, simTarget, modules: [{stage, name, nodeId, enabled}], renderers }. */
+        TSharedPtr<FJsonObject> Emitters;
+
+        /** Non-fatal problems: unknown properties or inputs, overridden inputs. */
+        TArray<FString> Warnings;
+
+        TSharedPtr<FJsonObject> ToJson() const;
+    };
+
+    struct FCompileError
+    {
+        FString Script;
+        FString Message;
+    };
+
+    struct FCompileResult
+    {
+        FString SystemPath;
+
+        /** VM scripts and GPU shaders finished before the wait ended. */
+        bool bFinished = false;
+
+        /** The system was garbage collected during the wait. */
+        bool bSystemLost = false;
+
+        double ScriptSeconds = 0.0;
+        double GpuShaderSeconds = 0.0;
+
+        /** Largest number of shader jobs queued in the compiling manager during the wait. */
+        int32 PeakShaderJobs = 0;
+
+        int32 ScriptCount = 0;
+        TArray<FCompileError> Errors;
+    };
+
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+    using FCompileSink = TFunction<void(const FCompileResult& Result)>;
+    using FCompletionSink = TFunction<void(bool bSuccess, const FString& Message,
+                                           const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)>;
+
+    /**
+     * Diff Spec against System and apply it in one transaction, then request
+     * one compile. Emitter sources, module scripts and renderer types are
+     * resolved before anything changes; on failure nothing is modified and
+     * OutError / OutErrorCode describe the problem.
+     */
+    bool Apply(UNiagaraSystem* System, const TSharedPtr<FJsonObject>& Spec, FApplyResult& OutResult,
+               FString& OutError, FString& OutErrorCode);
+
+    /**
+     * Report progress until System's VM scripts and GPU shaders have
+     * compiled, or TimeoutSeconds pass. OnComplete runs on a later tick.
+     */
+    void WaitForCompile(UNiagaraSystem* System, double TimeoutSeconds, FProgressSink OnProgress,
+                        FCompileSink OnComplete);
+
+    struct FBenchmarkSettings
+    {
+        /** System duplicated (transient) for both runs; it is not modified. */
+        FString TemplateSystemPath;
+        /** Emitter asset every generated emitter is added from. */
+        FString SourceEmitterPath;
+        int32 EmitterCount = 3;
+        int32 ModulesPerEmitter = 10;
+        double TimeoutSeconds = 240.0;
+    };
+
+    /**
+     * Build the same system twice on transient copies of the template: once
+     * with one apply (and one RequestCompile) per emitter, module, renderer
+     * and parameter, as the incremental actions do, and once with a single
+     * apply. Each run waits for its scripts; the report has authoring,
+     * compile wait and total time of both.
+     */
+    bool StartBenchmark(const FBenchmarkSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                        FString& OutError, FString& OutErrorCode);
+
+    bool IsBenchmarkRunning();
+
+    /** Drop waits and the benchmark (subsystem shutdown). Completions are not reported. */
+    void CancelAll();
+
+    /** Advance compile waits. Called from the subsystem ticker. */
+    void Tick();
+
+    TSharedPtr<FJsonObject> CompileResultToJson(const FCompileResult& Result);
+}
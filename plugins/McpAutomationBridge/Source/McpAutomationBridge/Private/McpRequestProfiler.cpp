@@ -0,0 +1,489 @@
+// =============================================================================
+// McpRequestProfiler.cpp
+// =============================================================================
+// Implementation of per-request phase timing and the McpRequest trace channel.
+// =============================================================================
+
+#include "McpRequestProfiler.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/DateTime.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Trace/Trace.inl"
+
+#if UE_TRACE_ENABLED
+UE_TRACE_CHANNEL(McpRequestChannel)
+
+UE_TRACE_EVENT_BEGIN(McpAutomation, RequestPhase)
+    UE_TRACE_EVENT_FIELD(uint64, StartCycle)
+    UE_TRACE_EVENT_FIELD(uint64, EndCycle)
+    UE_TRACE_EVENT_FIELD(uint32, ThreadId)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, RequestId)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Action)
+    UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Phase)
+UE_TRACE_EVENT_END()
+#endif
+
+namespace McpRequestProfiler
+{
+    namespace
+    {
+        constexpr int32 HistoryCapacity = 256;
+        constexpr int32 NumPhases = static_cast<int32>(EPhase::Count);
+
+        /** Requests that never get a response are dropped after this long. */
+        constexpr double StaleRequestSeconds = 600.0;
+
+        struct FRecord
+        {
+            FString RequestId;
+            FString Action;
+            FString Handler;
+            FString ErrorCode;
+            FDateTime ReceivedAt;
+            /** Platform time when the message finished parsing. */
+            double ReceivedSeconds = 0.0;
+            double PhaseSeconds[NumPhases] = {};
+            double TotalSeconds = 0.0;
+            bool bSuccess = false;
+            bool bDispatched = false;
+            bool bDispatching = false;
+            bool bResponded = false;
+        };
+
+        struct FState
+        {
+            FCriticalSection Mutex;
+            TMap<FString, FRecord> Active;
+            TArray<FRecord> History;
+            int32 NextHistoryIndex = 0;
+            int64 TotalCompleted = 0;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        /** Open phases on this thread (child seconds per depth) and the request being dispatched. */
+        struct FThreadState
+        {
+            TArray<double> ChildSeconds;
+            FString RequestId;
+            FString Action;
+        };
+
+        FThreadState& GetThreadState()
+        {
+            static thread_local FThreadState State;
+            return State;
+        }
+
+        double RoundMs(double Seconds)
+        {
+            return FMath::RoundToDouble(Seconds * 1000000.0) / 1000.0;
+        }
+
+        FRecord& FindOrAddActive(FState& State, const FString& RequestId, const FString& Action)
+        {
+            if (FRecord* Existing = State.Active.Find(RequestId))
+            {
+                return *Existing;
+            }
+            FRecord& Record = State.Active.Add(RequestId);
+            Record.RequestId = RequestId;
+            Record.Action = Action;
+            Record.ReceivedAt = FDateTime::UtcNow();
+            Record.ReceivedSeconds = FPlatformTime::Seconds();
+            return Record;
+        }
+
+        void PruneStale(FState& State, double NowSeconds)
+        {
+            for (auto It = State.Active.CreateIterator(); It; ++It)
+            {
+                if (!It.Value().bDispatching && NowSeconds - It.Value().ReceivedSeconds > StaleRequestSeconds)
+                {
+                    It.RemoveCurrent();
+                }
+            }
+        }
+
+        /** Move a finished request into the ring. Caller holds the mutex. */
+        void Finalize(FState& State, const FString& RequestId)
+        {
+            FRecord Record;
+            if (!State.Active.RemoveAndCopyValue(RequestId, Record))
+            {
+                return;
+            }
+
+            Record.TotalSeconds = FPlatformTime::Seconds() - Record.ReceivedSeconds +
+                                  Record.PhaseSeconds[static_cast<int32>(EPhase::Parse)];
+            double Attributed = 0.0;
+            for (int32 Index = 0; Index < NumPhases; ++Index)
+            {
+                Attributed += Record.PhaseSeconds[Index];
+            }
+            Record.PhaseSeconds[static_cast<int32>(EPhase::Async)] +=
+                FMath::Max(0.0, Record.TotalSeconds - Attributed);
+
+            if (State.History.Num() < HistoryCapacity)
+            {
+                State.History.Add(MoveTemp(Record));
+            }
+            else
+            {
+                State.History[State.NextHistoryIndex] = MoveTemp(Record);
+            }
+            State.NextHistoryIndex = (State.NextHistoryIndex + 1) % HistoryCapacity;
+            ++State.TotalCompleted;
+        }
+
+        TSharedPtr<FJsonObject> RecordToJson(const FRecord& Record)
+        {
+            TSharedPtr<FJsonObject> Obj = MakeShared<FJsonObject>();
+            Obj->SetStringField(TEXT("requestId"), Record.RequestId);
+            Obj->SetStringField(TEXT("action"), Record.Action);
+            Obj->SetStringField(TEXT("handler"), Record.Handler);
+            Obj->SetBoolField(TEXT("success"), Record.bSuccess);
+            if (!Record.ErrorCode.IsEmpty())
+            {
+                Obj->SetStringField(TEXT("error"), Record.ErrorCode);
+            }
+            Obj->SetStringField(TEXT("receivedAt"), Record.ReceivedAt.ToIso8601());
+            Obj->SetNumberField(TEXT("totalMs"), RoundMs(Record.TotalSeconds));
+
+            TSharedPtr<FJsonObject> Phases = MakeShared<FJsonObject>();
+            int32 Slowest = 0;
+            for (int32 Index = 0; Index < NumPhases; ++Index)
+            {
+                Phases->SetNumberField(GetPhaseName(static_cast<EPhase>(Index)), RoundMs(Record.PhaseSeconds[Index]));
+                if (Record.PhaseSeconds[Index] > Record.PhaseSeconds[Slowest])
+                {
+                    Slowest = Index;
+                }
+            }
+            Obj->SetObjectField(TEXT("phasesMs"), Phases);
+            Obj->SetStringField(TEXT("slowestPhase"), GetPhaseName(static_cast<EPhase>(Slowest)));
+            return Obj;
+        }
+
+        void TraceRequestPhase(const FString& RequestId, const FString& Action, EPhase Phase,
+                               uint64 StartCycles, uint64 EndCycles)
+        {
+#if UE_TRACE_ENABLED
+            UE_TRACE_LOG(McpAutomation, RequestPhase, McpRequestChannel)
+                << RequestPhase.StartCycle(StartCycles)
+                << RequestPhase.EndCycle(EndCycles)
+                << RequestPhase.ThreadId(FPlatformTLS::GetCurrentThreadId())
+                << RequestPhase.RequestId(*RequestId, RequestId.Len())
+                << RequestPhase.Action(*Action, Action.Len())
+                << RequestPhase.Phase(GetPhaseName(Phase));
+#endif
+        }
+    }
+
+    const TCHAR* GetPhaseName(EPhase Phase)
+    {
+        static const TCHAR* Names[] = {
+            TEXT("parse"), TEXT("queue"), TEXT("dispatch"), TEXT("handler"), TEXT("compile"),
+            TEXT("save"), TEXT("serialize"), TEXT("send"), TEXT("async")
+        };
+        static_assert(UE_ARRAY_COUNT(Names) == NumPhases, "Phase names out of sync with EPhase");
+        const int32 Index = static_cast<int32>(Phase);
+        return Index >= 0 && Index < NumPhases ? Names[Index] : TEXT("unknown");
+    }
+
+    bool IsTraceChannelEnabled()
+    {
+#if UE_TRACE_ENABLED
+        return UE_TRACE_CHANNELEXPR_IS_ENABLED(McpRequestChannel);
+#else
+        return false;
+#endif
+    }
+
+    void BeginRequest(const FString& RequestId, const FString& Action, double ParseSeconds)
+    {
+        if (RequestId.IsEmpty())
+        {
+            return;
+        }
+
+        FState& State = GetState();
+        const double NowSeconds = FPlatformTime::Seconds();
+        {
+            FScopeLock Lock(&State.Mutex);
+            if (State.Active.Num() >= HistoryCapacity)
+            {
+                PruneStale(State, NowSeconds);
+            }
+            FRecord& Record = FindOrAddActive(State, RequestId, Action);
+            Record.ReceivedAt -= FTimespan::FromSeconds(ParseSeconds);
+            Record.PhaseSeconds[static_cast<int32>(EPhase::Parse)] = ParseSeconds;
+        }
+
+        if (IsTraceChannelEnabled())
+        {
+            const uint64 EndCycles = FPlatformTime::Cycles64();
+            const uint64 ParseCycles = static_cast<uint64>(ParseSeconds / FPlatformTime::GetSecondsPerCycle64());
+            TraceRequestPhase(RequestId, Action, EPhase::Parse, EndCycles - FMath::Min(ParseCycles, EndCycles), EndCycles);
+        }
+    }
+
+    void SetHandler(const FString& RequestId, const FString& Handler)
+    {
+        FState& State = GetState();
+        FScopeLock Lock(&State.Mutex);
+        if (FRecord* Record = State.Active.Find(RequestId))
+        {
+            Record->Handler = Handler;
+        }
+    }
+
+    void EndRequest(const FString& RequestId, bool bSuccess, const FString& ErrorCode)
+    {
+        FState& State = GetState();
+        FScopeLock Lock(&State.Mutex);
+        FRecord* Record = State.Active.Find(RequestId);
+        if (!Record || Record->bResponded)
+        {
+            return;
+        }
+        Record->bResponded = true;
+        Record->bSuccess = bSuccess;
+        Record->ErrorCode = ErrorCode;
+        if (!Record->bDispatching)
+        {
+            Finalize(State, RequestId);
+        }
+    }
+
+    TSharedPtr<FJsonObject> GetProfile(int32 Limit, const FString& ActionFilter)
+    {
+        Limit = FMath::Clamp(Limit, 1, HistoryCapacity);
+
+        FState& State = GetState();
+        TArray<TSharedPtr<FJsonValue>> Requests;
+        double PhaseTotals[NumPhases] = {};
+        double PhaseMax[NumPhases] = {};
+        double TotalSeconds = 0.0;
+        int32 Recorded = 0;
+        int32 InFlight = 0;
+        int64 TotalCompleted = 0;
+        {
+            FScopeLock Lock(&State.Mutex);
+            Recorded = State.History.Num();
+            InFlight = State.Active.Num();
+            TotalCompleted = State.TotalCompleted;
+
+            // Walk the ring backwards from the newest entry
+            for (int32 Offset = 1; Offset <= Recorded && Requests.Num() < Limit; ++Offset)
+            {
+                const int32 Index = (State.NextHistoryIndex - Offset + HistoryCapacity) % HistoryCapacity;
+                if (!State.History.IsValidIndex(Index))
+                {
+                    continue;
+                }
+                const FRecord& Record = State.History[Index];
+                if (!ActionFilter.IsEmpty() && !Record.Action.Equals(ActionFilter, ESearchCase::IgnoreCase))
+                {
+                    continue;
+                }
+                Requests.Add(MakeShared<FJsonValueObject>(RecordToJson(Record)));
+                TotalSeconds += Record.TotalSeconds;
+                for (int32 Phase = 0; Phase < NumPhases; ++Phase)
+                {
+                    PhaseTotals[Phase] += Record.PhaseSeconds[Phase];
+                    PhaseMax[Phase] = FMath::Max(PhaseMax[Phase], Record.PhaseSeconds[Phase]);
+                }
+            }
+        }
+
+        // Where the returned requests spent their time, in aggregate
+        TSharedPtr<FJsonObject> Summary = MakeShared<FJsonObject>();
+        const int32 Count = Requests.Num();
+        for (int32 Phase = 0; Phase < NumPhases; ++Phase)
+        {
+            TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetNumberField(TEXT("totalMs"), RoundMs(PhaseTotals[Phase]));
+            Entry->SetNumberField(TEXT("avgMs"), Count > 0 ? RoundMs(PhaseTotals[Phase] / Count) : 0.0);
+            Entry->SetNumberField(TEXT("maxMs"), RoundMs(PhaseMax[Phase]));
+            Entry->SetNumberField(TEXT("percent"),
+                                  TotalSeconds > 0.0 ? FMath::RoundToDouble(PhaseTotals[Phase] / TotalSeconds * 1000.0) / 10.0 : 0.0);
+            Summary->SetObjectField(GetPhaseName(static_cast<EPhase>(Phase)), Entry);
+        }
+
+        TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+        Result->SetArrayField(TEXT("requests"), Requests);
+        Result->SetNumberField(TEXT("count"), Count);
+        Result->SetNumberField(TEXT("recorded"), Recorded);
+        Result->SetNumberField(TEXT("capacity"), HistoryCapacity);
+        Result->SetNumberField(TEXT("totalCompleted"), static_cast<double>(TotalCompleted));
+        Result->SetNumberField(TEXT("inFlight"), InFlight);
+        Result->SetNumberField(TEXT("totalMs"), RoundMs(TotalSeconds));
+        Result->SetNumberField(TEXT("avgTotalMs"), Count > 0 ? RoundMs(TotalSeconds / Count) : 0.0);
+        Result->SetObjectField(TEXT("phaseSummary"), Summary);
+        Result->SetStringField(TEXT("traceChannel"), TEXT("McpRequest"));
+        Result->SetBoolField(TEXT("traceChannelEnabled"), IsTraceChannelEnabled());
+        return Result;
+    }
+
+    void Reset()
+    {
+        FState& State = GetState();
+        FScopeLock Lock(&State.Mutex);
+        State.History.Reset();
+        State.NextHistoryIndex = 0;
+        State.TotalCompleted = 0;
+    }
+
+    FScopedRequest::FScopedRequest(const FString& RequestId, const FString& Action)
+    {
+        FThreadState& Thread = GetThreadState();
+        PreviousRequestId = MoveTemp(Thread.RequestId);
+        PreviousAction = MoveTemp(Thread.Action);
+        Thread.RequestId = RequestId;
+        Thread.Action = Action;
+
+        if (RequestId.IsEmpty())
+        {
+            return;
+        }
+
+        FState& State = GetState();
+        {
+            FScopeLock Lock(&State.Mutex);
+            // Requests from the native HTTP transport skip BeginRequest
+            FRecord& Record = FindOrAddActive(State, RequestId, Action);
+            if (!Record.bDispatched)
+            {
+                Record.bDispatched = true;
+                Record.PhaseSeconds[static_cast<int32>(EPhase::Queue)] =
+                    FMath::Max(0.0, FPlatformTime::Seconds() - Record.ReceivedSeconds);
+            }
+            Record.bDispatching = true;
+        }
+
+        if (IsTraceChannelEnabled())
+        {
+            TRACE_BOOKMARK(TEXT("MCP %s %s"), *Action, *RequestId);
+        }
+    }
+
+    FScopedRequest::~FScopedRequest()
+    {
+        FThreadState& Thread = GetThreadState();
+        if (!Thread.RequestId.IsEmpty())
+        {
+            FState& State = GetState();
+            FScopeLock Lock(&State.Mutex);
+            if (FRecord* Record = State.Active.Find(Thread.RequestId))
+            {
+                Record->bDispatching = false;
+                if (Record->bResponded)
+                {
+                    Finalize(State, Thread.RequestId);
+                }
+            }
+        }
+        Thread.RequestId = MoveTemp(PreviousRequestId);
+        Thread.Action = MoveTemp(PreviousAction);
+    }
+
+    FPhaseScope::FPhaseScope(EPhase InPhase, const TCHAR* Label)
+        : Phase(InPhase)
+    {
+        const FThreadState& Thread = GetThreadState();
+        RequestId = Thread.RequestId;
+        Action = Thread.Action;
+        Begin(Label);
+    }
+
+    FPhaseScope::FPhaseScope(EPhase InPhase, const FString& InRequestId)
+        : Phase(InPhase)
+        , RequestId(InRequestId)
+    {
+        const FThreadState& Thread = GetThreadState();
+        if (Thread.RequestId == RequestId)
+        {
+            Action = Thread.Action;
+        }
+        else if (!RequestId.IsEmpty() && IsTraceChannelEnabled())
+        {
+            // Only needed to name the trace scope
+            FState& State = GetState();
+            FScopeLock Lock(&State.Mutex);
+            if (const FRecord* Record = State.Active.Find(RequestId))
+            {
+                Action = Record->Action;
+            }
+        }
+        Begin(nullptr);
+    }
+
+    void FPhaseScope::Begin(const TCHAR* Label)
+    {
+        FThreadState& Thread = GetThreadState();
+        Depth = Thread.ChildSeconds.Add(0.0);
+
+#if CPUPROFILERTRACE_ENABLED
+        if (IsTraceChannelEnabled())
+        {
+            const FString ScopeName = FString::Printf(TEXT("MCP %s (%s)"),
+                                                      Label ? Label : GetPhaseName(Phase),
+                                                      Action.IsEmpty() ? TEXT("-") : *Action);
+            FCpuProfilerTrace::OutputBeginDynamicEvent(*ScopeName);
+            bTraced = true;
+        }
+#endif
+        StartCycles = FPlatformTime::Cycles64();
+    }
+
+    FPhaseScope::~FPhaseScope()
+    {
+        const uint64 EndCycles = FPlatformTime::Cycles64();
+        const double Elapsed = FPlatformTime::ToSeconds64(EndCycles - StartCycles);
+
+        // Charge only the time not spent in nested phases; the parent is
+        // told about the whole scope so it can do the same.
+        FThreadState& Thread = GetThreadState();
+        double ChildSeconds = 0.0;
+        if (Thread.ChildSeconds.IsValidIndex(Depth))
+        {
+            ChildSeconds = Thread.ChildSeconds[Depth];
+            Thread.ChildSeconds.SetNum(Depth);
+        }
+        if (Depth > 0 && Thread.ChildSeconds.IsValidIndex(Depth - 1))
+        {
+            Thread.ChildSeconds[Depth - 1] += Elapsed;
+        }
+
+#if CPUPROFILERTRACE_ENABLED
+        if (bTraced)
+        {
+            FCpuProfilerTrace::OutputEndEvent();
+            TraceRequestPhase(RequestId, Action, Phase, StartCycles, EndCycles);
+        }
+#endif
+
+        if (RequestId.IsEmpty())
+        {
+            return;
+        }
+
+        FState& State = GetState();
+        FScopeLock Lock(&State.Mutex);
+        if (FRecord* Record = State.Active.Find(RequestId))
+        {
+            Record->PhaseSeconds[static_cast<int32>(Phase)] += FMath::Max(0.0, Elapsed - ChildSeconds);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+// =============================================================================
+// McpRequestProfiler.h
+// =============================================================================
+// Per-request phase timing for automation requests.
+//
+// Every request is split into phases:
+//
+//   parse      - JSON parse of the incoming message (socket thread)
+//   queue      - waiting for the game thread or behind another request
+//   dispatch   - routing, error capture and bookkeeping around the handler
+//   handler    - the handler that consumed the request
+//   compile    - Blueprint compiles run inside the request
+//   save       - asset and level saves run inside the request
+//   serialize  - serializing the response JSON
+//   send       - writing the response to the socket
+//   async      - time between dispatch returning and the response being sent
+//                (handlers that finish their work on a later tick)
+//
+// Phases nest: a save inside a handler is charged to "save" and subtracted
+// from "handler", so the phases of a request add up to its total time.
+// Completed requests are kept in a fixed-size ring for get_request_profile.
+//
+// Each phase is also a CPU profiler scope named after the phase and action,
+// and a RequestPhase event carrying the RequestId, emitted on the "McpRequest"
+// trace channel (enable it with -trace=cpu,mcprequest or Trace.Enable). A
+// bookmark marks the start of every request. Nothing is traced while the
+// channel is off; the ring is always recorded.
+//
+// Request bookkeeping is thread-safe. Phase scopes nest per thread.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpRequestProfiler
+{
+    enum class EPhase : uint8
+    {
+        Parse,
+        Queue,
+        Dispatch,
+        Handler,
+        Compile,
+        Save,
+        Serialize,
+        Send,
+        Async,
+        Count
+    };
+
+    /** Lower-case phase name used in results and trace scopes. */
+    const TCHAR* GetPhaseName(EPhase Phase);
+
+    /** Start tracking a request once its message has been parsed. Any thread. */
+    void BeginRequest(const FString& RequestId, const FString& Action, double ParseSeconds);
+
+    /** Name the handler that consumed the request. */
+    void SetHandler(const FString& RequestId, const FString& Handler);
+
+    /**
+     * The response for the request has been sent. The request moves to the
+     * history ring now, or when its dispatch scope ends if the response was
+     * sent from inside the handler.
+     */
+    void EndRequest(const FString& RequestId, bool bSuccess, const FString& ErrorCode);
+
+    /** Most recent completed requests, newest first, optionally for one action. */
+    TSharedPtr<FJsonObject> GetProfile(int32 Limit, const FString& ActionFilter);
+
+    void Reset();
+
+    /** Whether the McpRequest trace channel is enabled. */
+    bool IsTraceChannelEnabled();
+
+    /**
+     * Dispatch of one request on the game thread. Phase scopes opened on this
+     * thread while it is alive are charged to the request. Records the queue
+     * time; the request's response completes it when the scope ends.
+     */
+    struct FScopedRequest
+    {
+        FScopedRequest(const FString& RequestId, const FString& Action);
+        ~FScopedRequest();
+
+        FScopedRequest(const FScopedRequest&) = delete;
+        FScopedRequest& operator=(const FScopedRequest&) = delete;
+
+    private:
+        FString PreviousRequestId;
+        FString PreviousAction;
+    };
+
+    /**
+     * Times one phase of the current request (or of RequestId when given).
+     * Label names the CPU profiler scope instead of the phase, e.g. the
+     * handler function being tried.
+     */
+    struct FPhaseScope
+    {
+        explicit FPhaseScope(EPhase InPhase, const TCHAR* Label = nullptr);
+        FPhaseScope(EPhase InPhase, const FString& InRequestId);
+        ~FPhaseScope();
+
+        /** Charge the elapsed time to a different phase when the scope ends. */
+        void SetPhase(EPhase InPhase) { Phase = InPhase; }
+
+        FPhaseScope(const FPhaseScope&) = delete;
+        FPhaseScope& operator=(const FPhaseScope&) = delete;
+
+    private:
+        void Begin(const TCHAR* Label);
+
+        EPhase Phase;
+        FString RequestId;
+        FString Action;
+        uint64 StartCycles = 0;
+        int32 Depth = 0;
+        bool bTraced = false;
+    };
+}
@@ -4,7 +4,8 @@
 // Safe asset and level operations with UE 5.7+ compatibility
 //
 // CRITICAL for UE 5.7+:
-// - McpSafeAssetSave() - Replaces UEditorAssetLibrary::SaveAsset() to avoid crashes
+// - McpSafeAssetSave() - Replaces UEditorAssetLibrary::SaveAsset() to avoid crashes;
+//   coalesced into batched saves by McpSaveCoordinator
 // - McpSafeLevelSave() - Safe level saving with render thread synchronization
 // - McpSafeLoadMap() - Safe map loading with TickTaskManager cleanup
 //
@@ -21,6 +22,8 @@
 
 // Include version compatibility macros FIRST before other engine includes
 #include "McpVersionCompatibility.h"
+#include "McpRequestProfiler.h"
+#include "McpSaveCoordinator.h"
 
 #if WITH_EDITOR
 #include "AssetRegistry/AssetData.h"
@@ -127,8 +130,9 @@ namespace McpSafeOperations
 #if WITH_EDITOR
 
 /**
- * Safe asset saving helper - marks package dirty, registers the asset, and
- * persists the owning package through the editor's save flow.
+ * Save one asset right now - marks package dirty, registers the asset, and
+ * persists the owning package through the editor's save flow, then rescans
+ * the package folder.
  * 
  * CRITICAL FOR UE 5.7+:
  * DO NOT use raw UPackage::SavePackage(). Use the editor-owned package save path
@@ -137,13 +141,15 @@ namespace McpSafeOperations
  * @param Asset The UObject asset to save
  * @returns true if the asset package was saved successfully
  */
-inline bool McpSafeAssetSave(UObject* Asset)
+inline bool McpSaveAssetImmediate(UObject* Asset)
 {
     if (!Asset)
     {
         return false;
     }
 
+    McpRequestProfiler::FPhaseScope SavePhase(McpRequestProfiler::EPhase::Save);
+
     Asset->MarkPackageDirty();
     FAssetRegistryModule::AssetCreated(Asset);
 
@@ -162,6 +168,7 @@ inline bool McpSafeAssetSave(UObject* Asset)
             FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
         AssetRegistryModule.Get().ScanPathsSynchronous(PathsToScan, false);
     }
+    McpSaveCoordinator::NoteImmediateSave(bSaved);
 
     return bSaved;
 #else
@@ -169,6 +176,55 @@ inline bool McpSafeAssetSave(UObject* Asset)
 #endif
 }
 
+/** Outcome of McpRequestAssetSave. */
+enum class EMcpAssetSaveResult : uint8
+{
+    Failed,
+    Saved,
+    /** Written by the next coalesced flush; failures are reported to the request then. */
+    Queued
+};
+
+/**
+ * Save an asset, or queue it while save coalescing is active (see
+ * McpSaveCoordinator.h). Queued packages are marked dirty and registered with
+ * the asset registry now and written in the next batched flush.
+ *
+ * @param Asset The UObject asset to save
+ * @returns whether the package was saved, queued, or failed to save
+ */
+inline EMcpAssetSaveResult McpRequestAssetSave(UObject* Asset)
+{
+    if (!Asset)
+    {
+        return EMcpAssetSaveResult::Failed;
+    }
+
+    if (McpSaveCoordinator::IsDeferring())
+    {
+        McpSaveCoordinator::Enqueue(Asset);
+        return EMcpAssetSaveResult::Queued;
+    }
+
+    return McpSaveAssetImmediate(Asset) ? EMcpAssetSaveResult::Saved : EMcpAssetSaveResult::Failed;
+}
+
+/**
+ * Safe asset saving helper used by all handlers.
+ *
+ * Returns true for queued saves too. The response of a request whose saves
+ * are still queued is rewritten to saved=false, saveQueued=true by
+ * McpSaveCoordinator::AnnotateResponse; handlers that report the outcome
+ * themselves use McpRequestAssetSave.
+ *
+ * @param Asset The UObject asset to save
+ * @returns true if the asset was queued or its package was saved successfully
+ */
+inline bool McpSafeAssetSave(UObject* Asset)
+{
+    return McpRequestAssetSave(Asset) != EMcpAssetSaveResult::Failed;
+}
+
 /**
  * Safely save a level with UE 5.7+ compatibility workarounds.
  *
@@ -194,6 +250,14 @@ inline bool McpSafeLevelSave(ULevel* Level, const FString& FullPath, int32 MaxRe
         return false;
     }
 
+    McpRequestProfiler::FPhaseScope SavePhase(McpRequestProfiler::EPhase::Save);
+
+    // Levels reference assets that may still be waiting in the save queue
+    if (IsInGameThread())
+    {
+        McpSaveCoordinator::Flush(TEXT("level_save"));
+    }
+
     // CRITICAL: Reject transient/unsaved level paths that would cause double-slash package names
     if (FullPath.StartsWith(TEXT("/Temp/")) ||
         FullPath.StartsWith(TEXT("/Engine/Transient")) ||
@@ -387,6 +451,9 @@ inline bool McpSafeLoadMap(const FString& MapPath, bool bForceCleanup = true)
         return false;
     }
 
+    // Write queued asset saves before the world (and anything it owns) is torn down
+    McpSaveCoordinator::Flush(TEXT("map_load"));
+
     // CRITICAL: Wait for any async loading to complete
     int32 AsyncWaitCount = 0;
     while (IsAsyncLoading() && AsyncWaitCount < 100)
@@ -563,12 +630,12 @@ inline UMaterialInterface* McpLoadMaterialWithFallback(const FString& MaterialPa
 }
 
 /**
- * Throttled wrapper around McpSafeAssetSave to avoid rapid repeated save calls.
+ * Wrapper around McpSafeAssetSave for handlers that may save the same asset repeatedly.
  *
  * @param Asset The asset to save
  * @param ThrottleSecondsOverride Override throttle time (default uses global setting)
- * @param bForce If true, ignore throttling and force immediate save
- * @return true if save succeeded or was skipped due to throttle
+ * @param bForce If true, flush the save queue (including this asset) before returning
+ * @return true if the save was queued or succeeded
  */
 inline bool SaveLoadedAssetThrottled(UObject* Asset, double ThrottleSecondsOverride = -1.0, bool bForce = false)
 {
@@ -577,10 +644,17 @@ inline bool SaveLoadedAssetThrottled(UObject* Asset, double ThrottleSecondsOverr
         return false;
     }
 
-    // Throttling parameters reserved for future implementation.
-    // For now this always uses the real editor-owned save path.
-    (void)ThrottleSecondsOverride; // Reserved for throttle duration override
-    (void)bForce; // Reserved for forcing immediate save bypassing throttle
+    // Repeated saves of the same package within a flush window collapse into
+    // one write in McpSaveCoordinator, which replaces timestamp throttling.
+    (void)ThrottleSecondsOverride; // Kept for API compatibility
+
+    if (bForce && McpSaveCoordinator::IsDeferring())
+    {
+        // Write this asset together with everything already queued
+        McpSaveCoordinator::Enqueue(Asset);
+        const McpSaveCoordinator::FFlushResult Result = McpSaveCoordinator::Flush(TEXT("forced"));
+        return !Result.FailedPackages.Contains(Asset->GetOutermost()->GetName());
+    }
 
     return McpSafeAssetSave(Asset);
 }
@@ -2154,6 +2228,7 @@ UE_LOG(LogMcpSafeOperations, Warning, TEXT("McpSafeDeleteFolder: Remaining asset
 #else
 
 // Non-editor stubs
+inline bool McpSaveAssetImmediate(void* Asset) { return false; }
 inline bool McpSafeAssetSave(void* Asset) { return false; }
 inline bool McpSafeLevelSave(void* Level, const FString& Path, int32 = 1) { return false; }
 inline bool McpSafeLoadMap(const FString& MapPath, bool = true) { return false; }
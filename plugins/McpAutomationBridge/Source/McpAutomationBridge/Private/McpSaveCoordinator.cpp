@@ -0,0 +1,461 @@
+// =============================================================================
+// McpSaveCoordinator.cpp
+// =============================================================================
+// Implementation of the deferred, coalescing asset save queue.
+// =============================================================================
+
+#include "McpSaveCoordinator.h"
+#include "McpAutomationBridgeSettings.h"
+#include "McpCompileScheduler.h"
+#include "McpRequestProfiler.h"
+#include "McpSafeOperations.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "UObject/GarbageCollection.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/WeakObjectPtr.h"
+
+namespace McpSaveCoordinator
+{
+    namespace
+    {
+        struct FPendingSave
+        {
+            TWeakObjectPtr<UObject> Asset;
+
+            /** Requests that queued this package, oldest first. */
+            TArray<FString> RequestIds;
+        };
+
+        /** Failed packages kept for get_save_queue. */
+        constexpr int32 MaxRecentFailures = 32;
+
+        struct FState
+        {
+            /** Queued packages keyed by package name; insertion order is save order. */
+            TMap<FName, FPendingSave> Pending;
+
+            /** Request being dispatched; owner of saves queued now. */
+            FString CurrentRequestId;
+            FFailureSink FailureSink;
+            TArray<TSharedPtr<FJsonValue>> RecentFailures;
+
+            double LastActivitySeconds = 0.0;
+            double OldestPendingSeconds = 0.0;
+            int32 ImmediateScopes = 0;
+            bool bFlushing = false;
+
+            int64 TotalEnqueued = 0;
+            int64 TotalCoalesced = 0;
+            int64 TotalFlushes = 0;
+            int64 TotalSaved = 0;
+            int64 TotalFailed = 0;
+            double TotalSaveSeconds = 0.0;
+            double TotalScanSeconds = 0.0;
+            int64 TotalSaveCalls = 0;
+            int64 TotalRegistryScans = 0;
+
+            TSharedPtr<FJsonObject> LastFlush;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        const UMcpAutomationBridgeSettings* GetSettings()
+        {
+            return GetDefault<UMcpAutomationBridgeSettings>();
+        }
+    }
+
+    bool IsDeferring()
+    {
+        const FState& State = GetState();
+        const UMcpAutomationBridgeSettings* Settings = GetSettings();
+        return IsInGameThread() && !State.bFlushing && State.ImmediateScopes == 0 &&
+               Settings && Settings->bCoalesceAssetSaves;
+    }
+
+    void Enqueue(UObject* Asset)
+    {
+        if (!Asset)
+        {
+            return;
+        }
+        check(IsInGameThread());
+
+        FState& State = GetState();
+
+#if WITH_EDITOR
+        // Match the immediate path: dirty + registered now, written at flush time
+        Asset->MarkPackageDirty();
+        FAssetRegistryModule::AssetCreated(Asset);
+#endif
+
+        const FName PackageName = Asset->GetOutermost()->GetFName();
+        if (FPendingSave* Existing = State.Pending.Find(PackageName))
+        {
+            Existing->Asset = Asset;
+            if (!State.CurrentRequestId.IsEmpty())
+            {
+                Existing->RequestIds.AddUnique(State.CurrentRequestId);
+            }
+            ++State.TotalCoalesced;
+            return;
+        }
+
+        if (State.Pending.Num() == 0)
+        {
+            State.OldestPendingSeconds = FPlatformTime::Seconds();
+        }
+        FPendingSave& Entry = State.Pending.Add(PackageName);
+        Entry.Asset = Asset;
+        if (!State.CurrentRequestId.IsEmpty())
+        {
+            Entry.RequestIds.Add(State.CurrentRequestId);
+        }
+        ++State.TotalEnqueued;
+    }
+
+    FFlushResult Flush(const FString& Reason)
+    {
+        FFlushResult Result;
+        Result.Reason = Reason;
+
+        FState& State = GetState();
+        if (State.bFlushing || State.Pending.Num() == 0)
+        {
+            return Result;
+        }
+        check(IsInGameThread());
+
+        TGuardValue<bool> FlushGuard(State.bFlushing, true);
+        McpRequestProfiler::FPhaseScope SavePhase(McpRequestProfiler::EPhase::Save);
+
+        // Save Blueprints compiled, as the per-op path did
+        McpCompileScheduler::Flush(TEXT("save"));
+
+        TMap<FName, FPendingSave> Batch = MoveTemp(State.Pending);
+        State.Pending.Reset();
+        Result.Requested = Batch.Num();
+
+#if WITH_EDITOR && MCP_HAS_PACKAGE_TOOLS
+        TArray<UObject*> ObjectsToSave;
+        TSet<FString> PathsToScan;
+        ObjectsToSave.Reserve(Batch.Num());
+
+        for (const TPair<FName, FPendingSave>& Entry : Batch)
+        {
+            UObject* Asset = Entry.Value.Asset.Get();
+            UPackage* Package = IsValid(Asset) ? Asset->GetOutermost() : nullptr;
+            if (!Package || Package == GetTransientPackage() || Package->HasAnyFlags(RF_Transient))
+            {
+                // Deleted or moved to the transient package since it was queued
+                ++Result.Skipped;
+                continue;
+            }
+            ObjectsToSave.Add(Asset);
+            PathsToScan.Add(FPaths::GetPath(Package->GetName()));
+        }
+
+        if (ObjectsToSave.Num() > 0)
+        {
+            const double SaveStart = FPlatformTime::Seconds();
+            FlushRenderingCommands();
+            UPackageTools::SavePackagesForObjects(ObjectsToSave);
+            ++State.TotalSaveCalls;
+            Result.SaveSeconds = FPlatformTime::Seconds() - SaveStart;
+
+            for (UObject* Asset : ObjectsToSave)
+            {
+                UPackage* Package = Asset->GetOutermost();
+                if (Package->IsDirty())
+                {
+                    Result.FailedPackages.Add(Package->GetName());
+                    if (const FPendingSave* Entry = Batch.Find(Package->GetFName()))
+                    {
+                        for (const FString& RequestId : Entry->RequestIds)
+                        {
+                            Result.FailedByRequest.FindOrAdd(RequestId).Add(Package->GetName());
+                        }
+                    }
+                }
+                else
+                {
+                    ++Result.Saved;
+                }
+            }
+
+            if (Result.Saved > 0)
+            {
+                const double ScanStart = FPlatformTime::Seconds();
+                FAssetRegistryModule& AssetRegistryModule =
+                    FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+                AssetRegistryModule.Get().ScanPathsSynchronous(PathsToScan.Array(), false);
+                ++State.TotalRegistryScans;
+                Result.ScannedPaths = PathsToScan.Num();
+                Result.ScanSeconds = FPlatformTime::Seconds() - ScanStart;
+            }
+        }
+#else
+        Result.Skipped = Batch.Num();
+#endif
+
+        ++State.TotalFlushes;
+        State.TotalSaved += Result.Saved;
+        State.TotalFailed += Result.FailedPackages.Num();
+        State.TotalSaveSeconds += Result.SaveSeconds;
+        State.TotalScanSeconds += Result.ScanSeconds;
+        State.LastFlush = FlushResultToJson(Result);
+
+        if (Result.FailedPackages.Num() > 0)
+        {
+            UE_LOG(LogMcpSafeOperations, Warning,
+                TEXT("McpSaveCoordinator: flush (%s) failed to save %d of %d packages: %s"),
+                *Reason, Result.FailedPackages.Num(), Result.Requested,
+                *FString::Join(Result.FailedPackages, TEXT(", ")));
+
+            for (const FString& PackageName : Result.FailedPackages)
+            {
+                TSharedPtr<FJsonObject> Failure = MakeShared<FJsonObject>();
+                Failure->SetStringField(TEXT("package"), PackageName);
+                Failure->SetStringField(TEXT("reason"), Reason);
+                TArray<TSharedPtr<FJsonValue>> RequestIds;
+                for (const TPair<FString, TArray<FString>>& Entry : Result.FailedByRequest)
+                {
+                    if (Entry.Value.Contains(PackageName))
+                    {
+                        RequestIds.Add(MakeShared<FJsonValueString>(Entry.Key));
+                    }
+                }
+                Failure->SetArrayField(TEXT("requestIds"), RequestIds);
+                State.RecentFailures.Add(MakeShared<FJsonValueObject>(Failure));
+            }
+            if (State.RecentFailures.Num() > MaxRecentFailures)
+            {
+                State.RecentFailures.RemoveAt(0, State.RecentFailures.Num() - MaxRecentFailures);
+            }
+
+            // The responses went out while these were queued; tell each requester
+            if (State.FailureSink)
+            {
+                for (const TPair<FString, TArray<FString>>& Entry : Result.FailedByRequest)
+                {
+                    State.FailureSink(Entry.Key, Entry.Value, Reason);
+                }
+            }
+        }
+        UE_LOG(LogMcpSafeOperations, Verbose,
+            TEXT("McpSaveCoordinator: flush (%s) saved=%d skipped=%d failed=%d save=%.1fms scan=%.1fms paths=%d"),
+            *Reason, Result.Saved, Result.Skipped, Result.FailedPackages.Num(),
+            Result.SaveSeconds * 1000.0, Result.ScanSeconds * 1000.0, Result.ScannedPaths);
+
+        return Result;
+    }
+
+    int32 NumPending()
+    {
+        return GetState().Pending.Num();
+    }
+
+    TArray<FString> GetQueuedPackages(const FString& RequestId)
+    {
+        TArray<FString> Packages;
+        if (RequestId.IsEmpty())
+        {
+            return Packages;
+        }
+        for (const TPair<FName, FPendingSave>& Entry : GetState().Pending)
+        {
+            if (Entry.Value.RequestIds.Contains(RequestId))
+            {
+                Packages.Add(Entry.Key.ToString());
+            }
+        }
+        return Packages;
+    }
+
+    TSharedPtr<FJsonObject> AnnotateResponse(const FString& RequestId, const TSharedPtr<FJsonObject>& Result)
+    {
+        const TArray<FString> Queued = GetQueuedPackages(RequestId);
+        if (Queued.Num() == 0)
+        {
+            return Result;
+        }
+
+        TSharedPtr<FJsonObject> Annotated = Result;
+        if (!Annotated.IsValid())
+        {
+            Annotated = MakeShared<FJsonObject>();
+        }
+        bool bSaved = false;
+        if (Annotated->TryGetBoolField(TEXT("saved"), bSaved) && bSaved)
+        {
+            // Written at the next flush, not yet on disk
+            Annotated->SetBoolField(TEXT("saved"), false);
+        }
+        Annotated->SetBoolField(TEXT("saveQueued"), true);
+        TArray<TSharedPtr<FJsonValue>> Packages;
+        for (const FString& PackageName : Queued)
+        {
+            Packages.Add(MakeShared<FJsonValueString>(PackageName));
+        }
+        Annotated->SetArrayField(TEXT("queuedPackages"), Packages);
+        return Annotated;
+    }
+
+    void SetFailureSink(FFailureSink Sink)
+    {
+        GetState().FailureSink = MoveTemp(Sink);
+    }
+
+    FIoCounters GetIoCounters()
+    {
+        const FState& State = GetState();
+        FIoCounters Counters;
+        Counters.SaveCalls = State.TotalSaveCalls;
+        Counters.RegistryScans = State.TotalRegistryScans;
+        return Counters;
+    }
+
+    void NoteImmediateSave(bool bScanned)
+    {
+        FState& State = GetState();
+        ++State.TotalSaveCalls;
+        if (bScanned)
+        {
+            ++State.TotalRegistryScans;
+        }
+    }
+
+    void NoteRequestActivity(const FString& RequestId)
+    {
+        FState& State = GetState();
+        State.LastActivitySeconds = FPlatformTime::Seconds();
+        State.CurrentRequestId = RequestId;
+    }
+
+    void NoteRequestFinished()
+    {
+        GetState().CurrentRequestId.Reset();
+    }
+
+    void Tick(bool bRequestInFlight)
+    {
+        FState& State = GetState();
+        if (State.Pending.Num() == 0 || State.bFlushing || bRequestInFlight)
+        {
+            return;
+        }
+        if (GIsSavingPackage || IsGarbageCollecting() || IsAsyncLoading())
+        {
+            return;
+        }
+
+        const UMcpAutomationBridgeSettings* Settings = GetSettings();
+        if (!Settings || !Settings->bCoalesceAssetSaves)
+        {
+            // Coalescing was switched off with saves still queued
+            Flush(TEXT("disabled"));
+            return;
+        }
+
+        if (State.Pending.Num() >= FMath::Max(1, Settings->MaxPendingAssetSaves))
+        {
+            Flush(TEXT("queue_full"));
+            return;
+        }
+
+        const double IdleSeconds = FPlatformTime::Seconds() - State.LastActivitySeconds;
+        if (IdleSeconds >= Settings->SaveFlushIdleSeconds)
+        {
+            Flush(TEXT("idle"));
+        }
+    }
+
+    TSharedPtr<FJsonObject> GetStatus(bool bIncludePackages)
+    {
+        const FState& State = GetState();
+        const UMcpAutomationBridgeSettings* Settings = GetSettings();
+        const double Now = FPlatformTime::Seconds();
+
+        TSharedPtr<FJsonObject> Status = MakeShared<FJsonObject>();
+        Status->SetBoolField(TEXT("coalescing"), Settings && Settings->bCoalesceAssetSaves);
+        Status->SetNumberField(TEXT("idleFlushSeconds"), Settings ? Settings->SaveFlushIdleSeconds : 0.0);
+        Status->SetNumberField(TEXT("maxPending"), Settings ? Settings->MaxPendingAssetSaves : 0);
+        Status->SetNumberField(TEXT("pending"), State.Pending.Num());
+        Status->SetNumberField(TEXT("oldestPendingAgeMs"),
+            State.Pending.Num() > 0 ? (Now - State.OldestPendingSeconds) * 1000.0 : 0.0);
+
+        if (bIncludePackages)
+        {
+            TArray<TSharedPtr<FJsonValue>> Packages;
+            for (const TPair<FName, FPendingSave>& Entry : State.Pending)
+            {
+                Packages.Add(MakeShared<FJsonValueString>(Entry.Key.ToString()));
+            }
+            Status->SetArrayField(TEXT("pendingPackages"), Packages);
+        }
+
+        TSharedPtr<FJsonObject> Totals = MakeShared<FJsonObject>();
+        Totals->SetNumberField(TEXT("enqueued"), static_cast<double>(State.TotalEnqueued));
+        Totals->SetNumberField(TEXT("coalesced"), static_cast<double>(State.TotalCoalesced));
+        Totals->SetNumberField(TEXT("flushes"), static_cast<double>(State.TotalFlushes));
+        Totals->SetNumberField(TEXT("saved"), static_cast<double>(State.TotalSaved));
+        Totals->SetNumberField(TEXT("failed"), static_cast<double>(State.TotalFailed));
+        Totals->SetNumberField(TEXT("saveMs"), State.TotalSaveSeconds * 1000.0);
+        Totals->SetNumberField(TEXT("scanMs"), State.TotalScanSeconds * 1000.0);
+        Totals->SetNumberField(TEXT("saveCalls"), static_cast<double>(State.TotalSaveCalls));
+        Totals->SetNumberField(TEXT("registryScans"), static_cast<double>(State.TotalRegistryScans));
+        Status->SetObjectField(TEXT("totals"), Totals);
+
+        if (State.LastFlush.IsValid())
+        {
+            Status->SetObjectField(TEXT("lastFlush"), State.LastFlush);
+        }
+        Status->SetArrayField(TEXT("recentFailures"), State.RecentFailures);
+        return Status;
+    }
+
+    TSharedPtr<FJsonObject> FlushResultToJson(const FFlushResult& Result)
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetStringField(TEXT("reason"), Result.Reason);
+        Json->SetNumberField(TEXT("requested"), Result.Requested);
+        Json->SetNumberField(TEXT("saved"), Result.Saved);
+        Json->SetNumberField(TEXT("skipped"), Result.Skipped);
+        Json->SetNumberField(TEXT("scannedPaths"), Result.ScannedPaths);
+        Json->SetNumberField(TEXT("saveMs"), Result.SaveSeconds * 1000.0);
+        Json->SetNumberField(TEXT("scanMs"), Result.ScanSeconds * 1000.0);
+
+        TArray<TSharedPtr<FJsonValue>> Failed;
+        for (const FString& PackageName : Result.FailedPackages)
+        {
+            Failed.Add(MakeShared<FJsonValueString>(PackageName));
+        }
+        Json->SetArrayField(TEXT("failedPackages"), Failed);
+
+        TArray<TSharedPtr<FJsonValue>> FailedRequests;
+        for (const TPair<FString, TArray<FString>>& Entry : Result.FailedByRequest)
+        {
+            FailedRequests.Add(MakeShared<FJsonValueString>(Entry.Key));
+        }
+        Json->SetArrayField(TEXT("failedRequestIds"), FailedRequests);
+        return Json;
+    }
+
+    FScopedImmediateSaves::FScopedImmediateSaves()
+    {
+        ++GetState().ImmediateScopes;
+    }
+
+    FScopedImmediateSaves::~FScopedImmediateSaves()
+    {
+        --GetState().ImmediateScopes;
+    }
+}
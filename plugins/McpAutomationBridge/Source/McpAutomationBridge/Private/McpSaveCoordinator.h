@@ -0,0 +1,143 @@
+// =============================================================================
+// McpSaveCoordinator.h
+// =============================================================================
+// Coalesces asset saves requested by automation handlers.
+//
+// McpSafeAssetSave used to save one package and rescan its folder on every
+// call, so a burst of authoring requests paid a SavePackages call and a
+// synchronous registry scan per asset. While deferral is active, the safe save
+// helpers hand the asset to this coordinator instead: the package is marked
+// dirty and registered with the asset registry immediately (so lookups within
+// the same session still find it), and the write happens later in a single
+// SavePackages batch followed by one registry scan over the touched folders.
+//
+// A flush happens when:
+//   - the bridge has been idle for SaveFlushIdleSeconds (the end of a burst)
+//   - a queue of deferred requests has been drained (batch boundary)
+//   - MaxPendingAssetSaves packages are queued
+//   - a level save or map load is about to run
+//   - manage_asset flush_saves is called, or a request sets flushSaves=true
+//   - the subsystem shuts down
+//
+// Each queued package remembers the requests that asked for it. A response
+// sent while its saves are still queued reports saveQueued (and saved=false)
+// instead of claiming the asset is on disk, and a package that fails to save
+// at flush time is reported back to those requests through the failure sink.
+//
+// All functions are game-thread only. Saves requested from other threads
+// bypass the coordinator and use the immediate path.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpSaveCoordinator
+{
+    struct FFlushResult
+    {
+        FString Reason;
+
+        /** Packages that were queued when the flush started. */
+        int32 Requested = 0;
+
+        /** Packages written and no longer dirty. */
+        int32 Saved = 0;
+
+        /** Queued objects that were deleted or became transient before the flush. */
+        int32 Skipped = 0;
+
+        /** Packages still dirty after SavePackages (save failed or was refused). */
+        TArray<FString> FailedPackages;
+
+        /** FailedPackages grouped by the request ids that queued them. */
+        TMap<FString, TArray<FString>> FailedByRequest;
+
+        /** Folders passed to the single registry scan. */
+        int32 ScannedPaths = 0;
+
+        double SaveSeconds = 0.0;
+        double ScanSeconds = 0.0;
+    };
+
+    /** SavePackages calls and registry scans made so far, by flushes and immediate saves. */
+    struct FIoCounters
+    {
+        int64 SaveCalls = 0;
+        int64 RegistryScans = 0;
+    };
+
+    /** Called once per request whose queued packages failed to save during a flush. */
+    using FFailureSink = TFunction<void(const FString& RequestId, const TArray<FString>& Packages,
+                                        const FString& Reason)>;
+
+    /** True when McpSafeAssetSave should queue instead of saving immediately. */
+    bool IsDeferring();
+
+    /**
+     * Mark the asset's package dirty, register it with the asset registry and
+     * queue it for the next flush on behalf of the current request. Queuing
+     * the same package twice only adds the requester.
+     */
+    void Enqueue(UObject* Asset);
+
+    /** Save every queued package in one batch, then scan the touched folders once. */
+    FFlushResult Flush(const FString& Reason);
+
+    /** Number of packages waiting for the next flush. */
+    int32 NumPending();
+
+    /** Packages queued by RequestId that have not been flushed yet. */
+    TArray<FString> GetQueuedPackages(const FString& RequestId);
+
+    /**
+     * Mark a response whose request still has saves queued: sets saveQueued and
+     * queuedPackages, and turns saved=true into saved=false. Returns Result, or
+     * a new object when Result is null and saves are queued.
+     */
+    TSharedPtr<FJsonObject> AnnotateResponse(const FString& RequestId, const TSharedPtr<FJsonObject>& Result);
+
+    /** Install (or clear, with nullptr) the sink that reports flush failures to their requests. */
+    void SetFailureSink(FFailureSink Sink);
+
+    /** Lifetime totals; diff two snapshots to count the I/O of an operation. */
+    FIoCounters GetIoCounters();
+
+    /** Count a save made outside the coordinator (McpSaveAssetImmediate). */
+    void NoteImmediateSave(bool bScanned);
+
+    /** Record that an automation request started; restarts the idle timer. */
+    void NoteRequestActivity(const FString& RequestId);
+
+    /** The dispatched request returned; later saves (background jobs) have no requester. */
+    void NoteRequestFinished();
+
+    /**
+     * Flush if the queue is full, or if the bridge has been idle long enough
+     * and no request is in flight. Called from the subsystem ticker.
+     */
+    void Tick(bool bRequestInFlight);
+
+    /** Queue contents, settings and lifetime totals for manage_asset get_save_queue. */
+    TSharedPtr<FJsonObject> GetStatus(bool bIncludePackages);
+
+    /** Serialize a flush result for responses. */
+    TSharedPtr<FJsonObject> FlushResultToJson(const FFlushResult& Result);
+
+    /**
+     * Disable deferral for the lifetime of the scope so McpSafeAssetSave saves
+     * immediately (used for flushSaves=true requests and the per-op benchmark).
+     */
+    struct FScopedImmediateSaves
+    {
+        FScopedImmediateSaves();
+        ~FScopedImmediateSaves();
+
+        FScopedImmediateSaves(const FScopedImmediateSaves&) = delete;
+        FScopedImmediateSaves& operator=(const FScopedImmediateSaves&) = delete;
+    };
+}
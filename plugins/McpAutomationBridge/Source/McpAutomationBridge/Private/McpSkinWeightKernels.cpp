@@ -0,0 +1,741 @@
+// =============================================================================
+// McpSkinWeightKernels.cpp
+// =============================================================================
+// Implementation of the fixed-stride skin-weight kernels used by the skeleton
+// handlers.
+// =============================================================================
+
+#include "McpSkinWeightKernels.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+namespace McpSkinWeightKernels
+{
+    namespace
+    {
+        // Vertices per work item.
+        constexpr int32 VERTEX_CHUNK = 4096;
+
+        // Largest stride; FMeshDescription skin weights hold at most this many.
+        constexpr int32 MAX_STRIDE = 16;
+
+        using FInfluenceList = TArray<TPair<int32, float>, TInlineAllocator<64>>;
+
+        /** Run Body over vertex chunks in parallel and sum what each chunk returns. */
+        int64 ParallelSumVertices(int32 NumVertices, TFunctionRef<int64(int32 Begin, int32 End)> Body)
+        {
+            if (NumVertices <= 0)
+            {
+                return 0;
+            }
+            const int32 NumChunks = (NumVertices + VERTEX_CHUNK - 1) / VERTEX_CHUNK;
+            TArray<int64> ChunkTotals;
+            ChunkTotals.SetNumZeroed(NumChunks);
+            ParallelFor(NumChunks, [&](int32 ChunkIndex)
+            {
+                const int32 Begin = ChunkIndex * VERTEX_CHUNK;
+                ChunkTotals[ChunkIndex] = Body(Begin, FMath::Min(Begin + VERTEX_CHUNK, NumVertices));
+            }, NumChunks == 1);
+
+            int64 Total = 0;
+            for (int64 ChunkTotal : ChunkTotals)
+            {
+                Total += ChunkTotal;
+            }
+            return Total;
+        }
+
+        /** Sort the slots of one vertex by weight, largest first; empty slots go last. */
+        void SortSlots(int32* Bones, float* Weights, int32 Stride)
+        {
+            for (int32 I = 1; I < Stride; ++I)
+            {
+                const int32 Bone = Bones[I];
+                const float Weight = Weights[I];
+                int32 J = I - 1;
+                while (J >= 0 && Weights[J] < Weight)
+                {
+                    Bones[J + 1] = Bones[J];
+                    Weights[J + 1] = Weights[J];
+                    --J;
+                }
+                Bones[J + 1] = Bone;
+                Weights[J + 1] = Weight;
+            }
+        }
+
+        /** Write the MaxCount largest influences of List, renormalized, and clear the rest of the Stride slots. */
+        void WriteTopInfluences(FInfluenceList& List, int32* Bones, float* Weights, int32 Stride,
+                                int32 MaxCount = TNumericLimits<int32>::Max())
+        {
+            List.Sort([](const TPair<int32, float>& A, const TPair<int32, float>& B) { return A.Value > B.Value; });
+            const int32 Count = FMath::Min3(List.Num(), Stride, MaxCount);
+            float Sum = 0.0f;
+            for (int32 I = 0; I < Count; ++I)
+            {
+                Sum += List[I].Value;
+            }
+            const float Scale = Sum > 0.0f ? 1.0f / Sum : 0.0f;
+            for (int32 I = 0; I < Stride; ++I)
+            {
+                const bool bUsed = I < Count && List[I].Value > 0.0f;
+                Bones[I] = bUsed ? List[I].Key : INDEX_NONE;
+                Weights[I] = bUsed ? List[I].Value * Scale : 0.0f;
+            }
+        }
+
+        void AccumulateInfluences(FInfluenceList& List, const int32* Bones, const float* Weights, int32 Stride, float Scale)
+        {
+            for (int32 I = 0; I < Stride; ++I)
+            {
+                if (Bones[I] == INDEX_NONE || Weights[I] <= 0.0f)
+                {
+                    continue;
+                }
+                bool bFound = false;
+                for (TPair<int32, float>& Entry : List)
+                {
+                    if (Entry.Key == Bones[I])
+                    {
+                        Entry.Value += Weights[I] * Scale;
+                        bFound = true;
+                        break;
+                    }
+                }
+                if (!bFound)
+                {
+                    List.Emplace(Bones[I], Weights[I] * Scale);
+                }
+            }
+        }
+
+        float DistanceToSegment(const FVector3f& Point, const FVector3f& Start, const FVector3f& End)
+        {
+            const FVector3f Segment = End - Start;
+            const float LengthSquared = Segment.SizeSquared();
+            const float T = LengthSquared > KINDA_SMALL_NUMBER
+                ? FMath::Clamp(FVector3f::DotProduct(Point - Start, Segment) / LengthSquared, 0.0f, 1.0f)
+                : 0.0f;
+            return FVector3f::Dist(Point, Start + Segment * T);
+        }
+
+        FIntVector GetCell(const FVector3f& Position, float CellSize)
+        {
+            return FIntVector(FMath::FloorToInt(Position.X / CellSize),
+                              FMath::FloorToInt(Position.Y / CellSize),
+                              FMath::FloorToInt(Position.Z / CellSize));
+        }
+    }
+
+    void FSkinWeightBuffer::Init(int32 InNumVertices, int32 InMaxInfluences)
+    {
+        NumVertices = FMath::Max(0, InNumVertices);
+        MaxInfluences = FMath::Clamp(InMaxInfluences, 1, MAX_STRIDE);
+        Bones.Init(INDEX_NONE, NumVertices * MaxInfluences);
+        Weights.Init(0.0f, NumVertices * MaxInfluences);
+    }
+
+    int32 FSkinWeightBuffer::GetNumInfluences(int32 Vertex) const
+    {
+        int32 Count = 0;
+        const int32 Base = Vertex * MaxInfluences;
+        for (int32 I = 0; I < MaxInfluences; ++I)
+        {
+            Count += (Bones[Base + I] != INDEX_NONE && Weights[Base + I] > 0.0f) ? 1 : 0;
+        }
+        return Count;
+    }
+
+    void FVertexAdjacency::Build(int32 NumVertices, const TArray<TPair<int32, int32>>& Edges)
+    {
+        Offsets.Init(0, NumVertices + 1);
+        for (const TPair<int32, int32>& Edge : Edges)
+        {
+            if (Edge.Key != Edge.Value && Edge.Key >= 0 && Edge.Value >= 0 && Edge.Key < NumVertices && Edge.Value < NumVertices)
+            {
+                ++Offsets[Edge.Key + 1];
+                ++Offsets[Edge.Value + 1];
+            }
+        }
+        for (int32 V = 0; V < NumVertices; ++V)
+        {
+            Offsets[V + 1] += Offsets[V];
+        }
+
+        Neighbors.SetNumUninitialized(Offsets[NumVertices]);
+        TArray<int32> Cursor(Offsets.GetData(), NumVertices);
+        for (const TPair<int32, int32>& Edge : Edges)
+        {
+            if (Edge.Key != Edge.Value && Edge.Key >= 0 && Edge.Value >= 0 && Edge.Key < NumVertices && Edge.Value < NumVertices)
+            {
+                Neighbors[Cursor[Edge.Key]++] = Edge.Value;
+                Neighbors[Cursor[Edge.Value]++] = Edge.Key;
+            }
+        }
+
+        // Drop duplicate edges (shared by several polygons) in place
+        TArray<int32> Compacted;
+        Compacted.Reserve(Neighbors.Num());
+        TArray<int32> NewOffsets;
+        NewOffsets.SetNumUninitialized(NumVertices + 1);
+        for (int32 V = 0; V < NumVertices; ++V)
+        {
+            NewOffsets[V] = Compacted.Num();
+            TArrayView<int32> Row(Neighbors.GetData() + Offsets[V], Offsets[V + 1] - Offsets[V]);
+            Row.Sort();
+            for (int32 I = 0; I < Row.Num(); ++I)
+            {
+                if (I == 0 || Row[I] != Row[I - 1])
+                {
+                    Compacted.Add(Row[I]);
+                }
+            }
+        }
+        NewOffsets[NumVertices] = Compacted.Num();
+        Offsets = MoveTemp(NewOffsets);
+        Neighbors = MoveTemp(Compacted);
+    }
+
+    TSharedPtr<FJsonObject> FSumStats::ToJson() const
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetNumberField(TEXT("minSum"), MinSum);
+        Json->SetNumberField(TEXT("maxSum"), MaxSum);
+        Json->SetNumberField(TEXT("meanSum"), MeanSum);
+        Json->SetNumberField(TEXT("unnormalizedVertices"), Unnormalized);
+        Json->SetNumberField(TEXT("unweightedVertices"), Unweighted);
+        Json->SetNumberField(TEXT("totalInfluences"), TotalInfluences);
+        Json->SetNumberField(TEXT("maxInfluencesUsed"), MaxInfluencesUsed);
+        return Json;
+    }
+
+    int32 Normalize(FSkinWeightBuffer& Buffer)
+    {
+        const int32 Stride = Buffer.MaxInfluences;
+        return static_cast<int32>(ParallelSumVertices(Buffer.NumVertices, [&](int32 Begin, int32 End) -> int64
+        {
+            int64 Changed = 0;
+            for (int32 V = Begin; V < End; ++V)
+            {
+                float* Weights = Buffer.Weights.GetData() + V * Stride;
+                float Sum = 0.0f;
+                for (int32 I = 0; I < Stride; ++I)
+                {
+                    Sum += Weights[I];
+                }
+                if (Sum <= 0.0f || FMath::IsNearlyEqual(Sum, 1.0f, 1.0e-6f))
+                {
+                    continue;
+                }
+                const float Scale = 1.0f / Sum;
+                for (int32 I = 0; I < Stride; ++I)
+                {
+                    Weights[I] *= Scale;
+                }
+                ++Changed;
+            }
+            return Changed;
+        }));
+    }
+
+    int32 Prune(FSkinWeightBuffer& Buffer, float Threshold)
+    {
+        const int32 Stride = Buffer.MaxInfluences;
+        return static_cast<int32>(ParallelSumVertices(Buffer.NumVertices, [&](int32 Begin, int32 End) -> int64
+        {
+            int64 Removed = 0;
+            for (int32 V = Begin; V < End; ++V)
+            {
+                int32* Bones = Buffer.Bones.GetData() + V * Stride;
+                float* Weights = Buffer.Weights.GetData() + V * Stride;
+                SortSlots(Bones, Weights, Stride);
+                for (int32 I = 1; I < Stride; ++I)
+                {
+                    if (Bones[I] != INDEX_NONE && Weights[I] < Threshold)
+                    {
+                        Bones[I] = INDEX_NONE;
+                        Weights[I] = 0.0f;
+                        ++Removed;
+                    }
+                }
+            }
+            return Removed;
+        }));
+    }
+
+    int32 LimitInfluences(FSkinWeightBuffer& Buffer, int32 MaxCount)
+    {
+        const int32 Stride = Buffer.MaxInfluences;
+        MaxCount = FMath::Max(1, MaxCount);
+        if (MaxCount >= Stride)
+        {
+            return 0;
+        }
+        return static_cast<int32>(ParallelSumVertices(Buffer.NumVertices, [&](int32 Begin, int32 End) -> int64
+        {
+            int64 Removed = 0;
+            for (int32 V = Begin; V < End; ++V)
+            {
+                int32* Bones = Buffer.Bones.GetData() + V * Stride;
+                float* Weights = Buffer.Weights.GetData() + V * Stride;
+                SortSlots(Bones, Weights, Stride);
+                for (int32 I = MaxCount; I < Stride; ++I)
+                {
+                    if (Bones[I] != INDEX_NONE)
+                    {
+                        Bones[I] = INDEX_NONE;
+                        Weights[I] = 0.0f;
+                        ++Removed;
+                    }
+                }
+            }
+            return Removed;
+        }));
+    }
+
+    void Smooth(FSkinWeightBuffer& Buffer, const FVertexAdjacency& Adjacency, int32 Iterations, float Strength, int32 MaxCount)
+    {
+        const int32 Stride = Buffer.MaxInfluences;
+        MaxCount = FMath::Clamp(MaxCount, 1, Stride);
+        Strength = FMath::Clamp(Strength, 0.0f, 1.0f);
+        if (Iterations <= 0 || Strength <= 0.0f || Adjacency.Offsets.Num() != Buffer.NumVertices + 1)
+        {
+            return;
+        }
+
+        // Jacobi iterations: read the previous pass, write the next one
+        FSkinWeightBuffer Next = Buffer;
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            ParallelSumVertices(Buffer.NumVertices, [&](int32 Begin, int32 End) -> int64
+            {
+                FInfluenceList List;
+                for (int32 V = Begin; V < End; ++V)
+                {
+                    const int32 NeighborBegin = Adjacency.Offsets[V];
+                    const int32 NeighborCount = Adjacency.Offsets[V + 1] - NeighborBegin;
+                    const int32* SrcBones = Buffer.Bones.GetData() + V * Stride;
+                    const float* SrcWeights = Buffer.Weights.GetData() + V * Stride;
+                    int32* DstBones = Next.Bones.GetData() + V * Stride;
+                    float* DstWeights = Next.Weights.GetData() + V * Stride;
+                    if (NeighborCount == 0)
+                    {
+                        FMemory::Memcpy(DstBones, SrcBones, Stride * sizeof(int32));
+                        FMemory::Memcpy(DstWeights, SrcWeights, Stride * sizeof(float));
+                        continue;
+                    }
+
+                    List.Reset();
+                    AccumulateInfluences(List, SrcBones, SrcWeights, Stride, 1.0f - Strength);
+                    const float NeighborScale = Strength / NeighborCount;
+                    for (int32 N = 0; N < NeighborCount; ++N)
+                    {
+                        const int32 Neighbor = Adjacency.Neighbors[NeighborBegin + N];
+                        AccumulateInfluences(List, Buffer.Bones.GetData() + Neighbor * Stride,
+                                             Buffer.Weights.GetData() + Neighbor * Stride, Stride, NeighborScale);
+                    }
+                    WriteTopInfluences(List, DstBones, DstWeights, Stride, MaxCount);
+                }
+                return 0;
+            });
+            Swap(Buffer, Next);
+        }
+    }
+
+    int32 Mirror(FSkinWeightBuffer& Buffer, const TArray<FVector3f>& Positions, int32 Axis, bool bPositiveToNegative,
+                 const TArray<int32>& BoneMirror, float Tolerance, int32& OutUnmatched)
+    {
+        OutUnmatched = 0;
+        const int32 Stride = Buffer.MaxInfluences;
+        Axis = FMath::Clamp(Axis, 0, 2);
+        Tolerance = FMath::Max(Tolerance, 1.0e-4f);
+        if (Positions.Num() != Buffer.NumVertices)
+        {
+            return 0;
+        }
+
+        // Signed distance to the mirror plane, positive on the source side
+        const float Sign = bPositiveToNegative ? 1.0f : -1.0f;
+        auto SideOf = [&](int32 V) { return Positions[V][Axis] * Sign; };
+
+        // Hash source-side vertices (including those on the plane) into cells
+        // of Tolerance size; a 3x3x3 lookup then finds every candidate.
+        const float CellSize = Tolerance;
+        TMap<FIntVector, int32> CellHeads;
+        TArray<int32> NextInCell;
+        NextInCell.Init(INDEX_NONE, Buffer.NumVertices);
+        for (int32 V = 0; V < Buffer.NumVertices; ++V)
+        {
+            if (SideOf(V) < -Tolerance)
+            {
+                continue;
+            }
+            const FIntVector Cell = GetCell(Positions[V], CellSize);
+            if (int32* Head = CellHeads.Find(Cell))
+            {
+                NextInCell[V] = *Head;
+                *Head = V;
+            }
+            else
+            {
+                CellHeads.Add(Cell, V);
+            }
+        }
+
+        TArray<int32> UnmatchedPerVertex;
+        UnmatchedPerVertex.SetNumZeroed(Buffer.NumVertices);
+        const int32 Written = static_cast<int32>(ParallelSumVertices(Buffer.NumVertices, [&](int32 Begin, int32 End) -> int64
+        {
+            int64 Count = 0;
+            for (int32 V = Begin; V < End; ++V)
+            {
+                if (SideOf(V) >= -Tolerance)
+                {
+                    continue;
+                }
+                FVector3f Mirrored = Positions[V];
+                Mirrored[Axis] = -Mirrored[Axis];
+                const FIntVector Center = GetCell(Mirrored, CellSize);
+
+                int32 Best = INDEX_NONE;
+                float BestDistSquared = Tolerance * Tolerance;
+                for (int32 DZ = -1; DZ <= 1; ++DZ)
+                {
+                    for (int32 DY = -1; DY <= 1; ++DY)
+                    {
+                        for (int32 DX = -1; DX <= 1; ++DX)
+                        {
+                            const int32* Head = CellHeads.Find(Center + FIntVector(DX, DY, DZ));
+                            for (int32 Candidate = Head ? *Head : INDEX_NONE; Candidate != INDEX_NONE; Candidate = NextInCell[Candidate])
+                            {
+                                const float DistSquared = FVector3f::DistSquared(Positions[Candidate], Mirrored);
+                                if (DistSquared <= BestDistSquared)
+                                {
+                                    BestDistSquared = DistSquared;
+                                    Best = Candidate;
+                                }
+                            }
+                        }
+                    }
+                }
+                if (Best == INDEX_NONE)
+                {
+                    UnmatchedPerVertex[V] = 1;
+                    continue;
+                }
+
+                // Source vertices are never written, so reading them here is race-free
+                const int32* SrcBones = Buffer.Bones.GetData() + Best * Stride;
+                const float* SrcWeights = Buffer.Weights.GetData() + Best * Stride;
+                int32* DstBones = Buffer.Bones.GetData() + V * Stride;
+                float* DstWeights = Buffer.Weights.GetData() + V * Stride;
+                for (int32 I = 0; I < Stride; ++I)
+                {
+                    const int32 Bone = SrcBones[I];
+                    const int32 MirroredBone = BoneMirror.IsValidIndex(Bone) ? BoneMirror[Bone] : INDEX_NONE;
+                    DstBones[I] = MirroredBone != INDEX_NONE ? MirroredBone : Bone;
+                    DstWeights[I] = SrcWeights[I];
+                }
+                ++Count;
+            }
+            return Count;
+        }));
+
+        for (int32 Flag : UnmatchedPerVertex)
+        {
+            OutUnmatched += Flag;
+        }
+        return Written;
+    }
+
+    void ComputeFromBones(FSkinWeightBuffer& Buffer, const TArray<FVector3f>& Positions,
+                          const TArray<FVector3f>& SegmentStart, const TArray<FVector3f>& SegmentEnd,
+                          const TArray<int32>& SegmentBone, float Falloff, int32 MaxCount)
+    {
+        const int32 Stride = Buffer.MaxInfluences;
+        MaxCount = FMath::Clamp(MaxCount, 1, Stride);
+        const int32 NumSegments = FMath::Min3(SegmentStart.Num(), SegmentEnd.Num(), SegmentBone.Num());
+        if (Positions.Num() != Buffer.NumVertices || NumSegments == 0)
+        {
+            return;
+        }
+        int32 NumBones = 0;
+        for (int32 S = 0; S < NumSegments; ++S)
+        {
+            NumBones = FMath::Max(NumBones, SegmentBone[S] + 1);
+        }
+        Falloff = FMath::Max(Falloff, 0.1f);
+
+        ParallelSumVertices(Buffer.NumVertices, [&](int32 Begin, int32 End) -> int64
+        {
+            TArray<float> BoneDistance;
+            BoneDistance.SetNumUninitialized(NumBones);
+            FInfluenceList List;
+            for (int32 V = Begin; V < End; ++V)
+            {
+                for (float& Distance : BoneDistance)
+                {
+                    Distance = TNumericLimits<float>::Max();
+                }
+                for (int32 S = 0; S < NumSegments; ++S)
+                {
+                    const int32 Bone = SegmentBone[S];
+                    if (Bone >= 0)
+                    {
+                        BoneDistance[Bone] = FMath::Min(BoneDistance[Bone], DistanceToSegment(Positions[V], SegmentStart[S], SegmentEnd[S]));
+                    }
+                }
+
+                List.Reset();
+                for (int32 Bone = 0; Bone < NumBones; ++Bone)
+                {
+                    if (BoneDistance[Bone] < TNumericLimits<float>::Max())
+                    {
+                        const float Distance = FMath::Max(BoneDistance[Bone], 0.01f);
+                        List.Emplace(Bone, 1.0f / FMath::Pow(Distance, Falloff));
+                    }
+                }
+                WriteTopInfluences(List, Buffer.Bones.GetData() + V * Stride, Buffer.Weights.GetData() + V * Stride, Stride,
+                                   MaxCount);
+            }
+            return 0;
+        });
+    }
+
+    FSumStats ComputeSumStats(const FSkinWeightBuffer& Buffer, double Tolerance)
+    {
+        FSumStats Stats;
+        if (Buffer.NumVertices <= 0)
+        {
+            return Stats;
+        }
+
+        const int32 Stride = Buffer.MaxInfluences;
+        const int32 NumChunks = (Buffer.NumVertices + VERTEX_CHUNK - 1) / VERTEX_CHUNK;
+        TArray<FSumStats> Partials;
+        Partials.SetNum(NumChunks);
+        TArray<double> PartialTotals;
+        PartialTotals.SetNumZeroed(NumChunks);
+        ParallelFor(NumChunks, [&](int32 ChunkIndex)
+        {
+            const int32 Begin = ChunkIndex * VERTEX_CHUNK;
+            const int32 End = FMath::Min(Begin + VERTEX_CHUNK, Buffer.NumVertices);
+            FSumStats& Partial = Partials[ChunkIndex];
+            Partial.MinSum = TNumericLimits<double>::Max();
+            Partial.MaxSum = -TNumericLimits<double>::Max();
+            for (int32 V = Begin; V < End; ++V)
+            {
+                double Sum = 0.0;
+                int32 Count = 0;
+                for (int32 I = 0; I < Stride; ++I)
+                {
+                    const float Weight = Buffer.Weights[V * Stride + I];
+                    if (Buffer.Bones[V * Stride + I] != INDEX_NONE && Weight > 0.0f)
+                    {
+                        Sum += Weight;
+                        ++Count;
+                    }
+                }
+                Partial.MinSum = FMath::Min(Partial.MinSum, Sum);
+                Partial.MaxSum = FMath::Max(Partial.MaxSum, Sum);
+                PartialTotals[ChunkIndex] += Sum;
+                Partial.Unweighted += Count == 0 ? 1 : 0;
+                Partial.Unnormalized += (Count > 0 && FMath::Abs(Sum - 1.0) > Tolerance) ? 1 : 0;
+                Partial.TotalInfluences += Count;
+                Partial.MaxInfluencesUsed = FMath::Max(Partial.MaxInfluencesUsed, Count);
+            }
+        }, NumChunks == 1);
+
+        Stats.MinSum = TNumericLimits<double>::Max();
+        Stats.MaxSum = -TNumericLimits<double>::Max();
+        double Total = 0.0;
+        for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+        {
+            const FSumStats& Partial = Partials[Chunk];
+            Stats.MinSum = FMath::Min(Stats.MinSum, Partial.MinSum);
+            Stats.MaxSum = FMath::Max(Stats.MaxSum, Partial.MaxSum);
+            Stats.Unweighted += Partial.Unweighted;
+            Stats.Unnormalized += Partial.Unnormalized;
+            Stats.TotalInfluences += Partial.TotalInfluences;
+            Stats.MaxInfluencesUsed = FMath::Max(Stats.MaxInfluencesUsed, Partial.MaxInfluencesUsed);
+            Total += PartialTotals[Chunk];
+        }
+        Stats.MeanSum = Total / Buffer.NumVertices;
+        return Stats;
+    }
+
+    TSharedPtr<FJsonObject> RunBenchmark(const TArray<int32>& VertexCounts, int32 Iterations)
+    {
+        TSharedPtr<FJsonObject> Report = MakeShared<FJsonObject>();
+        Iterations = FMath::Clamp(Iterations, 1, 20);
+
+        constexpr int32 Stride = 8;
+        constexpr int32 BonesPerSide = 16;
+        constexpr float Spacing = 1.0f;
+        constexpr float PruneThreshold = 0.05f;
+        constexpr int32 InfluenceCap = 4;
+
+        TArray<TSharedPtr<FJsonValue>> Results;
+        TArray<TSharedPtr<FJsonValue>> CountValues;
+        bool bAllVerified = true;
+
+        for (int32 RequestedCount : VertexCounts)
+        {
+            // Square grid in the XY plane, symmetric across X = 0
+            const int32 Side = FMath::Max(8, FMath::CeilToInt(FMath::Sqrt(static_cast<float>(FMath::Clamp(RequestedCount, 1000, 2000000)))) & ~1);
+            const int32 NumVertices = Side * Side;
+            CountValues.Add(MakeShared<FJsonValueNumber>(NumVertices));
+
+            TArray<FVector3f> Positions;
+            Positions.SetNumUninitialized(NumVertices);
+            TArray<TPair<int32, int32>> Edges;
+            Edges.Reserve(NumVertices * 2);
+            for (int32 Y = 0; Y < Side; ++Y)
+            {
+                for (int32 X = 0; X < Side; ++X)
+                {
+                    const int32 V = Y * Side + X;
+                    Positions[V] = FVector3f((X - (Side - 1) * 0.5f) * Spacing, Y * Spacing, 0.0f);
+                    if (X + 1 < Side)
+                    {
+                        Edges.Emplace(V, V + 1);
+                    }
+                    if (Y + 1 < Side)
+                    {
+                        Edges.Emplace(V, V + Side);
+                    }
+                }
+            }
+            FVertexAdjacency Adjacency;
+            Adjacency.Build(NumVertices, Edges);
+
+            // Mirrored bone chains: bone B on +X, bone B + BonesPerSide on -X
+            TArray<FVector3f> SegmentStart;
+            TArray<FVector3f> SegmentEnd;
+            TArray<int32> SegmentBone;
+            TArray<int32> BoneMirror;
+            BoneMirror.SetNumUninitialized(BonesPerSide * 2);
+            const float Extent = Side * Spacing;
+            for (int32 B = 0; B < BonesPerSide; ++B)
+            {
+                const float X = Extent * (0.05f + 0.4f * (B % 4) / 3.0f);
+                const float Y0 = Extent * (B / 4) / 4.0f;
+                const float Y1 = Extent * (B / 4 + 1) / 4.0f;
+                SegmentStart.Add(FVector3f(X, Y0, 0.0f));
+                SegmentEnd.Add(FVector3f(X, Y1, 0.0f));
+                SegmentBone.Add(B);
+                SegmentStart.Add(FVector3f(-X, Y0, 0.0f));
+                SegmentEnd.Add(FVector3f(-X, Y1, 0.0f));
+                SegmentBone.Add(B + BonesPerSide);
+                BoneMirror[B] = B + BonesPerSide;
+                BoneMirror[B + BonesPerSide] = B;
+            }
+
+            // Proximity weights with noise so normalize and prune have work to do
+            FSkinWeightBuffer Pristine;
+            Pristine.Init(NumVertices, Stride);
+            ComputeFromBones(Pristine, Positions, SegmentStart, SegmentEnd, SegmentBone, 2.0f, Stride);
+            FRandomStream Random(NumVertices);
+            for (float& Weight : Pristine.Weights)
+            {
+                Weight *= Random.FRandRange(0.5f, 1.5f);
+            }
+
+            FSkinWeightBuffer Work;
+            auto Measure = [&](const TCHAR* Kernel, TFunctionRef<void()> Body, TFunctionRef<bool(TSharedPtr<FJsonObject>&)> Verify)
+            {
+                double Best = TNumericLimits<double>::Max();
+                double Total = 0.0;
+                for (int32 Iter = 0; Iter < Iterations; ++Iter)
+                {
+                    Work = Pristine;
+                    const double Start = FPlatformTime::Seconds();
+                    Body();
+                    const double Elapsed = FPlatformTime::Seconds() - Start;
+                    Best = FMath::Min(Best, Elapsed);
+                    Total += Elapsed;
+                }
+
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("kernel"), Kernel);
+                Entry->SetNumberField(TEXT("vertices"), NumVertices);
+                Entry->SetNumberField(TEXT("bestMs"), Best * 1000.0);
+                Entry->SetNumberField(TEXT("avgMs"), Total / Iterations * 1000.0);
+                Entry->SetNumberField(TEXT("verticesPerSec"), Best > 0.0 ? NumVertices / Best : 0.0);
+                const bool bVerified = Verify(Entry);
+                Entry->SetBoolField(TEXT("verified"), bVerified);
+                bAllVerified &= bVerified;
+                Results.Add(MakeShared<FJsonValueObject>(Entry));
+            };
+
+            // Every kernel except mirror must leave each weighted vertex summing to 1
+            auto VerifySums = [&](TSharedPtr<FJsonObject>& Entry)
+            {
+                const FSumStats Before = ComputeSumStats(Pristine);
+                const FSumStats After = ComputeSumStats(Work);
+                Entry->SetObjectField(TEXT("before"), Before.ToJson());
+                Entry->SetObjectField(TEXT("after"), After.ToJson());
+                return After.Unnormalized == 0 && After.Unweighted == Before.Unweighted;
+            };
+
+            Measure(TEXT("normalize"), [&]() { Normalize(Work); }, VerifySums);
+            Measure(TEXT("prune"), [&]() { Prune(Work, PruneThreshold); Normalize(Work); },
+                [&](TSharedPtr<FJsonObject>& Entry)
+                {
+                    bool bAboveThreshold = true;
+                    for (int32 V = 0; V < NumVertices && bAboveThreshold; ++V)
+                    {
+                        for (int32 I = 1; I < Stride; ++I)
+                        {
+                            // Survivors were >= threshold before renormalizing, which only scales up
+                            bAboveThreshold &= Work.Bones[V * Stride + I] == INDEX_NONE || Work.Weights[V * Stride + I] >= PruneThreshold;
+                        }
+                    }
+                    return VerifySums(Entry) && bAboveThreshold;
+                });
+            Measure(TEXT("limit_influences"), [&]() { LimitInfluences(Work, InfluenceCap); Normalize(Work); },
+                [&](TSharedPtr<FJsonObject>& Entry)
+                {
+                    return VerifySums(Entry) && ComputeSumStats(Work).MaxInfluencesUsed <= InfluenceCap;
+                });
+            Measure(TEXT("smooth_x4"), [&]() { Smooth(Work, Adjacency, 4, 0.5f, Stride); }, VerifySums);
+            Measure(TEXT("mirror"), [&]()
+            {
+                int32 Unmatched = 0;
+                Mirror(Work, Positions, 0, true, BoneMirror, 0.1f * Spacing, Unmatched);
+            },
+            [&](TSharedPtr<FJsonObject>& Entry)
+            {
+                // Mirroring back must reproduce the source side exactly
+                FSkinWeightBuffer RoundTrip = Work;
+                int32 Unmatched = 0;
+                Mirror(RoundTrip, Positions, 0, false, BoneMirror, 0.1f * Spacing, Unmatched);
+                Entry->SetNumberField(TEXT("unmatched"), Unmatched);
+                return Unmatched == 0 && RoundTrip.Bones == Work.Bones && RoundTrip.Weights == Work.Weights;
+            });
+            Measure(TEXT("auto_from_bones"), [&]()
+            {
+                ComputeFromBones(Work, Positions, SegmentStart, SegmentEnd, SegmentBone, 2.0f, Stride);
+            }, VerifySums);
+            // auto_skin_weights pipeline: smoothing must not reintroduce influences past the cap
+            Measure(TEXT("auto_capped_smooth"), [&]()
+            {
+                ComputeFromBones(Work, Positions, SegmentStart, SegmentEnd, SegmentBone, 2.0f, 2);
+                Smooth(Work, Adjacency, 2, 0.5f, 2);
+            },
+            [&](TSharedPtr<FJsonObject>& Entry)
+            {
+                return VerifySums(Entry) && ComputeSumStats(Work).MaxInfluencesUsed <= 2;
+            });
+        }
+
+        Report->SetArrayField(TEXT("vertexCounts"), CountValues);
+        Report->SetNumberField(TEXT("iterations"), Iterations);
+        Report->SetNumberField(TEXT("workerThreads"), FTaskGraphInterface::Get().GetNumWorkerThreads());
+        Report->SetBoolField(TEXT("allVerified"), bAllVerified);
+        Report->SetArrayField(TEXT("results"), Results);
+        return Report;
+    }
+}
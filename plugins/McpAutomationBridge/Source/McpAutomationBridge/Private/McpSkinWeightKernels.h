@@ -0,0 +1,124 @@
+// =============================================================================
+// McpSkinWeightKernels.h
+// =============================================================================
+// CPU skin-weight kernels for the manage_skeleton weight actions.
+//
+// Weights are held in a flat, fixed-stride layout (FSkinWeightBuffer): every
+// vertex owns MaxInfluences slots of (bone, weight), unused slots have bone
+// INDEX_NONE and weight 0. The handlers copy the default skin weights of one
+// LOD's FMeshDescription into a buffer, run any number of kernels, and write
+// the result back with a single commit and one mesh rebuild.
+//
+// All kernels split vertices into ParallelFor chunks and only write the
+// vertex they own, so results do not depend on the worker count.
+//
+// KERNELS:
+//   - Normalize        : scale each vertex's weights to sum to 1
+//   - Prune            : drop influences below a threshold (keeps the largest)
+//   - LimitInfluences  : keep the N largest influences per vertex
+//   - Smooth           : blend with the average of edge neighbours (Jacobi)
+//   - Mirror           : copy weights from the mirror vertex across an axis,
+//                        remapping bones through a left/right table
+//   - ComputeFromBones : proximity weights from distance to bone segments
+//   - ComputeSumStats  : per-vertex weight sum statistics
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpSkinWeightKernels
+{
+    /** Fixed-stride skin weights: slot (V, I) lives at V * MaxInfluences + I. */
+    struct FSkinWeightBuffer
+    {
+        int32 NumVertices = 0;
+        int32 MaxInfluences = 0;
+        TArray<int32> Bones;
+        TArray<float> Weights;
+
+        void Init(int32 InNumVertices, int32 InMaxInfluences);
+
+        int32 GetNumInfluences(int32 Vertex) const;
+    };
+
+    /** Edge adjacency in compressed rows: neighbours of V are Neighbors[Offsets[V] .. Offsets[V + 1]). */
+    struct FVertexAdjacency
+    {
+        TArray<int32> Offsets;
+        TArray<int32> Neighbors;
+
+        /** Build from an undirected edge list (pairs of vertex indices). Duplicate edges are ignored. */
+        void Build(int32 NumVertices, const TArray<TPair<int32, int32>>& Edges);
+    };
+
+    /** Weight-sum statistics; sums outside 1 +- Tolerance count as unnormalized. */
+    struct FSumStats
+    {
+        double MinSum = 0.0;
+        double MaxSum = 0.0;
+        double MeanSum = 0.0;
+        int32 Unnormalized = 0;
+        int32 Unweighted = 0;
+        int32 TotalInfluences = 0;
+        int32 MaxInfluencesUsed = 0;
+
+        TSharedPtr<FJsonObject> ToJson() const;
+    };
+
+    /** Scale weights of every vertex to sum to 1. Returns the number of vertices changed. */
+    int32 Normalize(FSkinWeightBuffer& Buffer);
+
+    /**
+     * Remove influences below Threshold. The largest influence of a vertex is
+     * always kept so no vertex is left unweighted. Returns influences removed.
+     */
+    int32 Prune(FSkinWeightBuffer& Buffer, float Threshold);
+
+    /** Keep the MaxCount largest influences per vertex. Returns influences removed. */
+    int32 LimitInfluences(FSkinWeightBuffer& Buffer, int32 MaxCount);
+
+    /**
+     * Laplacian smoothing over the mesh topology: each iteration blends a
+     * vertex's weights with the mean of its neighbours by Strength (0-1),
+     * then keeps the MaxCount largest (at most the stride) and renormalizes.
+     */
+    void Smooth(FSkinWeightBuffer& Buffer, const FVertexAdjacency& Adjacency, int32 Iterations, float Strength, int32 MaxCount);
+
+    /**
+     * Mirror weights across the plane Axis = 0 (Axis 0/1/2 = X/Y/Z). Vertices
+     * on the target side (negative side when bPositiveToNegative) take the
+     * weights of the nearest vertex within Tolerance of their mirrored
+     * position, with bones remapped through BoneMirror (index -> mirrored
+     * index; INDEX_NONE or out of range keeps the bone). Returns vertices
+     * written; OutUnmatched counts target vertices with no source within
+     * Tolerance.
+     */
+    int32 Mirror(FSkinWeightBuffer& Buffer, const TArray<FVector3f>& Positions, int32 Axis, bool bPositiveToNegative,
+                 const TArray<int32>& BoneMirror, float Tolerance, int32& OutUnmatched);
+
+    /**
+     * Proximity weights: each vertex is weighted to the MaxCount bones (at
+     * most the buffer stride) whose segments are nearest, with weight
+     * 1 / distance^Falloff, then normalized. Segment S runs from
+     * SegmentStart[S] to SegmentEnd[S] and belongs to SegmentBone[S].
+     */
+    void ComputeFromBones(FSkinWeightBuffer& Buffer, const TArray<FVector3f>& Positions,
+                          const TArray<FVector3f>& SegmentStart, const TArray<FVector3f>& SegmentEnd,
+                          const TArray<int32>& SegmentBone, float Falloff, int32 MaxCount);
+
+    FSumStats ComputeSumStats(const FSkinWeightBuffer& Buffer, double Tolerance = 1.0e-3);
+
+    /**
+     * Time every kernel on a synthetic grid mesh of each vertex count and
+     * report vertices per second (best of Iterations). Each kernel is checked
+     * against its invariant: weight sums of 1 after normalize, prune, limit
+     * and smooth, no influence below the threshold after prune, at most the
+     * cap after limit, and an exact round trip for mirror.
+     */
+    TSharedPtr<FJsonObject> RunBenchmark(const TArray<int32>& VertexCounts, int32 Iterations);
+}
@@ -0,0 +1,653 @@
+// =============================================================================
+// McpSoundFolderImport.cpp
+// =============================================================================
+// Implementation of bulk wave import for create_sound_assets_from_folder.
+// =============================================================================
+
+#include "McpSoundFolderImport.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpVersionCompatibility.h"
+#include "McpAudioGraphSpec.h"
+#include "McpSaveCoordinator.h"
+
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+
+#if WITH_EDITOR && __has_include("Factories/SoundFactory.h")
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Audio.h"
+#include "Factories/SoundFactory.h"
+#include "ObjectTools.h"
+#include "Sound/SoundWave.h"
+#include "UObject/Package.h"
+#define MCP_HAS_SOUND_IMPORT 1
+#else
+#define MCP_HAS_SOUND_IMPORT 0
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcpSoundFolderImport, Log, All);
+
+namespace McpSoundFolderImport
+{
+    namespace
+    {
+        constexpr double PROGRESS_INTERVAL_SECONDS = 0.25;
+
+        /** Failures listed in the report; the count is always exact. */
+        constexpr int32 MAX_REPORTED_FAILURES = 50;
+
+        /** Worker result for one file. */
+        struct FReadResult
+        {
+            TArray<uint8> Data;
+            FString Error;
+            int32 Channels = 0;
+            int32 SampleRate = 0;
+            double DurationSeconds = 0.0;
+            double ReadSeconds = 0.0;
+            double FinishedSeconds = 0.0;
+        };
+
+        struct FItem
+        {
+            FString File;
+            /** Subfolder below the source folder, sanitized for package paths ("" at the top). */
+            FString RelativeFolder;
+            FString Name;
+            TFuture<FReadResult> Read;
+        };
+
+        struct FJob
+        {
+            FSettings Settings;
+            TArray<FItem> Items;
+            int32 NextToLaunch = 0;
+            int32 NextToImport = 0;
+            int32 MaxInFlight = 0;
+
+#if MCP_HAS_SOUND_IMPORT
+            TStrongObjectPtr<USoundFactory> Factory;
+#endif
+
+            int32 Imported = 0;
+            int32 Skipped = 0;
+            int32 Wrapped = 0;
+            int32 WrapSkipped = 0;
+            int32 FailedCount = 0;
+            bool bTimedOut = false;
+            TArray<TSharedPtr<FJsonValue>> Failed;
+            TArray<TSharedPtr<FJsonValue>> Warnings;
+            int64 Bytes = 0;
+            double AudioSeconds = 0.0;
+
+            double StartSeconds = 0.0;
+            double ListSeconds = 0.0;
+            double ReadSeconds = 0.0;
+            double LastReadFinishedSeconds = 0.0;
+            double ImportSeconds = 0.0;
+            double WrapSeconds = 0.0;
+            double LastProgressSeconds = 0.0;
+
+            FProgressSink OnProgress;
+            FCompletionSink OnComplete;
+        };
+
+        struct FState
+        {
+            TSharedPtr<FJob> Job;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        void AddFailure(FJob& Job, const FString& File, const FString& Error)
+        {
+            ++Job.FailedCount;
+            UE_LOG(LogMcpSoundFolderImport, Warning, TEXT("%s: %s"), *File, *Error);
+            if (Job.Failed.Num() < MAX_REPORTED_FAILURES)
+            {
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("file"), File);
+                Entry->SetStringField(TEXT("error"), Error);
+                Job.Failed.Add(MakeShared<FJsonValueObject>(Entry));
+            }
+        }
+
+        TFuture<FReadResult> LaunchRead(const FString& File)
+        {
+            return Async(EAsyncExecution::ThreadPool, [File]()
+            {
+                FReadResult Result;
+                const double Start = FPlatformTime::Seconds();
+                if (!FFileHelper::LoadFileToArray(Result.Data, *File))
+                {
+                    Result.Error = TEXT("could not read the file");
+                }
+#if MCP_HAS_SOUND_IMPORT
+                else if (FPaths::GetExtension(File).Equals(TEXT("wav"), ESearchCase::IgnoreCase))
+                {
+                    // Header parsing is pure; reject broken files before they reach the game thread
+                    FWaveModInfo WaveInfo;
+                    FString Error;
+                    if (!WaveInfo.ReadWaveInfo(Result.Data.GetData(), Result.Data.Num(), &Error))
+                    {
+                        Result.Error = FString::Printf(TEXT("not a supported WAVE file (%s)"), *Error);
+                    }
+                    else
+                    {
+                        Result.Channels = *WaveInfo.pChannels;
+                        Result.SampleRate = *WaveInfo.pSamplesPerSec;
+                        const int32 FrameBytes = Result.Channels * (*WaveInfo.pBitsPerSample / 8);
+                        if (FrameBytes > 0 && Result.SampleRate > 0)
+                        {
+                            Result.DurationSeconds = static_cast<double>(WaveInfo.SampleDataSize) / FrameBytes / Result.SampleRate;
+                        }
+                    }
+                }
+#endif
+                Result.FinishedSeconds = FPlatformTime::Seconds();
+                Result.ReadSeconds = Result.FinishedSeconds - Start;
+                return Result;
+            });
+        }
+
+        /** Keep up to MaxInFlight reads ahead of the importer. */
+        void LaunchReads(FJob& Job)
+        {
+            while (Job.NextToLaunch < Job.Items.Num() && Job.NextToLaunch - Job.NextToImport < Job.MaxInFlight)
+            {
+                FItem& Item = Job.Items[Job.NextToLaunch++];
+                Item.Read = LaunchRead(Item.File);
+            }
+        }
+
+        FString JoinPackagePath(const FString& Folder, const FString& RelativeFolder, const FString& Name)
+        {
+            return RelativeFolder.IsEmpty() ? Folder / Name : Folder / RelativeFolder / Name;
+        }
+
+#if MCP_HAS_SOUND_IMPORT
+        /** Queue Asset for the end-of-job flush, or only register it when the job does not save. */
+        void QueueOrRegister(const FJob& Job, UObject* Asset)
+        {
+            if (Job.Settings.bSave)
+            {
+                McpSaveCoordinator::Enqueue(Asset);
+                return;
+            }
+            Asset->MarkPackageDirty();
+            FAssetRegistryModule::AssetCreated(Asset);
+        }
+
+        void ImportItem(FJob& Job, const FItem& Item, FReadResult&& Read)
+        {
+            Job.ReadSeconds += Read.ReadSeconds;
+            Job.LastReadFinishedSeconds = FMath::Max(Job.LastReadFinishedSeconds, Read.FinishedSeconds);
+            if (!Read.Error.IsEmpty())
+            {
+                AddFailure(Job, Item.File, Read.Error);
+                return;
+            }
+            Job.Bytes += Read.Data.Num();
+            Job.AudioSeconds += Read.DurationSeconds;
+
+            // ---- Wave ------------------------------------------------------
+            const double ImportStart = FPlatformTime::Seconds();
+            const FString WavePath = JoinPackagePath(Job.Settings.DestinationPath, Item.RelativeFolder, Item.Name);
+            USoundWave* Wave = LoadObject<USoundWave>(nullptr, *(WavePath + TEXT(".") + Item.Name), nullptr, LOAD_NoWarn | LOAD_Quiet);
+            if (Wave && !Job.Settings.bOverwrite)
+            {
+                // Existing waves are kept, but still wrapped below if their wrapper is missing
+                ++Job.Skipped;
+            }
+            else
+            {
+                UPackage* Package = CreatePackage(*WavePath);
+                if (!Package)
+                {
+                    AddFailure(Job, Item.File, FString::Printf(TEXT("cannot create package %s"), *WavePath));
+                    return;
+                }
+                // The factory records the source file in the wave's import data
+                UFactory::CurrentFilename = Item.File;
+                const uint8* Buffer = Read.Data.GetData();
+                UObject* Created = Job.Factory->FactoryCreateBinary(USoundWave::StaticClass(), Package, FName(*Item.Name),
+                    RF_Public | RF_Standalone | RF_Transactional, nullptr, *FPaths::GetExtension(Item.File),
+                    Buffer, Buffer + Read.Data.Num(), GWarn);
+                UFactory::CurrentFilename.Reset();
+                Wave = Cast<USoundWave>(Created);
+                if (!Wave)
+                {
+                    AddFailure(Job, Item.File, TEXT("the sound factory rejected the file"));
+                    return;
+                }
+                ++Job.Imported;
+                QueueOrRegister(Job, Wave);
+            }
+            Job.ImportSeconds += FPlatformTime::Seconds() - ImportStart;
+
+            // ---- Wrapper ---------------------------------------------------
+            const bool bMetaSound = Job.Settings.Wrap == TEXT("metasound");
+            if (Job.Settings.Wrap == TEXT("none"))
+            {
+                return;
+            }
+            const double WrapStart = FPlatformTime::Seconds();
+            const FString WrapperName = Job.Settings.WrapPrefix + Item.Name;
+            const FString WrapperPath = JoinPackagePath(Job.Settings.WrapPath, Item.RelativeFolder, WrapperName);
+            UObject* Wrapper = LoadObject<UObject>(nullptr, *(WrapperPath + TEXT(".") + WrapperName), nullptr, LOAD_NoWarn | LOAD_Quiet);
+            if (Wrapper && !Job.Settings.bOverwrite)
+            {
+                ++Job.WrapSkipped;
+                Job.WrapSeconds += FPlatformTime::Seconds() - WrapStart;
+                return;
+            }
+
+            const FString AssetType = bMetaSound ? TEXT("MetaSound") : TEXT("SoundCue");
+            FString Error, ErrorCode;
+            if (!Wrapper)
+            {
+                Wrapper = McpAudioGraphSpec::CreateAsset(WrapperPath, AssetType, Error, ErrorCode);
+            }
+            McpAudioGraphSpec::FApplyResult Applied;
+            if (!Wrapper ||
+                !McpAudioGraphSpec::Apply(Wrapper, McpAudioGraphSpec::MakeWaveWrapperSpec(AssetType, Wave->GetPathName()),
+                                          Applied, Error, ErrorCode))
+            {
+                AddFailure(Job, Item.File, FString::Printf(TEXT("wrap failed: %s"), *Error));
+            }
+            else
+            {
+                ++Job.Wrapped;
+                QueueOrRegister(Job, Wrapper);
+                for (const FString& Warning : Applied.Warnings)
+                {
+                    if (Job.Warnings.Num() < MAX_REPORTED_FAILURES)
+                    {
+                        Job.Warnings.Add(MakeShared<FJsonValueString>(WrapperName + TEXT(": ") + Warning));
+                    }
+                }
+            }
+            Job.WrapSeconds += FPlatformTime::Seconds() - WrapStart;
+        }
+#endif
+
+        void Finish(const TSharedPtr<FJob>& Job)
+        {
+            GetState().Job.Reset();
+
+            McpSaveCoordinator::FFlushResult Flush;
+            if (Job->Settings.bSave)
+            {
+                Flush = McpSaveCoordinator::Flush(TEXT("create_sound_assets_from_folder"));
+            }
+            const double Now = FPlatformTime::Seconds();
+            const double WallSeconds = Now - Job->StartSeconds;
+
+            TSharedPtr<FJsonObject> Report = MakeShared<FJsonObject>();
+            Report->SetStringField(TEXT("sourceFolder"), Job->Settings.SourceFolder);
+            Report->SetStringField(TEXT("destinationPath"), Job->Settings.DestinationPath);
+            Report->SetStringField(TEXT("wrap"), Job->Settings.Wrap);
+            if (Job->Settings.Wrap != TEXT("none"))
+            {
+                Report->SetStringField(TEXT("wrapPath"), Job->Settings.WrapPath);
+            }
+            Report->SetNumberField(TEXT("files"), Job->Items.Num());
+            Report->SetNumberField(TEXT("imported"), Job->Imported);
+            Report->SetNumberField(TEXT("skipped"), Job->Skipped);
+            Report->SetNumberField(TEXT("wrapped"), Job->Wrapped);
+            Report->SetNumberField(TEXT("wrapSkipped"), Job->WrapSkipped);
+            Report->SetNumberField(TEXT("failedCount"), Job->FailedCount);
+            Report->SetNumberField(TEXT("notImported"), Job->Items.Num() - Job->NextToImport);
+            Report->SetBoolField(TEXT("timedOut"), Job->bTimedOut);
+            Report->SetArrayField(TEXT("failed"), Job->Failed);
+            Report->SetArrayField(TEXT("warnings"), Job->Warnings);
+            Report->SetNumberField(TEXT("megabytes"), static_cast<double>(Job->Bytes) / (1024.0 * 1024.0));
+            Report->SetNumberField(TEXT("audioSeconds"), Job->AudioSeconds);
+            Report->SetNumberField(TEXT("workers"), Job->MaxInFlight);
+
+            Report->SetNumberField(TEXT("wallMs"), WallSeconds * 1000.0);
+            Report->SetNumberField(TEXT("listMs"), Job->ListSeconds * 1000.0);
+            Report->SetNumberField(TEXT("readMs"), Job->ReadSeconds * 1000.0);
+            Report->SetNumberField(TEXT("readWallMs"),
+                FMath::Max(0.0, Job->LastReadFinishedSeconds - Job->StartSeconds) * 1000.0);
+            Report->SetNumberField(TEXT("importMs"), Job->ImportSeconds * 1000.0);
+            Report->SetNumberField(TEXT("wrapMs"), Job->WrapSeconds * 1000.0);
+            Report->SetNumberField(TEXT("saveMs"), (Flush.SaveSeconds + Flush.ScanSeconds) * 1000.0);
+            Report->SetNumberField(TEXT("wavesPerSecond"),
+                WallSeconds > 0.0 ? (Job->Imported + Job->Skipped) / WallSeconds : 0.0);
+            if (Job->Settings.bSave)
+            {
+                Report->SetObjectField(TEXT("save"), McpSaveCoordinator::FlushResultToJson(Flush));
+            }
+
+            UE_LOG(LogMcpSoundFolderImport, Log,
+                TEXT("%s: %d imported, %d skipped, %d wrapped, %d failed in %.1f ms (read %.1f ms on workers, import %.1f ms, wrap %.1f ms)"),
+                *Job->Settings.SourceFolder, Job->Imported, Job->Skipped, Job->Wrapped, Job->FailedCount,
+                WallSeconds * 1000.0, Job->ReadSeconds * 1000.0, Job->ImportSeconds * 1000.0, Job->WrapSeconds * 1000.0);
+
+            // Any failed or unreached file fails the job; the report still lists what was imported
+            FString ErrorCode;
+            if (Job->bTimedOut)
+            {
+                ErrorCode = TEXT("TIMEOUT");
+            }
+            else if (Job->FailedCount > 0)
+            {
+                ErrorCode = Job->Imported + Job->Skipped > 0 ? TEXT("PARTIAL_IMPORT") : TEXT("IMPORT_FAILED");
+            }
+            const bool bSuccess = ErrorCode.IsEmpty();
+            Report->SetBoolField(TEXT("partial"), !bSuccess && Job->Imported + Job->Skipped > 0);
+
+            FString Message = FString::Printf(TEXT("Imported %d of %d sound files and wrapped %d in %.2f s (%d failed)"),
+                Job->Imported, Job->Items.Num(), Job->Wrapped, WallSeconds, Job->FailedCount);
+            if (Job->bTimedOut)
+            {
+                Message += FString::Printf(TEXT("; stopped after %.0f s with %d files not imported"),
+                    Job->Settings.TimeoutSeconds, Job->Items.Num() - Job->NextToImport);
+            }
+            if (Job->OnComplete)
+            {
+                Job->OnComplete(bSuccess, Message, Report, ErrorCode);
+            }
+        }
+
+        /** 16-bit mono PCM sine tone as a complete RIFF/WAVE file. */
+        TArray<uint8> MakeSineWave(double Frequency, double Seconds, int32 SampleRate)
+        {
+            const int32 NumSamples = FMath::Max(1, static_cast<int32>(Seconds * SampleRate));
+            const uint32 DataBytes = NumSamples * sizeof(int16);
+
+            TArray<uint8> Bytes;
+            Bytes.Reserve(44 + DataBytes);
+            auto Write32 = [&Bytes](uint32 Value) { Bytes.Append(reinterpret_cast<const uint8*>(&Value), 4); };
+            auto Write16 = [&Bytes](uint16 Value) { Bytes.Append(reinterpret_cast<const uint8*>(&Value), 2); };
+            auto WriteTag = [&Bytes](const char* Tag) { Bytes.Append(reinterpret_cast<const uint8*>(Tag), 4); };
+
+            WriteTag("RIFF");
+            Write32(36 + DataBytes);
+            WriteTag("WAVE");
+            WriteTag("fmt ");
+            Write32(16);
+            Write16(1); // PCM
+            Write16(1); // mono
+            Write32(SampleRate);
+            Write32(SampleRate * sizeof(int16));
+            Write16(sizeof(int16));
+            Write16(16);
+            WriteTag("data");
+            Write32(DataBytes);
+            for (int32 Index = 0; Index < NumSamples; ++Index)
+            {
+                const double Sample = 0.5 * FMath::Sin(2.0 * PI * Frequency * Index / SampleRate);
+                Write16(static_cast<uint16>(static_cast<int16>(Sample * 32767.0)));
+            }
+            return Bytes;
+        }
+    }
+
+    bool Start(const FSettings& InSettings, FProgressSink OnProgress, FCompletionSink OnComplete,
+               FString& OutError, FString& OutErrorCode)
+    {
+#if MCP_HAS_SOUND_IMPORT
+        FState& State = GetState();
+        if (State.Job.IsValid())
+        {
+            OutError = TEXT("A sound folder import is already running");
+            OutErrorCode = TEXT("IMPORT_RUNNING");
+            return false;
+        }
+
+        TSharedPtr<FJob> Job = MakeShared<FJob>();
+        Job->StartSeconds = FPlatformTime::Seconds();
+        FSettings& Settings = Job->Settings;
+        Settings = InSettings;
+        Settings.Wrap = Settings.Wrap.ToLower();
+        if (Settings.Wrap != TEXT("cue") && Settings.Wrap != TEXT("metasound") && Settings.Wrap != TEXT("none"))
+        {
+            OutError = FString::Printf(TEXT("wrap must be cue, metasound or none, not '%s'"), *InSettings.Wrap);
+            OutErrorCode = TEXT("INVALID_ARGUMENT");
+            return false;
+        }
+        if (Settings.WrapPath.IsEmpty())
+        {
+            Settings.WrapPath = Settings.DestinationPath / (Settings.Wrap == TEXT("metasound") ? TEXT("MetaSounds") : TEXT("Cues"));
+        }
+        if (Settings.WrapPrefix.IsEmpty())
+        {
+            Settings.WrapPrefix = Settings.Wrap == TEXT("metasound") ? TEXT("MS_") : TEXT("SC_");
+        }
+        Settings.DestinationPath = SanitizeProjectRelativePath(Settings.DestinationPath);
+        Settings.WrapPath = SanitizeProjectRelativePath(Settings.WrapPath);
+        if (Settings.DestinationPath.IsEmpty() || Settings.WrapPath.IsEmpty())
+        {
+            OutError = TEXT("destinationPath and wrapPath must be content folders such as /Game/Audio");
+            OutErrorCode = TEXT("INVALID_PATH");
+            return false;
+        }
+
+        FString Folder = FPaths::IsRelative(Settings.SourceFolder)
+            ? FPaths::ProjectDir() / Settings.SourceFolder
+            : Settings.SourceFolder;
+        Folder = FPaths::ConvertRelativePathToFull(Folder);
+        FPaths::NormalizeDirectoryName(Folder);
+        if (!IFileManager::Get().DirectoryExists(*Folder))
+        {
+            OutError = FString::Printf(TEXT("Source folder not found: %s"), *Settings.SourceFolder);
+            OutErrorCode = TEXT("SOURCE_NOT_FOUND");
+            return false;
+        }
+        Settings.SourceFolder = Folder;
+
+        TArray<FString> Files;
+        for (const FString& Extension : Settings.Extensions)
+        {
+            const FString Wildcard = TEXT("*.") + Extension.Replace(TEXT("."), TEXT(""));
+            if (Settings.bRecursive)
+            {
+                IFileManager::Get().FindFilesRecursive(Files, *Folder, *Wildcard, true, false, false);
+            }
+            else
+            {
+                TArray<FString> Names;
+                IFileManager::Get().FindFiles(Names, *(Folder / Wildcard), true, false);
+                for (const FString& Name : Names)
+                {
+                    Files.Add(Folder / Name);
+                }
+            }
+        }
+        Files.Sort();
+        if (Settings.MaxFiles > 0 && Files.Num() > Settings.MaxFiles)
+        {
+            Files.SetNum(Settings.MaxFiles);
+        }
+        if (Files.Num() == 0)
+        {
+            OutError = FString::Printf(TEXT("No %s files in %s"), *FString::Join(Settings.Extensions, TEXT("/")), *Folder);
+            OutErrorCode = TEXT("NO_FILES");
+            return false;
+        }
+
+        for (const FString& File : Files)
+        {
+            FItem& Item = Job->Items.AddDefaulted_GetRef();
+            Item.File = File;
+            Item.Name = ObjectTools::SanitizeObjectName(FPaths::GetBaseFilename(File));
+            FString Relative = FPaths::GetPath(File).RightChop(Folder.Len());
+            TArray<FString> Segments;
+            Relative.ParseIntoArray(Segments, TEXT("/"), true);
+            for (FString& Segment : Segments)
+            {
+                Segment = ObjectTools::SanitizeObjectName(Segment);
+            }
+            Item.RelativeFolder = FString::Join(Segments, TEXT("/"));
+        }
+
+        Job->Factory.Reset(NewObject<USoundFactory>());
+        Job->Factory->bAutoCreateCue = false;
+        Job->Factory->SuppressImportDialogs();
+        // Two reads per pool thread keeps the workers busy while the importer drains
+        Job->MaxInFlight = FMath::Max(2, 2 * (GThreadPool ? GThreadPool->GetNumThreads() : 1));
+        Job->OnProgress = MoveTemp(OnProgress);
+        Job->OnComplete = MoveTemp(OnComplete);
+        Job->ListSeconds = FPlatformTime::Seconds() - Job->StartSeconds;
+
+        UE_LOG(LogMcpSoundFolderImport, Log, TEXT("Importing %d files from %s to %s (wrap: %s, %d reads in flight)"),
+            Job->Items.Num(), *Folder, *Settings.DestinationPath, *Settings.Wrap, Job->MaxInFlight);
+        LaunchReads(*Job);
+        State.Job = Job;
+        return true;
+#else
+        OutError = TEXT("create_sound_assets_from_folder requires the editor");
+        OutErrorCode = TEXT("NOT_SUPPORTED");
+        return false;
+#endif
+    }
+
+    void Tick()
+    {
+#if MCP_HAS_SOUND_IMPORT
+        TSharedPtr<FJob> Job = GetState().Job;
+        if (!Job.IsValid())
+        {
+            return;
+        }
+
+        const double Deadline = FPlatformTime::Seconds() + Job->Settings.FrameBudgetMs / 1000.0;
+        while (Job->NextToImport < Job->Items.Num() && FPlatformTime::Seconds() < Deadline)
+        {
+            FItem& Item = Job->Items[Job->NextToImport];
+            if (!Item.Read.IsValid() || !Item.Read.IsReady())
+            {
+                break;
+            }
+            FReadResult Read = Item.Read.Consume();
+            ImportItem(*Job, Item, MoveTemp(Read));
+            ++Job->NextToImport;
+            LaunchReads(*Job);
+        }
+
+        const double Now = FPlatformTime::Seconds();
+        if (Job->OnProgress && Now - Job->LastProgressSeconds >= PROGRESS_INTERVAL_SECONDS)
+        {
+            Job->LastProgressSeconds = Now;
+            Job->OnProgress(100.0f * Job->NextToImport / Job->Items.Num(),
+                FString::Printf(TEXT("Imported %d/%d sound files"), Job->NextToImport, Job->Items.Num()));
+        }
+        if (Job->NextToImport == Job->Items.Num())
+        {
+            Finish(Job);
+        }
+        else if (Now - Job->StartSeconds >= Job->Settings.TimeoutSeconds)
+        {
+            // Reads still on the pool are dropped with the job
+            Job->bTimedOut = true;
+            Finish(Job);
+        }
+#endif
+    }
+
+    bool StartBenchmark(const FBenchmarkSettings& InSettings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                        FString& OutError, FString& OutErrorCode)
+    {
+        if (IsRunning())
+        {
+            OutError = TEXT("A sound folder import is already running");
+            OutErrorCode = TEXT("IMPORT_RUNNING");
+            return false;
+        }
+        FBenchmarkSettings Settings = InSettings;
+        Settings.WaveCount = FMath::Clamp(Settings.WaveCount, 1, 2000);
+        Settings.DurationSeconds = FMath::Clamp(Settings.DurationSeconds, 0.05, 30.0);
+        Settings.RootPath = SanitizeProjectRelativePath(Settings.RootPath);
+        if (Settings.RootPath.IsEmpty())
+        {
+            OutError = TEXT("rootPath must be a content folder such as /Game/McpSoundImportBenchmark");
+            OutErrorCode = TEXT("INVALID_PATH");
+            return false;
+        }
+
+        // Generate the source files in parallel; they stand in for a folder of recordings
+        const FString RunId = FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(8);
+        const FString TempFolder = FPaths::ConvertRelativePathToFull(
+            FPaths::ProjectSavedDir() / TEXT("McpSoundImportBenchmark") / RunId);
+        IFileManager::Get().MakeDirectory(*TempFolder, true);
+        const double GenerateStart = FPlatformTime::Seconds();
+        TAtomic<int32> WriteFailures(0);
+        ParallelFor(Settings.WaveCount, [&](int32 Index)
+        {
+            const TArray<uint8> Bytes = MakeSineWave(220.0 + 5.0 * (Index % 100), Settings.DurationSeconds, 44100);
+            if (!FFileHelper::SaveArrayToFile(Bytes, *(TempFolder / FString::Printf(TEXT("Tone_%04d.wav"), Index))))
+            {
+                ++WriteFailures;
+            }
+        });
+        const double GenerateSeconds = FPlatformTime::Seconds() - GenerateStart;
+        if (WriteFailures.Load() > 0)
+        {
+            IFileManager::Get().DeleteDirectory(*TempFolder, false, true);
+            OutError = FString::Printf(TEXT("Could not write %d generated waves to %s"), WriteFailures.Load(), *TempFolder);
+            OutErrorCode = TEXT("WRITE_FAILED");
+            return false;
+        }
+
+        const FString RunPath = Settings.RootPath / (TEXT("Run_") + RunId);
+        FSettings Job;
+        Job.SourceFolder = TempFolder;
+        Job.DestinationPath = RunPath / TEXT("Waves");
+        Job.bRecursive = false;
+        Job.Wrap = Settings.Wrap;
+        Job.WrapPath = RunPath / TEXT("Wrappers");
+        Job.TimeoutSeconds = FMath::Max(1.0, Settings.TimeoutSeconds - GenerateSeconds);
+
+        auto Complete = [Settings, TempFolder, RunPath, GenerateSeconds, OnComplete = MoveTemp(OnComplete)](
+            bool bSuccess, const FString& Message, const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)
+        {
+            Result->SetNumberField(TEXT("waveCount"), Settings.WaveCount);
+            Result->SetNumberField(TEXT("durationSeconds"), Settings.DurationSeconds);
+            Result->SetNumberField(TEXT("generateMs"), GenerateSeconds * 1000.0);
+            Result->SetStringField(TEXT("assetPath"), RunPath);
+            if (Settings.bCleanup)
+            {
+                Result->SetBoolField(TEXT("cleanedUp"), McpSafeOperations::McpSafeDeleteFolder(RunPath));
+            }
+            IFileManager::Get().DeleteDirectory(*TempFolder, false, true);
+            if (OnComplete)
+            {
+                OnComplete(bSuccess, FString::Printf(TEXT("Benchmark: %s"), *Message), Result, ErrorCode);
+            }
+        };
+        if (!Start(Job, MoveTemp(OnProgress), MoveTemp(Complete), OutError, OutErrorCode))
+        {
+            IFileManager::Get().DeleteDirectory(*TempFolder, false, true);
+            return false;
+        }
+        return true;
+    }
+
+    bool IsRunning()
+    {
+        return GetState().Job.IsValid();
+    }
+
+    void CancelAll()
+    {
+        TSharedPtr<FJob> Job = MoveTemp(GetState().Job);
+        if (Job.IsValid())
+        {
+            Job->OnProgress = nullptr;
+            Job->OnComplete = nullptr;
+            // Reads still on the pool own their file name and buffer; their results are dropped
+        }
+    }
+}
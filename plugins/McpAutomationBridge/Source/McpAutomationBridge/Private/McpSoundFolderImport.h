@@ -0,0 +1,104 @@
+// =============================================================================
+// McpSoundFolderImport.h
+// =============================================================================
+// Bulk wave import for manage_audio_authoring create_sound_assets_from_folder.
+//
+// manage_asset import brings in one file per request through the automated
+// import path, and wrapping a wave in a cue or MetaSound is another request
+// with its own save. A folder job instead:
+//
+//   - lists the files once, then reads and parses them (RIFF/WAVE header:
+//     channels, rate, duration) on thread pool tasks, a bounded window ahead
+//     of the importer so memory stays flat for large folders
+//   - creates the USoundWave assets from the bytes already in memory on the
+//     game thread (UObject creation needs it), within a per-tick time budget
+//     so the editor keeps ticking
+//   - wraps each wave in a SoundCue or MetaSound through McpAudioGraphSpec
+//   - queues every package with McpSaveCoordinator and flushes once at the
+//     end: one SavePackages batch and one registry scan for the whole job
+//     (the subsystem holds the coordinator's idle and queue-full flushes
+//     while a job runs); with save off the packages are only marked dirty
+//
+// One job runs at a time. All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpSoundFolderImport
+{
+    struct FSettings
+    {
+        /** Folder on disk (absolute, or relative to the project directory). */
+        FString SourceFolder;
+        /** /Game folder for the waves; subfolders are mirrored when recursive. */
+        FString DestinationPath;
+        bool bRecursive = true;
+        /** File extensions without the dot. */
+        TArray<FString> Extensions = {TEXT("wav")};
+        /** "cue", "metasound" or "none". */
+        FString Wrap = TEXT("cue");
+        /** /Game folder for the wrappers; defaults to DestinationPath/Cues or DestinationPath/MetaSounds. */
+        FString WrapPath;
+        /** Wrapper name prefix; defaults to SC_ / MS_. */
+        FString WrapPrefix;
+        /** Replace existing waves and wrappers; otherwise they are skipped. */
+        bool bOverwrite = false;
+        /** Import at most this many files (0 = all). */
+        int32 MaxFiles = 0;
+        /** Game-thread time spent importing per tick. */
+        double FrameBudgetMs = 50.0;
+        /** Queue the packages and flush the save coordinator when the job ends; otherwise only mark them dirty. */
+        bool bSave = true;
+        /** Stop importing after this long and report the files not reached. */
+        double TimeoutSeconds = 240.0;
+    };
+
+    struct FBenchmarkSettings
+    {
+        int32 WaveCount = 300;
+        double DurationSeconds = 1.0;
+        FString Wrap = TEXT("cue");
+        /** /Game folder for the imported waves and wrappers. */
+        FString RootPath = TEXT("/Game/McpSoundImportBenchmark");
+        /** Delete the generated files and the imported assets afterwards. */
+        bool bCleanup = true;
+        /** Upper bound for the whole run, file generation included. */
+        double TimeoutSeconds = 240.0;
+    };
+
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+    using FCompletionSink = TFunction<void(bool bSuccess, const FString& Message,
+                                           const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)>;
+
+    /**
+     * Start a folder job. Returns false with OutError / OutErrorCode set when
+     * the settings are invalid, the folder has no matching files or a job is
+     * already running; otherwise OnComplete runs on a later tick with the
+     * report (counts, failures, wall time and its read / import / wrap / save
+     * split). The job fails with PARTIAL_IMPORT or IMPORT_FAILED when any file
+     * failed, and with TIMEOUT when TimeoutSeconds ran out first.
+     */
+    bool Start(const FSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+               FString& OutError, FString& OutErrorCode);
+
+    /**
+     * Write WaveCount generated sine waves under Saved/, run a folder job on
+     * them and report its wall time, then clean up.
+     */
+    bool StartBenchmark(const FBenchmarkSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                        FString& OutError, FString& OutErrorCode);
+
+    bool IsRunning();
+
+    /** Drop the running job (subsystem shutdown). The completion is not reported. */
+    void CancelAll();
+
+    /** Import the files that are ready. Called from the subsystem ticker. */
+    void Tick();
+}
@@ -0,0 +1,643 @@
+// =============================================================================
+// McpTraceAnalysis.cpp
+// =============================================================================
+// Implementation of trace listing and in-process trace analysis.
+// =============================================================================
+
+#include "McpTraceAnalysis.h"
+#include "McpVersionCompatibility.h"
+#include "McpAutomationBridgeHelpers.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonValue.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "TraceServices/AnalysisService.h"
+#include "TraceServices/Containers/Tables.h"
+#include "TraceServices/ITraceServicesModule.h"
+#include "TraceServices/Model/Counters.h"
+#include "TraceServices/Model/Frames.h"
+#include "TraceServices/Model/LoadTimeProfiler.h"
+#include "TraceServices/Model/Threads.h"
+#include "TraceServices/Model/TimingProfiler.h"
+#include <atomic>
+
+namespace McpTraceAnalysis
+{
+    namespace
+    {
+        constexpr double PROGRESS_INTERVAL_SECONDS = 1.0;
+        constexpr int32 MAX_LOAD_TIME_EVENTS = 25;
+
+        struct FTimerStats
+        {
+            double Inclusive = 0.0;
+            double Exclusive = 0.0;
+            double Max = 0.0;
+            int64 Count = 0;
+            /** Open scopes of this timer on the current stack (recursion guard for inclusive time). */
+            int32 ActiveDepth = 0;
+        };
+
+        struct FOpenScope
+        {
+            uint32 TimerIndex = 0;
+            double Start = 0.0;
+            double ChildTime = 0.0;
+        };
+
+        struct FAnalysis
+        {
+            FString FilePath;
+            FAnalyzeOptions Options;
+            FProgressSink OnProgress;
+            FCompletionSink OnComplete;
+            TSharedPtr<const TraceServices::IAnalysisSession> Session;
+            double StartTime = 0.0;
+            double LastProgress = 0.0;
+            double AnalysisSeconds = 0.0;
+            bool bExtracting = false;
+            std::atomic<bool> bCancelled{ false };
+        };
+
+        struct FState
+        {
+            TSharedPtr<FAnalysis> Active;
+            FTSTicker::FDelegateHandle TickHandle;
+        };
+
+        FState& GetState()
+        {
+            static FState State;
+            return State;
+        }
+
+        /** min / avg / p95 / max in milliseconds of a list of durations in seconds. */
+        TSharedPtr<FJsonObject> DurationStats(TArray<double> Seconds)
+        {
+            TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+            Stats->SetNumberField(TEXT("count"), Seconds.Num());
+            if (Seconds.Num() == 0)
+            {
+                return Stats;
+            }
+            Seconds.Sort();
+            double Sum = 0.0;
+            for (const double Value : Seconds)
+            {
+                Sum += Value;
+            }
+            const int32 P95 = FMath::Clamp(FMath::CeilToInt(0.95 * Seconds.Num()) - 1, 0, Seconds.Num() - 1);
+            Stats->SetNumberField(TEXT("minMs"), Seconds[0] * 1000.0);
+            Stats->SetNumberField(TEXT("avgMs"), Sum / Seconds.Num() * 1000.0);
+            Stats->SetNumberField(TEXT("p95Ms"), Seconds[P95] * 1000.0);
+            Stats->SetNumberField(TEXT("maxMs"), Seconds.Last() * 1000.0);
+            return Stats;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> TopTimersJson(const TMap<uint32, FTimerStats>& Timers, int32 Limit,
+                                                     const TraceServices::ITimingProfilerTimerReader& TimerReader)
+        {
+            TArray<TPair<uint32, const FTimerStats*>> Sorted;
+            for (const TPair<uint32, FTimerStats>& Timer : Timers)
+            {
+                Sorted.Emplace(Timer.Key, &Timer.Value);
+            }
+            Sorted.Sort([](const TPair<uint32, const FTimerStats*>& A, const TPair<uint32, const FTimerStats*>& B)
+            {
+                return A.Value->Inclusive > B.Value->Inclusive;
+            });
+
+            TArray<TSharedPtr<FJsonValue>> Values;
+            for (int32 Index = 0; Index < Sorted.Num() && Index < Limit; ++Index)
+            {
+                const TraceServices::FTimingProfilerTimer* Timer = TimerReader.GetTimer(Sorted[Index].Key);
+                const FTimerStats& Stats = *Sorted[Index].Value;
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("name"), Timer && Timer->Name ? FString(Timer->Name) : FString::Printf(TEXT("Timer_%u"), Sorted[Index].Key));
+                Entry->SetNumberField(TEXT("inclusiveMs"), Stats.Inclusive * 1000.0);
+                Entry->SetNumberField(TEXT("exclusiveMs"), Stats.Exclusive * 1000.0);
+                Entry->SetNumberField(TEXT("count"), static_cast<double>(Stats.Count));
+                Entry->SetNumberField(TEXT("avgInclusiveMs"), Stats.Count > 0 ? Stats.Inclusive / Stats.Count * 1000.0 : 0.0);
+                Entry->SetNumberField(TEXT("maxMs"), Stats.Max * 1000.0);
+                Values.Add(MakeShared<FJsonValueObject>(Entry));
+            }
+            return Values;
+        }
+
+        /**
+         * Walk one timing timeline and accumulate per-timer inclusive and
+         * exclusive time. Returns the time covered by top-level scopes.
+         */
+        double AccumulateTimeline(const TraceServices::ITimingProfilerProvider::Timeline& Timeline, double Start, double End,
+                                  const TraceServices::ITimingProfilerTimerReader& TimerReader,
+                                  TMap<uint32, FTimerStats>& OutTimers, const std::atomic<bool>& bCancelled)
+        {
+            TArray<FOpenScope> Stack;
+            double TopLevelTime = 0.0;
+            Timeline.EnumerateEvents(Start, End,
+                [&](bool bIsEnter, double Time, const TraceServices::FTimingProfilerEvent& Event)
+                {
+                    if (bCancelled)
+                    {
+                        return TraceServices::EEventEnumerate::Stop;
+                    }
+                    if (bIsEnter)
+                    {
+                        uint32 TimerIndex = Event.TimerIndex;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+                        // Scopes with metadata carry a per-instance index; fold them into their timer
+                        if (static_cast<int32>(TimerIndex) < 0)
+                        {
+                            TimerIndex = TimerReader.GetOriginalTimerIdFromMetadata(TimerIndex);
+                        }
+#endif
+                        FTimerStats& Stats = OutTimers.FindOrAdd(TimerIndex);
+                        ++Stats.ActiveDepth;
+                        Stack.Add({ TimerIndex, FMath::Max(Time, Start), 0.0 });
+                        return TraceServices::EEventEnumerate::Continue;
+                    }
+                    if (Stack.Num() == 0)
+                    {
+                        return TraceServices::EEventEnumerate::Continue;
+                    }
+
+                    const FOpenScope Scope = Stack.Pop();
+                    const double Duration = FMath::Min(Time, End) - Scope.Start;
+                    FTimerStats& Stats = OutTimers.FindOrAdd(Scope.TimerIndex);
+                    --Stats.ActiveDepth;
+                    if (Stats.ActiveDepth == 0)
+                    {
+                        Stats.Inclusive += Duration;
+                    }
+                    Stats.Exclusive += Duration - Scope.ChildTime;
+                    Stats.Max = FMath::Max(Stats.Max, Duration);
+                    ++Stats.Count;
+                    if (Stack.Num() > 0)
+                    {
+                        Stack.Last().ChildTime += Duration;
+                    }
+                    else
+                    {
+                        TopLevelTime += Duration;
+                    }
+                    return TraceServices::EEventEnumerate::Continue;
+                });
+            return TopLevelTime;
+        }
+
+        void MergeTimers(const TMap<uint32, FTimerStats>& From, TMap<uint32, FTimerStats>& Into)
+        {
+            for (const TPair<uint32, FTimerStats>& Timer : From)
+            {
+                FTimerStats& Merged = Into.FindOrAdd(Timer.Key);
+                Merged.Inclusive += Timer.Value.Inclusive;
+                Merged.Exclusive += Timer.Value.Exclusive;
+                Merged.Max = FMath::Max(Merged.Max, Timer.Value.Max);
+                Merged.Count += Timer.Value.Count;
+            }
+        }
+
+        TSharedPtr<FJsonObject> ExtractFrames(const TraceServices::IAnalysisSession& Session, double Start, double End,
+                                              int32& OutGameFrames)
+        {
+            const TraceServices::IFrameProvider& FrameProvider = TraceServices::ReadFrameProvider(Session);
+            auto Collect = [&](ETraceFrameType FrameType)
+            {
+                TArray<double> Durations;
+                const uint64 Count = FrameProvider.GetFrameCount(FrameType);
+                if (Count > 0)
+                {
+                    FrameProvider.EnumerateFrames(FrameType, 0, Count - 1, [&](const TraceServices::FFrame& Frame)
+                    {
+                        if (Frame.StartTime >= Start && Frame.EndTime <= End && Frame.EndTime > Frame.StartTime)
+                        {
+                            Durations.Add(Frame.EndTime - Frame.StartTime);
+                        }
+                    });
+                }
+                return Durations;
+            };
+
+            TArray<double> GameFrames = Collect(TraceFrameType_Game);
+            OutGameFrames = GameFrames.Num();
+            TSharedPtr<FJsonObject> Frames = MakeShared<FJsonObject>();
+            Frames->SetObjectField(TEXT("game"), DurationStats(MoveTemp(GameFrames)));
+            Frames->SetObjectField(TEXT("rendering"), DurationStats(Collect(TraceFrameType_Rendering)));
+            return Frames;
+        }
+
+        TArray<TSharedPtr<FJsonValue>> ExtractCounters(const TraceServices::IAnalysisSession& Session, double Start,
+                                                       double End, const FAnalyzeOptions& Options, int32& OutTotal)
+        {
+            TArray<TSharedPtr<FJsonObject>> Counters;
+            OutTotal = 0;
+            const TraceServices::ICounterProvider& CounterProvider = TraceServices::ReadCounterProvider(Session);
+            CounterProvider.EnumerateCounters([&](uint32 CounterId, const TraceServices::ICounter& Counter)
+            {
+                const FString Name = Counter.GetName() ? FString(Counter.GetName()) : FString();
+                if (!Options.CounterFilter.IsEmpty() && !Name.Contains(Options.CounterFilter))
+                {
+                    return;
+                }
+                ++OutTotal;
+
+                double Min = TNumericLimits<double>::Max();
+                double Max = TNumericLimits<double>::Lowest();
+                double Sum = 0.0;
+                double Last = 0.0;
+                int64 Samples = 0;
+                auto AddSample = [&](double Value)
+                {
+                    Min = FMath::Min(Min, Value);
+                    Max = FMath::Max(Max, Value);
+                    Sum += Value;
+                    Last = Value;
+                    ++Samples;
+                };
+                if (Counter.IsFloatingPoint())
+                {
+                    Counter.EnumerateFloatValues(Start, End, false, [&](double, double Value) { AddSample(Value); });
+                }
+                else
+                {
+                    Counter.EnumerateValues(Start, End, false, [&](double, int64 Value) { AddSample(static_cast<double>(Value)); });
+                }
+                if (Samples == 0)
+                {
+                    return;
+                }
+
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("name"), Name);
+                Entry->SetNumberField(TEXT("samples"), static_cast<double>(Samples));
+                Entry->SetNumberField(TEXT("min"), Min);
+                Entry->SetNumberField(TEXT("max"), Max);
+                Entry->SetNumberField(TEXT("avg"), Sum / Samples);
+                Entry->SetNumberField(TEXT("last"), Last);
+                Counters.Add(Entry);
+            });
+
+            Counters.Sort([](const TSharedPtr<FJsonObject>& A, const TSharedPtr<FJsonObject>& B)
+            {
+                return A->GetStringField(TEXT("name")) < B->GetStringField(TEXT("name"));
+            });
+            TArray<TSharedPtr<FJsonValue>> Values;
+            for (int32 Index = 0; Index < Counters.Num() && Index < Options.MaxCounters; ++Index)
+            {
+                Values.Add(MakeShared<FJsonValueObject>(Counters[Index]));
+            }
+            return Values;
+        }
+
+        TSharedPtr<FJsonObject> ExtractLoadTime(const TraceServices::IAnalysisSession& Session, double Start, double End)
+        {
+            TSharedPtr<FJsonObject> LoadTime = MakeShared<FJsonObject>();
+            const TraceServices::ILoadTimeProfilerProvider* Provider = TraceServices::ReadLoadTimeProfilerProvider(Session);
+            TraceServices::ITable<TraceServices::FLoadTimeProfilerAggregatedStats>* Table =
+                Provider ? Provider->CreateEventAggregation(Start, End) : nullptr;
+            if (!Table)
+            {
+                LoadTime->SetBoolField(TEXT("available"), false);
+                LoadTime->SetStringField(TEXT("hint"), TEXT("Record with the LoadTime channel (Trace.Start default,loadtime)"));
+                return LoadTime;
+            }
+
+            TArray<TSharedPtr<FJsonObject>> Events;
+            double TotalSeconds = 0.0;
+            TraceServices::ITableReader<TraceServices::FLoadTimeProfilerAggregatedStats>* Reader = Table->CreateReader();
+            while (Reader && Reader->IsValid())
+            {
+                const TraceServices::FLoadTimeProfilerAggregatedStats* Row = Reader->GetCurrentRow();
+                TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+                Entry->SetStringField(TEXT("name"), Row->Name ? FString(Row->Name) : FString());
+                Entry->SetNumberField(TEXT("count"), Row->Count);
+                Entry->SetNumberField(TEXT("totalMs"), Row->Total * 1000.0);
+                Entry->SetNumberField(TEXT("avgMs"), Row->Average * 1000.0);
+                Entry->SetNumberField(TEXT("maxMs"), Row->Max * 1000.0);
+                TotalSeconds += Row->Total;
+                Events.Add(Entry);
+                Reader->NextRow();
+            }
+            delete Reader;
+            delete Table;
+
+            Events.Sort([](const TSharedPtr<FJsonObject>& A, const TSharedPtr<FJsonObject>& B)
+            {
+                return A->GetNumberField(TEXT("totalMs")) > B->GetNumberField(TEXT("totalMs"));
+            });
+            TArray<TSharedPtr<FJsonValue>> Values;
+            for (int32 Index = 0; Index < Events.Num() && Index < MAX_LOAD_TIME_EVENTS; ++Index)
+            {
+                Values.Add(MakeShared<FJsonValueObject>(Events[Index]));
+            }
+            LoadTime->SetBoolField(TEXT("available"), Events.Num() > 0);
+            LoadTime->SetNumberField(TEXT("totalMs"), TotalSeconds * 1000.0);
+            LoadTime->SetArrayField(TEXT("events"), Values);
+            return LoadTime;
+        }
+
+        /** Build the summary. Runs on the thread pool once analysis is complete. */
+        TSharedPtr<FJsonObject> Extract(const FAnalysis& Analysis)
+        {
+            const TraceServices::IAnalysisSession& Session = *Analysis.Session;
+            TraceServices::FAnalysisSessionReadScope ReadScope(Session);
+
+            const double TraceDuration = Session.GetDurationSeconds();
+            const double Start = FMath::Clamp(Analysis.Options.StartSeconds, 0.0, TraceDuration);
+            const double End = Analysis.Options.EndSeconds > Start ? FMath::Min(Analysis.Options.EndSeconds, TraceDuration) : TraceDuration;
+
+            TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+            Result->SetStringField(TEXT("filePath"), Analysis.FilePath);
+            Result->SetNumberField(TEXT("traceDurationSeconds"), TraceDuration);
+            Result->SetNumberField(TEXT("startSeconds"), Start);
+            Result->SetNumberField(TEXT("endSeconds"), End);
+            Result->SetNumberField(TEXT("analysisSeconds"), Analysis.AnalysisSeconds);
+
+            int32 GameFrames = 0;
+            Result->SetObjectField(TEXT("frames"), ExtractFrames(Session, Start, End, GameFrames));
+
+            const TraceServices::ITimingProfilerProvider* TimingProvider = TraceServices::ReadTimingProfilerProvider(Session);
+            if (TimingProvider)
+            {
+                struct FThreadEntry
+                {
+                    FString Name;
+                    FString Group;
+                    uint32 TimelineIndex = 0;
+                };
+                TArray<FThreadEntry> Timelines;
+                const TraceServices::IThreadProvider& ThreadProvider = TraceServices::ReadThreadProvider(Session);
+                ThreadProvider.EnumerateThreads([&](const TraceServices::FThreadInfo& Thread)
+                {
+                    uint32 TimelineIndex = 0;
+                    if (TimingProvider->GetCpuThreadTimelineIndex(Thread.Id, TimelineIndex))
+                    {
+                        Timelines.Add({ Thread.Name ? FString(Thread.Name) : FString::Printf(TEXT("Thread %u"), Thread.Id),
+                                        Thread.GroupName ? FString(Thread.GroupName) : FString(), TimelineIndex });
+                    }
+                });
+                uint32 GpuTimelineIndex = 0;
+                if (TimingProvider->GetGpuTimelineIndex(GpuTimelineIndex))
+                {
+                    Timelines.Add({ TEXT("GPU"), TEXT("GPU"), GpuTimelineIndex });
+                }
+
+                TimingProvider->ReadTimers([&](const TraceServices::ITimingProfilerTimerReader& TimerReader)
+                {
+                    TMap<uint32, FTimerStats> AllCpuTimers;
+                    TArray<TSharedPtr<FJsonObject>> Threads;
+                    for (const FThreadEntry& Entry : Timelines)
+                    {
+                        TMap<uint32, FTimerStats> ThreadTimers;
+                        double BusySeconds = 0.0;
+                        TimingProvider->ReadTimeline(Entry.TimelineIndex,
+                            [&](const TraceServices::ITimingProfilerProvider::Timeline& Timeline)
+                            {
+                                BusySeconds = AccumulateTimeline(Timeline, Start, End, TimerReader, ThreadTimers,
+                                                                 Analysis.bCancelled);
+                            });
+                        if (ThreadTimers.Num() == 0)
+                        {
+                            continue;
+                        }
+                        if (Entry.Group != TEXT("GPU"))
+                        {
+                            MergeTimers(ThreadTimers, AllCpuTimers);
+                        }
+
+                        TSharedPtr<FJsonObject> Thread = MakeShared<FJsonObject>();
+                        Thread->SetStringField(TEXT("name"), Entry.Name);
+                        Thread->SetStringField(TEXT("group"), Entry.Group);
+                        Thread->SetNumberField(TEXT("busyMs"), BusySeconds * 1000.0);
+                        Thread->SetNumberField(TEXT("busyPercent"), End > Start ? BusySeconds / (End - Start) * 100.0 : 0.0);
+                        if (GameFrames > 0)
+                        {
+                            Thread->SetNumberField(TEXT("busyMsPerFrame"), BusySeconds / GameFrames * 1000.0);
+                        }
+                        Thread->SetArrayField(TEXT("topTimers"),
+                            TopTimersJson(ThreadTimers, Analysis.Options.TopTimersPerThread, TimerReader));
+                        Threads.Add(Thread);
+                    }
+
+                    Threads.Sort([](const TSharedPtr<FJsonObject>& A, const TSharedPtr<FJsonObject>& B)
+                    {
+                        return A->GetNumberField(TEXT("busyMs")) > B->GetNumberField(TEXT("busyMs"));
+                    });
+                    TArray<TSharedPtr<FJsonValue>> ThreadValues;
+                    for (const TSharedPtr<FJsonObject>& Thread : Threads)
+                    {
+                        ThreadValues.Add(MakeShared<FJsonValueObject>(Thread));
+                    }
+                    Result->SetArrayField(TEXT("timers"), TopTimersJson(AllCpuTimers, Analysis.Options.TopTimers, TimerReader));
+                    Result->SetArrayField(TEXT("threads"), ThreadValues);
+                });
+            }
+            else
+            {
+                Result->SetArrayField(TEXT("timers"), TArray<TSharedPtr<FJsonValue>>());
+                Result->SetArrayField(TEXT("threads"), TArray<TSharedPtr<FJsonValue>>());
+            }
+
+            int32 CounterTotal = 0;
+            Result->SetArrayField(TEXT("counters"), ExtractCounters(Session, Start, End, Analysis.Options, CounterTotal));
+            Result->SetNumberField(TEXT("counterCount"), CounterTotal);
+            Result->SetObjectField(TEXT("loadTime"), ExtractLoadTime(Session, Start, End));
+            return Result;
+        }
+
+        void Finish(const TSharedPtr<FAnalysis>& Analysis, bool bSuccess, const FString& Message,
+                    const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)
+        {
+            FState& State = GetState();
+            if (State.Active == Analysis)
+            {
+                State.Active.Reset();
+            }
+            if (!Analysis->bCancelled && Analysis->OnComplete)
+            {
+                Analysis->OnComplete(bSuccess, Message, Result, ErrorCode);
+            }
+        }
+
+        bool Tick(float DeltaTime)
+        {
+            FState& State = GetState();
+            TSharedPtr<FAnalysis> Analysis = State.Active;
+            if (!Analysis.IsValid() || Analysis->bExtracting)
+            {
+                State.TickHandle.Reset();
+                return false;
+            }
+
+            const double Now = FPlatformTime::Seconds();
+            if (!Analysis->Session->IsAnalysisComplete())
+            {
+                if (Analysis->OnProgress && Now - Analysis->LastProgress >= PROGRESS_INTERVAL_SECONDS)
+                {
+                    Analysis->LastProgress = Now;
+                    double TraceSeconds = 0.0;
+                    {
+                        TraceServices::FAnalysisSessionReadScope ReadScope(*Analysis->Session);
+                        TraceSeconds = Analysis->Session->GetDurationSeconds();
+                    }
+                    Analysis->OnProgress(-1.0f, FString::Printf(TEXT("Analyzing %s: %.1f s of trace read"),
+                        *FPaths::GetCleanFilename(Analysis->FilePath), TraceSeconds));
+                }
+                return true;
+            }
+
+            Analysis->AnalysisSeconds = Now - Analysis->StartTime;
+            Analysis->bExtracting = true;
+            if (Analysis->OnProgress)
+            {
+                Analysis->OnProgress(-1.0f, TEXT("Analysis complete, summarizing timers and counters"));
+            }
+            Async(EAsyncExecution::ThreadPool, [Analysis]()
+            {
+                TSharedPtr<FJsonObject> Result = Extract(*Analysis);
+                AsyncTask(ENamedThreads::GameThread, [Analysis, Result]()
+                {
+                    Result->SetNumberField(TEXT("totalSeconds"), FPlatformTime::Seconds() - Analysis->StartTime);
+                    const TArray<TSharedPtr<FJsonValue>>* Timers = nullptr;
+                    Result->TryGetArrayField(TEXT("timers"), Timers);
+                    Finish(Analysis, true,
+                        FString::Printf(TEXT("Analyzed %s (%.1f s of trace, %d timers reported)"),
+                            *FPaths::GetCleanFilename(Analysis->FilePath),
+                            Result->GetNumberField(TEXT("traceDurationSeconds")), Timers ? Timers->Num() : 0),
+                        Result, FString());
+                });
+            });
+            State.TickHandle.Reset();
+            return false;
+        }
+    }
+
+    FString GetTraceDir()
+    {
+        return FPaths::ConvertRelativePathToFull(FPaths::ProfilingDir());
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ListTraces(int32 Limit)
+    {
+        TArray<FString> Files;
+        IFileManager::Get().FindFilesRecursive(Files, *GetTraceDir(), TEXT("*.utrace"), true, false);
+
+        TArray<TPair<FDateTime, FString>> Dated;
+        for (const FString& File : Files)
+        {
+            Dated.Emplace(IFileManager::Get().GetTimeStamp(*File), File);
+        }
+        Dated.Sort([](const TPair<FDateTime, FString>& A, const TPair<FDateTime, FString>& B) { return A.Key > B.Key; });
+
+        TArray<TSharedPtr<FJsonValue>> Values;
+        for (int32 Index = 0; Index < Dated.Num() && Index < Limit; ++Index)
+        {
+            TSharedPtr<FJsonObject> Entry = MakeShared<FJsonObject>();
+            Entry->SetStringField(TEXT("name"), FPaths::GetCleanFilename(Dated[Index].Value));
+            Entry->SetStringField(TEXT("path"), Dated[Index].Value);
+            Entry->SetNumberField(TEXT("sizeBytes"), static_cast<double>(IFileManager::Get().FileSize(*Dated[Index].Value)));
+            Entry->SetStringField(TEXT("modified"), Dated[Index].Key.ToIso8601());
+            Values.Add(MakeShared<FJsonValueObject>(Entry));
+        }
+        return Values;
+    }
+
+    FString ResolveTracePath(const FString& Reference, FString& OutError)
+    {
+        if (Reference.IsEmpty() || Reference.Equals(TEXT("latest"), ESearchCase::IgnoreCase))
+        {
+            const TArray<TSharedPtr<FJsonValue>> Latest = ListTraces(1);
+            if (Latest.Num() == 0)
+            {
+                OutError = FString::Printf(TEXT("No .utrace files found under %s"), *GetTraceDir());
+                return FString();
+            }
+            return Latest[0]->AsObject()->GetStringField(TEXT("path"));
+        }
+
+        // Bare file name: look it up among the recorded traces
+        if (!Reference.Contains(TEXT("/")) && !Reference.Contains(TEXT("\\")))
+        {
+            for (const TSharedPtr<FJsonValue>& Entry : ListTraces(TNumericLimits<int32>::Max()))
+            {
+                if (Entry->AsObject()->GetStringField(TEXT("name")).Equals(Reference, ESearchCase::IgnoreCase))
+                {
+                    return Entry->AsObject()->GetStringField(TEXT("path"));
+                }
+            }
+            OutError = FString::Printf(TEXT("Trace not found: %s"), *Reference);
+            return FString();
+        }
+
+        const FString Sanitized = SanitizeProjectFilePath(Reference);
+        if (Sanitized.IsEmpty() || !Sanitized.EndsWith(TEXT(".utrace"), ESearchCase::IgnoreCase))
+        {
+            OutError = FString::Printf(TEXT("Invalid trace path (expected a project-relative .utrace): %s"), *Reference);
+            return FString();
+        }
+        const FString FullPath = FPaths::ConvertRelativePathToFull(FPaths::ProjectDir() / Sanitized);
+        if (!FPaths::FileExists(FullPath))
+        {
+            OutError = FString::Printf(TEXT("Trace not found: %s"), *Reference);
+            return FString();
+        }
+        return FullPath;
+    }
+
+    bool Analyze(const FString& FilePath, const FAnalyzeOptions& Options, FProgressSink OnProgress,
+                 FCompletionSink OnComplete, FString& OutError, FString& OutErrorCode)
+    {
+        check(IsInGameThread());
+        FState& State = GetState();
+        if (State.Active.IsValid())
+        {
+            OutError = FString::Printf(TEXT("Already analyzing %s"), *FPaths::GetCleanFilename(State.Active->FilePath));
+            OutErrorCode = TEXT("ANALYSIS_RUNNING");
+            return false;
+        }
+
+        ITraceServicesModule& TraceServicesModule = FModuleManager::LoadModuleChecked<ITraceServicesModule>(TEXT("TraceServices"));
+        TSharedPtr<TraceServices::IAnalysisService> AnalysisService = TraceServicesModule.GetAnalysisService();
+        TSharedPtr<const TraceServices::IAnalysisSession> Session =
+            AnalysisService.IsValid() ? AnalysisService->StartAnalysis(*FilePath) : nullptr;
+        if (!Session.IsValid())
+        {
+            OutError = FString::Printf(TEXT("Failed to open trace %s"), *FilePath);
+            OutErrorCode = TEXT("ANALYSIS_FAILED");
+            return false;
+        }
+
+        TSharedPtr<FAnalysis> Analysis = MakeShared<FAnalysis>();
+        Analysis->FilePath = FilePath;
+        Analysis->Options = Options;
+        Analysis->OnProgress = MoveTemp(OnProgress);
+        Analysis->OnComplete = MoveTemp(OnComplete);
+        Analysis->Session = Session;
+        Analysis->StartTime = FPlatformTime::Seconds();
+        Analysis->LastProgress = Analysis->StartTime;
+
+        State.Active = Analysis;
+        State.TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&Tick));
+        return true;
+    }
+
+    void CancelAll()
+    {
+        FState& State = GetState();
+        if (State.TickHandle.IsValid())
+        {
+            FTSTicker::GetCoreTicker().RemoveTicker(State.TickHandle);
+            State.TickHandle.Reset();
+        }
+        if (State.Active.IsValid())
+        {
+            State.Active->bCancelled = true;
+            State.Active->Session->Stop(true);
+            State.Active.Reset();
+        }
+    }
+}
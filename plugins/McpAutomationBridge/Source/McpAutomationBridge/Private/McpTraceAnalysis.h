@@ -0,0 +1,74 @@
+// =============================================================================
+// McpTraceAnalysis.h
+// =============================================================================
+// Trace file management and in-process analysis for manage_insights.
+//
+// Recorded .utrace files under Saved/Profiling can be listed and analyzed
+// without opening Unreal Insights. Analysis runs TraceServices' analysis
+// session on its own thread, then extracts a summary on the thread pool:
+//
+//   - timers:   top CPU/GPU timers by inclusive time (with exclusive time,
+//     call count and max), computed from the timing timelines.
+//   - threads:  per-thread busy time, busy ms per game frame and the top
+//     timers on that thread.
+//   - frames:   game and rendering frame time statistics.
+//   - counters: min / max / avg / last per trace counter.
+//   - loadTime: load-time profiler event aggregation, when the trace
+//     recorded the LoadTime channel.
+//
+// One analysis runs at a time. Listing and path resolution are game-thread
+// only; the completion callback runs on the game thread.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+namespace McpTraceAnalysis
+{
+    struct FAnalyzeOptions
+    {
+        /** Analysis window in seconds from trace start; EndSeconds <= 0 means the whole trace. */
+        double StartSeconds = 0.0;
+        double EndSeconds = 0.0;
+        int32 TopTimers = 25;
+        /** Timers listed per thread. */
+        int32 TopTimersPerThread = 5;
+        int32 MaxCounters = 100;
+        /** Case-insensitive substring a counter name must contain (empty = all). */
+        FString CounterFilter;
+    };
+
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+
+    using FCompletionSink = TFunction<void(bool bSuccess, const FString& Message,
+                                           const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)>;
+
+    /** Folder that Trace.Start and snapshots write to. */
+    FString GetTraceDir();
+
+    /** .utrace files in the trace folder, newest first (name, path, sizeBytes, modified). */
+    TArray<TSharedPtr<FJsonValue>> ListTraces(int32 Limit);
+
+    /**
+     * Resolve a trace reference to an absolute path: "latest" (or empty) for
+     * the newest trace, a file name from ListTraces, or a project-relative
+     * path. Returns an empty string with OutError set when nothing matches.
+     */
+    FString ResolveTracePath(const FString& Reference, FString& OutError);
+
+    /**
+     * Start analyzing a trace file. Returns false with OutError /
+     * OutErrorCode set when another analysis is running or the file cannot
+     * be opened; otherwise OnComplete is called once with the summary.
+     */
+    bool Analyze(const FString& FilePath, const FAnalyzeOptions& Options, FProgressSink OnProgress,
+                 FCompletionSink OnComplete, FString& OutError, FString& OutErrorCode);
+
+    /** Stop the running analysis without reporting it (subsystem shutdown). */
+    void CancelAll();
+}
@@ -0,0 +1,394 @@
+// =============================================================================
+// McpViewportCapture.cpp
+// =============================================================================
+// Implementation of asynchronous viewport readback and worker-thread encoding.
+// =============================================================================
+
+#include "McpViewportCapture.h"
+#include "McpVersionCompatibility.h"
+#include "McpImageKernels.h"
+
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "Engine/GameViewportClient.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "RHIGPUReadback.h"
+#include "UnrealClient.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+namespace McpViewportCapture
+{
+    namespace
+    {
+        // Give up on a readback the GPU has not completed within this window
+        // (e.g. the editor window is minimised and nothing is being presented).
+        constexpr double READBACK_TIMEOUT_SECONDS = 5.0;
+
+        enum EReadbackStage : int32
+        {
+            Stage_Copying = 0,
+            Stage_Pending = 1,
+            Stage_Ready = 2,
+            Stage_Failed = 3
+        };
+
+        struct FReadbackState
+        {
+            FOnPixelsReady OnComplete;
+            FIntPoint Size = FIntPoint::ZeroValue;
+            TUniquePtr<FRHIGPUTextureReadback> Readback;
+            bool bSwizzleRB = false;
+            TArray<FColor> Pixels;
+            FString Error;
+            FThreadSafeCounter Stage;
+            FThreadSafeBool bPollInFlight;
+            double StartTime = 0.0;
+        };
+
+        using FReadbackStateRef = TSharedRef<FReadbackState, ESPMode::ThreadSafe>;
+
+        // Render thread: copy the mapped staging texture into tightly packed BGRA pixels.
+        void CopyReadbackToPixels(FRHICommandListImmediate& RHICmdList, FReadbackState& State)
+        {
+            int32 RowPitchInPixels = 0;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+            const uint8* Data = static_cast<const uint8*>(State.Readback->Lock(RowPitchInPixels));
+#else
+            void* RawData = nullptr;
+            State.Readback->LockTexture(RHICmdList, RawData, RowPitchInPixels);
+            const uint8* Data = static_cast<const uint8*>(RawData);
+#endif
+            if (!Data || RowPitchInPixels < State.Size.X)
+            {
+                State.Error = TEXT("Failed to map viewport readback");
+                if (Data)
+                {
+                    State.Readback->Unlock();
+                }
+                return;
+            }
+
+            const int32 Width = State.Size.X;
+            const int32 Height = State.Size.Y;
+            State.Pixels.SetNumUninitialized(Width * Height);
+            for (int32 Y = 0; Y < Height; ++Y)
+            {
+                const uint8* SrcRow = Data + static_cast<int64>(Y) * RowPitchInPixels * 4;
+                FColor* DstRow = State.Pixels.GetData() + static_cast<int64>(Y) * Width;
+                FMemory::Memcpy(DstRow, SrcRow, Width * sizeof(FColor));
+                for (int32 X = 0; X < Width; ++X)
+                {
+                    if (State.bSwizzleRB)
+                    {
+                        Swap(DstRow[X].R, DstRow[X].B);
+                    }
+                    // Back buffers usually carry no meaningful alpha
+                    DstRow[X].A = 255;
+                }
+            }
+            State.Readback->Unlock();
+        }
+    }
+
+    FViewport* FindCaptureViewport()
+    {
+        if (GEngine && GEngine->GameViewport && GEngine->GameViewport->Viewport)
+        {
+            return GEngine->GameViewport->Viewport;
+        }
+#if WITH_EDITOR
+        if (GEditor)
+        {
+            return GEditor->GetActiveViewport();
+        }
+#endif
+        return nullptr;
+    }
+
+    bool ParseEncodeOptions(const TSharedPtr<FJsonObject>& Payload, FEncodeOptions& OutOptions, FString& OutError)
+    {
+        if (!Payload.IsValid())
+        {
+            return true;
+        }
+
+        FString Format;
+        if (Payload->TryGetStringField(TEXT("format"), Format) && !Format.IsEmpty())
+        {
+            Format = Format.ToLower();
+            if (Format == TEXT("jpg"))
+            {
+                Format = TEXT("jpeg");
+            }
+            if (Format != TEXT("png") && Format != TEXT("jpeg"))
+            {
+                OutError = FString::Printf(TEXT("Unsupported format '%s' (expected png or jpeg)"), *Format);
+                return false;
+            }
+            OutOptions.Format = Format;
+        }
+
+        double Number = 0.0;
+        if (Payload->TryGetNumberField(TEXT("quality"), Number))
+        {
+            OutOptions.Quality = FMath::Clamp(static_cast<int32>(Number), 1, 100);
+        }
+        if (Payload->TryGetNumberField(TEXT("maxWidth"), Number))
+        {
+            OutOptions.MaxWidth = FMath::Max(0, static_cast<int32>(Number));
+        }
+        if (Payload->TryGetNumberField(TEXT("maxHeight"), Number))
+        {
+            OutOptions.MaxHeight = FMath::Max(0, static_cast<int32>(Number));
+        }
+        if (Payload->TryGetNumberField(TEXT("scale"), Number))
+        {
+            if (Number <= 0.0 || Number > 1.0)
+            {
+                OutError = TEXT("scale must be in the range (0, 1]");
+                return false;
+            }
+            OutOptions.Scale = static_cast<float>(Number);
+        }
+
+        const TSharedPtr<FJsonObject>* CropObj = nullptr;
+        if (Payload->TryGetObjectField(TEXT("crop"), CropObj) && CropObj && CropObj->IsValid())
+        {
+            double X = 0.0, Y = 0.0, W = 0.0, H = 0.0;
+            (*CropObj)->TryGetNumberField(TEXT("x"), X);
+            (*CropObj)->TryGetNumberField(TEXT("y"), Y);
+            (*CropObj)->TryGetNumberField(TEXT("width"), W);
+            (*CropObj)->TryGetNumberField(TEXT("height"), H);
+            if (W <= 0.0 || H <= 0.0 || X < 0.0 || Y < 0.0)
+            {
+                OutError = TEXT("crop requires non-negative x/y and positive width/height");
+                return false;
+            }
+            OutOptions.Crop = FIntRect(static_cast<int32>(X), static_cast<int32>(Y),
+                                       static_cast<int32>(X + W), static_cast<int32>(Y + H));
+        }
+        return true;
+    }
+
+    void PreloadEncoder()
+    {
+        check(IsInGameThread());
+        FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+    }
+
+    void ReadViewportAsync(FViewport* Viewport, FOnPixelsReady OnComplete)
+    {
+        check(IsInGameThread());
+
+        if (!Viewport)
+        {
+            OnComplete(false, TArray<FColor>(), 0, 0, TEXT("No viewport available"));
+            return;
+        }
+        const FIntPoint Size = Viewport->GetSizeXY();
+        if (Size.X <= 0 || Size.Y <= 0)
+        {
+            OnComplete(false, TArray<FColor>(), 0, 0, TEXT("Viewport has zero size"));
+            return;
+        }
+
+        FReadbackStateRef State = MakeShared<FReadbackState, ESPMode::ThreadSafe>();
+        State->OnComplete = MoveTemp(OnComplete);
+        State->Size = Size;
+        State->StartTime = FPlatformTime::Seconds();
+
+        ENQUEUE_RENDER_COMMAND(McpViewportCaptureCopy)(
+            [State, Viewport](FRHICommandListImmediate& RHICmdList)
+            {
+                FRHITexture* Texture = Viewport->GetRenderTargetTexture().GetReference();
+                if (!Texture)
+                {
+                    State->Error = TEXT("Viewport has no render target");
+                    State->Stage.Set(Stage_Failed);
+                    return;
+                }
+
+                const EPixelFormat Format = Texture->GetFormat();
+                if (Format == PF_B8G8R8A8 || Format == PF_R8G8B8A8)
+                {
+                    State->bSwizzleRB = (Format == PF_R8G8B8A8);
+                    State->Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("McpViewportCapture"));
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+                    State->Readback->EnqueueCopy(RHICmdList, Texture, FIntVector::ZeroValue, 0,
+                                                 FIntVector(State->Size.X, State->Size.Y, 1));
+#else
+                    State->Readback->EnqueueCopy(RHICmdList, Texture,
+                                                 FResolveRect(0, 0, State->Size.X, State->Size.Y));
+#endif
+                    State->Stage.Set(Stage_Pending);
+                }
+                else
+                {
+                    // HDR / 10-bit back buffer: convert on the render thread instead
+                    RHICmdList.ReadSurfaceData(Texture, FIntRect(FIntPoint::ZeroValue, State->Size), State->Pixels,
+                                               FReadSurfaceDataFlags(RCM_UNorm, CubeFace_MAX));
+                    for (FColor& Pixel : State->Pixels)
+                    {
+                        Pixel.A = 255;
+                    }
+                    if (State->Pixels.Num() == State->Size.X * State->Size.Y)
+                    {
+                        State->Stage.Set(Stage_Ready);
+                    }
+                    else
+                    {
+                        State->Error = TEXT("Failed to read viewport pixels");
+                        State->Stage.Set(Stage_Failed);
+                    }
+                }
+            });
+
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+            [State](float) -> bool
+            {
+                const int32 Stage = State->Stage.GetValue();
+                if (Stage == Stage_Ready || Stage == Stage_Failed)
+                {
+                    State->OnComplete(Stage == Stage_Ready, MoveTemp(State->Pixels), State->Size.X, State->Size.Y, State->Error);
+                    return false;
+                }
+
+                if (FPlatformTime::Seconds() - State->StartTime > READBACK_TIMEOUT_SECONDS)
+                {
+                    State->OnComplete(false, TArray<FColor>(), State->Size.X, State->Size.Y,
+                                      TEXT("Timed out waiting for viewport readback (is the editor window visible?)"));
+                    return false;
+                }
+
+                // Poll the GPU fence on the render thread; at most one poll in flight
+                if (Stage == Stage_Pending && !State->bPollInFlight)
+                {
+                    State->bPollInFlight = true;
+                    ENQUEUE_RENDER_COMMAND(McpViewportCapturePoll)(
+                        [State](FRHICommandListImmediate& RHICmdList)
+                        {
+                            if (State->Readback.IsValid() && State->Readback->IsReady())
+                            {
+                                CopyReadbackToPixels(RHICmdList, *State);
+                                State->Readback.Reset();
+                                State->Stage.Set(State->Pixels.Num() > 0 ? Stage_Ready : Stage_Failed);
+                            }
+                            State->bPollInFlight = false;
+                        });
+                }
+                return true;
+            }));
+    }
+
+    bool EncodeImage(TArray<FColor>&& Pixels, int32 Width, int32 Height, const FEncodeOptions& Options,
+                     FEncodedImage& OutImage, FString& OutError)
+    {
+        if (Width <= 0 || Height <= 0 || Pixels.Num() < Width * Height)
+        {
+            OutError = TEXT("No pixel data to encode");
+            return false;
+        }
+
+        const double ResizeStart = FPlatformTime::Seconds();
+
+        // Crop
+        FIntRect Rect(0, 0, Width, Height);
+        TArray<FColor> Working;
+        if (Options.Crop.Area() > 0)
+        {
+            Rect = Options.Crop;
+            Rect.Clip(FIntRect(0, 0, Width, Height));
+            if (Rect.Width() <= 0 || Rect.Height() <= 0)
+            {
+                OutError = FString::Printf(TEXT("crop rectangle lies outside the %dx%d frame"), Width, Height);
+                return false;
+            }
+        }
+        int32 W = Rect.Width();
+        int32 H = Rect.Height();
+        if (W != Width || H != Height)
+        {
+            Working.SetNumUninitialized(W * H);
+            for (int32 Y = 0; Y < H; ++Y)
+            {
+                FMemory::Memcpy(Working.GetData() + static_cast<int64>(Y) * W,
+                                Pixels.GetData() + static_cast<int64>(Rect.Min.Y + Y) * Width + Rect.Min.X,
+                                W * sizeof(FColor));
+            }
+        }
+        else
+        {
+            Working = MoveTemp(Pixels);
+        }
+
+        // Downscale, keeping aspect ratio
+        int32 OutW = FMath::Max(1, FMath::RoundToInt(W * FMath::Clamp(Options.Scale, 0.01f, 1.0f)));
+        int32 OutH = FMath::Max(1, FMath::RoundToInt(H * FMath::Clamp(Options.Scale, 0.01f, 1.0f)));
+        if (Options.MaxWidth > 0 && OutW > Options.MaxWidth)
+        {
+            OutH = FMath::Max(1, FMath::RoundToInt(OutH * static_cast<float>(Options.MaxWidth) / OutW));
+            OutW = Options.MaxWidth;
+        }
+        if (Options.MaxHeight > 0 && OutH > Options.MaxHeight)
+        {
+            OutW = FMath::Max(1, FMath::RoundToInt(OutW * static_cast<float>(Options.MaxHeight) / OutH));
+            OutH = Options.MaxHeight;
+        }
+        if (OutW != W || OutH != H)
+        {
+            // Pre-filter large reductions so bilinear sampling does not alias
+            const int32 Factor = FMath::Min(W / OutW, H / OutH);
+            if (Factor >= 2)
+            {
+                McpImageKernels::BoxBlur(reinterpret_cast<uint8*>(Working.GetData()), W, H, Factor / 2);
+            }
+            TArray<FColor> Resized;
+            Resized.SetNumUninitialized(OutW * OutH);
+            McpImageKernels::ResizeBilinear(reinterpret_cast<const uint8*>(Working.GetData()), W, H,
+                                            reinterpret_cast<uint8*>(Resized.GetData()), OutW, OutH);
+            Working = MoveTemp(Resized);
+        }
+
+        const double CompressStart = FPlatformTime::Seconds();
+        OutImage.ResizeSeconds = CompressStart - ResizeStart;
+
+        // Compress
+        IImageWrapperModule* ImageWrapperModule = FModuleManager::GetModulePtr<IImageWrapperModule>(FName("ImageWrapper"));
+        if (!ImageWrapperModule)
+        {
+            OutError = TEXT("Image encoder module is not loaded");
+            return false;
+        }
+        const bool bJpeg = (Options.Format == TEXT("jpeg"));
+        TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule->CreateImageWrapper(bJpeg ? EImageFormat::JPEG : EImageFormat::PNG);
+        if (!ImageWrapper.IsValid() ||
+            !ImageWrapper->SetRaw(Working.GetData(), Working.Num() * sizeof(FColor), OutW, OutH, ERGBFormat::BGRA, 8))
+        {
+            OutError = TEXT("Failed to initialise image encoder");
+            return false;
+        }
+        const TArray64<uint8> Compressed = ImageWrapper->GetCompressed(bJpeg ? Options.Quality : 0);
+        if (Compressed.Num() == 0)
+        {
+            OutError = TEXT("Image compression produced no data");
+            return false;
+        }
+
+        OutImage.Bytes = TArray<uint8>(Compressed.GetData(), static_cast<int32>(Compressed.Num()));
+        OutImage.Width = OutW;
+        OutImage.Height = OutH;
+        OutImage.MimeType = bJpeg ? TEXT("image/jpeg") : TEXT("image/png");
+        OutImage.Extension = bJpeg ? TEXT("jpg") : TEXT("png");
+        OutImage.CompressSeconds = FPlatformTime::Seconds() - CompressStart;
+        return true;
+    }
+}
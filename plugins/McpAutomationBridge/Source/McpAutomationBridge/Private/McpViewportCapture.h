@@ -0,0 +1,80 @@
+// =============================================================================
+// McpViewportCapture.h
+// =============================================================================
+// Non-blocking viewport capture and off-thread image encoding.
+//
+// Capture copies the viewport back buffer into a staging texture on the render
+// thread and polls the GPU fence from a ticker, so the game thread never waits
+// on FlushRenderingCommands the way FViewport::ReadPixels does. Back buffers
+// that are not 8-bit (HDR / 10-bit) fall back to a render-thread
+// ReadSurfaceData, which still keeps the stall off the game thread.
+//
+// Encoding (crop, downscale, PNG/JPEG compression) is plain CPU work and is
+// safe to run on any thread.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class FViewport;
+
+namespace McpViewportCapture
+{
+    /** Crop / scale / format settings shared by screenshots and viewport streams. */
+    struct FEncodeOptions
+    {
+        /** "png" or "jpeg". */
+        FString Format = TEXT("png");
+
+        /** JPEG quality 1-100 (ignored for PNG). */
+        int32 Quality = 85;
+
+        /** Optional crop rectangle in source pixels; empty means full frame. */
+        FIntRect Crop;
+
+        /** Longest allowed output edges (0 = unlimited). Aspect ratio is kept. */
+        int32 MaxWidth = 0;
+        int32 MaxHeight = 0;
+
+        /** Uniform scale factor in (0, 1]; applied before the max size clamp. */
+        float Scale = 1.0f;
+    };
+
+    struct FEncodedImage
+    {
+        TArray<uint8> Bytes;
+        int32 Width = 0;
+        int32 Height = 0;
+        FString MimeType;
+        FString Extension;
+        double ResizeSeconds = 0.0;
+        double CompressSeconds = 0.0;
+    };
+
+    /** Called on the game thread once pixels are on the CPU (or capture failed). */
+    using FOnPixelsReady = TFunction<void(bool bSuccess, TArray<FColor>&& Pixels, int32 Width, int32 Height, const FString& Error)>;
+
+    /** PIE game viewport when playing, otherwise the active editor viewport. */
+    FViewport* FindCaptureViewport();
+
+    /**
+     * Read crop/scale/format fields from a request payload:
+     * format, quality, crop {x, y, width, height}, maxWidth, maxHeight, scale.
+     */
+    bool ParseEncodeOptions(const TSharedPtr<FJsonObject>& Payload, FEncodeOptions& OutOptions, FString& OutError);
+
+    /** Load the image wrapper module. Must be called on the game thread before encoding off-thread. */
+    void PreloadEncoder();
+
+    /** Start an asynchronous back-buffer read. Game thread only. */
+    void ReadViewportAsync(FViewport* Viewport, FOnPixelsReady OnComplete);
+
+    /** Crop, downscale and compress BGRA pixels. Safe on worker threads. */
+    bool EncodeImage(TArray<FColor>&& Pixels, int32 Width, int32 Height, const FEncodeOptions& Options,
+                     FEncodedImage& OutImage, FString& OutError);
+}
@@ -0,0 +1,432 @@
+// =============================================================================
+// McpViewportStream.cpp
+// =============================================================================
+// Implementation of rate-limited viewport streaming with frame dropping.
+// =============================================================================
+
+#include "McpViewportStream.h"
+#include "McpVersionCompatibility.h"
+
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/DateTime.h"
+#include "Misc/Guid.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+#include <atomic>
+
+namespace McpViewportStream
+{
+    namespace
+    {
+        // Frame time is sampled without capturing for this long after start
+        constexpr double BASELINE_SECONDS = 0.5;
+        constexpr int32 MAX_ACTIVE_STREAMS = 4;
+
+        class FStream : public TSharedFromThis<FStream, ESPMode::ThreadSafe>
+        {
+        public:
+            FStream(const FString& InId, const FStreamSettings& InSettings, FFrameSink InSink)
+                : Id(InId)
+                , Settings(InSettings)
+                , Sink(MoveTemp(InSink))
+            {
+            }
+
+            void Begin()
+            {
+                StartTime = FPlatformTime::Seconds();
+                TWeakPtr<FStream, ESPMode::ThreadSafe> WeakSelf = AsShared();
+                TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+                    [WeakSelf](float DeltaTime) -> bool
+                    {
+                        TSharedPtr<FStream, ESPMode::ThreadSafe> Self = WeakSelf.Pin();
+                        return Self.IsValid() && Self->Tick(DeltaTime);
+                    }));
+            }
+
+            void Finish(const FString& Reason)
+            {
+                bool bExpected = false;
+                if (bStopped.compare_exchange_strong(bExpected, true))
+                {
+                    FScopeLock Lock(&StatsMutex);
+                    StopReason = Reason;
+                    EndTime = FPlatformTime::Seconds();
+                }
+            }
+
+            void RemoveTicker()
+            {
+                if (TickHandle.IsValid())
+                {
+                    FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+                    TickHandle.Reset();
+                }
+            }
+
+            bool IsActive() const { return !bStopped.load(); }
+
+            TSharedPtr<FJsonObject> BuildStats() const
+            {
+                FScopeLock Lock(&StatsMutex);
+                const double Now = FPlatformTime::Seconds();
+                const double StreamingFrom = StreamStartTime > 0.0 ? StreamStartTime : Now;
+                const double StreamingSeconds = FMath::Max(0.0, (EndTime > 0.0 ? EndTime : Now) - StreamingFrom);
+
+                TSharedPtr<FJsonObject> Stats = MakeShared<FJsonObject>();
+                Stats->SetStringField(TEXT("streamId"), Id);
+                Stats->SetBoolField(TEXT("active"), !bStopped.load());
+                if (!StopReason.IsEmpty())
+                {
+                    Stats->SetStringField(TEXT("stopReason"), StopReason);
+                }
+                Stats->SetStringField(TEXT("transport"), Settings.Transport);
+                Stats->SetStringField(TEXT("format"), Settings.Encode.Format);
+                Stats->SetNumberField(TEXT("targetFps"), Settings.TargetFps);
+                Stats->SetNumberField(TEXT("streamingSeconds"), StreamingSeconds);
+                Stats->SetNumberField(TEXT("framesSent"), static_cast<double>(FramesSent));
+                Stats->SetNumberField(TEXT("framesDropped"), static_cast<double>(FramesDropped));
+                Stats->SetNumberField(TEXT("framesFailed"), static_cast<double>(FramesFailed));
+                Stats->SetNumberField(TEXT("sustainedFps"), StreamingSeconds > 0.0 ? FramesSent / StreamingSeconds : 0.0);
+                Stats->SetNumberField(TEXT("bytesSent"), static_cast<double>(BytesSent));
+                Stats->SetNumberField(TEXT("avgFrameBytes"), FramesSent > 0 ? static_cast<double>(BytesSent) / FramesSent : 0.0);
+                Stats->SetNumberField(TEXT("width"), LastWidth);
+                Stats->SetNumberField(TEXT("height"), LastHeight);
+
+                const double Sent = FMath::Max<double>(1.0, static_cast<double>(FramesSent));
+                TSharedPtr<FJsonObject> Timings = MakeShared<FJsonObject>();
+                Timings->SetNumberField(TEXT("avgReadbackMs"), TotalReadbackSeconds * 1000.0 / Sent);
+                Timings->SetNumberField(TEXT("avgEncodeMs"), TotalEncodeSeconds * 1000.0 / Sent);
+                Timings->SetNumberField(TEXT("avgSendMs"), TotalSendSeconds * 1000.0 / Sent);
+                Timings->SetNumberField(TEXT("gameThreadMsPerCapture"),
+                    CaptureCount > 0 ? GameThreadSeconds * 1000.0 / CaptureCount : 0.0);
+                Stats->SetObjectField(TEXT("timings"), Timings);
+
+                // Editor frame time before vs. during streaming
+                const double BaselineMs = BaselineTicks > 0 ? BaselineDeltaSum * 1000.0 / BaselineTicks : 0.0;
+                const double StreamingMs = StreamingTicks > 0 ? StreamingDeltaSum * 1000.0 / StreamingTicks : 0.0;
+                TSharedPtr<FJsonObject> FrameTime = MakeShared<FJsonObject>();
+                FrameTime->SetNumberField(TEXT("baselineMs"), BaselineMs);
+                FrameTime->SetNumberField(TEXT("streamingMs"), StreamingMs);
+                FrameTime->SetNumberField(TEXT("overheadMs"), (BaselineTicks > 0 && StreamingTicks > 0) ? StreamingMs - BaselineMs : 0.0);
+                Stats->SetObjectField(TEXT("editorFrameTime"), FrameTime);
+                return Stats;
+            }
+
+        private:
+            bool Tick(float DeltaTime)
+            {
+                if (bStopped.load())
+                {
+                    TickHandle.Reset();
+                    return false;
+                }
+
+                const double Now = FPlatformTime::Seconds();
+                if (Now - StartTime < BASELINE_SECONDS)
+                {
+                    FScopeLock Lock(&StatsMutex);
+                    BaselineDeltaSum += DeltaTime;
+                    ++BaselineTicks;
+                    return true;
+                }
+
+                double StreamStart = 0.0;
+                int64 SentSoFar = 0;
+                {
+                    FScopeLock Lock(&StatsMutex);
+                    if (StreamStartTime <= 0.0)
+                    {
+                        StreamStartTime = Now;
+                        NextCaptureTime = Now;
+                    }
+                    else
+                    {
+                        StreamingDeltaSum += DeltaTime;
+                        ++StreamingTicks;
+                    }
+                    StreamStart = StreamStartTime;
+                    SentSoFar = FramesSent;
+                }
+
+                if (Settings.DurationSeconds > 0.0 && Now - StreamStart >= Settings.DurationSeconds)
+                {
+                    Finish(TEXT("duration"));
+                    TickHandle.Reset();
+                    return false;
+                }
+                if (Settings.MaxFrames > 0 && SentSoFar >= Settings.MaxFrames)
+                {
+                    Finish(TEXT("max_frames"));
+                    TickHandle.Reset();
+                    return false;
+                }
+                if (Now < NextCaptureTime)
+                {
+                    return true;
+                }
+
+                // Schedule from the ideal time, but never burst to catch up after a hitch
+                const double Interval = 1.0 / Settings.TargetFps;
+                NextCaptureTime += Interval;
+                if (NextCaptureTime < Now)
+                {
+                    NextCaptureTime = Now + Interval;
+                }
+
+                // Backpressure: previous frame still reading back, encoding or sending
+                if (bFrameInFlight.load())
+                {
+                    FScopeLock Lock(&StatsMutex);
+                    ++FramesDropped;
+                    return true;
+                }
+
+                FViewport* Viewport = McpViewportCapture::FindCaptureViewport();
+                if (!Viewport)
+                {
+                    FScopeLock Lock(&StatsMutex);
+                    ++FramesFailed;
+                    return true;
+                }
+
+                bFrameInFlight.store(true);
+                TSharedRef<FStream, ESPMode::ThreadSafe> Self = AsShared();
+                const double CaptureStart = Now;
+                McpViewportCapture::ReadViewportAsync(Viewport,
+                    [Self, CaptureStart](bool bReadOk, TArray<FColor>&& Pixels, int32 Width, int32 Height, const FString&)
+                    {
+                        const double CallbackStart = FPlatformTime::Seconds();
+                        if (!bReadOk || Self->bStopped.load())
+                        {
+                            if (!bReadOk)
+                            {
+                                FScopeLock Lock(&Self->StatsMutex);
+                                ++Self->FramesFailed;
+                            }
+                            Self->bFrameInFlight.store(false);
+                            return;
+                        }
+
+                        const double ReadbackSeconds = CallbackStart - CaptureStart;
+                        Async(EAsyncExecution::ThreadPool,
+                            [Self, ReadbackSeconds, Width, Height, Pixels = MoveTemp(Pixels)]() mutable
+                            {
+                                Self->EncodeAndSend(MoveTemp(Pixels), Width, Height, ReadbackSeconds);
+                            });
+
+                        FScopeLock Lock(&Self->StatsMutex);
+                        Self->GameThreadSeconds += FPlatformTime::Seconds() - CallbackStart;
+                    });
+
+                FScopeLock Lock(&StatsMutex);
+                GameThreadSeconds += FPlatformTime::Seconds() - Now;
+                ++CaptureCount;
+                return true;
+            }
+
+            // Worker thread
+            void EncodeAndSend(TArray<FColor>&& Pixels, int32 Width, int32 Height, double ReadbackSeconds)
+            {
+                ON_SCOPE_EXIT { bFrameInFlight.store(false); };
+
+                McpViewportCapture::FEncodedImage Image;
+                FString EncodeError;
+                if (!McpViewportCapture::EncodeImage(MoveTemp(Pixels), Width, Height, Settings.Encode, Image, EncodeError))
+                {
+                    FScopeLock Lock(&StatsMutex);
+                    ++FramesFailed;
+                    return;
+                }
+                if (bStopped.load())
+                {
+                    return;
+                }
+
+                int64 Sequence = 0;
+                int64 DroppedSoFar = 0;
+                {
+                    FScopeLock Lock(&StatsMutex);
+                    Sequence = NextSequence++;
+                    DroppedSoFar = FramesDropped;
+                }
+
+                const double EncodeSeconds = Image.ResizeSeconds + Image.CompressSeconds;
+                TSharedRef<FJsonObject> Header = MakeShared<FJsonObject>();
+                Header->SetStringField(TEXT("event"), TEXT("viewport_frame"));
+                Header->SetStringField(TEXT("streamId"), Id);
+                Header->SetNumberField(TEXT("sequence"), static_cast<double>(Sequence));
+                const FDateTime NowUtc = FDateTime::UtcNow();
+                Header->SetNumberField(TEXT("timestamp"),
+                    static_cast<double>(NowUtc.ToUnixTimestamp()) * 1000.0 + NowUtc.GetMillisecond());
+                Header->SetNumberField(TEXT("width"), Image.Width);
+                Header->SetNumberField(TEXT("height"), Image.Height);
+                Header->SetStringField(TEXT("mimeType"), Image.MimeType);
+                Header->SetNumberField(TEXT("readbackMs"), ReadbackSeconds * 1000.0);
+                Header->SetNumberField(TEXT("encodeMs"), EncodeSeconds * 1000.0);
+                Header->SetNumberField(TEXT("dropped"), static_cast<double>(DroppedSoFar));
+
+                const double SendStart = FPlatformTime::Seconds();
+                const bool bSent = Sink(Header, Image.Bytes);
+                const double SendSeconds = FPlatformTime::Seconds() - SendStart;
+
+                if (!bSent)
+                {
+                    Finish(TEXT("client_disconnected"));
+                    return;
+                }
+
+                FScopeLock Lock(&StatsMutex);
+                ++FramesSent;
+                BytesSent += Image.Bytes.Num();
+                LastWidth = Image.Width;
+                LastHeight = Image.Height;
+                TotalReadbackSeconds += ReadbackSeconds;
+                TotalEncodeSeconds += EncodeSeconds;
+                TotalSendSeconds += SendSeconds;
+            }
+
+            const FString Id;
+            const FStreamSettings Settings;
+            const FFrameSink Sink;
+            FTSTicker::FDelegateHandle TickHandle;
+
+            std::atomic<bool> bStopped{false};
+            std::atomic<bool> bFrameInFlight{false};
+
+            // Game-thread schedule
+            double StartTime = 0.0;
+            double NextCaptureTime = 0.0;
+
+            // Stats (written from the game thread and workers)
+            mutable FCriticalSection StatsMutex;
+            FString StopReason;
+            double StreamStartTime = 0.0;
+            double EndTime = 0.0;
+            int64 NextSequence = 0;
+            int64 CaptureCount = 0;
+            int64 FramesSent = 0;
+            int64 FramesDropped = 0;
+            int64 FramesFailed = 0;
+            int64 BytesSent = 0;
+            int32 LastWidth = 0;
+            int32 LastHeight = 0;
+            double TotalReadbackSeconds = 0.0;
+            double TotalEncodeSeconds = 0.0;
+            double TotalSendSeconds = 0.0;
+            double GameThreadSeconds = 0.0;
+            double BaselineDeltaSum = 0.0;
+            int32 BaselineTicks = 0;
+            double StreamingDeltaSum = 0.0;
+            int32 StreamingTicks = 0;
+        };
+
+        using FStreamPtr = TSharedPtr<FStream, ESPMode::ThreadSafe>;
+
+        // Game thread only
+        TMap<FString, FStreamPtr>& GetStreams()
+        {
+            static TMap<FString, FStreamPtr> Streams;
+            return Streams;
+        }
+    }
+
+    FString Start(const FStreamSettings& Settings, FFrameSink Sink, FString& OutError)
+    {
+        check(IsInGameThread());
+
+        TMap<FString, FStreamPtr>& Streams = GetStreams();
+
+        // Forget streams that ended on their own before this one starts
+        int32 ActiveCount = 0;
+        for (auto It = Streams.CreateIterator(); It; ++It)
+        {
+            if (!It->Value->IsActive())
+            {
+                It->Value->RemoveTicker();
+                It.RemoveCurrent();
+            }
+            else
+            {
+                ++ActiveCount;
+            }
+        }
+        if (ActiveCount >= MAX_ACTIVE_STREAMS)
+        {
+            OutError = FString::Printf(TEXT("Too many active viewport streams (max %d)"), MAX_ACTIVE_STREAMS);
+            return FString();
+        }
+
+        FStreamSettings Clamped = Settings;
+        Clamped.TargetFps = FMath::Clamp(Clamped.TargetFps, 1.0f, 60.0f);
+
+        McpViewportCapture::PreloadEncoder();
+
+        const FString StreamId = FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(12).ToLower();
+        FStreamPtr Stream = MakeShared<FStream, ESPMode::ThreadSafe>(StreamId, Clamped, MoveTemp(Sink));
+        Streams.Add(StreamId, Stream);
+        Stream->Begin();
+        return StreamId;
+    }
+
+    TSharedPtr<FJsonObject> Stop(const FString& StreamId)
+    {
+        check(IsInGameThread());
+
+        FStreamPtr Stream;
+        if (!GetStreams().RemoveAndCopyValue(StreamId, Stream) || !Stream.IsValid())
+        {
+            return nullptr;
+        }
+        Stream->Finish(TEXT("unsubscribed"));
+        Stream->RemoveTicker();
+        return Stream->BuildStats();
+    }
+
+    TSharedPtr<FJsonObject> GetStats(const FString& StreamId)
+    {
+        check(IsInGameThread());
+
+        const FStreamPtr* Stream = GetStreams().Find(StreamId);
+        return (Stream && Stream->IsValid()) ? (*Stream)->BuildStats() : nullptr;
+    }
+
+    TArray<TSharedPtr<FJsonValue>> ListStreams()
+    {
+        check(IsInGameThread());
+
+        TArray<TSharedPtr<FJsonValue>> Out;
+        for (const auto& Pair : GetStreams())
+        {
+            Out.Add(MakeShared<FJsonValueObject>(Pair.Value->BuildStats()));
+        }
+        return Out;
+    }
+
+    void StopAll()
+    {
+        for (auto& Pair : GetStreams())
+        {
+            Pair.Value->Finish(TEXT("shutdown"));
+            Pair.Value->RemoveTicker();
+        }
+        GetStreams().Empty();
+    }
+
+    void BuildBinaryFrame(const FString& HeaderJson, const TArray<uint8>& ImageBytes, TArray<uint8>& OutMessage)
+    {
+        FTCHARToUTF8 HeaderUtf8(*HeaderJson);
+        const uint32 HeaderLength = static_cast<uint32>(HeaderUtf8.Length());
+
+        OutMessage.Reset(8 + HeaderLength + ImageBytes.Num());
+        OutMessage.Append(reinterpret_cast<const uint8*>("MCPV"), 4);
+        for (int32 Shift = 0; Shift < 32; Shift += 8)
+        {
+            OutMessage.Add(static_cast<uint8>((HeaderLength >> Shift) & 0xFF));
+        }
+        OutMessage.Append(reinterpret_cast<const uint8*>(HeaderUtf8.Get()), HeaderLength);
+        OutMessage.Append(ImageBytes);
+    }
+}
@@ -0,0 +1,73 @@
+// =============================================================================
+// McpViewportStream.h
+// =============================================================================
+// Continuous viewport frame streaming built on McpViewportCapture.
+//
+// A stream captures the PIE or active editor viewport at a target FPS, encodes
+// each frame on the thread pool and hands it to a caller-supplied sink (binary
+// WebSocket frame or native-transport SSE notification). At most one frame per
+// stream is in flight: if the previous frame is still being read back, encoded
+// or sent when the next capture is due, that capture is dropped. A slow client
+// therefore lowers the delivered FPS instead of queuing frames.
+//
+// The first half second of every stream samples editor frame time without
+// capturing, so stats can report the frame-time overhead of streaming.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+#include "Dom/JsonValue.h"
+#include "McpViewportCapture.h"
+
+namespace McpViewportStream
+{
+    struct FStreamSettings
+    {
+        McpViewportCapture::FEncodeOptions Encode;
+
+        /** Capture rate in frames per second (clamped to 1-60). */
+        float TargetFps = 10.0f;
+
+        /** Stop automatically after this many seconds (0 = until unsubscribed). */
+        double DurationSeconds = 0.0;
+
+        /** Stop automatically after this many delivered frames (0 = unlimited). */
+        int32 MaxFrames = 0;
+
+        /** "websocket" or "sse"; reported in stats only. */
+        FString Transport;
+    };
+
+    /**
+     * Deliver one encoded frame. Runs on a worker thread. Header holds the
+     * per-frame metadata (streamId, sequence, width, height, mimeType, timings).
+     * Return false when the client is gone; the stream then stops.
+     */
+    using FFrameSink = TFunction<bool(const TSharedRef<FJsonObject>& Header, const TArray<uint8>& ImageBytes)>;
+
+    /** Start a stream. Returns the new stream id, or an empty string with OutError set. Game thread only. */
+    FString Start(const FStreamSettings& Settings, FFrameSink Sink, FString& OutError);
+
+    /** Stop a stream and return its final stats, or null if the id is unknown. Game thread only. */
+    TSharedPtr<FJsonObject> Stop(const FString& StreamId);
+
+    /** Stats for one stream, or null if the id is unknown. Game thread only. */
+    TSharedPtr<FJsonObject> GetStats(const FString& StreamId);
+
+    /** Stats for every known stream (active and recently finished). Game thread only. */
+    TArray<TSharedPtr<FJsonValue>> ListStreams();
+
+    /** Stop every stream (subsystem shutdown). */
+    void StopAll();
+
+    /**
+     * Pack a binary WebSocket frame message:
+     * "MCPV" magic, uint32 little-endian header length, UTF-8 JSON header, image bytes.
+     */
+    void BuildBinaryFrame(const FString& HeaderJson, const TArray<uint8>& ImageBytes, TArray<uint8>& OutMessage);
+}
@@ -0,0 +1,1348 @@
+// =============================================================================
+// McpWidgetTreeSpec.cpp
+// =============================================================================
+// Implementation of declarative widget tree diff/apply and its benchmark.
+// =============================================================================
+
+#include "McpWidgetTreeSpec.h"
+#include "McpAutomationBridgeHelpers.h"
+#include "McpVersionCompatibility.h"
+#include "McpCompileScheduler.h"
+
+#include "Dom/JsonValue.h"
+#include "HAL/PlatformTime.h"
+#include "UObject/WeakObjectPtr.h"
+
+#if WITH_EDITOR
+#include "Blueprint/UserWidget.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/CanvasPanelSlot.h"
+#include "Components/HorizontalBoxSlot.h"
+#include "Components/OverlaySlot.h"
+#include "Components/PanelWidget.h"
+#include "Components/VerticalBoxSlot.h"
+#include "Components/Widget.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "ScopedTransaction.h"
+#include "UObject/Package.h"
+#include "WidgetBlueprint.h"
+#endif
+
+DEFINE_LOG_CATEGORY_STATIC(LogMcpWidgetTreeSpec, Log, All);
+
+namespace McpWidgetTreeSpec
+{
+    namespace
+    {
+#if WITH_EDITOR
+        struct FWidgetSpec
+        {
+            FString Name;
+            UClass* Class = nullptr;
+            TSharedPtr<FJsonObject> Json;
+            int32 Parent = INDEX_NONE;
+            TArray<int32> Children;
+
+            /** Resolved during apply. */
+            UWidget* Widget = nullptr;
+        };
+
+        UClass* ResolveWidgetClass(const FString& Type)
+        {
+            UClass* Class = ResolveUClass(Type);
+            if (!Class && Type.StartsWith(TEXT("U")))
+            {
+                Class = ResolveUClass(Type.Mid(1));
+            }
+            if (!Class && Type.StartsWith(TEXT("/")))
+            {
+                // A widget Blueprint asset rather than its class
+                if (UWidgetBlueprint* WidgetBP = LoadObject<UWidgetBlueprint>(nullptr, *Type))
+                {
+                    Class = WidgetBP->GeneratedClass;
+                }
+            }
+            return Class && Class->IsChildOf(UWidget::StaticClass()) &&
+                !Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated) ? Class : nullptr;
+        }
+
+        /** Flatten the nested spec depth-first; parents come before their children. */
+        bool ParseWidget(const UWidgetBlueprint& WidgetBP, const TSharedPtr<FJsonObject>& Json, int32 Parent,
+                         TArray<FWidgetSpec>& OutSpecs, TMap<FString, int32>& OutByName,
+                         FString& OutError, FString& OutErrorCode)
+        {
+            FWidgetSpec Spec;
+            Spec.Json = Json;
+            Spec.Parent = Parent;
+            FString Type;
+            Json->TryGetStringField(TEXT("name"), Spec.Name);
+            Json->TryGetStringField(TEXT("type"), Type);
+            if (Spec.Name.IsEmpty() || Type.IsEmpty())
+            {
+                OutError = TEXT("Every widget needs a 'name' and a 'type'");
+                return false;
+            }
+            if (!FName::IsValidXName(Spec.Name, INVALID_OBJECTNAME_CHARACTERS))
+            {
+                OutError = FString::Printf(TEXT("'%s' is not a valid widget name"), *Spec.Name);
+                return false;
+            }
+            if (OutByName.Contains(Spec.Name))
+            {
+                OutError = FString::Printf(TEXT("Widget '%s' is listed twice"), *Spec.Name);
+                return false;
+            }
+            Spec.Class = ResolveWidgetClass(Type);
+            if (!Spec.Class)
+            {
+                OutError = FString::Printf(TEXT("Widget '%s': '%s' is not a widget class"), *Spec.Name, *Type);
+                OutErrorCode = TEXT("CLASS_NOT_FOUND");
+                return false;
+            }
+            if (WidgetBP.GeneratedClass && Spec.Class->IsChildOf(WidgetBP.GeneratedClass))
+            {
+                OutError = FString::Printf(TEXT("Widget '%s': a widget Blueprint cannot contain itself"), *Spec.Name);
+                return false;
+            }
+
+            const TArray<TSharedPtr<FJsonValue>>* Children = nullptr;
+            const bool bHasChildren = Json->TryGetArrayField(TEXT("children"), Children) && Children->Num() > 0;
+            if (bHasChildren)
+            {
+                const UPanelWidget* Panel = Cast<UPanelWidget>(Spec.Class->GetDefaultObject());
+                if (!Panel)
+                {
+                    OutError = FString::Printf(TEXT("Widget '%s' (%s) is not a panel and cannot have children"),
+                        *Spec.Name, *Spec.Class->GetName());
+                    return false;
+                }
+                if (Children->Num() > 1 && !Panel->CanHaveMultipleChildren())
+                {
+                    OutError = FString::Printf(TEXT("Widget '%s' (%s) takes a single child"), *Spec.Name, *Spec.Class->GetName());
+                    return false;
+                }
+            }
+
+            const int32 Index = OutSpecs.Add(Spec);
+            OutByName.Add(Spec.Name, Index);
+            if (Parent != INDEX_NONE)
+            {
+                OutSpecs[Parent].Children.Add(Index);
+            }
+            if (bHasChildren)
+            {
+                for (const TSharedPtr<FJsonValue>& Value : *Children)
+                {
+                    const TSharedPtr<FJsonObject>* Child = nullptr;
+                    if (!Value.IsValid() || !Value->TryGetObject(Child))
+                    {
+                        OutError = FString::Printf(TEXT("Widget '%s': 'children' must be an array of objects"), *Spec.Name);
+                        return false;
+                    }
+                    if (!ParseWidget(WidgetBP, *Child, Index, OutSpecs, OutByName, OutError, OutErrorCode))
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        void RegisterWidgetGuid(UWidgetBlueprint& WidgetBP, UWidget& Widget)
+        {
+#if MCP_HAS_WIDGET_VARIABLE_GUID_MAP
+            // The widget compiler expects every tree widget in the GUID map
+            if (!MCP_WIDGET_BP_GET_GUID_MAP(&WidgetBP).Contains(Widget.GetFName()))
+            {
+                MCP_WIDGET_BP_GET_GUID_MAP(&WidgetBP).Emplace(Widget.GetFName(), MCP_NEW_DETERMINISTIC_GUID(Widget.GetPathName()));
+            }
+#endif
+        }
+
+        void UnregisterWidgetGuid(UWidgetBlueprint& WidgetBP, UWidget& Widget)
+        {
+#if MCP_HAS_WIDGET_VARIABLE_GUID_MAP
+            MCP_WIDGET_BP_GET_GUID_MAP(&WidgetBP).Remove(Widget.GetFName());
+#endif
+        }
+
+        /** Widget and its descendants, except spec widgets and what is under them. */
+        void CollectRemovable(UWidget* Widget, const TMap<FString, int32>& Keep, TArray<UWidget*>& OutRemove,
+                              TArray<UWidget*>& OutDetach)
+        {
+            OutRemove.Add(Widget);
+            if (UPanelWidget* Panel = Cast<UPanelWidget>(Widget))
+            {
+                for (UWidget* Child : Panel->GetAllChildren())
+                {
+                    if (!Child)
+                    {
+                        continue;
+                    }
+                    if (Keep.Contains(Child->GetName()))
+                    {
+                        OutDetach.Add(Child);
+                    }
+                    else
+                    {
+                        CollectRemovable(Child, Keep, OutRemove, OutDetach);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Remove Widget and its non-spec descendants from the tree. As
+         * ClearWidgetTreeForRebuild does, removed widgets move to the transient
+         * package so the compiler no longer finds them under the tree.
+         */
+        void RemoveSubtree(UWidgetBlueprint& WidgetBP, UWidget* Widget, const TMap<FString, int32>& Keep,
+                           TSet<FString>& OutRemovedNames, FApplyResult& Result)
+        {
+            TArray<UWidget*> Remove;
+            TArray<UWidget*> Detach;
+            CollectRemovable(Widget, Keep, Remove, Detach);
+            for (UWidget* Child : Detach)
+            {
+                Child->RemoveFromParent();
+            }
+            WidgetBP.WidgetTree->RemoveWidget(Widget);
+            for (UWidget* Removed : Remove)
+            {
+                OutRemovedNames.Add(Removed->GetName());
+                UnregisterWidgetGuid(WidgetBP, *Removed);
+                Removed->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors);
+                ++Result.Deleted;
+            }
+        }
+
+        bool ReadVector2D(const TSharedPtr<FJsonValue>& Value, FVector2D& Out)
+        {
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            const TArray<TSharedPtr<FJsonValue>>* Array = nullptr;
+            if (Value.IsValid() && Value->TryGetObject(Object))
+            {
+                Out.X = GetJsonNumberField(*Object, TEXT("x"), Out.X);
+                Out.Y = GetJsonNumberField(*Object, TEXT("y"), Out.Y);
+                return true;
+            }
+            if (Value.IsValid() && Value->TryGetArray(Array) && Array->Num() == 2)
+            {
+                Out.X = (*Array)[0]->AsNumber();
+                Out.Y = (*Array)[1]->AsNumber();
+                return true;
+            }
+            return false;
+        }
+
+        /** A number for uniform padding, or { left, top, right, bottom }. */
+        bool ReadMargin(const TSharedPtr<FJsonValue>& Value, FMargin& Out)
+        {
+            double Uniform = 0.0;
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (Value.IsValid() && Value->TryGetNumber(Uniform))
+            {
+                Out = FMargin(static_cast<float>(Uniform));
+                return true;
+            }
+            if (Value.IsValid() && Value->TryGetObject(Object))
+            {
+                Out.Left = GetJsonNumberField(*Object, TEXT("left"), 0.0);
+                Out.Top = GetJsonNumberField(*Object, TEXT("top"), 0.0);
+                Out.Right = GetJsonNumberField(*Object, TEXT("right"), 0.0);
+                Out.Bottom = GetJsonNumberField(*Object, TEXT("bottom"), 0.0);
+                return true;
+            }
+            return false;
+        }
+
+        bool ReadHorizontalAlignment(const FString& Value, EHorizontalAlignment& Out)
+        {
+            static const TMap<FString, EHorizontalAlignment> Alignments = {
+                {TEXT("Left"), HAlign_Left}, {TEXT("Center"), HAlign_Center},
+                {TEXT("Right"), HAlign_Right}, {TEXT("Fill"), HAlign_Fill}
+            };
+            const EHorizontalAlignment* Found = Alignments.Find(Value.Replace(TEXT("HAlign_"), TEXT("")));
+            Out = Found ? *Found : Out;
+            return Found != nullptr;
+        }
+
+        bool ReadVerticalAlignment(const FString& Value, EVerticalAlignment& Out)
+        {
+            static const TMap<FString, EVerticalAlignment> Alignments = {
+                {TEXT("Top"), VAlign_Top}, {TEXT("Center"), VAlign_Center},
+                {TEXT("Bottom"), VAlign_Bottom}, {TEXT("Fill"), VAlign_Fill}
+            };
+            const EVerticalAlignment* Found = Alignments.Find(Value.Replace(TEXT("VAlign_"), TEXT("")));
+            Out = Found ? *Found : Out;
+            return Found != nullptr;
+        }
+
+        /** The set_anchor presets, or { minimum, maximum }. */
+        bool ReadAnchors(const TSharedPtr<FJsonValue>& Value, FAnchors& Out)
+        {
+            static const TMap<FString, FAnchors> Presets = {
+                {TEXT("TopLeft"), FAnchors(0.0f, 0.0f)},
+                {TEXT("TopCenter"), FAnchors(0.5f, 0.0f)},
+                {TEXT("TopRight"), FAnchors(1.0f, 0.0f)},
+                {TEXT("CenterLeft"), FAnchors(0.0f, 0.5f)},
+                {TEXT("Center"), FAnchors(0.5f, 0.5f)},
+                {TEXT("CenterRight"), FAnchors(1.0f, 0.5f)},
+                {TEXT("BottomLeft"), FAnchors(0.0f, 1.0f)},
+                {TEXT("BottomCenter"), FAnchors(0.5f, 1.0f)},
+                {TEXT("BottomRight"), FAnchors(1.0f, 1.0f)},
+                {TEXT("StretchHorizontal"), FAnchors(0.0f, 0.5f, 1.0f, 0.5f)},
+                {TEXT("StretchVertical"), FAnchors(0.5f, 0.0f, 0.5f, 1.0f)},
+                {TEXT("StretchAll"), FAnchors(0.0f, 0.0f, 1.0f, 1.0f)}
+            };
+            FString Preset;
+            const TSharedPtr<FJsonObject>* Object = nullptr;
+            if (Value.IsValid() && Value->TryGetString(Preset))
+            {
+                const FAnchors* Found = Presets.Find(Preset);
+                Out = Found ? *Found : Out;
+                return Found != nullptr;
+            }
+            if (Value.IsValid() && Value->TryGetObject(Object))
+            {
+                FVector2D Minimum(Out.Minimum), Maximum(Out.Maximum);
+                ReadVector2D((*Object)->TryGetField(TEXT("minimum")), Minimum);
+                ReadVector2D((*Object)->TryGetField(TEXT("maximum")), Maximum);
+                Out.Minimum = Minimum;
+                Out.Maximum = Maximum;
+                return true;
+            }
+            return false;
+        }
+
+        /** Set a reflected property by name; FText takes a string. */
+        bool ApplyProperty(UObject& Target, const FString& Name, const TSharedPtr<FJsonValue>& Value, FString& OutError)
+        {
+            FProperty* Property = Target.GetClass()->FindPropertyByName(FName(*Name));
+            for (TFieldIterator<FProperty> It(Target.GetClass()); It && !Property; ++It)
+            {
+                if (It->GetName().Equals(Name, ESearchCase::IgnoreCase))
+                {
+                    Property = *It;
+                }
+            }
+            if (!Property)
+            {
+                OutError = FString::Printf(TEXT("%s has no property '%s'"), *Target.GetClass()->GetName(), *Name);
+                return false;
+            }
+            if (FTextProperty* TextProperty = CastField<FTextProperty>(Property))
+            {
+                FString Text;
+                if (!Value.IsValid() || !Value->TryGetString(Text))
+                {
+                    OutError = FString::Printf(TEXT("'%s' takes a string"), *Name);
+                    return false;
+                }
+                TextProperty->SetPropertyValue_InContainer(&Target, FText::FromString(Text));
+                return true;
+            }
+            return ApplyJsonValueToProperty(&Target, Property, Value, OutError);
+        }
+
+        void ApplySlot(UPanelSlot& Slot, const FString& WidgetName, const TSharedPtr<FJsonObject>& Json, FApplyResult& Result)
+        {
+            Slot.Modify();
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Json->Values)
+            {
+                const FString& Key = Pair.Key;
+                bool bHandled = true;
+                bool bValid = true;
+                FString StringValue;
+                Pair.Value->TryGetString(StringValue);
+
+                if (UCanvasPanelSlot* Canvas = Cast<UCanvasPanelSlot>(&Slot))
+                {
+                    FVector2D Vector = FVector2D::ZeroVector;
+                    FAnchors Anchors = Canvas->GetAnchors();
+                    if (Key == TEXT("anchors") && (bValid = ReadAnchors(Pair.Value, Anchors)))
+                    {
+                        Canvas->SetAnchors(Anchors);
+                    }
+                    else if (Key == TEXT("position") && (bValid = ReadVector2D(Pair.Value, Vector)))
+                    {
+                        Canvas->SetPosition(Vector);
+                    }
+                    else if (Key == TEXT("size") && (bValid = ReadVector2D(Pair.Value, Vector)))
+                    {
+                        Canvas->SetSize(Vector);
+                    }
+                    else if (Key == TEXT("alignment") && (bValid = ReadVector2D(Pair.Value, Vector)))
+                    {
+                        Canvas->SetAlignment(Vector);
+                    }
+                    else if (Key == TEXT("autoSize"))
+                    {
+                        Canvas->SetAutoSize(Pair.Value->AsBool());
+                    }
+                    else if (Key == TEXT("zOrder"))
+                    {
+                        Canvas->SetZOrder(static_cast<int32>(Pair.Value->AsNumber()));
+                    }
+                    else
+                    {
+                        bHandled = false;
+                    }
+                }
+                else
+                {
+                    UHorizontalBoxSlot* HBox = Cast<UHorizontalBoxSlot>(&Slot);
+                    UVerticalBoxSlot* VBox = Cast<UVerticalBoxSlot>(&Slot);
+                    UOverlaySlot* Overlay = Cast<UOverlaySlot>(&Slot);
+                    FMargin Padding;
+                    EHorizontalAlignment HAlign = HAlign_Fill;
+                    EVerticalAlignment VAlign = VAlign_Fill;
+                    if (Key == TEXT("padding") && (HBox || VBox || Overlay) && (bValid = ReadMargin(Pair.Value, Padding)))
+                    {
+                        if (HBox) { HBox->SetPadding(Padding); }
+                        if (VBox) { VBox->SetPadding(Padding); }
+                        if (Overlay) { Overlay->SetPadding(Padding); }
+                    }
+                    else if (Key == TEXT("horizontalAlignment") && (HBox || VBox || Overlay) &&
+                             (bValid = ReadHorizontalAlignment(StringValue, HAlign)))
+                    {
+                        if (HBox) { HBox->SetHorizontalAlignment(HAlign); }
+                        if (VBox) { VBox->SetHorizontalAlignment(HAlign); }
+                        if (Overlay) { Overlay->SetHorizontalAlignment(HAlign); }
+                    }
+                    else if (Key == TEXT("verticalAlignment") && (HBox || VBox || Overlay) &&
+                             (bValid = ReadVerticalAlignment(StringValue, VAlign)))
+                    {
+                        if (HBox) { HBox->SetVerticalAlignment(VAlign); }
+                        if (VBox) { VBox->SetVerticalAlignment(VAlign); }
+                        if (Overlay) { Overlay->SetVerticalAlignment(VAlign); }
+                    }
+                    else if (Key == TEXT("size") && (HBox || VBox))
+                    {
+                        // "Auto", "Fill" or a fill weight
+                        double Weight = 1.0;
+                        FSlateChildSize Size(ESlateSizeRule::Fill);
+                        if (StringValue.Equals(TEXT("Auto"), ESearchCase::IgnoreCase))
+                        {
+                            Size.SizeRule = ESlateSizeRule::Automatic;
+                        }
+                        else if (Pair.Value->TryGetNumber(Weight))
+                        {
+                            Size.Value = static_cast<float>(Weight);
+                        }
+                        else
+                        {
+                            bValid = StringValue.Equals(TEXT("Fill"), ESearchCase::IgnoreCase);
+                        }
+                        if (bValid && HBox) { HBox->SetSize(Size); }
+                        if (bValid && VBox) { VBox->SetSize(Size); }
+                    }
+                    else
+                    {
+                        bHandled = false;
+                    }
+                }
+
+                FString Error;
+                if (!bValid)
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: invalid slot value for '%s'"), *WidgetName, *Key));
+                }
+                else if (bHandled || ApplyProperty(Slot, Key, Pair.Value, Error))
+                {
+                    ++Result.SlotValuesSet;
+                }
+                else
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s slot: %s"), *WidgetName, *Error));
+                }
+            }
+        }
+
+        UEdGraph* FindFunctionGraph(UWidgetBlueprint& WidgetBP, const FString& Name)
+        {
+            for (UEdGraph* Graph : WidgetBP.FunctionGraphs)
+            {
+                if (Graph && Graph->GetName() == Name)
+                {
+                    return Graph;
+                }
+            }
+            return nullptr;
+        }
+
+        /** Bind "<Property>" to a function graph, the way the designer's Bind > function menu does. */
+        void ApplyBindings(UWidgetBlueprint& WidgetBP, const FWidgetSpec& Spec, const TSharedPtr<FJsonObject>& Bindings,
+                           bool bPrune, FApplyResult& Result)
+        {
+            TSet<FName> Listed;
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Bindings->Values)
+            {
+                const FName PropertyName(*Pair.Key);
+                FString FunctionName;
+                Pair.Value->TryGetString(FunctionName);
+                Listed.Add(PropertyName);
+
+                if (!CastField<FDelegateProperty>(Spec.Class->FindPropertyByName(FName(*(Pair.Key + TEXT("Delegate"))))))
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: %s is not bindable"), *Spec.Name, *Pair.Key));
+                    continue;
+                }
+                UEdGraph* Graph = FunctionName.IsEmpty() ? nullptr : FindFunctionGraph(WidgetBP, FunctionName);
+                if (!Graph)
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s.%s: function '%s' not found in the widget Blueprint"),
+                        *Spec.Name, *Pair.Key, *FunctionName));
+                    continue;
+                }
+
+                FDelegateEditorBinding Binding;
+                Binding.ObjectName = Spec.Name;
+                Binding.PropertyName = PropertyName;
+                Binding.FunctionName = Graph->GetFName();
+                Binding.MemberGuid = Graph->GraphGuid;
+                Binding.Kind = EBindingKind::Function;
+
+                FDelegateEditorBinding* Existing = WidgetBP.Bindings.FindByPredicate([&](const FDelegateEditorBinding& Candidate)
+                {
+                    return Candidate.ObjectName == Spec.Name && Candidate.PropertyName == PropertyName;
+                });
+                if (!Existing)
+                {
+                    WidgetBP.Bindings.Add(Binding);
+                    ++Result.BindingsSet;
+                }
+                else if (Existing->FunctionName != Binding.FunctionName || Existing->Kind != Binding.Kind)
+                {
+                    *Existing = Binding;
+                    ++Result.BindingsSet;
+                }
+            }
+
+            if (bPrune)
+            {
+                Result.BindingsRemoved += WidgetBP.Bindings.RemoveAll([&](const FDelegateEditorBinding& Candidate)
+                {
+                    return Candidate.ObjectName == Spec.Name && !Listed.Contains(Candidate.PropertyName);
+                });
+            }
+        }
+
+        void ApplyFields(UWidgetBlueprint& WidgetBP, const FWidgetSpec& Spec, bool bPrune, FApplyResult& Result)
+        {
+            UWidget& Widget = *Spec.Widget;
+            const TSharedPtr<FJsonObject>& Json = Spec.Json;
+            Widget.Modify();
+
+            bool bIsVariable = false;
+            if (Json->TryGetBoolField(TEXT("isVariable"), bIsVariable))
+            {
+                Widget.bIsVariable = bIsVariable;
+                ++Result.PropertiesSet;
+            }
+
+            FString Visibility;
+            if (Json->TryGetStringField(TEXT("visibility"), Visibility))
+            {
+                const int64 Value = StaticEnum<ESlateVisibility>()->GetValueByNameString(Visibility);
+                if (Value == INDEX_NONE)
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: unknown visibility '%s'"), *Spec.Name, *Visibility));
+                }
+                else
+                {
+                    Widget.SetVisibility(static_cast<ESlateVisibility>(Value));
+                    ++Result.PropertiesSet;
+                }
+            }
+
+            FString Error;
+            if (const TSharedPtr<FJsonValue> Text = Json->TryGetField(TEXT("text")))
+            {
+                if (ApplyProperty(Widget, TEXT("Text"), Text, Error))
+                {
+                    ++Result.PropertiesSet;
+                }
+                else
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: %s"), *Spec.Name, *Error));
+                }
+            }
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (Json->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Properties)->Values)
+                {
+                    if (ApplyProperty(Widget, Pair.Key, Pair.Value, Error))
+                    {
+                        ++Result.PropertiesSet;
+                    }
+                    else
+                    {
+                        Result.Warnings.Add(FString::Printf(TEXT("%s: %s"), *Spec.Name, *Error));
+                    }
+                }
+            }
+
+            const TSharedPtr<FJsonObject>* Slot = nullptr;
+            if (Json->TryGetObjectField(TEXT("slot"), Slot))
+            {
+                if (Widget.Slot)
+                {
+                    ApplySlot(*Widget.Slot, Spec.Name, *Slot, Result);
+                }
+                else
+                {
+                    Result.Warnings.Add(FString::Printf(TEXT("%s: the root widget has no slot"), *Spec.Name));
+                }
+            }
+
+            const TSharedPtr<FJsonObject>* Bindings = nullptr;
+            if (Json->TryGetObjectField(TEXT("bindings"), Bindings))
+            {
+                ApplyBindings(WidgetBP, Spec, *Bindings, bPrune, Result);
+            }
+        }
+
+        const TCHAR* StatusName(EBlueprintStatus Status)
+        {
+            switch (Status)
+            {
+            case BS_Dirty: return TEXT("dirty");
+            case BS_Error: return TEXT("error");
+            case BS_UpToDate: return TEXT("upToDate");
+            case BS_UpToDateWithWarnings: return TEXT("upToDateWithWarnings");
+            case BS_BeingCreated: return TEXT("beingCreated");
+            default: return TEXT("unknown");
+            }
+        }
+
+        // ---- Benchmark HUD -------------------------------------------------------
+
+        struct FBenchWidget
+        {
+            /** The widget's own fields, without children. */
+            TSharedPtr<FJsonObject> Json;
+            int32 Parent = INDEX_NONE;
+        };
+
+        TSharedPtr<FJsonObject> MakeVector(double X, double Y)
+        {
+            TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+            Json->SetNumberField(TEXT("x"), X);
+            Json->SetNumberField(TEXT("y"), Y);
+            return Json;
+        }
+
+        TSharedPtr<FJsonObject> MakeColor(double R, double G, double B, double A)
+        {
+            TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+            Json->SetNumberField(TEXT("R"), R);
+            Json->SetNumberField(TEXT("G"), G);
+            Json->SetNumberField(TEXT("B"), B);
+            Json->SetNumberField(TEXT("A"), A);
+            return Json;
+        }
+
+        /**
+         * A HUD of exactly Count widgets: a root canvas holding stat panels
+         * (border > vertical box > label, bar, row > icon, value), with any
+         * remainder as plain labels on the canvas.
+         */
+        TSharedPtr<FJsonObject> BuildBenchmarkHud(int32 Count, TArray<FBenchWidget>& OutFlat)
+        {
+            auto Add = [&OutFlat](int32 Parent, const FString& Name, const TCHAR* Type) -> TSharedPtr<FJsonObject>
+            {
+                TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+                Json->SetStringField(TEXT("name"), Name);
+                Json->SetStringField(TEXT("type"), Type);
+                OutFlat.Add({Json, Parent});
+                return Json;
+            };
+
+            Add(INDEX_NONE, TEXT("HUDRoot"), TEXT("CanvasPanel"));
+            constexpr int32 PanelSize = 7;
+            for (int32 Panel = 0; OutFlat.Num() < Count; ++Panel)
+            {
+                const FString Prefix = FString::Printf(TEXT("Stat%02d"), Panel);
+                if (Count - OutFlat.Num() < PanelSize)
+                {
+                    TSharedPtr<FJsonObject> Label = Add(0, Prefix + TEXT("_Note"), TEXT("TextBlock"));
+                    Label->SetStringField(TEXT("text"), Prefix);
+                    TSharedPtr<FJsonObject> Slot = MakeShared<FJsonObject>();
+                    Slot->SetStringField(TEXT("anchors"), TEXT("TopRight"));
+                    Slot->SetObjectField(TEXT("position"), MakeVector(-200.0, 20.0 + 24.0 * Panel));
+                    Slot->SetBoolField(TEXT("autoSize"), true);
+                    Label->SetObjectField(TEXT("slot"), Slot);
+                    continue;
+                }
+
+                const int32 BorderIndex = OutFlat.Num();
+                TSharedPtr<FJsonObject> Border = Add(0, Prefix + TEXT("_Panel"), TEXT("Border"));
+                TSharedPtr<FJsonObject> BorderProperties = MakeShared<FJsonObject>();
+                BorderProperties->SetObjectField(TEXT("BrushColor"), MakeColor(0.0, 0.0, 0.0, 0.4));
+                Border->SetObjectField(TEXT("properties"), BorderProperties);
+                TSharedPtr<FJsonObject> BorderSlot = MakeShared<FJsonObject>();
+                BorderSlot->SetStringField(TEXT("anchors"), TEXT("TopLeft"));
+                BorderSlot->SetObjectField(TEXT("position"), MakeVector(20.0, 20.0 + 90.0 * Panel));
+                BorderSlot->SetBoolField(TEXT("autoSize"), true);
+                Border->SetObjectField(TEXT("slot"), BorderSlot);
+
+                const int32 BoxIndex = OutFlat.Num();
+                Add(BorderIndex, Prefix + TEXT("_Box"), TEXT("VerticalBox"));
+
+                TSharedPtr<FJsonObject> Label = Add(BoxIndex, Prefix + TEXT("_Label"), TEXT("TextBlock"));
+                Label->SetStringField(TEXT("text"), FString::Printf(TEXT("Stat %d"), Panel));
+
+                TSharedPtr<FJsonObject> Bar = Add(BoxIndex, Prefix + TEXT("_Bar"), TEXT("ProgressBar"));
+                Bar->SetBoolField(TEXT("isVariable"), true);
+                TSharedPtr<FJsonObject> BarProperties = MakeShared<FJsonObject>();
+                BarProperties->SetNumberField(TEXT("Percent"), 0.75);
+                BarProperties->SetObjectField(TEXT("FillColorAndOpacity"), MakeColor(0.2, 0.8, 0.3, 1.0));
+                Bar->SetObjectField(TEXT("properties"), BarProperties);
+
+                const int32 RowIndex = OutFlat.Num();
+                TSharedPtr<FJsonObject> Row = Add(BoxIndex, Prefix + TEXT("_Row"), TEXT("HorizontalBox"));
+                TSharedPtr<FJsonObject> RowSlot = MakeShared<FJsonObject>();
+                TSharedPtr<FJsonObject> RowPadding = MakeShared<FJsonObject>();
+                RowPadding->SetNumberField(TEXT("top"), 4.0);
+                RowSlot->SetObjectField(TEXT("padding"), RowPadding);
+                Row->SetObjectField(TEXT("slot"), RowSlot);
+
+                TSharedPtr<FJsonObject> Icon = Add(RowIndex, Prefix + TEXT("_Icon"), TEXT("Image"));
+                TSharedPtr<FJsonObject> IconProperties = MakeShared<FJsonObject>();
+                IconProperties->SetObjectField(TEXT("ColorAndOpacity"), MakeColor(1.0, 0.8, 0.2, 1.0));
+                Icon->SetObjectField(TEXT("properties"), IconProperties);
+                TSharedPtr<FJsonObject> IconSlot = MakeShared<FJsonObject>();
+                IconSlot->SetStringField(TEXT("size"), TEXT("Auto"));
+                Icon->SetObjectField(TEXT("slot"), IconSlot);
+
+                TSharedPtr<FJsonObject> Value = Add(RowIndex, Prefix + TEXT("_Value"), TEXT("TextBlock"));
+                Value->SetStringField(TEXT("text"), TEXT("100"));
+                Value->SetBoolField(TEXT("isVariable"), true);
+                TSharedPtr<FJsonObject> ValueSlot = MakeShared<FJsonObject>();
+                ValueSlot->SetNumberField(TEXT("padding"), 6.0);
+                ValueSlot->SetStringField(TEXT("verticalAlignment"), TEXT("Center"));
+                Value->SetObjectField(TEXT("slot"), ValueSlot);
+            }
+
+            // Nest copies so the flat entries stay childless
+            TArray<TSharedPtr<FJsonObject>> Nested;
+            TArray<TArray<TSharedPtr<FJsonValue>>> Children;
+            Nested.Reserve(OutFlat.Num());
+            Children.SetNum(OutFlat.Num());
+            for (int32 Index = 0; Index < OutFlat.Num(); ++Index)
+            {
+                Nested.Add(MakeShared<FJsonObject>(*OutFlat[Index].Json));
+                if (OutFlat[Index].Parent != INDEX_NONE)
+                {
+                    Children[OutFlat[Index].Parent].Add(MakeShared<FJsonValueObject>(Nested[Index]));
+                }
+            }
+            for (int32 Index = 0; Index < OutFlat.Num(); ++Index)
+            {
+                if (Children[Index].Num() > 0)
+                {
+                    Nested[Index]->SetArrayField(TEXT("children"), Children[Index]);
+                }
+            }
+
+            TSharedPtr<FJsonObject> Spec = MakeShared<FJsonObject>();
+            Spec->SetObjectField(TEXT("root"), Nested[0]);
+            return Spec;
+        }
+
+        /** The spec a single add_* style request amounts to: the widget under its (bare) ancestors. */
+        TSharedPtr<FJsonObject> BuildSingleWidgetSpec(const TArray<FBenchWidget>& Flat, int32 Index)
+        {
+            TSharedPtr<FJsonObject> Current = MakeShared<FJsonObject>(*Flat[Index].Json);
+            for (int32 Parent = Flat[Index].Parent; Parent != INDEX_NONE; Parent = Flat[Parent].Parent)
+            {
+                TSharedPtr<FJsonObject> Ancestor = MakeShared<FJsonObject>();
+                Ancestor->SetStringField(TEXT("name"), Flat[Parent].Json->GetStringField(TEXT("name")));
+                Ancestor->SetStringField(TEXT("type"), Flat[Parent].Json->GetStringField(TEXT("type")));
+                TArray<TSharedPtr<FJsonValue>> Children;
+                Children.Add(MakeShared<FJsonValueObject>(Current));
+                Ancestor->SetArrayField(TEXT("children"), Children);
+                Current = Ancestor;
+            }
+            TSharedPtr<FJsonObject> Spec = MakeShared<FJsonObject>();
+            Spec->SetObjectField(TEXT("root"), Current);
+            return Spec;
+        }
+
+        int32 CountWidgets(const UWidgetBlueprint& WidgetBP)
+        {
+            TArray<UWidget*> Widgets;
+            WidgetBP.WidgetTree->GetAllWidgets(Widgets);
+            return Widgets.Num();
+        }
+#endif // WITH_EDITOR
+    }
+
+    TSharedPtr<FJsonObject> FApplyResult::ToJson() const
+    {
+        TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+        Json->SetNumberField(TEXT("created"), Created);
+        Json->SetNumberField(TEXT("updated"), Updated);
+        Json->SetNumberField(TEXT("replaced"), Replaced);
+        Json->SetNumberField(TEXT("deleted"), Deleted);
+        Json->SetNumberField(TEXT("moved"), Moved);
+        Json->SetNumberField(TEXT("propertiesSet"), PropertiesSet);
+        Json->SetNumberField(TEXT("slotValuesSet"), SlotValuesSet);
+        Json->SetNumberField(TEXT("bindingsSet"), BindingsSet);
+        Json->SetNumberField(TEXT("bindingsRemoved"), BindingsRemoved);
+        Json->SetBoolField(TEXT("compileRequested"), bCompileRequested);
+        Json->SetBoolField(TEXT("compileDeferred"), bCompileDeferred);
+        Json->SetStringField(TEXT("blueprintStatus"), BlueprintStatus);
+        Json->SetNumberField(TEXT("applyMs"), ApplySeconds * 1000.0);
+        Json->SetNumberField(TEXT("compileMs"), CompileSeconds * 1000.0);
+        Json->SetObjectField(TEXT("widgets"), Widgets.IsValid() ? Widgets : MakeShared<FJsonObject>());
+
+        TArray<TSharedPtr<FJsonValue>> WarningValues;
+        for (const FString& Warning : Warnings)
+        {
+            WarningValues.Add(MakeShared<FJsonValueString>(Warning));
+        }
+        Json->SetArrayField(TEXT("warnings"), WarningValues);
+        return Json;
+    }
+
+    bool Apply(UWidgetBlueprint* WidgetBP, const TSharedPtr<FJsonObject>& Spec, bool bCompile,
+               FApplyResult& OutResult, FString& OutError, FString& OutErrorCode)
+    {
+#if WITH_EDITOR
+        const double StartSeconds = FPlatformTime::Seconds();
+        OutResult = FApplyResult();
+        OutResult.Widgets = MakeShared<FJsonObject>();
+        OutErrorCode = TEXT("INVALID_SPEC");
+
+        if (!WidgetBP || !WidgetBP->WidgetTree || !Spec.IsValid())
+        {
+            OutError = TEXT("Missing widget blueprint, widget tree or spec");
+            return false;
+        }
+
+        bool bPrune = false;
+        Spec->TryGetBoolField(TEXT("prune"), bPrune);
+
+        // ---- Resolve and validate, before anything is modified -------------
+        const TSharedPtr<FJsonObject>* RootJson = nullptr;
+        if (!Spec->TryGetObjectField(TEXT("root"), RootJson))
+        {
+            OutError = TEXT("Spec needs a 'root' widget");
+            return false;
+        }
+        TArray<FWidgetSpec> Specs;
+        TMap<FString, int32> ByName;
+        if (!ParseWidget(*WidgetBP, *RootJson, INDEX_NONE, Specs, ByName, OutError, OutErrorCode))
+        {
+            return false;
+        }
+        OutErrorCode.Reset();
+
+        UWidgetTree* WidgetTree = WidgetBP->WidgetTree;
+        TMap<FString, UWidget*> ExistingByName;
+        {
+            TArray<UWidget*> AllWidgets;
+            WidgetTree->GetAllWidgets(AllWidgets);
+            for (UWidget* Widget : AllWidgets)
+            {
+                if (Widget)
+                {
+                    ExistingByName.Add(Widget->GetName(), Widget);
+                }
+            }
+        }
+
+        bool bStructural = false;
+        TSet<FString> RemovedNames;
+        {
+            const FScopedTransaction Transaction(FText::FromString(TEXT("Apply Widget Tree")));
+            WidgetBP->Modify();
+            WidgetTree->Modify();
+
+            // ---- Match, replace, construct ---------------------------------
+            for (FWidgetSpec& WidgetSpec : Specs)
+            {
+                UWidget* Existing = ExistingByName.FindRef(WidgetSpec.Name);
+                const bool bReplace = Existing && Existing->GetClass() != WidgetSpec.Class;
+                if (bReplace)
+                {
+                    RemoveSubtree(*WidgetBP, Existing, ByName, RemovedNames, OutResult);
+                    // Counted as a replacement, not a deletion
+                    --OutResult.Deleted;
+                    ++OutResult.Replaced;
+                    Existing = nullptr;
+                }
+                if (Existing)
+                {
+                    WidgetSpec.Widget = Existing;
+                    ++OutResult.Updated;
+                    continue;
+                }
+
+                // A stale object outside the tree would block the name
+                if (UObject* Stale = StaticFindObject(UObject::StaticClass(), WidgetTree, *WidgetSpec.Name))
+                {
+                    Stale->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors);
+                }
+                WidgetSpec.Widget = WidgetTree->ConstructWidget<UWidget>(WidgetSpec.Class, FName(*WidgetSpec.Name));
+                if (!WidgetSpec.Widget)
+                {
+                    OutResult.Warnings.Add(FString::Printf(TEXT("%s: could not construct %s"), *WidgetSpec.Name,
+                        *WidgetSpec.Class->GetName()));
+                    continue;
+                }
+                RegisterWidgetGuid(*WidgetBP, *WidgetSpec.Widget);
+                OutResult.Created += bReplace ? 0 : 1;
+            }
+
+            // ---- Place: root, then each panel's children in spec order -----
+            UWidget* Root = Specs[0].Widget;
+            if (Root && WidgetTree->RootWidget != Root)
+            {
+                UWidget* OldRoot = WidgetTree->RootWidget;
+                Root->RemoveFromParent();
+                WidgetTree->RootWidget = Root;
+                if (OldRoot && !ByName.Contains(OldRoot->GetName()))
+                {
+                    RemoveSubtree(*WidgetBP, OldRoot, ByName, RemovedNames, OutResult);
+                }
+                ++OutResult.Moved;
+            }
+
+            for (const FWidgetSpec& WidgetSpec : Specs)
+            {
+                UPanelWidget* Panel = Cast<UPanelWidget>(WidgetSpec.Widget);
+                if (!Panel || WidgetSpec.Children.Num() == 0)
+                {
+                    continue;
+                }
+                TArray<UWidget*> Desired;
+                for (int32 Child : WidgetSpec.Children)
+                {
+                    if (Specs[Child].Widget)
+                    {
+                        Desired.Add(Specs[Child].Widget);
+                    }
+                }
+                TArray<UWidget*> Current = Panel->GetAllChildren();
+                TArray<UWidget*> Kept = Current.FilterByPredicate([&Desired](UWidget* Child) { return Desired.Contains(Child); });
+                if (Kept == Desired)
+                {
+                    continue;
+                }
+
+                Panel->Modify();
+                if (!Panel->CanHaveMultipleChildren())
+                {
+                    for (UWidget* Child : Current)
+                    {
+                        if (Child && !Desired.Contains(Child))
+                        {
+                            OutResult.Warnings.Add(FString::Printf(TEXT("%s: replaced content '%s'"), *WidgetSpec.Name,
+                                *Child->GetName()));
+                            RemoveSubtree(*WidgetBP, Child, ByName, RemovedNames, OutResult);
+                        }
+                    }
+                }
+                for (UWidget* Child : Desired)
+                {
+                    Child->RemoveFromParent();
+                }
+                for (UWidget* Child : Desired)
+                {
+                    Panel->AddChild(Child);
+                    ++OutResult.Moved;
+                }
+            }
+
+            // ---- Fields ----------------------------------------------------
+            for (const FWidgetSpec& WidgetSpec : Specs)
+            {
+                if (WidgetSpec.Widget)
+                {
+                    ApplyFields(*WidgetBP, WidgetSpec, bPrune, OutResult);
+                }
+            }
+
+            // ---- Prune -----------------------------------------------------
+            if (bPrune)
+            {
+                TArray<UWidget*> AllWidgets;
+                WidgetTree->GetAllWidgets(AllWidgets);
+                TArray<UWidget*> Unlisted;
+                for (UWidget* Widget : AllWidgets)
+                {
+                    // Children of an unlisted widget go with it
+                    if (Widget && !ByName.Contains(Widget->GetName()) && ByName.Contains(Widget->GetParent()
+                        ? Widget->GetParent()->GetName() : FString()))
+                    {
+                        Unlisted.Add(Widget);
+                    }
+                }
+                for (UWidget* Widget : Unlisted)
+                {
+                    RemoveSubtree(*WidgetBP, Widget, ByName, RemovedNames, OutResult);
+                }
+            }
+
+            // Bindings of removed widgets would fail the compile
+            OutResult.BindingsRemoved += WidgetBP->Bindings.RemoveAll([&](const FDelegateEditorBinding& Binding)
+            {
+                return RemovedNames.Contains(Binding.ObjectName) && !ByName.Contains(Binding.ObjectName);
+            });
+
+            for (const FWidgetSpec& WidgetSpec : Specs)
+            {
+                if (!WidgetSpec.Widget)
+                {
+                    continue;
+                }
+                TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+                Json->SetStringField(TEXT("class"), WidgetSpec.Widget->GetClass()->GetName());
+                Json->SetStringField(TEXT("parent"), WidgetSpec.Widget->GetParent()
+                    ? WidgetSpec.Widget->GetParent()->GetName() : FString());
+                Json->SetStringField(TEXT("slot"), WidgetSpec.Widget->Slot
+                    ? WidgetSpec.Widget->Slot->GetClass()->GetName() : FString());
+                OutResult.Widgets->SetObjectField(WidgetSpec.Name, Json);
+            }
+
+            // One modification notice for the whole tree
+            bStructural = OutResult.Created + OutResult.Replaced + OutResult.Deleted + OutResult.Moved > 0;
+            if (bStructural)
+            {
+                FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(WidgetBP);
+            }
+            else
+            {
+                FBlueprintEditorUtils::MarkBlueprintAsModified(WidgetBP);
+            }
+        }
+        OutResult.ApplySeconds = FPlatformTime::Seconds() - StartSeconds;
+
+        if (bCompile)
+        {
+            const double CompileStart = FPlatformTime::Seconds();
+            OutResult.bCompileDeferred = McpCompileScheduler::IsDeferring();
+            McpSafeCompileBlueprint(WidgetBP);
+            OutResult.bCompileRequested = true;
+            OutResult.CompileSeconds = FPlatformTime::Seconds() - CompileStart;
+        }
+        OutResult.BlueprintStatus = StatusName(WidgetBP->Status);
+        UE_LOG(LogMcpWidgetTreeSpec, Verbose, TEXT("%s: %d created, %d updated, %d replaced, %d deleted, %d moved"),
+            *WidgetBP->GetName(), OutResult.Created, OutResult.Updated, OutResult.Replaced, OutResult.Deleted,
+            OutResult.Moved);
+        return true;
+#else
+        OutError = TEXT("apply_widget_tree requires the editor");
+        OutErrorCode = TEXT("EDITOR_ONLY");
+        return false;
+#endif
+    }
+
+    // Benchmark
+    // =========================================================================
+
+    namespace
+    {
+#if WITH_EDITOR
+        constexpr double PROGRESS_INTERVAL_SECONDS = 0.25;
+
+        /** Game-thread time spent on per-widget steps per tick; one step always runs. */
+        constexpr double BENCHMARK_FRAME_BUDGET_SECONDS = 0.05;
+
+        struct FBenchmarkPhase
+        {
+            int32 Applies = 0;
+            int32 Compiles = 0;
+            double ApplySeconds = 0.0;
+            double CompileSeconds = 0.0;
+            /** Apply and compile time; editor frames between steps are not counted. */
+            double TotalSeconds = 0.0;
+            int32 Widgets = 0;
+            FString Status;
+
+            TSharedPtr<FJsonObject> ToJson() const
+            {
+                TSharedPtr<FJsonObject> Json = MakeShared<FJsonObject>();
+                Json->SetNumberField(TEXT("applies"), Applies);
+                Json->SetNumberField(TEXT("compiles"), Compiles);
+                Json->SetNumberField(TEXT("applyMs"), ApplySeconds * 1000.0);
+                Json->SetNumberField(TEXT("compileMs"), CompileSeconds * 1000.0);
+                Json->SetNumberField(TEXT("totalMs"), TotalSeconds * 1000.0);
+                Json->SetNumberField(TEXT("widgets"), Widgets);
+                Json->SetStringField(TEXT("blueprintStatus"), Status);
+                return Json;
+            }
+        };
+
+        struct FBenchmarkRun
+        {
+            FBenchmarkSettings Settings;
+            FString RunPath;
+            TWeakObjectPtr<UWidgetBlueprint> PerWidgetBP;
+            TWeakObjectPtr<UWidgetBlueprint> SpecBP;
+            TArray<FBenchWidget> Flat;
+            TSharedPtr<FJsonObject> HudSpec;
+            int32 NextIndex = 0;
+            FBenchmarkPhase PerWidget;
+            FBenchmarkPhase Spec;
+            double StartSeconds = 0.0;
+            double LastProgressSeconds = 0.0;
+            FProgressSink OnProgress;
+            FCompletionSink OnComplete;
+        };
+
+        struct FBenchmarkState
+        {
+            TSharedPtr<FBenchmarkRun> Run;
+        };
+
+        FBenchmarkState& GetBenchmarkState()
+        {
+            static FBenchmarkState State;
+            return State;
+        }
+
+        /** Apply Spec without compiling; false with OutError when it fails. */
+        bool ApplyStep(UWidgetBlueprint* WidgetBP, const TSharedPtr<FJsonObject>& Spec, FBenchmarkPhase& Phase,
+                       FString& OutError)
+        {
+            const double Start = FPlatformTime::Seconds();
+            FApplyResult Result;
+            FString ErrorCode;
+            const bool bOk = Apply(WidgetBP, Spec, false, Result, OutError, ErrorCode);
+            Phase.ApplySeconds += Result.ApplySeconds;
+            Phase.TotalSeconds += FPlatformTime::Seconds() - Start;
+            ++Phase.Applies;
+            return bOk;
+        }
+
+        bool CompileStep(UWidgetBlueprint* WidgetBP, FBenchmarkPhase& Phase, FString& OutError)
+        {
+            const double Start = FPlatformTime::Seconds();
+            const bool bOk = McpCompileScheduler::CompileNow(WidgetBP);
+            const double Seconds = FPlatformTime::Seconds() - Start;
+            Phase.CompileSeconds += Seconds;
+            Phase.TotalSeconds += Seconds;
+            ++Phase.Compiles;
+            if (!bOk)
+            {
+                OutError = FString::Printf(TEXT("%s failed to compile"), *WidgetBP->GetName());
+            }
+            return bOk;
+        }
+
+        /**
+         * Report both runs and clean up. ErrorCode / Message describe why the
+         * run stopped early; a run whose trees differ fails too. Only a clean
+         * run reports a speedup.
+         */
+        void FinishBenchmark(const TSharedPtr<FBenchmarkRun>& Run, FString ErrorCode, FString Message)
+        {
+            GetBenchmarkState().Run.Reset();
+
+            if (const UWidgetBlueprint* PerWidgetBP = Run->PerWidgetBP.Get())
+            {
+                Run->PerWidget.Widgets = CountWidgets(*PerWidgetBP);
+                Run->PerWidget.Status = StatusName(PerWidgetBP->Status);
+            }
+            if (const UWidgetBlueprint* SpecBP = Run->SpecBP.Get())
+            {
+                Run->Spec.Widgets = CountWidgets(*SpecBP);
+                Run->Spec.Status = StatusName(SpecBP->Status);
+            }
+            const int32 Expected = Run->Flat.Num();
+            const bool bTreesMatch = Run->PerWidget.Widgets == Expected && Run->Spec.Widgets == Expected;
+            if (ErrorCode.IsEmpty() && !bTreesMatch)
+            {
+                ErrorCode = TEXT("BENCHMARK_FAILED");
+                Message = FString::Printf(TEXT("The runs built %d and %d widgets, expected %d"),
+                    Run->PerWidget.Widgets, Run->Spec.Widgets, Expected);
+            }
+
+            TSharedPtr<FJsonObject> Report = MakeShared<FJsonObject>();
+            Report->SetNumberField(TEXT("widgetCount"), Expected);
+            Report->SetStringField(TEXT("path"), Run->RunPath);
+            Report->SetBoolField(TEXT("compileEach"), Run->Settings.bCompileEach);
+            Report->SetObjectField(TEXT("perWidget"), Run->PerWidget.ToJson());
+            Report->SetObjectField(TEXT("spec"), Run->Spec.ToJson());
+            Report->SetBoolField(TEXT("treesMatch"), bTreesMatch);
+            Report->SetNumberField(TEXT("benchmarkMs"), (FPlatformTime::Seconds() - Run->StartSeconds) * 1000.0);
+            if (ErrorCode.IsEmpty())
+            {
+                const double Speedup = Run->Spec.TotalSeconds > 0.0 ? Run->PerWidget.TotalSeconds / Run->Spec.TotalSeconds : 0.0;
+                Report->SetNumberField(TEXT("speedup"), Speedup);
+                Message = FString::Printf(TEXT("%d widgets: %.0f ms per widget, %.0f ms as one spec (%.1fx)"),
+                    Expected, Run->PerWidget.TotalSeconds * 1000.0, Run->Spec.TotalSeconds * 1000.0, Speedup);
+            }
+            if (Run->Settings.bCleanup)
+            {
+                Report->SetBoolField(TEXT("cleanedUp"), McpSafeOperations::McpSafeDeleteFolder(Run->RunPath));
+            }
+
+            if (Run->OnComplete)
+            {
+                Run->OnComplete(ErrorCode.IsEmpty(), Message, Report, ErrorCode);
+            }
+        }
+#endif // WITH_EDITOR
+    }
+
+    bool StartBenchmark(const FBenchmarkSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                        FString& OutError, FString& OutErrorCode)
+    {
+#if WITH_EDITOR
+        FBenchmarkState& State = GetBenchmarkState();
+        if (State.Run.IsValid())
+        {
+            OutError = TEXT("A widget tree benchmark is already running");
+            OutErrorCode = TEXT("BUSY");
+            return false;
+        }
+        if (Settings.WidgetCount < 1 || Settings.WidgetCount > 1000)
+        {
+            OutError = TEXT("widgetCount must be between 1 and 1000");
+            OutErrorCode = TEXT("INVALID_ARGUMENT");
+            return false;
+        }
+        FString RootPath = Settings.RootPath;
+        RootPath.RemoveFromEnd(TEXT("/"));
+        if (!RootPath.StartsWith(TEXT("/Game/")))
+        {
+            OutError = TEXT("path must be a folder under /Game/");
+            OutErrorCode = TEXT("INVALID_ARGUMENT");
+            return false;
+        }
+
+        TSharedPtr<FBenchmarkRun> Run = MakeShared<FBenchmarkRun>();
+        Run->Settings = Settings;
+        Run->RunPath = RootPath / FString::Printf(TEXT("Run_%s"),
+            *FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(8));
+        auto CreateWidgetBlueprint = [&Run](const TCHAR* Name) -> UWidgetBlueprint*
+        {
+            UPackage* Package = CreatePackage(*(Run->RunPath / Name));
+            return Package ? Cast<UWidgetBlueprint>(FKismetEditorUtilities::CreateBlueprint(
+                UUserWidget::StaticClass(), Package, Name, BPTYPE_Normal,
+                UWidgetBlueprint::StaticClass(), UWidgetBlueprintGeneratedClass::StaticClass())) : nullptr;
+        };
+        Run->PerWidgetBP = CreateWidgetBlueprint(TEXT("WBP_PerWidget"));
+        Run->SpecBP = CreateWidgetBlueprint(TEXT("WBP_Spec"));
+        if (!Run->PerWidgetBP.IsValid() || !Run->SpecBP.IsValid())
+        {
+            if (Settings.bCleanup)
+            {
+                McpSafeOperations::McpSafeDeleteFolder(Run->RunPath);
+            }
+            OutError = TEXT("Failed to create benchmark widget blueprints");
+            OutErrorCode = TEXT("CREATION_FAILED");
+            return false;
+        }
+
+        Run->HudSpec = BuildBenchmarkHud(Settings.WidgetCount, Run->Flat);
+        Run->StartSeconds = FPlatformTime::Seconds();
+        Run->LastProgressSeconds = Run->StartSeconds;
+        Run->OnProgress = MoveTemp(OnProgress);
+        Run->OnComplete = MoveTemp(OnComplete);
+        State.Run = Run;
+        UE_LOG(LogMcpWidgetTreeSpec, Log, TEXT("Widget tree benchmark: %d widgets in %s"), Run->Flat.Num(), *Run->RunPath);
+        return true;
+#else
+        OutError = TEXT("benchmark_widget_tree requires the editor");
+        OutErrorCode = TEXT("EDITOR_ONLY");
+        return false;
+#endif
+    }
+
+    bool IsBenchmarkRunning()
+    {
+#if WITH_EDITOR
+        return GetBenchmarkState().Run.IsValid();
+#else
+        return false;
+#endif
+    }
+
+    void CancelAll()
+    {
+#if WITH_EDITOR
+        TSharedPtr<FBenchmarkRun> Run = MoveTemp(GetBenchmarkState().Run);
+        if (Run.IsValid())
+        {
+            // The benchmark blueprints were never saved; they go away with the editor
+            Run->OnProgress = nullptr;
+            Run->OnComplete = nullptr;
+        }
+#endif
+    }
+
+    void Tick()
+    {
+#if WITH_EDITOR
+        TSharedPtr<FBenchmarkRun> Run = GetBenchmarkState().Run;
+        if (!Run.IsValid())
+        {
+            return;
+        }
+        UWidgetBlueprint* PerWidgetBP = Run->PerWidgetBP.Get();
+        UWidgetBlueprint* SpecBP = Run->SpecBP.Get();
+        if (!PerWidgetBP || !SpecBP)
+        {
+            FinishBenchmark(Run, TEXT("BENCHMARK_FAILED"), TEXT("The benchmark widget blueprints were deleted"));
+            return;
+        }
+
+        const double Now = FPlatformTime::Seconds();
+        if (Now - Run->StartSeconds >= Run->Settings.TimeoutSeconds)
+        {
+            FinishBenchmark(Run, TEXT("TIMEOUT"), FString::Printf(
+                TEXT("Benchmark stopped after %.0f s with %d of %d per-widget applies done"),
+                Run->Settings.TimeoutSeconds, Run->NextIndex, Run->Flat.Num()));
+            return;
+        }
+
+        FString Error;
+        const int32 Count = Run->Flat.Num();
+        if (Run->NextIndex < Count)
+        {
+            // Per widget: one apply (and compile) per widget, as a script of add_* calls does
+            const double Deadline = Now + BENCHMARK_FRAME_BUDGET_SECONDS;
+            do
+            {
+                const int32 Index = Run->NextIndex++;
+                const bool bCompile = Run->Settings.bCompileEach || Index == Count - 1;
+                if (!ApplyStep(PerWidgetBP, BuildSingleWidgetSpec(Run->Flat, Index), Run->PerWidget, Error) ||
+                    (bCompile && !CompileStep(PerWidgetBP, Run->PerWidget, Error)))
+                {
+                    FinishBenchmark(Run, TEXT("BENCHMARK_FAILED"),
+                        FString::Printf(TEXT("Per-widget run failed at widget %d: %s"), Index, *Error));
+                    return;
+                }
+            }
+            while (Run->NextIndex < Count && FPlatformTime::Seconds() < Deadline);
+
+            const double After = FPlatformTime::Seconds();
+            if (Run->OnProgress && After - Run->LastProgressSeconds >= PROGRESS_INTERVAL_SECONDS)
+            {
+                Run->LastProgressSeconds = After;
+                Run->OnProgress(95.0f * Run->NextIndex / Count,
+                    FString::Printf(TEXT("Per-widget run: %d of %d widgets"), Run->NextIndex, Count));
+            }
+            return;
+        }
+
+        // Spec: the whole tree in one apply and one compile, on a tick of its own
+        if (!ApplyStep(SpecBP, Run->HudSpec, Run->Spec, Error) || !CompileStep(SpecBP, Run->Spec, Error))
+        {
+            FinishBenchmark(Run, TEXT("BENCHMARK_FAILED"), FString::Printf(TEXT("Spec run failed: %s"), *Error));
+            return;
+        }
+        FinishBenchmark(Run, FString(), FString());
+#endif
+    }
+}
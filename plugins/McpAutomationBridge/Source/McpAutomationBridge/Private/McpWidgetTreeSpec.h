@@ -0,0 +1,137 @@
+// =============================================================================
+// McpWidgetTreeSpec.h
+// =============================================================================
+// Declarative widget trees for manage_widget_authoring apply_widget_tree.
+//
+// The add_* / set_* / bind_* widget actions change one widget per request;
+// each one reloads the widget Blueprint, searches its tree and marks it
+// structurally modified, which regenerates the skeleton class. A spec
+// describes the whole tree instead; Apply diffs it against the widget tree
+// in one transaction:
+//
+//   - widgets are matched by name (the widget's variable name); a matched
+//     widget of another class is replaced, missing ones are constructed
+//   - children are placed under their spec parent in spec order. Widgets
+//     that are reparented or reordered get a new slot, so their slot
+//     settings come from the spec only.
+//   - properties, slot settings and bindings are written for the widgets
+//     that list them; unlisted values are left alone
+//   - widgets the spec does not mention stay where they are, unless their
+//     subtree loses its place (old root, child of a replaced widget, content
+//     of a single-child panel). With prune, all of them are removed.
+//
+// The Blueprint is marked modified once and compiled once at the end (the
+// compile follows McpCompileScheduler like any other edit).
+//
+// SPEC:
+//   {
+//     "root": WIDGET,
+//     "prune": false
+//   }
+//   WIDGET = {
+//     "name", "type": "CanvasPanel" | "TextBlock" | <UWidget class or widget BP class path>,
+//     "isVariable", "visibility", "text",
+//     "properties": { "<Property>": value },
+//     "slot": { canvas: "anchors" (preset | {minimum, maximum}), "position",
+//               "size", "alignment", "autoSize", "zOrder";
+//               box / overlay: "padding", "horizontalAlignment",
+//               "verticalAlignment", "size" ("Auto" | "Fill" | fill weight);
+//               any other slot property by name },
+//     "bindings": { "<Property>": "<function in the widget Blueprint>" },
+//     "children": [ WIDGET ]
+//   }
+//
+// All functions are game-thread only.
+//
+// Copyright (c) 2025 MCP Automation Bridge Contributors
+// SPDX-License-Identifier: MIT
+// =============================================================================
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UWidgetBlueprint;
+
+namespace McpWidgetTreeSpec
+{
+    struct FApplyResult
+    {
+        int32 Created = 0;
+        int32 Updated = 0;
+        int32 Replaced = 0;
+        int32 Deleted = 0;
+        int32 Moved = 0;
+        int32 PropertiesSet = 0;
+        int32 SlotValuesSet = 0;
+        int32 BindingsSet = 0;
+        int32 BindingsRemoved = 0;
+
+        /** McpSafeCompileBlueprint ran (false with compile: false). */
+        bool bCompileRequested = false;
+
+        /** The compile was deferred to McpCompileScheduler. */
+        bool bCompileDeferred = false;
+
+        /** Blueprint status after the compile: upToDate, dirty, error, ... */
+        FString BlueprintStatus;
+
+        double ApplySeconds = 0.0;
+        double CompileSeconds = 0.0;
+
+        /** Widget name -> { class, parent, slot } for every spec widget. */
+        TSharedPtr<FJsonObject> Widgets;
+
+        /** Non-fatal problems: unknown properties, unbindable properties, removed extras. */
+        TArray<FString> Warnings;
+
+        TSharedPtr<FJsonObject> ToJson() const;
+    };
+
+    /**
+     * Diff Spec against the widget tree of WidgetBP and apply it in one
+     * transaction, then compile once (unless bCompile is false). Names,
+     * widget classes and the tree shape are validated before anything
+     * changes; on failure nothing is modified and OutError / OutErrorCode
+     * describe the problem.
+     */
+    bool Apply(UWidgetBlueprint* WidgetBP, const TSharedPtr<FJsonObject>& Spec, bool bCompile,
+               FApplyResult& OutResult, FString& OutError, FString& OutErrorCode);
+
+    struct FBenchmarkSettings
+    {
+        int32 WidgetCount = 80;
+        /** /Game folder for the two temporary widget Blueprints. */
+        FString RootPath = TEXT("/Game/McpWidgetTreeBenchmark");
+        /** Compile after every widget in the per-widget run; false only regenerates the skeleton, as add_* does. */
+        bool bCompileEach = true;
+        bool bCleanup = true;
+        /** Upper bound for the whole run. */
+        double TimeoutSeconds = 240.0;
+    };
+
+    using FProgressSink = TFunction<void(float Percent, const FString& Message)>;
+    using FCompletionSink = TFunction<void(bool bSuccess, const FString& Message,
+                                           const TSharedPtr<FJsonObject>& Result, const FString& ErrorCode)>;
+
+    /**
+     * Build the same generated HUD (root canvas, stat panels with labels,
+     * bars and icons) in two fresh widget Blueprints: once with one apply per
+     * widget, as the add_* actions are used, and once with a single apply and
+     * compile. The per-widget run advances over editor ticks within a frame
+     * budget, with progress. OnComplete gets both timings; a failed apply or
+     * compile, differing trees or the timeout fail the run and leave out the
+     * speedup. Returns false with OutError / OutErrorCode when it cannot start.
+     */
+    bool StartBenchmark(const FBenchmarkSettings& Settings, FProgressSink OnProgress, FCompletionSink OnComplete,
+                        FString& OutError, FString& OutErrorCode);
+
+    bool IsBenchmarkRunning();
+
+    /** Drop the benchmark (subsystem shutdown). Completion is not reported. */
+    void CancelAll();
+
+    /** Advance the benchmark. Called from the subsystem ticker. */
+    void Tick();
+}
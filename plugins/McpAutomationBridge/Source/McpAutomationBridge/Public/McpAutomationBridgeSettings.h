@@ -160,6 +160,57 @@ public:
                 MultiLine = "true"))
     FString NativeMCPInstructions;
 
+    // ── Asset Saving ────────────────────────────────────────────────────
+
+    /** Collect asset saves made by handlers and write them in one batched save
+     * when the bridge goes idle, instead of saving and rescanning per operation.
+     * Level saves, map loads and manage_asset flush_saves always flush first. */
+    UPROPERTY(config, EditAnywhere, Category = "Asset Saving",
+        meta = (DisplayName = "Coalesce Asset Saves"))
+    bool bCoalesceAssetSaves = true;
+
+    /** Seconds without a new automation request before queued saves are flushed. */
+    UPROPERTY(config, EditAnywhere, Category = "Asset Saving",
+        meta = (DisplayName = "Idle Flush Delay", EditCondition = "bCoalesceAssetSaves",
+                ClampMin = "0.0", ClampMax = "30.0"))
+    float SaveFlushIdleSeconds = 0.5f;
+
+    /** Flush as soon as this many packages are queued, even while requests keep arriving. */
+    UPROPERTY(config, EditAnywhere, Category = "Asset Saving",
+        meta = (DisplayName = "Max Queued Packages", EditCondition = "bCoalesceAssetSaves",
+                ClampMin = "1"))
+    int32 MaxPendingAssetSaves = 256;
+
+    // ── Blueprint Compilation ───────────────────────────────────────────
+
+    /** Defer the compile after Blueprint edits (add variable, add component, set
+     * default, replication, RPCs) and compile each edited Blueprint once, when
+     * the bridge goes idle or before a request that needs the compiled class. */
+    UPROPERTY(config, EditAnywhere, Category = "Blueprint Compilation",
+        meta = (DisplayName = "Batch Blueprint Compiles"))
+    bool bBatchBlueprintCompiles = true;
+
+    /** Seconds without a new automation request before deferred compiles run. */
+    UPROPERTY(config, EditAnywhere, Category = "Blueprint Compilation",
+        meta = (DisplayName = "Idle Compile Delay", EditCondition = "bBatchBlueprintCompiles",
+                ClampMin = "0.0", ClampMax = "30.0"))
+    float CompileFlushIdleSeconds = 0.5f;
+
+    // ── Navigation ──────────────────────────────────────────────────────
+
+    /** Pause navmesh building while automation requests keep arriving and
+     * rebuild the dirty tiles once when the bridge goes idle, instead of once
+     * per placed, moved or deleted actor. */
+    UPROPERTY(config, EditAnywhere, Category = "Navigation",
+        meta = (DisplayName = "Batch Navmesh Rebuilds"))
+    bool bBatchNavigationRebuilds = true;
+
+    /** Seconds without a new automation request before paused navmesh building resumes. */
+    UPROPERTY(config, EditAnywhere, Category = "Navigation",
+        meta = (DisplayName = "Idle Rebuild Delay", EditCondition = "bBatchNavigationRebuilds",
+                ClampMin = "0.0", ClampMax = "30.0"))
+    float NavRebuildIdleSeconds = 0.5f;
+
     virtual FName GetCategoryName() const override { return FName(TEXT("Plugins")); }
     virtual FText GetSectionText() const override;
 
@@ -370,6 +370,10 @@ private:
   bool HandleBlueprintAction(const FString &RequestId, const FString &Action,
                              const TSharedPtr<FJsonObject> &Payload,
                              TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleBenchmarkBlueprintCompiles(
+      const FString &RequestId, const FString &Action,
+      const TSharedPtr<FJsonObject> &Payload,
+      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   bool HandleSequenceAction(const FString &RequestId, const FString &Action,
                             const TSharedPtr<FJsonObject> &Payload,
                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
@@ -550,6 +554,17 @@ private:
   HandleRebuildMaterial(const FString &RequestId, const FString &Action,
                         const TSharedPtr<FJsonObject> &Payload,
                         TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  // Coalesced asset save queue (McpSaveCoordinator)
+  bool HandleFlushSaves(const FString &RequestId, const FString &Action,
+                        const TSharedPtr<FJsonObject> &Payload,
+                        TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleGetSaveQueue(const FString &RequestId, const FString &Action,
+                          const TSharedPtr<FJsonObject> &Payload,
+                          TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool
+  HandleBenchmarkAssetSaves(const FString &RequestId, const FString &Action,
+                            const TSharedPtr<FJsonObject> &Payload,
+                            TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   // Landscape, foliage, and Niagara handlers
   bool HandleCreateLandscape(const FString &RequestId, const FString &Action,
                              const TSharedPtr<FJsonObject> &Payload,
@@ -664,6 +679,14 @@ private:
   HandleSystemControlAction(const FString &RequestId, const FString &Action,
                             const TSharedPtr<FJsonObject> &Payload,
                             TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  // Background process jobs (run_ubt, run_tests, get_ubt_job, cancel_ubt_job,
+  // list_ubt_jobs), shared by system_control, manage_pipeline and
+  // manage_tests. bWaitByDefault selects whether run_ubt responds on
+  // completion or as soon as the job is queued; run_tests waits only on request.
+  bool HandleUbtJobAction(const FString &RequestId, const FString &SubAction,
+                          const TSharedPtr<FJsonObject> &Payload,
+                          TSharedPtr<FMcpBridgeWebSocket> RequestingSocket,
+                          bool bWaitByDefault);
   bool
   HandleConsoleCommandAction(const FString &RequestId, const FString &Action,
                              const TSharedPtr<FJsonObject> &Payload,
@@ -769,6 +792,9 @@ private:
   bool HandlePruneWeights(const FString &RequestId,
                           const TSharedPtr<FJsonObject> &Payload,
                           TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
+  bool HandleProcessSkinWeights(const FString &RequestId,
+                                const TSharedPtr<FJsonObject> &Payload,
+                                TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
   bool HandleBindClothToSkeletalMesh(const FString &RequestId,
                                      const TSharedPtr<FJsonObject> &Payload,
                                      TSharedPtr<FMcpBridgeWebSocket> RequestingSocket);
@@ -1008,6 +1034,9 @@ private:
   bool HandleSequenceAddKeyframe(const FString &RequestId,
                                  const TSharedPtr<FJsonObject> &Payload,
                                  TSharedPtr<FMcpBridgeWebSocket> Socket);
+  bool HandleSequenceSetKeys(const FString &RequestId,
+                             const TSharedPtr<FJsonObject> &Payload,
+                             TSharedPtr<FMcpBridgeWebSocket> Socket);
 
   // Control handlers
   AActor *FindActorByName(const FString &Target, bool bExactMatchOnly = false);
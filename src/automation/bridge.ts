@@ -27,6 +27,7 @@ import { RequestTracker } from './request-tracker.js';
 import { HandshakeHandler } from './handshake.js';
 import { MessageHandler } from './message-handler.js';
 import { automationMessageSchema } from './message-schema.js';
+import { isViewportFrame, parseViewportFrame, type ViewportFrame } from './viewport-frame.js';
 import { config } from '../config.js';
 
 const require = createRequire(import.meta.url);
@@ -70,6 +71,7 @@ export class AutomationBridge extends EventEmitter {
     private lastError?: { message: string; at: Date };
      
     private queuedRequestItems: QueuedRequestItem[] = [];
+    private latestViewportFrames = new Map<string, ViewportFrame>();
     private connectionPromise?: Promise<void>;
     private connectionLock = false;
 
@@ -442,7 +444,7 @@ export class AutomationBridge extends EventEmitter {
                     return '';
                 };
 
-                        socket.on('message', (data) => {
+                        socket.on('message', (data, isBinary) => {
                     try {
                         const byteLength = getRawDataByteLength(data);
                         if (byteLength > MAX_WS_MESSAGE_SIZE_BYTES) {
@@ -452,6 +454,12 @@ export class AutomationBridge extends EventEmitter {
                             return;
                         }
 
+                        // Viewport stream frames arrive as binary messages and bypass JSON parsing
+                        if (isBinary && Buffer.isBuffer(data) && isViewportFrame(data)) {
+                            this.handleViewportFrame(data);
+                            return;
+                        }
+
                         const text = rawDataToUtf8String(data, byteLength);
                         this.log.debug(`[AutomationBridge Client] Received message: ${text.substring(0, 1000)}`);
                         const parsed = JSON.parse(text) as AutomationBridgeMessage;
@@ -800,6 +808,37 @@ export class AutomationBridge extends EventEmitter {
         return sentCount > 0;
     }
 
+    private handleViewportFrame(data: Buffer): void {
+        const frame = parseViewportFrame(data);
+        if (!frame) {
+            this.log.warn('Dropped malformed viewport frame');
+            return;
+        }
+        // Copy out of the socket's receive buffer; only the latest frame per stream is kept
+        frame.data = Buffer.from(frame.data);
+        this.latestViewportFrames.set(frame.streamId, frame);
+        this.emitAutomation('viewportFrame', frame);
+    }
+
+    /** Most recent frame received for a viewport stream (any stream when omitted). */
+    getLatestViewportFrame(streamId?: string): ViewportFrame | undefined {
+        if (streamId) {
+            return this.latestViewportFrames.get(streamId);
+        }
+        let latest: ViewportFrame | undefined;
+        for (const frame of this.latestViewportFrames.values()) {
+            if (!latest || frame.receivedAt > latest.receivedAt) {
+                latest = frame;
+            }
+        }
+        return latest;
+    }
+
+    /** Forget buffered frames for a stream once it has been unsubscribed. */
+    clearViewportFrames(streamId: string): void {
+        this.latestViewportFrames.delete(streamId);
+    }
+
     private emitAutomation<K extends keyof AutomationBridgeEvents>(
         event: K,
         ...args: Parameters<AutomationBridgeEvents[K]>
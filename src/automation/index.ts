@@ -1,2 +1,3 @@
 export { AutomationBridge } from './bridge.js';
 export * from './types.js';
+export * from './viewport-frame.js';
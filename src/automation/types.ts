@@ -1,4 +1,5 @@
 import { WebSocket } from 'ws';
+import type { ViewportFrame } from './viewport-frame.js';
 
 export interface AutomationBridgeOptions {
     host?: string;
@@ -142,4 +143,5 @@ export type AutomationBridgeEvents = {
     message: (message: AutomationBridgeMessage) => void;
     error: (error: Error & { port?: number }) => void;
     handshakeFailed: (info: { reason: string; port: number }) => void;
+    viewportFrame: (frame: ViewportFrame) => void;
 };
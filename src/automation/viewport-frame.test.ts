@@ -0,0 +1,52 @@
+import { describe, it, expect } from 'vitest';
+import { isViewportFrame, parseViewportFrame } from './viewport-frame.js';
+
+function buildFrame(header: Record<string, unknown> | string, image: Buffer): Buffer {
+    const headerBytes = Buffer.from(typeof header === 'string' ? header : JSON.stringify(header), 'utf8');
+    const prefix = Buffer.alloc(8);
+    prefix.write('MCPV', 0, 'latin1');
+    prefix.writeUInt32LE(headerBytes.length, 4);
+    return Buffer.concat([prefix, headerBytes, image]);
+}
+
+describe('parseViewportFrame', () => {
+    it('parses header fields and image bytes', () => {
+        const image = Buffer.from([0xff, 0xd8, 0xff, 0xe0]);
+        const frame = parseViewportFrame(buildFrame({
+            event: 'viewport_frame',
+            streamId: 'abc123',
+            sequence: 7,
+            timestamp: 1700000000000,
+            width: 1280,
+            height: 720,
+            mimeType: 'image/jpeg',
+            encodeMs: 4.5,
+            dropped: 2
+        }, image));
+
+        expect(frame).not.toBeNull();
+        expect(frame?.streamId).toBe('abc123');
+        expect(frame?.sequence).toBe(7);
+        expect(frame?.width).toBe(1280);
+        expect(frame?.height).toBe(720);
+        expect(frame?.mimeType).toBe('image/jpeg');
+        expect(frame?.dropped).toBe(2);
+        expect(frame?.data.equals(image)).toBe(true);
+    });
+
+    it('rejects buffers without the magic prefix', () => {
+        expect(isViewportFrame(Buffer.from('{"type":"automation_response"}'))).toBe(false);
+        expect(parseViewportFrame(Buffer.from('not a frame at all'))).toBeNull();
+    });
+
+    it('rejects a header length past the end of the buffer', () => {
+        const frame = buildFrame({ streamId: 'abc' }, Buffer.alloc(0));
+        frame.writeUInt32LE(1000, 4);
+        expect(parseViewportFrame(frame)).toBeNull();
+    });
+
+    it('rejects malformed or anonymous headers', () => {
+        expect(parseViewportFrame(buildFrame('{oops', Buffer.alloc(4)))).toBeNull();
+        expect(parseViewportFrame(buildFrame({ sequence: 1 }, Buffer.alloc(4)))).toBeNull();
+    });
+});
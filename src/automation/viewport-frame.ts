@@ -0,0 +1,68 @@
+/**
+ * Binary viewport stream frames sent by the plugin for subscribe_viewport_stream.
+ *
+ * Layout: 'MCPV' magic (4 bytes), uint32 little-endian header length,
+ * UTF-8 JSON header, then the encoded image bytes.
+ */
+
+const VIEWPORT_FRAME_MAGIC = 'MCPV';
+const VIEWPORT_FRAME_PREFIX_BYTES = 8;
+
+export interface ViewportFrame {
+    streamId: string;
+    sequence: number;
+    timestamp: number;
+    width: number;
+    height: number;
+    mimeType: string;
+    readbackMs?: number;
+    encodeMs?: number;
+    dropped?: number;
+    data: Buffer;
+    receivedAt: Date;
+}
+
+/** True if the buffer starts with the viewport frame magic. */
+export function isViewportFrame(data: Buffer): boolean {
+    return data.length >= VIEWPORT_FRAME_PREFIX_BYTES
+        && data.toString('latin1', 0, 4) === VIEWPORT_FRAME_MAGIC;
+}
+
+/** Parse a binary viewport frame; returns null when the buffer is malformed. */
+export function parseViewportFrame(data: Buffer): ViewportFrame | null {
+    if (!isViewportFrame(data)) {
+        return null;
+    }
+
+    const headerLength = data.readUInt32LE(4);
+    const headerEnd = VIEWPORT_FRAME_PREFIX_BYTES + headerLength;
+    if (headerEnd > data.length) {
+        return null;
+    }
+
+    let header: Record<string, unknown>;
+    try {
+        header = JSON.parse(data.toString('utf8', VIEWPORT_FRAME_PREFIX_BYTES, headerEnd)) as Record<string, unknown>;
+    } catch {
+        return null;
+    }
+    if (typeof header.streamId !== 'string' || header.streamId.length === 0) {
+        return null;
+    }
+
+    const num = (value: unknown): number | undefined => (typeof value === 'number' && Number.isFinite(value) ? value : undefined);
+
+    return {
+        streamId: header.streamId,
+        sequence: num(header.sequence) ?? 0,
+        timestamp: num(header.timestamp) ?? Date.now(),
+        width: num(header.width) ?? 0,
+        height: num(header.height) ?? 0,
+        mimeType: typeof header.mimeType === 'string' ? header.mimeType : 'application/octet-stream',
+        readbackMs: num(header.readbackMs),
+        encodeMs: num(header.encodeMs),
+        dropped: num(header.dropped),
+        data: data.subarray(headerEnd),
+        receivedAt: new Date()
+    };
+}
@@ -10,16 +10,29 @@ import { commonSchemas } from './tool-definition-utils.js';
 export const consolidatedToolDefinitions: ToolDefinition[] = [
   {
     name: 'manage_pipeline',
-    description: 'Build automation and pipeline control. Actions: run_ubt (compile targets), list_categories (show tool categories), get_status (bridge status). Routes to system_control internally.',
+    description: 'Build automation and pipeline control. Actions: run_ubt (compile targets as a background job), get_ubt_job / cancel_ubt_job / list_ubt_jobs (follow or stop builds), list_categories (show tool categories), get_status (bridge status). Routes to system_control internally.',
     category: 'core',
     inputSchema: {
       type: 'object',
       properties: {
-        action: { type: 'string', enum: ['run_ubt', 'list_categories', 'get_status'], description: 'run_ubt: compile with UnrealBuildTool. list_categories: show available tool categories. get_status: get bridge status.' },
+        action: { type: 'string', enum: ['run_ubt', 'get_ubt_job', 'cancel_ubt_job', 'list_ubt_jobs', 'list_categories', 'get_status'], description: 'run_ubt: compile with UnrealBuildTool. get_ubt_job: job state, new output lines and diagnostics. cancel_ubt_job: terminate a build. list_ubt_jobs: recent builds. list_categories: show available tool categories. get_status: get bridge status.' },
         target: { type: 'string', description: 'Build target name (e.g., MyProjectEditor)' },
         platform: { type: 'string', description: 'Target platform (Win64, Linux, Mac)' },
         configuration: { type: 'string', description: 'Build configuration (Development, Shipping, Debug)' },
-        arguments: { type: 'string', description: 'Additional UBT arguments' }
+        arguments: { type: 'string', description: 'Additional UBT arguments' },
+        wait: { type: 'boolean', description: 'run_ubt: wait for the build to finish (default true); false returns a jobId immediately.' },
+        timeoutSeconds: { type: 'number', description: 'run_ubt: terminate the build after this many seconds (default 3600).' },
+        jobId: { type: 'string', description: 'UBT job id returned by run_ubt.' },
+        sinceLine: { type: 'integer', description: 'get_ubt_job: first output line to return (use the previous nextLine).' },
+        maxLines: { type: 'integer', description: 'get_ubt_job: maximum output lines to return (default 200).' },
+        fileName: { type: 'string', description: 'snapshot_trace: output file name in Saved/Profiling (default Snapshot_<timestamp>).' },
+        filePath: { type: 'string', description: 'analyze_trace: trace name from list_traces, project-relative .utrace path, or "latest" (default).' },
+        startSeconds: { type: 'number', description: 'analyze_trace: start of the analysis window in trace seconds.' },
+        endSeconds: { type: 'number', description: 'analyze_trace: end of the analysis window (default: end of trace).' },
+        topTimers: { type: 'integer', description: 'analyze_trace: timers returned by inclusive time (default 25).' },
+        maxCounters: { type: 'integer', description: 'analyze_trace: counters returned (default 100).' },
+        counterFilter: { type: 'string', description: 'analyze_trace: only counters whose name contains this text.' },
+        limit: { type: 'integer', description: 'list_traces: maximum files returned, newest first (default 50).' }
       },
       required: ['action']
     },
@@ -28,7 +41,24 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
       properties: {
         ...commonSchemas.outputBase,
         output: { type: 'string', description: 'Build output' },
-        command: { type: 'string', description: 'Executed command' }
+        command: { type: 'string', description: 'Executed command' },
+        jobId: { type: 'string', description: 'Bridge-side UBT job id' },
+        state: { type: 'string', description: 'queued, running, succeeded, failed, cancelled or timed_out' },
+        diagnostics: {
+          type: 'array',
+          items: {
+            type: 'object',
+            properties: {
+              severity: { type: 'string' },
+              file: { type: 'string' },
+              line: { type: 'integer' },
+              column: { type: 'integer' },
+              code: { type: 'string' },
+              message: { type: 'string' }
+            }
+          },
+          description: 'Compiler, linker and UBT errors/warnings parsed from the output'
+        }
       }
     }
   },
@@ -74,7 +104,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'get_dependencies', 'get_source_control_state', 'analyze_graph', 'get_asset_graph', 'create_thumbnail', 'set_tags', 'get_metadata', 'set_metadata', 'validate', 'fixup_redirectors', 'find_by_tag', 'generate_report',
             'create_material', 'create_material_instance', 'create_render_target', 'generate_lods', 'add_material_parameter', 'list_instances', 'reset_instance_parameters', 'exists', 'get_material_stats',
             'nanite_rebuild_mesh', 'bulk_rename', 'bulk_delete', 'source_control_checkout', 'source_control_submit',
-            'add_material_node', 'connect_material_pins', 'remove_material_node', 'break_material_connections', 'get_material_node_details', 'rebuild_material'
+            'add_material_node', 'connect_material_pins', 'remove_material_node', 'break_material_connections', 'get_material_node_details', 'rebuild_material',
+            'flush_saves', 'get_save_queue', 'benchmark_asset_saves'
           ],
           description: 'Action to perform'
         },
@@ -158,7 +189,12 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         inputPin: commonSchemas.targetPin,
         type: commonSchemas.stringProp,
         defaultValue: commonSchemas.value,
-        expressionIndex: commonSchemas.nodeId
+        expressionIndex: commonSchemas.nodeId,
+        // Save queue
+        flushSaves: { type: 'boolean', description: 'Write queued asset saves and save this request\'s assets before responding.' },
+        includePackages: { type: 'boolean', description: 'get_save_queue: list queued package names (default true).' },
+        count: { type: 'integer', description: 'benchmark_asset_saves: assets to author per mode (default 200, max 2000).' },
+        cleanup: { type: 'boolean', description: 'benchmark_asset_saves: delete the benchmark folder afterwards (default true).' }
       },
       required: ['action']
     },
@@ -191,7 +227,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'add_component', 'set_default', 'modify_scs', 'get_scs', 'add_scs_component', 'remove_scs_component', 'reparent_scs_component', 'set_scs_transform', 'set_scs_property',
             'ensure_exists', 'probe_handle', 'add_variable', 'remove_variable', 'rename_variable', 'add_function', 'add_event', 'remove_event', 'add_construction_script', 'set_variable_metadata', 'set_metadata',
             'create_node', 'add_node', 'delete_node', 'connect_pins', 'break_pin_links', 'set_node_property', 'create_reroute_node', 'get_node_details', 'get_graph_details', 'get_pin_details',
-            'list_node_types', 'set_pin_default_value'
+            'list_node_types', 'set_pin_default_value', 'apply_graph',
+            'flush_compiles', 'get_compile_queue', 'benchmark_compiles'
           ],
           description: 'Blueprint action'
         },
@@ -272,7 +309,18 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         fromPinName: commonSchemas.sourcePin,
         toNodeId: commonSchemas.targetNodeId,
         toPin: commonSchemas.targetPin,
-        toPinName: commonSchemas.targetPin
+        toPinName: commonSchemas.targetPin,
+        // Compile queue (flush_compiles, get_compile_queue, benchmark_compiles)
+        includeBlueprints: { type: 'boolean', description: 'get_compile_queue: list the Blueprints waiting to compile (default true).' },
+        edits: { type: 'integer', description: 'benchmark_compiles: scripted edits per mode (1-300, default 30).' },
+        path: { type: 'string', description: 'benchmark_compiles: /Game folder for the temporary Blueprints.' },
+        cleanup: { type: 'boolean', description: 'benchmark_compiles: delete the temporary Blueprints afterwards (default true).' },
+        // Declarative graph (apply_graph)
+        spec: {
+          type: 'object',
+          description: 'apply_graph: full graph spec { nodes: [{ key, type, x, y, comment, function ("Class.Function") | memberName + memberClass, variableName, eventName, targetClass, inputAxisName, pins: { InputPin: default } }], links: [{ from: "key.Pin", to: "key.Pin" }], prune }. Keys map to stable node IDs across applies.'
+        },
+        prune: { type: 'boolean', description: 'apply_graph: remove deletable nodes the spec does not list (default false).' }
       },
       required: ['action']
     },
@@ -281,7 +329,9 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
       properties: {
         ...commonSchemas.outputBase,
         blueprintPath: commonSchemas.blueprintPath,
-        blueprint: { oneOf: [{ type: 'object' }, { type: 'string' }], description: 'Blueprint data object or path string.' }
+        blueprint: { oneOf: [{ type: 'object' }, { type: 'string' }], description: 'Blueprint data object or path string.' },
+        apply: { type: 'object', description: 'apply_graph: created/updated/replaced/deleted/linked/unlinked counts, compile state and warnings.' },
+        nodeIds: { type: 'object', description: 'apply_graph: spec key -> { nodeId, nodeName, nodeClass }.' }
       }
     }
   },
@@ -633,6 +683,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_pose_library',
             'create_animation_asset', 'create_animation_sequence',
             'set_sequence_length', 'add_bone_track', 'set_bone_key', 'set_curve_key',
+            'set_bone_track_keys', 'set_curves',
             'create_montage', 'add_montage_section', 'add_montage_slot',
             'set_section_timing', 'add_montage_notify', 'set_blend_in', 'set_blend_out',
             'link_sections', 'add_notify', 'play_montage', 'play_anim_montage',
@@ -683,6 +734,40 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         scale: commonSchemas.scale,
         value: commonSchemas.value,
         enabled: commonSchemas.enabled,
+        assetPath: commonSchemas.assetPath,
+        tracks: {
+          type: 'array',
+          description: 'set_bone_track_keys: packed keys per bone.',
+          items: {
+            type: 'object',
+            properties: {
+              boneName: commonSchemas.boneName,
+              positions: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'x, y, z per key (base64 little-endian float32 or number array).' },
+              rotations: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'x, y, z, w per key, or pitch, yaw, roll with rotationFormat euler.' },
+              scales: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'x, y, z per key. A single key holds for the whole sequence.' }
+            }
+          }
+        },
+        curves: {
+          type: 'array',
+          description: 'set_curves / set_bone_track_keys: packed float curves.',
+          items: {
+            type: 'object',
+            properties: {
+              curveName: commonSchemas.stringProp,
+              values: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'One value per key (base64 little-endian float32 or number array).' },
+              times: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'Key times in seconds (optional).' },
+              frames: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'Key frames (optional; defaults to 0, 1, 2...).' },
+              interpolation: { type: 'string', enum: ['cubic', 'linear', 'constant'], description: 'Key interpolation (cubic by default).' }
+            }
+          }
+        },
+        rotationFormat: { type: 'string', enum: ['quat', 'euler'], description: 'Layout of set_bone_track_keys rotations (quat by default).' },
+        numFrames: { type: 'number', description: 'Resize the sequence to this many frames (default: longest track).' },
+        frameRate: { type: 'number', description: 'Sampling frame rate to set before writing.' },
+        createIfMissing: { type: 'boolean', description: 'Create curves that do not exist yet.' },
+        recompress: { type: 'boolean', description: 'Request one asynchronous recompression after writing (default true).' },
+        save: commonSchemas.save,
         rigPath: commonSchemas.assetPath,
         chainName: commonSchemas.stringProp,
         startBone: commonSchemas.boneName,
@@ -731,7 +816,10 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'run_ubt', 'run_tests', 'subscribe', 'unsubscribe', 'spawn_category', 'start_session', 'lumen_update_scene',
             'play_sound', 'create_widget', 'show_widget', 'add_widget_child',
             'set_cvar', 'get_project_settings', 'validate_assets',
-            'set_project_setting', 'execute_python'
+            'set_project_setting', 'execute_python',
+            'subscribe_viewport_stream', 'unsubscribe_viewport_stream', 'get_viewport_stream_stats', 'get_viewport_frame',
+            'get_ubt_job', 'cancel_ubt_job', 'list_ubt_jobs',
+            'stop_session', 'snapshot_trace', 'list_traces', 'analyze_trace'
           ],
           description: 'Action'
         },
@@ -745,7 +833,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         platform: commonSchemas.stringProp,
         configuration: commonSchemas.stringProp,
         arguments: commonSchemas.stringProp,
-        filter: commonSchemas.stringProp,
+        filter: { type: 'string', description: 'run_tests: automation test filter (e.g. Project.Gameplay); all tests when empty.' },
         channels: commonSchemas.stringProp,
         widgetPath: commonSchemas.widgetPath,
         childClass: commonSchemas.stringProp,
@@ -755,7 +843,32 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         value: commonSchemas.stringProp,
         configName: commonSchemas.stringProp,
         code: { type: 'string', description: 'Python code to execute inline', maxLength: 1048576 }, // 1MB max — prevents resource exhaustion via oversized payloads
-        file: { type: 'string', description: 'Path to .py file to execute', maxLength: 4096 } // Max path length on most OS
+        file: { type: 'string', description: 'Path to .py file to execute', maxLength: 4096 }, // Max path length on most OS
+        format: { type: 'string', enum: ['png', 'jpeg'], description: 'Image format: screenshot default png, viewport stream default jpeg.' },
+        quality: { type: 'integer', minimum: 1, maximum: 100, description: 'screenshot: JPEG quality (default 85).' },
+        crop: {
+          type: 'object',
+          properties: {
+            x: commonSchemas.integerProp,
+            y: commonSchemas.integerProp,
+            width: commonSchemas.integerProp,
+            height: commonSchemas.integerProp
+          },
+          description: 'screenshot: crop rectangle in viewport pixels.'
+        },
+        maxWidth: { type: 'integer', description: 'screenshot: downscale so width does not exceed this.' },
+        maxHeight: { type: 'integer', description: 'screenshot: downscale so height does not exceed this.' },
+        scale: { type: 'number', description: 'screenshot: uniform downscale factor in (0, 1].' },
+        delivery: { type: 'string', enum: ['file', 'base64'], description: 'screenshot: return a file path (default) or inline base64 bytes.' },
+        fps: { type: 'number', minimum: 1, maximum: 60, description: 'subscribe_viewport_stream: target frames per second (default 10).' },
+        durationSeconds: { type: 'number', description: 'subscribe_viewport_stream: stop after this many seconds (0 = until unsubscribed).' },
+        maxFrames: { type: 'integer', description: 'subscribe_viewport_stream: stop after this many frames (0 = unlimited).' },
+        streamId: { type: 'string', description: 'Viewport stream id returned by subscribe_viewport_stream.' },
+        wait: { type: 'boolean', description: 'run_ubt / run_tests: wait for the job to finish (run_ubt default true, run_tests default false); false returns a jobId immediately.' },
+        timeoutSeconds: { type: 'number', description: 'run_ubt / run_tests: terminate the process after this many seconds (default 3600).' },
+        jobId: { type: 'string', description: 'Job id returned by run_ubt or run_tests.' },
+        sinceLine: { type: 'integer', description: 'get_ubt_job: first output line to return (use the previous nextLine).' },
+        maxLines: { type: 'integer', description: 'get_ubt_job: maximum output lines to return (default 200).' }
       },
       required: ['action']
     },
@@ -778,7 +891,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           type: 'string',
           enum: [
             'create', 'open', 'add_camera', 'add_actor', 'add_actors', 'remove_actors',
-            'get_bindings', 'play', 'pause', 'stop', 'set_playback_speed', 'add_keyframe',
+            'get_bindings', 'play', 'pause', 'stop', 'set_playback_speed', 'add_keyframe', 'set_keys',
             'get_properties', 'set_properties', 'duplicate', 'rename', 'delete', 'list', 'get_metadata', 'set_metadata',
             'add_spawnable_from_class', 'add_track', 'add_section', 'set_display_rate', 'set_tick_resolution',
             'set_work_range', 'set_view_range', 'set_track_muted', 'set_track_solo', 'set_track_locked',
@@ -793,6 +906,26 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         frame: commonSchemas.numberProp,
         value: commonSchemas.objectProp,
         property: commonSchemas.propertyName,
+        bindingId: { type: 'string', description: 'Binding GUID (alternative to actorName).' },
+        channels: {
+          type: 'array',
+          description: 'set_keys: per-channel keys (one entry for a float property).',
+          items: {
+            type: 'object',
+            properties: {
+              channel: { type: 'string', description: 'Transform channel (location.x, rotation.yaw, scale.z) or "value".' },
+              frames: { type: 'array', items: { type: 'number' }, description: 'Key times in timeUnit.' },
+              values: { type: 'array', items: { type: 'number' }, description: 'Key values, one per frame.' },
+              interpolation: { type: 'string', description: 'cubic, linear or constant.' },
+              tolerance: { type: 'number', description: 'Key reduction tolerance for this channel.' }
+            }
+          }
+        },
+        interpolation: { type: 'string', enum: ['cubic', 'linear', 'constant'], description: 'Default interpolation for set_keys.' },
+        timeUnit: { type: 'string', enum: ['frames', 'seconds'], description: 'Unit of set_keys frames (display-rate frames by default).' },
+        tolerance: { type: 'number', description: 'Drop keys within this value error (0 keeps every key).' },
+        replace: { type: 'boolean', description: 'Remove existing keys inside the written range.' },
+        save: commonSchemas.save,
         destinationPath: commonSchemas.destinationPath,
         newName: commonSchemas.newName,
         overwrite: commonSchemas.overwrite,
@@ -964,6 +1097,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_dialogue_voice', 'create_dialogue_wave', 'set_dialogue_context',
             // Effects
             'create_reverb_effect', 'create_source_effect_chain', 'add_source_effect', 'create_submix_effect',
+            // Declarative graphs and bulk import
+            'apply_audio_graph', 'create_sound_assets_from_folder', 'benchmark_sound_import',
             // Utility
             'get_audio_info'
           ],
@@ -1028,7 +1163,28 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         defaultValue: commonSchemas.value,
         metasoundNodeType: commonSchemas.stringProp,
         soundClassPath: commonSchemas.soundClassPath,
-        parentClassPath: commonSchemas.parentClassPath
+        parentClassPath: commonSchemas.parentClassPath,
+        // Declarative graph (apply_audio_graph)
+        spec: {
+          type: 'object',
+          description: 'apply_audio_graph: SoundCue { nodes: [{ key, type (wave_player, mixer, random, modulator, looping, attenuation, concatenator, delay, switch, branch or a SoundNode class), wave, volume, pitch, delay, looping, indefinite, loopCount, attenuation, weights, properties, inputs: [child keys], x, y }], output, volume, pitch, attenuation, soundClass } rebuilds the cue; MetaSound { graphInputs: [{ name, type, default }], graphOutputs: [{ name, type }], nodes: [{ key, class ("UE.Sine.Audio", WavePlayer, ...), version, inputs: { Input: literal } }], edges: [{ from: "key.Output", to: "key.Input" }] } is matched by key ("graph" names the graph inputs/outputs).'
+        },
+        assetType: { type: 'string', enum: ['SoundCue', 'MetaSound'], description: 'apply_audio_graph: type to create when assetPath does not exist (default inferred from the spec).' },
+        // Bulk import (create_sound_assets_from_folder, benchmark_sound_import)
+        sourceFolder: { type: 'string', description: 'create_sound_assets_from_folder: folder on disk with the sound files (absolute or project-relative).' },
+        destinationPath: { type: 'string', description: 'create_sound_assets_from_folder: content folder for the imported waves (default /Game/Audio/Imported).' },
+        recursive: { type: 'boolean', description: 'create_sound_assets_from_folder: include subfolders, mirrored under destinationPath (default true).' },
+        extensions: { type: 'array', items: { type: 'string' }, description: 'create_sound_assets_from_folder: file extensions to import (default ["wav"]).' },
+        wrap: { type: 'string', enum: ['cue', 'metasound', 'none'], description: 'Wrap each imported wave in a SoundCue or MetaSound source (default cue).' },
+        wrapPath: { type: 'string', description: 'create_sound_assets_from_folder: content folder for the wrappers (default destinationPath/Cues or /MetaSounds).' },
+        wrapPrefix: { type: 'string', description: 'create_sound_assets_from_folder: wrapper name prefix (default SC_ or MS_).' },
+        overwrite: { type: 'boolean', description: 'create_sound_assets_from_folder: replace existing waves and wrappers instead of skipping them.' },
+        maxFiles: { type: 'integer', description: 'create_sound_assets_from_folder: import at most this many files (0 = all).' },
+        frameBudgetMs: { type: 'number', description: 'create_sound_assets_from_folder: game-thread import time per editor tick (default 50).' },
+        timeoutSeconds: { type: 'number', description: 'create_sound_assets_from_folder / benchmark_sound_import: stop after this many seconds and report the files not imported (default and maximum 240).' },
+        waveCount: { type: 'integer', description: 'benchmark_sound_import: generated waves (default 300).' },
+        durationSeconds: { type: 'number', description: 'benchmark_sound_import: length of each generated wave in seconds (default 1).' },
+        cleanup: { type: 'boolean', description: 'benchmark_sound_import: delete the generated files and assets afterwards (default true).' }
       },
       required: ['action']
     },
@@ -1037,7 +1193,13 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
       properties: {
         ...commonSchemas.outputBase,
         assetPath: commonSchemas.assetPath,
-        nodeId: commonSchemas.nodeId
+        nodeId: commonSchemas.nodeId,
+        apply: { type: 'object', description: 'apply_audio_graph: created/updated/replaced/removed/linked counts, defaults set, applyMs and warnings.' },
+        nodeIds: { type: 'object', description: 'apply_audio_graph: spec key -> node name (SoundCue) or node ID (MetaSound).' },
+        imported: { type: 'number', description: 'create_sound_assets_from_folder: waves imported.' },
+        wrapped: { type: 'number', description: 'create_sound_assets_from_folder: cues or MetaSounds created.' },
+        failed: { type: 'array', items: { type: 'object' }, description: 'create_sound_assets_from_folder: { file, error } per failure (first 50).' },
+        wallMs: { type: 'number', description: 'create_sound_assets_from_folder: wall time of the whole job (split into readMs, importMs, wrapMs, saveMs).' }
       }
     }
   },
@@ -1154,8 +1316,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         action: {
           type: 'string',
           enum: [
-            'start_profiling', 'stop_profiling', 'run_benchmark', 'show_fps', 'show_stats', 'generate_memory_report',
-            'set_scalability', 'set_resolution_scale', 'set_vsync', 'set_frame_rate_limit', 'enable_gpu_timing',
+            'start_profiling', 'stop_profiling', 'run_benchmark', 'show_fps', 'show_stats', 'generate_memory_report', 'diff_memory_reports',
+            'get_request_profile', 'set_scalability', 'set_resolution_scale', 'set_vsync', 'set_frame_rate_limit', 'enable_gpu_timing',
             'configure_texture_streaming', 'configure_lod', 'apply_baseline_settings', 'optimize_draw_calls', 'merge_actors',
             'configure_occlusion_culling', 'optimize_shaders', 'configure_nanite', 'configure_world_partition'
           ],
@@ -1189,7 +1351,27 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         maxPixelsPerEdge: commonSchemas.numberProp,
         streamingPoolSize: commonSchemas.numberProp,
         streamingDistance: commonSchemas.numberProp,
-        cellSize: commonSchemas.numberProp
+        cellSize: commonSchemas.numberProp,
+        label: { type: 'string', description: 'generate_memory_report: label stored with the snapshot.' },
+        include: { type: 'array', items: { type: 'string', enum: ['objects', 'textures', 'llm'] }, description: 'generate_memory_report: sections to capture besides platform (default all).' },
+        topClasses: { type: 'integer', description: 'generate_memory_report: classes returned in the response (default 50, all when detailed).' },
+        baseline: { type: 'string', description: 'diff_memory_reports: snapshot id or .json path. run_benchmark: earlier benchmarkId or result .json path.' },
+        current: { type: 'string', description: 'diff_memory_reports: snapshot id or .json path (default: capture now).' },
+        limit: { type: 'integer', description: 'diff_memory_reports: entries per grown/shrunk list (default 25). get_request_profile: requests returned (default 20, max 256).' },
+        actionFilter: { type: 'string', description: 'get_request_profile: only requests for this automation action.' },
+        reset: { type: 'boolean', description: 'get_request_profile: clear the request history after reading it.' },
+        warmupSeconds: { type: 'number', description: 'run_benchmark: seconds to run before sampling (0-30, default 2).' },
+        hitchThresholdMs: { type: 'number', description: 'run_benchmark: frames longer than this count as hitches (default 50).' },
+        cameraPath: {
+          type: 'array',
+          items: {
+            type: 'object',
+            properties: { location: commonSchemas.location, rotation: commonSchemas.rotation }
+          },
+          description: 'run_benchmark: viewport camera keys followed evenly over the duration.'
+        },
+        sequencePath: { type: 'string', description: 'run_benchmark: Level Sequence played while sampling; its length (at most 240 s) sets the duration.' },
+        regressionThresholdPct: { type: 'number', description: 'run_benchmark: percent slower than baseline that counts as a regression (default 10).' }
       },
       required: ['action']
     },
@@ -1197,7 +1379,13 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
       type: 'object',
       properties: {
         ...commonSchemas.outputBase,
-        params: commonSchemas.objectProp
+        params: commonSchemas.objectProp,
+        snapshotId: { type: 'string' },
+        benchmarkId: { type: 'string' },
+        filePath: { type: 'string' },
+        frameMs: commonSchemas.objectProp,
+        hitches: { type: 'number' },
+        comparison: commonSchemas.objectProp
       }
     }
   },
@@ -1231,7 +1419,9 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'generate_collision', 'generate_complex_collision', 'simplify_collision',
             'generate_lods', 'set_lod_settings', 'set_lod_screen_sizes', 'convert_to_nanite',
             'convert_to_static_mesh',
-            'get_mesh_info'
+            'get_mesh_info',
+            'set_mesh_buffers', 'get_mesh_buffers',
+            'apply_geometry_pipeline', 'cancel_geometry_job', 'list_geometry_jobs'
           ],
           description: 'Geometry action to perform'
         },
@@ -1298,7 +1488,34 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         createAsset: { type: 'boolean', description: 'Create as persistent asset.' },
         overwrite: commonSchemas.overwrite,
         save: commonSchemas.save,
-        enableNanite: { type: 'boolean', description: 'Enable Nanite for the output mesh.' }
+        enableNanite: { type: 'boolean', description: 'Enable Nanite for the output mesh.' },
+        positions: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'set_mesh_buffers: vertex positions, 3 float32 per vertex (base64 little-endian or number array).' },
+        indices: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'set_mesh_buffers: triangle indices, 3 uint32 per triangle (base64 little-endian or number array).' },
+        normals: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'set_mesh_buffers: optional per-vertex normals, 3 float32 per vertex.' },
+        uvs: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'set_mesh_buffers: optional per-vertex UVs, 2 float32 per vertex.' },
+        colors: { oneOf: [{ type: 'string' }, { type: 'array', items: commonSchemas.numberProp }], description: 'set_mesh_buffers: optional per-vertex RGBA colors, 4 float32 per vertex.' },
+        mode: { type: 'string', enum: ['replace', 'append'], description: 'set_mesh_buffers: replace the mesh (default) or append to it.' },
+        encoding: { type: 'string', enum: ['base64', 'json'], description: 'get_mesh_buffers: return base64 float32/uint32 buffers (default) or number arrays.' },
+        include: { type: 'array', items: { type: 'string', enum: ['normals', 'uvs', 'colors'] }, description: 'get_mesh_buffers: optional attribute buffers to return (default: all available).' },
+        ops: {
+          type: 'array',
+          items: {
+            type: 'object',
+            properties: {
+              op: {
+                type: 'string',
+                enum: [
+                  'append_box', 'append_sphere', 'append_cylinder', 'boolean', 'simplify', 'remesh_uniform',
+                  'smooth', 'weld', 'fill_holes', 'recalculate_normals', 'auto_uv', 'bevel', 'transform'
+                ]
+              }
+            },
+            required: ['op']
+          },
+          description: 'apply_geometry_pipeline: ordered ops applied to one mesh copy off the game thread. Each op takes the same params as its single action (boolean: operation + toolActor or shape/width/radius/location).'
+        },
+        useCache: { type: 'boolean', description: 'apply_geometry_pipeline: reuse cached intermediate meshes for matching op prefixes.' },
+        jobId: { type: 'string', description: 'cancel_geometry_job: request ID of a queued or running background geometry job.' }
       },
       required: ['action']
     },
@@ -1341,6 +1558,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'auto_skin_weights', 'set_vertex_weights',
             'normalize_weights', 'prune_weights',
             'copy_weights', 'mirror_weights',
+            'process_skin_weights', 'benchmark_skin_weights',
             'create_physics_asset',
             'add_physics_body', 'configure_physics_body',
             'add_physics_constraint', 'configure_constraint_limits',
@@ -1376,6 +1594,29 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         threshold: { type: 'number', description: 'Weight threshold for pruning (0-1).' },
         mirrorAxis: { type: 'string', enum: ['X', 'Y', 'Z'], description: 'Axis for weight mirroring.' },
         mirrorTable: { type: 'object', description: 'Bone name mapping for mirroring.' },
+        operations: {
+          type: 'array',
+          items: {
+            type: 'object',
+            properties: {
+              op: { type: 'string', enum: ['normalize', 'prune', 'limit_influences', 'smooth', 'mirror', 'auto'] },
+              threshold: { type: 'number', description: 'prune: drop influences below this weight.' },
+              maxInfluences: { type: 'number', description: 'limit_influences / auto / smooth: influences per vertex (smooth defaults to the current stride).' },
+              iterations: { type: 'number', description: 'smooth: passes over the topology.' },
+              strength: { type: 'number', description: 'smooth: blend toward the neighbour average (0-1).' },
+              axis: { type: 'string', enum: ['X', 'Y', 'Z'], description: 'mirror: mirror plane normal.' },
+              direction: { type: 'string', enum: ['positive_to_negative', 'negative_to_positive'] },
+              tolerance: { type: 'number', description: 'mirror: max distance to the mirror vertex (cm).' },
+              falloff: { type: 'number', description: 'auto: distance falloff exponent.' }
+            }
+          },
+          description: 'process_skin_weights: ordered weight operations, committed with one rebuild. Plain op names are accepted.'
+        },
+        lodIndex: { type: 'number', description: 'LOD whose skin weights are edited.' },
+        maxInfluences: { type: 'number', description: 'auto_skin_weights: influences per vertex.' },
+        smoothIterations: { type: 'number', description: 'auto_skin_weights: smoothing passes after proximity weights.' },
+        vertexCounts: { type: 'array', items: { type: 'number' }, description: 'benchmark_skin_weights: synthetic mesh sizes.' },
+        iterations: { type: 'number', description: 'benchmark_skin_weights: runs per kernel.' },
         bodyType: { type: 'string', enum: ['Capsule', 'Sphere', 'Box', 'Convex', 'Sphyl'], description: 'Physics body shape type.' },
         bodyName: commonSchemas.bodyName,
         mass: commonSchemas.mass,
@@ -1449,7 +1690,9 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_material_instance', 'set_scalar_parameter_value', 'set_vector_parameter_value', 'set_texture_parameter_value',
             'create_landscape_material', 'create_decal_material', 'create_post_process_material',
             'add_landscape_layer', 'configure_layer_blend',
-            'compile_material', 'get_material_info'
+            'compile_material', 'get_material_info',
+            'begin_material_edit', 'commit_material_edit', 'get_material_edit_status',
+            'apply_material_graph', 'benchmark_material_graph'
           ],
           description: 'Material authoring action to perform'
         },
@@ -1491,7 +1734,14 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         layerName: commonSchemas.layerName,
         blendType: { type: 'string', enum: ['LB_WeightBlend', 'LB_AlphaBlend', 'LB_HeightBlend'], description: 'Landscape layer blend type.' },
         layers: { type: 'array', items: commonSchemas.objectProp, description: 'Array of layer configurations for layer blend.' },
-        save: commonSchemas.save
+        save: commonSchemas.save,
+        maxSeconds: { type: 'number', description: 'begin_material_edit: commit the session automatically after this many seconds (default 300).' },
+        wait: { type: 'boolean', description: 'compile_material/commit_material_edit/apply_material_graph: respond once shaders finish compiling, with progress and structured compile errors.' },
+        timeoutSeconds: { type: 'number', description: 'Maximum seconds to wait for shader compilation (default and maximum 240, under the client request cap).' },
+        graph: { type: 'object', description: 'apply_material_graph: full graph spec {nodes:[{key,type,x,y,parameterName,defaultValue,texture,function,properties}], parameters:[{name,type}], edges:[{from,output,to,input}] (to "Main" = material input), materialProperties, prune}.' },
+        spec: { type: 'string', description: 'apply_material_graph: text form of the graph, one statement per line (node/param/edge/set/prune).' },
+        prune: { type: 'boolean', description: 'apply_material_graph: delete expressions and clear links the spec does not list (default false).' },
+        nodeCount: { type: 'number', description: 'benchmark_material_graph: nodes in the generated master material (default 100).' }
       },
       required: ['action']
     },
@@ -1532,7 +1782,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'invert', 'desaturate', 'channel_pack', 'channel_extract', 'combine_textures',
             'set_compression_settings', 'set_texture_group', 'set_lod_bias',
             'configure_virtual_texture', 'set_streaming_priority',
-            'get_texture_info'
+            'get_texture_info', 'benchmark_image_kernels'
           ],
           description: 'Texture action to perform'
         },
@@ -1621,6 +1871,8 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         tileBorderSize: { type: 'number', description: 'Virtual texture tile border size.' },
         neverStream: { type: 'boolean', description: 'Disable texture streaming.' },
         streamingPriority: { type: 'number', description: 'Streaming priority (-1 to 1, lower = higher priority).' },
+        sizes: { type: 'array', items: { type: 'number' }, description: 'Square image sizes for benchmark_image_kernels (default [2048, 4096, 8192]).' },
+        iterations: { type: 'number', description: 'Runs per kernel for benchmark_image_kernels; best run is reported (default 3).' },
         hdr: { type: 'boolean', description: 'Create HDR texture (16-bit float).' },
         save: commonSchemas.save
       },
@@ -1680,7 +1932,7 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'add_static_mesh_data_interface', 'add_spline_data_interface', 'add_audio_spectrum_data_interface',
             'add_collision_query_data_interface', 'add_event_generator', 'add_event_receiver',
             'configure_event_payload', 'enable_gpu_simulation', 'add_simulation_stage',
-            'get_niagara_info', 'validate_niagara_system'
+            'get_niagara_info', 'validate_niagara_system', 'apply_niagara_spec', 'benchmark_niagara_spec'
           ],
           description: 'Effect/Niagara action to perform.'
         },
@@ -1801,6 +2053,18 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         // Simulation stage
         stageName: commonSchemas.stringProp,
         stageType: commonSchemas.stringProp,
+        // Declarative specs (apply_niagara_spec, benchmark_niagara_spec)
+        spec: {
+          type: 'object',
+          description: 'Full system spec: { emitters: [{ name, source, enabled, simTarget, properties, modules: [{ module|script, stage, name, enabled, inputs }], renderers: [{ type, material, mesh, enabled, properties }] }], userParameters: [{ name, type, value }], systemProperties, prune }.'
+        },
+        prune: { type: 'boolean', description: 'Remove emitters, renderers and user parameters the spec does not list; disable unlisted modules.' },
+        wait: { type: 'boolean', description: 'apply_niagara_spec: wait for VM scripts and GPU shaders to compile (default true).' },
+        timeoutSeconds: { type: 'number', description: 'apply_niagara_spec / benchmark_niagara_spec: compile wait limit in seconds (default and maximum 240).' },
+        sourceEmitter: { type: 'string', description: 'benchmark_niagara_spec: emitter asset the generated emitters are added from.' },
+        emitterCount: commonSchemas.numberProp,
+        modulesPerEmitter: commonSchemas.numberProp,
+        save: commonSchemas.booleanProp,
         // Timeout
         timeoutMs: commonSchemas.numberProp
       },
@@ -1814,7 +2078,11 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         emitterName: commonSchemas.stringProp,
         shapes: commonSchemas.arrayOfObjects,
         niagaraInfo: commonSchemas.objectProp,
-        validationResult: commonSchemas.objectProp
+        validationResult: commonSchemas.objectProp,
+        apply: commonSchemas.objectProp,
+        compile: commonSchemas.objectProp,
+        batched: commonSchemas.objectProp,
+        incremental: commonSchemas.objectProp
       }
     }
   },
@@ -3194,7 +3462,9 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_dialog_widget',
             'create_radial_menu',
             'get_widget_info',
-            'preview_widget'
+            'preview_widget',
+            'apply_widget_tree',
+            'benchmark_widget_tree'
           ],
           description: 'The widget authoring action to perform.'
         },
@@ -3499,7 +3769,20 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           description: 'Preview resolution preset.'
         },
         customWidth: { type: 'number', description: 'Custom preview width.' },
-        customHeight: { type: 'number', description: 'Custom preview height.' }
+        customHeight: { type: 'number', description: 'Custom preview height.' },
+        // Declarative tree (apply_widget_tree)
+        spec: {
+          type: 'object',
+          description: 'apply_widget_tree: { root: WIDGET, prune }, WIDGET = { name, type (CanvasPanel, TextBlock, ... or widget BP path), isVariable, visibility, text, properties: { Property: value }, slot: { anchors, position, size, alignment, autoSize, zOrder, padding, horizontalAlignment, verticalAlignment, ... }, bindings: { Property: "FunctionName" }, children: [WIDGET] }. Widgets are matched by name.'
+        },
+        prune: { type: 'boolean', description: 'apply_widget_tree: remove widgets the spec does not list (overrides spec.prune).' },
+        compile: { type: 'boolean', description: 'apply_widget_tree: compile once after applying (default true).' },
+        save: { type: 'boolean', description: 'apply_widget_tree: save the widget blueprint (default true).' },
+        widgetCount: { type: 'integer', description: 'benchmark_widget_tree: widgets in the generated HUD (default 80).' },
+        path: { type: 'string', description: 'benchmark_widget_tree: /Game folder for the temporary widget blueprints.' },
+        compileEach: { type: 'boolean', description: 'benchmark_widget_tree: compile after every widget in the per-widget run (default true).' },
+        cleanup: { type: 'boolean', description: 'benchmark_widget_tree: delete the temporary widget blueprints (default true).' },
+        timeoutSeconds: { type: 'number', description: 'benchmark_widget_tree: stop the run after this many seconds (default and maximum 240).' }
       },
       required: ['action']
     },
@@ -3527,6 +3810,11 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           },
           description: 'Widget info (for get_widget_info).'
         },
+        apply: { type: 'object', description: 'apply_widget_tree: created/updated/replaced/deleted/moved counts, compile state and warnings.' },
+        widgets: { type: 'object', description: 'apply_widget_tree: widget name -> { class, parent, slot }.' },
+        perWidget: { type: 'object', description: 'benchmark_widget_tree: one apply per widget (applies, compiles, applyMs, compileMs, totalMs).' },
+        speedup: { type: 'number', description: 'benchmark_widget_tree: per-widget total time / spec total time.' },
+        treesMatch: { type: 'boolean', description: 'benchmark_widget_tree: both runs produced the full widget count.' },
         error: commonSchemas.stringProp
       }
     }
@@ -4327,7 +4615,9 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
             'create_nav_modifier_component', 'set_nav_area_class', 'configure_nav_area_cost',
             'create_nav_link_proxy', 'configure_nav_link', 'set_nav_link_type',
             'create_smart_link', 'configure_smart_link_behavior',
-            'get_navigation_info'
+            'get_navigation_info',
+            'find_paths', 'reachability_matrix', 'project_points_to_navmesh', 'benchmark_navigation_queries',
+            'begin_nav_batch', 'end_nav_batch', 'get_nav_build_status', 'benchmark_nav_rebuild'
           ],
           description: 'Navigation action to perform'
         },
@@ -4420,6 +4710,42 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
           },
           description: 'Rotation for nav link proxy.'
         },
+        pairs: {
+          type: 'array',
+          items: {
+            type: 'object',
+            properties: {
+              start: { oneOf: [{ type: 'object', properties: { x: commonSchemas.numberProp, y: commonSchemas.numberProp, z: commonSchemas.numberProp } }, { type: 'array', items: commonSchemas.numberProp }, { type: 'string' }] },
+              end: { oneOf: [{ type: 'object', properties: { x: commonSchemas.numberProp, y: commonSchemas.numberProp, z: commonSchemas.numberProp } }, { type: 'array', items: commonSchemas.numberProp }, { type: 'string' }] }
+            }
+          },
+          description: 'find_paths: start/end pairs. A point is {x,y,z}, [x,y,z] or an actor name/label.'
+        },
+        sources: { type: 'array', items: { oneOf: [{ type: 'object', properties: { x: commonSchemas.numberProp, y: commonSchemas.numberProp, z: commonSchemas.numberProp } }, { type: 'array', items: commonSchemas.numberProp }, { type: 'string' }] }, description: 'reachability_matrix: source points or actor names.' },
+        targets: { type: 'array', items: { oneOf: [{ type: 'object', properties: { x: commonSchemas.numberProp, y: commonSchemas.numberProp, z: commonSchemas.numberProp } }, { type: 'array', items: commonSchemas.numberProp }, { type: 'string' }] }, description: 'reachability_matrix: target points or actor names.' },
+        points: { type: 'array', items: { oneOf: [{ type: 'object', properties: { x: commonSchemas.numberProp, y: commonSchemas.numberProp, z: commonSchemas.numberProp } }, { type: 'array', items: commonSchemas.numberProp }, { type: 'string' }] }, description: 'project_points_to_navmesh: points or actor names.' },
+        mode: { type: 'string', enum: ['path', 'test', 'full', 'incremental'], description: 'reachability_matrix: path lengths (path) or existence only (test, faster). rebuild_navigation: full rebuild (default) or incremental (dirty tiles only, waits with progress).' },
+        includePoints: { type: 'boolean', description: 'find_paths: return path points as flat x,y,z arrays.' },
+        simplifyTolerance: { type: 'number', description: 'find_paths: drop path points within this distance (0 keeps all).' },
+        queryExtent: {
+          type: 'object',
+          properties: {
+            x: commonSchemas.numberProp, y: commonSchemas.numberProp, z: commonSchemas.numberProp
+          },
+          description: 'Projection extent (default: navmesh query extent).'
+        },
+        filterClass: { type: 'string', description: 'NavigationQueryFilter class path.' },
+        projectEndpoints: { type: 'boolean', description: 'Project path endpoints onto the navmesh first (default true).' },
+        allowPartial: { type: 'boolean', description: 'reachability_matrix: count partial paths as reachable.' },
+        parallel: { type: 'boolean', description: 'Run queries on worker threads (default true).' },
+        numPaths: { type: 'number', description: 'benchmark_navigation_queries: random pairs to path (default 2000).' },
+        iterations: { type: 'number', description: 'benchmark_navigation_queries: timed runs per mode (default 3).' },
+        maxSeconds: { type: 'number', description: 'begin_nav_batch: resume building after this long if not ended (default 600).' },
+        wait: { type: 'boolean', description: 'end_nav_batch: respond once the navmesh is up to date (default true).' },
+        timeoutSeconds: { type: 'number', description: 'Wait limit for rebuilds and for queries waiting on dirty tiles (default 120; benchmark_nav_rebuild 240; at most 240, under the client request cap).' },
+        actorCount: { type: 'number', description: 'benchmark_nav_rebuild: actors placed per mode (default 100).' },
+        spacing: { type: 'number', description: 'benchmark_nav_rebuild: distance between placed actors (default 300).' },
+        actorScale: { type: 'number', description: 'benchmark_nav_rebuild: scale of the placed cubes (default 2).' },
         filter: commonSchemas.filter,
         save: commonSchemas.save
       },
@@ -4607,6 +4933,15 @@ export const consolidatedToolDefinitions: ToolDefinition[] = [
         startOffset: { type: 'number', description: 'Offset from spline start for first mesh.' },
         endOffset: { type: 'number', description: 'Offset from spline end for last mesh.' },
         bAlignToSpline: { type: 'boolean', description: 'Align scattered meshes to spline direction.' },
+        instancingMode: {
+          type: 'string',
+          enum: ['none', 'ism', 'hism'],
+          description: 'Scatter output: one component per sample (none, default) or one ISM/HISM component per mesh.'
+        },
+        meshPaths: { type: 'array', items: commonSchemas.stringProp, description: 'Multiple meshes to distribute across scatter samples.' },
+        clearExisting: { type: 'boolean', description: 'Remove components from a previous scatter before scattering.' },
+        useRandomOffset: { type: 'boolean', description: 'Jitter scatter samples along the spline.' },
+        randomOffsetRange: { type: 'number', description: 'Maximum jitter distance along the spline.' },
         bRandomizeRotation: { type: 'boolean', description: 'Apply random rotation to scattered meshes.' },
         rotationRandomRange: {
           type: 'object',
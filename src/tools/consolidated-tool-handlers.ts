@@ -15,7 +15,7 @@ import { handleEffectTools } from './handlers/effect-handlers.js';
 import { handleEnvironmentTools } from './handlers/environment-handlers.js';
 import { handleSystemTools, handleConsoleCommand } from './handlers/system-handlers.js';
 import { handleInspectTools } from './handlers/inspect-handlers.js';
-import { handlePipelineTools } from './handlers/pipeline-handlers.js';
+import { handlePipelineTools, isUbtJobAction, runTestsOnBridge } from './handlers/pipeline-handlers.js';
 import { handleGraphTools } from './handlers/graph-handlers.js';
 import { handleAudioTools } from './handlers/audio-handlers.js';
 import { handleLightingTools } from './handlers/lighting-handlers.js';
@@ -83,6 +83,9 @@ const NIAGARA_GRAPH_ACTION_MAP: Record<string, string> = {
   set_niagara_parameter: 'set_parameter'
 };
 
+// system_control trace actions handled by the bridge's manage_insights handler
+const INSIGHTS_TRACE_ACTIONS = new Set(['stop_session', 'snapshot_trace', 'list_traces', 'analyze_trace']);
+
 function isMaterialGraphAction(action: string): boolean {
   return (
     Object.prototype.hasOwnProperty.call(MATERIAL_GRAPH_ACTION_MAP, action) ||
@@ -179,7 +182,7 @@ function registerDefaultHandlers() {
       return await handleBlueprintGet(args, tools);
     }
     // Graph actions (merged from manage_blueprint_graph)
-    const graphActions = ['create_node', 'delete_node', 'connect_pins', 'break_pin_links', 'set_node_property', 'create_reroute_node', 'get_node_details', 'get_graph_details', 'get_pin_details', 'list_node_types', 'set_pin_default_value'];
+    const graphActions = ['create_node', 'delete_node', 'connect_pins', 'break_pin_links', 'set_node_property', 'create_reroute_node', 'get_node_details', 'get_graph_details', 'get_pin_details', 'list_node_types', 'set_pin_default_value', 'apply_graph'];
     if (graphActions.includes(action)) {
       return await handleGraphTools('manage_blueprint_graph', action, args, tools);
     }
@@ -226,6 +229,7 @@ function registerDefaultHandlers() {
   // 6. ANIMATION & PHYSICS (merged with manage_animation_authoring - Phase 53)
   const ANIMATION_AUTHORING_ACTIONS = new Set([
     'create_animation_sequence', 'set_sequence_length', 'add_bone_track', 'set_bone_key', 'set_curve_key',
+    'set_bone_track_keys', 'set_curves',
     'add_notify_state', 'add_sync_marker', 'set_root_motion_settings', 'set_additive_settings',
     'create_montage', 'add_montage_section', 'add_montage_slot', 'set_section_timing',
     'add_montage_notify', 'set_blend_in', 'set_blend_out', 'link_sections',
@@ -267,7 +271,8 @@ function registerDefaultHandlers() {
     'add_audio_spectrum_data_interface', 'add_collision_query_data_interface',
     'add_event_generator', 'add_event_receiver', 'configure_event_payload',
     'enable_gpu_simulation', 'add_simulation_stage',
-    'get_niagara_info', 'validate_niagara_system'
+    'get_niagara_info', 'validate_niagara_system',
+    'apply_niagara_spec', 'benchmark_niagara_spec'
   ]);
   toolRegistry.register('manage_effect', async (args, tools) => {
     const action = getAction(args);
@@ -294,12 +299,16 @@ function registerDefaultHandlers() {
   toolRegistry.register('system_control', async (args, tools) => {
     const action = getAction(args);
     if (action === 'console_command') return await handleConsoleCommand(args, tools);
-    if (action === 'run_ubt') return await handlePipelineTools(action, args, tools);
+    if (action === 'run_ubt' || isUbtJobAction(action)) return await handlePipelineTools(action, args, tools);
 
-    if (action === 'run_tests') return cleanObject(await executeAutomationRequest(tools, 'manage_tests', { ...args, subAction: action }, 'Bridge unavailable'));
+    if (action === 'run_tests') return cleanObject(await runTestsOnBridge(args, tools));
     if (action === 'subscribe' || action === 'unsubscribe') return cleanObject(await executeAutomationRequest(tools, 'manage_logs', { ...args, subAction: action }, 'Bridge unavailable'));
     if (action === 'spawn_category') return cleanObject(await executeAutomationRequest(tools, 'manage_debug', { ...args, subAction: action }, 'Bridge unavailable'));
-    if (action === 'start_session') return cleanObject(await executeAutomationRequest(tools, 'manage_insights', { ...args, subAction: action }, 'Bridge unavailable'));
+    if (action === 'start_session' || INSIGHTS_TRACE_ACTIONS.has(action)) {
+      // analyze_trace responds once analysis finishes; progress updates keep the request alive
+      const options = action === 'analyze_trace' ? { timeoutMs: 300000 } : {};
+      return cleanObject(await executeAutomationRequest(tools, 'manage_insights', { ...args, subAction: action }, 'Bridge unavailable', options));
+    }
     // Note: lumen_update_scene is now available directly via manage_render tool, not system_control
 
     return await handleSystemTools(action, args, tools);
@@ -315,7 +324,8 @@ function registerDefaultHandlers() {
   toolRegistry.register('manage_tools', async (args, tools) => await handleManageToolsTools(getAction(args), args, tools));
 
   // 13. MANAGE_PIPELINE - Routes to handlePipelineTools with action dispatch
-  // Actions: run_ubt (local spawn), list_categories, get_status (via system_control)
+  // Actions: run_ubt (local spawn or bridge job), get_ubt_job/cancel_ubt_job/list_ubt_jobs,
+  // list_categories, get_status (via system_control)
   toolRegistry.register('manage_pipeline', async (args, tools) => {
     const action = getAction(args);
     // list_categories and get_status route through system_control
@@ -336,6 +346,7 @@ function registerDefaultHandlers() {
     'configure_spatialization', 'configure_occlusion', 'configure_reverb_send',
     'create_dialogue_voice', 'create_dialogue_wave', 'set_dialogue_context',
     'create_reverb_effect', 'create_source_effect_chain', 'add_source_effect', 'create_submix_effect',
+    'apply_audio_graph', 'create_sound_assets_from_folder', 'benchmark_sound_import',
     'get_audio_info'
   ]);
   toolRegistry.register('manage_audio', async (args, tools) => {
@@ -244,6 +244,54 @@ export async function handleAnimationAuthoringTools(
         return ResponseFactory.success(res, res.message ?? `Curve key set at frame ${frame}`);
       }
 
+      case 'set_bone_track_keys':
+      case 'set_curves': {
+        // Bulk keys: one controller bracket and one recompression for the whole payload
+        const params = normalizeArgs(args, [
+          { key: 'assetPath', required: true },
+          { key: 'tracks' },
+          { key: 'curves' },
+          { key: 'rotationFormat', default: 'quat' },
+          { key: 'numFrames' },
+          { key: 'frameRate' },
+          { key: 'createIfMissing', default: true },
+          { key: 'recompress', default: true },
+          { key: 'save', default: true },
+        ]);
+
+        const rawAssetPath = extractString(params, 'assetPath');
+        const pathValidation = validatePath(rawAssetPath, 'assetPath');
+        if (!pathValidation.valid) {
+          return pathValidation.error;
+        }
+        const tracks = extractOptionalArray(params, 'tracks');
+        const curves = extractOptionalArray(params, 'curves');
+        if (action === 'set_bone_track_keys' && !tracks?.length) {
+          return ResponseFactory.error('tracks is required and must not be empty', 'MISSING_TRACKS');
+        }
+        if (action === 'set_curves' && !curves?.length) {
+          return ResponseFactory.error('curves is required and must not be empty', 'MISSING_CURVES');
+        }
+
+        const res = (await executeAutomationRequest(tools, 'manage_animation_authoring', {
+          subAction: action,
+          assetPath: pathValidation.sanitized,
+          tracks,
+          curves,
+          rotationFormat: extractOptionalString(params, 'rotationFormat') ?? 'quat',
+          numFrames: extractOptionalNumber(params, 'numFrames'),
+          frameRate: extractOptionalNumber(params, 'frameRate'),
+          createIfMissing: extractOptionalBoolean(params, 'createIfMissing') ?? true,
+          recompress: extractOptionalBoolean(params, 'recompress') ?? true,
+          save: extractOptionalBoolean(params, 'save') ?? true,
+        }, 'Automation bridge not available', { timeoutMs: 300000 })) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.error(res.error ?? 'Failed to write animation keys', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Animation keys written');
+      }
+
       case 'add_notify': {
         const params = normalizeArgs(args, [
           { key: 'assetPath', required: true },
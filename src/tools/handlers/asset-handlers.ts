@@ -28,7 +28,9 @@ const VALID_ASSET_ACTIONS = new Set([
   // Source control
   'source_control_checkout', 'source_control_submit', 'source_control_enable', 'get_source_control_state',
   // Graph analysis
-  'analyze_graph', 'get_asset_graph'
+  'analyze_graph', 'get_asset_graph',
+  // Save queue
+  'flush_saves', 'get_save_queue', 'benchmark_asset_saves'
 ]);
 
 /**
@@ -891,6 +893,35 @@ export async function handleAssetTools(action: string, args: HandlerArgs, tools:
         });
         return ResponseFactory.success(res, 'Material rebuilt successfully');
       }
+      case 'flush_saves': {
+        const res = await executeAutomationRequest(tools, 'manage_asset', {
+          subAction: 'flush_saves'
+        }, undefined, { timeoutMs: 300000 });
+        return ResponseFactory.success(res, 'Queued asset saves flushed');
+      }
+      case 'get_save_queue': {
+        const argsTyped = args as AssetArgs & { includePackages?: boolean };
+        const res = await executeAutomationRequest(tools, 'manage_asset', {
+          subAction: 'get_save_queue',
+          includePackages: argsTyped.includePackages
+        });
+        return ResponseFactory.success(res, 'Save queue retrieved');
+      }
+      case 'benchmark_asset_saves': {
+        const argsTyped = args as AssetArgs & { count?: number; cleanup?: boolean };
+        const pathSecurity = validatePathSecurity(
+          typeof argsTyped.path === 'string' ? argsTyped.path : undefined, 'path'
+        );
+        if (pathSecurity) return pathSecurity;
+
+        const res = await executeAutomationRequest(tools, 'manage_asset', {
+          subAction: 'benchmark_asset_saves',
+          count: argsTyped.count,
+          path: argsTyped.path,
+          cleanup: argsTyped.cleanup
+        }, undefined, { timeoutMs: 600000 });
+        return ResponseFactory.success(res, 'Asset save benchmark complete');
+      }
       case 'bulk_rename': {
         // Accept either folderPath or assetPaths
         // Map pattern->searchText and replacement->replaceText for C++ compatibility
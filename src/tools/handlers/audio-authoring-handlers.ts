@@ -8,6 +8,7 @@
  * - Attenuation & Spatialization
  * - Dialogue System
  * - Audio Effects
+ * - Declarative graphs (whole cue/MetaSound spec, one save) and bulk folder import
  *
  * @module audio-authoring-handlers
  */
@@ -15,7 +16,7 @@
 import { ITools } from '../../types/tool-interfaces.js';
 import { cleanObject } from '../../utils/safe-json.js';
 import type { HandlerArgs } from '../../types/handler-types.js';
-import { requireNonEmptyString, executeAutomationRequest } from './common-handlers.js';
+import { requireNonEmptyString, executeAutomationRequest, getBridgeWaitTimeoutMs } from './common-handlers.js';
 
 function getTimeoutMs(): number {
   const envDefault = Number(process.env.MCP_AUTOMATION_REQUEST_TIMEOUT_MS ?? '120000');
@@ -34,14 +35,14 @@ export async function handleAudioAuthoringTools(
   const timeoutMs = getTimeoutMs();
 
   // All actions are dispatched to C++ via automation bridge
-  const sendRequest = async (subAction: string): Promise<Record<string, unknown>> => {
+  const sendRequest = async (subAction: string, requestTimeoutMs = timeoutMs): Promise<Record<string, unknown>> => {
     const payload = { ...argsRecord, subAction };
     const result = await executeAutomationRequest(
       tools,
       'manage_audio_authoring',
       payload as HandlerArgs,
       `Automation bridge not available for audio authoring action: ${subAction}`,
-      { timeoutMs }
+      { timeoutMs: requestTimeoutMs }
     );
     return cleanObject(result) as Record<string, unknown>;
   };
@@ -232,6 +233,31 @@ export async function handleAudioAuthoringTools(
       return sendRequest('create_submix_effect');
     }
 
+    // =========================================================================
+    // 11.7 Declarative Graphs & Bulk Import (3 actions)
+    // =========================================================================
+
+    case 'apply_audio_graph': {
+      requireNonEmptyString(argsRecord.assetPath, 'assetPath', 'Missing required parameter: assetPath');
+      // Builds a whole cue or MetaSound graph from one spec; one save
+      // Required: spec. Optional: assetType (created when missing), save
+      return sendRequest('apply_audio_graph');
+    }
+
+    case 'create_sound_assets_from_folder': {
+      requireNonEmptyString(argsRecord.sourceFolder, 'sourceFolder', 'Missing required parameter: sourceFolder');
+      // Reads files on worker threads, imports and wraps them over editor ticks, flushes saves once
+      // Optional: destinationPath, recursive, extensions, wrap, wrapPath, wrapPrefix, overwrite, maxFiles, timeoutSeconds
+      // The bridge stops the job at timeoutSeconds and reports the files it did not reach
+      return sendRequest('create_sound_assets_from_folder', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 240, timeoutMs));
+    }
+
+    case 'benchmark_sound_import': {
+      // Generates waveCount sine waves (default 300) and times the import-and-wrap job
+      // Optional: waveCount, durationSeconds, wrap, path, cleanup, timeoutSeconds
+      return sendRequest('benchmark_sound_import', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 240, timeoutMs));
+    }
+
     // =========================================================================
     // Utility (1 action)
     // =========================================================================
@@ -406,6 +406,26 @@ export async function handleBlueprintTools(action: string, args: HandlerArgs, to
       }) as Record<string, unknown>;
       return cleanObject(res);
     }
+    case 'flush_compiles': {
+      const res = await executeAutomationRequest(tools, 'blueprint_flush_compiles', {}, undefined, {
+        timeoutMs: 300000
+      }) as Record<string, unknown>;
+      return cleanObject(res);
+    }
+    case 'get_compile_queue': {
+      const res = await executeAutomationRequest(tools, 'blueprint_get_compile_queue', {
+        includeBlueprints: argsRecord.includeBlueprints as boolean | undefined
+      }) as Record<string, unknown>;
+      return cleanObject(res);
+    }
+    case 'benchmark_compiles': {
+      const res = await executeAutomationRequest(tools, 'blueprint_benchmark_compiles', {
+        edits: argsRecord.edits as number | undefined,
+        path: argsRecord.path as string | undefined,
+        cleanup: argsRecord.cleanup as boolean | undefined
+      }, undefined, { timeoutMs: 600000 }) as Record<string, unknown>;
+      return cleanObject(res);
+    }
     case 'probe_handle': {
       const res = await executeAutomationRequest(tools, 'blueprint_probe_subobject_handle', {
         componentClass: (argsRecord.componentClass as string) ?? ''
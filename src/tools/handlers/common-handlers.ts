@@ -1,6 +1,7 @@
 import { ITools } from '../../types/tool-interfaces.js';
 import type { HandlerArgs, Vector3, Rotator } from '../../types/handler-types.js';
 import { getAdditionalPathPrefixes } from '../../config.js';
+import { ABSOLUTE_MAX_TIMEOUT_MS } from '../../constants.js';
 
 /**
  * Validates that args is not null/undefined.
@@ -144,6 +145,20 @@ export async function executeAutomationRequest(
   return await automationBridge.sendAutomationRequest(toolName, cleanedArgs, timeoutMs ? { timeoutMs } : {});
 }
 
+/** Longest bridge-side wait (timeoutSeconds) a request may ask for. */
+export const MAX_BRIDGE_WAIT_SECONDS = 240;
+
+/**
+ * Client timeout for a request the bridge answers once its own wait
+ * (timeoutSeconds, clamped to MAX_BRIDGE_WAIT_SECONDS) runs out: that wait
+ * plus a margin, never past the request tracker's absolute cap.
+ */
+export function getBridgeWaitTimeoutMs(timeoutSeconds: unknown, defaultSeconds: number, baseTimeoutMs: number): number {
+  const requested = typeof timeoutSeconds === 'number' && timeoutSeconds > 0 ? timeoutSeconds : defaultSeconds;
+  const seconds = Math.min(requested, MAX_BRIDGE_WAIT_SECONDS);
+  return Math.min(ABSOLUTE_MAX_TIMEOUT_MS, Math.max(baseTimeoutMs, seconds * 1000 + 30000));
+}
+
 /**
  * Normalize location to [x, y, z] array format
  * Accepts both {x,y,z} object and [x,y,z] array formats
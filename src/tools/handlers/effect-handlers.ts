@@ -267,7 +267,8 @@ export async function handleEffectTools(action: string, args: HandlerArgs, tools
     'add_collision_query_data_interface',
     'add_event_generator', 'add_event_receiver', 'configure_event_payload',
     'enable_gpu_simulation', 'add_simulation_stage',
-    'get_niagara_info', 'validate_niagara_system'
+    'get_niagara_info', 'validate_niagara_system',
+    'apply_niagara_spec', 'benchmark_niagara_spec'
   ];
   if (authoringActions.includes(action)) {
     return executeAutomationRequest(tools, 'manage_niagara_authoring', mutableArgs) as Promise<Record<string, unknown>>;
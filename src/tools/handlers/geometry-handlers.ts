@@ -47,7 +47,13 @@ const GEOMETRY_ACTIONS = [
   // Export/conversion
   'convert_to_static_mesh',
   // Utils
-  'get_mesh_info'
+  'get_mesh_info',
+  // Bulk buffer transfer
+  'set_mesh_buffers', 'get_mesh_buffers',
+  // Chained operations
+  'apply_geometry_pipeline',
+  // Background job control
+  'cancel_geometry_job', 'list_geometry_jobs'
 ] as const;
 
 type GeometryAction = (typeof GEOMETRY_ACTIONS)[number];
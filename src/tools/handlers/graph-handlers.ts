@@ -15,8 +15,8 @@ interface ProcessedGraphArgs extends GraphArgs {
 
 // Blueprint node type aliases: map human-friendly names to K2Node class names
 // NOTE: These aliases are applied in TS before sending to C++. The C++ plugin has
-// its own fallback alias map (McpAutomationBridge_BlueprintGraphHandlers.cpp) which
-// handles unmapped types. Keep these in sync with the C++ map.
+// its own fallback alias map (McpBlueprintGraphSpec.cpp) which handles unmapped
+// types and the node types inside apply_graph specs. Keep these in sync with the C++ map.
 const BLUEPRINT_NODE_ALIASES: Record<string, string> = {
     'Branch': 'K2Node_IfThenElse',
     'IfThenElse': 'K2Node_IfThenElse',
@@ -7,7 +7,7 @@
 import { ITools } from '../../types/tool-interfaces.js';
 import type { HandlerArgs } from '../../types/handler-types.js';
 import type { AutomationResponse } from '../../types/automation-responses.js';
-import { executeAutomationRequest } from './common-handlers.js';
+import { executeAutomationRequest, getBridgeWaitTimeoutMs, MAX_BRIDGE_WAIT_SECONDS } from './common-handlers.js';
 import {
   normalizeArgs,
   extractString,
@@ -30,6 +30,18 @@ function parseMaterialPath(fullPath: string | undefined): { name: string; path:
 import { ResponseFactory } from '../../utils/response-factory.js';
 import { TOOL_ACTIONS } from '../../utils/action-constants.js';
 
+function getTimeoutMs(): number {
+  const envDefault = Number(process.env.MCP_AUTOMATION_REQUEST_TIMEOUT_MS ?? '120000');
+  return Number.isFinite(envDefault) && envDefault > 0 ? envDefault : 120000;
+}
+
+/** Keep the structured compile report on failures (compile errors, timeouts). */
+function compileFailure(res: AutomationResponse, fallback: string): Record<string, unknown> {
+  return ResponseFactory.errorWithCode(res.errorCode ?? 'MATERIAL_COMPILE_ERROR', res.error ?? res.message ?? fallback, {
+    result: res.result,
+  }) as unknown as Record<string, unknown>;
+}
+
 /**
  * Handle material authoring actions
  */
@@ -825,23 +837,147 @@ export async function handleMaterialAuthoringTools(
         const params = normalizeArgs(args, [
           { key: 'assetPath', aliases: ['materialPath'], required: true },
           { key: 'save', default: true },
+          { key: 'wait', default: false },
+          { key: 'timeoutSeconds' },
         ]);
 
         const assetPath = extractString(params, 'assetPath');
         const save = extractOptionalBoolean(params, 'save') ?? true;
+        const wait = extractOptionalBoolean(params, 'wait') ?? false;
+        const timeoutSeconds = extractOptionalNumber(params, 'timeoutSeconds');
 
         const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_MATERIAL_AUTHORING, {
           subAction: 'compile_material',
           assetPath,
           save,
-        })) as AutomationResponse;
+          wait,
+          timeoutSeconds,
+        }, 'Automation bridge not available', wait ? { timeoutMs: getBridgeWaitTimeoutMs(timeoutSeconds, MAX_BRIDGE_WAIT_SECONDS, getTimeoutMs()) } : {})) as AutomationResponse;
 
         if (res.success === false) {
-          return ResponseFactory.error(res.error ?? 'Failed to compile material', res.errorCode);
+          return wait ? compileFailure(res, 'Failed to compile material')
+            : ResponseFactory.error(res.error ?? 'Failed to compile material', res.errorCode);
         }
         return ResponseFactory.success(res, res.message ?? 'Material compiled');
       }
 
+      // ===== 8.9 Edit Sessions =====
+      case 'begin_material_edit': {
+        const params = normalizeArgs(args, [
+          { key: 'assetPath', aliases: ['materialPath'], required: true },
+          { key: 'maxSeconds' },
+        ]);
+
+        const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_MATERIAL_AUTHORING, {
+          subAction: 'begin_material_edit',
+          assetPath: extractString(params, 'assetPath'),
+          maxSeconds: extractOptionalNumber(params, 'maxSeconds'),
+        })) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.error(res.error ?? 'Failed to open material edit session', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Material edit session opened');
+      }
+
+      case 'commit_material_edit': {
+        const params = normalizeArgs(args, [
+          { key: 'assetPath', aliases: ['materialPath'], required: true },
+          { key: 'save', default: false },
+          { key: 'wait', default: false },
+          { key: 'timeoutSeconds' },
+        ]);
+
+        const wait = extractOptionalBoolean(params, 'wait') ?? false;
+        const timeoutSeconds = extractOptionalNumber(params, 'timeoutSeconds');
+
+        const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_MATERIAL_AUTHORING, {
+          subAction: 'commit_material_edit',
+          assetPath: extractString(params, 'assetPath'),
+          save: extractOptionalBoolean(params, 'save') ?? false,
+          wait,
+          timeoutSeconds,
+        }, 'Automation bridge not available', wait ? { timeoutMs: getBridgeWaitTimeoutMs(timeoutSeconds, MAX_BRIDGE_WAIT_SECONDS, getTimeoutMs()) } : {})) as AutomationResponse;
+
+        if (res.success === false) {
+          return wait ? compileFailure(res, 'Failed to commit material edit session')
+            : ResponseFactory.error(res.error ?? 'Failed to commit material edit session', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Material edit session committed');
+      }
+
+      case 'get_material_edit_status': {
+        const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_MATERIAL_AUTHORING, {
+          subAction: 'get_material_edit_status',
+        })) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.error(res.error ?? 'Failed to get material edit status', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Material edit session status');
+      }
+
+      // ===== 8.10 Declarative Graphs =====
+      case 'apply_material_graph': {
+        const params = normalizeArgs(args, [
+          { key: 'assetPath', aliases: ['materialPath'], required: true },
+          { key: 'graph' },
+          { key: 'spec' },
+          { key: 'prune' },
+          { key: 'save', default: false },
+          { key: 'wait', default: false },
+          { key: 'timeoutSeconds' },
+        ]);
+
+        const graph = params.graph;
+        const spec = extractOptionalString(params, 'spec');
+        if ((typeof graph !== 'object' || graph === null) && !spec) {
+          return ResponseFactory.error("apply_material_graph requires 'graph' (object) or 'spec' (text)", 'INVALID_ARGUMENT');
+        }
+
+        const wait = extractOptionalBoolean(params, 'wait') ?? false;
+        const timeoutSeconds = extractOptionalNumber(params, 'timeoutSeconds');
+
+        const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_MATERIAL_AUTHORING, {
+          subAction: 'apply_material_graph',
+          assetPath: extractString(params, 'assetPath'),
+          graph: typeof graph === 'object' && graph !== null ? graph : undefined,
+          spec,
+          prune: extractOptionalBoolean(params, 'prune'),
+          save: extractOptionalBoolean(params, 'save') ?? false,
+          wait,
+          timeoutSeconds,
+        }, 'Automation bridge not available', wait ? { timeoutMs: getBridgeWaitTimeoutMs(timeoutSeconds, MAX_BRIDGE_WAIT_SECONDS, getTimeoutMs()) } : {})) as AutomationResponse;
+
+        if (res.success === false) {
+          return wait ? compileFailure(res, 'Failed to apply material graph')
+            : ResponseFactory.error(res.error ?? 'Failed to apply material graph', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Material graph applied');
+      }
+
+      case 'benchmark_material_graph': {
+        const params = normalizeArgs(args, [
+          { key: 'nodeCount', default: 100 },
+          { key: 'timeoutSeconds' },
+        ]);
+
+        const timeoutSeconds = extractOptionalNumber(params, 'timeoutSeconds') ?? MAX_BRIDGE_WAIT_SECONDS;
+
+        const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_MATERIAL_AUTHORING, {
+          subAction: 'benchmark_material_graph',
+          nodeCount: extractOptionalNumber(params, 'nodeCount') ?? 100,
+          timeoutSeconds,
+        }, 'Automation bridge not available', { timeoutMs: getBridgeWaitTimeoutMs(timeoutSeconds, MAX_BRIDGE_WAIT_SECONDS, getTimeoutMs()) })) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.errorWithCode(res.errorCode ?? 'BENCHMARK_FAILED', res.error ?? res.message ?? 'Material graph benchmark failed', {
+            result: res.result,
+          }) as unknown as Record<string, unknown>;
+        }
+        return ResponseFactory.success(res, res.message ?? 'Material graph benchmark complete');
+      }
+
       case 'get_material_info': {
         const params = normalizeArgs(args, [
           { key: 'assetPath', aliases: ['materialPath'], required: true },
@@ -1039,7 +1175,7 @@ export async function handleMaterialAuthoringTools(
 
       default:
         return ResponseFactory.error(
-          `Unknown material authoring action: ${action}. Available actions: create_material, set_blend_mode, set_shading_model, add_texture_sample, add_scalar_parameter, add_vector_parameter, add_math_node, connect_nodes, create_material_instance, set_scalar_parameter_value, set_vector_parameter_value, set_texture_parameter_value, compile_material, get_material_info`,
+          `Unknown material authoring action: ${action}. Available actions: create_material, set_blend_mode, set_shading_model, add_texture_sample, add_scalar_parameter, add_vector_parameter, add_math_node, connect_nodes, create_material_instance, set_scalar_parameter_value, set_vector_parameter_value, set_texture_parameter_value, compile_material, get_material_info, begin_material_edit, commit_material_edit, get_material_edit_status, apply_material_graph, benchmark_material_graph`,
           'UNKNOWN_ACTION'
         );
     }
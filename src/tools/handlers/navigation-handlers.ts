@@ -7,6 +7,10 @@
  * - Nav Links: create_nav_link_proxy, configure_nav_link, set_nav_link_type,
  *              create_smart_link, configure_smart_link_behavior
  * - Utility: get_navigation_info
+ * - Queries: find_paths, reachability_matrix, project_points_to_navmesh,
+ *            benchmark_navigation_queries
+ * - Build control: begin_nav_batch, end_nav_batch, get_nav_build_status,
+ *                  benchmark_nav_rebuild
  *
  * @module navigation-handlers
  */
@@ -14,7 +18,7 @@
 import { ITools } from '../../types/tool-interfaces.js';
 import { cleanObject } from '../../utils/safe-json.js';
 import type { HandlerArgs } from '../../types/handler-types.js';
-import { executeAutomationRequest } from './common-handlers.js';
+import { executeAutomationRequest, getBridgeWaitTimeoutMs } from './common-handlers.js';
 
 function getTimeoutMs(): number {
   const envDefault = Number(process.env.MCP_AUTOMATION_REQUEST_TIMEOUT_MS ?? '120000');
@@ -65,14 +69,14 @@ export async function handleNavigationTools(
   const timeoutMs = getTimeoutMs();
 
   // All actions are dispatched to C++ via automation bridge
-  const sendRequest = async (subAction: string): Promise<Record<string, unknown>> => {
+  const sendRequest = async (subAction: string, requestTimeoutMs = timeoutMs): Promise<Record<string, unknown>> => {
     const payload = { ...argsRecord, subAction };
     const result = await executeAutomationRequest(
       tools,
       'manage_navigation',
       payload as HandlerArgs,
       `Automation bridge not available for navigation action: ${subAction}`,
-      { timeoutMs }
+      { timeoutMs: requestTimeoutMs }
     );
     return cleanObject(result) as Record<string, unknown>;
   };
@@ -88,7 +92,9 @@ export async function handleNavigationTools(
       return sendRequest('set_nav_agent_properties');
 
     case 'rebuild_navigation':
-      return sendRequest('rebuild_navigation');
+      return argsRecord.mode === 'incremental'
+        ? sendRequest('rebuild_navigation', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 120, timeoutMs))
+        : sendRequest('rebuild_navigation');
 
     // ========================================================================
     // Nav Modifiers (3 actions)
@@ -126,6 +132,36 @@ export async function handleNavigationTools(
     case 'get_navigation_info':
       return sendRequest('get_navigation_info');
 
+    // ========================================================================
+    // Queries (4 actions) - wait for dirty tiles to rebuild before running
+    // ========================================================================
+    case 'find_paths':
+      return sendRequest('find_paths', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 120, timeoutMs));
+
+    case 'reachability_matrix':
+      return sendRequest('reachability_matrix', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 120, timeoutMs));
+
+    case 'project_points_to_navmesh':
+      return sendRequest('project_points_to_navmesh', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 120, timeoutMs));
+
+    case 'benchmark_navigation_queries':
+      return sendRequest('benchmark_navigation_queries', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 120, timeoutMs));
+
+    // ========================================================================
+    // Build Control (4 actions)
+    // ========================================================================
+    case 'begin_nav_batch':
+      return sendRequest('begin_nav_batch');
+
+    case 'end_nav_batch':
+      return sendRequest('end_nav_batch', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 120, timeoutMs));
+
+    case 'get_nav_build_status':
+      return sendRequest('get_nav_build_status');
+
+    case 'benchmark_nav_rebuild':
+      return sendRequest('benchmark_nav_rebuild', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 240, timeoutMs));
+
     default:
       return cleanObject({
         success: false,
@@ -7,6 +7,7 @@
  * - Parameters & Data Interfaces (user parameters, mesh/spline/audio data interfaces)
  * - Events & GPU Simulation
  * - Utility (get info, validate)
+ * - Declarative specs (apply a whole system in one pass, benchmark it)
  *
  * @module niagara-authoring-handlers
  */
@@ -14,7 +15,7 @@
 import { ITools } from '../../types/tool-interfaces.js';
 import { cleanObject } from '../../utils/safe-json.js';
 import type { HandlerArgs } from '../../types/handler-types.js';
-import { requireNonEmptyString, executeAutomationRequest } from './common-handlers.js';
+import { requireNonEmptyString, executeAutomationRequest, getBridgeWaitTimeoutMs } from './common-handlers.js';
 
 function getTimeoutMs(): number {
   const envDefault = Number(process.env.MCP_AUTOMATION_REQUEST_TIMEOUT_MS ?? '120000');
@@ -61,14 +62,14 @@ export async function handleNiagaraAuthoringTools(
   }
 
   // All actions are dispatched to C++ via automation bridge
-  const sendRequest = async (subAction: string): Promise<Record<string, unknown>> => {
+  const sendRequest = async (subAction: string, requestTimeoutMs: number = timeoutMs): Promise<Record<string, unknown>> => {
     const payload = { ...argsRecord, subAction };
     const result = await executeAutomationRequest(
       tools,
       'manage_niagara_authoring',
       payload as HandlerArgs,
       `Automation bridge not available for Niagara authoring action: ${subAction}`,
-      { timeoutMs }
+      { timeoutMs: requestTimeoutMs }
     );
     return cleanObject(result) as Record<string, unknown>;
   };
@@ -312,6 +313,29 @@ export async function handleNiagaraAuthoringTools(
       return sendRequest('validate_niagara_system');
     }
 
+    // =========================================================================
+    // 12.6 Declarative Specs (2 actions)
+    // =========================================================================
+
+    case 'apply_niagara_spec': {
+      requireNonEmptyString(argsRecord.systemPath, 'systemPath', 'Missing required parameter: systemPath');
+      if (typeof argsRecord.spec !== 'object' || argsRecord.spec === null) {
+        return cleanObject({
+          success: false,
+          error: 'INVALID_ARGUMENT',
+          message: "apply_niagara_spec requires 'spec' (object)"
+        });
+      }
+      const wait = argsRecord.wait !== false;
+      return sendRequest('apply_niagara_spec', wait ? getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 240, timeoutMs) : timeoutMs);
+    }
+
+    case 'benchmark_niagara_spec': {
+      requireNonEmptyString(argsRecord.systemPath, 'systemPath', 'Missing required parameter: systemPath (template system)');
+      requireNonEmptyString(argsRecord.sourceEmitter, 'sourceEmitter', 'Missing required parameter: sourceEmitter');
+      return sendRequest('benchmark_niagara_spec', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 240, timeoutMs));
+    }
+
     // =========================================================================
     // Default / Unknown Action
     // =========================================================================
@@ -13,6 +13,9 @@ const VALID_PROFILING_TYPES = ['cpu', 'gpu', 'memory', 'renderthread', 'all', 'f
 const MIN_SCALABILITY_LEVEL = 0;
 const MAX_SCALABILITY_LEVEL = 4;
 
+// Bridge clamps run_benchmark to 240s sampling + 30s warm-up
+const MAX_BENCHMARK_TIMEOUT_MS = 300000;
+
 export async function handlePerformanceTools(action: string, args: HandlerArgs, tools: ITools): Promise<Record<string, unknown>> {
   const argsTyped = args as PerformanceArgs;
   const argsRecord = args as Record<string, unknown>;
@@ -40,21 +43,23 @@ export async function handlePerformanceTools(action: string, args: HandlerArgs,
       return cleanObject(res);
     }
     case 'run_benchmark': {
-      // Run benchmark using console commands with timing
-      const duration = typeof argsTyped.duration === 'number' ? argsTyped.duration : 60;
-      
-      // Start recording
-      await executeAutomationRequest(tools, TOOL_ACTIONS.CONSOLE_COMMAND, { command: 'stat startfile' });
-      await executeAutomationRequest(tools, TOOL_ACTIONS.CONSOLE_COMMAND, { command: 'profilegpu' });
-      
-      // Wait for duration
-      await new Promise(resolve => setTimeout(resolve, duration * 1000));
-      
-      // Stop recording
-      await executeAutomationRequest(tools, TOOL_ACTIONS.CONSOLE_COMMAND, { command: 'stat stopfile' });
-      await executeAutomationRequest(tools, TOOL_ACTIONS.CONSOLE_COMMAND, { command: 'stat none' });
-      
-      return { success: true, message: `Benchmark completed for ${duration} seconds` };
+      // The bridge samples frame times itself and responds when the run ends
+      const duration = typeof argsTyped.duration === 'number' ? argsTyped.duration : 10;
+      const warmup = typeof argsTyped.warmupSeconds === 'number' ? argsTyped.warmupSeconds : 2;
+      const timeoutMs = argsTyped.sequencePath
+        ? MAX_BENCHMARK_TIMEOUT_MS
+        : Math.min(MAX_BENCHMARK_TIMEOUT_MS, (duration + warmup) * 1000 + 30000);
+      const res = await executeAutomationRequest(tools, TOOL_ACTIONS.RUN_BENCHMARK, {
+        duration,
+        warmupSeconds: argsTyped.warmupSeconds,
+        hitchThresholdMs: argsTyped.hitchThresholdMs,
+        cameraPath: argsTyped.cameraPath,
+        sequencePath: argsTyped.sequencePath,
+        label: argsTyped.label,
+        baseline: argsTyped.baseline,
+        regressionThresholdPct: argsTyped.regressionThresholdPct
+      }, undefined, { timeoutMs }) as Record<string, unknown>;
+      return cleanObject(res);
     }
     case 'show_fps': {
       const res = await executeAutomationRequest(tools, TOOL_ACTIONS.SHOW_FPS, {
@@ -110,7 +115,30 @@ export async function handlePerformanceTools(action: string, args: HandlerArgs,
     case 'generate_memory_report': {
       const res = await executeAutomationRequest(tools, TOOL_ACTIONS.GENERATE_MEMORY_REPORT, {
         detailed: argsTyped.detailed,
-        outputPath: argsTyped.outputPath
+        outputPath: argsTyped.outputPath,
+        label: argsTyped.label,
+        include: argsTyped.include,
+        topClasses: argsTyped.topClasses
+      }) as Record<string, unknown>;
+      return cleanObject(res);
+    }
+    case 'diff_memory_reports': {
+      if (!argsTyped.baseline) {
+        return ResponseFactory.error('diff_memory_reports requires baseline (snapshot id or .json path)');
+      }
+      const res = await executeAutomationRequest(tools, TOOL_ACTIONS.DIFF_MEMORY_REPORTS, {
+        baseline: argsTyped.baseline,
+        current: argsTyped.current,
+        label: argsTyped.label,
+        limit: argsTyped.limit
+      }) as Record<string, unknown>;
+      return cleanObject(res);
+    }
+    case 'get_request_profile': {
+      const res = await executeAutomationRequest(tools, TOOL_ACTIONS.GET_REQUEST_PROFILE, {
+        limit: argsTyped.limit,
+        actionFilter: argsTyped.actionFilter,
+        reset: argsTyped.reset
       }) as Record<string, unknown>;
       return cleanObject(res);
     }
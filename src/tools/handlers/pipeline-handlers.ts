@@ -228,6 +228,132 @@ function findUbtExecutable(): string {
   return '';
 }
 
+// Polling cadence for bridge-side UBT jobs. A build can run far past the
+// request tracker's progress-extension cap, so run_ubt starts the job without
+// waiting and follows it with short get_ubt_job requests instead.
+const UBT_POLL_INTERVAL_MS = 2000;
+const UBT_POLL_MAX_LINES = 500;
+const UBT_DEFAULT_TIMEOUT_SECONDS = 3600;
+const UBT_JOB_ACTIONS = new Set(['get_ubt_job', 'cancel_ubt_job', 'list_ubt_jobs']);
+
+export function isUbtJobAction(action: string): boolean {
+  return UBT_JOB_ACTIONS.has(action);
+}
+
+type BridgeResponse = Record<string, unknown> & { result?: Record<string, unknown> };
+
+function responseData(res: unknown): Record<string, unknown> {
+  const r = (res ?? {}) as BridgeResponse;
+  return (r.result && typeof r.result === 'object') ? r.result : r;
+}
+
+/**
+ * Poll a bridge-side job with short get_ubt_job requests until it finishes,
+ * echoing new output lines to stderr the way the local spawn path does.
+ */
+async function followBridgeJob(
+  tools: ITools,
+  toolName: string,
+  jobId: string,
+  timeoutSeconds: number,
+  label: string,
+  failureCode: string
+): Promise<unknown> {
+  let sinceLine = 0;
+  // The bridge enforces timeoutSeconds; the extra minute covers queueing
+  const deadline = Date.now() + (timeoutSeconds + 60) * 1000;
+  while (Date.now() < deadline) {
+    await new Promise(resolve => setTimeout(resolve, UBT_POLL_INTERVAL_MS));
+
+    const polled = await executeAutomationRequest(
+      tools,
+      toolName,
+      { subAction: 'get_ubt_job', jobId, sinceLine, maxLines: UBT_POLL_MAX_LINES },
+      `Automation bridge not available for ${toolName}`
+    ) as BridgeResponse;
+    if (polled.success === false) {
+      return polled;
+    }
+
+    const job = responseData(polled);
+    const lines = Array.isArray(job.lines) ? job.lines as string[] : [];
+    if (lines.length > 0) {
+      process.stderr.write(lines.join('\n') + '\n');
+    }
+    if (typeof job.nextLine === 'number') {
+      sinceLine = job.nextLine;
+    }
+
+    const state = job.state;
+    if (state === 'queued' || state === 'running') {
+      continue;
+    }
+
+    delete job.lines;
+    const tests = job.tests as { failed?: number } | undefined;
+    const succeeded = state === 'succeeded' && !(tests && (tests.failed ?? 0) > 0);
+    const errorCode = state === 'cancelled' ? 'CANCELLED' : state === 'timed_out' ? 'TIMEOUT' : failureCode;
+    return {
+      success: succeeded,
+      ...(succeeded ? {} : { error: errorCode }),
+      message: succeeded
+        ? `${label} finished successfully`
+        : tests && state === 'succeeded'
+          ? `${label}: ${tests.failed} tests failed`
+          : `${label} ${state === 'failed' ? `failed with code ${job.returnCode}` : state}`,
+      ...job
+    };
+  }
+
+  return {
+    success: false,
+    error: 'TIMEOUT',
+    message: `Stopped waiting for job ${jobId}; it may still be running (see get_ubt_job)`,
+    jobId
+  };
+}
+
+/**
+ * Start run_ubt as a bridge-side job and poll it to completion.
+ */
+async function runUbtOnBridge(args: PipelineArgs, tools: ITools): Promise<unknown> {
+  const timeoutSeconds = args.timeoutSeconds ?? UBT_DEFAULT_TIMEOUT_SECONDS;
+
+  const started = await executeAutomationRequest(
+    tools,
+    'manage_pipeline',
+    { ...args, subAction: 'run_ubt', wait: false, timeoutSeconds },
+    'Automation bridge not available for manage_pipeline'
+  ) as BridgeResponse;
+
+  const jobId = responseData(started).jobId;
+  if (args.wait === false || started.success === false || typeof jobId !== 'string') {
+    return started;
+  }
+  return await followBridgeJob(tools, 'manage_pipeline', jobId, timeoutSeconds, 'UnrealBuildTool', 'UBT_FAILED');
+}
+
+/**
+ * run_tests: the bridge runs the tests in a headless editor process and
+ * returns a jobId; with wait=true the job is polled like a bridge-side build.
+ */
+export async function runTestsOnBridge(args: PipelineArgs, tools: ITools): Promise<unknown> {
+  const timeoutSeconds = args.timeoutSeconds ?? UBT_DEFAULT_TIMEOUT_SECONDS;
+
+  const started = await executeAutomationRequest(
+    tools,
+    'manage_tests',
+    { ...args, subAction: 'run_tests', wait: false, timeoutSeconds },
+    'Bridge unavailable'
+  ) as BridgeResponse;
+
+  const jobId = responseData(started).jobId;
+  if (args.wait !== true || started.success === false || typeof jobId !== 'string') {
+    return started;
+  }
+  return await followBridgeJob(tools, 'manage_pipeline', jobId, timeoutSeconds, 'Automation tests', 'TESTS_FAILED');
+}
+
 export async function handlePipelineTools(action: string, args: PipelineArgs, tools: ITools) {
   switch (action) {
     case 'run_ubt': {
@@ -247,13 +373,7 @@ export async function handlePipelineTools(action: string, args: PipelineArgs, to
       if (!discoveredUbtPath) {
         // UBT not found on TS side — delegate to C++ handler which uses
         // FPaths::EngineDir() and always knows the correct engine root.
-        const res = await executeAutomationRequest(
-          tools,
-          'manage_pipeline',
-          { ...args, subAction: action },
-          'Automation bridge not available for manage_pipeline'
-        );
-        return cleanObject(res);
+        return cleanObject(await runUbtOnBridge(args, tools));
       }
 
       let projectPath = process.env.UE_PROJECT_PATH;
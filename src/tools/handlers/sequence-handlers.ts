@@ -286,6 +286,31 @@ export async function handleSequenceTools(action: string, args: Record<string, u
 
       return cleanObject(res);
     }
+    case 'set_keys': {
+      const path = requireNonEmptyString(args.path, 'path', 'Missing required parameter: path');
+      if (!Array.isArray(args.channels) || args.channels.length === 0) {
+        throw new Error('Missing required parameter: channels (array of { channel, frames, values })');
+      }
+      const res = await executeAutomationRequest(tools, 'manage_sequence', {
+        ...args,
+        path,
+        subAction: 'set_keys'
+      }) as SequenceActionResponse;
+      if (res && res.success === false) {
+        const errorCode = getErrorString(res).toUpperCase();
+        const msgLower = getMessageString(res).toLowerCase();
+        if (errorCode === 'INVALID_SEQUENCE' || msgLower.includes('sequence not found')) {
+          return cleanObject({
+            success: false,
+            error: 'NOT_FOUND',
+            message: res.message || 'Sequence not found',
+            action: 'set_keys',
+            path
+          });
+        }
+      }
+      return cleanObject(res);
+    }
     case 'add_spawnable_from_class': {
       const className = requireNonEmptyString(args.className, 'className', 'Missing required parameter: className');
       const path = requireNonEmptyString(args.path, 'path', 'Missing required parameter: path');
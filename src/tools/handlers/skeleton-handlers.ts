@@ -23,6 +23,7 @@ const SKELETON_ACTIONS = [
   'auto_skin_weights', 'set_vertex_weights',
   'normalize_weights', 'prune_weights',
   'copy_weights', 'mirror_weights',
+  'process_skin_weights', 'benchmark_skin_weights',
   // 7.3 Physics Asset
   'create_physics_asset',
   'add_physics_body', 'configure_physics_body',
@@ -148,13 +149,18 @@ export async function handleSkeletonTools(
   // Normalize arguments
   const normalizedArgs = normalizeSkeletonArgs(action, args);
 
+  // Weight kernels and their benchmark finish with a full mesh rebuild or
+  // run several passes over large synthetic meshes
+  const longRunning = action.endsWith('_weights') && action !== 'set_vertex_weights';
+
   // Route to C++ handler
   try {
     const response = await executeAutomationRequest(
       tools,
       'manage_skeleton',
       normalizedArgs,
-      `Automation bridge not available for skeleton action: ${action}`
+      `Automation bridge not available for skeleton action: ${action}`,
+      longRunning ? { timeoutMs: 300000 } : undefined
     );
 
     return cleanObject(response as Record<string, unknown>);
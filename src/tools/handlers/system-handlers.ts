@@ -524,6 +524,32 @@ export async function handleSystemTools(action: string, args: HandlerArgs, tools
       const metadata = (argsTyped as Record<string, unknown>).metadata;
       const resolution = (argsTyped as Record<string, unknown>).resolution;
 
+      // Crop/scale/format options are only understood by the async capture
+      // pipeline in the system_control handler; the control_editor path just
+      // queues an engine screenshot at full resolution.
+      const captureArgs = argsTyped as Record<string, unknown>;
+      const captureKeys = ['format', 'quality', 'crop', 'maxWidth', 'maxHeight', 'scale', 'delivery', 'returnBase64'];
+      if (captureKeys.some((key) => captureArgs[key] !== undefined)) {
+        const res = await executeAutomationRequest(tools, 'system_control', {
+          action: 'screenshot',
+          filename: filenameArg,
+          format: captureArgs.format,
+          quality: captureArgs.quality,
+          crop: captureArgs.crop,
+          maxWidth: captureArgs.maxWidth,
+          maxHeight: captureArgs.maxHeight,
+          scale: captureArgs.scale,
+          delivery: captureArgs.delivery,
+          returnBase64: captureArgs.returnBase64
+        }, undefined, { timeoutMs: 30000 }) as Record<string, unknown>;
+        const cleanedCaptureRes = typeof res === 'object' && res !== null ? res : {};
+        return cleanObject({
+          ...cleanedCaptureRes,
+          metadata,
+          action: 'screenshot'
+        });
+      }
+
       if (includeMetadata) {
         const baseName = filenameArg && filenameArg.trim().length > 0
           ? filenameArg.trim()
@@ -708,6 +734,43 @@ export async function handleSystemTools(action: string, args: HandlerArgs, tools
         exportPath
       });
     }
+    case 'unsubscribe_viewport_stream': {
+      const res = await executeAutomationRequest(tools, 'system_control', args, 'Automation bridge not available for system control operations') as OperationResponse;
+      const streamId = (argsTyped as Record<string, unknown>).streamId;
+      if (typeof streamId === 'string') {
+        tools.automationBridge?.clearViewportFrames(streamId);
+      }
+      return cleanObject(res) as Record<string, unknown>;
+    }
+    case 'get_viewport_frame': {
+      // Frames are pushed by the plugin as binary messages; this returns the
+      // latest one without triggering a new capture.
+      const streamIdArg = (argsTyped as Record<string, unknown>).streamId;
+      const streamId = typeof streamIdArg === 'string' && streamIdArg.length > 0 ? streamIdArg : undefined;
+      const frame = tools.automationBridge?.getLatestViewportFrame(streamId);
+      if (!frame) {
+        return {
+          success: false,
+          error: 'NO_FRAME',
+          message: streamId
+            ? `No frame received yet for viewport stream ${streamId}`
+            : 'No viewport stream frames received yet (call subscribe_viewport_stream first)',
+          action: 'get_viewport_frame'
+        };
+      }
+      return {
+        success: true,
+        action: 'get_viewport_frame',
+        streamId: frame.streamId,
+        sequence: frame.sequence,
+        width: frame.width,
+        height: frame.height,
+        mimeType: frame.mimeType,
+        ageMs: Date.now() - frame.receivedAt.getTime(),
+        dropped: frame.dropped,
+        imageBase64: frame.data.toString('base64')
+      };
+    }
     default: {
       const res = await executeAutomationRequest(tools, 'system_control', args, 'Automation bridge not available for system control operations');
       return cleanObject(res) as Record<string, unknown>;
@@ -802,6 +802,27 @@ export async function handleTextureTools(
         return ResponseFactory.success(res, res.message ?? 'Texture info retrieved');
       }
 
+      case 'benchmark_image_kernels': {
+        const params = normalizeArgs(args, [
+          { key: 'sizes' },
+          { key: 'iterations', default: 3 },
+        ]);
+
+        const sizes = extractOptionalArray(params, 'sizes');
+        const iterations = extractOptionalNumber(params, 'iterations') ?? 3;
+
+        const res = (await executeAutomationRequest(tools, TOOL_ACTIONS.MANAGE_TEXTURE, {
+          subAction: 'benchmark_image_kernels',
+          sizes,
+          iterations,
+        }, undefined, { timeoutMs: 600000 })) as AutomationResponse;
+
+        if (res.success === false) {
+          return ResponseFactory.error(res.error ?? 'Failed to benchmark image kernels', res.errorCode);
+        }
+        return ResponseFactory.success(res, res.message ?? 'Image kernels benchmarked');
+      }
+
       // ===== Additional Actions for Test Compatibility =====
       case 'import_texture': {
         const params = normalizeArgs(args, [
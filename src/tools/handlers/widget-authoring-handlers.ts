@@ -10,6 +10,7 @@
  * - Widget Animations (animation tracks, keyframes, playback)
  * - UI Templates (main menu, pause menu, HUD, inventory, etc.)
  * - Utility (info queries, preview)
+ * - Declarative trees (whole-tree spec with one compile, benchmark)
  *
  * @module widget-authoring-handlers
  */
@@ -17,7 +18,7 @@
 import { ITools } from '../../types/tool-interfaces.js';
 import { cleanObject } from '../../utils/safe-json.js';
 import type { HandlerArgs } from '../../types/handler-types.js';
-import { requireNonEmptyString, executeAutomationRequest } from './common-handlers.js';
+import { requireNonEmptyString, executeAutomationRequest, getBridgeWaitTimeoutMs } from './common-handlers.js';
 
 function getTimeoutMs(): number {
   const envDefault = Number(process.env.MCP_AUTOMATION_REQUEST_TIMEOUT_MS ?? '120000');
@@ -64,14 +65,14 @@ export async function handleWidgetAuthoringTools(
   const timeoutMs = getTimeoutMs();
 
   // All actions are dispatched to C++ via automation bridge
-  const sendRequest = async (subAction: string): Promise<Record<string, unknown>> => {
+  const sendRequest = async (subAction: string, requestTimeoutMs = timeoutMs): Promise<Record<string, unknown>> => {
     const payload = { ...argsRecord, subAction };
     const result = await executeAutomationRequest(
       tools,
       'manage_widget_authoring',
       payload as HandlerArgs,
       `Automation bridge not available for widget authoring action: ${subAction}`,
-      { timeoutMs }
+      { timeoutMs: requestTimeoutMs }
     );
     return cleanObject(result) as Record<string, unknown>;
   };
@@ -590,6 +591,24 @@ export async function handleWidgetAuthoringTools(
       return sendRequest('preview_widget');
     }
 
+    // =========================================================================
+    // 19.17 Declarative Trees (2 actions)
+    // =========================================================================
+
+    case 'apply_widget_tree': {
+      requireNonEmptyString(argsRecord.widgetPath, 'widgetPath', 'Missing required parameter: widgetPath');
+      // Diffs a nested widget spec against the tree; one transaction, one compile
+      // Required: spec { root, prune }. Optional: prune, compile, save
+      return sendRequest('apply_widget_tree');
+    }
+
+    case 'benchmark_widget_tree': {
+      // Builds an N-widget HUD per widget and as one spec in temporary widget blueprints
+      // Optional: widgetCount (default 80), path, compileEach, cleanup, timeoutSeconds
+      // Runs over editor ticks with progress; the bridge stops it at timeoutSeconds
+      return sendRequest('benchmark_widget_tree', getBridgeWaitTimeoutMs(argsRecord.timeoutSeconds, 240, timeoutMs));
+    }
+
     // =========================================================================
     // Default / Unknown Action
     // =========================================================================
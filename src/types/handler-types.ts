@@ -316,6 +316,19 @@ export interface SequenceArgs extends HandlerArgs {
     muted?: boolean;
     solo?: boolean;
     locked?: boolean;
+    bindingId?: string;
+    channels?: Array<{
+        channel?: string;
+        frames: number[];
+        values: number[];
+        interpolation?: 'cubic' | 'linear' | 'constant';
+        tolerance?: number;
+    }>;
+    interpolation?: 'cubic' | 'linear' | 'constant';
+    timeUnit?: 'frames' | 'seconds';
+    tolerance?: number;
+    replace?: boolean;
+    save?: boolean;
 }
 
 // ============================================================================
@@ -533,6 +546,19 @@ export interface PerformanceArgs extends HandlerArgs {
     maxFPS?: number;
     verbose?: boolean;
     detailed?: boolean;
+    label?: string;
+    include?: string[];
+    topClasses?: number;
+    baseline?: string;
+    current?: string;
+    limit?: number;
+    warmupSeconds?: number;
+    hitchThresholdMs?: number;
+    cameraPath?: Array<{ location?: Vector3; rotation?: Rotator }>;
+    sequencePath?: string;
+    regressionThresholdPct?: number;
+    actionFilter?: string;
+    reset?: boolean;
 }
 
 // ============================================================================
@@ -646,6 +672,11 @@ export interface PipelineArgs extends HandlerArgs {
     configuration?: string;
     arguments?: string;
     projectPath?: string;
+    wait?: boolean;
+    timeoutSeconds?: number;
+    jobId?: string;
+    sinceLine?: number;
+    maxLines?: number;
 }
 
 // ============================================================================
@@ -703,6 +734,14 @@ export interface AnimationArgs extends HandlerArgs {
     // Animation asset
     assetType?: string;
     
+    // Bulk keys (set_bone_track_keys / set_curves)
+    tracks?: Array<{ boneName: string; positions?: string | number[]; rotations?: string | number[]; scales?: string | number[] }>;
+    curves?: Array<{ curveName: string; values: string | number[]; times?: string | number[]; frames?: string | number[]; interpolation?: 'cubic' | 'linear' | 'constant' }>;
+    rotationFormat?: 'quat' | 'euler';
+    numFrames?: number;
+    frameRate?: number;
+    recompress?: boolean;
+    
     // Notify
     animationPath?: string;
     assetPath?: string;
@@ -859,6 +898,9 @@ export interface GameFrameworkArgs extends HandlerArgs {
 // Navigation System Types (Phase 25)
 // ============================================================================
 
+/** A navigation query point: coordinates or the name/label of an actor. */
+export type NavQueryPoint = Vector3 | [number, number, number] | string;
+
 /**
  * Arguments for manage_navigation tool (Phase 25)
  * 
@@ -928,6 +970,30 @@ export interface NavigationArgs extends HandlerArgs {
     // Query parameters
     filter?: string;
     
+    // Path / reachability / projection queries
+    pairs?: Array<{ start: NavQueryPoint; end: NavQueryPoint }>;
+    sources?: NavQueryPoint[];
+    targets?: NavQueryPoint[];
+    points?: NavQueryPoint[];
+    mode?: 'path' | 'test' | 'full' | 'incremental';
+    includePoints?: boolean;
+    simplifyTolerance?: number;
+    queryExtent?: Vector3;
+    filterClass?: string;
+    projectEndpoints?: boolean;
+    allowPartial?: boolean;
+    parallel?: boolean;
+    numPaths?: number;
+    iterations?: number;
+    
+    // Navmesh build control (batches, incremental rebuild, rebuild benchmark)
+    maxSeconds?: number;
+    wait?: boolean;
+    timeoutSeconds?: number;
+    actorCount?: number;
+    spacing?: number;
+    actorScale?: number;
+    
     // Save option
     save?: boolean;
 }
@@ -117,6 +117,9 @@ export const TOOL_ACTIONS = {
   SET_VSYNC: 'set_vsync',
   SET_FRAME_RATE_LIMIT: 'set_frame_rate_limit',
   GENERATE_MEMORY_REPORT: 'generate_memory_report',
+  DIFF_MEMORY_REPORTS: 'diff_memory_reports',
+  GET_REQUEST_PROFILE: 'get_request_profile',
+  RUN_BENCHMARK: 'run_benchmark',
   CONFIGURE_TEXTURE_STREAMING: 'configure_texture_streaming',
   CONFIGURE_LOD: 'configure_lod',
   MERGE_ACTORS: 'merge_actors',
@@ -18,6 +18,28 @@ const ADV_TEST_FOLDER = '/Game/AdvancedIntegrationTest';
 
 const testCases = [
   { scenario: 'System: execute safe console command (log)', toolName: 'system_control', arguments: { action: 'execute_command', command: 'Log Integration test started' }, expected: 'success|handled|blocked' },
+  { scenario: 'System: downscaled JPEG screenshot', toolName: 'system_control', arguments: { action: 'screenshot', filename: 'IntegrationCapture', format: 'jpeg', quality: 80, maxWidth: 1280 }, expected: 'success|NO_VIEWPORT' },
+  { scenario: 'System: viewport stream stats (no streams)', toolName: 'system_control', arguments: { action: 'get_viewport_stream_stats' }, expected: 'success' },
+  { scenario: 'System: list UBT jobs', toolName: 'system_control', arguments: { action: 'list_ubt_jobs' }, expected: 'success' },
+  { scenario: 'System: get unknown UBT job', toolName: 'manage_pipeline', arguments: { action: 'get_ubt_job', jobId: 'build_missing' }, expected: 'not found' },
+  { scenario: 'Performance: capture platform-only memory snapshot', toolName: 'manage_performance', arguments: { action: 'generate_memory_report', include: ['platform'], label: 'integration' }, expected: 'success' },
+  { scenario: 'Performance: diff against unknown memory snapshot', toolName: 'manage_performance', arguments: { action: 'diff_memory_reports', baseline: 'mem_missing' }, expected: 'not found' },
+  { scenario: 'Performance: short benchmark run', toolName: 'manage_performance', arguments: { action: 'run_benchmark', duration: 1, warmupSeconds: 0, label: 'integration' }, expected: 'success' },
+  { scenario: 'Performance: benchmark against unknown baseline', toolName: 'manage_performance', arguments: { action: 'run_benchmark', duration: 1, baseline: 'bench_missing' }, expected: 'not found' },
+  { scenario: 'Insights: list recorded traces', toolName: 'system_control', arguments: { action: 'list_traces', limit: 5 }, expected: 'success' },
+  { scenario: 'Insights: analyze unknown trace', toolName: 'system_control', arguments: { action: 'analyze_trace', filePath: 'missing_trace.utrace' }, expected: 'not found' },
+  { scenario: 'Performance: recent request profile', toolName: 'manage_performance', arguments: { action: 'get_request_profile', limit: 5 }, expected: 'success' },
+  { scenario: 'Sequencer: bulk keys on missing sequence', toolName: 'manage_sequence', arguments: { action: 'set_keys', path: '/Game/Missing/SEQ_Missing', actorName: 'Missing', channels: [{ channel: 'location.z', frames: [0, 10, 20], values: [0, 50, 100] }] }, expected: 'not found' },
+  { scenario: 'Skeleton: benchmark skin weight kernels', toolName: 'manage_skeleton', arguments: { action: 'benchmark_skin_weights', vertexCounts: [10000], iterations: 1 }, expected: 'success' },
+  { scenario: 'Skeleton: copy skeletal cube for weight edits', toolName: 'manage_asset', arguments: { action: 'duplicate', sourcePath: '/Engine/EngineMeshes/SkeletalCube', destinationPath: `${TEST_FOLDER}/SK_WeightCube` }, expected: 'success|already exists|not found' },
+  { scenario: 'Skeleton: auto weights stay within maxInfluences after smoothing', toolName: 'manage_skeleton', arguments: { action: 'auto_skin_weights', skeletalMeshPath: `${TEST_FOLDER}/SK_WeightCube`, maxInfluences: 2, smoothIterations: 2, save: false }, expected: 'success|not found' },
+  { scenario: 'Skeleton: process weights on missing mesh', toolName: 'manage_skeleton', arguments: { action: 'process_skin_weights', skeletalMeshPath: '/Game/Missing/SK_Missing', operations: ['normalize'] }, expected: 'not found' },
+  { scenario: 'Animation: bulk bone track keys on missing sequence', toolName: 'animation_physics', arguments: { action: 'set_bone_track_keys', assetPath: '/Game/Missing/AS_Missing', tracks: [{ boneName: 'root', positions: [0, 0, 0, 0, 0, 10, 0, 0, 20] }], save: false }, expected: 'not found' },
+  { scenario: 'Navigation: reachability from unknown actor', toolName: 'manage_navigation', arguments: { action: 'reachability_matrix', sources: ['MissingSpawnPoint'], targets: [[0, 0, 0]] }, expected: 'not found|NO_NAVMESH' },
+  { scenario: 'Navigation: build status', toolName: 'manage_navigation', arguments: { action: 'get_nav_build_status' }, expected: 'success' },
+  { scenario: 'Material: edit session status', toolName: 'manage_material_authoring', arguments: { action: 'get_material_edit_status' }, expected: 'success' },
+  { scenario: 'Material: apply graph to missing material', toolName: 'manage_material_authoring', arguments: { action: 'apply_material_graph', assetPath: '/Game/IntegrationTest/M_DoesNotExist', spec: 'param Tint vector\nedge Tint -> Main.BaseColor' }, expected: 'not found|could not load' },
+  { scenario: 'Effects: apply Niagara spec to missing system', toolName: 'manage_effect', arguments: { action: 'apply_niagara_spec', systemPath: '/Game/IntegrationTest/NS_DoesNotExist', spec: { emitters: [{ name: 'Sparks', modules: [{ module: 'GravityForce' }] }] } }, expected: 'not found|could not load' },
   { scenario: 'Lighting: list available light types', toolName: 'manage_lighting', arguments: { action: 'list_light_types' }, expected: 'success' },
   { scenario: 'Effects: list available debug shapes', toolName: 'manage_effect', arguments: { action: 'list_debug_shapes' }, expected: 'success' },
   { scenario: 'Sequencer: list available track types', toolName: 'manage_sequence', arguments: { action: 'list_track_types' }, expected: 'success' },
@@ -26,10 +48,20 @@ const testCases = [
   { scenario: 'Actor: spawn StaticMeshActor (cube)', toolName: 'control_actor', arguments: { action: 'spawn', classPath: '/Engine/BasicShapes/Cube', actorName: 'IT_Cube', location: { x: 0, y: 0, z: 200 } }, expected: 'success' },
   { scenario: 'Actor: set transform', toolName: 'control_actor', arguments: { action: 'set_transform', actorName: 'IT_Cube', location: { x: 100, y: 100, z: 300 } }, expected: 'success|not found' },
   { scenario: 'Blueprint: create Actor blueprint', toolName: 'manage_blueprint', arguments: { action: 'create', name: 'BP_IntegrationTest', path: TEST_FOLDER, parentClass: 'Actor' }, expected: 'success|already exists' },
+  { scenario: 'Blueprint: compile queue status', toolName: 'manage_blueprint', arguments: { action: 'get_compile_queue' }, expected: 'success' },
+  { scenario: 'Blueprint: apply graph spec', toolName: 'manage_blueprint', arguments: { action: 'apply_graph', blueprintPath: `${TEST_FOLDER}/BP_IntegrationTest`, spec: { nodes: [{ key: 'begin', type: 'Event', eventName: 'BeginPlay' }, { key: 'print', type: 'PrintString', x: 300, pins: { InString: 'Hello' } }], links: [{ from: 'begin.then', to: 'print.execute' }] } }, expected: 'success' },
+  { scenario: 'Blueprint: flush deferred compiles', toolName: 'manage_blueprint', arguments: { action: 'flush_compiles' }, expected: 'success' },
   { scenario: 'Geometry: Create box primitive', toolName: 'manage_geometry', arguments: { action: 'create_box', actorName: 'GeoTest_Box', dimensions: [100, 100, 100], location: { x: 0, y: 0, z: 100 } }, expected: 'success|already exists' },
+  { scenario: 'Geometry: Upload mesh buffers', toolName: 'manage_geometry', arguments: { action: 'set_mesh_buffers', actorName: 'GeoTest_Box', positions: [0, 0, 0, 100, 0, 0, 0, 100, 0, 100, 100, 0], indices: [0, 1, 2, 1, 3, 2], uvs: [0, 0, 1, 0, 0, 1, 1, 1] }, expected: 'success|not found' },
+  { scenario: 'Geometry: Reject NaN in base64 positions', toolName: 'manage_geometry', arguments: { action: 'set_mesh_buffers', actorName: 'GeoTest_Box', positions: 'AAAAAAAAAAAAAAAAAADAfwAAAAAAAAAAAAAAAAAAyEIAAAAA', indices: [0, 1, 2] }, expected: 'invalid_buffer|not finite' },
+  { scenario: 'Geometry: Download mesh buffers', toolName: 'manage_geometry', arguments: { action: 'get_mesh_buffers', actorName: 'GeoTest_Box', encoding: 'base64' }, expected: 'success|not found' },
+  { scenario: 'Geometry: Apply op pipeline', toolName: 'manage_geometry', arguments: { action: 'apply_geometry_pipeline', actorName: 'GeoTest_Box', useCache: true, ops: [{ op: 'boolean', operation: 'subtract', shape: 'sphere', radius: 40 }, { op: 'simplify', targetPercentage: 50 }, { op: 'recalculate_normals' }] }, expected: 'success|not found' },
+  { scenario: 'Geometry: List background jobs', toolName: 'manage_geometry', arguments: { action: 'list_geometry_jobs' }, expected: 'success' },
+  { scenario: 'Geometry: Cancel unknown job', toolName: 'manage_geometry', arguments: { action: 'cancel_geometry_job', jobId: 'missing-job' }, expected: 'not found' },
   { scenario: 'Skeleton: Get skeleton info', toolName: 'manage_skeleton', arguments: { action: 'get_skeleton_info', skeletonPath: '/Engine/EngineMeshes/SkeletalCube_Skeleton' }, expected: 'success|not found' },
   { scenario: 'Material Authoring: Create material', toolName: 'manage_material_authoring', arguments: { action: 'create_material', name: 'M_AdvTest', path: ADV_TEST_FOLDER }, expected: 'success|already exists' },
   { scenario: 'Texture: Create noise texture', toolName: 'manage_texture', arguments: { action: 'create_noise_texture', name: 'T_TestNoise', path: ADV_TEST_FOLDER }, expected: 'success|already exists' },
+  { scenario: 'Texture: Benchmark image kernels', toolName: 'manage_texture', arguments: { action: 'benchmark_image_kernels', sizes: [256, 512], iterations: 1 }, expected: 'success' },
   { scenario: 'Animation: Create anim blueprint', toolName: 'manage_animation_authoring', arguments: { action: 'create_anim_blueprint', name: 'ABP_Test', path: ADV_TEST_FOLDER, skeletonPath: '/Engine/EngineMeshes/SkeletalCube_Skeleton' }, expected: 'success|already exists|not found' },
   { scenario: 'Niagara: Create niagara system', toolName: 'manage_niagara_authoring', arguments: { action: 'create_niagara_system', name: 'NS_Test', path: ADV_TEST_FOLDER }, expected: 'success|already exists' },
   { scenario: 'GAS: Create attribute set', toolName: 'manage_gas', arguments: { action: 'create_attribute_set', name: 'AS_TestAttributes', path: ADV_TEST_FOLDER }, expected: 'success|already exists' },
@@ -37,6 +69,8 @@ const testCases = [
   { scenario: 'AI: Create AI controller', toolName: 'manage_ai', arguments: { action: 'create_ai_controller', name: 'AIC_Test', path: ADV_TEST_FOLDER }, expected: 'success|already exists' },
   { scenario: 'Interaction: Create door actor', toolName: 'manage_interaction', arguments: { action: 'create_door_actor', name: 'BP_TestDoor', path: ADV_TEST_FOLDER }, expected: 'success|already exists' },
   { scenario: 'Widget: Create widget blueprint', toolName: 'manage_widget_authoring', arguments: { action: 'create_widget_blueprint', name: 'WBP_TestWidget', path: ADV_TEST_FOLDER }, expected: 'success|already exists' },
+  { scenario: 'Widget: Apply widget tree', toolName: 'manage_widget_authoring', arguments: { action: 'apply_widget_tree', widgetPath: `${ADV_TEST_FOLDER}/WBP_TestWidget`, spec: { root: { name: 'RootCanvas', type: 'CanvasPanel', children: [{ name: 'Title', type: 'TextBlock', text: 'Hello', slot: { anchors: 'TopCenter', position: { x: 0, y: 40 }, autoSize: true } }, { name: 'Stats', type: 'VerticalBox', children: [{ name: 'HealthBar', type: 'ProgressBar', properties: { Percent: 0.5 } }] }] } } }, expected: 'success|not found' },
+  { scenario: 'Audio: Apply audio graph', toolName: 'manage_audio', arguments: { action: 'apply_audio_graph', assetPath: `${ADV_TEST_FOLDER}/SC_TestGraph`, assetType: 'SoundCue', spec: { nodes: [{ key: 'early', type: 'delay', delay: 0.1 }, { key: 'late', type: 'delay', delay: 0.3 }, { key: 'mix', type: 'mixer', inputs: ['early', 'late'] }, { key: 'out', type: 'modulator', volume: 0.8, inputs: ['mix'] }], output: 'out' } }, expected: 'success' },
   { scenario: 'Networking: Set property replicated', toolName: 'manage_networking', arguments: { action: 'set_property_replicated', blueprintPath: `${ADV_TEST_FOLDER}/BP_TestCharacter`, propertyName: 'Health', replicated: true }, expected: 'success|not found' },
   { scenario: 'Game Framework: Create game mode', toolName: 'manage_game_framework', arguments: { action: 'create_game_mode', name: 'GM_Test', path: ADV_TEST_FOLDER }, expected: 'success|already exists' },
   { scenario: 'Game Framework: Get info', toolName: 'manage_game_framework', arguments: { action: 'get_game_framework_info', gameModeBlueprint: `${ADV_TEST_FOLDER}/GM_Test` }, expected: 'success|not found' },
@@ -65,12 +99,19 @@ const testCases = [
   { scenario: 'Navigation: Create nav link proxy', toolName: 'manage_navigation', arguments: { action: 'create_nav_link_proxy', actorName: 'IT_NavLink', location: { x: 0, y: 0, z: 100 }, startPoint: { x: -100, y: 0, z: 0 }, endPoint: { x: 100, y: 0, z: 0 }, direction: 'BothWays' }, expected: 'success' },
   { scenario: 'Navigation: Configure nav link', toolName: 'manage_navigation', arguments: { action: 'configure_nav_link', actorName: 'IT_NavLink', snapRadius: 30 }, expected: 'success|not found' },
   { scenario: 'Navigation: Set nav link type', toolName: 'manage_navigation', arguments: { action: 'set_nav_link_type', actorName: 'IT_NavLink', linkType: 'smart' }, expected: 'success|not found' },
+  { scenario: 'Navigation: place obstacle in nav bounds', toolName: 'control_actor', arguments: { action: 'spawn', classPath: '/Engine/BasicShapes/Cube', actorName: 'IT_NavObstacle', location: { x: 0, y: 500, z: 50 } }, expected: 'success' },
+  { scenario: 'Navigation: path around fresh obstacle', toolName: 'manage_navigation', arguments: { action: 'find_paths', pairs: [{ start: [-800, 500, 0], end: [800, 500, 0] }], includePoints: true }, expected: 'success|NO_NAVMESH' },
+  { scenario: 'Cleanup: delete nav obstacle', toolName: 'control_actor', arguments: { action: 'delete', actorName: 'IT_NavObstacle' }, expected: 'success|not found' },
   // Phase 26: Spline System
   { scenario: 'Splines: Create spline actor', toolName: 'manage_splines', arguments: { action: 'create_spline_actor', actorName: 'IT_SplineActor', location: { x: 0, y: 0, z: 100 }, bClosedLoop: false }, expected: 'success' },
   { scenario: 'Splines: Add spline point', toolName: 'manage_splines', arguments: { action: 'add_spline_point', actorName: 'IT_SplineActor', position: { x: 500, y: 0, z: 100 } }, expected: 'success|not found' },
   { scenario: 'Splines: Set spline point position', toolName: 'manage_splines', arguments: { action: 'set_spline_point_position', actorName: 'IT_SplineActor', pointIndex: 1, position: { x: 600, y: 100, z: 150 } }, expected: 'success|not found' },
   { scenario: 'Splines: Set spline type', toolName: 'manage_splines', arguments: { action: 'set_spline_type', actorName: 'IT_SplineActor', splineType: 'linear' }, expected: 'success|not found' },
   { scenario: 'Splines: Create road spline', toolName: 'manage_splines', arguments: { action: 'create_road_spline', actorName: 'IT_RoadSpline', location: { x: 1000, y: 0, z: 0 }, width: 400 }, expected: 'success' },
+  { scenario: 'Splines: Store scatter spacing', toolName: 'manage_splines', arguments: { action: 'configure_mesh_spacing', actorName: 'IT_RoadSpline', spacing: 150, useRandomOffset: true, randomOffsetRange: 20 }, expected: 'success|not found' },
+  { scenario: 'Splines: Store scatter randomization', toolName: 'manage_splines', arguments: { action: 'configure_mesh_randomization', actorName: 'IT_RoadSpline', bRandomizeScale: true, scaleMin: 0.9, scaleMax: 1.1, randomSeed: 7 }, expected: 'success|not found' },
+  { scenario: 'Splines: Scatter meshes as components', toolName: 'manage_splines', arguments: { action: 'scatter_meshes_along_spline', actorName: 'IT_RoadSpline', meshPath: '/Engine/BasicShapes/Cube', instancingMode: 'none' }, expected: 'success|not found' },
+  { scenario: 'Splines: Scatter meshes as HISM', toolName: 'manage_splines', arguments: { action: 'scatter_meshes_along_spline', actorName: 'IT_RoadSpline', meshPath: '/Engine/BasicShapes/Cube', instancingMode: 'hism', clearExisting: true }, expected: 'success|not found' },
   { scenario: 'Splines: Get splines info', toolName: 'manage_splines', arguments: { action: 'get_splines_info' }, expected: 'success' },
   { scenario: 'Splines: Get specific spline info', toolName: 'manage_splines', arguments: { action: 'get_splines_info', actorName: 'IT_SplineActor' }, expected: 'success|not found' },
   { scenario: 'Cleanup: delete spline actors', toolName: 'control_actor', arguments: { action: 'delete', actorName: 'IT_SplineActor' }, expected: 'success|not found' },
@@ -82,6 +123,8 @@ const testCases = [
   { scenario: 'Asset: search by text + path filter', toolName: 'manage_asset', arguments: { action: 'search_assets', searchText: 'IntegrationTest', packagePaths: ['/Game/IntegrationTest'], recursivePaths: true }, expected: 'success' },
   { scenario: 'Asset: search with no matches', toolName: 'manage_asset', arguments: { action: 'search_assets', searchText: 'ZZZZZ_NonExistent_Asset_12345' }, expected: 'success' },
   { scenario: 'Asset: search without searchText (structured query)', toolName: 'manage_asset', arguments: { action: 'search_assets', classNames: ['Blueprint'], packagePaths: ['/Game/IntegrationTest'] }, expected: 'success' },
+  { scenario: 'Asset: flush coalesced saves', toolName: 'manage_asset', arguments: { action: 'flush_saves' }, expected: 'success' },
+  { scenario: 'Asset: save queue status', toolName: 'manage_asset', arguments: { action: 'get_save_queue' }, expected: 'success' },
   { scenario: 'Cleanup: delete test actor', toolName: 'control_actor', arguments: { action: 'delete', actorName: 'IT_Cube' }, expected: 'success|not found' },
   { scenario: 'Cleanup: delete test folder', toolName: 'manage_asset', arguments: { action: 'delete', path: TEST_FOLDER, force: true }, expected: 'success|not found' },
   { scenario: 'Cleanup: delete advanced test folder', toolName: 'manage_asset', arguments: { action: 'delete', path: ADV_TEST_FOLDER, force: true }, expected: 'success|not found' }